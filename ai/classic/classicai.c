@@ -437,6 +437,16 @@ static void cai_switch_to_explore(struct unit *punit, struct tile *target,
   dai_switch_to_explore(deftype, punit, target, allow);
 }
 
+/**********************************************************************//**
+  Call default ai with classic ai type as parameter.
+**************************************************************************/
+static void cai_do_phase_planning(struct player *pplayer)
+{
+  struct ai_type *deftype = classic_ai_get_self();
+
+  dai_do_phase_planning(deftype, pplayer);
+}
+
 /**********************************************************************//**
   Call default ai with classic ai type as parameter.
 **************************************************************************/
@@ -666,6 +676,7 @@ bool fc_ai_classic_setup(struct ai_type *ai)
 
   ai->funcs.want_to_explore = cai_switch_to_explore;
 
+  ai->funcs.phase_planning = cai_do_phase_planning;
   ai->funcs.first_activities = cai_do_first_activities;
   ai->funcs.restart_phase = cai_restart_phase;
   ai->funcs.diplomacy_actions = cai_diplomacy_actions;
@@ -677,11 +677,11 @@ static void dai_manage_taxes(struct ai_type *ait, struct player *pplayer)
       }
       cm_result_destroy(cmr);
     } city_list_iterate_end;
-  } else if (celebrate == AI_CELEBRATION_NO) {
+  } else {
     city_list_iterate(pplayer->cities, pcity) {
-      /* KLUDGE: Must refresh to restore the original values which
-       * were clobbered in cm_query_result(), after the tax rates
-       * were changed. */
+      /* Must refresh for the new tax rates, and (KLUDGE) to restore
+       * the original values which were clobbered in cm_query_result(),
+       * if it was called. */
       city_refresh_from_main_map(pcity, NULL);
     } city_list_iterate_end;
   }
@@ -741,16 +741,27 @@ static void dai_manage_government(struct ai_type *ait, struct player *pplayer)
 }
 
 /*************************************************************************//**
-  Activities to be done by AI _before_ human turn.  Here we just move the
-  units intelligently.
+  Planning to be done by AI at the beginning of the phase, before the
+  first activities of any player. This only reads the game state and
+  writes the AI data of pplayer, so it can be done for several players
+  at once.
 *****************************************************************************/
-void dai_do_first_activities(struct ai_type *ait, struct player *pplayer)
+void dai_do_phase_planning(struct ai_type *ait, struct player *pplayer)
 {
-  TIMING_LOG(AIT_ALL, TIMER_START);
   dai_assess_danger_player(ait, pplayer, &(wld.map));
   /* TODO: Make assess_danger save information on what is threatening
    * us and make dai_manage_units and Co act upon this information, trying
    * to eliminate the source of danger */
+}
+
+/*************************************************************************//**
+  Activities to be done by AI _before_ human turn.  Here we just move the
+  units intelligently. The dangers have been assessed already by
+  dai_do_phase_planning().
+*****************************************************************************/
+void dai_do_first_activities(struct ai_type *ait, struct player *pplayer)
+{
+  TIMING_LOG(AIT_ALL, TIMER_START);
 
   TIMING_LOG(AIT_UNITS, TIMER_START);
   dai_manage_units(ait, pplayer);
@@ -319,7 +319,7 @@ static void dai_hunter_try_launch(struct ai_type *ait,
       UNIT_LOG(LOGLEVEL_HUNT, missile, "checking for hunt targets");
       pft_fill_unit_parameter(&parameter, punit);
       parameter.omniscience = !has_handicap(pplayer, H_MAP);
-      pfm = pf_map_new(&parameter);
+      pfm = pf_map_cache_get(&parameter);
 
       pf_map_move_costs_iterate(pfm, ptile, move_cost, FALSE) {
         if (move_cost > missile->moves_left / SINGLE_MOVE) {
@@ -445,7 +445,7 @@ int dai_hunter_manage(struct ai_type *ait, struct player *pplayer,
 
   pft_fill_unit_parameter(&parameter, punit);
   parameter.omniscience = !has_handicap(pplayer, H_MAP);
-  pfm = pf_map_new(&parameter);
+  pfm = pf_map_cache_get(&parameter);
 
   if (original_target) {
     dai_hunter_juiciness(pplayer, punit, original_target,
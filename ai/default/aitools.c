@@ -397,7 +397,6 @@ bool dai_unit_goto_constrained(struct ai_type *ait, struct unit *punit,
                                struct pf_parameter *parameter)
 {
   bool alive = TRUE;
-  struct pf_map *pfm;
   struct pf_path *path;
 
   UNIT_LOG(LOG_DEBUG, punit, "constrained goto to %d,%d", TILE_XY(ptile));
@@ -421,8 +420,7 @@ bool dai_unit_goto_constrained(struct ai_type *ait, struct unit *punit,
     return TRUE;
   }
 
-  pfm = pf_map_new(parameter);
-  path = pf_map_path(pfm, ptile);
+  path = pf_map_path_to_tile(parameter, ptile);
 
   if (path) {
     dai_log_path(punit, path, parameter);
@@ -433,7 +431,6 @@ bool dai_unit_goto_constrained(struct ai_type *ait, struct unit *punit,
   }
 
   pf_path_destroy(path);
-  pf_map_destroy(pfm);
 
   return alive;
 }
@@ -454,6 +451,7 @@ bool goto_is_sane(struct unit *punit, struct tile *ptile)
     struct pf_map *pfm;
 
     pft_fill_unit_attack_param(&parameter, punit);
+    parameter.goal_tile = ptile;
     pfm = pf_map_new(&parameter);
 
     if (pf_map_move_cost(pfm, ptile) != PF_IMPOSSIBLE_MC) {
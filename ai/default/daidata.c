@@ -463,9 +463,7 @@ void dai_adjust_policies(struct ai_type *ait, struct player *pplayer)
 
         pplayer->multipliers[pidx].value = MAX(mp_val - ppol->step, ppol->start);
 
-        city_list_iterate(pplayer->cities, acity) {
-          auto_arrange_workers(acity);
-        } city_list_iterate_end;
+        auto_arrange_workers_list(pplayer->cities);
 
         city_list_iterate(pplayer->cities, pcity) {
           new_value += dai_city_want(pplayer, pcity, adv, NULL);
@@ -486,9 +484,7 @@ void dai_adjust_policies(struct ai_type *ait, struct player *pplayer)
 
         pplayer->multipliers[pidx].value = MIN(mp_val + ppol->step, ppol->stop);
 
-        city_list_iterate(pplayer->cities, acity) {
-          auto_arrange_workers(acity);
-        } city_list_iterate_end;
+        auto_arrange_workers_list(pplayer->cities);
 
         city_list_iterate(pplayer->cities, pcity) {
           new_value += dai_city_want(pplayer, pcity, adv, NULL);
@@ -512,9 +508,7 @@ void dai_adjust_policies(struct ai_type *ait, struct player *pplayer)
   } multipliers_iterate_end;
 
   if (needs_back_rearrange) {
-    city_list_iterate(pplayer->cities, acity) {
-      auto_arrange_workers(acity);
-    } city_list_iterate_end;
+    auto_arrange_workers_list(pplayer->cities);
   }
 }
 
@@ -547,9 +541,7 @@ void dai_gov_value(struct ai_type *ait, struct player *pplayer,
   /* Ideally we should change tax rates here, but since
    * this is a rather big CPU operation, we'd rather not. */
   check_player_max_rates(pplayer);
-  city_list_iterate(pplayer->cities, acity) {
-    auto_arrange_workers(acity);
-  } city_list_iterate_end;
+  auto_arrange_workers_list(pplayer->cities);
   city_list_iterate(pplayer->cities, pcity) {
     bool capital;
     const struct req_context context = { .player = pplayer, .city = pcity };
@@ -1305,7 +1305,7 @@ static void process_attacker_want(struct ai_type *ait,
       pft_fill_utype_parameter(&parameter, punittype, city_tile(pcity),
                                pplayer);
       parameter.omniscience = !has_handicap(pplayer, H_MAP);
-      pfm = pf_map_new(&parameter);
+      pfm = pf_map_cache_get(&parameter);
 
       /* Set the move_time appropriately. */
       move_time = -1;
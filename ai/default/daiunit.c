@@ -531,7 +531,7 @@ static struct pf_path *find_rampage_target(struct unit *punit,
    * Hence no call ai_avoid_risks()
    */
 
-  tgt_map = pf_map_new(&parameter);
+  tgt_map = pf_map_cache_get(&parameter);
   pf_map_move_costs_iterate(tgt_map, iter_tile, move_cost, FALSE) {
     int want;
     bool move_needed;
@@ -727,7 +727,7 @@ adv_want look_for_charge(struct ai_type *ait, struct player *pplayer,
 
   pft_fill_unit_parameter(&parameter, punit);
   parameter.omniscience = !has_handicap(pplayer, H_MAP);
-  pfm = pf_map_new(&parameter);
+  pfm = pf_map_cache_get(&parameter);
 
   pf_map_move_costs_iterate(pfm, ptile, move_cost, TRUE) {
     if (move_cost > max_move_cost) {
@@ -1271,7 +1271,7 @@ adv_want find_something_to_kill(struct ai_type *ait, struct player *pplayer,
 
   pft_fill_unit_attack_param(&parameter, punit);
   parameter.omniscience = !has_handicap(pplayer, H_MAP);
-  punit_map = pf_map_new(&parameter);
+  punit_map = pf_map_cache_get(&parameter);
 
   if (MOVE_NONE == punit_class->adv.sea_move) {
     /* We need boat to move over sea. */
@@ -1298,7 +1298,7 @@ adv_want find_something_to_kill(struct ai_type *ait, struct player *pplayer,
     boattype = unit_type_get(ferryboat);
     pft_fill_unit_overlap_param(&parameter, ferryboat);
     parameter.omniscience = !has_handicap(pplayer, H_MAP);
-    ferry_map = pf_map_new(&parameter);
+    ferry_map = pf_map_cache_get(&parameter);
   } else {
     boattype = best_role_unit_for_player(pplayer, L_FERRYBOAT);
     if (NULL == boattype) {
@@ -1310,7 +1310,7 @@ adv_want find_something_to_kill(struct ai_type *ait, struct player *pplayer,
       pft_fill_utype_overlap_param(&parameter, boattype, punit_tile,
                                    pplayer);
       parameter.omniscience = !has_handicap(pplayer, H_MAP);
-      ferry_map = pf_map_new(&parameter);
+      ferry_map = pf_map_cache_get(&parameter);
     } else {
       ferry_map = NULL;
     }
@@ -1626,7 +1626,7 @@ struct city *find_nearest_safe_city(struct unit *punit)
 
   pft_fill_unit_parameter(&parameter, punit);
   parameter.omniscience = !has_handicap(pplayer, H_MAP);
-  pfm = pf_map_new(&parameter);
+  pfm = pf_map_cache_get(&parameter);
 
   pf_map_move_costs_iterate(pfm, ptile, move_cost, TRUE) {
     if (move_cost > best) {
@@ -2971,7 +2971,7 @@ static void dai_manage_barbarian_leader(struct ai_type *ait,
   if (0 < body_guards) {
     pft_fill_unit_parameter(&parameter, leader);
     parameter.omniscience = !has_handicap(pplayer, H_MAP);
-    pfm = pf_map_new(&parameter);
+    pfm = pf_map_cache_get(&parameter);
 
     /* Find the closest body guard. FIXME: maybe choose the strongest too? */
     pf_map_tiles_iterate(pfm, ptile, FALSE) {
@@ -3412,7 +3412,7 @@ bool dai_unit_can_strike_my_unit(const struct unit *attacker,
 
   pft_fill_unit_parameter(&parameter, attacker);
   parameter.omniscience = !has_handicap(unit_owner(defender), H_MAP);
-  pfm = pf_map_new(&parameter);
+  pfm = pf_map_cache_get(&parameter);
 
   pf_map_move_costs_iterate(pfm, ptile, move_cost, FALSE) {
     if (move_cost > max_move_cost) {
@@ -417,6 +417,15 @@ static void texwai_switch_to_explore(struct unit *punit, struct tile *target,
   TEXAI_DFUNC(dai_switch_to_explore, punit, target, allow);
 }
 
+/**********************************************************************//**
+  Call default ai with tex ai type as parameter.
+**************************************************************************/
+static void texwai_phase_planning(struct player *pplayer)
+{
+  TEXAI_AIT;
+  TEXAI_DFUNC(dai_do_phase_planning, pplayer);
+}
+
 /**********************************************************************//**
   Call default ai with tex ai type as parameter.
 **************************************************************************/
@@ -647,6 +656,7 @@ bool fc_ai_tex_setup(struct ai_type *ai)
 
   ai->funcs.want_to_explore = texwai_switch_to_explore;
 
+  ai->funcs.phase_planning = texwai_phase_planning;
   ai->funcs.first_activities = texwai_first_activities;
   ai->funcs.restart_phase = texwai_restart_phase;
   ai->funcs.diplomacy_actions = texwai_diplomacy_actions;
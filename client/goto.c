@@ -171,6 +171,8 @@ void free_client_goto(void)
 
   goto_destination = NULL;
   goto_warned = FALSE;
+
+  pf_map_pools_free();
 }
 
 /************************************************************************//**
@@ -1547,13 +1549,10 @@ void send_rally_path(struct city *pcity, struct unit *punit,
 bool send_goto_tile(struct unit *punit, struct tile *ptile)
 {
   struct pf_parameter parameter;
-  struct pf_map *pfm;
   struct pf_path *path;
 
   goto_fill_parameter_base(&parameter, punit);
-  pfm = pf_map_new(&parameter);
-  path = pf_map_path(pfm, ptile);
-  pf_map_destroy(pfm);
+  path = pf_map_path_to_tile(&parameter, ptile);
 
   if (path) {
     send_goto_path(punit, path, NULL);
@@ -1574,7 +1573,6 @@ bool send_rally_tile(struct city *pcity, struct tile *ptile)
   struct unit *punit;
 
   struct pf_parameter parameter;
-  struct pf_map *pfm;
   struct pf_path *path;
 
   fc_assert_ret_val(pcity != NULL, FALSE);
@@ -1592,9 +1590,7 @@ bool send_rally_tile(struct city *pcity, struct tile *ptile)
 
   /* Use the unit to find a path to the destination tile. */
   goto_fill_parameter_base(&parameter, punit);
-  pfm = pf_map_new(&parameter);
-  path = pf_map_path(pfm, ptile);
-  pf_map_destroy(pfm);
+  path = pf_map_path_to_tile(&parameter, ptile);
 
   if (path) {
     /* Send orders to server. */
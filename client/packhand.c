@@ -3332,6 +3332,86 @@ void handle_tile_info(const struct packet_tile_info *packet)
    * case of changes in worked tiles above. */
 }
 
+/* Position in the runs of one field of a PACKET_TILE_INFO_CHUNK. */
+struct tile_chunk_cursor {
+  int run;
+  int left;
+};
+
+/************************************************************************//**
+  Move the cursor to the next tile. Returns FALSE if the runs end first.
+****************************************************************************/
+static bool tile_chunk_next(struct tile_chunk_cursor *cursor,
+                            const int *len, int runs)
+{
+  while (0 == cursor->left) {
+    if (cursor->run + 1 >= runs) {
+      return FALSE;
+    }
+    cursor->run++;
+    cursor->left = len[cursor->run];
+  }
+  cursor->left--;
+
+  return TRUE;
+}
+
+/************************************************************************//**
+  Packet tile_info_chunk handler. Each tile of the chunk is handled as a
+  tile_info packet.
+****************************************************************************/
+void handle_tile_info_chunk(const struct packet_tile_info_chunk *packet)
+{
+  struct tile_chunk_cursor known = { -1, 0 }, continent = { -1, 0 };
+  struct tile_chunk_cursor owner = { -1, 0 }, extras_owner = { -1, 0 };
+  struct tile_chunk_cursor worked = { -1, 0 }, terrain = { -1, 0 };
+  struct tile_chunk_cursor resource = { -1, 0 }, extras = { -1, 0 };
+  struct packet_tile_info info;
+  int i;
+
+  info.placing = -1;
+  info.place_turn = 0;
+  info.spec_sprite[0] = '\0';
+  info.label[0] = '\0';
+
+  for (i = 0; i < packet->count; i++) {
+    if (!tile_chunk_next(&known, packet->known_len, packet->known_runs)
+        || !tile_chunk_next(&continent, packet->continent_len,
+                            packet->continent_runs)
+        || !tile_chunk_next(&owner, packet->owner_len, packet->owner_runs)
+        || !tile_chunk_next(&extras_owner, packet->extras_owner_len,
+                            packet->extras_owner_runs)
+        || !tile_chunk_next(&worked, packet->worked_len,
+                            packet->worked_runs)
+        || !tile_chunk_next(&terrain, packet->terrain_len,
+                            packet->terrain_runs)
+        || !tile_chunk_next(&resource, packet->resource_len,
+                            packet->resource_runs)
+        || !tile_chunk_next(&extras, packet->extras_len,
+                            packet->extras_runs)) {
+      log_error("handle_tile_info_chunk() runs end at tile %d of %d.",
+                i, packet->count);
+      return;
+    }
+
+    if (TILE_CHUNK_SKIPPED == packet->known[known.run]) {
+      continue;
+    }
+
+    info.tile = packet->first + i;
+    info.known = packet->known[known.run];
+    info.continent = packet->continent[continent.run];
+    info.owner = packet->owner[owner.run];
+    info.extras_owner = packet->extras_owner[extras_owner.run];
+    info.worked = packet->worked[worked.run];
+    info.terrain = packet->terrain[terrain.run];
+    info.resource = packet->resource[resource.run];
+    info.extras = packet->extras[extras.run];
+
+    handle_tile_info(&info);
+  }
+}
+
 /************************************************************************//**
   Received packet containing info about current scenario
 ****************************************************************************/
@@ -3861,6 +3941,7 @@ void handle_ruleset_building(const struct packet_ruleset_building *p)
     requirement_vector_append(&b->reqs, p->reqs[i]);
   }
   fc_assert(b->reqs.size == p->reqs_count);
+  req_program_invalidate(&b->reqs_prog);
   for (i = 0; i < p->obs_count; i++) {
     requirement_vector_append(&b->obsolete_by, p->obs_reqs[i]);
   }
@@ -4403,11 +4484,13 @@ handle_ruleset_action_enabler(const struct packet_ruleset_action_enabler *p)
     requirement_vector_append(&enabler->actor_reqs, p->actor_reqs[i]);
   }
   fc_assert(enabler->actor_reqs.size == p->actor_reqs_count);
+  req_program_invalidate(&enabler->actor_reqs_prog);
 
   for (i = 0; i < p->target_reqs_count; i++) {
     requirement_vector_append(&enabler->target_reqs, p->target_reqs[i]);
   }
   fc_assert(enabler->target_reqs.size == p->target_reqs_count);
+  req_program_invalidate(&enabler->target_reqs_prog);
 
   action_enabler_add(enabler);
 }
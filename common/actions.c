@@ -2385,6 +2385,8 @@ struct action_enabler *action_enabler_new(void)
   enabler->ruledit_disabled = FALSE;
   requirement_vector_init(&enabler->actor_reqs);
   requirement_vector_init(&enabler->target_reqs);
+  req_program_init(&enabler->actor_reqs_prog);
+  req_program_init(&enabler->target_reqs_prog);
 
   /* Make sure that action doesn't end up as a random value that happens to
    * be a valid action id. */
@@ -2400,6 +2402,8 @@ void action_enabler_free(struct action_enabler *enabler)
 {
   requirement_vector_free(&enabler->actor_reqs);
   requirement_vector_free(&enabler->target_reqs);
+  req_program_free(&enabler->actor_reqs_prog);
+  req_program_free(&enabler->target_reqs_prog);
 
   free(enabler);
 }
@@ -4710,10 +4714,14 @@ static bool is_enabler_active(const struct action_enabler *enabler,
                               const struct req_context *actor,
                               const struct req_context *target)
 {
-  return are_reqs_active(actor, target != NULL ? target->player : NULL,
-                         &enabler->actor_reqs, RPT_CERTAIN)
-      && are_reqs_active(target, actor != NULL ? actor->player : NULL,
-                         &enabler->target_reqs, RPT_CERTAIN);
+  return are_reqs_active_prog(actor,
+                              target != NULL ? target->player : NULL,
+                              &enabler->actor_reqs,
+                              &enabler->actor_reqs_prog, RPT_CERTAIN)
+      && are_reqs_active_prog(target,
+                              actor != NULL ? actor->player : NULL,
+                              &enabler->target_reqs,
+                              &enabler->target_reqs_prog, RPT_CERTAIN);
 }
 
 /**********************************************************************//**
@@ -7217,8 +7225,8 @@ static bool is_target_possible(const action_id wanted_action,
 {
   action_enabler_list_iterate(action_enablers_for_action(wanted_action),
                               enabler) {
-    if (are_reqs_active(target, actor_player,
-                        &enabler->target_reqs, RPT_POSSIBLE)) {
+    if (are_reqs_active_prog(target, actor_player, &enabler->target_reqs,
+                             &enabler->target_reqs_prog, RPT_POSSIBLE)) {
       return TRUE;
     }
   } action_enabler_list_iterate_end;
@@ -390,6 +390,10 @@ struct action_enabler
   struct requirement_vector actor_reqs;
   struct requirement_vector target_reqs;
 
+  /* The requirements compiled for evaluation */
+  struct req_program actor_reqs_prog;
+  struct req_program target_reqs_prog;
+
   /* Only relevant for ruledit and other rulesave users. Indicates that
    * this action enabler is deleted and shouldn't be saved. */
   bool ruledit_disabled;
@@ -24,7 +24,7 @@ extern "C" {
  * structure below. When changing mandatory capability part, check that
  * there's enough reserved_xx pointers in the end of the structure for
  * taking to use without need to bump mandatory capability again. */
-#define FC_AI_MOD_CAPSTR "+Freeciv-3.2-ai-module-2021.Mar.01"
+#define FC_AI_MOD_CAPSTR "+Freeciv-3.2-ai-module-2021.Mar.01 phase_planning"
 
 /* Timers for all AI activities. Define it to get statistics about the AI. */
 #ifdef FREECIV_DEBUG
@@ -316,6 +316,12 @@ struct ai_type
      */
     void (*unit_info)(struct unit *punit);
 
+    /* Called for player AI type in the beginning of player phase, before
+     * first_activities of any player. Calls for different players may run
+     * at the same time in different threads, so this must not change
+     * anything but the AI data of the player itself. */
+    void (*phase_planning)(struct player *pplayer);
+
     /* These are here reserving space for future optional callbacks.
      * This way we don't need to change the mandatory capability of the AI module
      * interface when adding such callbacks, but existing modules just have these
@@ -324,7 +330,6 @@ struct ai_type
      * version to do so.
      * When mandatory capability then changes again, please add new reservations to
      * replace those taken to use. */
-    void (*reserved_01)(void);
     void (*reserved_02)(void);
     void (*reserved_03)(void);
     void (*reserved_04)(void);
@@ -20,6 +20,7 @@
 
 /* utility */
 #include "fcintl.h"
+#include "fcthread.h"
 #include "log.h"
 #include "mem.h"
 #include "shared.h"
@@ -28,6 +29,7 @@
 
 /* common */
 #include "city.h"
+#include "effects.h"
 #include "game.h"
 #include "government.h"
 #include "map.h"
@@ -114,6 +116,12 @@ static struct {
 static void print_performance(struct one_perf *counts);
 #endif /* GATHER_TIME_STATS */
 
+/* The key for qsort(). Queries may run in several threads at once, so
+ * the sorting is protected by compare_key_mutex. */
+static Output_type_id compare_key;
+static double compare_key_trade_bonus;
+static fc_mutex compare_key_mutex;
+
 /* Fitness of a solution.  */
 struct cm_fitness {
   int weighted; /* weighted sum */
@@ -292,7 +300,10 @@ static bool choice_is_promising(struct cm_state *state, int newchoice,
 ****************************************************************************/
 void cm_init(void)
 {
-  /* In the B&B algorithm there's not really anything to initialize. */
+  /* In the B&B algorithm there's not really anything to initialize,
+   * but the lock of the lattice sorting. */
+  fc_mutex_init(&compare_key_mutex);
+
 #ifdef GATHER_TIME_STATS
   memset(&performance, 0, sizeof(performance));
 
@@ -337,6 +348,8 @@ void cm_free(void)
   timer_destroy(performance.opt.wall_timer);
   memset(&performance, 0, sizeof(performance));
 #endif /* GATHER_TIME_STATS */
+
+  fc_mutex_destroy(&compare_key_mutex);
 }
 
 /************************************************************************//**
@@ -890,9 +903,6 @@ static int compare_tile_type_by_fitness(const void *va, const void *vb)
   return compare_tile_type_by_lattice_order(*a, *b);
 }
 
-static Output_type_id compare_key;
-static double compare_key_trade_bonus;
-
 /************************************************************************//**
   Compare by the production of type compare_key.
   If a produces more food than b, then a cannot be a child of b, so
@@ -1856,6 +1866,7 @@ static struct cm_state *cm_state_init(struct city *pcity, bool negative_ok)
   get_tax_rates(pplayer, rates);
 
   /* For the heuristic, make sorted copies of the lattice */
+  fc_mutex_allocate(&compare_key_mutex);
   output_type_iterate(stat_index) {
     int lsize = tile_type_vector_size(&state->lattice);
 
@@ -1883,6 +1894,7 @@ static struct cm_state *cm_state_init(struct city *pcity, bool negative_ok)
             compare_tile_type_by_stat);
     }
   } output_type_iterate_end;
+  fc_mutex_release(&compare_key_mutex);
 
   state->min_luxury = - FC_INFINITY;
 
@@ -2092,12 +2104,17 @@ void cm_query_result(struct city *pcity,
 {
   struct cm_state *state = cm_state_init(pcity, negative_ok);
 
+  /* Only the placement of the workers changes during the search, which
+   * the effects of the city don't depend on. */
+  city_effect_cache_begin(pcity);
+
   /* Refresh the city.  Otherwise the CM can give wrong results or just be
    * slower than necessary.  Note that cities are often passed in in an
    * unrefreshed state (which should probably be fixed). */
   city_refresh_from_main_map(pcity, NULL);
 
   cm_find_best_solution(state, param, result, negative_ok);
+  city_effect_cache_end(pcity);
   cm_state_free(state);
 }
 
@@ -15,8 +15,11 @@
 #include <fc_config.h>
 #endif
 
+#include <string.h>
+
 /* utility */
 #include "bitvector.h"
+#include "fcthread.h"
 #include "log.h"
 #include "mem.h"
 #include "support.h"
@@ -51,7 +54,8 @@
 enum pf_mode {
   PF_NORMAL = 1,        /* Usual goto */
   PF_DANGER,            /* Goto with dangerous positions */
-  PF_FUEL               /* Goto for fueled units */
+  PF_FUEL,              /* Goto for fueled units */
+  PF_SHARED             /* Handle on a cached map */
 };
 #endif /* PF_DEBUG */
 
@@ -91,6 +95,8 @@ struct pf_map {
   /* Private data. */
   struct tile *tile;          /* The current position (aka iterator). */
   struct pf_parameter params; /* Initial parameters. */
+  struct pf_cache_entry *cache_entry; /* Where to record the iteration when
+                                       * the map is shared, or NULL. */
 };
 
 /* Down-cast macro. */
@@ -175,6 +181,25 @@ static inline int pf_total_CC(const struct pf_parameter *param,
   return PF_TURN_FACTOR * cost + extra * pf_move_rate(param);
 }
 
+/************************************************************************//**
+  Lowest move cost a single step can have for the unit type of the
+  parameter, before being adjusted to the moves left. Steps into unknown
+  tiles, actions, and moves into non-native tiles are considered too.
+****************************************************************************/
+static int pf_min_step_cost(const struct pf_parameter *param)
+{
+  const struct unit_type *utype = param->utype;
+  int cost = utype_class(utype)->cache.min_move_cost;
+
+  if (utype_has_flag(utype, UTYF_IGTER)) {
+    cost = MIN(cost, MOVE_COST_IGTER);
+  }
+  cost = MIN(cost, utype->unknown_move_cost);
+  cost = MIN(cost, param->move_rate);
+
+  return MAX(cost, 0);
+}
+
 /************************************************************************//**
   Take a position previously filled out (as by fill_position) and "finalize"
   it by reversing all fuel multipliers.
@@ -196,6 +221,122 @@ pf_path_new_to_start_tile(const struct pf_parameter *param);
 static void pf_position_fill_start_tile(struct pf_position *pos,
                                         const struct pf_parameter *param);
 
+/* ============================ Lattice pools ============================ */
+
+/* Allocating and zeroing a full map of nodes for every pf_map is the main
+ * cost of short searches on large maps. Instead, the lattices of the
+ * destroyed maps are kept in a pool. Every node has a generation stamp;
+ * a node which doesn't carry the generation of the map which uses the
+ * lattice is stale, and is reset at first access. Then a recycled lattice
+ * doesn't need to be cleared.
+ *
+ * The pools and the statistics are protected by a mutex, so that maps can
+ * be created and destroyed from several threads at once, as long as each
+ * map is used by only one of them. */
+
+enum pf_lattice_kind {
+  PF_LATTICE_NORMAL = 0,
+  PF_LATTICE_DANGER,
+  PF_LATTICE_FUEL,
+  PF_LATTICE_KIND_NUM
+};
+
+/* Maximum number of free lattices to keep for every kind. */
+#define PF_LATTICE_POOL_MAX 4
+
+struct pf_lattice {
+  void *nodes;                  /* The nodes themselves. */
+  int nodes_num;                /* Number of nodes (MAP_INDEX_SIZE). */
+  size_t size;                  /* Size of 'nodes' in bytes. */
+  unsigned short generation;    /* Stamp of the current user. */
+  struct pf_lattice *next;      /* Next free lattice in the pool. */
+};
+
+static struct pf_lattice *pf_lattice_pool[PF_LATTICE_KIND_NUM];
+static int pf_lattice_pool_size[PF_LATTICE_KIND_NUM];
+static struct pf_map_stats pf_stats;
+static fc_mutex pf_lattice_mutex;
+
+/************************************************************************//**
+  Free a lattice and its nodes.
+****************************************************************************/
+static void pf_lattice_free(struct pf_lattice *plattice)
+{
+  free(plattice->nodes);
+  free(plattice);
+}
+
+/************************************************************************//**
+  Get a lattice of nodes of size 'node_size' for a new map, from the pool
+  if possible. The nodes of the returned lattice are valid only if their
+  generation stamp matches the one of the lattice.
+****************************************************************************/
+static struct pf_lattice *pf_lattice_acquire(enum pf_lattice_kind kind,
+                                             size_t node_size)
+{
+  struct pf_lattice *plattice;
+
+  fc_mutex_allocate(&pf_lattice_mutex);
+  pf_stats.maps_created++;
+
+  while (NULL != (plattice = pf_lattice_pool[kind])) {
+    pf_lattice_pool[kind] = plattice->next;
+    pf_lattice_pool_size[kind]--;
+
+    if (plattice->nodes_num == MAP_INDEX_SIZE) {
+      break;
+    }
+
+    /* Allocated for another map. */
+    pf_lattice_free(plattice);
+  }
+
+  if (NULL != plattice) {
+    plattice->generation++;
+    if (0 == plattice->generation) {
+      /* Wrapped around, the stamps of the nodes cannot be trusted
+       * anymore. */
+      memset(plattice->nodes, 0, plattice->size);
+      plattice->generation = 1;
+    }
+    plattice->next = NULL;
+    pf_stats.lattices_recycled++;
+    pf_stats.bytes_recycled += plattice->size;
+  } else {
+    plattice = fc_malloc(sizeof(*plattice));
+    plattice->nodes_num = MAP_INDEX_SIZE;
+    plattice->size = MAP_INDEX_SIZE * node_size;
+    plattice->nodes = fc_calloc(MAP_INDEX_SIZE, node_size);
+    /* Zeroed nodes have the generation 0, so they are all stale. */
+    plattice->generation = 1;
+    plattice->next = NULL;
+    pf_stats.bytes_allocated += plattice->size;
+  }
+  fc_mutex_release(&pf_lattice_mutex);
+
+  return plattice;
+}
+
+/************************************************************************//**
+  Give back a lattice to the pool when its map is destroyed.
+****************************************************************************/
+static void pf_lattice_release(enum pf_lattice_kind kind,
+                               struct pf_lattice *plattice)
+{
+  fc_mutex_allocate(&pf_lattice_mutex);
+  if (PF_LATTICE_POOL_MAX <= pf_lattice_pool_size[kind]
+      || plattice->nodes_num != MAP_INDEX_SIZE) {
+    fc_mutex_release(&pf_lattice_mutex);
+    pf_lattice_free(plattice);
+    return;
+  }
+
+  plattice->next = pf_lattice_pool[kind];
+  pf_lattice_pool[kind] = plattice;
+  pf_lattice_pool_size[kind]++;
+  fc_mutex_release(&pf_lattice_mutex);
+}
+
 
 /* ================ Specific pf_normal_* mode structures ================= */
 
@@ -222,6 +363,7 @@ struct pf_normal_node {
   unsigned behavior : 2;        /* 'enum tile_behavior' really. */
   unsigned zoc_number : 2;      /* 'enum pf_zoc_type' really. */
   unsigned short extra_tile;    /* EC */
+  unsigned short generation;    /* See pf_normal_map_node(). */
 };
 
 /* Derived structure of struct pf_map. */
@@ -231,7 +373,13 @@ struct pf_normal_map {
   struct map_index_pq *queue; /* Queue of nodes we have reached but not
                                * processed yet (NS_NEW), sorted by their
                                * total_CC. */
+  struct pf_lattice *plattice;  /* Lattice storage. */
   struct pf_normal_node *lattice; /* Lattice of nodes. */
+  unsigned short generation;    /* Stamp of the valid nodes. */
+
+  const struct tile *goal_tile; /* Target of the A* search, or NULL. */
+  int min_step_cost;            /* Lowest possible cost of a step, for the
+                                 * A* heuristic. */
 };
 
 /* Up-cast macro. */
@@ -251,6 +399,24 @@ pf_normal_map_check(struct pf_map *pfm, const char *file,
 #define PF_NORMAL_MAP(pfm) ((struct pf_normal_map *) (pfm))
 #endif /* PF_DEBUG */
 
+/************************************************************************//**
+  Return the node of the tile index 'tindex'. The lattice may have been
+  used by a previous map, so a node with an outdated generation stamp is
+  reset here before being used.
+****************************************************************************/
+static inline struct pf_normal_node *
+pf_normal_map_node(const struct pf_normal_map *pfnm, int tindex)
+{
+  struct pf_normal_node *node = pfnm->lattice + tindex;
+
+  if (node->generation != pfnm->generation) {
+    memset(node, 0, sizeof(*node));
+    node->generation = pfnm->generation;
+  }
+
+  return node;
+}
+
 /* ================  Specific pf_normal_* mode functions ================= */
 
 /************************************************************************//**
@@ -403,7 +569,7 @@ static void pf_normal_map_fill_position(const struct pf_normal_map *pfnm,
                                         struct pf_position *pos)
 {
   int tindex = tile_index(ptile);
-  struct pf_normal_node *node = pfnm->lattice + tindex;
+  struct pf_normal_node *node = pf_normal_map_node(pfnm, tindex);
   const struct pf_parameter *params = pf_map_parameter(PF_MAP(pfnm));
 
 #ifdef PF_DEBUG
@@ -438,7 +604,8 @@ static struct pf_path *
 pf_normal_map_construct_path(const struct pf_normal_map *pfnm,
                              struct tile *dest_tile)
 {
-  struct pf_normal_node *node = pfnm->lattice + tile_index(dest_tile);
+  struct pf_normal_node *node = pf_normal_map_node(pfnm,
+                                                   tile_index(dest_tile));
   const struct pf_parameter *params = pf_map_parameter(PF_MAP(pfnm));
   enum direction8 dir_next = direction8_invalid();
   struct pf_path *path;
@@ -463,7 +630,7 @@ pf_normal_map_construct_path(const struct pf_normal_map *pfnm,
     }
 
     ptile = mapstep(params->map, ptile, DIR_REVERSE(node->dir_to_here));
-    node = pfnm->lattice + tile_index(ptile);
+    node = pf_normal_map_node(pfnm, tile_index(ptile));
   }
 
   /* 2: Allocate the memory */
@@ -472,7 +639,7 @@ pf_normal_map_construct_path(const struct pf_normal_map *pfnm,
 
   /* 3: Backtrack again and fill the positions this time */
   ptile = dest_tile;
-  node = pfnm->lattice + tile_index(ptile);
+  node = pf_normal_map_node(pfnm, tile_index(ptile));
 
   for (; i >= 0; i--) {
     pf_normal_map_fill_position(pfnm, ptile, &path->positions[i]);
@@ -484,7 +651,7 @@ pf_normal_map_construct_path(const struct pf_normal_map *pfnm,
     if (i > 0) {
       /* Step further back, if we haven't finished yet */
       ptile = mapstep(params->map, ptile, DIR_REVERSE(dir_next));
-      node = pfnm->lattice + tile_index(ptile);
+      node = pf_normal_map_node(pfnm, tile_index(ptile));
     }
   }
 
@@ -499,6 +666,123 @@ static int pf_normal_map_adjust_cost(int cost, int moves_left)
   return MIN(cost, moves_left);
 }
 
+/************************************************************************//**
+  Returns the minimal number of steps between the tiles. real_map_distance()
+  is not enough: it wraps the native vector, which doesn't always give the
+  shortest map vector on isometric maps. So the neighbour wraps are tried
+  too.
+****************************************************************************/
+static int pf_step_distance(const struct tile *ptile,
+                            const struct tile *goal_tile)
+{
+  int xwrap = (current_wrap_has_flag(WRAP_X) ? 1 : 0);
+  int ywrap = (current_wrap_has_flag(WRAP_Y) ? 1 : 0);
+  int nat_x0, nat_y0, nat_x1, nat_y1, map_x0, map_y0;
+  int dist = FC_INFINITY;
+  int wx, wy;
+
+  index_to_native_pos(&nat_x0, &nat_y0, tile_index(ptile));
+  index_to_native_pos(&nat_x1, &nat_y1, tile_index(goal_tile));
+  NATIVE_TO_MAP_POS(&map_x0, &map_y0, nat_x0, nat_y0);
+
+  for (wx = -xwrap; wx <= xwrap; wx++) {
+    for (wy = -ywrap; wy <= ywrap; wy++) {
+      int map_x1, map_y1;
+
+      NATIVE_TO_MAP_POS(&map_x1, &map_y1, nat_x1 + wx * wld.map.xsize,
+                        nat_y1 + wy * wld.map.ysize);
+      dist = MIN(dist, map_vector_to_real_distance(map_x1 - map_x0,
+                                                   map_y1 - map_y0));
+    }
+  }
+
+  return dist;
+}
+
+/************************************************************************//**
+  A* heuristic. Returns a lower bound of the move cost still needed to
+  reach the goal tile from 'ptile', when 'ptile' is reached with the
+  total_MC 'cost'. Every remaining step is assumed to cost the minimal
+  step cost, adjusted like in pf_normal_map_adjust_cost(). It never
+  overestimates, and doesn't decrease more than the cost of a real step,
+  so nodes are still processed only once.
+****************************************************************************/
+static inline int pf_normal_map_heuristic(const struct pf_normal_map *pfnm,
+                                          const struct tile *ptile,
+                                          int cost)
+{
+  const struct pf_parameter *params = &pfnm->base_map.params;
+  int move_rate = pf_move_rate(params);
+  int step = pfnm->min_step_cost;
+  int dist, moves_left, turn_steps;
+
+  if (0 >= step || 0 >= move_rate) {
+    return 0;
+  }
+
+  dist = pf_step_distance(ptile, pfnm->goal_tile);
+  moves_left = pf_moves_left(params, cost);
+
+  /* Steps during the current turn. The last one may be truncated. */
+  turn_steps = (moves_left + step - 1) / step;
+  if (dist <= turn_steps) {
+    return MIN(dist * step, moves_left);
+  }
+  dist -= turn_steps;
+
+  /* Full turns, then the remaining steps. */
+  turn_steps = (move_rate + step - 1) / step;
+
+  return (moves_left + (dist / turn_steps) * move_rate
+          + (dist % turn_steps) * step);
+}
+
+/************************************************************************//**
+  Returns the priority queue key of a node of total_MC 'cost' and total_CC
+  'cost_of_path' (lower is better). This is total_CC itself, plus the
+  estimated remaining cost for A* searches.
+****************************************************************************/
+static inline int pf_normal_map_key(const struct pf_normal_map *pfnm,
+                                    const struct tile *ptile,
+                                    int cost, int cost_of_path)
+{
+  if (NULL == pfnm->goal_tile) {
+    return cost_of_path;
+  }
+
+  return (cost_of_path
+          + PF_TURN_FACTOR * pf_normal_map_heuristic(pfnm, ptile, cost));
+}
+
+/************************************************************************//**
+  Get the next node to process for A* searches. The queue may contain
+  outdated entries for nodes reached again with a better cost, as A*
+  keys cannot be just raised in place; those are skipped here.
+****************************************************************************/
+static bool pf_normal_map_astar_remove(struct pf_normal_map *pfnm,
+                                       int *tindex)
+{
+  const struct pf_parameter *params = pf_map_parameter(PF_MAP(pfnm));
+  struct pf_normal_node *node;
+  int priority;
+
+  while (map_index_pq_priority(pfnm->queue, &priority)) {
+    fc_assert_action(map_index_pq_remove(pfnm->queue, tindex), break);
+    node = pf_normal_map_node(pfnm, *tindex);
+
+    if (NS_NEW == node->status
+        && -priority == pf_normal_map_key(pfnm,
+                                          index_to_tile(params->map, *tindex),
+                                          node->cost,
+                                          pf_total_CC(params, node->cost,
+                                                      node->extra_cost))) {
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
 /************************************************************************//**
   Bare-bones PF iterator. All Freeciv rules logic is hidden in 'get_costs'
   callback (compare to pf_normal_map_iterate function). This function is
@@ -521,7 +805,7 @@ static bool pf_jumbo_map_iterate(struct pf_map *pfm)
   struct pf_normal_map *pfnm = PF_NORMAL_MAP(pfm);
   struct tile *tile = pfm->tile;
   int tindex = tile_index(tile);
-  struct pf_normal_node *node = pfnm->lattice + tindex;
+  struct pf_normal_node *node = pf_normal_map_node(pfnm, tindex);
   const struct pf_parameter *params = pf_map_parameter(pfm);
 
   /* Processing Stage */
@@ -534,7 +818,7 @@ static bool pf_jumbo_map_iterate(struct pf_map *pfm)
     /* Calculate the cost of every adjacent position and set them in the
      * priority queue for next call to pf_jumbo_map_iterate(). */
     int tindex1 = tile_index(tile1);
-    struct pf_normal_node *node1 = pfnm->lattice + tindex1;
+    struct pf_normal_node *node1 = pf_normal_map_node(pfnm, tindex1);
     int priority, cost1, extra_cost1;
 
     /* As for the previous position, 'tile1', 'node1' and 'tindex1' are
@@ -582,12 +866,12 @@ static bool pf_jumbo_map_iterate(struct pf_map *pfm)
   }
 
 #ifdef PF_DEBUG
-  fc_assert(NS_NEW == pfnm->lattice[tindex].status);
+  fc_assert(NS_NEW == pf_normal_map_node(pfnm, tindex)->status);
 #endif
 
   /* Change the pf_map iterator. Node status step B. to C. */
   pfm->tile = index_to_tile(params->map, tindex);
-  pfnm->lattice[tindex].status = NS_PROCESSED;
+  pf_normal_map_node(pfnm, tindex)->status = NS_PROCESSED;
 
   return TRUE;
 }
@@ -613,7 +897,7 @@ static bool pf_normal_map_iterate(struct pf_map *pfm)
   struct pf_normal_map *pfnm = PF_NORMAL_MAP(pfm);
   struct tile *tile = pfm->tile;
   int tindex = tile_index(tile);
-  struct pf_normal_node *node = pfnm->lattice + tindex;
+  struct pf_normal_node *node = pf_normal_map_node(pfnm, tindex);
   const struct pf_parameter *params = pf_map_parameter(pfm);
   int cost_of_path;
   enum pf_move_scope scope = node->move_scope;
@@ -632,7 +916,7 @@ static bool pf_normal_map_iterate(struct pf_map *pfm)
       /* Calculate the cost of every adjacent position and set them in the
        * priority queue for next call to pf_normal_map_iterate(). */
       int tindex1 = tile_index(tile1);
-      struct pf_normal_node *node1 = pfnm->lattice + tindex1;
+      struct pf_normal_node *node1 = pf_normal_map_node(pfnm, tindex1);
       int cost;
       int extra = 0;
 
@@ -712,7 +996,9 @@ static bool pf_normal_map_iterate(struct pf_map *pfm)
         node1->cost = cost;
         node1->dir_to_here = dir;
         /* As we prefer lower costs, let's reverse the cost of the path. */
-        map_index_pq_insert(pfnm->queue, tindex1, -cost_of_path);
+        map_index_pq_insert(pfnm->queue, tindex1,
+                            -pf_normal_map_key(pfnm, tile1, cost,
+                                               cost_of_path));
       } else if (cost_of_path < pf_total_CC(params, node1->cost,
                                             node1->extra_cost)) {
         /* We found a better route to 'tile1'. Let's register 'tindex1' to
@@ -722,24 +1008,37 @@ static bool pf_normal_map_iterate(struct pf_map *pfm)
         node1->cost = cost;
         node1->dir_to_here = dir;
         /* As we prefer lower costs, let's reverse the cost of the path. */
-        map_index_pq_replace(pfnm->queue, tindex1, -cost_of_path);
+        if (NULL == pfnm->goal_tile) {
+          map_index_pq_replace(pfnm->queue, tindex1, -cost_of_path);
+        } else {
+          /* The key may be higher than the previous one, the outdated
+           * entry is skipped by pf_normal_map_astar_remove(). */
+          map_index_pq_insert(pfnm->queue, tindex1,
+                              -pf_normal_map_key(pfnm, tile1, cost,
+                                                 cost_of_path));
+        }
       }
     } adjc_dir_iterate_end;
   }
 
   /* Get the next node (the index with the highest priority). */
-  if (!map_index_pq_remove(pfnm->queue, &tindex)) {
+  if (NULL != pfnm->goal_tile) {
+    if (!pf_normal_map_astar_remove(pfnm, &tindex)) {
+      /* No more indexes in the priority queue, iteration end. */
+      return FALSE;
+    }
+  } else if (!map_index_pq_remove(pfnm->queue, &tindex)) {
     /* No more indexes in the priority queue, iteration end. */
     return FALSE;
   }
 
 #ifdef PF_DEBUG
-  fc_assert(NS_NEW == pfnm->lattice[tindex].status);
+  fc_assert(NS_NEW == pf_normal_map_node(pfnm, tindex)->status);
 #endif
 
   /* Change the pf_map iterator. Node status step C. to D. */
   pfm->tile = index_to_tile(params->map, tindex);
-  pfnm->lattice[tindex].status = NS_PROCESSED;
+  pf_normal_map_node(pfnm, tindex)->status = NS_PROCESSED;
 
   return TRUE;
 }
@@ -751,7 +1050,7 @@ static inline bool pf_normal_map_iterate_until(struct pf_normal_map *pfnm,
                                                struct tile *ptile)
 {
   struct pf_map *pfm = PF_MAP(pfnm);
-  struct pf_normal_node *node = pfnm->lattice + tile_index(ptile);
+  struct pf_normal_node *node = pf_normal_map_node(pfnm, tile_index(ptile));
 
   if (NULL == pf_map_parameter(pfm)->get_costs) {
     /* Start position is handled in every function calling this function. */
@@ -790,7 +1089,7 @@ static int pf_normal_map_move_cost(struct pf_map *pfm, struct tile *ptile)
   if (ptile == pfm->params.start_tile) {
     return 0;
   } else if (pf_normal_map_iterate_until(pfnm, ptile)) {
-    return (pfnm->lattice[tile_index(ptile)].cost
+    return (pf_normal_map_node(pfnm, tile_index(ptile))->cost
             - pf_move_rate(pf_map_parameter(pfm))
             + pf_moves_left_initially(pf_map_parameter(pfm)));
   } else {
@@ -844,7 +1143,7 @@ static void pf_normal_map_destroy(struct pf_map *pfm)
 {
   struct pf_normal_map *pfnm = PF_NORMAL_MAP(pfm);
 
-  free(pfnm->lattice);
+  pf_lattice_release(PF_LATTICE_NORMAL, pfnm->plattice);
   map_index_pq_destroy(pfnm->queue);
   free(pfnm);
 }
@@ -868,7 +1167,10 @@ static struct pf_map *pf_normal_map_new(const struct pf_parameter *parameter)
 #endif /* PF_DEBUG */
 
   /* Allocate the map. */
-  pfnm->lattice = fc_calloc(MAP_INDEX_SIZE, sizeof(struct pf_normal_node));
+  pfnm->plattice = pf_lattice_acquire(PF_LATTICE_NORMAL,
+                                      sizeof(struct pf_normal_node));
+  pfnm->lattice = pfnm->plattice->nodes;
+  pfnm->generation = pfnm->plattice->generation;
   pfnm->queue = map_index_pq_new(INITIAL_QUEUE_SIZE);
 
   if (NULL == parameter->get_costs) {
@@ -882,6 +1184,15 @@ static struct pf_map *pf_normal_map_new(const struct pf_parameter *parameter)
   /* Copy parameters. */
   *params = *parameter;
 
+  if (NULL != params->goal_tile && NULL == params->get_costs) {
+    pfnm->goal_tile = params->goal_tile;
+    pfnm->min_step_cost = pf_min_step_cost(params);
+  } else {
+    /* Jumbo maps compute the priorities themselves. */
+    pfnm->goal_tile = NULL;
+    pfnm->min_step_cost = 0;
+  }
+
   /* Initialize virtual function table. */
   base_map->destroy = pf_normal_map_destroy;
   base_map->get_move_cost = pf_normal_map_move_cost;
@@ -892,9 +1203,10 @@ static struct pf_map *pf_normal_map_new(const struct pf_parameter *parameter)
   } else {
     base_map->iterate = pf_normal_map_iterate;
   }
+  base_map->cache_entry = NULL;
 
   /* Initialise starting node. */
-  node = pfnm->lattice + tile_index(params->start_tile);
+  node = pf_normal_map_node(pfnm, tile_index(params->start_tile));
   if (NULL == params->get_costs) {
     if (!pf_normal_node_init(pfnm, node, params->start_tile, PF_MS_NONE)) {
       /* Always fails. */
@@ -962,6 +1274,7 @@ struct pf_danger_node {
   bool is_dangerous : 1;        /* Whether we cannot end the turn there. */
   bool waited : 1;              /* TRUE if waited to get there. */
   unsigned short extra_tile;    /* EC */
+  unsigned short generation;    /* See pf_danger_map_node(). */
 
   /* Segment leading across the danger area back to the nearest safe node:
    * need to remeber costs and stuff. */
@@ -980,7 +1293,9 @@ struct pf_danger_map {
                                  * processed yet (NS_NEW and NS_WAITING),
                                  * sorted by their total_CC. */
   struct map_index_pq *danger_queue; /* Dangerous positions. */
+  struct pf_lattice *plattice;  /* Lattice storage. */
   struct pf_danger_node *lattice; /* Lattice of nodes. */
+  unsigned short generation;    /* Stamp of the valid nodes. */
 };
 
 /* Up-cast macro. */
@@ -1000,6 +1315,24 @@ pf_danger_map_check(struct pf_map *pfm, const char *file,
 #define PF_DANGER_MAP(pfm) ((struct pf_danger_map *) (pfm))
 #endif /* PF_DEBUG */
 
+/************************************************************************//**
+  Return the node of the tile index 'tindex'. The lattice may have been
+  used by a previous map, so a node with an outdated generation stamp is
+  reset here before being used.
+****************************************************************************/
+static inline struct pf_danger_node *
+pf_danger_map_node(const struct pf_danger_map *pfdm, int tindex)
+{
+  struct pf_danger_node *node = pfdm->lattice + tindex;
+
+  if (node->generation != pfdm->generation) {
+    memset(node, 0, sizeof(*node));
+    node->generation = pfdm->generation;
+  }
+
+  return node;
+}
+
 /* ===============  Specific pf_danger_* mode functions ================== */
 
 /************************************************************************//**
@@ -1161,7 +1494,7 @@ static void pf_danger_map_fill_position(const struct pf_danger_map *pfdm,
                                         struct pf_position *pos)
 {
   int tindex = tile_index(ptile);
-  struct pf_danger_node *node = pfdm->lattice + tindex;
+  struct pf_danger_node *node = pf_danger_map_node(pfdm, tindex);
   const struct pf_parameter *params = pf_map_parameter(PF_MAP(pfdm));
 
 #ifdef PF_DEBUG
@@ -1219,7 +1552,7 @@ pf_danger_map_construct_path(const struct pf_danger_map *pfdm,
   enum direction8 dir_next = direction8_invalid();
   struct pf_danger_pos *danger_seg = NULL;
   bool waited = FALSE;
-  struct pf_danger_node *node = pfdm->lattice + tile_index(ptile);
+  struct pf_danger_node *node = pf_danger_map_node(pfdm, tile_index(ptile));
   unsigned length = 1;
   struct tile *iter_tile = ptile;
   const struct pf_parameter *params = pf_map_parameter(PF_MAP(pfdm));
@@ -1256,7 +1589,7 @@ pf_danger_map_construct_path(const struct pf_danger_map *pfdm,
 
     /* Step backward. */
     iter_tile = mapstep(params->map, iter_tile, DIR_REVERSE(dir_next));
-    node = pfdm->lattice + tile_index(iter_tile);
+    node = pf_danger_map_node(pfdm, tile_index(iter_tile));
   }
 
   /* Allocate memory for path. */
@@ -1265,7 +1598,7 @@ pf_danger_map_construct_path(const struct pf_danger_map *pfdm,
 
   /* Reset variables for main iteration. */
   iter_tile = ptile;
-  node = pfdm->lattice + tile_index(ptile);
+  node = pf_danger_map_node(pfdm, tile_index(ptile));
   danger_seg = NULL;
   waited = FALSE;
 
@@ -1347,7 +1680,7 @@ pf_danger_map_construct_path(const struct pf_danger_map *pfdm,
 
     /* 5: Step further back. */
     iter_tile = mapstep(params->map, iter_tile, DIR_REVERSE(dir_next));
-    node = pfdm->lattice + tile_index(iter_tile);
+    node = pf_danger_map_node(pfdm, tile_index(iter_tile));
   }
 
   fc_assert_msg(FALSE, "Cannot get to the starting point!");
@@ -1376,7 +1709,7 @@ static void pf_danger_map_create_segment(struct pf_danger_map *pfdm,
                                          struct pf_danger_node *node1)
 {
   struct tile *ptile = PF_MAP(pfdm)->tile;
-  struct pf_danger_node *node = pfdm->lattice + tile_index(ptile);
+  struct pf_danger_node *node = pf_danger_map_node(pfdm, tile_index(ptile));
   struct pf_danger_pos *pos;
   unsigned length = 0;
   unsigned i;
@@ -1392,7 +1725,7 @@ static void pf_danger_map_create_segment(struct pf_danger_map *pfdm,
   while (node->is_dangerous && direction8_is_valid(node->dir_to_here)) {
     length++;
     ptile = mapstep(params->map, ptile, DIR_REVERSE(node->dir_to_here));
-    node = pfdm->lattice + tile_index(ptile);
+    node = pf_danger_map_node(pfdm, tile_index(ptile));
   }
 
   /* Allocate memory for segment */
@@ -1400,7 +1733,7 @@ static void pf_danger_map_create_segment(struct pf_danger_map *pfdm,
 
   /* Reset tile and node pointers for main iteration */
   ptile = PF_MAP(pfdm)->tile;
-  node = pfdm->lattice + tile_index(ptile);
+  node = pf_danger_map_node(pfdm, tile_index(ptile));
 
   /* Now fill the positions */
   for (i = 0, pos = node1->danger_segment; i < length; i++, pos++) {
@@ -1415,7 +1748,7 @@ static void pf_danger_map_create_segment(struct pf_danger_map *pfdm,
 
     /* Step further down the tree */
     ptile = mapstep(params->map, ptile, DIR_REVERSE(node->dir_to_here));
-    node = pfdm->lattice + tile_index(ptile);
+    node = pf_danger_map_node(pfdm, tile_index(ptile));
   }
 
 #ifdef PF_DEBUG
@@ -1492,7 +1825,7 @@ static bool pf_danger_map_iterate(struct pf_map *pfm)
   const struct pf_parameter *const params = pf_map_parameter(pfm);
   struct tile *tile = pfm->tile;
   int tindex = tile_index(tile);
-  struct pf_danger_node *node = pfdm->lattice + tindex;
+  struct pf_danger_node *node = pf_danger_map_node(pfdm, tindex);
   enum pf_move_scope scope = node->move_scope;
 
   /* The previous position is defined by 'tile' (tile pointer), 'node'
@@ -1533,7 +1866,7 @@ static bool pf_danger_map_iterate(struct pf_map *pfm)
         /* Calculate the cost of every adjacent position and set them in
          * the priority queues for next call to pf_danger_map_iterate(). */
         int tindex1 = tile_index(tile1);
-        struct pf_danger_node *node1 = pfdm->lattice + tindex1;
+        struct pf_danger_node *node1 = pf_danger_map_node(pfdm, tindex1);
         int cost;
         int extra = 0;
 
@@ -1704,7 +2037,7 @@ static bool pf_danger_map_iterate(struct pf_map *pfm)
       /* Change the pf_map iterator and reset data. */
       tile = index_to_tile(params->map, tindex);
       pfm->tile = tile;
-      node = pfdm->lattice + tindex;
+      node = pf_danger_map_node(pfdm, tindex);
     } else {
       /* No dangerous nodes to process, go for a safe one. */
       if (!map_index_pq_remove(pfdm->queue, &tindex)) {
@@ -1713,13 +2046,13 @@ static bool pf_danger_map_iterate(struct pf_map *pfm)
       }
 
 #ifdef PF_DEBUG
-      fc_assert(NS_PROCESSED != pfdm->lattice[tindex].status);
+      fc_assert(NS_PROCESSED != pf_danger_map_node(pfdm, tindex)->status);
 #endif
 
       /* Change the pf_map iterator and reset data. */
       tile = index_to_tile(params->map, tindex);
       pfm->tile = tile;
-      node = pfdm->lattice + tindex;
+      node = pf_danger_map_node(pfdm, tindex);
       if (NS_WAITING != node->status) {
         /* Node status step C. and D. */
 #ifdef PF_DEBUG
@@ -1756,7 +2089,7 @@ static inline bool pf_danger_map_iterate_until(struct pf_danger_map *pfdm,
                                                struct tile *ptile)
 {
   struct pf_map *pfm = PF_MAP(pfdm);
-  struct pf_danger_node *node = pfdm->lattice + tile_index(ptile);
+  struct pf_danger_node *node = pf_danger_map_node(pfdm, tile_index(ptile));
 
   /* Start position is handled in every function calling this function. */
 
@@ -1795,7 +2128,7 @@ static int pf_danger_map_move_cost(struct pf_map *pfm, struct tile *ptile)
   if (ptile == pfm->params.start_tile) {
     return 0;
   } else if (pf_danger_map_iterate_until(pfdm, ptile)) {
-    return (pfdm->lattice[tile_index(ptile)].cost
+    return (pf_danger_map_node(pfdm, tile_index(ptile))->cost
             - pf_move_rate(pf_map_parameter(pfm))
             + pf_moves_left_initially(pf_map_parameter(pfm)));
   } else {
@@ -1851,13 +2184,14 @@ static void pf_danger_map_destroy(struct pf_map *pfm)
   struct pf_danger_node *node;
   int i;
 
-  /* Need to clean up the dangling danger segments. */
+  /* Need to clean up the dangling danger segments. Nodes of other
+   * generations were not used by this map. */
   for (i = 0, node = pfdm->lattice; i < MAP_INDEX_SIZE; i++, node++) {
-    if (node->danger_segment) {
+    if (node->generation == pfdm->generation && node->danger_segment) {
       free(node->danger_segment);
     }
   }
-  free(pfdm->lattice);
+  pf_lattice_release(PF_LATTICE_DANGER, pfdm->plattice);
   map_index_pq_destroy(pfdm->queue);
   map_index_pq_destroy(pfdm->danger_queue);
   free(pfdm);
@@ -1882,7 +2216,10 @@ static struct pf_map *pf_danger_map_new(const struct pf_parameter *parameter)
 #endif /* PF_DEBUG */
 
   /* Allocate the map. */
-  pfdm->lattice = fc_calloc(MAP_INDEX_SIZE, sizeof(struct pf_danger_node));
+  pfdm->plattice = pf_lattice_acquire(PF_LATTICE_DANGER,
+                                      sizeof(struct pf_danger_node));
+  pfdm->lattice = pfdm->plattice->nodes;
+  pfdm->generation = pfdm->plattice->generation;
   pfdm->queue = map_index_pq_new(INITIAL_QUEUE_SIZE);
   pfdm->danger_queue = map_index_pq_new(INITIAL_QUEUE_SIZE);
 
@@ -1904,9 +2241,10 @@ static struct pf_map *pf_danger_map_new(const struct pf_parameter *parameter)
   base_map->get_path = pf_danger_map_path;
   base_map->get_position = pf_danger_map_position;
   base_map->iterate = pf_danger_map_iterate;
+  base_map->cache_entry = NULL;
 
   /* Initialise starting node. */
-  node = pfdm->lattice + tile_index(params->start_tile);
+  node = pf_danger_map_node(pfdm, tile_index(params->start_tile));
   if (!pf_danger_node_init(pfdm, node, params->start_tile, PF_MS_NONE)) {
     /* Always fails. */
     fc_assert(pf_danger_node_init(pfdm, node, params->start_tile,
@@ -1972,6 +2310,7 @@ struct pf_fuel_node {
                                  * constant move costs! */
   unsigned short extra_tile;    /* EC */
   unsigned short cost_to_here[DIR8_MAGIC_MAX]; /* Step cost[dir to here] */
+  unsigned short generation;    /* See pf_fuel_map_node(). */
 
   /* Segment leading across the danger area back to the nearest safe node:
    * need to remember costs and stuff. */
@@ -2001,7 +2340,9 @@ struct pf_fuel_map {
                                  * total_CC */
   struct map_index_pq *waited_queue; /* Queue of nodes to reach farer
                                       * positions after having refueled. */
+  struct pf_lattice *plattice;  /* Lattice storage. */
   struct pf_fuel_node *lattice; /* Lattice of nodes */
+  unsigned short generation;    /* Stamp of the valid nodes. */
 };
 
 /* Up-cast macro. */
@@ -2021,6 +2362,24 @@ pf_fuel_map_check(struct pf_map *pfm, const char *file,
 #define PF_FUEL_MAP(pfm) ((struct pf_fuel_map *) (pfm))
 #endif /* PF_DEBUG */
 
+/************************************************************************//**
+  Return the node of the tile index 'tindex'. The lattice may have been
+  used by a previous map, so a node with an outdated generation stamp is
+  reset here before being used.
+****************************************************************************/
+static inline struct pf_fuel_node *
+pf_fuel_map_node(const struct pf_fuel_map *pffm, int tindex)
+{
+  struct pf_fuel_node *node = pffm->lattice + tindex;
+
+  if (node->generation != pffm->generation) {
+    memset(node, 0, sizeof(*node));
+    node->generation = pffm->generation;
+  }
+
+  return node;
+}
+
 /* =================  Specific pf_fuel_* mode functions ================== */
 
 /************************************************************************//**
@@ -2334,7 +2693,7 @@ static void pf_fuel_map_fill_position(const struct pf_fuel_map *pffm,
                                       struct pf_position *pos)
 {
   int tindex = tile_index(ptile);
-  struct pf_fuel_node *node = pffm->lattice + tindex;
+  struct pf_fuel_node *node = pf_fuel_map_node(pffm, tindex);
   struct pf_fuel_pos *head = node->segment;
   const struct pf_parameter *params = pf_map_parameter(PF_MAP(pffm));
 
@@ -2376,7 +2735,7 @@ pf_fuel_map_construct_path(const struct pf_fuel_map *pffm,
 {
   struct pf_path *path = fc_malloc(sizeof(*path));
   enum direction8 dir_next = direction8_invalid();
-  struct pf_fuel_node *node = pffm->lattice + tile_index(ptile);
+  struct pf_fuel_node *node = pf_fuel_map_node(pffm, tile_index(ptile));
   struct pf_fuel_pos *segment = node->segment;
   unsigned length = 1;
   struct tile *iter_tile = ptile;
@@ -2409,7 +2768,7 @@ pf_fuel_map_construct_path(const struct pf_fuel_map *pffm,
     /* Step backward. */
     iter_tile = mapstep(params->map, iter_tile,
                         DIR_REVERSE(segment->dir_to_here));
-    node = pffm->lattice + tile_index(iter_tile);
+    node = pf_fuel_map_node(pffm, tile_index(iter_tile));
     segment = segment->prev;
 #ifdef PF_DEBUG
     fc_assert(NULL != segment);
@@ -2426,7 +2785,7 @@ pf_fuel_map_construct_path(const struct pf_fuel_map *pffm,
 
   /* Reset variables for main iteration. */
   iter_tile = ptile;
-  node = pffm->lattice + tile_index(ptile);
+  node = pf_fuel_map_node(pffm, tile_index(ptile));
   segment = node->segment;
 
   for (i = length - 1; i >= 0; i--) {
@@ -2479,7 +2838,7 @@ pf_fuel_map_construct_path(const struct pf_fuel_map *pffm,
 
     /* 5: Step further back. */
     iter_tile = mapstep(params->map, iter_tile, DIR_REVERSE(dir_next));
-    node = pffm->lattice + tile_index(iter_tile);
+    node = pf_fuel_map_node(pffm, tile_index(iter_tile));
     segment = segment->prev;
 #ifdef PF_DEBUG
     fc_assert(NULL != segment);
@@ -2521,7 +2880,7 @@ static inline void pf_fuel_map_create_segment(struct pf_fuel_map *pffm,
   do {
     next = pos;
     ptile = mapstep(params->map, ptile, DIR_REVERSE(node->dir_to_here));
-    node = pffm->lattice + tile_index(ptile);
+    node = pf_fuel_map_node(pffm, tile_index(ptile));
     pos = node->pos;
     if (NULL != pos) {
       if (pos->cost == node->cost
@@ -2632,7 +2991,7 @@ static bool pf_fuel_map_iterate(struct pf_map *pfm)
   const struct pf_parameter *const params = pf_map_parameter(pfm);
   struct tile *tile = pfm->tile;
   int tindex = tile_index(tile);
-  struct pf_fuel_node *node = pffm->lattice + tindex;
+  struct pf_fuel_node *node = pf_fuel_map_node(pffm, tindex);
   enum pf_move_scope scope = node->move_scope;
   int priority, waited_priority;
   bool waited = FALSE;
@@ -2678,7 +3037,7 @@ static bool pf_fuel_map_iterate(struct pf_map *pfm)
         /* Calculate the cost of every adjacent position and set them in
          * the priority queues for next call to pf_fuel_map_iterate(). */
         int tindex1 = tile_index(tile1);
-        struct pf_fuel_node *node1 = pffm->lattice + tindex1;
+        struct pf_fuel_node *node1 = pf_fuel_map_node(pffm, tindex1);
         int cost, extra = 0;
         int moves_left;
         int cost_of_path, old_cost_of_path;
@@ -2920,7 +3279,7 @@ static bool pf_fuel_map_iterate(struct pf_map *pfm)
       /* Change the pf_map iterator and reset data. */
       tile = index_to_tile(params->map, tindex);
       pfm->tile = tile;
-      node = pffm->lattice + tindex;
+      node = pf_fuel_map_node(pffm, tindex);
       waited = TRUE;
 #ifdef PF_DEBUG
       fc_assert(0 < node->moves_left_req);
@@ -2941,7 +3300,7 @@ static bool pf_fuel_map_iterate(struct pf_map *pfm)
       /* Change the pf_map iterator and reset data. */
       tile = index_to_tile(params->map, tindex);
       pfm->tile = tile;
-      node = pffm->lattice + tindex;
+      node = pf_fuel_map_node(pffm, tindex);
 
 #ifdef PF_DEBUG
       fc_assert(NS_PROCESSED != node->status);
@@ -2990,7 +3349,7 @@ static inline bool pf_fuel_map_iterate_until(struct pf_fuel_map *pffm,
                                              struct tile *ptile)
 {
   struct pf_map *pfm = PF_MAP(pffm);
-  struct pf_fuel_node *node = pffm->lattice + tile_index(ptile);
+  struct pf_fuel_node *node = pf_fuel_map_node(pffm, tile_index(ptile));
 
   /* Start position is handled in every function calling this function. */
 
@@ -3028,7 +3387,8 @@ static int pf_fuel_map_move_cost(struct pf_map *pfm, struct tile *ptile)
   if (ptile == pfm->params.start_tile) {
     return 0;
   } else if (pf_fuel_map_iterate_until(pffm, ptile)) {
-    const struct pf_fuel_node *node = pffm->lattice + tile_index(ptile);
+    const struct pf_fuel_node *node = pf_fuel_map_node(pffm,
+                                                       tile_index(ptile));
 
     return (node->segment->cost
             - pf_move_rate(pf_map_parameter(pfm))
@@ -3086,12 +3446,15 @@ static void pf_fuel_map_destroy(struct pf_map *pfm)
   struct pf_fuel_node *node;
   int i;
 
-  /* Need to clean up the dangling fuel segments. */
+  /* Need to clean up the dangling fuel segments. Nodes of other
+   * generations were not used by this map. */
   for (i = 0, node = pffm->lattice; i < MAP_INDEX_SIZE; i++, node++) {
-    pf_fuel_pos_unref(node->pos);
-    pf_fuel_pos_unref(node->segment);
+    if (node->generation == pffm->generation) {
+      pf_fuel_pos_unref(node->pos);
+      pf_fuel_pos_unref(node->segment);
+    }
   }
-  free(pffm->lattice);
+  pf_lattice_release(PF_LATTICE_FUEL, pffm->plattice);
   map_index_pq_destroy(pffm->queue);
   map_index_pq_destroy(pffm->waited_queue);
   free(pffm);
@@ -3116,7 +3479,10 @@ static struct pf_map *pf_fuel_map_new(const struct pf_parameter *parameter)
 #endif /* PF_DEBUG */
 
   /* Allocate the map. */
-  pffm->lattice = fc_calloc(MAP_INDEX_SIZE, sizeof(struct pf_fuel_node));
+  pffm->plattice = pf_lattice_acquire(PF_LATTICE_FUEL,
+                                      sizeof(struct pf_fuel_node));
+  pffm->lattice = pffm->plattice->nodes;
+  pffm->generation = pffm->plattice->generation;
   pffm->queue = map_index_pq_new(INITIAL_QUEUE_SIZE);
   pffm->waited_queue = map_index_pq_new(INITIAL_QUEUE_SIZE);
 
@@ -3138,9 +3504,10 @@ static struct pf_map *pf_fuel_map_new(const struct pf_parameter *parameter)
   base_map->get_path = pf_fuel_map_path;
   base_map->get_position = pf_fuel_map_position;
   base_map->iterate = pf_fuel_map_iterate;
+  base_map->cache_entry = NULL;
 
   /* Initialise starting node. */
-  node = pffm->lattice + tile_index(params->start_tile);
+  node = pf_fuel_map_node(pffm, tile_index(params->start_tile));
   if (!pf_fuel_node_init(pffm, node, params->start_tile, PF_MS_NONE)) {
     /* Always fails. */
     fc_assert(pf_fuel_node_init(pffm, node, params->start_tile,
@@ -3171,6 +3538,240 @@ static struct pf_map *pf_fuel_map_new(const struct pf_parameter *parameter)
 }
 
 
+/* ================= Specific pf_shared_* mode structures ================ */
+
+/* The maps built by pf_map_cache_get() are shared by all the users asking
+ * for the same parameters. A cache entry holds the real map and the list
+ * of the tiles it processed so far, in the iteration order. Every user
+ * gets a light pf_shared_map handle, which keeps its own position in this
+ * list and extends the real map only when it goes beyond its end. */
+struct pf_cache_entry {
+  struct pf_parameter params;   /* The key, the parameters of the map. */
+  struct pf_map *pfm;           /* The real map. */
+  int *tiles;                   /* Indices of the processed tiles. */
+  int tiles_num;                /* Number of processed tiles. */
+  int tiles_alloc;              /* Allocated size of 'tiles'. */
+  int ref_count;                /* Handles, plus one while cached. */
+};
+
+/* Derived structure of struct pf_map. */
+struct pf_shared_map {
+  struct pf_map base_map;       /* Base structure, must be the first! */
+
+  struct pf_cache_entry *entry; /* The shared map. */
+  int position;                 /* Our position in 'entry->tiles'. */
+};
+
+/* Up-cast macro. */
+#ifdef PF_DEBUG
+static inline struct pf_shared_map *
+pf_shared_map_check(struct pf_map *pfm, const char *file,
+                    const char *function, int line)
+{
+  fc_assert_full(file, function, line,
+                 NULL != pfm && PF_SHARED == pfm->mode,
+                 return NULL, "Wrong pf_map to pf_shared_map conversion.");
+  return (struct pf_shared_map *) pfm;
+}
+#define PF_SHARED_MAP(pfm)                                                  \
+  pf_shared_map_check(pfm, __FILE__, __FUNCTION__, __FC_LINE__)
+#else
+#define PF_SHARED_MAP(pfm) ((struct pf_shared_map *) (pfm))
+#endif /* PF_DEBUG */
+
+static genhash_val_t pf_cache_hash_val(const struct pf_parameter *param);
+static bool pf_cache_hash_cmp(const struct pf_parameter *param1,
+                              const struct pf_parameter *param2);
+
+#define SPECHASH_TAG pf_cache
+#define SPECHASH_IKEY_TYPE struct pf_parameter *
+#define SPECHASH_IDATA_TYPE struct pf_cache_entry *
+#define SPECHASH_IKEY_VAL pf_cache_hash_val
+#define SPECHASH_IKEY_COMP pf_cache_hash_cmp
+#include "spechash.h"
+#define pf_cache_hash_data_iterate(phash, entry)                            \
+  TYPED_HASH_DATA_ITERATE(struct pf_cache_entry *, phash, entry)
+#define pf_cache_hash_data_iterate_end HASH_DATA_ITERATE_END
+
+static struct pf_cache_hash *pf_cache = NULL;
+static int pf_cache_turn = -1;  /* The turn the cached maps are valid for. */
+
+/* ================= Specific pf_shared_* mode functions ================= */
+
+/************************************************************************//**
+  Hash function for the parameters of the cached maps.
+****************************************************************************/
+static genhash_val_t pf_cache_hash_val(const struct pf_parameter *param)
+{
+  genhash_val_t result = tile_index(param->start_tile);
+
+  if (NULL != param->utype) {
+    result += utype_index(param->utype) << 16;
+  }
+  if (NULL != param->owner) {
+    result += player_index(param->owner) << 24;
+  }
+
+  return result + param->moves_left_initially * 31;
+}
+
+/************************************************************************//**
+  Comparison function for the parameters of the cached maps. All fields
+  matter, as they could all change the map.
+****************************************************************************/
+static bool pf_cache_hash_cmp(const struct pf_parameter *param1,
+                              const struct pf_parameter *param2)
+{
+  return (param1->start_tile == param2->start_tile
+          && param1->utype == param2->utype
+          && param1->owner == param2->owner
+          && param1->moves_left_initially == param2->moves_left_initially
+          && param1->map == param2->map
+          && param1->fuel_left_initially == param2->fuel_left_initially
+          && param1->transported_by_initially
+             == param2->transported_by_initially
+          && param1->cargo_depth == param2->cargo_depth
+          && BV_ARE_EQUAL(param1->cargo_types, param2->cargo_types)
+          && param1->move_rate == param2->move_rate
+          && param1->fuel == param2->fuel
+          && param1->omniscience == param2->omniscience
+          && param1->get_MC == param2->get_MC
+          && param1->get_move_scope == param2->get_move_scope
+          && param1->ignore_none_scopes == param2->ignore_none_scopes
+          && param1->get_TB == param2->get_TB
+          && param1->get_EC == param2->get_EC
+          && param1->get_action == param2->get_action
+          && param1->actions == param2->actions
+          && param1->is_action_possible == param2->is_action_possible
+          && param1->get_zoc == param2->get_zoc
+          && param1->is_pos_dangerous == param2->is_pos_dangerous
+          && param1->get_moves_left_req == param2->get_moves_left_req
+          && param1->get_costs == param2->get_costs
+          && param1->goal_tile == param2->goal_tile
+          && param1->data == param2->data);
+}
+
+/************************************************************************//**
+  Append the new current tile of the real map to the processed tiles.
+****************************************************************************/
+static void pf_cache_entry_record(struct pf_cache_entry *entry,
+                                  const struct tile *ptile)
+{
+  if (entry->tiles_num >= entry->tiles_alloc) {
+    entry->tiles_alloc *= 2;
+    entry->tiles = fc_realloc(entry->tiles,
+                              entry->tiles_alloc * sizeof(*entry->tiles));
+  }
+  entry->tiles[entry->tiles_num++] = tile_index(ptile);
+}
+
+/************************************************************************//**
+  Drop a reference to the cache entry. Destroy it when it is not used
+  anymore.
+****************************************************************************/
+static void pf_cache_entry_unref(struct pf_cache_entry *entry)
+{
+  fc_assert_ret(0 < entry->ref_count);
+
+  if (0 < --entry->ref_count) {
+    return;
+  }
+
+  pf_map_destroy(entry->pfm);
+  free(entry->tiles);
+  free(entry);
+}
+
+/************************************************************************//**
+  'pf_shared_map' destructor. The real map is destroyed with its last
+  handle, if it is not in the cache anymore.
+****************************************************************************/
+static void pf_shared_map_destroy(struct pf_map *pfm)
+{
+  struct pf_shared_map *psm = PF_SHARED_MAP(pfm);
+
+  pf_cache_entry_unref(psm->entry);
+  free(psm);
+}
+
+/************************************************************************//**
+  Forward to the real map, see pf_map_move_cost().
+****************************************************************************/
+static int pf_shared_map_move_cost(struct pf_map *pfm, struct tile *ptile)
+{
+  return pf_map_move_cost(PF_SHARED_MAP(pfm)->entry->pfm, ptile);
+}
+
+/************************************************************************//**
+  Forward to the real map, see pf_map_path().
+****************************************************************************/
+static struct pf_path *pf_shared_map_path(struct pf_map *pfm,
+                                          struct tile *ptile)
+{
+  return pf_map_path(PF_SHARED_MAP(pfm)->entry->pfm, ptile);
+}
+
+/************************************************************************//**
+  Forward to the real map, see pf_map_position().
+****************************************************************************/
+static bool pf_shared_map_position(struct pf_map *pfm, struct tile *ptile,
+                                   struct pf_position *pos)
+{
+  return pf_map_position(PF_SHARED_MAP(pfm)->entry->pfm, ptile, pos);
+}
+
+/************************************************************************//**
+  Move to the next processed tile of the real map, iterating it only when
+  no other handle did it before.
+****************************************************************************/
+static bool pf_shared_map_iterate(struct pf_map *pfm)
+{
+  struct pf_shared_map *psm = PF_SHARED_MAP(pfm);
+  struct pf_cache_entry *entry = psm->entry;
+
+  if (psm->position + 1 >= entry->tiles_num
+      && !pf_map_iterate(entry->pfm)) {
+    return FALSE;
+  }
+
+  psm->position++;
+  pfm->tile = index_to_tile(pfm->params.map, entry->tiles[psm->position]);
+
+  return TRUE;
+}
+
+/************************************************************************//**
+  'pf_shared_map' constructor, a new handle on the cache entry.
+****************************************************************************/
+static struct pf_map *pf_shared_map_new(struct pf_cache_entry *entry)
+{
+  struct pf_shared_map *psm = fc_malloc(sizeof(*psm));
+  struct pf_map *base_map = &psm->base_map;
+
+#ifdef PF_DEBUG
+  /* Set the mode, used for cast check. */
+  base_map->mode = PF_SHARED;
+#endif /* PF_DEBUG */
+
+  /* Initialize virtual function table. */
+  base_map->destroy = pf_shared_map_destroy;
+  base_map->get_move_cost = pf_shared_map_move_cost;
+  base_map->get_path = pf_shared_map_path;
+  base_map->get_position = pf_shared_map_position;
+  base_map->iterate = pf_shared_map_iterate;
+  base_map->cache_entry = NULL;
+
+  base_map->params = entry->params;
+  base_map->tile = entry->params.start_tile;
+
+  psm->entry = entry;
+  psm->position = 0;
+  entry->ref_count++;
+
+  return base_map;
+}
+
+
 /* ====================== pf_map public functions ======================= */
 
 /************************************************************************//**
@@ -3272,6 +3873,27 @@ bool pf_map_position(struct pf_map *pfm, struct tile *ptile,
   return pfm->get_position(pfm, ptile, pos);
 }
 
+/************************************************************************//**
+  Returns the best path to 'ptile' for the parameter, or NULL if it cannot
+  be reached. The search is directed towards 'ptile' (see 'goal_tile' in
+  struct pf_parameter), so it is much cheaper than building a full map
+  when only one destination is wanted.
+****************************************************************************/
+struct pf_path *pf_map_path_to_tile(const struct pf_parameter *parameter,
+                                    struct tile *ptile)
+{
+  struct pf_parameter goal_parameter = *parameter;
+  struct pf_map *pfm;
+  struct pf_path *path;
+
+  goal_parameter.goal_tile = ptile;
+  pfm = pf_map_new(&goal_parameter);
+  path = pf_map_path(pfm, ptile);
+  pf_map_destroy(pfm);
+
+  return path;
+}
+
 /************************************************************************//**
   Iterates the path-finding algorithm one step further, to the next nearest
   position. This full info on this position and the best path to it can be
@@ -3301,6 +3923,10 @@ bool pf_map_iterate(struct pf_map *pfm)
     return FALSE;
   }
 
+  if (NULL != pfm->cache_entry) {
+    pf_cache_entry_record(pfm->cache_entry, pfm->tile);
+  }
+
   return TRUE;
 }
 
@@ -3368,6 +3994,146 @@ const struct pf_parameter *pf_map_parameter(const struct pf_map *pfm)
   return &pfm->params;
 }
 
+/************************************************************************//**
+  Initialize the path-finding module.
+****************************************************************************/
+void pf_init(void)
+{
+  fc_mutex_init(&pf_lattice_mutex);
+}
+
+/************************************************************************//**
+  Free the path-finding module: the cached maps and the pooled lattices.
+****************************************************************************/
+void pf_free(void)
+{
+  pf_map_cache_free();
+  pf_map_pools_free();
+  fc_mutex_destroy(&pf_lattice_mutex);
+}
+
+/************************************************************************//**
+  Return the pf_map allocation statistics collected since the last call
+  to pf_map_stats_reset().
+****************************************************************************/
+const struct pf_map_stats *pf_map_stats_get(void)
+{
+  return &pf_stats;
+}
+
+/************************************************************************//**
+  Reset the pf_map allocation statistics.
+****************************************************************************/
+void pf_map_stats_reset(void)
+{
+  memset(&pf_stats, 0, sizeof(pf_stats));
+}
+
+/************************************************************************//**
+  Free the pooled lattices. The maps still in use keep their lattice,
+  which will be pooled again when they are destroyed.
+****************************************************************************/
+void pf_map_pools_free(void)
+{
+  int kind;
+
+  fc_mutex_allocate(&pf_lattice_mutex);
+  for (kind = 0; kind < PF_LATTICE_KIND_NUM; kind++) {
+    struct pf_lattice *plattice;
+
+    while (NULL != (plattice = pf_lattice_pool[kind])) {
+      pf_lattice_pool[kind] = plattice->next;
+      pf_lattice_free(plattice);
+    }
+    pf_lattice_pool_size[kind] = 0;
+  }
+  fc_mutex_release(&pf_lattice_mutex);
+}
+
+/************************************************************************//**
+  Returns a map for the parameter, shared with the other users of the same
+  parameters: all the positions processed by one of them are reused by the
+  others. It must be destroyed with pf_map_destroy() as any other map.
+
+  The cached maps are valid until pf_map_cache_invalidate() is called, or
+  the turn changes. The caller must ensure the invalidation is called
+  whenever something used by the path-finding callbacks changes (units,
+  cities, terrains, knowledge of the map, diplomatic states...).
+
+  Maps whose parameter has user 'data', or a 'goal_tile', are not cached.
+  Unlike pf_map_new(), this must be called from the main thread only.
+****************************************************************************/
+struct pf_map *pf_map_cache_get(const struct pf_parameter *parameter)
+{
+  struct pf_cache_entry *entry;
+  struct pf_map *pfm;
+
+  if (NULL != parameter->data || NULL != parameter->goal_tile) {
+    return pf_map_new(parameter);
+  }
+
+  if (pf_cache_turn != game.info.turn) {
+    pf_map_cache_invalidate();
+    pf_cache_turn = game.info.turn;
+  }
+
+  if (NULL == pf_cache) {
+    pf_cache = pf_cache_hash_new();
+  } else if (pf_cache_hash_lookup(pf_cache, parameter, &entry)) {
+    pf_stats.cache_hits++;
+    return pf_shared_map_new(entry);
+  }
+
+  pf_stats.cache_misses++;
+  pfm = pf_map_new(parameter);
+  if (NULL == pfm) {
+    return NULL;
+  }
+
+  entry = fc_malloc(sizeof(*entry));
+  entry->params = *parameter;
+  entry->pfm = pfm;
+  entry->tiles_alloc = 64;
+  entry->tiles = fc_malloc(entry->tiles_alloc * sizeof(*entry->tiles));
+  entry->tiles[0] = tile_index(parameter->start_tile);
+  entry->tiles_num = 1;
+  entry->ref_count = 1;         /* Reference of the cache. */
+  pfm->cache_entry = entry;
+  pf_cache_hash_insert(pf_cache, &entry->params, entry);
+
+  return pf_shared_map_new(entry);
+}
+
+/************************************************************************//**
+  Drop all the cached maps. The maps still in use remain valid for their
+  users, but they will not be shared anymore.
+****************************************************************************/
+void pf_map_cache_invalidate(void)
+{
+  if (NULL == pf_cache || 0 == pf_cache_hash_size(pf_cache)) {
+    return;
+  }
+
+  pf_cache_hash_data_iterate(pf_cache, entry) {
+    pf_cache_entry_unref(entry);
+  } pf_cache_hash_data_iterate_end;
+  pf_cache_hash_clear(pf_cache);
+  pf_stats.cache_invalidations++;
+}
+
+/************************************************************************//**
+  Free the cache of the maps.
+****************************************************************************/
+void pf_map_cache_free(void)
+{
+  if (NULL != pf_cache) {
+    pf_map_cache_invalidate();
+    pf_cache_hash_destroy(pf_cache);
+    pf_cache = NULL;
+  }
+  pf_cache_turn = -1;
+}
+
 
 /* ====================== pf_path public functions ======================= */
 
@@ -3742,7 +4508,7 @@ pf_reverse_map_pos(struct pf_reverse_map *pfrm,
   struct pf_map *pfm;
   struct pf_parameter *copy;
   struct tile *target_tile;
-  const struct pf_normal_node *lattice;
+  struct pf_normal_map *pfnm;
   int max_cost;
 
   /* Check if we already processed something similar. */
@@ -3752,12 +4518,13 @@ pf_reverse_map_pos(struct pf_reverse_map *pfrm,
 
   /* We didn't. Build map and iterate. */
   pfm = pf_normal_map_new(param);
-  lattice = PF_NORMAL_MAP(pfm)->lattice;
+  pfnm = PF_NORMAL_MAP(pfm);
   target_tile = pfrm->target_tile;
   if (pfrm->max_turns >= 0) {
     max_cost = param->move_rate * (pfrm->max_turns + 1);
     do {
-      if (lattice[tile_index(pfm->tile)].cost >= max_cost) {
+      if (pf_normal_map_node(pfnm, tile_index(pfm->tile))->cost
+          >= max_cost) {
         break;
       } else if (pfm->tile == target_tile) {
         /* Found our position. Insert in hash, destroy map, and return. */
@@ -194,6 +194,16 @@ extern "C" {
  *
  * You may call pf_map_path() multiple times with the same pfm.
  *
+ * If only one path is needed, setting 'goal_tile' in the parameter makes
+ * the search directed towards it (A* search), so it doesn't need to
+ * expand the whole reachable area. pf_map_path_to_tile() does all the
+ * above in one call this way:
+ *
+ *    if ((path = pf_map_path_to_tile(&parameter, ptile))) {
+ *      // success, use path
+ *      pf_path_destroy(path);
+ *    }
+ *
  * B) the caller doesn't know the map position of the goal yet (but knows
  * what they are looking for, e.g. a port) and wants to iterate over
  * all paths in order of increasing costs (total_CC):
@@ -467,6 +477,16 @@ struct pf_parameter {
                     int *to_cost, int *to_extra,
                     const struct pf_parameter *param);
 
+  /* If set, the search is directed towards this tile (A* search): the
+   * tiles closer to it are processed first, so it is reached after
+   * iterating only a part of the map. The paths and costs of the reached
+   * tiles are still the best ones, but the iteration order of the
+   * method B) functions doesn't follow the costs anymore. It assumes that
+   * 'get_MC' never returns less than the move cost rules of the unit type
+   * allow. Ignored by jumbo, danger and fuel maps. See also
+   * pf_map_path_to_tile(). */
+  struct tile *goal_tile;
+
   /* User provided data. Can be used to attach arbitrary information
    * to the map. */
   void *data;
@@ -478,6 +498,20 @@ struct pf_map;
 /* The reverse map strucure. Opaque type. */
 struct pf_reverse_map;
 
+/* Allocation statistics of the pf_map node lattices. The lattices of
+ * destroyed maps are kept in a pool and reused by the next maps of the
+ * same kind, see pf_map_stats_get(). The cache counters are about the
+ * maps shared with pf_map_cache_get(). */
+struct pf_map_stats {
+  unsigned int maps_created;      /* Number of maps created. */
+  unsigned int lattices_recycled; /* Maps which reused a pooled lattice. */
+  size_t bytes_allocated;         /* Lattice memory freshly allocated. */
+  size_t bytes_recycled;          /* Lattice memory reused from the pool. */
+  unsigned int cache_hits;        /* Shared maps found in the cache. */
+  unsigned int cache_misses;      /* Shared maps built from scratch. */
+  unsigned int cache_invalidations; /* Times the cache was flushed. */
+};
+
 
 
 /* ========================= Public Interface ============================ */
@@ -494,6 +528,9 @@ struct pf_path *pf_map_path(struct pf_map *pfm, struct tile *ptile)
 bool pf_map_position(struct pf_map *pfm, struct tile *ptile,
                      struct pf_position *pos)
                      fc__warn_unused_result;
+struct pf_path *pf_map_path_to_tile(const struct pf_parameter *parameter,
+                                    struct tile *ptile)
+                fc__warn_unused_result;
 
 /* Method B) functions. */
 bool pf_map_iterate(struct pf_map *pfm);
@@ -506,6 +543,21 @@ void pf_map_iter_position(struct pf_map *pfm, struct pf_position *pos);
 /* Other related functions. */
 const struct pf_parameter *pf_map_parameter(const struct pf_map *pfm);
 
+/* Module functions. */
+void pf_init(void);
+void pf_free(void);
+
+/* Lattice pool functions. */
+const struct pf_map_stats *pf_map_stats_get(void);
+void pf_map_stats_reset(void);
+void pf_map_pools_free(void);
+
+/* Shared maps functions. */
+struct pf_map *pf_map_cache_get(const struct pf_parameter *parameter)
+  fc__warn_unused_result;
+void pf_map_cache_invalidate(void);
+void pf_map_cache_free(void);
+
 
 /* Paths functions. */
 void pf_path_destroy(struct pf_path *path);
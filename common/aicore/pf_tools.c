@@ -686,6 +686,7 @@ pft_fill_default_parameter(struct pf_parameter *parameter,
   parameter->get_action = NULL;
   parameter->is_action_possible = NULL;
   parameter->actions = PF_AA_NONE;
+  parameter->goal_tile = NULL;
 
   parameter->utype = punittype;
 }
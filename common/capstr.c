@@ -25,6 +25,9 @@
 
 /* common */
 #include "connection.h"	        /* MAX_LEN_CAPSTR */
+#ifdef FREECIV_HAVE_LIBZSTD
+#include "packets_zstd_dict.h"    /* PACKET_ZSTD_CAPABILITY */
+#endif
 
 #include "capstr.h"
 
@@ -89,8 +92,15 @@ void init_our_capability(void)
   const char *s;
 
   s = getenv("FREECIV_CAPS");
-  if (!s) {
-    s = NETWORK_CAPSTRING;
+  if (s) {
+    sz_strlcpy(our_capability_internal, s);
+  } else {
+    sz_strlcpy(our_capability_internal, NETWORK_CAPSTRING);
+#if defined(USE_COMPRESSION) && defined(FREECIV_HAVE_LIBZSTD)
+    /* Streaming packet compression, see conn_compression_negotiate() */
+    sz_strlcat(our_capability_internal, " " PACKET_ZSTD_CAPABILITY);
+#endif
+    /* Run-length encoded bulk tile sends, see PACKET_TILE_INFO_CHUNK */
+    sz_strlcat(our_capability_internal, " tilechunk");
   }
-  sz_strlcpy(our_capability_internal, s);
 }
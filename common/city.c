@@ -830,13 +830,14 @@ bool can_city_build_improvement_direct(const struct city *pcity,
     return FALSE;
   }
 
-  return are_reqs_active(&(const struct req_context) {
-                           .player = city_owner(pcity),
-                           .city = pcity,
-                           .tile = pcity->tile,
-                         },
-                         NULL,
-                         &(pimprove->reqs), RPT_CERTAIN);
+  return are_reqs_active_prog(&(const struct req_context) {
+                                .player = city_owner(pcity),
+                                .city = pcity,
+                                .tile = pcity->tile,
+                              },
+                              NULL,
+                              &(pimprove->reqs), &(pimprove->reqs_prog),
+                              RPT_CERTAIN);
 }
 
 /**********************************************************************//**
@@ -3055,6 +3056,9 @@ static inline void city_support(struct city *pcity)
 **************************************************************************/
 void city_refresh_from_main_map(struct city *pcity, bool *workers_map)
 {
+  /* Nothing the effects of the city depend on changes while refreshing. */
+  city_effect_cache_begin(pcity);
+
   if (workers_map == NULL) {
     /* do a full refresh */
 
@@ -3095,6 +3099,8 @@ void city_refresh_from_main_map(struct city *pcity, bool *workers_map)
 
   unhappy_city_check(pcity);
   set_surpluses(pcity);
+
+  city_effect_cache_end(pcity);
 }
 
 /**********************************************************************//**
@@ -3433,6 +3439,7 @@ void destroy_city_virtual(struct city *pcity)
   if (pcity->tile_cache != NULL) {
     free(pcity->tile_cache);
   }
+  city_effect_cache_free(pcity);
 
   if (pcity->cm_parameter) {
     free(pcity->cm_parameter);
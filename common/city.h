@@ -299,6 +299,7 @@ struct tile_cache; /* defined and only used within city.c */
 struct adv_city; /* defined in ./server/advisors/infracache.h */
 
 struct cm_parameter; /* defined in ./common/aicore/cm.h */
+struct city_effect_cache; /* defined and only used within effects.c */
 
 #ifdef FREECIV_WEB
 #pragma pack(push, 1)
@@ -336,6 +337,10 @@ struct city {
    * radius. */
   int tile_cache_radius_sq;
 
+  /* Memo of the effect values of the city, used while they can't change
+   * (see city_effect_cache_begin()) */
+  struct city_effect_cache *effect_cache;
+
   /* the productions */
   int surplus[O_LAST]; /* Final surplus in each category. */
   int waste[O_LAST]; /* Waste/corruption in each category. */
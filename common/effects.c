@@ -20,6 +20,7 @@
 /* utility */
 #include "astring.h"
 #include "fcintl.h"
+#include "fcthread.h"
 #include "log.h"
 #include "mem.h"
 #include "support.h"
@@ -134,8 +135,50 @@ static struct {
     /* ...advances... */
     struct effect_list *advances[A_LAST];
   } reqs;
+
+  /* The widest range at which the effects require each kind of source,
+   * and each of the sources cached above. Tells who may be affected when
+   * a source changes; see get_req_source_effects_range(). */
+  struct {
+    enum req_range kinds[VUT_COUNT];
+    enum req_range buildings[B_LAST];
+    enum req_range govs[G_LAST];
+    enum req_range advances[A_LAST];
+  } ranges;
 } ruleset_cache;
 
+/**************************************************************************
+  Effect values of a city, remembered between city_effect_cache_begin()
+  and the matching city_effect_cache_end(). A value is only valid if its
+  stamp is the current generation of the cache; starting a new
+  generation thus forgets all the values at once. The output type
+  O_LAST holds the values of get_city_bonus(), the others the values of
+  get_city_output_bonus().
+
+  The memos being remembered form a chain private to the thread that
+  began them, so a thread never reads nor writes the memo of a city that
+  another thread is refreshing, even when the effects of its own city
+  depend on that city.
+**************************************************************************/
+struct city_effect_cache {
+  const struct city *pcity;           /* City the values are of */
+  int depth;            /* Number of begin calls not yet ended */
+  struct city_effect_cache *outer;    /* Next memo begun in the thread */
+  unsigned generation;
+  struct {
+    unsigned stamp;
+    int value;
+  } bonus[EFT_COUNT][O_LAST + 1];
+};
+
+#ifdef fc_thread_local
+/* The memos the current thread is remembering, innermost first. */
+static fc_thread_local struct city_effect_cache *open_effect_caches = NULL;
+#endif /* fc_thread_local */
+
+/* Whether city_effect_cache_begin() remembers anything. */
+static bool city_effect_caching = TRUE;
+
 
 /**********************************************************************//**
   Get a list of effects of this type.
@@ -180,6 +223,50 @@ struct effect_list *get_req_source_effects(const struct universal *psource)
   }
 }
 
+/**********************************************************************//**
+  Get the widest range at which the effects require the source, or
+  REQ_RANGE_LOCAL if no effect requires it. When the source changes,
+  only the targets within that range of it may get different effect
+  values.
+
+  For the kinds of sources that have no effects cache of their own
+  (see get_req_source_effects()), this is the widest range at which
+  any source of the same kind is required.
+**************************************************************************/
+enum req_range get_req_source_effects_range(const struct universal *psource)
+{
+  switch (psource->kind) {
+  case VUT_GOVERNMENT:
+    return ruleset_cache.ranges.govs
+      [government_index(psource->value.govern)];
+  case VUT_IMPROVEMENT:
+    return ruleset_cache.ranges.buildings
+      [improvement_index(psource->value.building)];
+  case VUT_ADVANCE:
+    return ruleset_cache.ranges.advances
+      [advance_index(psource->value.advance)];
+  default:
+    break;
+  }
+
+  if (psource->kind < VUT_COUNT) {
+    return ruleset_cache.ranges.kinds[psource->kind];
+  }
+
+  return REQ_RANGE_WORLD;
+}
+
+/**********************************************************************//**
+  Widen the recorded range of the source to 'range', if narrower.
+**************************************************************************/
+static void req_source_range_widen(enum req_range *recorded,
+                                   enum req_range range)
+{
+  if (range > *recorded) {
+    *recorded = range;
+  }
+}
+
 /**********************************************************************//**
   Add effect to ruleset cache.
 **************************************************************************/
@@ -195,6 +282,7 @@ struct effect *effect_new(enum effect_type type, int value,
   peffect->multiplier = pmul;
 
   requirement_vector_init(&peffect->reqs);
+  req_program_init(&peffect->reqs_prog);
 
   /* Now add the effect to the ruleset cache. */
   effect_list_append(ruleset_cache.tracker, peffect);
@@ -216,6 +304,7 @@ struct effect *effect_new(enum effect_type type, int value,
 void effect_free(struct effect *peffect)
 {
   requirement_vector_free(&peffect->reqs);
+  req_program_free(&peffect->reqs_prog);
   if (peffect->rulesave.comment != NULL) {
     free(peffect->rulesave.comment);
   }
@@ -268,14 +357,40 @@ void effect_req_append(struct effect *peffect, struct requirement req)
   struct effect_list *eff_list = get_req_source_effects(&req.source);
 
   requirement_vector_append(&peffect->reqs, req);
+  req_program_invalidate(&peffect->reqs_prog);
 
   if (eff_list != NULL) {
     effect_list_append(eff_list, peffect);
   }
 
+  req_source_range_widen(&ruleset_cache.ranges.kinds[req.source.kind],
+                         req.range);
+  switch (req.source.kind) {
+  case VUT_GOVERNMENT:
+    req_source_range_widen(&ruleset_cache.ranges.govs
+                           [government_index(req.source.value.govern)],
+                           req.range);
+    break;
+  case VUT_IMPROVEMENT:
+    req_source_range_widen(&ruleset_cache.ranges.buildings
+                           [improvement_index(req.source.value.building)],
+                           req.range);
+    break;
+  case VUT_ADVANCE:
+    req_source_range_widen(&ruleset_cache.ranges.advances
+                           [advance_index(req.source.value.advance)],
+                           req.range);
+    break;
+  default:
+    break;
+  }
+
   if (req.source.kind == VUT_IMPR_FLAG) {
     improvement_iterate(impr) {
       if (improvement_has_flag(impr, req.source.value.impr_flag)) {
+        req_source_range_widen(&ruleset_cache.ranges.buildings
+                               [improvement_index(impr)], req.range);
+
         eff_list = get_req_source_effects(&(const struct universal) {
                                             .kind = VUT_IMPROVEMENT,
                                             .value.building = impr
@@ -315,6 +430,19 @@ void ruleset_cache_init(void)
     ruleset_cache.reqs.advances[i] = effect_list_new();
   }
 
+  for (i = 0; i < ARRAY_SIZE(ruleset_cache.ranges.kinds); i++) {
+    ruleset_cache.ranges.kinds[i] = REQ_RANGE_LOCAL;
+  }
+  for (i = 0; i < ARRAY_SIZE(ruleset_cache.ranges.buildings); i++) {
+    ruleset_cache.ranges.buildings[i] = REQ_RANGE_LOCAL;
+  }
+  for (i = 0; i < ARRAY_SIZE(ruleset_cache.ranges.govs); i++) {
+    ruleset_cache.ranges.govs[i] = REQ_RANGE_LOCAL;
+  }
+  for (i = 0; i < ARRAY_SIZE(ruleset_cache.ranges.advances); i++) {
+    ruleset_cache.ranges.advances[i] = REQ_RANGE_LOCAL;
+  }
+
   /* By default, user effects are valued as themselves
    * (currently meaning that they get no value at all) */
   for (i = EFT_USER_EFFECT_1 ; i <= EFT_USER_EFFECT_LAST; i++) {
@@ -759,8 +887,8 @@ int get_target_bonus_effects(struct effect_list *plist,
   /* Loop over all effects of this type. */
   effect_list_iterate(get_effects(effect_type), peffect) {
     /* For each effect, see if it is active. */
-    if (are_reqs_active(context, other_player,
-                        &peffect->reqs, RPT_CERTAIN)) {
+    if (are_reqs_active_prog(context, other_player, &peffect->reqs,
+                             &peffect->reqs_prog, RPT_CERTAIN)) {
       /* This code will add value of effect. If there's multiplier for 
        * effect and target_player aren't null, then value is multiplied
        * by player's multiplier factor. */
@@ -813,22 +941,156 @@ int get_player_bonus(const struct player *pplayer,
                                   effect_type);
 }
 
+/**********************************************************************//**
+  Start remembering the effect values of the city, until the matching
+  city_effect_cache_end(). In between, the caller guarantees that nothing
+  the requirements of the city's effects depend on changes, so that
+  get_city_bonus() and get_city_output_bonus() can be looked up just
+  once. The calls may be nested; values are only forgotten when the
+  outermost one begins.
+
+  The values are only remembered for lookups made by the calling thread.
+  Only the thread refreshing the city may call this; without thread
+  local storage, nothing is remembered.
+**************************************************************************/
+void city_effect_cache_begin(struct city *pcity)
+{
+#ifdef fc_thread_local
+  struct city_effect_cache *cache;
+
+  if (!city_effect_caching) {
+    return;
+  }
+
+  for (cache = open_effect_caches; cache != NULL; cache = cache->outer) {
+    if (cache->pcity == pcity) {
+      cache->depth++;
+      return;
+    }
+  }
+
+  cache = pcity->effect_cache;
+  if (cache == NULL) {
+    cache = fc_calloc(1, sizeof(*cache));
+    pcity->effect_cache = cache;
+  }
+
+  fc_assert(cache->depth == 0);
+  cache->pcity = pcity;
+  cache->depth = 1;
+  cache->outer = open_effect_caches;
+  open_effect_caches = cache;
+
+  /* Stamps are 0 when allocated; never use it as a generation. */
+  if (++cache->generation == 0) {
+    cache->generation = 1;
+    memset(cache->bonus, 0, sizeof(cache->bonus));
+  }
+#endif /* fc_thread_local */
+}
+
+/**********************************************************************//**
+  Stop remembering the effect values of the city, as started by
+  city_effect_cache_begin().
+**************************************************************************/
+void city_effect_cache_end(struct city *pcity)
+{
+#ifdef fc_thread_local
+  struct city_effect_cache **pcache;
+
+  if (!city_effect_caching) {
+    return;
+  }
+
+  for (pcache = &open_effect_caches; *pcache != NULL;
+       pcache = &(*pcache)->outer) {
+    if ((*pcache)->pcity == pcity) {
+      if (--(*pcache)->depth == 0) {
+        *pcache = (*pcache)->outer;
+      }
+      return;
+    }
+  }
+
+  fc_assert_msg(FALSE, "Effect values of %s not being remembered.",
+                city_name_get(pcity));
+#endif /* fc_thread_local */
+}
+
+/**********************************************************************//**
+  Set whether the effect values of the cities get remembered at all, to
+  compare them with plain lookups. Must not be called while any city is
+  remembering its effect values.
+**************************************************************************/
+void city_effect_cache_enable(bool enable)
+{
+  city_effect_caching = enable;
+}
+
+/**********************************************************************//**
+  Free the effect value memo of the city.
+**************************************************************************/
+void city_effect_cache_free(struct city *pcity)
+{
+  if (pcity->effect_cache != NULL) {
+    fc_assert(pcity->effect_cache->depth == 0);
+    free(pcity->effect_cache);
+    pcity->effect_cache = NULL;
+  }
+}
+
+/**********************************************************************//**
+  Returns the effect value memo of the city, or NULL if the current
+  thread is not remembering its effect values.
+**************************************************************************/
+static inline struct city_effect_cache *
+city_effect_cache_active(const struct city *pcity)
+{
+#ifdef fc_thread_local
+  struct city_effect_cache *cache;
+
+  for (cache = open_effect_caches; cache != NULL; cache = cache->outer) {
+    if (cache->pcity == pcity) {
+      return cache;
+    }
+  }
+#endif /* fc_thread_local */
+
+  return NULL;
+}
+
 /**********************************************************************//**
   Returns the effect bonus at a city.
 **************************************************************************/
 int get_city_bonus(const struct city *pcity, enum effect_type effect_type)
 {
+  struct city_effect_cache *cache;
+  int bonus;
+
   if (!initialized) {
     return 0;
   }
 
-  return get_target_bonus_effects(NULL,
-                                  &(const struct req_context) {
-                                    .player = city_owner(pcity),
-                                    .city = pcity,
-                                    .tile = city_tile(pcity),
-                                  },
-                                  NULL, effect_type);
+  cache = city_effect_cache_active(pcity);
+  if (cache != NULL
+      && cache->bonus[effect_type][O_LAST].stamp == cache->generation) {
+    return cache->bonus[effect_type][O_LAST].value;
+  }
+
+  bonus = get_target_bonus_effects(NULL,
+                                   &(const struct req_context) {
+                                     .player = city_owner(pcity),
+                                     .city = pcity,
+                                     .tile = city_tile(pcity),
+                                   },
+                                   NULL, effect_type);
+
+  if (cache != NULL) {
+    cache->bonus[effect_type][O_LAST].value = bonus;
+    cache->bonus[effect_type][O_LAST].stamp = cache->generation;
+  }
+
+  return bonus;
 }
 
 /**********************************************************************//**
@@ -958,6 +1220,9 @@ int get_city_output_bonus(const struct city *pcity,
                           const struct output_type *poutput,
                           enum effect_type effect_type)
 {
+  struct city_effect_cache *cache;
+  int bonus;
+
   if (!initialized) {
     return 0;
   }
@@ -965,14 +1230,29 @@ int get_city_output_bonus(const struct city *pcity,
   fc_assert_ret_val(pcity != NULL, 0);
   fc_assert_ret_val(poutput != NULL, 0);
   fc_assert_ret_val(effect_type != EFT_COUNT, 0);
-  return get_target_bonus_effects(NULL,
-                                  &(const struct req_context) {
-                                    .player = city_owner(pcity),
-                                    .city = pcity,
-                                    .output = poutput,
-                                  },
-                                  NULL,
-                                  effect_type);
+
+  cache = city_effect_cache_active(pcity);
+  if (cache != NULL
+      && cache->bonus[effect_type][poutput->index].stamp
+         == cache->generation) {
+    return cache->bonus[effect_type][poutput->index].value;
+  }
+
+  bonus = get_target_bonus_effects(NULL,
+                                   &(const struct req_context) {
+                                     .player = city_owner(pcity),
+                                     .city = pcity,
+                                     .output = poutput,
+                                   },
+                                   NULL,
+                                   effect_type);
+
+  if (cache != NULL) {
+    cache->bonus[effect_type][poutput->index].value = bonus;
+    cache->bonus[effect_type][poutput->index].stamp = cache->generation;
+  }
+
+  return bonus;
 }
 
 /**********************************************************************//**
@@ -369,6 +369,7 @@ struct effect {
   /* An effect can have multiple requirements.  The effect will only be
    * active if all of these requirement are met. */
   struct requirement_vector reqs;
+  struct req_program reqs_prog;  /* reqs compiled for evaluation */
 
   /* Only relevant for ruledit and other rulesave users. */
   struct {
@@ -433,6 +434,11 @@ bool is_building_replaced(const struct city *pcity,
 int get_world_bonus(enum effect_type effect_type);
 int get_player_bonus(const struct player *plr, enum effect_type effect_type);
 int get_city_bonus(const struct city *pcity, enum effect_type effect_type);
+
+void city_effect_cache_begin(struct city *pcity);
+void city_effect_cache_end(struct city *pcity);
+void city_effect_cache_free(struct city *pcity);
+void city_effect_cache_enable(bool enable);
 int get_tile_bonus(const struct tile *ptile, enum effect_type effect_type);
 int get_city_specialist_output_bonus(const struct city *pcity,
 				     const struct specialist *pspecialist,
@@ -467,6 +473,7 @@ int get_unit_vs_tile_bonus(const struct tile *ptile,
 
 /* Miscellaneous auxiliary effects functions */
 struct effect_list *get_req_source_effects(const struct universal *psource);
+enum req_range get_req_source_effects_range(const struct universal *psource);
 
 int get_player_bonus_effects(struct effect_list *plist,
                              const struct player *pplayer,
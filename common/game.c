@@ -25,6 +25,7 @@
 
 /* aicore */
 #include "cm.h"
+#include "path_finding.h"
 
 /* common */
 #include "ai.h"
@@ -347,12 +348,14 @@ static void game_defaults(bool keep_ruleset_value)
   if (is_server()) {
     /* All settings only used by the server (./server/ and ./ai/ */
     sz_strlcpy(game.server.allow_take, GAME_DEFAULT_ALLOW_TAKE);
+    game.server.ai_threads        = GAME_DEFAULT_AI_THREADS;
     game.server.allowed_city_names = GAME_DEFAULT_ALLOWED_CITY_NAMES;
     game.server.aqueductloss      = GAME_DEFAULT_AQUEDUCTLOSS;
     game.server.auto_ai_toggle    = GAME_DEFAULT_AUTO_AI_TOGGLE;
     game.server.autoattack        = GAME_DEFAULT_AUTOATTACK;
     game.server.barbarianrate     = GAME_DEFAULT_BARBARIANRATE;
     game.server.civilwarsize      = GAME_DEFAULT_CIVILWARSIZE;
+    game.server.cm_threads        = GAME_DEFAULT_CM_THREADS;
     game.server.connectmsg[0]     = '\0';
     game.server.conquercost       = GAME_DEFAULT_CONQUERCOST;
     game.server.contactturns      = GAME_DEFAULT_CONTACTTURNS;
@@ -412,14 +415,18 @@ static void game_defaults(bool keep_ruleset_value)
     }
     game.server.save_compress_level = GAME_DEFAULT_COMPRESS_LEVEL;
     game.server.save_compress_type = GAME_DEFAULT_COMPRESS_TYPE;
+    game.server.save_compress_threads = GAME_DEFAULT_COMPRESS_THREADS;
     sz_strlcpy(game.server.save_name, GAME_DEFAULT_SAVE_NAME);
     game.server.save_nturns       = GAME_DEFAULT_SAVETURNS;
+    game.server.checkpoint_turns  = GAME_DEFAULT_CHECKPOINTTURNS;
     game.server.save_options.save_known = TRUE;
     game.server.save_options.save_private_map = TRUE;
     game.server.save_options.save_starts = TRUE;
     game.server.savepalace        = GAME_DEFAULT_SAVEPALACE;
     game.server.scorelog          = GAME_DEFAULT_SCORELOG;
     game.server.scoreloglevel     = GAME_DEFAULT_SCORELOGLEVEL;
+    game.server.proflog           = GAME_DEFAULT_PROFLOG;
+    sz_strlcpy(game.server.proffile, GAME_DEFAULT_PROFFILE);
     game.server.scoreturn         = GAME_DEFAULT_SCORETURN - 1;
     game.server.seed              = GAME_DEFAULT_SEED;
     sz_strlcpy(game.server.start_units, GAME_DEFAULT_START_UNITS);
@@ -459,6 +466,7 @@ void game_init(bool keep_ruleset_value)
   game_ruleset_init();
   idex_init(&wld);
   cm_init();
+  pf_init();
   researches_init();
   universal_found_functions_init();
   treaties_init();
@@ -491,6 +499,7 @@ void game_free(void)
   team_slots_free();
   game_ruleset_free();
   researches_free();
+  pf_free();
   cm_free();
   modpacks_free();
 }
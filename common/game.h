@@ -69,6 +69,12 @@ enum scorelog_level {
   SL_HUMANS
 };
 
+enum proflog_format {
+  PROFLOG_DISABLED = 0,
+  PROFLOG_CSV,
+  PROFLOG_JSON
+};
+
 struct user_flag
 {
   char *name;
@@ -126,6 +132,7 @@ struct civ_game {
 
       enum city_names_mode allowed_city_names;
       enum plrcolor_mode plrcolormode;
+      int ai_threads;
       int aqueductloss;
       bool auto_ai_toggle;
       bool autoattack;
@@ -133,6 +140,7 @@ struct civ_game {
       enum barbarians_rate barbarianrate;
       int base_incite_cost;
       int civilwarsize;
+      int cm_threads;
       int conquercost;
       int contactturns;
       int diplchance;
@@ -178,9 +186,13 @@ struct civ_game {
       int revolution_length;
       int spaceship_travel_pct;
       bool threaded_save;
+      bool threaded_send;
       int save_compress_level;
       enum fz_method save_compress_type;
+      int save_compress_threads;
+      bool save_binary;
       int save_nturns;
+      int checkpoint_turns;
       int save_frequency;
       unsigned autosaves; /* FIXME: char would be enough, but current settings.c code wants to
                              write sizeof(unsigned) bytes */
@@ -221,6 +233,8 @@ struct civ_game {
       bool scorelog;
       enum scorelog_level scoreloglevel;
       char scorefile[MAX_LEN_PATH];
+      enum proflog_format proflog;
+      char proffile[MAX_LEN_PATH];
       int scoreturn;    /* next make_history_report() */
       randseed seed_setting;
       randseed seed;
@@ -423,6 +437,14 @@ static inline bool is_ruleset_compat_mode(void)
 #define GAME_MIN_AIFILL              0
 #define GAME_MAX_AIFILL              GAME_MAX_MAX_PLAYERS
 
+#define GAME_DEFAULT_AI_THREADS      1
+#define GAME_MIN_AI_THREADS          1
+#define GAME_MAX_AI_THREADS          32
+
+#define GAME_DEFAULT_CM_THREADS      1
+#define GAME_MIN_CM_THREADS          1
+#define GAME_MAX_CM_THREADS          32
+
 #define GAME_DEFAULT_NATIONSET       ""
 
 #define GAME_DEFAULT_FOODBOX         100
@@ -591,6 +613,9 @@ static inline bool is_ruleset_compat_mode(void)
 #define GAME_DEFAULT_SCORELOGLEVEL   SL_ALL
 #define GAME_DEFAULT_SCOREFILE       "freeciv-score.log"
 
+#define GAME_DEFAULT_PROFLOG         PROFLOG_DISABLED
+#define GAME_DEFAULT_PROFFILE        "freeciv-prof.log"
+
 /* Turns between reports is random between SCORETURN and (2 x SCORETURN).
  * First report is shown at SCORETURN. As report is generated in the end of the turn,
  * first report is already generated at (SCORETURN - 1) */
@@ -695,6 +720,9 @@ static inline bool is_ruleset_compat_mode(void)
 #define GAME_DEFAULT_SAVETURNS       1
 #define GAME_MIN_SAVETURNS           1
 #define GAME_MAX_SAVETURNS           200
+#define GAME_DEFAULT_CHECKPOINTTURNS 0
+#define GAME_MIN_CHECKPOINTTURNS     0
+#define GAME_MAX_CHECKPOINTTURNS     100
 #define GAME_DEFAULT_SAVEFREQUENCY   15
 #define GAME_MIN_SAVEFREQUENCY       2
 #define GAME_MAX_SAVEFREQUENCY       1440
@@ -707,6 +735,10 @@ static inline bool is_ruleset_compat_mode(void)
 
 #define GAME_DEFAULT_THREADED_SAVE   FALSE
 
+#define GAME_DEFAULT_THREADED_SEND   FALSE
+
+#define GAME_DEFAULT_SAVE_BINARY     FALSE
+
 #define GAME_DEFAULT_USER_META_MESSAGE ""
 
 #define GAME_DEFAULT_SKILL_LEVEL     AI_LEVEL_EASY
@@ -736,6 +768,10 @@ static inline bool is_ruleset_compat_mode(void)
 #define GAME_MIN_COMPRESS_LEVEL     1
 #define GAME_MAX_COMPRESS_LEVEL     9
 
+#define GAME_DEFAULT_COMPRESS_THREADS 1
+#define GAME_MIN_COMPRESS_THREADS     1
+#define GAME_MAX_COMPRESS_THREADS     64
+
 #if defined(FREECIV_HAVE_LIBZSTD)
 #  define GAME_DEFAULT_COMPRESS_TYPE FZ_ZSTD
 #elif defined(FREECIV_HAVE_LIBLZMA)
@@ -132,6 +132,8 @@ class ScriptConfig:
             ("client_impl_path",   "--client-c", "client/packhand_gen.c"),
             ("server_header_path", "--server-h", "server/hand_gen.h"),
             ("server_impl_path",   "--server-c", "server/hand_gen.c"),
+            ("bench_header_path",  "--bench-h",  "server/packetbench_gen.h"),
+            ("bench_impl_path",    "--bench-c",  "server/packetbench_gen.c"),
         )
 
         for dest, option, canonical in output_path_args:
@@ -170,6 +172,12 @@ class ScriptConfig:
             self.client_impl_path = optional_path
             """Output path for the client implementation, or None if that
             should not be generated"""
+            self.bench_header_path = optional_path
+            """Output path for the freeciv-packetbench header, or None if
+            that should not be generated"""
+            self.bench_impl_path = optional_path
+            """Output path for the freeciv-packetbench implementation, or
+            None if that should not be generated"""
 
             self.verbose = False
             """Whether to enable verbose logging"""
@@ -703,6 +711,15 @@ class FieldType(RawFieldType):
         the `old` and `real_packet` and setting `differ` accordingly."""
         raise NotImplementedError
 
+    def get_code_sample(self, location: Location) -> str:
+        """Generate a code snippet setting a field of this type of the
+        `real_packet` to a random value, for freeciv-packetbench."""
+        raise ValueError("sample not supported for type %s in field %s" % (self, location.name))
+
+    def get_sizes(self) -> "list[SizeInfo]":
+        """Return the size info of all array dimensions of this type."""
+        return []
+
     @abstractmethod
     def get_code_put(self, location: Location, deep_diff: bool = False) -> str:
         """Generate a code snippet writing a field of this type to the
@@ -791,6 +808,18 @@ class IntType(BasicType):
 result += key->%s;
 """ % location
 
+    def get_code_sample(self, location: Location) -> str:
+        bits = int(self.dataio_type[4:])
+        if self.dataio_type[0] == "u":
+            low = "0"
+            high = "INT_MAX" if bits >= 32 else str((1 << bits) - 1)
+        else:
+            low = "INT_MIN" if bits >= 32 else str(-(1 << (bits - 1)))
+            high = "INT_MAX" if bits >= 32 else str((1 << (bits - 1)) - 1)
+        return """\
+real_packet->{location} = sample_int({low}, {high});
+""".format(location = location, low = low, high = high)
+
     def get_code_get(self, location: Location, deep_diff: bool = False) -> str:
         if self.public_type in ("int", "bool"):
             # read directly
@@ -835,6 +864,11 @@ class BoolType(IntType):
 
         super().__init__(dataio_info, public_type)
 
+    def get_code_sample(self, location: Location) -> str:
+        return """\
+real_packet->{location} = sample_bool();
+""".format(location = location)
+
 DEFAULT_REGISTRY.dataio_patterns[BoolType.TYPE_PATTERN] = BoolType
 
 
@@ -886,6 +920,12 @@ if (!DIO_GET({self.dataio_type}, &din, &field_addr, &real_packet->{location}, {s
 }}
 """.format(self = self, location = location)
 
+    def get_code_sample(self, location: Location) -> str:
+        return """\
+real_packet->{location} = sample_float({signed});
+""".format(location = location,
+           signed = "TRUE" if self.dataio_type[0] == "s" else "FALSE")
+
     def __str__(self) -> str:
         return "{self.dataio_type}{self.float_factor:d}({self.public_type})".format(self = self)
 
@@ -906,6 +946,11 @@ class BitvectorType(BasicType):
 differ = !BV_ARE_EQUAL(old->{location}, real_packet->{location});
 """.format(self = self, location = location)
 
+    def get_code_sample(self, location: Location) -> str:
+        return """\
+sample_memory(real_packet->{location}.vec, sizeof(real_packet->{location}.vec));
+""".format(location = location)
+
     def get_code_put(self, location: Location, deep_diff: bool = False) -> str:
         return """\
 e |= DIO_BV_PUT(&dout, &field_addr, packet->{location});
@@ -956,6 +1001,11 @@ class StructType(BasicType):
     def get_code_cmp(self, location: Location) -> str:
         return """\
 differ = !are_{self.dataio_type}s_equal(&old->{location}, &real_packet->{location});
+""".format(self = self, location = location)
+
+    def get_code_sample(self, location: Location) -> str:
+        return """\
+sample_{self.dataio_type}(&real_packet->{location});
 """.format(self = self, location = location)
 
     def get_code_put(self, location: Location, deep_diff: bool = False) -> str:
@@ -1024,6 +1074,9 @@ class SizedType(BasicType):
         pre = "" if location.depth else "const "
         return pre + super().get_code_handle_param(location.deeper("*%s" % location))
 
+    def get_sizes(self) -> "list[SizeInfo]":
+        return [self.size]
+
     @abstractmethod
     def get_code_fill(self, location: Location) -> str:
         return super().get_code_fill(location)
@@ -1047,6 +1100,11 @@ class StringType(SizedType):
     def get_code_fill(self, location: Location) -> str:
         return """\
 sz_strlcpy(real_packet->{location}, {location});
+""".format(location = location)
+
+    def get_code_sample(self, location: Location) -> str:
+        return """\
+sample_string(real_packet->{location}, sizeof(real_packet->{location}));
 """.format(location = location)
 
     def get_code_cmp(self, location: Location) -> str:
@@ -1076,6 +1134,11 @@ class MemoryType(SizedType):
     def get_code_fill(self, location: Location) -> str:
         raise NotImplementedError("fill not supported for memory-type fields")
 
+    def get_code_sample(self, location: Location) -> str:
+        return """\
+sample_memory(real_packet->{location}, sizeof(real_packet->{location}));
+""".format(location = location)
+
     def get_code_cmp(self, location: Location) -> str:
         if self.size.constant:
             return """\
@@ -1140,6 +1203,21 @@ class ArrayType(FieldType):
     def get_code_hash(self, location: Location) -> str:
         raise ValueError("hash not supported for array type %s in field %s" % (self, location.name))
 
+    def get_code_sample(self, location: Location) -> str:
+        inner_sample = prefix("    ", self.elem.get_code_sample(location.sub))
+        return """\
+{{
+  int {location.index};
+
+  for ({location.index} = 0; {location.index} < {self.size.declared}; {location.index}++) {{
+{inner_sample}\
+  }}
+}}
+""".format(self = self, location = location, inner_sample = inner_sample)
+
+    def get_sizes(self) -> "list[SizeInfo]":
+        return [self.size] + self.elem.get_sizes()
+
     def get_code_cmp(self, location: Location) -> str:
         if not self.size.constant:
             head = """\
@@ -1483,6 +1561,10 @@ class Field:
         the packet struct."""
         return self.type_info.get_code_fill(Location(self.name))
 
+    def get_sample(self) -> str:
+        """Generate code setting this field to a random value."""
+        return self.type_info.get_code_sample(Location(self.name))
+
     def get_hash(self) -> str:
         """Generate code factoring this field into a hash computation."""
         assert self.is_key
@@ -2040,7 +2122,13 @@ static bool cmp_{self.name}(const void *vkey1, const void *vkey2)
                     delta_header += """\
   bool differ;
 """
-                delta_header += """\
+                if self.is_info == "game":
+                    # Shared by the connections of an observer group
+                    delta_header += """\
+  struct genhash **hash = packet_sent_hash(pc, {self.type});
+""".format(self = self)
+                else:
+                    delta_header += """\
   struct genhash **hash = pc->phs.sent + {self.type};
 """.format(self = self)
                 if self.is_info != "no":
@@ -2133,11 +2221,23 @@ if (NULL == *hash) {{
 BV_CLR_ALL(fields);
 
 if (!genhash_lookup(*hash, real_packet, (void **) &old)) {{
+""".format(self = self)
+        tail = self.packet.cache_tail
+        if tail is None:
+            intro += """\
   old = fc_malloc(sizeof(*old));
   *old = *real_packet;
   genhash_insert(*hash, old, old);
   memset(old, 0, sizeof(*old));
-""".format(self = self)
+"""
+        else:
+            # Keep only the part before the (still empty) tail array
+            intro += """\
+  old = fc_malloc(offsetof(struct {self.packet_name}, {tail.name}));
+  memcpy(old, real_packet, offsetof(struct {self.packet_name}, {tail.name}));
+  genhash_insert(*hash, old, old);
+  memset(old, 0, offsetof(struct {self.packet_name}, {tail.name}));
+""".format(self = self, tail = tail)
         if self.is_info != "no":
             intro += """\
   different = 1;      /* Force to send. */
@@ -2194,16 +2294,33 @@ if (e) {
             field.get_put_wrapper(self, i, True)
             for i, field in enumerate(self.other_fields)
         )
-        body += """\
+        if tail is None:
+            body += """\
 
 *old = *real_packet;
 """
+        else:
+            # Reallocate the cached copy when the used tail length changes
+            body += """\
+
+if (cache_size_{self.packet_name}(real_packet)
+    != cache_size_{self.packet_name}(old)) {{
+  /* A new copy still has a zeroed key: restore it to find the copy. */
+  memcpy(old, real_packet, offsetof(struct {self.packet_name}, {tail.name}));
+  genhash_remove(*hash, real_packet);
+  old = fc_malloc(cache_size_{self.packet_name}(real_packet));
+  memcpy(old, real_packet, cache_size_{self.packet_name}(real_packet));
+  genhash_insert(*hash, old, old);
+}} else {{
+  memcpy(old, real_packet, cache_size_{self.packet_name}(real_packet));
+}}
+""".format(self = self, tail = tail)
 
         # Cancel some is-info packets.
         for i in self.cancel:
             body += """\
 
-hash = pc->phs.sent + %s;
+hash = packet_sent_hash(pc, %s);
 if (NULL != *hash) {
   genhash_remove(*hash, real_packet);
 }
@@ -2553,6 +2670,17 @@ class Packet:
         self.other_fields = [field for field in self.fields if not field.is_key]
         """List of only the non-key fields of this packet"""
 
+        self.cache_tail = None
+        """The variable-length array field stored last in this packet's
+        struct, or None. Copies cached for delta comparison only keep the
+        used part of this array; see get_cache_size()."""
+        if self.delta:
+            for field in self.other_fields:
+                if (isinstance(field.type_info, ArrayType)
+                        and not field.type_info.size.constant
+                        and not field.diff):
+                    self.cache_tail = field
+
         # valid, since self.fields is already set
         if self.no_packet:
             self.delta = False
@@ -2652,7 +2780,12 @@ struct {self.name} {{
 
         body = "".join(
             prefix("  ", field.get_declar())
-            for field in chain(self.key_fields, self.other_fields)
+            for field in chain(
+                self.key_fields,
+                (field for field in self.other_fields
+                 if field is not self.cache_tail),
+                (self.cache_tail,) if self.cache_tail is not None else (),
+            )
         ) or """\
   char __dummy;                 /* to avoid malloc(0); */
 """
@@ -2726,10 +2859,117 @@ struct {self.name} {{
 
 """.format(self = self, func = func, args = args)
 
+    def get_cache_size(self) -> str:
+        """Generate the function returning how many bytes of a packet
+        struct are kept in the delta cache. Only packets with a cache_tail
+        get one; all others cache the whole struct."""
+        if self.cache_tail is None:
+            return ""
+        size = self.cache_tail.type_info.size
+        return """\
+static size_t cache_size_{self.name}(const struct {self.name} *packet)
+{{
+  return offsetof(struct {self.name}, {tail})
+         + MIN({real}, {size.declared}) * sizeof(packet->{tail}[0]);
+}}
+
+""".format(self = self, tail = self.cache_tail.name, size = size,
+           real = size.actual_for("packet"))
+
+    def get_bench_clamp(self) -> str:
+        """Generate code bringing the actual sizes of this packet's arrays
+        back into range after random values were set. They are kept short
+        enough for the packet to fit in a single network packet."""
+        sizes = {}
+        for field in self.fields:
+            for size in field.type_info.get_sizes():
+                if not size.constant:
+                    declared = sizes.setdefault(size.real, [])
+                    if size.declared not in declared:
+                        declared.append(size.declared)
+        result = ""
+        for real, declared in sizes.items():
+            limit = "PACKETBENCH_MAX_ARRAY"
+            for other in reversed(declared):
+                limit = "MIN({other}, {limit})".format(other = other, limit = limit)
+            result += """\
+if ({real} < 0 || {real} > {limit}) {{
+  {real} = sample_int(0, {limit});
+}}
+""".format(real = real, limit = limit)
+        return result
+
+    def get_bench(self) -> str:
+        """Generate the functions freeciv-packetbench uses to build random
+        packets of this type and to compare them."""
+        if self.no_packet:
+            return ""
+        sample = "".join(
+            prefix("  ", field.get_sample())
+            for field in self.fields
+        )
+        clamp = prefix("  ", self.get_bench_clamp())
+        result = """\
+static void sample_{self.name}(struct {self.name} *real_packet)
+{{
+{sample}\
+{clamp}\
+}}
+
+""".format(self = self, sample = sample, clamp = clamp)
+
+        if self.other_fields:
+            cases = "".join(
+                """\
+  case {i:d}:
+{sample}\
+    break;
+""".format(i = i, sample = prefix("    ", field.get_sample()))
+                for i, field in enumerate(self.other_fields)
+            )
+            result += """\
+static void change_{self.name}(struct {self.name} *real_packet)
+{{
+  switch (fc_rand({num:d})) {{
+{cases}\
+  }}
+{clamp}\
+}}
+
+""".format(self = self, num = len(self.other_fields), cases = cases,
+           clamp = clamp)
+
+        for func, fields in (("same_key", self.key_fields),
+                             ("equal", self.fields)):
+            if not fields:
+                continue
+            cmp = "\n".join(
+                prefix("  ", field.get_cmp()) + """\
+  if (differ) {
+    return FALSE;
+  }
+"""
+                for field in fields
+            )
+            result += """\
+static bool {func}_{self.name}(const struct {self.name} *old,
+{indent}const struct {self.name} *real_packet)
+{{
+  bool differ;
+
+{cmp}\
+
+  return TRUE;
+}}
+
+""".format(self = self, func = func, cmp = cmp,
+           indent = " " * len("static bool %s_%s(" % (func, self.name)))
+        return result
+
     def get_variants(self) -> str:
         """Generate all code associated with individual variants of this
         packet; see the Variant class (and its methods) for details."""
-        result=""
+        result = self.get_cache_size()
         for v in self.variants:
             if v.delta:
                 result += """\
@@ -2750,6 +2990,21 @@ struct {self.name} {{
         """Generate the implementation of the lsend function, which takes
         a list of connections to send a packet to."""
         if not self.want_lsend: return ""
+        if self.is_info == "game":
+            # Built only once for each observer group in the list
+            return """\
+{self.lsend_prototype}
+{{
+  int serial = observer_group_send_serial();
+
+  conn_list_iterate(dest, pconn) {{
+    if (observer_group_send_needed(pconn, serial)) {{
+      send_{self.name}(pconn{self.extra_send_args2});
+    }}
+  }} conn_list_iterate_end;
+}}
+
+""".format(self = self)
         return """\
 {self.lsend_prototype}
 {{
@@ -3142,6 +3397,167 @@ bool packet_has_game_info_flag(enum packet_type type)
 """
         return intro + body + extro
 
+    @property
+    def code_packet_struct_size(self) -> str:
+        """Code fragment implementing the packet_struct_size() function"""
+        intro = """\
+size_t packet_struct_size(enum packet_type type)
+{
+  static const size_t size[PACKET_LAST] = {
+"""
+        body = ""
+        for _, packet, skipped in self.iter_by_number():
+            body += """\
+    0,
+""" * skipped
+            body += """\
+    sizeof(struct %s),
+""" % packet.name
+
+        extro = """\
+  };
+
+  return (type < PACKET_LAST ? size[type] : 0);
+}
+
+"""
+        return intro + body + extro
+
+    @property
+    def code_packet_cache_size(self) -> str:
+        """Code fragment implementing the packet_cache_size() function"""
+        intro = """\
+size_t packet_cache_size(enum packet_type type, const void *packet)
+{
+  switch (type) {
+"""
+        body = ""
+        for packet in self:
+            if packet.cache_tail is None:
+                continue
+            body += """\
+  case {packet.type}:
+    return cache_size_{packet.name}((const struct {packet.name} *) packet);
+""".format(packet = packet)
+
+        extro = """\
+  default:
+    return packet_struct_size(type);
+  }
+}
+
+"""
+        return intro + body + extro
+
+    @property
+    def code_send_packet_by_type(self) -> str:
+        """Code fragment implementing the send_packet_by_type() function"""
+        intro = """\
+int send_packet_by_type(struct connection *pc, enum packet_type type,
+                        const void *packet)
+{
+  switch (type) {
+"""
+        body = ""
+        for packet in self:
+            if packet.no_packet:
+                body += """\
+  case {packet.type}:
+    return send_{packet.name}(pc);
+""".format(packet = packet)
+            elif packet.want_force:
+                body += """\
+  case {packet.type}:
+    return send_{packet.name}(pc, packet, FALSE);
+""".format(packet = packet)
+
+        extro = """\
+  default:
+    fc_assert_ret_val_msg(pc->phs.handlers->send[type].packet != NULL, -1,
+                          "Handler for %s not installed", packet_name(type));
+    return pc->phs.handlers->send[type].packet(pc, packet);
+  }
+}
+
+"""
+        return intro + body + extro
+
+    @property
+    def code_packetbench(self) -> str:
+        """Code fragment implementing the packetbench_sample(),
+        packetbench_change(), packetbench_same_key() and
+        packetbench_equal() functions"""
+        sample = ""
+        change = ""
+        same_key = ""
+        equal = ""
+        for packet in self:
+            if packet.no_packet:
+                continue
+            sample += """\
+  case {packet.type}:
+    sample_{packet.name}(packet);
+    break;
+""".format(packet = packet)
+            if packet.other_fields:
+                change += """\
+  case {packet.type}:
+    change_{packet.name}(packet);
+    break;
+""".format(packet = packet)
+            if packet.key_fields:
+                same_key += """\
+  case {packet.type}:
+    return same_key_{packet.name}(packet1, packet2);
+""".format(packet = packet)
+            equal += """\
+  case {packet.type}:
+    return equal_{packet.name}(packet1, packet2);
+""".format(packet = packet)
+
+        return """\
+void packetbench_sample(enum packet_type type, void *packet)
+{{
+  memset(packet, 0, packet_struct_size(type));
+
+  switch (type) {{
+{sample}\
+  default:
+    break;
+  }}
+}}
+
+void packetbench_change(enum packet_type type, void *packet)
+{{
+  switch (type) {{
+{change}\
+  default:
+    break;
+  }}
+}}
+
+bool packetbench_same_key(enum packet_type type, const void *packet1,
+                          const void *packet2)
+{{
+  switch (type) {{
+{same_key}\
+  default:
+    return TRUE;
+  }}
+}}
+
+bool packetbench_equal(enum packet_type type, const void *packet1,
+                       const void *packet2)
+{{
+  switch (type) {{
+{equal}\
+  default:
+    return TRUE;
+  }}
+}}
+""".format(sample = sample, change = change, same_key = same_key,
+           equal = equal)
+
     @property
     def code_packet_handlers_fill_initial(self) -> str:
         """Code fragment implementing the packet_handlers_fill_initial()
@@ -3419,6 +3835,7 @@ static int stats_total_sent;
 
         output_c.write(packets.code_packet_name)
         output_c.write(packets.code_packet_has_game_info_flag)
+        output_c.write(packets.code_packet_struct_size)
 
         # write hash, cmp, send, receive
         for p in packets:
@@ -3428,6 +3845,8 @@ static int stats_total_sent;
             output_c.write(p.get_dsend())
             output_c.write(p.get_dlsend())
 
+        output_c.write(packets.code_packet_cache_size)
+        output_c.write(packets.code_send_packet_by_type)
         output_c.write(packets.code_packet_handlers_fill_initial)
         output_c.write(packets.code_packet_handlers_fill_capability)
 
@@ -3605,6 +4024,53 @@ bool client_handle_packet(enum packet_type type, const void *packet)
 """)
 
 
+def write_bench_header(path: "str | Path | None", packets: PacketsDefinition):
+    """Write contents for server/packetbench_gen.h to the given path"""
+    if path is None:
+        return
+    with packets.cfg.open_write(path, wrap_header = "packetbench_gen", cplusplus = False) as f:
+        f.write("""\
+/* utility */
+#include "support.h"            /* bool type */
+
+/* common */
+#include "packets.h"
+
+void packetbench_sample(enum packet_type type, void *packet);
+void packetbench_change(enum packet_type type, void *packet);
+bool packetbench_same_key(enum packet_type type, const void *packet1,
+                          const void *packet2);
+bool packetbench_equal(enum packet_type type, const void *packet1,
+                       const void *packet2);
+""")
+
+def write_bench_impl(path: "str | Path | None", packets: PacketsDefinition):
+    """Write contents for server/packetbench_gen.c to the given path"""
+    if path is None:
+        return
+    with packets.cfg.open_write(path) as f:
+        f.write("""\
+#ifdef HAVE_CONFIG_H
+#include <fc_config.h>
+#endif
+
+#include <string.h>
+
+/* utility */
+#include "rand.h"
+
+/* common */
+#include "packets.h"
+
+#include "packetbench.h"
+#include "packetbench_gen.h"
+
+""")
+        for p in packets:
+            f.write(p.get_bench())
+        f.write(packets.code_packetbench)
+
+
 def main(raw_args: "typing.Sequence[str] | None" = None):
     """Main function. Read the given arguments, or the command line
     arguments if raw_args is not given, and run the packet code generation
@@ -3622,6 +4088,8 @@ def main(raw_args: "typing.Sequence[str] | None" = None):
     write_client_header(script_args.client_header_path, packets)
     write_server_impl(script_args.server_impl_path, packets)
     write_client_impl(script_args.client_impl_path, packets)
+    write_bench_header(script_args.bench_header_path, packets)
+    write_bench_impl(script_args.bench_impl_path, packets)
 
 
 if __name__ == "__main__":
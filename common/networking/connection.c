@@ -31,6 +31,9 @@
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
 #endif
+#ifdef FREECIV_HAVE_LIBZSTD
+#include <zstd.h>
+#endif
 
 /* utility */
 #include "fcintl.h"
@@ -54,6 +57,9 @@ static void default_conn_close_callback(struct connection *pconn);
  */
 const char blank_addr_str[] = "---.---.---.---";
 
+/* Size of the segments the small packets are copied to. */
+#define SEND_SEGMENT_SIZE (4 * MAX_LEN_PACKET)
+
 /****************************************************************************
   This callback is used when an error occurs trying to write to the
   connection. The effect of the callback should be to close the connection.
@@ -64,6 +70,10 @@ const char blank_addr_str[] = "---.---.---.---";
 ****************************************************************************/
 static conn_close_fn_t conn_close_callback = default_conn_close_callback;
 
+/* When set, the data to write to the sockets is handed to this function
+ * instead of being written directly. See connections_set_writer(). */
+static conn_writer_fn_t conn_writer = NULL;
+
 /************************************************************************//**
   Default 'conn_close_fn_t' to close a connection.
 ****************************************************************************/
@@ -82,6 +92,16 @@ void connections_set_close_callback(conn_close_fn_t func)
   conn_close_callback = func;
 }
 
+/**********************************************************************//**
+  Register the function taking over the socket writes, or NULL to write
+  directly again. The writer is given the connection whose send buffer
+  has to be written; it must take all its data and leave it empty.
+**************************************************************************/
+void connections_set_writer(conn_writer_fn_t func)
+{
+  conn_writer = func;
+}
+
 /**********************************************************************//**
   Call the conn_close_callback.
 **************************************************************************/
@@ -158,19 +178,203 @@ int read_socket_data(int sock, struct socket_packet_buffer *buffer)
   return -1;
 }
 
+/**********************************************************************//**
+  Return a new segment with room for 'capacity' bytes of data. The caller
+  holds the only reference to it.
+**************************************************************************/
+struct send_segment *send_segment_new(int capacity)
+{
+  struct send_segment *segment = fc_malloc(sizeof(*segment));
+
+  segment->refcount = 1;
+  segment->size = 0;
+  segment->capacity = capacity;
+  segment->data = fc_malloc(MAX(capacity, 1));
+
+  return segment;
+}
+
+/**********************************************************************//**
+  Release a reference to the segment, freeing it if it was the last one.
+**************************************************************************/
+void send_segment_unref(struct send_segment *segment)
+{
+  fc_assert_ret(0 < segment->refcount);
+
+  if (0 == --segment->refcount) {
+    free(segment->data);
+    free(segment);
+  }
+}
+
+/**********************************************************************//**
+  Return the last segment of the queue, or NULL if it is empty.
+**************************************************************************/
+static struct send_segment *
+send_buffer_last(const struct socket_send_buffer *buf)
+{
+  return (0 < buf->nsegments
+          ? buf->segments[buf->first + buf->nsegments - 1] : NULL);
+}
+
+/**********************************************************************//**
+  Append a segment to the queue. The queue takes over the reference of
+  the caller.
+**************************************************************************/
+static void send_buffer_append(struct socket_send_buffer *buf,
+                               struct send_segment *segment)
+{
+  if (buf->first + buf->nsegments == buf->allocated) {
+    if (0 < buf->first) {
+      memmove(buf->segments, buf->segments + buf->first,
+              buf->nsegments * sizeof(*buf->segments));
+      buf->first = 0;
+    } else {
+      buf->allocated = MAX(2 * buf->allocated, 16);
+      buf->segments = fc_realloc(buf->segments,
+                                 buf->allocated * sizeof(*buf->segments));
+    }
+  }
+
+  buf->segments[buf->first + buf->nsegments++] = segment;
+  buf->ndata += segment->size;
+  buf->nsize += segment->capacity;
+}
+
+/**********************************************************************//**
+  Append all the data of 'src' to 'dest', leaving 'src' empty. The
+  segments are moved, not copied, except for the rest of a partially
+  sent one, which can only stay as it is at the head of 'dest'.
+**************************************************************************/
+void send_buffer_move(struct socket_send_buffer *dest,
+                      struct socket_send_buffer *src)
+{
+  int i = 0;
+
+  if (0 < src->offset) {
+    struct send_segment *segment = src->segments[src->first];
+
+    if (0 == dest->nsegments) {
+      dest->offset = src->offset;
+      dest->ndata -= src->offset;
+    } else {
+      struct send_segment *rest
+        = send_segment_new(segment->size - src->offset);
+
+      memcpy(rest->data, segment->data + src->offset, rest->capacity);
+      rest->size = rest->capacity;
+      send_buffer_append(dest, rest);
+      send_segment_unref(segment);
+      i = 1;
+    }
+  }
+
+  for (; i < src->nsegments; i++) {
+    send_buffer_append(dest, src->segments[src->first + i]);
+  }
+
+  src->ndata = 0;
+  src->nsize = 0;
+  src->first = 0;
+  src->nsegments = 0;
+  src->offset = 0;
+}
+
+/**********************************************************************//**
+  Release all the segments of the queue, sent or not.
+**************************************************************************/
+void send_buffer_clear(struct socket_send_buffer *buf)
+{
+  int i;
+
+  for (i = 0; i < buf->nsegments; i++) {
+    send_segment_unref(buf->segments[buf->first + i]);
+  }
+
+  buf->ndata = 0;
+  buf->nsize = 0;
+  buf->first = 0;
+  buf->nsegments = 0;
+  buf->offset = 0;
+}
+
+/**********************************************************************//**
+  Fill 'iov' with the data at the head of the queue, using at most
+  'max' entries. Return the number of entries used.
+**************************************************************************/
+int send_buffer_iovec(const struct socket_send_buffer *buf,
+                      struct fc_iovec *iov, int max)
+{
+  int niov = MIN(buf->nsegments, max);
+  int i;
+
+  for (i = 0; i < niov; i++) {
+    const struct send_segment *segment = buf->segments[buf->first + i];
+    int offset = (0 == i ? buf->offset : 0);
+
+    iov[i].base = segment->data + offset;
+    iov[i].len = segment->size - offset;
+  }
+
+  return niov;
+}
+
+/**********************************************************************//**
+  Forget the first 'len' bytes of the queue, which have been sent. The
+  segments sent completely are released, or moved to 'sent' when it is
+  not NULL, so that a thread which must not touch the reference counts
+  can consume the queue.
+**************************************************************************/
+void send_buffer_consume(struct socket_send_buffer *buf, int len,
+                         struct socket_send_buffer *sent)
+{
+  buf->ndata -= len;
+
+  while (0 < len) {
+    struct send_segment *segment = buf->segments[buf->first];
+    int left = segment->size - buf->offset;
+
+    if (len < left) {
+      buf->offset += len;
+      return;
+    }
+
+    len -= left;
+    buf->offset = 0;
+    buf->nsize -= segment->capacity;
+    if (NULL != sent) {
+      send_buffer_append(sent, segment);
+    } else {
+      send_segment_unref(segment);
+    }
+    buf->first++;
+    buf->nsegments--;
+  }
+
+  if (0 == buf->nsegments) {
+    buf->first = 0;
+  }
+}
+
 /**********************************************************************//**
   Write wrapper function -vasc
 **************************************************************************/
 static int write_socket_data(struct connection *pc,
-                             struct socket_packet_buffer *buf, int limit)
+                             struct socket_send_buffer *buf, int limit)
 {
-  int start, nput, nblock;
+  int written = 0;
 
   if (is_server() && pc->server.is_closing) {
     return 0;
   }
 
-  for (start = 0; buf->ndata-start > limit;) {
+  if (NULL != conn_writer) {
+    /* The writer thread does the actual writing. */
+    conn_writer(pc);
+    return 0;
+  }
+
+  while (buf->ndata > limit) {
     fd_set writefs, exceptfs;
     fc_timeval tv;
 
@@ -197,10 +401,13 @@ static int write_socket_data(struct connection *pc,
     }
 
     if (FD_ISSET(pc->sock, &writefs)) {
-      nblock = MIN(buf->ndata-start, MAX_LEN_PACKET);
-      log_debug("trying to write %d limit=%d", nblock, limit);
-      if ((nput = fc_writesocket(pc->sock, 
-                                 (const char *)buf->data+start, nblock)) == -1) {
+      struct fc_iovec iov[FC_IOV_MAX];
+      int niov = send_buffer_iovec(buf, iov, FC_IOV_MAX);
+      int nput;
+
+      log_debug("trying to write %d bytes in %d segments limit=%d",
+                buf->ndata, niov, limit);
+      if ((nput = fc_writevsocket(pc->sock, iov, niov)) == -1) {
 #ifdef NONBLOCKING_SOCKETS
         if (errno == EWOULDBLOCK || errno == EAGAIN) {
           break;
@@ -209,13 +416,12 @@ static int write_socket_data(struct connection *pc,
         connection_close(pc, _("lagging connection"));
         return -1;
       }
-      start += nput;
+      send_buffer_consume(buf, nput, NULL);
+      written += nput;
     }
   }
 
-  if (start > 0) {
-    buf->ndata -= start;
-    memmove(buf->data, buf->data+start, buf->ndata);
+  if (written > 0) {
     pc->last_write = timer_renew(pc->last_write, TIMER_USER, TIMER_ACTIVE,
                                  pc->last_write != NULL ? NULL : "socket write");
     timer_start(pc->last_write);
@@ -255,12 +461,15 @@ static void flush_connection_send_buffer_packets(struct connection *pc)
 #endif /* FREECIV_JSON_CONNECTION */
 
 /**********************************************************************//**
-  Add data to send to the connection.
+  Add data to send to the connection. The data is copied at the end of
+  the last segment when it has room for it and is not shared, else to a
+  new segment.
 **************************************************************************/
 static bool add_connection_data(struct connection *pconn,
                                 const unsigned char *data, int len)
 {
-  struct socket_packet_buffer *buf;
+  struct socket_send_buffer *buf;
+  struct send_segment *segment;
 
   if (NULL == pconn
       || !pconn->used
@@ -270,23 +479,64 @@ static bool add_connection_data(struct connection *pconn,
 
   buf = pconn->send_buffer;
   log_debug("add %d bytes to %d (space =%d)", len, buf->ndata, buf->nsize);
-  if (!buffer_ensure_free_extra_space(buf, len)) {
+  /* added this check so we don't gobble up too much mem */
+  if (buf->ndata + len > MAX_LEN_BUFFER) {
     connection_close(pconn, _("buffer overflow"));
     return FALSE;
   }
 
-  memcpy(buf->data + buf->ndata, data, len);
-  buf->ndata += len;
+  segment = send_buffer_last(buf);
+  if (NULL != segment && 1 == segment->refcount
+      && segment->capacity - segment->size >= len) {
+    memcpy(segment->data + segment->size, data, len);
+    segment->size += len;
+    buf->ndata += len;
+  } else {
+    segment = send_segment_new(MAX(len, SEND_SEGMENT_SIZE));
+    memcpy(segment->data, data, len);
+    segment->size = len;
+    send_buffer_append(buf, segment);
+  }
 
   return TRUE;
 }
 
 /**********************************************************************//**
-  Write data to socket. Return TRUE on success.
+  Add a segment to send to the connection, without copying it.
 **************************************************************************/
-bool connection_send_data(struct connection *pconn,
-                          const unsigned char *data, int len)
+static bool add_connection_segment(struct connection *pconn,
+                                   struct send_segment *segment)
+{
+  struct socket_send_buffer *buf;
+
+  if (NULL == pconn
+      || !pconn->used
+      || (is_server() && pconn->server.is_closing)) {
+    return TRUE;
+  }
+
+  buf = pconn->send_buffer;
+  if (buf->ndata + segment->size > MAX_LEN_BUFFER) {
+    connection_close(pconn, _("buffer overflow"));
+    return FALSE;
+  }
+
+  segment->refcount++;
+  send_buffer_append(buf, segment);
+
+  return TRUE;
+}
+
+/**********************************************************************//**
+  Write data to socket, either copied from 'data' or, when 'segment' is
+  not NULL, that segment. Return TRUE on success.
+**************************************************************************/
+static bool connection_send_real(struct connection *pconn,
+                                 const unsigned char *data, int len,
+                                 struct send_segment *segment)
 {
+  bool added;
+
   if (NULL == pconn
       || !pconn->used
       || (is_server() && pconn->server.is_closing)) {
@@ -298,7 +548,9 @@ bool connection_send_data(struct connection *pconn,
 #ifndef FREECIV_JSON_CONNECTION
   if (0 < pconn->send_buffer->do_buffer_sends) {
     flush_connection_send_buffer_packets(pconn);
-    if (!add_connection_data(pconn, data, len)) {
+    added = (NULL != segment ? add_connection_segment(pconn, segment)
+             : add_connection_data(pconn, data, len));
+    if (!added) {
       log_verbose("cut connection %s due to huge send buffer (1)",
                   conn_description(pconn));
       return FALSE;
@@ -308,7 +560,9 @@ bool connection_send_data(struct connection *pconn,
 #endif /* FREECIV_JSON_CONNECTION */
   {
     flush_connection_send_buffer_all(pconn);
-    if (!add_connection_data(pconn, data, len)) {
+    added = (NULL != segment ? add_connection_segment(pconn, segment)
+             : add_connection_data(pconn, data, len));
+    if (!added) {
       log_verbose("cut connection %s due to huge send buffer (2)",
                   conn_description(pconn));
       return FALSE;
@@ -318,6 +572,27 @@ bool connection_send_data(struct connection *pconn,
   return TRUE;
 }
 
+/**********************************************************************//**
+  Write data to socket. Return TRUE on success.
+**************************************************************************/
+bool connection_send_data(struct connection *pconn,
+                          const unsigned char *data, int len)
+{
+  return connection_send_real(pconn, data, len, NULL);
+}
+
+/**********************************************************************//**
+  Write the data of the segment to socket. The segment is not copied, so
+  it must not change anymore; the caller keeps its reference to it.
+  Return TRUE on success.
+**************************************************************************/
+bool connection_send_segment(struct connection *pconn,
+                             struct send_segment *segment)
+{
+  return connection_send_real(pconn, segment->data, segment->size,
+                              segment);
+}
+
 /**********************************************************************//**
   Turn on buffering, using a counter so that calls may be nested.
 **************************************************************************/
@@ -462,6 +737,26 @@ static void free_socket_packet_buffer(struct socket_packet_buffer *buf)
   }
 }
 
+/**********************************************************************//**
+  Create a new, empty, send buffer.
+**************************************************************************/
+struct socket_send_buffer *new_socket_send_buffer(void)
+{
+  return fc_calloc(1, sizeof(struct socket_send_buffer));
+}
+
+/**********************************************************************//**
+  Free a send buffer, releasing the segments it still has to send.
+**************************************************************************/
+void free_socket_send_buffer(struct socket_send_buffer *buf)
+{
+  if (buf) {
+    send_buffer_clear(buf);
+    free(buf->segments);
+    free(buf);
+  }
+}
+
 /**********************************************************************//**
   Return pointer to static string containing a description for this
   connection, based on pconn->name, pconn->addr, and (if applicable)
@@ -548,6 +843,12 @@ void free_compression_queue(struct connection *pc)
 {
 #ifdef USE_COMPRESSION
   byte_vector_free(&pc->compression.queue);
+#ifdef FREECIV_HAVE_LIBZSTD
+  ZSTD_freeCCtx(pc->compression.zstd_cctx);
+  pc->compression.zstd_cctx = NULL;
+  ZSTD_freeDCtx(pc->compression.zstd_dctx);
+  pc->compression.zstd_dctx = NULL;
+#endif /* FREECIV_HAVE_LIBZSTD */
 #endif /* USE_COMPRESSION */
 }
 
@@ -608,17 +909,23 @@ void connection_common_init(struct connection *pconn)
   pconn->closing_reason = NULL;
   pconn->last_write = NULL;
   pconn->buffer = new_socket_packet_buffer();
-  pconn->send_buffer = new_socket_packet_buffer();
+  pconn->send_buffer = new_socket_send_buffer();
   pconn->statistics.bytes_send = 0;
 #ifdef FREECIV_JSON_CONNECTION
   pconn->json_mode = TRUE;
 #endif /* FREECIV_JSON_CONNECTION */
 
   init_packet_hashs(pconn);
+  pconn->phs.recording = NULL;
+  pconn->phs.group = NULL;
 
 #ifdef USE_COMPRESSION
   byte_vector_init(&pconn->compression.queue);
   pconn->compression.frozen_level = 0;
+#ifdef FREECIV_HAVE_LIBZSTD
+  pconn->compression.zstd_cctx = NULL;
+  pconn->compression.zstd_dctx = NULL;
+#endif /* FREECIV_HAVE_LIBZSTD */
 #endif /* USE_COMPRESSION */
 
   pconn->client_gui = GUI_STUB;
@@ -642,7 +949,7 @@ void connection_common_close(struct connection *pconn)
     free_socket_packet_buffer(pconn->buffer);
     pconn->buffer = NULL;
 
-    free_socket_packet_buffer(pconn->send_buffer);
+    free_socket_send_buffer(pconn->send_buffer);
     pconn->send_buffer = NULL;
 
     if (pconn->last_write) {
@@ -651,6 +958,7 @@ void connection_common_close(struct connection *pconn)
     }
 
     free_compression_queue(pconn);
+    observer_group_leave(pconn, FALSE);
     free_packet_hashes(pconn);
   }
 }
@@ -674,6 +982,9 @@ void conn_reset_delta_state(struct connection *pc)
 {
   int i;
 
+  /* Only is-game-info state is shared with the group. */
+  observer_group_leave(pc, FALSE);
+
   for (i = 0; i < PACKET_LAST; i++) {
     if (packet_has_game_info_flag(i)) {
       if (NULL != pc->phs.sent && NULL != pc->phs.sent[i]) {
@@ -726,18 +1037,6 @@ void conn_list_compression_freeze(const struct conn_list *pconn_list)
 #endif /* USE_COMPRESSION */
 }
 
-/**********************************************************************//**
-  Thaw a connection list.
-**************************************************************************/
-void conn_list_compression_thaw(const struct conn_list *pconn_list)
-{
-#ifdef USE_COMPRESSION
-  conn_list_iterate(pconn_list, pconn) {
-    conn_compression_thaw(pconn);
-  } conn_list_iterate_end;
-#endif /* USE_COMPRESSION */
-}
-
 /**********************************************************************//**
   Returns TRUE if the given connection is attached to a player which it
   also controls (i.e. not a player observer).
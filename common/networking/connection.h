@@ -51,9 +51,18 @@ extern "C" {
 #include "conn_types.h"
 
 struct conn_pattern_list;
+struct fc_iovec;
 struct genhash;
+struct netwriter_queue;
+struct observer_group;
 struct packet_handlers;
+struct packet_stream;
+struct packet_tile_info_chunk;
 struct timer_list;
+#ifdef FREECIV_HAVE_LIBZSTD
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+#endif
 
 /****************************************************************************
   Command access levels for client-side use; at present, they are only
@@ -120,6 +129,34 @@ struct socket_packet_buffer {
   unsigned char *data;
 };
 
+/***********************************************************
+  Data to send. A segment may be queued to several connections,
+  e.g. a packet compressed once for all of them, and is freed
+  when the last of them has sent it.
+***********************************************************/
+struct send_segment {
+  int refcount;
+  int size;                     /* Bytes of data. */
+  int capacity;                 /* Bytes allocated. */
+  unsigned char *data;
+};
+
+/***********************************************************
+  This is where the data waits to be sent: a queue of segments,
+  written to the socket without being moved.
+***********************************************************/
+struct socket_send_buffer {
+  int ndata;                    /* Bytes waiting to be sent. */
+  int do_buffer_sends;
+  int nsize;                    /* Bytes allocated for them. */
+
+  struct send_segment **segments;
+  int first;                    /* Index of the first segment. */
+  int nsegments;
+  int allocated;                /* Size of the 'segments' array. */
+  int offset;                   /* Bytes of the first one already sent. */
+};
+
 struct packet_header {
   unsigned int length : 4;      /* Actually 'enum data_type' */
   unsigned int type : 4;        /* Actually 'enum data_type' */
@@ -151,7 +188,7 @@ struct connection {
   struct player *playing;
 
   struct socket_packet_buffer *buffer;
-  struct socket_packet_buffer *send_buffer;
+  struct socket_send_buffer *send_buffer;
   struct timer *last_write;
 #ifdef FREECIV_JSON_CONNECTION
   bool json_mode;
@@ -233,6 +270,12 @@ struct connection {
        * but the closing has been postponed. */
       bool is_closing;
 
+      /* The tiles of a bulk send not sent yet, see send_tile_info(). */
+      struct packet_tile_info_chunk *tile_chunk;
+
+      /* The data handed to the network writer thread, if it runs. */
+      struct netwriter_queue *write_queue;
+
       /* If we use delegation the original player (playing) is replaced. Save
        * it here to easily restore it. */
       struct {
@@ -263,6 +306,8 @@ struct connection {
     struct genhash **sent;
     struct genhash **received;
     const struct packet_handlers *handlers;
+    struct packet_stream *recording;    /* See packet_stream_record_start() */
+    struct observer_group *group;       /* See observer_group_join() */
   } phs;
 
 #ifdef USE_COMPRESSION
@@ -270,6 +315,12 @@ struct connection {
     int frozen_level;
 
     struct byte_vector queue;
+#ifdef FREECIV_HAVE_LIBZSTD
+    /* Streaming zstd, when both ends support it. The contexts keep the
+     * history of the previous batches. */
+    struct ZSTD_CCtx_s *zstd_cctx;
+    struct ZSTD_DCtx_s *zstd_dctx;
+#endif
   } compression;
 #endif
   struct {
@@ -282,10 +333,28 @@ typedef void (*conn_close_fn_t) (struct connection *pconn);
 void connections_set_close_callback(conn_close_fn_t func);
 void connection_close(struct connection *pconn, const char *reason);
 
+typedef void (*conn_writer_fn_t) (struct connection *pconn);
+void connections_set_writer(conn_writer_fn_t func);
+
 int read_socket_data(int sock, struct socket_packet_buffer *buffer);
 void flush_connection_send_buffer_all(struct connection *pc);
 bool connection_send_data(struct connection *pconn,
                           const unsigned char *data, int len);
+bool connection_send_segment(struct connection *pconn,
+                             struct send_segment *segment);
+
+struct send_segment *send_segment_new(int capacity);
+void send_segment_unref(struct send_segment *segment);
+
+struct socket_send_buffer *new_socket_send_buffer(void);
+void free_socket_send_buffer(struct socket_send_buffer *buf);
+void send_buffer_move(struct socket_send_buffer *dest,
+                      struct socket_send_buffer *src);
+void send_buffer_clear(struct socket_send_buffer *buf);
+int send_buffer_iovec(const struct socket_send_buffer *buf,
+                      struct fc_iovec *iov, int max);
+void send_buffer_consume(struct socket_send_buffer *buf, int len,
+                         struct socket_send_buffer *sent);
 
 void connection_do_buffer(struct connection *pc);
 void connection_do_unbuffer(struct connection *pc);
@@ -305,6 +374,8 @@ void conn_set_capability(struct connection *pconn, const char *capability);
 void free_compression_queue(struct connection *pconn);
 void conn_reset_delta_state(struct connection *pconn);
 
+void conn_compression_negotiate(struct connection *pconn,
+                                const char *capability);
 void conn_compression_freeze(struct connection *pconn);
 bool conn_compression_thaw(struct connection *pconn);
 bool conn_compression_frozen(const struct connection *pconn);
@@ -33,11 +33,14 @@
 #include "capability.h"
 #include "fc_cmdline.h"
 #include "fcintl.h"
+#include "genhash.h"
 #include "log.h"
 #include "mem.h"
 #include "support.h"
+#include "timing.h"
 
 /* commmon */
+#include "capstr.h"
 #include "dataio.h"
 #include "game.h"
 #include "events.h"
@@ -47,6 +50,11 @@
 
 #ifdef USE_COMPRESSION
 #include <zlib.h>
+#ifdef FREECIV_HAVE_LIBZSTD
+#include <zstd.h>
+
+#include "packets_zstd_dict.h"
+#endif
 /*
  * Value for the 16bit size to indicate a jumbo packet
  */
@@ -67,8 +75,23 @@
 
 #define MAX_DECOMPRESSION 400
 
+#ifdef FREECIV_HAVE_LIBZSTD
+/* Packets sent alone smaller than this are not worth a compressed packet
+ * of the zstd stream. They are sent as they are. */
+#define STREAM_ALONE_MIN 32
+
+/* Log2 of the history the zstd streams keep. It bounds the memory of
+ * each connection, including what the other end can make us keep. */
+#define STREAM_WINDOW_LOG 19
+#endif /* FREECIV_HAVE_LIBZSTD */
+
 #endif /* USE_COMPRESSION */
 
+/* Keep this a decent amount less than MAX_LEN_BUFFER to avoid the
+ * (remote) possibility of trying to dump MAX_LEN_BUFFER to the network
+ * in one go. Also the size of the chunks of the packet streams. */
+#define MAX_LEN_COMPRESS_QUEUE (MAX_LEN_BUFFER/2)
+
 /*
  * Valid values are 0, 1 and 2. For 2 you have to run generate_packets.py
  * with --gen-stats.
@@ -90,6 +113,14 @@ static int stat_size_alone = 0;
 static int stat_size_uncompressed = 0;
 static int stat_size_compressed = 0;
 static int stat_size_no_compression = 0;
+static int stat_size_shared = 0;         /* Not compressed again. */
+static double stat_cpu_shared = 0.0;     /* Seconds. */
+
+#ifdef FREECIV_HAVE_LIBZSTD
+/* The digested dictionary, shared by the streams of all connections. */
+static ZSTD_CDict *zstd_cdict = NULL;
+static ZSTD_DDict *zstd_ddict = NULL;
+#endif /* FREECIV_HAVE_LIBZSTD */
 
 /**********************************************************************//**
   Returns the compression level. Initilialize it if needed.
@@ -109,83 +140,370 @@ static inline int get_compression_level(void)
   return level;
 }
 
+#ifdef FREECIV_HAVE_LIBZSTD
 /**********************************************************************//**
-  Send all waiting data. Return TRUE on success.
+  Returns the level of the zstd streams. Initialize it if needed.
+  Negative levels are the fastest ones.
 **************************************************************************/
-static bool conn_compression_flush(struct connection *pconn)
+static inline int get_zstd_compression_level(void)
+{
+  static int level = INT_MIN;   /* Not initialized. */
+
+  if (INT_MIN == level) {
+    const char *s = getenv("FREECIV_ZSTD_COMPRESSION_LEVEL");
+
+    if (NULL == s || !str_to_int(s, &level)
+        || ZSTD_minCLevel() > level || ZSTD_maxCLevel() < level) {
+      level = ZSTD_CLEVEL_DEFAULT;
+    }
+  }
+
+  return level;
+}
+#endif /* FREECIV_HAVE_LIBZSTD */
+
+/* A queue compressed by conn_list_compression_thaw(). The connections of
+ * the list having the same queue, e.g. observers with the same delta
+ * state, get the same compressed data without compressing it again. */
+struct compressed_queue {
+  unsigned char *queue;         /* Copy of the uncompressed queue. */
+  size_t queue_size;
+  uLong queue_crc;
+  struct send_segment *compressed;
+  double cpu;                   /* Time it took to compress it. */
+};
+
+/**********************************************************************//**
+  Compress 'size' bytes of data with zlib. 'compressed_size' is the size
+  of the 'compressed' buffer, and is set to the size of the compressed
+  data. Return TRUE on success.
+**************************************************************************/
+static bool conn_compression_compress(const unsigned char *data,
+                                      size_t size, Bytef *compressed,
+                                      uLongf *compressed_size)
 {
   int compression_level = get_compression_level();
-  uLongf compressed_size = 12 + 1.001 * pconn->compression.queue.size;
-  Bytef compressed[compressed_size];
-  bool jumbo;
-  unsigned long compressed_packet_len;
 
 #ifndef FREECIV_NDEBUG
   int error =
 #endif
-  compress2(compressed, &compressed_size,
-            pconn->compression.queue.p,
-            pconn->compression.queue.size,
-            compression_level);
+  compress2(compressed, compressed_size, data, size, compression_level);
 
   fc_assert_ret_val(error == Z_OK, FALSE);
 
-  /* Compression signalling currently assumes a 2-byte packet length; if that
-   * changes, the protocol should probably be changed */
-  fc_assert_ret_val(data_type_size(pconn->packet_header.length) == 2, FALSE);
+  log_compress("COMPRESS: compressed %lu bytes to %ld (level %d)",
+               (unsigned long) size, *compressed_size, compression_level);
 
-  /* Include normal length field in decision */
-  jumbo = (compressed_size+2 >= JUMBO_BORDER);
+  return TRUE;
+}
+
+/**********************************************************************//**
+  Compress 'size' bytes of data with zlib to a new segment, which can be
+  sent to several connections. Returns NULL on failure.
+**************************************************************************/
+static struct send_segment *
+conn_compression_compress_segment(const unsigned char *data, size_t size)
+{
+  uLongf compressed_size = 12 + 1.001 * size;
+  struct send_segment *segment = send_segment_new(compressed_size);
 
-  compressed_packet_len = compressed_size + (jumbo ? 6 : 2);
-  if (compressed_packet_len < pconn->compression.queue.size) {
-    struct raw_data_out dout;
+  if (!conn_compression_compress(data, size, segment->data,
+                                 &compressed_size)) {
+    send_segment_unref(segment);
+    return NULL;
+  }
+  segment->size = compressed_size;
 
-    log_compress("COMPRESS: compressed %lu bytes to %ld (level %d)",
-                 (unsigned long) pconn->compression.queue.size,
-                 compressed_size, compression_level);
-    stat_size_uncompressed += pconn->compression.queue.size;
-    stat_size_compressed += compressed_size;
+  return segment;
+}
 
-    if (!jumbo) {
-      unsigned char header[2];
+/**********************************************************************//**
+  Send compressed data to the connection as one compressed packet. 'size'
+  is the size of the data before compression. When 'segment' is not
+  NULL, it holds the compressed data, and is sent without being copied.
+**************************************************************************/
+static void conn_compression_send_packet(struct connection *pconn,
+                                         size_t size,
+                                         const Bytef *compressed,
+                                         unsigned long compressed_size,
+                                         struct send_segment *segment)
+{
+  struct raw_data_out dout;
 
-      FC_STATIC_ASSERT(COMPRESSION_BORDER > MAX_LEN_PACKET,
-                       uncompressed_compressed_packet_len_overlap);
+  stat_size_uncompressed += size;
+  stat_size_compressed += compressed_size;
 
-      log_compress("COMPRESS: sending %ld as normal", compressed_size);
+  /* Include normal length field in decision */
+  if (compressed_size + 2 < JUMBO_BORDER) {
+    unsigned char header[2];
 
-      dio_output_init(&dout, header, sizeof(header));
-      dio_put_uint16_raw(&dout, 2 + compressed_size + COMPRESSION_BORDER);
-      connection_send_data(pconn, header, sizeof(header));
-      connection_send_data(pconn, compressed, compressed_size);
-    } else {
-      unsigned char header[6];
+    FC_STATIC_ASSERT(COMPRESSION_BORDER > MAX_LEN_PACKET,
+                     uncompressed_compressed_packet_len_overlap);
 
-      FC_STATIC_ASSERT(JUMBO_SIZE >= JUMBO_BORDER+COMPRESSION_BORDER,
-                       compressed_normal_jumbo_packet_len_overlap);
+    log_compress("COMPRESS: sending %ld as normal", compressed_size);
 
-      log_compress("COMPRESS: sending %ld as jumbo", compressed_size);
-      dio_output_init(&dout, header, sizeof(header));
-      dio_put_uint16_raw(&dout, JUMBO_SIZE);
-      dio_put_uint32_raw(&dout, 6 + compressed_size);
-      connection_send_data(pconn, header, sizeof(header));
+    dio_output_init(&dout, header, sizeof(header));
+    dio_put_uint16_raw(&dout, 2 + compressed_size + COMPRESSION_BORDER);
+    connection_send_data(pconn, header, sizeof(header));
+    if (NULL != segment) {
+      connection_send_segment(pconn, segment);
+    } else {
+      connection_send_data(pconn, compressed, compressed_size);
+    }
+  } else {
+    unsigned char header[6];
+
+    FC_STATIC_ASSERT(JUMBO_SIZE >= JUMBO_BORDER+COMPRESSION_BORDER,
+                     compressed_normal_jumbo_packet_len_overlap);
+
+    log_compress("COMPRESS: sending %ld as jumbo", compressed_size);
+    dio_output_init(&dout, header, sizeof(header));
+    dio_put_uint16_raw(&dout, JUMBO_SIZE);
+    dio_put_uint32_raw(&dout, 6 + compressed_size);
+    connection_send_data(pconn, header, sizeof(header));
+    if (NULL != segment) {
+      connection_send_segment(pconn, segment);
+    } else {
       connection_send_data(pconn, compressed, compressed_size);
     }
+  }
+}
+
+/**********************************************************************//**
+  Send the compressed data, or the data itself if compressing it didn't
+  make it smaller. See conn_compression_send_packet() for 'segment'.
+  Return TRUE on success.
+**************************************************************************/
+static bool conn_compression_send(struct connection *pconn,
+                                  const unsigned char *data, size_t size,
+                                  const Bytef *compressed,
+                                  uLongf compressed_size,
+                                  struct send_segment *segment)
+{
+  unsigned long compressed_packet_len;
+
+  /* Compression signalling currently assumes a 2-byte packet length; if that
+   * changes, the protocol should probably be changed */
+  fc_assert_ret_val(data_type_size(pconn->packet_header.length) == 2, FALSE);
+
+  compressed_packet_len = compressed_size
+    + (compressed_size + 2 >= JUMBO_BORDER ? 6 : 2);
+  if (compressed_packet_len < size) {
+    conn_compression_send_packet(pconn, size, compressed, compressed_size,
+                                 segment);
   } else {
     log_compress("COMPRESS: would enlarge %lu bytes to %ld; "
                  "sending uncompressed",
-                 (unsigned long) pconn->compression.queue.size,
-                 compressed_packet_len);
-    connection_send_data(pconn, pconn->compression.queue.p,
-                         pconn->compression.queue.size);
-    stat_size_no_compression += pconn->compression.queue.size;
+                 (unsigned long) size, compressed_packet_len);
+    connection_send_data(pconn, data, size);
+    stat_size_no_compression += size;
   }
 
   return pconn->used;
 }
+
+/**********************************************************************//**
+  Send all waiting data, compressed with zlib. Return TRUE on success.
+**************************************************************************/
+static bool conn_compression_flush_zlib(struct connection *pconn)
+{
+  uLongf compressed_size = 12 + 1.001 * pconn->compression.queue.size;
+  Bytef compressed[compressed_size];
+
+  if (!conn_compression_compress(pconn->compression.queue.p,
+                                 pconn->compression.queue.size,
+                                 compressed, &compressed_size)) {
+    return FALSE;
+  }
+
+  return conn_compression_send(pconn, pconn->compression.queue.p,
+                               pconn->compression.queue.size,
+                               compressed, compressed_size, NULL);
+}
+
+#ifdef FREECIV_HAVE_LIBZSTD
+/**********************************************************************//**
+  Send 'size' bytes of data, compressed in the zstd stream of the
+  connection. Data fed to the stream is always sent compressed, as the
+  other end must see all the stream to decompress what follows. Return
+  TRUE on success.
+**************************************************************************/
+static bool conn_compression_send_zstd(struct connection *pconn,
+                                       const unsigned char *data,
+                                       size_t size)
+{
+  size_t compressed_size = ZSTD_compressBound(size) + 64;
+  Bytef compressed[compressed_size];
+  ZSTD_inBuffer in = { data, size, 0 };
+  ZSTD_outBuffer out = { compressed, compressed_size, 0 };
+  size_t remaining;
+
+  /* Compression signalling currently assumes a 2-byte packet length; if that
+   * changes, the protocol should probably be changed */
+  fc_assert_ret_val(data_type_size(pconn->packet_header.length) == 2, FALSE);
+
+  if (0 == in.size) {
+    return pconn->used;
+  }
+
+  remaining = ZSTD_compressStream2(pconn->compression.zstd_cctx,
+                                   &out, &in, ZSTD_e_flush);
+  if (ZSTD_isError(remaining) || 0 != remaining) {
+    log_error("zstd compression failed for %s: %s",
+              conn_description(pconn),
+              ZSTD_isError(remaining) ? ZSTD_getErrorName(remaining)
+                                      : "output too small");
+    return FALSE;
+  }
+
+  log_compress("COMPRESS: zstd compressed %lu bytes to %lu",
+               (unsigned long) in.size, (unsigned long) out.pos);
+  conn_compression_send_packet(pconn, in.size, compressed, out.pos, NULL);
+
+  return pconn->used;
+}
+
+/**********************************************************************//**
+  Send all waiting data, compressed in the zstd stream of the connection.
+  Return TRUE on success.
+**************************************************************************/
+static bool conn_compression_flush_zstd(struct connection *pconn)
+{
+  return conn_compression_send_zstd(pconn, pconn->compression.queue.p,
+                                    pconn->compression.queue.size);
+}
+#endif /* FREECIV_HAVE_LIBZSTD */
+
+/**********************************************************************//**
+  Send all waiting data. Return TRUE on success.
+**************************************************************************/
+static bool conn_compression_flush(struct connection *pconn)
+{
+#ifdef FREECIV_HAVE_LIBZSTD
+  if (NULL != pconn->compression.zstd_cctx) {
+    return conn_compression_flush_zstd(pconn);
+  }
+#endif /* FREECIV_HAVE_LIBZSTD */
+
+  return conn_compression_flush_zlib(pconn);
+}
+
+/**********************************************************************//**
+  Send all waiting data, compressing it only if none of the queues of
+  'shared' is the same. Return TRUE on success.
+**************************************************************************/
+static bool conn_compression_flush_shared(struct connection *pconn,
+                                          struct compressed_queue **shared,
+                                          int *shared_num)
+{
+  size_t size = pconn->compression.queue.size;
+  uLong crc = crc32(0L, pconn->compression.queue.p, size);
+  struct compressed_queue *pqueue;
+  struct timer *cpu_timer;
+  int i;
+
+  for (i = 0; i < *shared_num; i++) {
+    pqueue = *shared + i;
+    if (pqueue->queue_size == size
+        && pqueue->queue_crc == crc
+        && 0 == memcmp(pqueue->queue, pconn->compression.queue.p, size)) {
+      log_compress("COMPRESS: reusing %lu bytes compressed for %s",
+                   (unsigned long) size, conn_description(pconn));
+      stat_size_shared += size;
+      stat_cpu_shared += pqueue->cpu;
+
+      return conn_compression_send(pconn, pconn->compression.queue.p, size,
+                                   pqueue->compressed->data,
+                                   pqueue->compressed->size,
+                                   pqueue->compressed);
+    }
+  }
+
+  *shared = fc_realloc(*shared, (*shared_num + 1) * sizeof(**shared));
+  pqueue = *shared + (*shared_num)++;
+  pqueue->queue = fc_malloc(size);
+  memcpy(pqueue->queue, pconn->compression.queue.p, size);
+  pqueue->queue_size = size;
+  pqueue->queue_crc = crc;
+
+  cpu_timer = timer_new(TIMER_CPU, TIMER_ACTIVE, NULL);
+  timer_start(cpu_timer);
+  pqueue->compressed
+    = conn_compression_compress_segment(pconn->compression.queue.p, size);
+  if (NULL == pqueue->compressed) {
+    free(pqueue->queue);
+    (*shared_num)--;
+    timer_destroy(cpu_timer);
+
+    return FALSE;
+  }
+  timer_stop(cpu_timer);
+  pqueue->cpu = timer_read_seconds(cpu_timer);
+  timer_destroy(cpu_timer);
+
+  return conn_compression_send(pconn, pconn->compression.queue.p, size,
+                               pqueue->compressed->data,
+                               pqueue->compressed->size, pqueue->compressed);
+}
 #endif /* USE_COMPRESSION */
 
+/**********************************************************************//**
+  Set up the compression of the connection once the server accepted it:
+  on the server after it sent the join reply, and on the client when it
+  got it. 'capability' is the one of the other end. When both ends
+  support it, the connection uses zstd streams starting with the shared
+  dictionary, instead of compressing every batch alone with zlib.
+**************************************************************************/
+void conn_compression_negotiate(struct connection *pconn,
+                                const char *capability)
+{
+#if defined(USE_COMPRESSION) && defined(FREECIV_HAVE_LIBZSTD)
+  int level = get_zstd_compression_level();
+
+  if (NULL != pconn->compression.zstd_cctx
+      || !has_capability(PACKET_ZSTD_CAPABILITY, our_capability)
+      || !has_capability(PACKET_ZSTD_CAPABILITY, capability)) {
+    return;
+  }
+
+  if (0 < byte_vector_size(&pconn->compression.queue)) {
+    /* The client starts its stream only once it read the join reply,
+     * which may be waiting there. */
+    conn_compression_flush(pconn);
+    byte_vector_reserve(&pconn->compression.queue, 0);
+  }
+
+  if (NULL == zstd_cdict) {
+    fc_assert(PACKET_ZSTD_DICT_ID
+              == ZSTD_getDictID_fromDict(packet_zstd_dict,
+                                         packet_zstd_dict_size));
+    zstd_cdict = ZSTD_createCDict(packet_zstd_dict, packet_zstd_dict_size,
+                                  level);
+    zstd_ddict = ZSTD_createDDict(packet_zstd_dict, packet_zstd_dict_size);
+  }
+
+  pconn->compression.zstd_cctx = ZSTD_createCCtx();
+  pconn->compression.zstd_dctx = ZSTD_createDCtx();
+  if (NULL == zstd_cdict || NULL == zstd_ddict
+      || NULL == pconn->compression.zstd_cctx
+      || NULL == pconn->compression.zstd_dctx) {
+    /* The other end already expects zstd streams. */
+    log_fatal("Could not create zstd contexts.");
+    exit(EXIT_FAILURE);
+  }
+  ZSTD_CCtx_setParameter(pconn->compression.zstd_cctx,
+                         ZSTD_c_compressionLevel, level);
+  ZSTD_CCtx_refCDict(pconn->compression.zstd_cctx, zstd_cdict);
+  ZSTD_CCtx_setParameter(pconn->compression.zstd_cctx,
+                         ZSTD_c_windowLog, STREAM_WINDOW_LOG);
+  ZSTD_DCtx_refDDict(pconn->compression.zstd_dctx, zstd_ddict);
+  ZSTD_DCtx_setParameter(pconn->compression.zstd_dctx,
+                         ZSTD_d_windowLogMax, STREAM_WINDOW_LOG);
+  log_compress("COMPRESS: using zstd streams for %s",
+               conn_description(pconn));
+#endif /* USE_COMPRESSION && FREECIV_HAVE_LIBZSTD */
+}
+
 /**********************************************************************//**
   Thaw the connection. Then maybe compress the data waiting to send them
   to the connection. Returns TRUE on success. See also
@@ -208,10 +526,671 @@ bool conn_compression_thaw(struct connection *pconn)
 }
 
 /**********************************************************************//**
+  Thaw the connections of the list. The data waiting to be sent to them
+  is compressed once for all the connections having the same data.
+**************************************************************************/
+void conn_list_compression_thaw(const struct conn_list *pconn_list)
+{
+#ifdef USE_COMPRESSION
+  struct compressed_queue *shared = NULL;
+  int shared_num = 0;
+  int flushed = 0;
+  int i;
+
+  if (conn_list_size(pconn_list) < 2) {
+    conn_list_iterate(pconn_list, pconn) {
+      conn_compression_thaw(pconn);
+    } conn_list_iterate_end;
+    return;
+  }
+
+  conn_list_iterate(pconn_list, pconn) {
+    pconn->compression.frozen_level--;
+    fc_assert_action_msg(pconn->compression.frozen_level >= 0,
+                         pconn->compression.frozen_level = 0,
+                         "Too many calls to conn_compression_thaw on %s!",
+                         conn_description(pconn));
+    if (0 == pconn->compression.frozen_level) {
+#ifdef FREECIV_HAVE_LIBZSTD
+      if (NULL != pconn->compression.zstd_cctx) {
+        /* Each stream has its own history. */
+        conn_compression_flush_zstd(pconn);
+        continue;
+      }
+#endif /* FREECIV_HAVE_LIBZSTD */
+      conn_compression_flush_shared(pconn, &shared, &shared_num);
+      flushed++;
+    }
+  } conn_list_iterate_end;
+
+  if (flushed > shared_num) {
+    log_verbose("Compressed %d queues once for %d connections; "
+                "%d bytes and %.3f seconds saved so far.",
+                shared_num, flushed, stat_size_shared, stat_cpu_shared);
+  }
+
+  for (i = 0; i < shared_num; i++) {
+    free(shared[i].queue);
+    send_segment_unref(shared[i].compressed);
+  }
+  free(shared);
+#endif /* USE_COMPRESSION */
+}
+
+#ifdef USE_COMPRESSION
+/**********************************************************************//**
+  Append data to the compression queue of the connection. If the queue
+  would overfill, what is in there already is sent first. Return TRUE on
+  success.
+**************************************************************************/
+static bool conn_compression_queue(struct connection *pconn,
+                                   const unsigned char *data, int len)
+{
+  size_t old_size;
+
+  /* If this packet would cause us to overfill the queue, flush
+   * everything that's in there already before queuing this one */
+  if (MAX_LEN_COMPRESS_QUEUE
+      < byte_vector_size(&pconn->compression.queue) + len) {
+    log_compress2("COMPRESS: huge queue, forcing to flush (%lu/%lu)",
+                  (long unsigned)
+                  byte_vector_size(&pconn->compression.queue),
+                  (long unsigned) MAX_LEN_COMPRESS_QUEUE);
+    if (!conn_compression_flush(pconn)) {
+      return FALSE;
+    }
+    byte_vector_reserve(&pconn->compression.queue, 0);
+  }
+
+  old_size = byte_vector_size(&pconn->compression.queue);
+  byte_vector_reserve(&pconn->compression.queue, old_size + len);
+  memcpy(pconn->compression.queue.p + old_size, data, len);
+
+  return TRUE;
+}
+#endif /* USE_COMPRESSION */
+
+/* A chunk of a packet stream. The chunks are cut between two packets,
+ * and fit in a compression queue. */
+struct packet_stream_chunk {
+  struct byte_vector data;
+#ifdef USE_COMPRESSION
+  struct send_segment *compressed;      /* With zlib, once needed. */
+#endif
+};
+
+/* The packets sent to a connection while it was recorded, and the delta
+ * state they left. See packet_stream_record_start(). */
+struct packet_stream {
+  const struct packet_handlers *handlers;
+  struct packet_stream_chunk *chunks;
+  int chunks_num;
+  size_t size;
+
+  bool types[PACKET_LAST];      /* The types of the recorded packets. */
+  bool had_state[PACKET_LAST];  /* Delta state before the recording. */
+  struct genhash *sent[PACKET_LAST];
+};
+
+/**********************************************************************//**
+  Append a packet to the stream being recorded.
+**************************************************************************/
+static void packet_stream_append(struct packet_stream *pstream,
+                                 const unsigned char *data, int len,
+                                 enum packet_type type)
+{
+  struct packet_stream_chunk *chunk = NULL;
+  size_t old_size;
+
+  if (0 < pstream->chunks_num) {
+    chunk = pstream->chunks + pstream->chunks_num - 1;
+    if (MAX_LEN_COMPRESS_QUEUE < byte_vector_size(&chunk->data) + len) {
+      chunk = NULL;
+    }
+  }
+
+  if (NULL == chunk) {
+    pstream->chunks = fc_realloc(pstream->chunks,
+                                 (pstream->chunks_num + 1)
+                                 * sizeof(*pstream->chunks));
+    chunk = pstream->chunks + pstream->chunks_num++;
+    byte_vector_init(&chunk->data);
+#ifdef USE_COMPRESSION
+    chunk->compressed = NULL;
+#endif
+  }
+
+  old_size = byte_vector_size(&chunk->data);
+  byte_vector_reserve(&chunk->data, old_size + len);
+  memcpy(chunk->data.p + old_size, data, len);
+
+  pstream->size += len;
+  pstream->types[type] = TRUE;
+}
+
+/**********************************************************************//**
+  Free a packet stream.
+**************************************************************************/
+void packet_stream_destroy(struct packet_stream *pstream)
+{
+  int i;
+
+  for (i = 0; i < pstream->chunks_num; i++) {
+    byte_vector_free(&pstream->chunks[i].data);
+#ifdef USE_COMPRESSION
+    if (NULL != pstream->chunks[i].compressed) {
+      send_segment_unref(pstream->chunks[i].compressed);
+    }
+#endif
+  }
+  free(pstream->chunks);
+
+  for (i = 0; i < PACKET_LAST; i++) {
+    if (NULL != pstream->sent[i]) {
+      genhash_destroy(pstream->sent[i]);
+    }
+  }
+
+  free(pstream);
+}
+
+/**********************************************************************//**
+  Return the number of bytes used by a delta cache of packets sent.
+**************************************************************************/
+static size_t packet_hash_memory(const struct genhash *phash,
+                                 enum packet_type type)
+{
+  size_t size = genhash_memory_size(phash);
+
+  genhash_keys_iterate(phash, packet) {
+    size += packet_cache_size(type, packet);
+  } genhash_keys_iterate_end;
+
+  return size;
+}
+
+/**********************************************************************//**
+  Return the number of bytes used by the delta caches of the connection
+  for packets of the given type, both sent and received. If 'entries' is
+  not NULL, the number of cached packets is stored there.
+**************************************************************************/
+size_t packet_cache_memory(const struct connection *pconn,
+                           enum packet_type type, size_t *entries)
+{
+  size_t size = 0;
+  size_t count = 0;
+
+  if (NULL != pconn->phs.sent && NULL != pconn->phs.sent[type]) {
+    size += packet_hash_memory(pconn->phs.sent[type], type);
+    count += genhash_size(pconn->phs.sent[type]);
+  }
+
+  if (NULL != pconn->phs.received && NULL != pconn->phs.received[type]) {
+    /* Received packets are always cached whole. */
+    size += genhash_memory_size(pconn->phs.received[type])
+            + (genhash_size(pconn->phs.received[type])
+               * packet_struct_size(type));
+    count += genhash_size(pconn->phs.received[type]);
+  }
+
+  if (NULL != entries) {
+    *entries = count;
+  }
+
+  return size;
+}
+
+/**********************************************************************//**
+  Return a deep copy of a delta cache of packets of the given type.
+**************************************************************************/
+static struct genhash *packet_hash_copy(const struct genhash *phash,
+                                        enum packet_type type)
+{
+  struct genhash *copy = genhash_new_like(phash);
+
+  genhash_keys_iterate(phash, packet) {
+    size_t size = packet_cache_size(type, packet);
+    void *packet_copy = fc_malloc(size);
+
+    /* The key is the packet itself. */
+    memcpy(packet_copy, packet, size);
+    genhash_insert(copy, packet_copy, packet_copy);
+  } genhash_keys_iterate_end;
+
+  return copy;
+}
+
+/**********************************************************************//**
+  Start to record the packets sent to the connection. The same packets
+  can then be sent again to other connections using the same capability,
+  without building them again. See packet_stream_record_stop().
+**************************************************************************/
+void packet_stream_record_start(struct connection *pconn)
+{
+  struct packet_stream *pstream = fc_calloc(1, sizeof(*pstream));
+  int i;
+
+  fc_assert_ret(NULL == pconn->phs.recording);
+
+  pstream->handlers = pconn->phs.handlers;
+  for (i = 0; i < PACKET_LAST; i++) {
+    pstream->had_state[i] = (NULL != pconn->phs.sent[i]
+                             && 0 < genhash_size(pconn->phs.sent[i]));
+  }
+
+  pconn->phs.recording = pstream;
+}
+
+/**********************************************************************//**
+  Stop to record the packets sent to the connection, and return them.
+  Returns NULL if they can't be sent again: when some were sent as a
+  delta to the state of the connection before the recording started.
+**************************************************************************/
+struct packet_stream *packet_stream_record_stop(struct connection *pconn)
+{
+  struct packet_stream *pstream = pconn->phs.recording;
+  int i;
+
+  fc_assert_ret_val(NULL != pstream, NULL);
+  pconn->phs.recording = NULL;
+
+  for (i = 0; i < PACKET_LAST; i++) {
+    if (pstream->types[i] && pstream->had_state[i]) {
+      log_debug("Can't record %s: %s was already sent to it.",
+                conn_description(pconn), packet_name(i));
+      packet_stream_destroy(pstream);
+
+      return NULL;
+    }
+  }
+
+  for (i = 0; i < PACKET_LAST; i++) {
+    if (pstream->types[i] && NULL != pconn->phs.sent[i]) {
+      pstream->sent[i] = packet_hash_copy(pconn->phs.sent[i], i);
+    }
+  }
+
+  return pstream;
+}
+
+/**********************************************************************//**
+  Return the number of bytes of the packets of the stream.
+**************************************************************************/
+size_t packet_stream_size(const struct packet_stream *pstream)
+{
+  return pstream->size;
+}
+
+/**********************************************************************//**
+  Send a chunk of a stream to the connection, as send_packet_data()
+  would have sent its packets. The zlib compressed chunk is kept for the
+  next connections.
+**************************************************************************/
+static void packet_stream_send_chunk(struct packet_stream_chunk *chunk,
+                                     struct connection *pconn)
+{
+#ifdef USE_COMPRESSION
+  if (conn_compression_frozen(pconn)) {
+#ifdef FREECIV_HAVE_LIBZSTD
+    if (NULL != pconn->compression.zstd_cctx) {
+      /* Part of the stream of the connection. */
+      conn_compression_queue(pconn, chunk->data.p, chunk->data.size);
+      return;
+    }
+#endif /* FREECIV_HAVE_LIBZSTD */
+
+    if (0 < byte_vector_size(&pconn->compression.queue)) {
+      /* Keep the order of the packets. */
+      if (!conn_compression_flush(pconn)) {
+        return;
+      }
+      byte_vector_reserve(&pconn->compression.queue, 0);
+    }
+
+    if (NULL == chunk->compressed) {
+      chunk->compressed
+        = conn_compression_compress_segment(chunk->data.p,
+                                            chunk->data.size);
+      if (NULL == chunk->compressed) {
+        return;
+      }
+    } else {
+      stat_size_shared += chunk->data.size;
+    }
+
+    conn_compression_send(pconn, chunk->data.p, chunk->data.size,
+                          chunk->compressed->data, chunk->compressed->size,
+                          chunk->compressed);
+    return;
+  }
+#endif /* USE_COMPRESSION */
+
+  connection_send_data(pconn, chunk->data.p, chunk->data.size);
+}
+
+/**********************************************************************//**
+  Send the packets of the stream to the connection, and set its delta
+  state as if they had been built for it. Returns FALSE, without sending
+  anything, when the connection doesn't use the same capability as the
+  recorded one, or when some of the packets were already sent to it.
+**************************************************************************/
+bool packet_stream_replay(struct packet_stream *pstream,
+                          struct connection *pconn)
+{
+  int i;
+
+  if (pconn->phs.handlers != pstream->handlers
+      || NULL != pconn->phs.recording) {
+    return FALSE;
+  }
+
+  for (i = 0; i < PACKET_LAST; i++) {
+    if (pstream->types[i] && NULL != pconn->phs.sent[i]
+        && 0 < genhash_size(pconn->phs.sent[i])) {
+      return FALSE;
+    }
+  }
+
+  for (i = 0; i < pstream->chunks_num && pconn->used; i++) {
+    packet_stream_send_chunk(pstream->chunks + i, pconn);
+  }
+
+  for (i = 0; i < PACKET_LAST; i++) {
+    if (NULL != pstream->sent[i]) {
+      if (NULL != pconn->phs.sent[i]) {
+        genhash_destroy(pconn->phs.sent[i]);
+      }
+      pconn->phs.sent[i] = packet_hash_copy(pstream->sent[i], i);
+    }
+  }
+
+  return TRUE;
+}
+
+/* Connections with the same view of the game, i.e. global observers
+ * using the same capability, share the delta state of the is-game-info
+ * packets. Such a packet is then built once and sent to all of them. */
+struct observer_group {
+  const struct packet_handlers *handlers;
+  struct packet_header packet_header;
+#ifdef FREECIV_JSON_CONNECTION
+  bool json_mode;
+#endif
+  struct conn_list *members;
+  int serial;                   /* See observer_group_send_needed(). */
+  struct genhash *sent[PACKET_LAST];
+};
+
+#define SPECLIST_TAG observer_group
+#define SPECLIST_TYPE struct observer_group
+#include "speclist.h"
+
+#define observer_group_list_iterate(plist, pgroup) \
+  TYPED_LIST_ITERATE(struct observer_group, plist, pgroup)
+#define observer_group_list_iterate_end LIST_ITERATE_END
+
+static struct observer_group_list *observer_groups = NULL;
+static int observer_group_serial = 0;
+
+/**********************************************************************//**
+  Return the observer group the connection could join, or NULL.
+**************************************************************************/
+static struct observer_group *observer_group_find(struct connection *pconn)
+{
+  if (NULL == observer_groups) {
+    return NULL;
+  }
+
+  observer_group_list_iterate(observer_groups, pgroup) {
+    if (pgroup->handlers == pconn->phs.handlers
+        && pgroup->packet_header.length == pconn->packet_header.length
+        && pgroup->packet_header.type == pconn->packet_header.type
+#ifdef FREECIV_JSON_CONNECTION
+        && pgroup->json_mode == pconn->json_mode
+#endif
+        ) {
+      return pgroup;
+    }
+  } observer_group_list_iterate_end;
+
+  return NULL;
+}
+
+/**********************************************************************//**
+  Returns TRUE if the same is-game-info packets were sent to the
+  connection and to the group, maybe with other values.
+**************************************************************************/
+static bool observer_group_same_keys(const struct observer_group *pgroup,
+                                     const struct connection *pconn)
+{
+  enum packet_type i;
+
+  for (i = 0; i < PACKET_LAST; i++) {
+    const struct genhash *mine = pconn->phs.sent[i];
+    const struct genhash *theirs = pgroup->sent[i];
+
+    if (!packet_has_game_info_flag(i)) {
+      continue;
+    }
+
+    if ((NULL != mine ? genhash_size(mine) : 0)
+        != (NULL != theirs ? genhash_size(theirs) : 0)) {
+      return FALSE;
+    }
+
+    if (NULL != mine) {
+      genhash_keys_iterate(mine, packet) {
+        if (!genhash_lookup(theirs, packet, NULL)) {
+          return FALSE;
+        }
+      } genhash_keys_iterate_end;
+    }
+  }
+
+  return TRUE;
+}
+
+/**********************************************************************//**
+  Make the connection share the delta state of the is-game-info packets
+  with the other global observers using the same capability. The
+  connection must be a global observer that was sent all the game info
+  already.
+
+  The values of the packets last sent to the group are sent again to the
+  connection, so it only gets what differs from the info it was just
+  sent. Returns FALSE, leaving the connection alone, if the connection
+  doesn't know the same objects as the group, e.g. because one of them
+  was removed while its packet can't be cancelled.
+**************************************************************************/
+bool observer_group_join(struct connection *pconn)
+{
+  struct observer_group *pgroup;
+  enum packet_type i;
+
+  fc_assert_ret_val(is_server(), FALSE);
+  fc_assert_ret_val(NULL == pconn->phs.group, TRUE);
+
+#ifndef FREECIV_DELTA_PROTOCOL
+  /* Without delta state, packets already sent can't be told apart from
+   * new ones, so each member would get them again from each other one. */
+  return FALSE;
+#endif
+
+  pgroup = observer_group_find(pconn);
+  if (NULL == pgroup) {
+    /* The first one: the group starts with its state. */
+    pgroup = fc_calloc(1, sizeof(*pgroup));
+    pgroup->handlers = pconn->phs.handlers;
+    pgroup->packet_header = pconn->packet_header;
+#ifdef FREECIV_JSON_CONNECTION
+    pgroup->json_mode = pconn->json_mode;
+#endif
+    pgroup->members = conn_list_new();
+
+    for (i = 0; i < PACKET_LAST; i++) {
+      if (packet_has_game_info_flag(i)) {
+        pgroup->sent[i] = pconn->phs.sent[i];
+        pconn->phs.sent[i] = NULL;
+      }
+    }
+
+    if (NULL == observer_groups) {
+      observer_groups = observer_group_list_new();
+    }
+    observer_group_list_append(observer_groups, pgroup);
+  } else {
+    if (!observer_group_same_keys(pgroup, pconn)) {
+      log_verbose("%s can't join the group of %d observers.",
+                  conn_description(pconn),
+                  conn_list_size(pgroup->members));
+
+      return FALSE;
+    }
+
+    conn_compression_freeze(pconn);
+    for (i = 0; i < PACKET_LAST; i++) {
+      if (NULL != pgroup->sent[i] && pconn->used) {
+        genhash_keys_iterate(pgroup->sent[i], packet) {
+          send_packet_by_type(pconn, i, packet);
+        } genhash_keys_iterate_end;
+      }
+    }
+    conn_compression_thaw(pconn);
+
+    for (i = 0; i < PACKET_LAST; i++) {
+      if (packet_has_game_info_flag(i) && NULL != pconn->phs.sent[i]) {
+        genhash_destroy(pconn->phs.sent[i]);
+        pconn->phs.sent[i] = NULL;
+      }
+    }
+  }
+
+  conn_list_append(pgroup->members, pconn);
+  pconn->phs.group = pgroup;
+  log_verbose("%s joined a group of %d observers.",
+              conn_description(pconn), conn_list_size(pgroup->members));
+
+  return TRUE;
+}
+
+/**********************************************************************//**
+  Remove the connection from its observer group, if any. If 'keep_state'
+  is TRUE, the connection gets a copy of the delta state of the group,
+  else its is-game-info delta state is left empty.
+**************************************************************************/
+void observer_group_leave(struct connection *pconn, bool keep_state)
+{
+  struct observer_group *pgroup = pconn->phs.group;
+  bool last;
+  enum packet_type i;
+
+  if (NULL == pgroup) {
+    return;
+  }
+
+  conn_list_remove(pgroup->members, pconn);
+  pconn->phs.group = NULL;
+  last = (0 == conn_list_size(pgroup->members));
+
+  for (i = 0; i < PACKET_LAST; i++) {
+    if (NULL == pgroup->sent[i]) {
+      continue;
+    }
+    fc_assert(NULL == pconn->phs.sent[i]);
+    if (keep_state) {
+      pconn->phs.sent[i] = (last ? pgroup->sent[i]
+                            : packet_hash_copy(pgroup->sent[i], i));
+    }
+    if (last && !keep_state) {
+      genhash_destroy(pgroup->sent[i]);
+    }
+  }
+
+  if (last) {
+    observer_group_list_remove(observer_groups, pgroup);
+    conn_list_destroy(pgroup->members);
+    free(pgroup);
+  }
+}
+
+/**********************************************************************//**
+  Return the connections of the observer group.
+**************************************************************************/
+const struct conn_list *
+observer_group_members(const struct observer_group *pgroup)
+{
+  return pgroup->members;
+}
+
+/**********************************************************************//**
+  Return the number of bytes used by the delta cache of the observer
+  group for packets of the given type. If 'entries' is not NULL, the
+  number of cached packets is stored there.
+**************************************************************************/
+size_t observer_group_cache_memory(const struct observer_group *pgroup,
+                                   enum packet_type type, size_t *entries)
+{
+  if (NULL != entries) {
+    *entries = (NULL != pgroup->sent[type]
+                ? genhash_size(pgroup->sent[type]) : 0);
+  }
+
+  return (NULL != pgroup->sent[type]
+          ? packet_hash_memory(pgroup->sent[type], type) : 0);
+}
+
+/**********************************************************************//**
+  Return a new serial number for sending a packet to a list of
+  connections. See observer_group_send_needed().
+**************************************************************************/
+int observer_group_send_serial(void)
+{
+  return ++observer_group_serial;
+}
+
+/**********************************************************************//**
+  Returns TRUE if an is-game-info packet sent to a list of connections
+  must be built for this one. It's FALSE for the connections of an
+  observer group but the first one in the list, since they all get what
+  is built for the first one. 'serial' identifies the sending, see
+  observer_group_send_serial().
+**************************************************************************/
+bool observer_group_send_needed(struct connection *pconn, int serial)
+{
+  struct observer_group *pgroup = pconn->phs.group;
+
+  if (NULL == pgroup) {
+    return TRUE;
+  }
+  if (pgroup->serial == serial) {
+    return FALSE;
+  }
+  pgroup->serial = serial;
+
+  return TRUE;
+}
+
+/**********************************************************************//**
+  Return where the delta state of the packets of the given type sent to
+  the connection is kept. It's the state of the observer group of the
+  connection for is-game-info packets.
+**************************************************************************/
+struct genhash **packet_sent_hash(struct connection *pconn,
+                                  enum packet_type type)
+{
+  if (NULL != pconn->phs.group && packet_has_game_info_flag(type)) {
+    return pconn->phs.group->sent + type;
+  }
+
+  return pconn->phs.sent + type;
+}
+
+/**********************************************************************//**
+  Send the packet data to one connection.
   It returns the request id of the outgoing packet (or 0 if is_server()).
 **************************************************************************/
-int send_packet_data(struct connection *pc, unsigned char *data, int len,
-                     enum packet_type packet_type)
+static int send_packet_data_conn(struct connection *pc, unsigned char *data,
+                                 int len, enum packet_type packet_type)
 {
   /* default for the server */
   int result = 0;
@@ -231,39 +1210,31 @@ int send_packet_data(struct connection *pc, unsigned char *data, int len,
     pc->outgoing_packet_notify(pc, packet_type, len, result);
   }
 
+  if (NULL != pc->phs.recording) {
+    packet_stream_append(pc->phs.recording, data, len, packet_type);
+  }
+
 #ifdef USE_COMPRESSION
   if (TRUE) {
     int size = len;
 
     if (conn_compression_frozen(pc)) {
-      size_t old_size;
-
-      /* Keep this a decent amount less than MAX_LEN_BUFFER to avoid the
-       * (remote) possibility of trying to dump MAX_LEN_BUFFER to the
-       * network in one go */
-#define MAX_LEN_COMPRESS_QUEUE (MAX_LEN_BUFFER/2)
-      FC_STATIC_ASSERT(MAX_LEN_COMPRESS_QUEUE < MAX_LEN_BUFFER,
-                       compress_queue_maxlen_too_big);
-
-      /* If this packet would cause us to overfill the queue, flush
-       * everything that's in there already before queuing this one */
-      if (MAX_LEN_COMPRESS_QUEUE
-          < byte_vector_size(&pc->compression.queue) + len) {
-        log_compress2("COMPRESS: huge queue, forcing to flush (%lu/%lu)",
-                      (long unsigned)
-                      byte_vector_size(&pc->compression.queue),
-                      (long unsigned) MAX_LEN_COMPRESS_QUEUE);
-        if (!conn_compression_flush(pc)) {
-          return -1;
-        }
-        byte_vector_reserve(&pc->compression.queue, 0);
+      if (!conn_compression_queue(pc, data, len)) {
+        return -1;
       }
-
-      old_size = byte_vector_size(&pc->compression.queue);
-      byte_vector_reserve(&pc->compression.queue, old_size + len);
-      memcpy(pc->compression.queue.p + old_size, data, len);
       log_compress2("COMPRESS: putting %s into the queue",
                     packet_name(packet_type));
+#ifdef FREECIV_HAVE_LIBZSTD
+    } else if (NULL != pc->compression.zstd_cctx
+               && STREAM_ALONE_MIN <= len) {
+      /* With the history of the stream, even a packet alone compresses
+       * well. */
+      if (!conn_compression_send_zstd(pc, data, len)) {
+        return -1;
+      }
+      log_compress2("COMPRESS: sending %s alone in the stream",
+                    packet_name(packet_type));
+#endif /* FREECIV_HAVE_LIBZSTD */
     } else {
       stat_size_alone += size;
       log_compress("COMPRESS: sending %s alone (%d bytes total)",
@@ -272,9 +1243,10 @@ int send_packet_data(struct connection *pc, unsigned char *data, int len,
     }
 
     log_compress2("COMPRESS: STATS: alone=%d compression-expand=%d "
-                  "compression (before/after) = %d/%d",
+                  "compression (before/after) = %d/%d shared=%d",
                   stat_size_alone, stat_size_no_compression,
-                  stat_size_uncompressed, stat_size_compressed);
+                  stat_size_uncompressed, stat_size_compressed,
+                  stat_size_shared);
   }
 #else  /* USE_COMPRESSION */
   connection_send_data(pc, data, len);
@@ -365,6 +1337,97 @@ int send_packet_data(struct connection *pc, unsigned char *data, int len,
   return result;
 }
 
+/**********************************************************************//**
+  It returns the request id of the outgoing packet (or 0 if is_server()).
+  An is-game-info packet sent to a connection of an observer group is
+  sent to all the connections of the group.
+**************************************************************************/
+int send_packet_data(struct connection *pc, unsigned char *data, int len,
+                     enum packet_type packet_type)
+{
+  if (NULL != pc->phs.group && packet_has_game_info_flag(packet_type)) {
+    conn_list_iterate(pc->phs.group->members, pconn) {
+      send_packet_data_conn(pconn, data, len, packet_type);
+    } conn_list_iterate_end;
+
+    return 0;
+  }
+
+  return send_packet_data_conn(pc, data, len, packet_type);
+}
+
+#ifdef USE_COMPRESSION
+/**********************************************************************//**
+  Uncompress the zlib data of a compressed packet. Returns the newly
+  allocated data, or NULL on error.
+**************************************************************************/
+static void *decompress_zlib(const void *compressed, uLong compressed_size,
+                             unsigned long int *decompressed_size)
+{
+  int decompress_factor = 80;
+  int error;
+  void *decompressed;
+
+  *decompressed_size = decompress_factor * compressed_size;
+  decompressed = fc_malloc(*decompressed_size);
+
+  while (Z_OK != (error = uncompress(decompressed, decompressed_size,
+                                     compressed, compressed_size))) {
+    decompress_factor += 50;
+    if (error != Z_BUF_ERROR || decompress_factor > MAX_DECOMPRESSION) {
+      free(decompressed);
+      return NULL;
+    }
+
+    *decompressed_size = decompress_factor * compressed_size;
+    decompressed = fc_realloc(decompressed, *decompressed_size);
+  }
+
+  return decompressed;
+}
+
+#ifdef FREECIV_HAVE_LIBZSTD
+/**********************************************************************//**
+  Uncompress the next part of the zstd stream of the connection. Returns
+  the newly allocated data, or NULL on error.
+**************************************************************************/
+static void *decompress_zstd(struct connection *pc, const void *compressed,
+                             uLong compressed_size,
+                             unsigned long int *decompressed_size)
+{
+  ZSTD_inBuffer in = { compressed, compressed_size, 0 };
+  ZSTD_outBuffer out = { NULL, 0, 0 };
+
+  do {
+    size_t ret;
+
+    if (out.pos == out.size) {
+      /* A dictionary and the history make ratios far beyond what zlib
+       * reaches legitimate, so bound the size by what a sender ever
+       * queues instead. */
+      if (out.size >= MAX_LEN_BUFFER) {
+        free(out.dst);
+        return NULL;
+      }
+      out.size = MIN(MAX(2 * out.size, 8 * compressed_size), MAX_LEN_BUFFER);
+      out.dst = fc_realloc(out.dst, out.size);
+    }
+
+    ret = ZSTD_decompressStream(pc->compression.zstd_dctx, &out, &in);
+    if (ZSTD_isError(ret)) {
+      log_verbose("zstd: %s", ZSTD_getErrorName(ret));
+      free(out.dst);
+      return NULL;
+    }
+  } while (in.pos < in.size || out.pos == out.size);
+
+  *decompressed_size = out.pos;
+
+  return out.dst;
+}
+#endif /* FREECIV_HAVE_LIBZSTD */
+#endif /* USE_COMPRESSION */
+
 /**********************************************************************//**
   Read and return a packet from the connection 'pc'. The type of the
   packet is written in 'ptype'. On error, the connection is closed and
@@ -441,34 +1504,29 @@ void *get_packet_from_connection_raw(struct connection *pc,
 
   if (compressed_packet) {
     uLong compressed_size = whole_packet_len - header_size;
-    int decompress_factor = 80;
-    unsigned long int decompressed_size = decompress_factor * compressed_size;
-    int error = Z_BUF_ERROR;
+    unsigned long int decompressed_size;
     struct socket_packet_buffer *buffer = pc->buffer;
-    void *decompressed = fc_malloc(decompressed_size);
-
-    do {
-      error =
-        uncompress(decompressed, &decompressed_size,
-                   ADD_TO_POINTER(buffer->data, header_size),
-                   compressed_size);
-
-      if (error == Z_BUF_ERROR) {
-        decompress_factor += 50;
-        decompressed_size = decompress_factor * compressed_size;
-        decompressed = fc_realloc(decompressed, decompressed_size);
-      }
-
-      if (error != Z_OK) {
-        if (error != Z_BUF_ERROR || decompress_factor > MAX_DECOMPRESSION ) {
-          log_verbose("Uncompressing of the packet stream failed. "
-                      "The connection will be closed now.");
-          connection_close(pc, _("decoding error"));
-          return NULL;
-        }
-      }
+    void *decompressed;
+
+#ifdef FREECIV_HAVE_LIBZSTD
+    if (NULL != pc->compression.zstd_dctx) {
+      decompressed =
+        decompress_zstd(pc, ADD_TO_POINTER(buffer->data, header_size),
+                        compressed_size, &decompressed_size);
+    } else
+#endif /* FREECIV_HAVE_LIBZSTD */
+    {
+      decompressed =
+        decompress_zlib(ADD_TO_POINTER(buffer->data, header_size),
+                        compressed_size, &decompressed_size);
+    }
 
-    } while (error != Z_OK);
+    if (NULL == decompressed) {
+      log_verbose("Uncompressing of the packet stream failed. "
+                  "The connection will be closed now.");
+      connection_close(pc, _("decoding error"));
+      return NULL;
+    }
 
     buffer->ndata -= whole_packet_len;
     /* 
@@ -647,7 +1705,8 @@ void post_send_packet_server_join_reply(struct connection *pconn,
 }
 
 /**********************************************************************//**
-  Modify if needed the packet header field lengths.
+  Modify if needed the packet header field lengths, and start the
+  compression streams.
 **************************************************************************/
 void post_receive_packet_server_join_reply(struct connection *pconn,
                                            const struct
@@ -655,9 +1714,61 @@ void post_receive_packet_server_join_reply(struct connection *pconn,
 {
   if (packet->you_can_join) {
     packet_header_set(&pconn->packet_header);
+    conn_compression_negotiate(pconn, packet->capability);
   }
 }
 
+/**********************************************************************//**
+  Forget the PACKET_TILE_INFO delta state of the tiles of the chunk. The
+  chunk doesn't update it, so the next PACKET_TILE_INFO of these tiles
+  is sent in full.
+**************************************************************************/
+static void tile_info_chunk_forget(struct genhash *hash,
+                                   const struct packet_tile_info_chunk
+                                   *packet)
+{
+#ifdef FREECIV_DELTA_PROTOCOL
+  struct packet_tile_info key;
+  int pos = 0;
+  int i, j;
+
+  if (NULL == hash) {
+    return;
+  }
+
+  for (i = 0; i < packet->known_runs && pos < packet->count; i++) {
+    for (j = 0; j < packet->known_len[i] && pos < packet->count; j++) {
+      if (TILE_CHUNK_SKIPPED != packet->known[i]) {
+        key.tile = packet->first + pos;
+        genhash_remove(hash, &key);
+      }
+      pos++;
+    }
+  }
+#endif /* FREECIV_DELTA_PROTOCOL */
+}
+
+/**********************************************************************//**
+  Keep the PACKET_TILE_INFO delta state in sync with the client.
+**************************************************************************/
+void post_send_packet_tile_info_chunk(struct connection *pconn,
+                                      const struct packet_tile_info_chunk
+                                      *packet)
+{
+  tile_info_chunk_forget(*packet_sent_hash(pconn, PACKET_TILE_INFO),
+                         packet);
+}
+
+/**********************************************************************//**
+  Keep the PACKET_TILE_INFO delta state in sync with the server.
+**************************************************************************/
+void post_receive_packet_tile_info_chunk(struct connection *pconn,
+                                         const struct packet_tile_info_chunk
+                                         *packet)
+{
+  tile_info_chunk_forget(pconn->phs.received[PACKET_TILE_INFO], packet);
+}
+
 
 /**********************************************************************//**
   Sanity check packet
@@ -900,4 +2011,17 @@ const struct packet_handlers *packet_handlers_get(const char *capability)
 void packets_deinit(void)
 {
   packet_handlers_free();
+
+#if defined(USE_COMPRESSION) && defined(FREECIV_HAVE_LIBZSTD)
+  ZSTD_freeCDict(zstd_cdict);
+  zstd_cdict = NULL;
+  ZSTD_freeDDict(zstd_ddict);
+  zstd_ddict = NULL;
+#endif /* USE_COMPRESSION && FREECIV_HAVE_LIBZSTD */
+
+  if (NULL != observer_groups) {
+    fc_assert(0 == observer_group_list_size(observer_groups));
+    observer_group_list_destroy(observer_groups);
+    observer_groups = NULL;
+  }
 }
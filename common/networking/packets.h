@@ -69,6 +69,17 @@ enum unit_info_use {
   UNIT_INFO_CITY_PRESENT
 };
 
+/* Most runs of one field of a PACKET_TILE_INFO_CHUNK.
+ *
+ * Used in network protocol. */
+#define MAX_TILE_CHUNK_RUNS 256
+
+/* The known value of the tiles which are not part of a
+ * PACKET_TILE_INFO_CHUNK.
+ *
+ * Used in network protocol. */
+#define TILE_CHUNK_SKIPPED (TILE_KNOWN_SEEN + 1)
+
 #include "packets_gen.h"
 
 struct packet_handlers {
@@ -103,6 +114,10 @@ void packet_handlers_fill_capability(struct packet_handlers *phandlers,
                                      const char *capability);
 const char *packet_name(enum packet_type type);
 bool packet_has_game_info_flag(enum packet_type type);
+size_t packet_struct_size(enum packet_type type);
+size_t packet_cache_size(enum packet_type type, const void *packet);
+size_t packet_cache_memory(const struct connection *pconn,
+                           enum packet_type type, size_t *entries);
 
 void packet_header_init(struct packet_header *packet_header);
 void post_send_packet_server_join_reply(struct connection *pconn,
@@ -111,11 +126,41 @@ void post_send_packet_server_join_reply(struct connection *pconn,
 void post_receive_packet_server_join_reply(struct connection *pconn,
                                            const struct
                                            packet_server_join_reply *packet);
+void post_send_packet_tile_info_chunk(struct connection *pconn,
+                                      const struct packet_tile_info_chunk
+                                      *packet);
+void post_receive_packet_tile_info_chunk(struct connection *pconn,
+                                         const struct packet_tile_info_chunk
+                                         *packet);
 
 void pre_send_packet_player_attribute_chunk(struct connection *pc,
 					    struct packet_player_attribute_chunk
 					    *packet);
 
+struct packet_stream;
+
+void packet_stream_record_start(struct connection *pconn);
+struct packet_stream *packet_stream_record_stop(struct connection *pconn);
+bool packet_stream_replay(struct packet_stream *pstream,
+                          struct connection *pconn);
+size_t packet_stream_size(const struct packet_stream *pstream);
+void packet_stream_destroy(struct packet_stream *pstream);
+
+struct observer_group;
+
+bool observer_group_join(struct connection *pconn);
+void observer_group_leave(struct connection *pconn, bool keep_state);
+const struct conn_list *
+observer_group_members(const struct observer_group *pgroup);
+size_t observer_group_cache_memory(const struct observer_group *pgroup,
+                                   enum packet_type type, size_t *entries);
+int observer_group_send_serial(void);
+bool observer_group_send_needed(struct connection *pconn, int serial);
+struct genhash **packet_sent_hash(struct connection *pconn,
+                                  enum packet_type type);
+int send_packet_by_type(struct connection *pc, enum packet_type type,
+                        const void *packet);
+
 const struct packet_handlers *packet_handlers_initial(void);
 const struct packet_handlers *packet_handlers_get(const char *capability);
 
@@ -0,0 +1,9426 @@
+/***********************************************************************
+ Freeciv - Copyright (C) 1996 - A Kjeldberg, L Gregersen, P Unold
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2, or (at your option)
+   any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+***********************************************************************/
+
+/**********************************************************************
+  The zstd dictionary the packet streams start with. Most of what a
+  client gets when it joins is the rulesets, the nations and the help
+  of the server settings, which are the same in every game. With this
+  dictionary, that part compresses well from the first packets on.
+
+  It was trained with
+    zstd --train --maxdict=112640 --dictID=1
+  on the uncompressed contents of the packets a client got when it
+  joined new games of each of the supplied rulesets and observed their
+  first turns. A dictionary that doesn't match the packets anymore
+  still works, it only compresses less.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <fc_config.h>
+#endif
+
+#include "packets_zstd_dict.h"
+
+#ifdef FREECIV_HAVE_LIBZSTD
+const unsigned char packet_zstd_dict[] = {
+  0x37, 0xa4, 0x30, 0xec, 0x01, 0x00, 0x00, 0x00, 0x52, 0x10, 0x78, 0x56,
+  0x9c, 0x74, 0xcc, 0xc0, 0x53, 0x42, 0x33, 0xf0, 0x0c, 0x3c, 0x4f, 0xfd,
+  0x64, 0x13, 0xe1, 0x45, 0x11, 0x2c, 0x93, 0x70, 0xd3, 0xe8, 0x6e, 0xe4,
+  0x4c, 0x20, 0x0c, 0x6d, 0x23, 0x7b, 0xab, 0xed, 0xde, 0xb4, 0xa6, 0x97,
+  0x6c, 0xdb, 0x44, 0x4a, 0x00, 0x63, 0xa8, 0x14, 0xfe, 0x63, 0x8c, 0x43,
+  0x1f, 0xe0, 0x3f, 0xa2, 0x34, 0x06, 0xda, 0xb6, 0xad, 0x02, 0x12, 0x6a,
+  0xa5, 0x9d, 0x14, 0xad, 0x5d, 0xd1, 0xef, 0xe1, 0x63, 0xe0, 0xdf, 0x16,
+  0x01, 0xfc, 0xb6, 0x66, 0x09, 0x21, 0x29, 0x63, 0x03, 0x00, 0x18, 0x12,
+  0x08, 0x44, 0x42, 0xb1, 0x88, 0x34, 0x1c, 0xd2, 0xa6, 0x75, 0x0f, 0x04,
+  0x60, 0x01, 0x15, 0x1c, 0x95, 0x25, 0x17, 0xd9, 0x47, 0xb2, 0x20, 0x86,
+  0x81, 0x3c, 0x0f, 0x19, 0x63, 0x00, 0x21, 0x88, 0x18, 0x00, 0x00, 0x30,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x4f, 0x8f, 0x44,
+  0x3d, 0xcc, 0x82, 0x4c, 0x21, 0x63, 0x8c, 0xc0, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x67, 0x72, 0x65,
+  0x77, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x6e, 0x73, 0x65,
+  0x20, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x77,
+  0x65, 0x61, 0x6c, 0x74, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x32, 0x30, 0x30, 0x20, 0x79, 0x65,
+  0x61, 0x72, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x77, 0x65, 0x72,
+  0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x6e, 0x6f, 0x76, 0x61,
+  0x74, 0x6f, 0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x6e, 0x79,
+  0x20, 0x6d, 0x6f, 0x64, 0x65, 0x72, 0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x63,
+  0x65, 0x70, 0x74, 0x73, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x73,
+  0x20, 0x42, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x2e, 0x00, 0x17, 0x48,
+  0x75, 0x67, 0x68, 0x20, 0x64, 0x65, 0x20, 0x50, 0x61, 0x79, 0x65, 0x6e,
+  0x73, 0x00, 0x52, 0x6f, 0x62, 0x65, 0x72, 0x74, 0x20, 0x64, 0x65, 0x20,
+  0x43, 0x72, 0x61, 0x6f, 0x6e, 0x00, 0x45, 0x76, 0x65, 0x72, 0x61, 0x72,
+  0x64, 0x20, 0x64, 0x65, 0x73, 0x20, 0x42, 0x61, 0x72, 0x72, 0x65, 0x73,
+  0x00, 0x42, 0x65, 0x72, 0x6e, 0x68, 0x61, 0x72, 0x64, 0x20, 0x64, 0x65,
+  0x20, 0x54, 0x72, 0x65, 0x6d, 0x65, 0x6c, 0x61, 0x69, 0x00, 0x41, 0x6e,
+  0x64, 0x72, 0x65, 0x20, 0x64, 0x65, 0x20, 0x4d, 0x6f, 0x6e, 0x74, 0x65,
+  0x62, 0x61, 0x72, 0x64, 0x00, 0x42, 0x65, 0x72, 0x74, 0x72, 0x61, 0x6e,
+  0x64, 0x20, 0x64, 0x65, 0x20, 0x42, 0x6c, 0x61, 0x6e, 0x71, 0x75, 0x65,
+  0x66, 0x6f, 0x72, 0x74, 0x00, 0x50, 0x68, 0x69, 0x6c, 0x69, 0x70, 0x20,
+  0x64, 0x65, 0x20, 0x4d, 0x69, 0x6c, 0x6c, 0x79, 0x00, 0x4f, 0x64, 0x6f,
+  0x20, 0x64, 0x65, 0x20, 0x53, 0x74, 0x2e, 0x20, 0x41, 0x6d, 0x61, 0x6e,
+  0x64, 0x00, 0x41, 0x72, 0x6e, 0x6f, 0x6c, 0x64, 0x20, 0x64, 0x65, 0x20,
+  0x54, 0x6f, 0x72, 0x6f, 0x67, 0x61, 0x00, 0x47, 0x65, 0x72, 0x61, 0x72,
+  0x64, 0x20, 0x64, 0x65, 0x20, 0x52, 0x69, 0x64, 0x66, 0x6f, 0x72, 0x74,
+  0x00, 0x52, 0x6f, 0x62, 0x65, 0x72, 0x74, 0x20, 0x64, 0x65, 0x20, 0x53,
+  0x61, 0x62, 0x6c, 0x65, 0x00, 0x47, 0x69, 0x6c, 0x62, 0x65, 0x72, 0x74,
+  0x20, 0x45, 0x72, 0x61, 0x69, 0x6c, 0x00, 0x50, 0x68, 0x69, 0x6c, 0x69,
+  0x70, 0x20, 0x64, 0x65, 0x20, 0x50, 0x6c, 0x65, 0x73, 0x73, 0x69, 0x65,
+  0x7a, 0x00, 0x57, 0x69, 0x6c, 0x6c, 0x69, 0x61, 0x6d, 0x20, 0x64, 0x65,
+  0x20, 0x43, 0x68, 0x61, 0x72, 0x74, 0x72, 0x65, 0x73, 0x00, 0x50, 0x65,
+  0x64, 0x72, 0x6f, 0x20, 0x64, 0x65, 0x20, 0x4d, 0x6f, 0x6e, 0x74, 0x61,
+  0x69, 0x67, 0x75, 0x00, 0x41, 0x72, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x64,
+  0x65, 0x20, 0x50, 0x65, 0x72, 0x69, 0x67, 0x6f, 0x72, 0x64, 0x00, 0x52,
+  0x69, 0x63, 0x68, 0x61, 0x72, 0x64, 0x20, 0x64, 0x65, 0x20, 0x42, 0x75,
+  0x72, 0x65, 0x73, 0x00, 0x57, 0x69, 0x6c, 0x6c, 0x69, 0x61, 0x6d, 0x20,
+  0x64, 0x65, 0x20, 0x53, 0x6f, 0x6e, 0x6e, 0x61, 0x63, 0x00, 0x52, 0x65,
+  0x79, 0x6e, 0x61, 0x6c, 0x64, 0x20, 0x64, 0x65, 0x20, 0x56, 0x69, 0x63,
+  0x68, 0x69, 0x65, 0x72, 0x73, 0x00, 0x54, 0x68, 0x6f, 0x6d, 0x61, 0x73,
+  0x20, 0x42, 0x65, 0x72, 0x61, 0x72, 0x64, 0x00, 0x57, 0x69, 0x6c, 0x6c,
+  0x69, 0x61, 0x6d, 0x20, 0x64, 0x65, 0x20, 0x42, 0x65, 0x61, 0x75, 0x6a,
+  0x65, 0x75, 0x00, 0x54, 0x69, 0x62, 0x61, 0x6c, 0x64, 0x20, 0x64, 0x65,
+  0x20, 0x47, 0x61, 0x75, 0x64, 0x69, 0x6e, 0x00, 0x4a, 0x61, 0x63, 0x71,
+  0x75, 0x65, 0x73, 0x20, 0x64, 0x65, 0x20, 0x4d, 0x6f, 0x6c, 0x61, 0x79,
+  0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x09, 0x06, 0x02, 0x85, 0x00, 0x94, 0x7f, 0xef, 0x03,
+  0x01, 0xea, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x54, 0x65, 0x75, 0x74, 0x6f, 0x6e,
+  0x69, 0x63, 0x00, 0x54, 0x65, 0x75, 0x74, 0x6f, 0x6e, 0x69, 0x63, 0x00,
+  0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x54, 0x65, 0x75, 0x74,
+  0x6f, 0x6e, 0x69, 0x63, 0x20, 0x4f, 0x72, 0x64, 0x65, 0x72, 0x00, 0x74,
+  0x65, 0x75, 0x74, 0x6f, 0x6e, 0x69, 0x63, 0x5f, 0x6f, 0x72, 0x64, 0x65,
+  0x72, 0x00, 0x68, 0x72, 0x65, 0x00, 0x54, 0x68, 0x65, 0x20, 0x54, 0x65,
+  0x75, 0x74, 0x6f, 0x6e, 0x69, 0x63, 0x20, 0x4f, 0x72, 0x64, 0x65, 0x72,
+  0x20, 0x6c, 0x65, 0x64, 0x20, 0x61, 0x20, 0x73, 0x65, 0x72, 0x69, 0x65,
+  0x73, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x72, 0x75, 0x73, 0x61, 0x64, 0x65,
+  0x73, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x74, 0x20, 0x70, 0x61,
+  0x67, 0x61, 0x6e, 0x20, 0x42, 0x61, 0x6c, 0x74, 0x73, 0x20, 0x64, 0x75,
+  0x72, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x48, 0x69, 0x67,
+  0x68, 0x20, 0x4d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x20, 0x41, 0x67, 0x65,
+  0x73, 0x2e, 0x20, 0x49, 0x6e, 0x20, 0x31, 0x32, 0x32, 0x34, 0x20, 0x69,
+  0x6d, 0x6c, 0x79, 0x20, 0x31, 0x2d, 0x27, 0x72, 0x65, 0x76, 0x6f, 0x6c,
+  0x65, 0x6e, 0x27, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x00, 0x46, 0x69,
+  0x72, 0x73, 0x74, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x27, 0x72, 0x65,
+  0x76, 0x6f, 0x6c, 0x65, 0x6e, 0x27, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e,
+  0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x71, 0x75, 0x69, 0x63,
+  0x6b, 0x65, 0x72, 0x00, 0x52, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x2c, 0x20,
+  0x6d, 0x61, 0x78, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x71,
+  0x75, 0x69, 0x63, 0x6b, 0x65, 0x72, 0x00, 0x00, 0x07, 0x00, 0xa6, 0x04,
+  0x00, 0x8a, 0x00, 0x07, 0x00, 0xa7, 0x04, 0x00, 0x84, 0x00, 0x07, 0x00,
+  0xa8, 0x04, 0x00, 0x8b, 0x00, 0x07, 0x00, 0xa6, 0x37, 0x00, 0x66, 0x00,
+  0x07, 0x00, 0xa7, 0x04, 0x00, 0x82, 0x00, 0x17, 0x00, 0xa7, 0xf7, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x27, 0x10, 0x00, 0x07, 0x00, 0xa8, 0x04, 0x00, 0x8e,
+  0x00, 0x07, 0x00, 0xa6, 0x04, 0x00, 0x8c, 0x00, 0x08, 0x00, 0xa9, 0x04,
+  0x00, 0x00, 0x8d, 0x00, 0x07, 0x00, 0xa6, 0x37, 0x00, 0x0b, 0x00, 0x17,
+  0x00, 0xa7, 0xf7, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x27, 0x10, 0x00, 0x13, 0x00,
+  0xa7, 0xb7, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x17, 0x00, 0xa7, 0xf7, 0x00, 0x0e, 0xff,
+  0xff, 0xfc, 0x18, 0xff, 0xff, 0xfc, 0x18, 0xff, 0xff, 0xfc, 0x18, 0x00,
+  0x00, 0x03, 0xe8, 0x00, 0x17, 0x00, 0xa7, 0xf7, 0x00, 0x61, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00,
+  0x03, 0xe8, 0x00, 0x13, 0x00, 0xa7, 0xb7, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x07, 0x00,
+  0xa6, 0x07, 0x00, 0x28, 0x00, 0xbb, 0x00, 0xa9, 0xc7, 0x01, 0x00, 0x08,
+  0x05, 0x44, 0x45, 0x46, 0x41, 0x55, 0x4c, 0x54, 0x00, 0x53, 0x49, 0x4e,
+  0x47, 0x4c, 0x45, 0x00, 0x32, 0x6f, 0x72, 0x33, 0x00, 0x41, 0x4c, 0x4c,
+  0x00, 0x56, 0x41, 0x52, 0x49, 0x41, 0x42, 0x4c, 0x45, 0x00, 0x47, 0x65,
+  0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x27, 0x73, 0x20, 0x63, 0x68,
+  0x6f, 0x69, 0x63, 0x65, 0x00, 0x4f, 0x6e, 0x65, 0x20, 0x70, 0x6c, 0x61,
+  0x79, 0x65, 0x72, 0x20, 0x70, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x74,
+  0x69, 0x6e, 0x65, 0x6e, 0x74, 0x00, 0x54, 0x77, 0x6f, 0x20, 0x6f, 0x72,
+  0x20, 0x74, 0x68, 0x72, 0x65, 0x65, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65,
+  0x72, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69,
+  0x6e, 0x65, 0x6e, 0x74, 0x00, 0x41, 0x6c, 0x6c, 0x20, 0x70, 0x6c, 0x61,
+  0x79, 0x65, 0x72, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x61, 0x20, 0x73, 0x69,
+  0x6e, 0x67, 0x6c, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x65,
+  0x6e, 0x74, 0x00, 0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67,
+  0x20, 0x6f, 0x6e, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f, 0x66, 0x20,
+  0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x65, 0x6e, 0x74, 0x73, 0x00, 0x00,
+  0x13, 0x00, 0xa8, 0x3f, 0x00, 0x27, 0x01, 0x63, 0x77, 0x73, 0x78, 0x00,
+  0x63, 0x63, 0x77, 0x77, 0x78, 0x00, 0x00, 0x13, 0x00, 0xa7, 0xb7, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x64, 0x00, 0x07, 0x00, 0xa6, 0x37, 0x00, 0x33, 0x00, 0x96, 0x00, 0xa9,
+  0xf7, 0x01, 0x00, 0x09, 0x01, 0x01, 0x05, 0x44, 0x49, 0x53, 0x41, 0x42,
+  0x4c, 0x45, 0x44, 0x00, 0x43, 0x4c, 0x4f, 0x53, 0x45, 0x53, 0x54, 0x00,
+  0x43, 0x4f, 0x4e, 0x54, 0x49, 0x4e, 0x45, 0x4e, 0x54, 0x00, 0x48, 0x4f,
+  0x52, 0x49, 0x5a, 0x4f, 0x4e, 0x54, 0x41, 0x4c, 0x00, 0x56, 0x45, 0x52,
+  0x54, 0x49, 0x43, 0x41, 0x4c, 0x00, 0x44, 0x69, 0x73, 0x61, 0x62, 0x6c,
+  0x65, 0x64, 0x00, 0x41, 0x73, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x20,
+  0x61, 0x73, 0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x00,
+  0x4f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20,
+  0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x65, 0x6e, 0x74, 0x00, 0x48, 0x6f,
+  0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x70, 0x6c, 0x61,
+  0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x56, 0x65, 0x72, 0x74, 0x69,
+  0x63, 0x61, 0x6c, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x00, 0x00, 0x13, 0x00, 0xa7, 0xb7, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x10, 0x00,
+  0xa7, 0x9f, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x64, 0x00, 0x14, 0x00, 0xa7, 0xef, 0x00, 0x3a, 0x01, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x18, 0x00,
+  0xa7, 0xff, 0x00, 0x3b, 0x01, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x32, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x64, 0x00, 0x0b, 0x00,
+  0xa7, 0x87, 0x00, 0x31, 0x00, 0x00, 0x00, 0x64, 0x00, 0x0b, 0x00, 0xa7,
+  0x87, 0x00, 0x30, 0x00, 0x00, 0x00, 0x64, 0x00, 0x13, 0x00, 0xa7, 0xb7,
+  0x00, 0x2f, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x14, 0x00, 0xa7, 0xbf, 0x00, 0x0f, 0x01, 0x00, 0x00,
+  0x00, 0x3c, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x64, 0x00, 0x07,
+  0x00, 0xa6, 0x04, 0x00, 0x86, 0x00, 0x07, 0x00, 0xa6, 0x04, 0x00, 0x7a,
+  0x00, 0x18, 0x00, 0xa7, 0xff, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0x0b, 0x00, 0xa7, 0x87, 0x00, 0x75, 0x00, 0x83, 0xd5, 0xff, 0x00,
+  0x14, 0x00, 0xa7, 0xdf, 0x00, 0x73, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0x83, 0xd5, 0xff, 0x00, 0x08, 0x00, 0xa6, 0x1f,
+  0x00, 0x0a, 0x01, 0x00, 0x13, 0x00, 0xa7, 0xb7, 0x00, 0x80, 0x00, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x28, 0x00, 0x2a,
+  0x00, 0xaa, 0xff, 0x01, 0x00, 0x05, 0x01, 0x00, 0x03, 0x00, 0x03, 0x02,
+  0x49, 0x53, 0x4f, 0x00, 0x48, 0x45, 0x58, 0x00, 0x49, 0x73, 0x6f, 0x6d,
+  0x65, 0x74, 0x72, 0x69, 0x63, 0x00, 0x48, 0x65, 0x78, 0x61, 0x67, 0x6f,
+  0x6e, 0x61, 0x6c, 0x00, 0x00, 0x43, 0x00, 0xa9, 0xc7, 0x01, 0x00, 0x47,
+  0x02, 0x43, 0x4c, 0x41, 0x53, 0x53, 0x49, 0x43, 0x00, 0x53, 0x49, 0x4d,
+  0x50, 0x4c, 0x45, 0x00, 0x43, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x63, 0x20,
+  0x46, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x00, 0x50, 0x72, 0x6f, 0x70,
+  0x6f, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x20,
+  0x74, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x00, 0x00,
+  0x17, 0x00, 0xa7, 0xf7, 0x00, 0x48, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xe7, 0x00, 0x14,
+  0x00, 0xa7, 0xbf, 0x00, 0x41, 0x01, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+  0x00, 0x32, 0x00, 0x00, 0x00, 0x64, 0x00, 0x07, 0x00, 0xa6, 0x37, 0x00,
+  0x45, 0x00, 0x07, 0x00, 0xa6, 0x37, 0x00, 0x44, 0x00, 0x07, 0x00, 0xa6,
+  0x37, 0x00, 0x43, 0x00, 0x1f, 0x00, 0xa9, 0xc7, 0x01, 0x00, 0x4b, 0x02,
+  0x46, 0x49, 0x58, 0x45, 0x44, 0x00, 0x45, 0x56, 0x45, 0x4e, 0x00, 0x46,
+  0x69, 0x78, 0x65, 0x64, 0x00, 0x45, 0x76, 0x65, 0x6e, 0x00, 0x00, 0x07,
+  0x00, 0xa6, 0x37, 0x00, 0x7e, 0x00, 0x0b, 0x00, 0xa7, 0x87, 0x00, 0x76,
+  0x00, 0x83, 0xd5, 0xff, 0x00, 0x08, 0x00, 0xa6, 0x2f, 0x00, 0x64, 0x01,
+  0x00, 0x4f, 0x00, 0xaa, 0xf7, 0x01, 0x00, 0x5f, 0x00, 0x03, 0x00, 0x03,
+  0x03, 0x53, 0x50, 0x41, 0x43, 0x45, 0x52, 0x41, 0x43, 0x45, 0x00, 0x41,
+  0x4c, 0x4c, 0x49, 0x45, 0x44, 0x00, 0x43, 0x55, 0x4c, 0x54, 0x55, 0x52,
+  0x45, 0x00, 0x53, 0x70, 0x61, 0x63, 0x65, 0x72, 0x61, 0x63, 0x65, 0x00,
+  0x41, 0x6c, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x76, 0x69, 0x63, 0x74, 0x6f,
+  0x72, 0x79, 0x00, 0x43, 0x75, 0x6c, 0x74, 0x75, 0x72, 0x65, 0x20, 0x76,
+  0x69, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x00, 0x00, 0x13, 0x00, 0xa7, 0xb7,
+  0x00, 0x12, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x3a, 0x00, 0xaa, 0xff, 0x01, 0x00, 0x06, 0x01, 0x00,
+  0x03, 0x00, 0x01, 0x02, 0x57, 0x52, 0x41, 0x50, 0x58, 0x00, 0x57, 0x52,
+  0x41, 0x50, 0x59, 0x00, 0x57, 0x72, 0x61, 0x70, 0x20, 0x45, 0x61, 0x73,
+  0x74, 0x2d, 0x57, 0x65, 0x73, 0x74, 0x00, 0x57, 0x72, 0x61, 0x70, 0x20,
+  0x4e, 0x6f, 0x72, 0x74, 0x68, 0x2d, 0x53, 0x6f, 0x75, 0x74, 0x68, 0x00,
+  0x00, 0x17, 0x00, 0xa7, 0xf7, 0x00, 0x03, 0x00, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x17, 0x00, 0xa7, 0xf7, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+  0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x06,
+  0x00, 0xb4, 0x88, 0x14, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x03, 0x20, 0x00,
+  0x10, 0xe3, 0xff, 0xee, 0x35, 0x5d, 0xc3, 0x66, 0xbe, 0xdf, 0xfd, 0x33,
+  0x31, 0x70, 0xff, 0xeb, 0x9d, 0x7a, 0x08, 0x00, 0x05, 0x01, 0xff, 0xec,
+  0x00, 0x0a, 0x00, 0x0a, 0x64, 0x00, 0x05, 0x01, 0xff, 0xfd, 0x01, 0x00,
+  0x00, 0x02, 0xee, 0x00, 0x00, 0x4e, 0x20, 0x00, 0x64, 0x00, 0x32, 0x03,
+  0x04, 0x00, 0x32, 0x4b, 0x03, 0x00, 0xeb, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x64, 0x64, 0x01, 0x64, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x32,
+  0x01, 0x03, 0x02, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00,
+  0x14, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x03, 0x02, 0x02, 0x04, 0x02, 0x02, 0x05, 0x02, 0x02, 0x06, 0x02,
+  0x02, 0x07, 0x02, 0x02, 0x08, 0x02, 0x02, 0x09, 0x02, 0x02, 0x0a, 0x02,
+  0x02, 0x0b, 0x02, 0x02, 0x0c, 0x02, 0x02, 0x0d, 0x02, 0x02, 0x0e, 0x02,
+  0x02, 0x0f, 0x02, 0x02, 0x10, 0x02, 0x02, 0x11, 0x02, 0x02, 0x12, 0x02,
+  0x02, 0x13, 0x02, 0x02, 0x14, 0x02, 0x02, 0x15, 0x02, 0x02, 0x16, 0x02,
+  0x02, 0x17, 0x02, 0x02, 0x18, 0x02, 0x02, 0x19, 0x02, 0x02, 0x1a, 0x02,
+  0x02, 0x1b, 0x02, 0x02, 0x1c, 0x02, 0x02, 0x1d, 0x02, 0x02, 0x1e, 0x02,
+  0x02, 0x1f, 0x02, 0x02, 0x20, 0x02, 0x02, 0x21, 0x02, 0x02, 0x22, 0x02,
+  0x02, 0x23, 0x02, 0x02, 0x24, 0x02, 0x02, 0x25, 0x02, 0x02, 0x26, 0x02,
+  0x02, 0x27, 0x02, 0x02, 0x28, 0x02, 0x02, 0x29, 0x02, 0x02, 0x2a, 0x02,
+  0x02, 0x2b, 0x02, 0x02, 0x2c, 0x02, 0x02, 0x2d, 0x02, 0x02, 0x2e, 0x02,
+  0x02, 0x2f, 0x02, 0x02, 0x30, 0x02, 0x02, 0x31, 0x02, 0x02, 0x32, 0x02,
+  0x02, 0x33, 0x02, 0x02, 0x34, 0x02, 0x02, 0x35, 0x02, 0x02, 0x36, 0x02,
+  0x02, 0x37, 0x02, 0x02, 0x38, 0x02, 0x02, 0x39, 0x02, 0x02, 0x3a, 0x02,
+  0x02, 0x3b, 0x02, 0x02, 0x3c, 0x02, 0x02, 0x3d, 0x02, 0x02, 0x3e, 0x02,
+  0x02, 0x3f, 0x02, 0x02, 0x40, 0x02, 0x02, 0x41, 0x02, 0x02, 0x42, 0x02,
+  0x02, 0x43, 0x02, 0x02, 0x44, 0x02, 0x02, 0x45, 0x02, 0x02, 0x46, 0x02,
+  0x02, 0x47, 0x02, 0x02, 0x48, 0x02, 0x02, 0x49, 0x02, 0x02, 0x4a, 0x02,
+  0x02, 0x4b, 0x02, 0x02, 0x4c, 0x02, 0x02, 0x4d, 0x02, 0x02, 0x4e, 0x02,
+  0x02, 0x4f, 0x02, 0x02, 0x50, 0x02, 0x02, 0x51, 0x02, 0x02, 0x52, 0x02,
+  0x02, 0x53, 0x02, 0x02, 0x54, 0x02, 0x02, 0x55, 0x02, 0x02, 0x56, 0x02,
+  0x02, 0x57, 0x02, 0x02, 0x58, 0x02, 0x02, 0x59, 0x02, 0x02, 0x5a, 0x02,
+  0x02, 0x5b, 0x02, 0x02, 0x5c, 0x02, 0x02, 0x5d, 0x02, 0x02, 0x5e, 0x02,
+  0x02, 0x5f, 0x02, 0x02, 0x60, 0x02, 0x02, 0x61, 0x02, 0x02, 0x62, 0x02,
+  0x02, 0x63, 0x02, 0x02, 0x64, 0x02, 0x02, 0x65, 0x02, 0x02, 0x66, 0x02,
+  0x02, 0x67, 0x02, 0x02, 0x68, 0x02, 0x02, 0x69, 0x02, 0x02, 0x6a, 0x02,
+  0x02, 0x6b, 0x02, 0x02, 0x6c, 0x02, 0x02, 0x6d, 0x02, 0x02, 0x6e, 0x02,
+  0x02, 0x6f, 0x02, 0x02, 0x70, 0x02, 0x02, 0x71, 0x02, 0x02, 0x72, 0x02,
+  0x02, 0x73, 0x02, 0x02, 0x74, 0x02, 0x02, 0x75, 0x02, 0x02, 0x76, 0x02,
+  0x02, 0x77, 0x02, 0x02, 0x78, 0x02, 0x02, 0x79, 0x02, 0x02, 0x7a, 0x02,
+  0x02, 0x7b, 0x02, 0x02, 0x7c, 0x02, 0x02, 0x7d, 0x02, 0x02, 0x7e, 0x02,
+  0x02, 0x7f, 0x02, 0x02, 0x80, 0x02, 0x02, 0x81, 0x02, 0x02, 0x82, 0x02,
+  0x02, 0x83, 0x02, 0x02, 0x84, 0x02, 0x02, 0x85, 0x02, 0x02, 0x86, 0x02,
+  0x02, 0x87, 0x02, 0x02, 0x88, 0x02, 0x02, 0x89, 0x02, 0x02, 0x8a, 0x02,
+  0x02, 0x8b, 0x02, 0x02, 0x8c, 0x02, 0x02, 0x8d, 0x02, 0x02, 0x8e, 0x02,
+  0x02, 0x8f, 0x02, 0x02, 0x90, 0x02, 0x02, 0x91, 0x02, 0x02, 0x92, 0x02,
+  0x02, 0x93, 0x02, 0x02, 0x94, 0x02, 0x02, 0x95, 0x02, 0x02, 0x96, 0x02,
+  0x02, 0x97, 0x02, 0x02, 0x98, 0x02, 0x02, 0x99, 0x02, 0x02, 0x9a, 0x02,
+  0x02, 0x9b, 0x02, 0x02, 0x9c, 0x02, 0x02, 0x9d, 0x02, 0x02, 0x9e, 0x02,
+  0x02, 0x9f, 0x02, 0x02, 0xa0, 0x02, 0x02, 0xa1, 0x02, 0x02, 0xa2, 0x02,
+  0x02, 0xa3, 0x02, 0x02, 0xa4, 0x02, 0x02, 0xa5, 0x02, 0x02, 0xa6, 0x02,
+  0x02, 0xa7, 0x02, 0x02, 0xa8, 0x02, 0x72, 0x6e, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x2c, 0x20, 0x73, 0x6f, 0x20,
+  0x69, 0x74, 0x20, 0x62, 0x65, 0x63, 0x6f, 0x6d, 0x65, 0x73, 0x20, 0x65,
+  0x61, 0x73, 0x69, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x65, 0x73, 0x74,
+  0x61, 0x62, 0x6c, 0x69, 0x73, 0x68, 0x20, 0x61, 0x20, 0x6e, 0x65, 0x77,
+  0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x67,
+  0x6f, 0x76, 0x65, 0x72, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x66,
+  0x20, 0x69, 0x74, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6e,
+  0x20, 0x64, 0x6f, 0x6e, 0x65, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
+  0x2e, 0x00, 0x01, 0x01, 0x56, 0x00, 0xa5, 0x0f, 0x00, 0x8a, 0x73, 0x61,
+  0x76, 0x65, 0x62, 0x69, 0x6e, 0x61, 0x72, 0x79, 0x00, 0x57, 0x68, 0x65,
+  0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x61, 0x76, 0x65,
+  0x20, 0x67, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x62, 0x69,
+  0x6e, 0x61, 0x72, 0x79, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x00,
+  0x49, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74,
+  0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x2c, 0x20, 0x73, 0x61,
+  0x76, 0x65, 0x64, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x61, 0x72,
+  0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6e, 0x20, 0x69, 0x6e,
+  0x20, 0x61, 0x20, 0x62, 0x69, 0x6e, 0x61, 0x72, 0x79, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x61, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73,
+  0x20, 0x63, 0x6f, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x72, 0x61, 0x62, 0x6c,
+  0x79, 0x20, 0x66, 0x61, 0x73, 0x74, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20,
+  0x73, 0x61, 0x76, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6c, 0x6f, 0x61,
+  0x64, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64,
+  0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20,
+  0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x68, 0x75, 0x6d, 0x61, 0x6e, 0x20, 0x72, 0x65, 0x61, 0x64, 0x61,
+  0x62, 0x6c, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x27, 0x63, 0x6f,
+  0x6d, 0x70, 0x72, 0x65, 0x73, 0x73, 0x27, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x27, 0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73, 0x74, 0x79, 0x70,
+  0x65, 0x27, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20,
+  0x61, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x74, 0x20,
+  0x61, 0x73, 0x20, 0x77, 0x65, 0x6c, 0x6c, 0x2e, 0x20, 0x53, 0x63, 0x65,
+  0x6e, 0x61, 0x72, 0x69, 0x6f, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61,
+  0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2e, 0x00, 0x05, 0x01, 0x3d, 0x00,
+  0xa5, 0x0f, 0x00, 0x84, 0x73, 0x61, 0x76, 0x65, 0x66, 0x72, 0x65, 0x71,
+  0x75, 0x65, 0x6e, 0x63, 0x79, 0x00, 0x4d, 0x69, 0x6e, 0x75, 0x74, 0x65,
+  0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x2d, 0x73,
+  0x61, 0x76, 0x65, 0x00, 0x48, 0x6f, 0x77, 0x20, 0x6d, 0x61, 0x6e, 0x79,
+  0x20, 0x6d, 0x69, 0x6e, 0x75, 0x74, 0x65, 0x73, 0x20, 0x65, 0x6c, 0x61,
+  0x70, 0x73, 0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20,
+  0x61, 0x75, 0x74, 0x6f, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x20, 0x67, 0x61,
+  0x6d, 0x65, 0x20, 0x73, 0x61, 0x76, 0x65, 0x73, 0x2e, 0x20, 0x55, 0x6e,
+  0x6c, 0x69, 0x6b, 0x65, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x73,
+  0x61, 0x76, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2c, 0x20, 0x74,
+  0x68, 0x69, 0x73, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x69, 0x73, 0x20,
+  0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x74, 0x20, 0x61,
+  0x73, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x75, 0x70, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x72, 0x20, 0x6d, 0x65,
+  0x6d, 0x6f, 0x72, 0x79, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x74,
+  0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x75, 0x73, 0x65, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x2c, 0x20, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x20, 0x73, 0x61,
+  0x76, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x6b, 0x65, 0x70, 0x74, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x73,
+  0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20,
+  0x68, 0x61, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63,
+  0x74, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x27,
+  0x61, 0x75, 0x74, 0x6f, 0x73, 0x61, 0x76, 0x65, 0x73, 0x27, 0x20, 0x73,
+  0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75,
+  0x64, 0x65, 0x73, 0x20, 0x22, 0x54, 0x69, 0x6d, 0x65, 0x72, 0x22, 0x2e,
+  0x00, 0x05, 0x01, 0xb0, 0x00, 0xa5, 0x0f, 0x00, 0x8b, 0x73, 0x61, 0x76,
+  0x65, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x44, 0x65, 0x66, 0x69, 0x6e, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x73, 0x61, 0x76, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x00, 0x57, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x63,
+  0x75, 0x73, 0x74, 0x6f, 0x6d, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
+  0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
+  0x64, 0x3a, 0x0a, 0x20, 0x20, 0x25, 0x52, 0x20, 0x3d, 0x20, 0x3c, 0x72,
+  0x65, 0x61, 0x73, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x25, 0x53, 0x20,
+  0x3d, 0x20, 0x3c, 0x73, 0x75, 0x66, 0x66, 0x69, 0x78, 0x3e, 0x0a, 0x20,
+  0x20, 0x25, 0x54, 0x20, 0x3d, 0x20, 0x3c, 0x74, 0x75, 0x72, 0x6e, 0x2d,
+  0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x25, 0x59,
+  0x20, 0x3d, 0x20, 0x3c, 0x67, 0x61, 0x6d, 0x65, 0x2d, 0x79, 0x65, 0x61,
+  0x72, 0x3e, 0x0a, 0x0a, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a,
+  0x20, 0x27, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x54, 0x25,
+  0x30, 0x34, 0x54, 0x2d, 0x59, 0x25, 0x2b, 0x30, 0x35, 0x59, 0x2d, 0x25,
+  0x52, 0x27, 0x20, 0x3d, 0x3e, 0x20, 0x27, 0x66, 0x72, 0x65, 0x65, 0x63,
+  0x69, 0x76, 0x2d, 0x54, 0x30, 0x31, 0x30, 0x30, 0x2d, 0x59, 0x30, 0x30,
+  0x30, 0x30, 0x31, 0x2d, 0x6d, 0x61, 0x6e, 0x75, 0x61, 0x6c, 0x27, 0x0a,
+  0x0a, 0x42, 0x65, 0x20, 0x63, 0x61, 0x72, 0x65, 0x66, 0x75, 0x6c, 0x20,
+  0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x61, 0x74, 0x20, 0x6c, 0x65,
+  0x61, 0x73, 0x74, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x25,
+  0x54, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x25, 0x59, 0x2c, 0x20, 0x65, 0x6c,
+  0x73, 0x65, 0x20, 0x6e, 0x65, 0x77, 0x65, 0x72, 0x20, 0x73, 0x61, 0x76,
+  0x65, 0x67, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20,
+  0x6f, 0x76, 0x65, 0x72, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x6f, 0x6c,
+  0x64, 0x20, 0x6f, 0x6e, 0x65, 0x73, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x6e,
+  0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x61, 0x74, 0x73, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73,
+  0x65, 0x64, 0x20, 0x27, 0x2d, 0x54, 0x25, 0x30, 0x34, 0x54, 0x2d, 0x59,
+  0x25, 0x30, 0x35, 0x59, 0x2d, 0x25, 0x52, 0x27, 0x20, 0x69, 0x73, 0x20,
+  0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x27, 0x73, 0x61, 0x76, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x27, 0x2e,
+  0x00, 0x05, 0x01, 0x72, 0x00, 0xa5, 0x0f, 0x00, 0x66, 0x73, 0x61, 0x76,
+  0x65, 0x70, 0x61, 0x6c, 0x61, 0x63, 0x65, 0x00, 0x52, 0x65, 0x62, 0x75,
+  0x69, 0x6c, 0x64, 0x20, 0x70, 0x61, 0x6c, 0x61, 0x63, 0x65, 0x20, 0x77,
+  0x68, 0x65, 0x6e, 0x65, 0x76, 0x65, 0x72, 0x20, 0x63, 0x61, 0x70, 0x69,
+  0x74, 0x61, 0x6c, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x71, 0x75,
+  0x65, 0x72, 0x65, 0x64, 0x00, 0x49, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73,
+  0x20, 0x69, 0x73, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x6f,
+  0x6e, 0x2c, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x69, 0x73, 0x20, 0x63,
+  0x6f, 0x6e, 0x71, 0x75, 0x65, 0x72, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x70, 0x61, 0x6c, 0x61, 0x63, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61,
+  0x75, 0x74, 0x6f, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x6c, 0x79,
+  0x20, 0x72, 0x65, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6e, 0x6f,
+  0x74, 0x68, 0x65, 0x72, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x6c,
+  0x79, 0x20, 0x63, 0x68, 0x6f, 0x73, 0x65, 0x6e, 0x20, 0x63, 0x69, 0x74,
+  0x79, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x73,
+  0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x20, 0x62,
+  0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
+  0x65, 0x63, 0x68, 0x6e, 0x6f, 0x6c, 0x6f, 0x67, 0x79, 0x20, 0x72, 0x65,
+  0x71, 0x75, 0x69, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61,
+  0x20, 0x70, 0x61, 0x6c, 0x61, 0x63, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c,
+  0x20, 0x62, 0x65, 0x20, 0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x64, 0x2e,
+  0x20, 0x28, 0x49, 0x6e, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x72, 0x75,
+  0x6c, 0x65, 0x73, 0x65, 0x74, 0x73, 0x2c, 0x20, 0x62, 0x75, 0x69, 0x6c,
+  0x64, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20,
+  0x74, 0x68, 0x61, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x6c,
+  0x61, 0x63, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x66, 0x66, 0x65,
+  0x63, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73,
+  0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x2e, 0x29, 0x00, 0x03,
+  0x00, 0xac, 0x00, 0xa5, 0x0f, 0x00, 0x82, 0x73, 0x61, 0x76, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x73, 0x00, 0x54, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x70,
+  0x65, 0x72, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x2d, 0x73, 0x61, 0x76, 0x65,
+  0x00, 0x48, 0x6f, 0x77, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 0x74, 0x75,
+  0x72, 0x6e, 0x73, 0x20, 0x65, 0x6c, 0x61, 0x70, 0x73, 0x65, 0x20, 0x62,
+  0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x6d,
+  0x61, 0x74, 0x69, 0x63, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x20, 0x73, 0x61,
+  0x76, 0x65, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x73, 0x65,
+  0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x68,
+  0x61, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74,
+  0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x27, 0x61,
+  0x75, 0x74, 0x6f, 0x73, 0x61, 0x76, 0x65, 0x73, 0x27, 0x20, 0x73, 0x65,
+  0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64,
+  0x65, 0x73, 0x20, 0x22, 0x4e, 0x65, 0x77, 0x20, 0x74, 0x75, 0x72, 0x6e,
+  0x22, 0x2e, 0x00, 0x05, 0x01, 0x01, 0x00, 0xa5, 0x0f, 0x00, 0x2d, 0x73,
+  0x63, 0x69, 0x65, 0x6e, 0x63, 0x65, 0x62, 0x6f, 0x78, 0x00, 0x54, 0x65,
+  0x63, 0x68, 0x6e, 0x6f, 0x6c, 0x6f, 0x67, 0x79, 0x20, 0x63, 0x6f, 0x73,
+  0x74, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x69, 0x65, 0x72,
+  0x20, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x61, 0x67, 0x65, 0x00,
+  0x54, 0x68, 0x69, 0x73, 0x20, 0x61, 0x66, 0x66, 0x65, 0x63, 0x74, 0x73,
+  0x20, 0x68, 0x6f, 0x77, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x6c, 0x79,
+  0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x20, 0x63, 0x61, 0x6e,
+  0x20, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x6e, 0x65,
+  0x77, 0x20, 0x74, 0x65, 0x63, 0x68, 0x6e, 0x6f, 0x6c, 0x6f, 0x67, 0x79,
+  0x2e, 0x20, 0x41, 0x6c, 0x6c, 0x20, 0x74, 0x65, 0x63, 0x68, 0x20, 0x63,
+  0x6f, 0x73, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6d, 0x75, 0x6c,
+  0x74, 0x69, 0x70, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74,
+  0x68, 0x69, 0x73, 0x20, 0x61, 0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x28,
+  0x61, 0x73, 0x20, 0x61, 0x20, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74,
+  0x61, 0x67, 0x65, 0x29, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x62, 0x61,
+  0x73, 0x65, 0x20, 0x74, 0x65, 0x63, 0x68, 0x20, 0x63, 0x6f, 0x73, 0x74,
+  0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6d,
+  0x69, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x72, 0x75, 0x6c, 0x65, 0x73, 0x65, 0x74, 0x20, 0x6f, 0x72, 0x20, 0x6f,
+  0x74, 0x68, 0x65, 0x72, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x20, 0x73, 0x65,
+  0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x00, 0x04, 0x00, 0x6e, 0x00,
+  0xff, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcb,
+  0x6e, 0x00, 0x53, 0x00, 0x33, 0x54, 0x00, 0x74, 0x00, 0x31, 0x00, 0x00,
+  0x04, 0x02, 0x00, 0x00, 0x00, 0x32, 0x28, 0x3c, 0x05, 0x56, 0x00, 0x00,
+  0x80, 0xea, 0xa2, 0x8f, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x22, 0x78, 0x78,
+  0xff, 0x7f, 0x00, 0x00, 0x20, 0x23, 0x78, 0x78, 0xff, 0x7f, 0x00, 0x00,
+  0x00, 0x04, 0xcb, 0x6e, 0xe7, 0x26, 0x9e, 0x6b, 0x80, 0xde, 0x4f, 0xab,
+  0x05, 0x56, 0x00, 0x00, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcb, 0x6e,
+  0x00, 0x0a, 0x00, 0x3b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0c,
+  0x00, 0x3b, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x05, 0x00, 0x0c,
+  0x00, 0x3b, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x05, 0x00, 0x0c,
+  0x00, 0x3b, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x05, 0x00, 0x0c,
+  0x00, 0x3b, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x05, 0x00, 0x0c,
+  0x00, 0x3b, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x0e,
+  0x00, 0x3b, 0x07, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x01, 0x05,
+  0x00, 0x0e, 0x00, 0x3b, 0x07, 0x00, 0x00, 0x02, 0x02, 0x00, 0x01, 0x00,
+  0x02, 0x05, 0x00, 0x0e, 0x00, 0x3b, 0x07, 0x00, 0x00, 0x02, 0x03, 0x00,
+  0x01, 0x00, 0x03, 0x05, 0x00, 0x0e, 0x00, 0x3b, 0x07, 0x00, 0x00, 0x02,
+  0x04, 0x00, 0x01, 0x00, 0x04, 0x05, 0x00, 0x0c, 0x00, 0x3b, 0x05, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x02, 0x05, 0x00, 0x0e, 0x00, 0x3b, 0x07, 0x00,
+  0x00, 0x04, 0x01, 0x00, 0x02, 0x00, 0x01, 0x05, 0x00, 0x0e, 0x00, 0x3b,
+  0x07, 0x00, 0x00, 0x04, 0x02, 0x00, 0x02, 0x00, 0x02, 0x05, 0x00, 0x0e,
+  0x00, 0x3b, 0x07, 0x00, 0x00, 0x04, 0x03, 0x00, 0x02, 0x00, 0x03, 0x05,
+  0x00, 0x0e, 0x00, 0x3b, 0x07, 0x00, 0x00, 0x04, 0x04, 0x00, 0x02, 0x00,
+  0x04, 0x05, 0x00, 0x0c, 0x00, 0x3b, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x03, 0x05, 0x00, 0x0e, 0x00, 0x3b, 0x07, 0x00, 0x00, 0x06, 0x01, 0x00,
+  0x03, 0x00, 0x01, 0x05, 0x00, 0x0e, 0x00, 0x3b, 0x07, 0x00, 0x00, 0x06,
+  0x02, 0x00, 0x03, 0x00, 0x02, 0x05, 0x00, 0x0e, 0x00, 0x3b, 0x07, 0x00,
+  0x00, 0x06, 0x03, 0x00, 0x03, 0x00, 0x03, 0x05, 0x00, 0x0e, 0x00, 0x3b,
+  0x07, 0x00, 0x00, 0x06, 0x04, 0x00, 0x03, 0x00, 0x04, 0x05, 0x00, 0x0c,
+  0x00, 0x3b, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x05, 0x00, 0x0e,
+  0x00, 0x3b, 0x07, 0x00, 0x00, 0x08, 0x01, 0x00, 0x04, 0x00, 0x01, 0x05,
+  0x00, 0x0e, 0x00, 0x3b, 0x07, 0x00, 0x00, 0x08, 0x02, 0x00, 0x04, 0x00,
+  0x02, 0x05, 0x00, 0x0e, 0x00, 0x3b, 0x07, 0x00, 0x00, 0x08, 0x03, 0x00,
+  0x04, 0x00, 0x03, 0x05, 0x00, 0x0e, 0x00, 0x3b, 0x07, 0x00, 0x00, 0x08,
+  0x04, 0x00, 0x04, 0x00, 0x04, 0x05, 0x00, 0x0b, 0x00, 0x3c, 0x0c, 0x02,
+  0x23, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x0f, 0x00, 0x11, 0x3f, 0x00, 0x1c,
+  0x00, 0x38, 0x03, 0x03, 0x03, 0xe8, 0xfc, 0x18, 0x00, 0x24, 0x00, 0x0f,
+  0xef, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x07, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f,
+  0x6f, 0x01, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00,
+  0x00, 0x02, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff,
+  0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x17, 0x00, 0x00, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f,
+  0x6f, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x06, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x1e, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x08, 0x80, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x0a, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f,
+  0xef, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f,
+  0xef, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x0b, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f,
+  0xef, 0x01, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x02, 0x23, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f,
+  0x6f, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x0a, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00,
+  0x00, 0x0d, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f,
+  0x6f, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x02, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x04, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0a, 0x80, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x11, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f,
+  0x6f, 0x01, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00,
+  0x00, 0x13, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f,
+  0x6f, 0x01, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00,
+  0x00, 0x16, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x80, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f,
+  0x6f, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x06, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00,
+  0x00, 0x19, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0a, 0x80, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x0a, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f,
+  0xef, 0x01, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x0a, 0x12, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f,
+  0x6f, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x0b, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00,
+  0x00, 0x1d, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x80, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f,
+  0x6f, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x0b, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00,
+  0x00, 0x20, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x21, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00,
+  0x00, 0x21, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x80, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x22, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f,
+  0xef, 0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x08, 0x24, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f,
+  0xef, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x0b, 0x1a, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f,
+  0xef, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x07, 0x1f, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2f, 0x00, 0x0f,
+  0xef, 0x09, 0x00, 0x00, 0x00, 0x26, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x0a, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x44, 0x65, 0x65, 0x70,
+  0x20, 0x47, 0x6f, 0x72, 0x67, 0x65, 0x00, 0x00, 0x1e, 0x00, 0x0f, 0x6f,
+  0x09, 0x00, 0x00, 0x00, 0x27, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x04, 0x80, 0xff, 0x49, 0x63, 0x65, 0x20, 0x53, 0x68, 0x65, 0x6c, 0x66,
+  0x00, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00,
+  0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0xff, 0x00, 0x24, 0x00,
+  0x0f, 0xef, 0x01, 0x00, 0x00, 0x00, 0x29, 0x00, 0x01, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x0a, 0x13, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x00, 0x2b, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x2c, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x24, 0x00,
+  0x0f, 0xef, 0x01, 0x00, 0x00, 0x00, 0x2d, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x17, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x00, 0x2f, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x30, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x31, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x00, 0x32, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x33, 0xff,
+  0xfe, 0x02, 0x00, 0xff, 0x00, 0xff, 0x01, 0x80, 0xff, 0x00, 0x21, 0x00,
+  0x0f, 0x6f, 0x09, 0x00, 0x00, 0x00, 0x34, 0x00, 0x01, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x05, 0x80, 0xff, 0x57, 0x68, 0x69, 0x74, 0x65, 0x20, 0x44,
+  0x65, 0x73, 0x65, 0x72, 0x74, 0x00, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01,
+  0x00, 0x00, 0x00, 0x35, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05,
+  0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x36,
+  0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x08, 0x80, 0xff, 0x00, 0x14,
+  0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x37, 0x00, 0x01, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x07, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01,
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06,
+  0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x00, 0x39,
+  0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x80, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x3a,
+  0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x80, 0xff, 0x00, 0x14,
+  0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x3b, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01,
+  0x00, 0x00, 0x00, 0x3c, 0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05,
+  0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x00, 0x3d,
+  0x00, 0x01, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x80, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x3e,
+  0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0x20, 0x64, 0x65, 0x73, 0x65, 0x72,
+  0x74, 0x20, 0x7a, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x6c,
+  0x61, 0x70, 0x73, 0x20, 0x74, 0x72, 0x6f, 0x70, 0x69, 0x63, 0x61, 0x6c,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61,
+  0x74, 0x65, 0x20, 0x7a, 0x6f, 0x6e, 0x65, 0x73, 0x2e, 0x0a, 0x20, 0x33,
+  0x30, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x61, 0x20, 0x63, 0x6f,
+  0x6c, 0x64, 0x20, 0x70, 0x6c, 0x61, 0x6e, 0x65, 0x74, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x72, 0x6f,
+  0x70, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x7a, 0x6f, 0x6e, 0x65, 0x73, 0x2e,
+  0x0a, 0x20, 0x20, 0x30, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x61,
+  0x20, 0x76, 0x65, 0x72, 0x79, 0x20, 0x63, 0x6f, 0x6c, 0x64, 0x20, 0x70,
+  0x6c, 0x61, 0x6e, 0x65, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6c,
+  0x61, 0x72, 0x67, 0x65, 0x20, 0x70, 0x6f, 0x6c, 0x61, 0x72, 0x20, 0x7a,
+  0x6f, 0x6e, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6e, 0x6f, 0x20,
+  0x74, 0x72, 0x6f, 0x70, 0x69, 0x63, 0x73, 0x2e, 0x00, 0x01, 0x9f, 0x00,
+  0xa5, 0x0f, 0x00, 0x86, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x65, 0x64,
+  0x5f, 0x73, 0x61, 0x76, 0x65, 0x00, 0x57, 0x68, 0x65, 0x74, 0x68, 0x65,
+  0x72, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x6f, 0x20, 0x73, 0x61, 0x76, 0x69,
+  0x6e, 0x67, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61,
+  0x74, 0x65, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x00, 0x49, 0x66,
+  0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74, 0x75, 0x72,
+  0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x2c, 0x20, 0x73, 0x61, 0x76, 0x69,
+  0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x20,
+  0x74, 0x61, 0x6b, 0x65, 0x73, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67,
+  0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20,
+  0x67, 0x61, 0x6d, 0x65, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69,
+  0x73, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x73,
+  0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x77, 0x61, 0x79, 0x20, 0x75,
+  0x73, 0x65, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 0x74, 0x6f,
+  0x20, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x66, 0x69,
+  0x6e, 0x69, 0x73, 0x68, 0x2e, 0x20, 0x57, 0x68, 0x65, 0x72, 0x65, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x73,
+  0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x20, 0x69, 0x74, 0x2c, 0x20,
+  0x61, 0x20, 0x73, 0x6e, 0x61, 0x70, 0x73, 0x68, 0x6f, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x20, 0x62, 0x75, 0x69,
+  0x6c, 0x64, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x77, 0x72, 0x69, 0x74,
+  0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x68, 0x6f, 0x6c, 0x65,
+  0x20, 0x73, 0x61, 0x76, 0x65, 0x67, 0x61, 0x6d, 0x65, 0x3b, 0x20, 0x6f,
+  0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x6f, 0x6e, 0x6c,
+  0x79, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6e,
+  0x67, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x61, 0x76, 0x69, 0x6e, 0x67,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x63, 0x74, 0x75, 0x61, 0x6c, 0x20,
+  0x66, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x61, 0x6b, 0x65, 0x73, 0x20, 0x70,
+  0x6c, 0x61, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x73, 0x65,
+  0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61,
+  0x64, 0x2e, 0x00, 0x05, 0x01, 0x63, 0x00, 0xa5, 0x0f, 0x00, 0x7a, 0x74,
+  0x68, 0x72, 0x65, 0x61, 0x64, 0x65, 0x64, 0x5f, 0x73, 0x65, 0x6e, 0x64,
+  0x00, 0x57, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20,
+  0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x69, 0x6e, 0x20,
+  0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x72,
+  0x65, 0x61, 0x64, 0x00, 0x49, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
+  0x69, 0x73, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x6f, 0x6e,
+  0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73,
+  0x65, 0x6e, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+  0x6c, 0x69, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x69, 0x73, 0x20, 0x77, 0x72,
+  0x69, 0x74, 0x74, 0x65, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x62, 0x79, 0x20,
+  0x61, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+  0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x2c, 0x20, 0x73, 0x6f, 0x20,
+  0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x61, 0x6d,
+  0x65, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x77,
+  0x61, 0x69, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x6c, 0x6f, 0x77,
+  0x20, 0x63, 0x6c, 0x69, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x20, 0x54, 0x68,
+  0x65, 0x20, 0x27, 0x6e, 0x65, 0x74, 0x77, 0x61, 0x69, 0x74, 0x27, 0x20,
+  0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x68, 0x61, 0x73, 0x20,
+  0x74, 0x68, 0x65, 0x6e, 0x20, 0x6e, 0x6f, 0x20, 0x65, 0x66, 0x66, 0x65,
+  0x63, 0x74, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f, 0x6e, 0x6e,
+  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x63, 0x75, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6c, 0x61, 0x67, 0x67,
+  0x69, 0x6e, 0x67, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x66, 0x74,
+  0x65, 0x72, 0x20, 0x27, 0x6e, 0x65, 0x74, 0x74, 0x69, 0x6d, 0x65, 0x6f,
+  0x75, 0x74, 0x27, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x20,
+  0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x61, 0x6e, 0x79, 0x20,
+  0x70, 0x72, 0x6f, 0x67, 0x72, 0x65, 0x73, 0x73, 0x2e, 0x00, 0x06, 0x01,
+  0x56, 0x00, 0xa5, 0x07, 0x00, 0x02, 0x74, 0x69, 0x6c, 0x65, 0x73, 0x70,
+  0x65, 0x72, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x00, 0x4e, 0x75, 0x6d,
+  0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x28, 0x6c, 0x61, 0x6e, 0x64,
+  0x29, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20,
+  0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x00, 0x54, 0x68, 0x69, 0x73, 0x20,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65,
+  0x64, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6d, 0x69,
+  0x6e, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x70, 0x20, 0x64,
+  0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x20, 0x49,
+  0x74, 0x20, 0x63, 0x61, 0x6c, 0x63, 0x75, 0x6c, 0x61, 0x74, 0x65, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x70, 0x20, 0x73, 0x69, 0x7a,
+  0x65, 0x20, 0x61, 0x74, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x20, 0x73, 0x74,
+  0x61, 0x72, 0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x6f, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20,
+  0x6f, 0x66, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x74, 0x74,
+  0x69, 0x6e, 0x67, 0x20, 0x27, 0x6c, 0x61, 0x6e, 0x64, 0x6d, 0x61, 0x73,
+  0x73, 0x27, 0x2e, 0x0a, 0x46, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x69, 0x73,
+  0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x74,
+  0x61, 0x6b, 0x65, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x2c, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x22, 0x4d, 0x61, 0x70, 0x20, 0x73, 0x69, 0x7a,
+  0x65, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+  0x22, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x27, 0x6d,
+  0x61, 0x70, 0x73, 0x69, 0x7a, 0x65, 0x27, 0x29, 0x20, 0x6d, 0x75, 0x73,
+  0x74, 0x20, 0x62, 0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 0x20,
+  0x22, 0x54, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x70,
+  0x6c, 0x61, 0x79, 0x65, 0x72, 0x22, 0x20, 0x28, 0x50, 0x4c, 0x41, 0x59,
+  0x45, 0x52, 0x29, 0x2e, 0x00, 0x00, 0xb0, 0x00, 0xa5, 0x0f, 0x00, 0x75,
+  0x74, 0x69, 0x6d, 0x65, 0x61, 0x64, 0x64, 0x65, 0x6e, 0x65, 0x6d, 0x79,
+  0x6d, 0x6f, 0x76, 0x65, 0x00, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74,
+  0x20, 0x61, 0x74, 0x20, 0x6c, 0x65, 0x61, 0x73, 0x74, 0x20, 0x6e, 0x20,
+  0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x77, 0x68, 0x65, 0x6e,
+  0x20, 0x65, 0x6e, 0x65, 0x6d, 0x79, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x64,
+  0x00, 0x41, 0x6e, 0x79, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x61, 0x20,
+  0x75, 0x6e, 0x69, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x77,
+  0x68, 0x69, 0x6c, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x69, 0x67, 0x68,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x6e, 0x65, 0x6d,
+  0x79, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x2c, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20,
+  0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x20, 0x69, 0x73, 0x20, 0x69,
+  0x6e, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20,
+  0x74, 0x68, 0x69, 0x73, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x00,
+  0x05, 0x01, 0xf5, 0x00, 0xa5, 0x0f, 0x00, 0x73, 0x74, 0x69, 0x6d, 0x65,
+  0x6f, 0x75, 0x74, 0x00, 0x4d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x20,
+  0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20,
+  0x74, 0x75, 0x72, 0x6e, 0x00, 0x49, 0x66, 0x20, 0x61, 0x6c, 0x6c, 0x20,
+  0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x20, 0x68, 0x61, 0x76, 0x65,
+  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x68, 0x69, 0x74, 0x20, 0x22, 0x54, 0x75,
+  0x72, 0x6e, 0x20, 0x44, 0x6f, 0x6e, 0x65, 0x22, 0x20, 0x62, 0x65, 0x66,
+  0x6f, 0x72, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x74, 0x69, 0x6d,
+  0x65, 0x20, 0x69, 0x73, 0x20, 0x75, 0x70, 0x2c, 0x20, 0x74, 0x68, 0x65,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x65,
+  0x6e, 0x64, 0x73, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x6d, 0x61, 0x74, 0x69,
+  0x63, 0x61, 0x6c, 0x6c, 0x79, 0x2e, 0x20, 0x5a, 0x65, 0x72, 0x6f, 0x20,
+  0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20,
+  0x69, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75,
+  0x74, 0x2e, 0x20, 0x49, 0x6e, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
+  0x73, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x67, 0x69, 0x6e,
+  0x67, 0x2c, 0x20, 0x61, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x2d, 0x31, 0x20, 0x73, 0x65, 0x74, 0x73, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x67, 0x61, 0x6d, 0x65,
+  0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x2e, 0x20,
+  0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x68, 0x61,
+  0x63, 0x6b, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x20, 0x61, 0x63, 0x63,
+  0x65, 0x73, 0x73, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x73, 0x65, 0x74, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x20,
+  0x74, 0x6f, 0x20, 0x66, 0x65, 0x77, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61,
+  0x6e, 0x20, 0x33, 0x30, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73,
+  0x2e, 0x20, 0x55, 0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x6d,
+  0x61, 0x6e, 0x64, 0x20, 0x22, 0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74,
+  0x69, 0x6e, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x22, 0x20, 0x74, 0x6f,
+  0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x20, 0x64, 0x79, 0x6e, 0x61,
+  0x6d, 0x69, 0x63, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x72, 0x2e, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x75, 0x72,
+  0x6e, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61,
+  0x6c, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69,
+  0x73, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x64,
+  0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x27, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x27, 0x20,
+  0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x2e, 0x00, 0x05, 0x00, 0x8b,
+  0x00, 0xa5, 0x07, 0x00, 0x0a, 0x74, 0x69, 0x6e, 0x79, 0x69, 0x73, 0x6c,
+  0x65, 0x73, 0x00, 0x50, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x63, 0x65, 0x20,
+  0x6f, 0x66, 0x20, 0x31, 0x78, 0x31, 0x20, 0x69, 0x73, 0x6c, 0x61, 0x6e,
+  0x79, 0x65, 0x72, 0x20, 0x69, 0x73, 0x6e, 0x27, 0x74, 0x20, 0x61, 0x6c,
+  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65,
+  0x20, 0x61, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x63,
+  0x69, 0x74, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20,
+  0x61, 0x6e, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6e, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x75, 0x6e, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x69, 0x74,
+  0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c,
+  0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20,
+  0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x2e,
+  0x00, 0x01, 0x00, 0xf9, 0x00, 0xa5, 0x0f, 0x00, 0x62, 0x63, 0x69, 0x76,
+  0x69, 0x6c, 0x77, 0x61, 0x72, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x4d, 0x69,
+  0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
+  0x20, 0x6f, 0x66, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x63, 0x69, 0x76, 0x69, 0x6c, 0x20, 0x77, 0x61, 0x72,
+  0x00, 0x41, 0x20, 0x63, 0x69, 0x76, 0x69, 0x6c, 0x20, 0x77, 0x61, 0x72,
+  0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x65,
+  0x64, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x61, 0x20, 0x70, 0x6c, 0x61,
+  0x79, 0x65, 0x72, 0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x74, 0x20, 0x6c,
+  0x65, 0x61, 0x73, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6d, 0x61,
+  0x6e, 0x79, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72,
+  0x27, 0x73, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x69,
+  0x73, 0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x64, 0x2e, 0x20,
+  0x49, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6f, 0x70, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6f,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d,
+  0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x20, 0x63, 0x69, 0x76, 0x69,
+  0x6c, 0x20, 0x77, 0x61, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74,
+  0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x6f, 0x66, 0x66, 0x20, 0x61, 0x6c,
+  0x74, 0x6f, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x2e, 0x00, 0x01, 0x01,
+  0x16, 0x00, 0xa5, 0x0f, 0x00, 0x20, 0x63, 0x6d, 0x74, 0x68, 0x72, 0x65,
+  0x61, 0x64, 0x73, 0x00, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x61, 0x72, 0x72, 0x61, 0x6e, 0x67, 0x69, 0x6e, 0x67, 0x20,
+  0x63, 0x69, 0x74, 0x79, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x73,
+  0x00, 0x57, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x6f,
+  0x72, 0x6b, 0x65, 0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6c, 0x6c,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x61, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x20,
+  0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x61, 0x72, 0x72, 0x61, 0x6e, 0x67,
+  0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x6f, 0x6e, 0x63, 0x65, 0x2c, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x77,
+  0x68, 0x69, 0x63, 0x68, 0x20, 0x64, 0x6f, 0x6e, 0x27, 0x74, 0x20, 0x73,
+  0x68, 0x61, 0x72, 0x65, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x61,
+  0x72, 0x65, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x64, 0x20, 0x61,
+  0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x74,
+  0x69, 0x6d, 0x65, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
+  0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x72, 0x65, 0x61, 0x64, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72,
+  0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x67, 0x61, 0x6d, 0x65, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x6e, 0x27,
+  0x74, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x20, 0x6f, 0x6e, 0x20,
+  0x74, 0x68, 0x69, 0x73, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x00,
+  0x05, 0x00, 0xbd, 0x00, 0xa5, 0x0f, 0x00, 0x87, 0x63, 0x6f, 0x6d, 0x70,
+  0x72, 0x65, 0x73, 0x73, 0x00, 0x53, 0x61, 0x76, 0x65, 0x67, 0x61, 0x6d,
+  0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6f,
+  0x6e, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x00, 0x49, 0x66, 0x20, 0x6e,
+  0x6f, 0x6e, 0x2d, 0x7a, 0x65, 0x72, 0x6f, 0x2c, 0x20, 0x73, 0x61, 0x76,
+  0x65, 0x64, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6c,
+  0x6c, 0x20, 0x62, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73,
+  0x73, 0x65, 0x64, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x69, 0x6e,
+  0x67, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x27, 0x63, 0x6f,
+  0x6d, 0x70, 0x72, 0x65, 0x73, 0x73, 0x74, 0x79, 0x70, 0x65, 0x27, 0x20,
+  0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x4c, 0x61, 0x72,
+  0x67, 0x65, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x77,
+  0x69, 0x6c, 0x6c, 0x20, 0x67, 0x69, 0x76, 0x65, 0x20, 0x62, 0x65, 0x74,
+  0x74, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73,
+  0x69, 0x6f, 0x6e, 0x20, 0x62, 0x75, 0x74, 0x20, 0x74, 0x61, 0x6b, 0x65,
+  0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x65, 0x72, 0x2e, 0x00, 0x05, 0x01, 0x22,
+  0x00, 0xa5, 0x0f, 0x00, 0x89, 0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73,
+  0x73, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x00, 0x53, 0x61, 0x76,
+  0x65, 0x67, 0x61, 0x6d, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65,
+  0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64,
+  0x73, 0x00, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x70,
+  0x72, 0x65, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x61, 0x76, 0x65,
+  0x67, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x22, 0x55, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x78, 0x7a,
+  0x22, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x22, 0x55, 0x73, 0x69, 0x6e, 0x67,
+  0x20, 0x7a, 0x73, 0x74, 0x64, 0x22, 0x20, 0x27, 0x63, 0x6f, 0x6d, 0x70,
+  0x72, 0x65, 0x73, 0x73, 0x74, 0x79, 0x70, 0x65, 0x27, 0x20, 0x61, 0x6c,
+  0x67, 0x6f, 0x72, 0x69, 0x74, 0x68, 0x6d, 0x73, 0x2e, 0x20, 0x53, 0x65,
+  0x76, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64,
+  0x73, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x73, 0x61, 0x76, 0x65, 0x67, 0x61, 0x6d, 0x65, 0x20,
+  0x69, 0x6e, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63,
+  0x68, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x73, 0x20, 0x69, 0x74, 0x20, 0x73,
+  0x6c, 0x69, 0x67, 0x68, 0x74, 0x6c, 0x79, 0x20, 0x6c, 0x61, 0x72, 0x67,
+  0x65, 0x72, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x66, 0x69, 0x6c, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20,
+  0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x20, 0x6c, 0x69, 0x6b, 0x65, 0x20,
+  0x61, 0x6e, 0x79, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x2e, 0x00, 0x05,
+  0x00, 0x5e, 0x00, 0xa5, 0x0f, 0x00, 0x88, 0x63, 0x6f, 0x6d, 0x70, 0x72,
+  0x65, 0x73, 0x73, 0x74, 0x79, 0x70, 0x65, 0x00, 0x53, 0x61, 0x76, 0x65,
+  0x67, 0x61, 0x6d, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73,
+  0x73, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6c, 0x67, 0x6f, 0x72, 0x69, 0x74,
+  0x68, 0x6d, 0x00, 0x43, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69,
+  0x6f, 0x6e, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x74,
+  0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x61,
+  0x76, 0x65, 0x67, 0x61, 0x6d, 0x65, 0x73, 0x2e, 0x00, 0x05, 0x01, 0x17,
+  0x00, 0xa5, 0x0f, 0x00, 0x38, 0x63, 0x6f, 0x6e, 0x71, 0x75, 0x65, 0x72,
+  0x63, 0x6f, 0x73, 0x74, 0x00, 0x50, 0x65, 0x6e, 0x61, 0x6c, 0x74, 0x79,
+  0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x67, 0x65, 0x74, 0x74, 0x69, 0x6e,
+  0x67, 0x20, 0x74, 0x65, 0x63, 0x68, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20,
+  0x63, 0x6f, 0x6e, 0x71, 0x75, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x46,
+  0x6f, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x74, 0x65, 0x63, 0x68,
+  0x6e, 0x6f, 0x6c, 0x6f, 0x67, 0x79, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x67,
+  0x61, 0x69, 0x6e, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x71, 0x75,
+  0x65, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x6e, 0x65,
+  0x6d, 0x79, 0x20, 0x63, 0x69, 0x74, 0x79, 0x2c, 0x20, 0x79, 0x6f, 0x75,
+  0x20, 0x6c, 0x6f, 0x73, 0x65, 0x20, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72,
+  0x63, 0x68, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x65, 0x71,
+  0x75, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
+  0x70, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x61, 0x67, 0x65, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x73, 0x74, 0x20, 0x74,
+  0x6f, 0x20, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x61,
+  0x20, 0x6e, 0x65, 0x77, 0x20, 0x74, 0x65, 0x63, 0x68, 0x6e, 0x6f, 0x6c,
+  0x6f, 0x67, 0x79, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73,
+  0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x7a, 0x65, 0x72, 0x6f,
+  0x2c, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x65, 0x6e,
+  0x64, 0x20, 0x75, 0x70, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6e, 0x65,
+  0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x72, 0x65, 0x73, 0x65, 0x61,
+  0x72, 0x63, 0x68, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x2e, 0x00,
+  0x04, 0x00, 0xfa, 0x00, 0xa5, 0x0f, 0x00, 0x65, 0x63, 0x6f, 0x6e, 0x74,
+  0x61, 0x63, 0x74, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x00, 0x54, 0x75, 0x72,
+  0x6e, 0x73, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x70, 0x6c, 0x61,
+  0x79, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x63, 0x74, 0x20,
+  0x69, 0x73, 0x20, 0x6c, 0x6f, 0x73, 0x74, 0x00, 0x50, 0x6c, 0x61, 0x79,
+  0x65, 0x72, 0x73, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x6d, 0x65, 0x65, 0x74,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 0x69, 0x70, 0x6c, 0x6f, 0x6d, 0x61,
+  0x63, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6e, 0x75, 0x6d, 0x62,
+  0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20,
+  0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20,
+  0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x6c,
+  0x61, 0x73, 0x74, 0x20, 0x6d, 0x65, 0x74, 0x2c, 0x20, 0x65, 0x76, 0x65,
+  0x6e, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20,
+  0x64, 0x6f, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20,
+  0x61, 0x6e, 0x20, 0x65, 0x6d, 0x62, 0x61, 0x73, 0x73, 0x79, 0x2e, 0x20,
+  0x49, 0x66, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x7a, 0x65,
+  0x72, 0x6f, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x70, 0x6c, 0x61,
+  0x79, 0x65, 0x72, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20,
+  0x6d, 0x65, 0x65, 0x74, 0x20, 0x75, 0x6e, 0x6c, 0x65, 0x73, 0x73, 0x20,
+  0x74, 0x68, 0x65, 0x79, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x6e,
+  0x20, 0x65, 0x6d, 0x62, 0x61, 0x73, 0x73, 0x79, 0x2e, 0x00, 0x03, 0x03,
+  0x0a, 0x00, 0xa5, 0x0f, 0x00, 0x81, 0x64, 0x65, 0x6d, 0x6f, 0x67, 0x72,
+  0x61, 0x70, 0x68, 0x79, 0x00, 0x57, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73,
+  0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x44, 0x65, 0x6d, 0x6f,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x73, 0x20, 0x72, 0x65, 0x70,
+  0x6f, 0x72, 0x74, 0x00, 0x54, 0x68, 0x69, 0x73, 0x20, 0x73, 0x68, 0x6f,
+  0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72,
+  0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61,
+  0x63, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+  0x6f, 0x66, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x73, 0x70, 0x65,
+  0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69,
+  0x6e, 0x63, 0x6c, 0x75, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20,
+  0x61, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x6e,
+  0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x44, 0x65, 0x6d, 0x6f, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x69, 0x63, 0x73, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74,
+  0x2e, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63,
+  0x74, 0x65, 0x72, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65,
+  0x69, 0x72, 0x20, 0x6d, 0x65, 0x61, 0x6e, 0x69, 0x6e, 0x67, 0x73, 0x20,
+  0x61, 0x72, 0x65, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x4e, 0x20, 0x3d,
+  0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x50, 0x6f, 0x70,
+  0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x50, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x00, 0x47, 0x65,
+  0x6e, 0x65, 0x74, 0x69, 0x63, 0x20, 0x45, 0x6e, 0x67, 0x69, 0x6e, 0x65,
+  0x65, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x61, 0x2e, 0x67, 0x65, 0x6e, 0x65,
+  0x74, 0x69, 0x63, 0x5f, 0x65, 0x6e, 0x67, 0x69, 0x6e, 0x65, 0x65, 0x72,
+  0x69, 0x6e, 0x67, 0x00, 0x00, 0x41, 0x00, 0x90, 0x89, 0x17, 0x1c, 0x01,
+  0x00, 0x00, 0x00, 0x1f, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x65, 0x90, 0x00, 0x00, 0x00,
+  0x0d, 0x47, 0x75, 0x6e, 0x70, 0x6f, 0x77, 0x64, 0x65, 0x72, 0x00, 0x47,
+  0x75, 0x6e, 0x70, 0x6f, 0x77, 0x64, 0x65, 0x72, 0x00, 0x61, 0x2e, 0x67,
+  0x75, 0x6e, 0x70, 0x6f, 0x77, 0x64, 0x65, 0x72, 0x00, 0x00, 0x45, 0x00,
+  0x90, 0x8d, 0x17, 0x1d, 0x00, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x00,
+  0x01, 0x48, 0x6f, 0x72, 0x73, 0x65, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x52,
+  0x69, 0x64, 0x69, 0x6e, 0x67, 0x00, 0x48, 0x6f, 0x72, 0x73, 0x65, 0x62,
+  0x61, 0x63, 0x6b, 0x20, 0x52, 0x69, 0x64, 0x69, 0x6e, 0x67, 0x00, 0x61,
+  0x2e, 0x68, 0x6f, 0x72, 0x73, 0x65, 0x62, 0x61, 0x63, 0x6b, 0x5f, 0x72,
+  0x69, 0x64, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x8c, 0x00, 0x90, 0x8d, 0x1f,
+  0x1e, 0x02, 0x01, 0x00, 0x00, 0x00, 0x33, 0x07, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x06, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0xcb, 0x20,
+  0x00, 0x00, 0x00, 0x1a, 0x49, 0x6e, 0x64, 0x75, 0x73, 0x74, 0x72, 0x69,
+  0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x49, 0x6e,
+  0x64, 0x75, 0x73, 0x74, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x00, 0x50, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x73, 0x74, 0x61, 0x72,
+  0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69,
+  0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x6f, 0x6c, 0x6c, 0x75, 0x74,
+  0x69, 0x6f, 0x6e, 0x2e, 0x03, 0x00, 0x61, 0x2e, 0x69, 0x6e, 0x64, 0x75,
+  0x73, 0x74, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x00, 0x00, 0x42, 0x00, 0x90, 0x89, 0x1f, 0x1f, 0x01, 0x00, 0x00,
+  0x00, 0x16, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x22, 0x07,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0xf0, 0x00, 0x00, 0x00, 0x0b, 0x49,
+  0x6e, 0x76, 0x65, 0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x49, 0x6e, 0x76,
+  0x65, 0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x61, 0x2e, 0x69, 0x6e,
+  0x76, 0x65, 0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x42, 0x00, 0x90,
+  0x8d, 0x17, 0x20, 0x01, 0x01, 0x00, 0x00, 0x00, 0x08, 0x07, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x0f, 0xa0, 0x00, 0x00, 0x00, 0x02, 0x49, 0x72, 0x6f,
+  0x6e, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x00, 0x49, 0x72,
+  0x6f, 0x6e, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x00, 0x61,
+  0x2e, 0x69, 0x72, 0x6f, 0x6e, 0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x69, 0x6e,
+  0x67, 0x00, 0x00, 0x48, 0x00, 0x90, 0x8d, 0x17, 0x21, 0x02, 0x01, 0x00,
+  0x00, 0x00, 0x26, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e,
+  0x07, 0x00, 0x01, 0x00, 0x00, 0x01, 0x40, 0x50, 0x00, 0x00, 0x00, 0x29,
+  0x4c, 0x61, 0x62, 0x6f, 0x72, 0x20, 0x55, 0x6e, 0x69, 0x6f, 0x6e, 0x00,
+  0x4c, 0x61, 0x62, 0x6f, 0x72, 0x20, 0x55, 0x6e, 0x69, 0x6f, 0x6e, 0x00,
+  0x61, 0x2e, 0x6c, 0x61, 0x62, 0x6f, 0x72, 0x5f, 0x75, 0x6e, 0x69, 0x6f,
+  0x6e, 0x00, 0x00, 0x3e, 0x00, 0x90, 0x89, 0x17, 0x22, 0x01, 0x00, 0x00,
+  0x00, 0x43, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x07,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x40, 0x00, 0x00, 0x00, 0x04, 0x4c,
+  0x69, 0x74, 0x65, 0x72, 0x61, 0x63, 0x79, 0x00, 0x4c, 0x69, 0x74, 0x65,
+  0x72, 0x61, 0x63, 0x79, 0x00, 0x61, 0x2e, 0x6c, 0x69, 0x74, 0x65, 0x72,
+  0x61, 0x63, 0x79, 0x00, 0x00, 0x41, 0x00, 0x90, 0x89, 0x17, 0x23, 0x01,
+  0x00, 0x00, 0x00, 0x2c, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x30, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4e, 0x20, 0x00, 0x00, 0x00,
+  0x0a, 0x4d, 0x61, 0x67, 0x6e, 0x65, 0x74, 0x69, 0x73, 0x6d, 0x00, 0x4d,
+  0x61, 0x67, 0x6e, 0x65, 0x74, 0x69, 0x73, 0x6d, 0x00, 0x61, 0x2e, 0x6d,
+  0x61, 0x67, 0x6e, 0x65, 0x74, 0x69, 0x73, 0x6d, 0x00, 0x00, 0x3c, 0x00,
+  0x90, 0x8d, 0x17, 0x24, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0f, 0xa0, 0x00, 0x00, 0x00, 0x02, 0x4d, 0x61,
+  0x70, 0x20, 0x4d, 0x61, 0x6b, 0x69, 0x6e, 0x67, 0x00, 0x4d, 0x61, 0x70,
+  0x20, 0x4d, 0x61, 0x6b, 0x69, 0x6e, 0x67, 0x00, 0x61, 0x2e, 0x6d, 0x61,
+  0x70, 0x5f, 0x6d, 0x61, 0x6b, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x2a, 0x00,
+  0x90, 0x8d, 0x17, 0x25, 0x00, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x00,
+  0x01, 0x4d, 0x61, 0x73, 0x6f, 0x6e, 0x72, 0x79, 0x00, 0x4d, 0x61, 0x73,
+  0x6f, 0x6e, 0x72, 0x79, 0x00, 0x61, 0x2e, 0x6d, 0x61, 0x73, 0x6f, 0x6e,
+  0x72, 0x79, 0x00, 0x00, 0x8b, 0x00, 0x90, 0x8d, 0x1f, 0x26, 0x02, 0x01,
+  0x00, 0x00, 0x00, 0x05, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x3d, 0x07, 0x00, 0x01, 0x00, 0x00, 0x01, 0x30, 0xb0, 0x00, 0x00, 0x00,
+  0x27, 0x4d, 0x61, 0x73, 0x73, 0x20, 0x50, 0x72, 0x6f, 0x64, 0x75, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x00, 0x4d, 0x61, 0x73, 0x73, 0x20, 0x50, 0x72,
+  0x6f, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x49, 0x6e, 0x63,
+  0x72, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+  0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x27, 0x73, 0x20,
+  0x63, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x74, 0x6f, 0x20, 0x70, 0x6f, 0x6c, 0x6c, 0x75, 0x74, 0x69, 0x6f,
+  0x6e, 0x2e, 0x03, 0x00, 0x61, 0x2e, 0x6d, 0x61, 0x73, 0x73, 0x5f, 0x70,
+  0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x48,
+  0x00, 0x90, 0x89, 0x1f, 0x27, 0x01, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x07, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x17, 0x70, 0x00, 0x00, 0x00, 0x03, 0x4d, 0x61, 0x74, 0x68, 0x65,
+  0x6d, 0x61, 0x74, 0x69, 0x63, 0x73, 0x00, 0x4d, 0x61, 0x74, 0x68, 0x65,
+  0x6d, 0x61, 0x74, 0x69, 0x63, 0x73, 0x00, 0x00, 0x61, 0x2e, 0x6d, 0x61,
+  0x74, 0x68, 0x65, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x73, 0x00, 0x00, 0x86,
+  0x00, 0x90, 0x89, 0x1f, 0x28, 0x01, 0x00, 0x00, 0x00, 0x2f, 0x07, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x41, 0x07, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x55, 0xf0, 0x00, 0x00, 0x00, 0x0b, 0x4d, 0x65, 0x64, 0x69, 0x63,
+  0x69, 0x6e, 0x65, 0x00, 0x4d, 0x65, 0x64, 0x69, 0x63, 0x69, 0x6e, 0x65,
+  0x00, 0x45, 0x6c, 0x69, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x73, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x72, 0x69, 0x73, 0x6b, 0x20, 0x6f, 0x66, 0x20,
+  0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c,
+  0x6f, 0x73, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x70, 0x6c, 0x61,
+  0x67, 0x75, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x79,
+  0x6f, 0x75, 0x72, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x2e, 0x03,
+  0x00, 0x61, 0x2e, 0x6d, 0x65, 0x64, 0x69, 0x63, 0x69, 0x6e, 0x65, 0x00,
+  0x00, 0x45, 0x00, 0x90, 0x89, 0x1f, 0x29, 0x01, 0x00, 0x00, 0x00, 0x1c,
+  0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x42, 0x07, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x94, 0x70, 0x00, 0x00, 0x00, 0x13, 0x4d, 0x65, 0x74,
+  0x61, 0x6c, 0x6c, 0x75, 0x72, 0x67, 0x79, 0x00, 0x4d, 0x65, 0x74, 0x61,
+  0x6c, 0x6c, 0x75, 0x72, 0x67, 0x79, 0x00, 0x00, 0x61, 0x2e, 0x6d, 0x65,
+  0x74, 0x61, 0x6c, 0x6c, 0x75, 0x72, 0x67, 0x79, 0x00, 0x00, 0x3e, 0x00,
+  0x90, 0x89, 0x17, 0x2a, 0x01, 0x00, 0x00, 0x00, 0x09, 0x07, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x1f, 0x40, 0x00, 0x00, 0x00, 0x04, 0x4d, 0x6f, 0x6e, 0x61, 0x72, 0x63,
+  0x68, 0x79, 0x00, 0x4d, 0x6f, 0x6e, 0x61, 0x72, 0x63, 0x68, 0x79, 0x00,
+  0x61, 0x2e, 0x6d, 0x6f, 0x6e, 0x61, 0x72, 0x63, 0x68, 0x79, 0x00, 0x00,
+  0x5a, 0x00, 0x90, 0x8d, 0x1f, 0x2b, 0x01, 0x01, 0x00, 0x00, 0x00, 0x09,
+  0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0xa0, 0x00, 0x00, 0x00, 0x02,
+  0x4d, 0x79, 0x73, 0x74, 0x69, 0x63, 0x69, 0x73, 0x6d, 0x00, 0x4d, 0x79,
+  0x73, 0x74, 0x69, 0x63, 0x69, 0x73, 0x6d, 0x00, 0x49, 0x6d, 0x70, 0x72,
+  0x6f, 0x76, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x66, 0x66,
+  0x65, 0x63, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x54, 0x65, 0x6d, 0x70, 0x6c,
+  0x65, 0x73, 0x2e, 0x03, 0x00, 0x61, 0x2e, 0x6d, 0x79, 0x73, 0x74, 0x69,
+  0x63, 0x69, 0x73, 0x6d, 0x00, 0x00, 0x46, 0x00, 0x90, 0x8d, 0x1f, 0x2c,
+  0x02, 0x01, 0x00, 0x00, 0x00, 0x24, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x03, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3e, 0x80, 0x00,
+  0x00, 0x00, 0x08, 0x4e, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x00, 0x4e, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x00, 0x00, 0x61, 0x2e, 0x6e, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x00, 0x00, 0x53, 0x00, 0x90, 0x89, 0x17, 0x2d, 0x01, 0x00,
+  0x00, 0x00, 0x26, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04,
+  0x07, 0x00, 0x01, 0x00, 0x00, 0x01, 0x48, 0x20, 0x00, 0x00, 0x00, 0x2a,
+  0x4e, 0x75, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20, 0x46, 0x69, 0x73, 0x73,
+  0x69, 0x6f, 0x6e, 0x00, 0x4e, 0x75, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20,
+  0x46, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x61, 0x2e, 0x6e, 0x75,
+  0x63, 0x6c, 0x65, 0x61, 0x72, 0x5f, 0x66, 0x69, 0x73, 0x73, 0x69, 0x6f,
+  0x6e, 0x00, 0x00, 0x4d, 0x00, 0x90, 0x89, 0x17, 0x2e, 0x01, 0x00, 0x00,
+  0x00, 0x2d, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x07,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x67, 0x60, 0x00, 0x00, 0x00, 0x2e, 0x4e,
+  0x75, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20, 0x50, 0x6f, 0x77, 0x65, 0x72,
+  0x00, 0x4e, 0x75, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20, 0x50, 0x6f, 0x77,
+  0x65, 0x72, 0x00, 0x61, 0x2e, 0x6e, 0x75, 0x63, 0x6c, 0x65, 0x61, 0x72,
+  0x5f, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x00, 0x00, 0x44, 0x00, 0x90, 0x89,
+  0x17, 0x2f, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x07, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x22, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x36, 0xb0,
+  0x00, 0x00, 0x00, 0x07, 0x50, 0x68, 0x69, 0x6c, 0x6f, 0x73, 0x6f, 0x70,
+  0x68, 0x79, 0x00, 0x50, 0x68, 0x69, 0x6c, 0x6f, 0x73, 0x6f, 0x70, 0x68,
+  0x79, 0x00, 0x61, 0x2e, 0x70, 0x68, 0x69, 0x6c, 0x6f, 0x73, 0x6f, 0x70,
+  0x68, 0x79, 0x00, 0x00, 0x3b, 0x00, 0x90, 0x89, 0x17, 0x30, 0x01, 0x00,
+  0x00, 0x00, 0x27, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c,
+  0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x46, 0x50, 0x00, 0x00, 0x00, 0x09,
+  0x50, 0x68, 0x79, 0x73, 0x69, 0x63, 0x73, 0x00, 0x50, 0x68, 0x79, 0x73,
+  0x69, 0x63, 0x73, 0x00, 0x61, 0x2e, 0x70, 0x68, 0x79, 0x73, 0x69, 0x63,
+  0x73, 0x00, 0x00, 0x75, 0x00, 0x90, 0x89, 0x1f, 0x31, 0x01, 0x00, 0x00,
+  0x00, 0x35, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x39, 0x07,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x90, 0x00, 0x00, 0x00, 0x2d, 0x50,
+  0x6c, 0x61, 0x73, 0x74, 0x69, 0x63, 0x73, 0x00, 0x50, 0x6c, 0x61, 0x73,
+  0x74, 0x69, 0x63, 0x73, 0x00, 0x49, 0x6e, 0x63, 0x72, 0x65, 0x61, 0x73,
+  0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x70, 0x75, 0x6c,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x27, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20,
+  0x70, 0x6f, 0x6c, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x03, 0x00,
+  0x61, 0x2e, 0x70, 0x6c, 0x61, 0x73, 0x74, 0x69, 0x63, 0x73, 0x00, 0x00,
+  0x2b, 0x00, 0x90, 0x8d, 0x1f, 0x32, 0x00, 0x00, 0x00, 0x07, 0xd0, 0x00,
+  0x00, 0x00, 0x01, 0x50, 0x6f, 0x74, 0x74, 0x65, 0x72, 0x79, 0x00, 0x50,
+  0x6f, 0x74, 0x74, 0x65, 0x72, 0x79, 0x00, 0x00, 0x61, 0x2e, 0x70, 0x6f,
+  0x74, 0x74, 0x65, 0x72, 0x79, 0x00, 0x00, 0xa7, 0x00, 0x90, 0x8d, 0x1f,
+  0x33, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3a, 0x07, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0xab, 0xe0,
+  0x00, 0x00, 0x00, 0x16, 0x3f, 0x74, 0x65, 0x63, 0x68, 0x3a, 0x52, 0x61,
+  0x69, 0x6c, 0x72, 0x6f, 0x61, 0x64, 0x00, 0x52, 0x61, 0x69, 0x6c, 0x72,
+  0x6f, 0x61, 0x64, 0x00, 0x41, 0x6c, 0x6c, 0x6f, 0x77, 0x73, 0x20, 0x53,
+  0x65, 0x74, 0x74, 0x6c, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x75,
+  0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x20, 0x72, 0x6f, 0x61, 0x64, 0x73,
+  0x20, 0x74, 0x6f, 0x20, 0x72, 0x61, 0x69, 0x6c, 0x72, 0x6f, 0x61, 0x64,
+  0x73, 0x2e, 0x03, 0x44, 0x65, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x73,
+  0x20, 0x6f, 0x6e, 0x65, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x72, 0x65,
+  0x76, 0x65, 0x6e, 0x75, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x6e,
+  0x65, 0x77, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x72, 0x6f, 0x75,
+  0x74, 0x65, 0x73, 0x2e, 0x03, 0x00, 0x61, 0x2e, 0x72, 0x61, 0x69, 0x6c,
+  0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x0a, 0x69, 0x00, 0x08,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x0a, 0x6a, 0x00, 0x08,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f,
+  0xef, 0x01, 0x00, 0x00, 0x0a, 0x6b, 0x00, 0x08, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x03, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x0a, 0x6c, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a,
+  0x6d, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x6e, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x0a, 0x6f, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x70, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x0a, 0x71, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x72,
+  0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x73, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x0a, 0x74, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x75, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x0a, 0x76, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x77, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x0a, 0x78, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a,
+  0x79, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x7a, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x0a, 0x7b, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x7c, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x0a, 0x7d, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x7e,
+  0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x7f, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x0a, 0x80, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x81, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x0a, 0x82, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x0a, 0x83, 0x00,
+  0x0a, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x0a, 0x84, 0x00, 0x0a, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x08, 0x80, 0xff, 0x00, 0x23, 0x00, 0x0f, 0xcf, 0x01, 0x00,
+  0x00, 0x0a, 0x85, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x1b, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x0a, 0x86, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x87, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x0a, 0x88, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x89, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x0a, 0x8a, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a,
+  0x8b, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x8c, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x0a, 0x8d, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x8e, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x0a, 0x8f, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x90,
+  0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x91, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x0a, 0x92, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x93, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x0a, 0x94, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x95, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x0a, 0x96, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a,
+  0x97, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x98, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x0a, 0x99, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x23, 0x00, 0x0f, 0xcf, 0x01, 0x00, 0x00, 0x0a, 0x9a, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x9b, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x0a, 0x9c, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0x9d, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x23, 0x00, 0x0f,
+  0xcf, 0x01, 0x00, 0x00, 0x0a, 0x9e, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x0f, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef,
+  0x01, 0x00, 0x00, 0x0a, 0x9f, 0x00, 0x08, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x08, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f,
+  0x01, 0x00, 0x00, 0x0a, 0xa0, 0x00, 0x08, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x0a,
+  0xa1, 0x00, 0x08, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00,
+  0x23, 0x00, 0x0f, 0xcf, 0x01, 0x00, 0x00, 0x0a, 0xa2, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xa3, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x0a, 0xa4, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xa5, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x0a, 0xa6, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xa7,
+  0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xa8, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x0a, 0xa9, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xaa, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x0a, 0xab, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xac, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x0a, 0xad, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a,
+  0xae, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xaf, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x0a, 0xb0, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xb1, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x0a, 0xb2, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xb3,
+  0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xb4, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x0a, 0xb5, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xb6, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x0a, 0xb7, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x23, 0x00, 0x0f, 0xcf, 0x01, 0x00, 0x00, 0x0a, 0xb8, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x0a, 0xb9, 0x00, 0x0a,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f,
+  0x6f, 0x01, 0x00, 0x00, 0x0a, 0xba, 0x00, 0x0a, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x05, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x0a, 0xbb, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xbc, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x0a, 0xbd, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xbe, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x0a, 0xbf, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a,
+  0xc0, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xc1, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x0a, 0xc2, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xc3, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x0a, 0xc4, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xc5,
+  0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xc6, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x0a, 0xc7, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xc8, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x0a, 0xc9, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x0a, 0xca, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01,
+  0x00, 0x00, 0x06, 0xb1, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06,
+  0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x06, 0xb2, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xb3, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x06, 0xb4, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06,
+  0xb5, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xb6, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x06, 0xb7, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xb8, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x06, 0xb9, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xba,
+  0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x23, 0x00,
+  0x0f, 0xcf, 0x01, 0x00, 0x00, 0x06, 0xbb, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x06, 0xbc, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06,
+  0xbd, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x14,
+  0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x06, 0xbe, 0x00, 0x06, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x06, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01,
+  0x00, 0x00, 0x06, 0xbf, 0x00, 0x06, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03,
+  0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01,
+  0x00, 0x00, 0x06, 0xc0, 0x00, 0x06, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03,
+  0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x06, 0xc1, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xc2, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x06, 0xc3, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06,
+  0xc4, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xc5, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x06, 0xc6, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xc7, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f,
+  0x01, 0x00, 0x00, 0x06, 0xc8, 0x00, 0x07, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x02, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x06,
+  0xc9, 0x00, 0x07, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x1e, 0x00, 0x00,
+  0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x06,
+  0xca, 0x00, 0x07, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x80, 0xff, 0x00,
+  0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x06, 0xcb, 0x00, 0x07, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x05, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f,
+  0x01, 0x00, 0x00, 0x06, 0xcc, 0x00, 0x07, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x03, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x06,
+  0xcd, 0x00, 0x07, 0x02, 0x00, 0xff, 0x00, 0xff, 0x09, 0x15, 0x08, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06,
+  0xce, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xcf, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x06, 0xd0, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xd1, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x06, 0xd2, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x80, 0xff, 0x00, 0x23, 0x00, 0x0f, 0xcf, 0x01, 0x00, 0x00, 0x06, 0xd3,
+  0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x06, 0xd4, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x09, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x06, 0xd5, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x06, 0xd6, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x06, 0xd7, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x09, 0x80, 0xff, 0x00, 0x23, 0x00,
+  0x0f, 0xcf, 0x01, 0x00, 0x00, 0x06, 0xd8, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x0f, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x06, 0xd9, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06,
+  0xda, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xdb, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x06, 0xdc, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x06, 0xdd, 0x00, 0x03,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f,
+  0x6f, 0x01, 0x00, 0x00, 0x06, 0xde, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x04, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x06, 0xdf, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xe0, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01,
+  0x00, 0x00, 0x06, 0xe1, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x09,
+  0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x06, 0xe2,
+  0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x19, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x06, 0xe3,
+  0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x24,
+  0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x06, 0xe4, 0x00, 0x03, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x03, 0x16, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14,
+  0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x06, 0xe5, 0x00, 0x03, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x08, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01,
+  0x00, 0x00, 0x06, 0xe6, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x09,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xe7,
+  0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xe8, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x06, 0xe9, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xea, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x06, 0xeb, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xec, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x06, 0xed, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06,
+  0xee, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xef, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x23, 0x00, 0x0f, 0xcf, 0x01, 0x00,
+  0x00, 0x06, 0xf0, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0f, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x06, 0xf1, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xf2, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01,
+  0x00, 0x00, 0x06, 0xf3, 0x00, 0x06, 0x02, 0x00, 0xff, 0x00, 0xff, 0x08,
+  0x12, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01,
+  0x00, 0x00, 0x06, 0xf4, 0x00, 0x06, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03,
+  0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01,
+  0x00, 0x00, 0x06, 0xf5, 0x00, 0x06, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05,
+  0x1c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01,
+  0x00, 0x00, 0x06, 0xf6, 0x00, 0x06, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xf7,
+  0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xf8, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x06, 0xf9, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xfa, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x06, 0xfb, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x06, 0xfc, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x06, 0xfd, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x06,
+  0xfe, 0x00, 0x07, 0x02, 0x00, 0xff, 0x00, 0xff, 0x09, 0x80, 0xff, 0x00,
+  0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x06, 0xff, 0x00, 0x07, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f,
+  0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x05, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07,
+  0x01, 0x00, 0x07, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05, 0x80, 0xff, 0x00,
+  0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x07, 0x02, 0x00, 0x07, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+  0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0x03, 0x00, 0x07, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x09, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x07, 0x04, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x07, 0x05,
+  0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x07, 0x06, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x07, 0x07, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x07, 0x08, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x07, 0x09, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x07, 0x0a, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x23, 0x00, 0x0f,
+  0xcf, 0x01, 0x00, 0x00, 0x07, 0x0b, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0x5f, 0x31, 0x32, 0x00, 0x00, 0x17, 0x00, 0xe6, 0x03, 0x19, 0x55, 0x43,
+  0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x5f,
+  0x31, 0x33, 0x00, 0x00, 0x17, 0x00, 0xe6, 0x03, 0x1a, 0x55, 0x43, 0x46,
+  0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x31,
+  0x34, 0x00, 0x00, 0x17, 0x00, 0xe6, 0x03, 0x1b, 0x55, 0x43, 0x46, 0x5f,
+  0x55, 0x53, 0x45, 0x52, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x31, 0x35,
+  0x00, 0x00, 0x26, 0x00, 0x98, 0x66, 0x3f, 0x75, 0x6e, 0x69, 0x74, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x3a, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65,
+  0x00, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x64, 0x20,
+  0x49, 0x08, 0x00, 0x00, 0x23, 0x00, 0x98, 0x4f, 0x01, 0x3f, 0x75, 0x6e,
+  0x69, 0x74, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3a, 0x4c, 0x61, 0x6e, 0x64,
+  0x00, 0x4c, 0x61, 0x6e, 0x64, 0x00, 0x00, 0x00, 0x00, 0x06, 0xdf, 0x30,
+  0x31, 0x00, 0x00, 0x2b, 0x00, 0x98, 0x47, 0x02, 0x3f, 0x75, 0x6e, 0x69,
+  0x74, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3a, 0x53, 0x6d, 0x61, 0x6c, 0x6c,
+  0x20, 0x4c, 0x61, 0x6e, 0x64, 0x00, 0x53, 0x6d, 0x61, 0x6c, 0x6c, 0x20,
+  0x4c, 0x61, 0x6e, 0x64, 0x00, 0xd7, 0x31, 0x02, 0x00, 0x00, 0x27, 0x00,
+  0x98, 0x47, 0x03, 0x3f, 0x75, 0x6e, 0x69, 0x74, 0x63, 0x6c, 0x61, 0x73,
+  0x73, 0x3a, 0x42, 0x69, 0x67, 0x20, 0x4c, 0x61, 0x6e, 0x64, 0x00, 0x42,
+  0x69, 0x67, 0x20, 0x4c, 0x61, 0x6e, 0x64, 0x00, 0xdd, 0x54, 0x20, 0x00,
+  0x00, 0x27, 0x00, 0x98, 0x47, 0x04, 0x3f, 0x75, 0x6e, 0x69, 0x74, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x3a, 0x4d, 0x65, 0x72, 0x63, 0x68, 0x61, 0x6e,
+  0x74, 0x00, 0x4d, 0x65, 0x72, 0x63, 0x68, 0x61, 0x6e, 0x74, 0x00, 0x93,
+  0x51, 0x02, 0x00, 0x00, 0x23, 0x00, 0x98, 0x6f, 0x05, 0x3f, 0x75, 0x6e,
+  0x69, 0x74, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3a, 0x53, 0x65, 0x61, 0x00,
+  0x53, 0x65, 0x61, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x19, 0x04, 0x82,
+  0x04, 0x00, 0x00, 0x25, 0x00, 0x98, 0x47, 0x06, 0x3f, 0x75, 0x6e, 0x69,
+  0x74, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3a, 0x54, 0x72, 0x69, 0x72, 0x65,
+  0x6d, 0x65, 0x00, 0x54, 0x72, 0x69, 0x72, 0x65, 0x6d, 0x65, 0x00, 0x84,
+  0x40, 0x04, 0x00, 0x00, 0x32, 0x00, 0x98, 0x7f, 0x07, 0x3f, 0x75, 0x6e,
+  0x69, 0x74, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3a, 0x48, 0x65, 0x6c, 0x69,
+  0x63, 0x6f, 0x70, 0x74, 0x65, 0x72, 0x00, 0x48, 0x65, 0x6c, 0x69, 0x63,
+  0x6f, 0x70, 0x74, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x00,
+  0x64, 0x68, 0x41, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x98, 0x47, 0x08, 0x3f,
+  0x75, 0x6e, 0x69, 0x74, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3a, 0x41, 0x69,
+  0x72, 0x00, 0x41, 0x69, 0x72, 0x00, 0x20, 0x49, 0x10, 0x00, 0x00, 0x2f,
+  0x00, 0xe5, 0x07, 0x1e, 0x46, 0x6f, 0x72, 0x74, 0x72, 0x65, 0x73, 0x73,
+  0x00, 0x43, 0x61, 0x6e, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x46,
+  0x6f, 0x72, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x46, 0x6f, 0x72,
+  0x74, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x2e, 0x00, 0x00, 0x11, 0x00,
+  0xe5, 0x07, 0x1f, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d,
+  0x00, 0x00, 0x00, 0x2f, 0x00, 0xe5, 0x07, 0x20, 0x41, 0x69, 0x72, 0x41,
+  0x74, 0x74, 0x61, 0x63, 0x6b, 0x65, 0x72, 0x00, 0x56, 0x65, 0x72, 0x79,
+  0x20, 0x62, 0x61, 0x64, 0x20, 0x61, 0x74, 0x20, 0x61, 0x74, 0x74, 0x61,
+  0x63, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x41, 0x45, 0x47, 0x49, 0x53, 0x2e,
+  0x00, 0x00, 0x3e, 0x00, 0xe5, 0x07, 0x21, 0x53, 0x75, 0x62, 0x6d, 0x61,
+  0x72, 0x69, 0x6e, 0x65, 0x00, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x20,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x68, 0x61, 0x6c, 0x76, 0x65, 0x64,
+  0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6b,
+  0x69, 0x6e, 0x67, 0x20, 0x44, 0x65, 0x73, 0x74, 0x72, 0x6f, 0x79, 0x65,
+  0x72, 0x2e, 0x00, 0x00, 0x5f, 0x00, 0xe5, 0x07, 0x22, 0x53, 0x75, 0x70,
+  0x70, 0x6c, 0x79, 0x4c, 0x69, 0x6e, 0x65, 0x73, 0x00, 0x43, 0x61, 0x6e,
+  0x20, 0x73, 0x6c, 0x6f, 0x77, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x20, 0x28,
+  0x74, 0x61, 0x6b, 0x65, 0x20, 0x31, 0x20, 0x4d, 0x50, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x29, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x6e, 0x65, 0x6d, 0x79,
+  0x20, 0x75, 0x6e, 0x69, 0x74, 0x20, 0x62, 0x79, 0x20, 0x64, 0x69, 0x73,
+  0x72, 0x75, 0x70, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x74, 0x73, 0x20,
+  0x73, 0x75, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x73,
+  0x2e, 0x00, 0x00, 0x40, 0x00, 0xe5, 0x07, 0x23, 0x43, 0x6f, 0x6e, 0x73,
+  0x65, 0x6e, 0x73, 0x75, 0x73, 0x00, 0x55, 0x6e, 0x64, 0x69, 0x73, 0x62,
+  0x61, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6e,
+  0x20, 0x79, 0x6f, 0x75, 0x72, 0x20, 0x62, 0x75, 0x72, 0x65, 0x61, 0x75,
+  0x63, 0x72, 0x61, 0x63, 0x79, 0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x20,
+  0x76, 0x65, 0x74, 0x6f, 0x2e, 0x00, 0x00, 0x12, 0x00, 0xe5, 0x07, 0x24,
+  0x46, 0x6c, 0x65, 0x73, 0x68, 0x42, 0x61, 0x73, 0x65, 0x64, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0xe5, 0x03, 0x25, 0x49, 0x72, 0x6f, 0x6e, 0x42, 0x61,
+  0x73, 0x65, 0x64, 0x00, 0x00, 0x11, 0x00, 0xe5, 0x03, 0x26, 0x55, 0x6e,
+  0x62, 0x72, 0x69, 0x62, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x4a, 0x00,
+  0xe5, 0x07, 0x27, 0x54, 0x72, 0x61, 0x64, 0x65, 0x52, 0x6f, 0x75, 0x74,
+  0x65, 0x00, 0x43, 0x61, 0x6e, 0x20, 0x65, 0x73, 0x74, 0x61, 0x62, 0x6c,
+  0x69, 0x73, 0x68, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x72, 0x6f,
+  0x75, 0x74, 0x65, 0x73, 0x20, 0x28, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x74,
+  0x72, 0x61, 0x76, 0x65, 0x6c, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x61, 0x72,
+  0x67, 0x65, 0x74, 0x20, 0x63, 0x69, 0x74, 0x79, 0x29, 0x2e, 0x00, 0x00,
+  0x12, 0x00, 0xe5, 0x07, 0x28, 0x48, 0x65, 0x6c, 0x70, 0x57, 0x6f, 0x6e,
+  0x64, 0x65, 0x72, 0x00, 0x00, 0x00, 0x2d, 0x00, 0xe5, 0x07, 0x29, 0x43,
+  0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x72, 0x00, 0x43, 0x61, 0x6e, 0x20,
+  0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x20, 0x73, 0x6f, 0x6d, 0x65,
+  0x20, 0x65, 0x6e, 0x65, 0x6d, 0x79, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73,
+  0x2e, 0x00, 0x00, 0x36, 0x00, 0xe5, 0x07, 0x2a, 0x43, 0x61, 0x70, 0x74,
+  0x75, 0x72, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x43, 0x61, 0x6e, 0x20, 0x62,
+  0x65, 0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x64, 0x20, 0x62,
+  0x79, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x65, 0x6e, 0x65, 0x6d, 0x79,
+  0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x2e, 0x00, 0x00, 0x11, 0x00, 0xe5,
+  0x07, 0x2b, 0x42, 0x6f, 0x6d, 0x62, 0x61, 0x72, 0x64, 0x65, 0x72, 0x00,
+  0x00, 0x00, 0x0d, 0x00, 0xe5, 0x03, 0x2c, 0x43, 0x69, 0x74, 0x69, 0x65,
+  0x73, 0x00, 0x00, 0x10, 0x00, 0xe5, 0x03, 0x2d, 0x41, 0x64, 0x64, 0x54,
+  0x6f, 0x43, 0x69, 0x74, 0x79, 0x00, 0x00, 0x0e, 0x00, 0xe5, 0x03, 0x2e,
+  0x4e, 0x75, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x00, 0x00, 0x10, 0x00, 0xe5,
+  0x03, 0x2f, 0x4e, 0x75, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x4f, 0x50, 0x00,
+  0x00, 0x13, 0x00, 0xe5, 0x03, 0x30, 0x54, 0x61, 0x63, 0x74, 0x69, 0x63,
+  0x61, 0x6c, 0x4e, 0x75, 0x6b, 0x65, 0x00, 0x00, 0x4d, 0x00, 0xe5, 0x07,
+  0x31, 0x50, 0x61, 0x72, 0x61, 0x74, 0x72, 0x6f, 0x6f, 0x70, 0x65, 0x72,
+  0x73, 0x00, 0x43, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x70, 0x61, 0x72,
+  0x61, 0x64, 0x72, 0x6f, 0x70, 0x70, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x20, 0x61, 0x20, 0x66, 0x72, 0x69, 0x65, 0x6e, 0x64, 0x6c, 0x79,
+  0x20, 0x63, 0x69, 0x74, 0x79, 0x20, 0x6f, 0x72, 0x20, 0x73, 0x75, 0x69,
+  0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x62, 0x61, 0x73, 0x65, 0x2e, 0x00,
+  0x00, 0x37, 0x00, 0xe5, 0x07, 0x32, 0x4d, 0x61, 0x72, 0x69, 0x6e, 0x65,
+  0x73, 0x00, 0x43, 0x61, 0x6e, 0x20, 0x6c, 0x61, 0x75, 0x6e, 0x63, 0x68,
+  0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+  0x74, 0x69, 0x6c, 0x65, 0x73, 0x2e, 0x00, 0x00, 0x14, 0x00, 0xe5, 0x07,
+  0x33, 0x43, 0x61, 0x6e, 0x74, 0x5f, 0x46, 0x6f, 0x72, 0x74, 0x69, 0x66,
+  0x79, 0x00, 0x00, 0x00, 0x10, 0x00, 0xe5, 0x03, 0x34, 0x4f, 0x6e, 0x65,
+  0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x35, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x32, 0x34, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x36, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x32, 0x35, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x37, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x32, 0x36, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x38, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x32, 0x37, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x39, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x32, 0x38, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x3a, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x32, 0x39, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x3b, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x33, 0x30, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x3c, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x33, 0x31, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x3d, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x33, 0x32, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x3e, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x33, 0x33, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x3f, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x33, 0x34, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x40, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x33, 0x35, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x41, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x33, 0x36, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x42, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x33, 0x37, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x43, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x33, 0x38, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x44, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x33, 0x39, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x45, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x34, 0x30, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x46, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x34, 0x31, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x47, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x34, 0x32, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x48, 0x55, 0x54, 0x59, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46,
+  0x4c, 0x41, 0x47, 0x5f, 0x34, 0x33, 0x00, 0x00, 0x18, 0x00, 0xe5, 0x03,
+  0x00, 0x08, 0x00, 0xaa, 0x01, 0x00, 0x00, 0x72, 0x00, 0x52, 0x00, 0x33,
+  0x04, 0x00, 0x16, 0x00, 0x31, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00,
+  0x00, 0x37, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00,
+  0x00, 0x00, 0x02, 0xf2, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x3b, 0x2c, 0x00,
+  0x00, 0x08, 0x03, 0x02, 0x00, 0x10, 0x00, 0x14, 0x00, 0x0f, 0x00, 0x3f,
+  0x00, 0x08, 0x20, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0x14, 0x00, 0x3f, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00,
+  0x0d, 0xa7, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x3f, 0x00,
+  0x00, 0x40, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x04,
+  0x00, 0x00, 0x00, 0x0b, 0x43, 0x00, 0x03, 0x00, 0x14, 0x00, 0x3f, 0x0c,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x0b, 0xab, 0x01, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x53, 0x00, 0x33, 0x44, 0x00, 0x74, 0x00, 0x31,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x32, 0x28, 0x3c, 0xcf, 0x01,
+  0x00, 0x00, 0xcf, 0x01, 0x00, 0x00, 0xcf, 0x01, 0x00, 0x00, 0xcf, 0x01,
+  0x00, 0x00, 0xd0, 0x01, 0x00, 0x00, 0xd1, 0x01, 0x00, 0x00, 0xd1, 0x01,
+  0x00, 0x00, 0xd1, 0x01, 0x00, 0x00, 0xd1, 0x01, 0x00, 0x00, 0xd2, 0x01,
+  0x00, 0x00, 0xd2, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x35, 0x07,
+  0x00, 0x01, 0x00, 0x4d, 0x6f, 0x6e, 0x61, 0x72, 0x63, 0x68, 0x79, 0x00,
+  0x4d, 0x6f, 0x6e, 0x61, 0x72, 0x63, 0x68, 0x79, 0x00, 0x67, 0x6f, 0x76,
+  0x2e, 0x6d, 0x6f, 0x6e, 0x61, 0x72, 0x63, 0x68, 0x79, 0x00, 0x55, 0x6e,
+  0x64, 0x65, 0x72, 0x20, 0x4d, 0x6f, 0x6e, 0x61, 0x72, 0x63, 0x68, 0x79,
+  0x2c, 0x20, 0x61, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x72, 0x20,
+  0x71, 0x75, 0x65, 0x65, 0x6e, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x73,
+  0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x68, 0x65, 0x72, 0x65, 0x64, 0x69,
+  0x74, 0x61, 0x72, 0x79, 0x20, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x68,
+  0x65, 0x61, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x79, 0x6f, 0x75, 0x72,
+  0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
+  0x03, 0x4d, 0x6f, 0x6e, 0x61, 0x72, 0x63, 0x68, 0x79, 0x20, 0x67, 0x69,
+  0x76, 0x65, 0x73, 0x20, 0x6c, 0x6f, 0x77, 0x20, 0x75, 0x6e, 0x69, 0x74,
+  0x20, 0x75, 0x70, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x63, 0x6f, 0x73, 0x74,
+  0x73, 0x2e, 0x03, 0x2a, 0x20, 0x59, 0x6f, 0x75, 0x72, 0x20, 0x63, 0x65,
+  0x6e, 0x74, 0x65, 0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x67, 0x6f, 0x76,
+  0x65, 0x72, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x28, 0x63, 0x69, 0x74,
+  0x69, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x50, 0x61, 0x6c,
+  0x61, 0x63, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x45, 0x63, 0x63, 0x6c,
+  0x65, 0x73, 0x69, 0x61, 0x73, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x50,
+  0x61, 0x6c, 0x61, 0x63, 0x65, 0x29, 0x20, 0x67, 0x65, 0x74, 0x20, 0x61,
+  0x20, 0x2b, 0x35, 0x30, 0x25, 0x20, 0x62, 0x6f, 0x6e, 0x75, 0x73, 0x20,
+  0x74, 0x6f, 0x20, 0x67, 0x6f, 0x6c, 0x64, 0x20, 0x70, 0x72, 0x6f, 0x64,
+  0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x2a, 0x20, 0x43, 0x65,
+  0x6c, 0x65, 0x62, 0x72, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x69,
+  0x74, 0x69, 0x65, 0x73, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x65,
+  0x20, 0x6f, 0x6e, 0x65, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x74,
+  0x72, 0x61, 0x64, 0x65, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x74, 0x69, 0x6c,
+  0x65, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x61,
+  0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75,
+  0x63, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x2e, 0x20,
+  0x28, 0x43, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x62, 0x65, 0x6c, 0x6f,
+  0x77, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x33, 0x20, 0x77, 0x69, 0x6c,
+  0x6c, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x63, 0x65, 0x6c, 0x65, 0x62, 0x72,
+  0x61, 0x74, 0x65, 0x2e, 0x29, 0x0a, 0x2a, 0x20, 0x45, 0x61, 0x63, 0x68,
+  0x20, 0x63, 0x69, 0x74, 0x79, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x73, 0x75,
+  0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6f, 0x20,
+  0x33, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x66, 0x72, 0x65, 0x65, 0x20, 0x28, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61,
+  0x78, 0x69, 0x6d, 0x75, 0x6d, 0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62,
+  0x6c, 0x65, 0x29, 0x3b, 0x20, 0x66, 0x75, 0x72, 0x74, 0x68, 0x65, 0x72,
+  0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+  0x63, 0x6f, 0x73, 0x74, 0x20, 0x31, 0x20, 0x67, 0x6f, 0x6c, 0x64, 0x20,
+  0x70, 0x65, 0x72, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x2e, 0x0a, 0x2a, 0x20,
+  0x45, 0x61, 0x63, 0x68, 0x20, 0x63, 0x69, 0x74, 0x79, 0x20, 0x74, 0x6f,
+  0x6c, 0x65, 0x72, 0x61, 0x74, 0x65, 0x73, 0x20, 0x75, 0x70, 0x20, 0x74,
+  0x6f, 0x20, 0x33, 0x20, 0x61, 0x67, 0x67, 0x72, 0x65, 0x73, 0x73, 0x69,
+  0x76, 0x65, 0x6c, 0x79, 0x20, 0x64, 0x65, 0x70, 0x6c, 0x6f, 0x79, 0x65,
+  0x64, 0x20, 0x6d, 0x69, 0x6c, 0x69, 0x74, 0x61, 0x72, 0x79, 0x20, 0x75,
+  0x6e, 0x69, 0x74, 0x73, 0x3b, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x66,
+  0x75, 0x72, 0x74, 0x68, 0x65, 0x72, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x20,
+  0x63, 0x61, 0x75, 0x73, 0x65, 0x73, 0x20, 0x31, 0x20, 0x75, 0x6e, 0x68,
+  0x61, 0x70, 0x70, 0x79, 0x20, 0x63, 0x69, 0x74, 0x69, 0x7a, 0x65, 0x6e,
+  0x2e, 0x0a, 0x2a, 0x20, 0x4d, 0x69, 0x6c, 0x69, 0x74, 0x61, 0x72, 0x79,
+  0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x69, 0x6d, 0x70, 0x6f, 0x73,
+  0x65, 0x20, 0x6d, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6c, 0x20, 0x6c, 0x61,
+  0x77, 0x2e, 0x20, 0x55, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x33, 0x20, 0x6d,
+  0x69, 0x6c, 0x69, 0x74, 0x61, 0x72, 0x79, 0x20, 0x75, 0x6e, 0x69, 0x74,
+  0x73, 0x20, 0x69, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x20, 0x61, 0x20, 0x63,
+  0x69, 0x74, 0x79, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x65, 0x61, 0x63,
+  0x68, 0x20, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x20, 0x31, 0x20, 0x75, 0x6e,
+  0x68, 0x61, 0x70, 0x70, 0x79, 0x20, 0x63, 0x69, 0x74, 0x69, 0x7a, 0x65,
+  0x6e, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x65, 0x63, 0x6f, 0x6d, 0x65, 0x20,
+  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2e, 0x0a, 0x2a, 0x20, 0x42,
+  0x61, 0x73, 0x65, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x75, 0x70, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x31, 0x30, 0x25, 0x2e, 0x20, 0x54,
+  0x68, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65,
+  0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61,
+  0x6e, 0x63, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x28, 0x68, 0x61,
+  0x6c, 0x66, 0x20, 0x61, 0x73, 0x20, 0x66, 0x61, 0x73, 0x74, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x6b, 0x6e, 0x6f, 0x77, 0x6c, 0x65, 0x64, 0x67,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x54, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x72,
+  0x70, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x2e, 0x0a, 0x2a,
+  0x20, 0x42, 0x61, 0x73, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x61, 0x73, 0x74, 0x65, 0x20, 0x69,
+  0x73, 0x20, 0x32, 0x30, 0x25, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20,
+  0x69, 0x6e, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x61, 0x70,
+  0x69, 0x74, 0x61, 0x6c, 0x20, 0x28, 0x68, 0x61, 0x6c, 0x66, 0x20, 0x61,
+  0x73, 0x20, 0x66, 0x61, 0x73, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x6b, 0x6e, 0x6f, 0x77, 0x6c, 0x65, 0x64, 0x67, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x54, 0x72, 0x61, 0x64, 0x65, 0x29, 0x2e, 0x03, 0x00, 0x00, 0x2e,
+  0x00, 0x8f, 0x0f, 0x03, 0x00, 0x01, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20,
+  0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65,
+  0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20, 0x43,
+  0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x00, 0x22, 0x00, 0x8f,
+  0x0e, 0x01, 0x86, 0x48, 0x69, 0x67, 0x68, 0x20, 0x4b, 0x69, 0x6e, 0x67,
+  0x20, 0x25, 0x73, 0x00, 0x48, 0x69, 0x67, 0x68, 0x20, 0x51, 0x75, 0x65,
+  0x65, 0x6e, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1d, 0x00, 0x8f, 0x0e, 0x00,
+  0x02, 0x45, 0x6d, 0x70, 0x65, 0x72, 0x6f, 0x72, 0x20, 0x25, 0x73, 0x00,
+  0x45, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x1c, 0x00, 0x8f, 0x0e, 0x00, 0x04, 0x53, 0x75, 0x6c, 0x74, 0x61, 0x6e,
+  0x20, 0x25, 0x73, 0x00, 0x53, 0x75, 0x6c, 0x74, 0x61, 0x6e, 0x61, 0x20,
+  0x25, 0x73, 0x00, 0x00, 0x2d, 0x00, 0x8f, 0x0e, 0x01, 0x89, 0x47, 0x72,
+  0x65, 0x61, 0x74, 0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73,
+  0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x47, 0x72, 0x65,
+  0x61, 0x74, 0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00,
+  0x00, 0x18, 0x00, 0x8f, 0x0e, 0x00, 0x06, 0x45, 0x6d, 0x69, 0x72, 0x20,
+  0x25, 0x73, 0x00, 0x45, 0x6d, 0x69, 0x72, 0x61, 0x20, 0x25, 0x73, 0x00,
+  0x00, 0x2d, 0x00, 0x8f, 0x0e, 0x00, 0x09, 0x47, 0x72, 0x65, 0x61, 0x74,
+  0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66,
+  0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20,
+  0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x00, 0x18, 0x00,
+  0x8f, 0x0e, 0x00, 0x0a, 0x45, 0x6d, 0x69, 0x72, 0x20, 0x25, 0x73, 0x00,
+  0x45, 0x6d, 0x69, 0x72, 0x61, 0x20, 0x25, 0x73, 0x00, 0x00, 0x07, 0x00,
+  0x8f, 0x02, 0x01, 0x8f, 0x00, 0x26, 0x00, 0x8f, 0x0e, 0x01, 0x93, 0x47,
+  0x72, 0x61, 0x6e, 0x64, 0x20, 0x44, 0x75, 0x6b, 0x65, 0x20, 0x25, 0x73,
+  0x00, 0x47, 0x72, 0x61, 0x6e, 0x64, 0x20, 0x44, 0x75, 0x63, 0x68, 0x65,
+  0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x18, 0x00, 0x8f, 0x0e, 0x01,
+  0x94, 0x45, 0x6d, 0x69, 0x72, 0x20, 0x25, 0x73, 0x00, 0x45, 0x6d, 0x69,
+  0x72, 0x61, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1e, 0x00, 0x8f, 0x0e, 0x01,
+  0x97, 0x25, 0x73, 0x20, 0x41, 0x75, 0x67, 0x75, 0x73, 0x74, 0x75, 0x73,
+  0x00, 0x25, 0x73, 0x20, 0x41, 0x75, 0x67, 0x75, 0x73, 0x74, 0x61, 0x00,
+  0x00, 0x23, 0x00, 0x8f, 0x0e, 0x00, 0x13, 0x43, 0x6f, 0x2d, 0x50, 0x72,
+  0x69, 0x6e, 0x63, 0x65, 0x20, 0x25, 0x73, 0x00, 0x43, 0x6f, 0x2d, 0x50,
+  0x72, 0x69, 0x6e, 0x63, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x1b, 0x00, 0x8f, 0x0e, 0x01, 0x99, 0x54, 0x73, 0x61, 0x72, 0x20, 0x25,
+  0x73, 0x00, 0x54, 0x73, 0x61, 0x72, 0x69, 0x74, 0x73, 0x61, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x26, 0x00, 0x8f, 0x0e, 0x00, 0x15, 0x47, 0x72, 0x61,
+  0x6e, 0x64, 0x20, 0x44, 0x75, 0x6b, 0x65, 0x20, 0x25, 0x73, 0x00, 0x47,
+  0x72, 0x61, 0x6e, 0x64, 0x20, 0x44, 0x75, 0x63, 0x68, 0x65, 0x73, 0x73,
+  0x20, 0x25, 0x73, 0x00, 0x00, 0x2d, 0x00, 0x8f, 0x0e, 0x00, 0x16, 0x47,
+  0x72, 0x65, 0x61, 0x74, 0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25,
+  0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x47, 0x72,
+  0x65, 0x61, 0x74, 0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73,
+  0x00, 0x00, 0x29, 0x00, 0x8f, 0x0e, 0x01, 0x9b, 0x47, 0x72, 0x61, 0x6e,
+  0x64, 0x20, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x25, 0x73, 0x00,
+  0x47, 0x72, 0x61, 0x6e, 0x64, 0x20, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x65,
+  0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1d, 0x00, 0x8f, 0x0e, 0x00,
+  0x17, 0x45, 0x6d, 0x70, 0x65, 0x72, 0x6f, 0x72, 0x20, 0x25, 0x73, 0x00,
+  0x45, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x2d, 0x00, 0x8f, 0x0e, 0x00, 0x1a, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20,
+  0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65,
+  0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20, 0x43,
+  0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x00, 0x07, 0x00, 0x8f,
+  0x02, 0x01, 0xa2, 0x00, 0x1f, 0x00, 0x8f, 0x0e, 0x00, 0x1e, 0x56, 0x69,
+  0x63, 0x65, 0x72, 0x6f, 0x79, 0x20, 0x25, 0x73, 0x00, 0x56, 0x69, 0x63,
+  0x65, 0x72, 0x65, 0x69, 0x6e, 0x65, 0x20, 0x25, 0x73, 0x00, 0x00, 0x2b,
+  0x00, 0x8f, 0x0e, 0x00, 0x20, 0x41, 0x73, 0x61, 0x6e, 0x74, 0x65, 0x68,
+  0x65, 0x6e, 0x65, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61,
+  0x6c, 0x65, 0x3a, 0x41, 0x73, 0x61, 0x6e, 0x74, 0x65, 0x68, 0x65, 0x6e,
+  0x65, 0x20, 0x25, 0x73, 0x00, 0x00, 0x35, 0x00, 0x8f, 0x0e, 0x01, 0xa7,
+  0x50, 0x61, 0x72, 0x61, 0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x43, 0x68,
+  0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61,
+  0x6c, 0x65, 0x3a, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x6f, 0x75, 0x6e, 0x74,
+  0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x00, 0x22,
+  0x00, 0x8f, 0x0e, 0x00, 0x24, 0x48, 0x69, 0x67, 0x68, 0x20, 0x4b, 0x69,
+  0x6e, 0x67, 0x20, 0x25, 0x73, 0x00, 0x48, 0x69, 0x67, 0x68, 0x20, 0x51,
+  0x75, 0x65, 0x65, 0x6e, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1d, 0x00, 0x8f,
+  0x0e, 0x00, 0x26, 0x4b, 0x61, 0x69, 0x73, 0x65, 0x72, 0x20, 0x25, 0x73,
+  0x00, 0x4b, 0x61, 0x69, 0x73, 0x65, 0x72, 0x69, 0x6e, 0x20, 0x25, 0x73,
+  0x00, 0x00, 0x23, 0x00, 0x8f, 0x0e, 0x00, 0x27, 0x25, 0x73, 0x20, 0x4b,
+  0x68, 0x61, 0x67, 0x61, 0x6e, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c,
+  0x65, 0x3a, 0x25, 0x73, 0x20, 0x4b, 0x68, 0x61, 0x67, 0x61, 0x6e, 0x00,
+  0x00, 0x1b, 0x00, 0x8f, 0x0e, 0x00, 0x29, 0x25, 0x73, 0x20, 0x53, 0x68,
+  0x61, 0x68, 0x00, 0x25, 0x73, 0x20, 0x53, 0x68, 0x61, 0x68, 0x62, 0x61,
+  0x6e, 0x75, 0x00, 0x00, 0x1d, 0x00, 0x8f, 0x0e, 0x00, 0x2a, 0x45, 0x6d,
+  0x70, 0x65, 0x72, 0x6f, 0x72, 0x20, 0x25, 0x73, 0x00, 0x45, 0x6d, 0x70,
+  0x72, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x26, 0x00, 0x8f,
+  0x0e, 0x00, 0x2b, 0x47, 0x72, 0x61, 0x6e, 0x64, 0x20, 0x44, 0x75, 0x6b,
+  0x65, 0x20, 0x25, 0x73, 0x00, 0x47, 0x72, 0x61, 0x6e, 0x64, 0x20, 0x44,
+  0x75, 0x63, 0x68, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x07,
+  0x00, 0x8f, 0x02, 0x01, 0xb0, 0x00, 0x21, 0x00, 0x8f, 0x0e, 0x00, 0x2c,
+  0x25, 0x73, 0x20, 0x4c, 0x75, 0x67, 0x61, 0x6c, 0x00, 0x3f, 0x66, 0x65,
+  0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x10, 0x0a, 0x01, 0x01, 0x00, 0x00, 0x61, 0x00, 0xeb, 0x1e,
+  0x07, 0x07, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x01, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4c,
+  0x0a, 0x00, 0x00, 0x00, 0x03, 0x11, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x16,
+  0x00, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x01, 0x00, 0x00, 0x44, 0x00, 0xeb,
+  0x04, 0x07, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x01, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x0a, 0x01, 0x01, 0x00, 0x00, 0x2c, 0x00, 0xeb, 0x1f, 0x6a, 0x04, 0x07,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4c, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x29, 0x00, 0xeb, 0x04, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x1e,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x0a, 0x01, 0x01, 0x00, 0x00, 0x19, 0x00, 0xeb, 0x07, 0x6c, 0x02,
+  0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xeb, 0x07, 0x6f,
+  0x01, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x62,
+  0x00, 0xeb, 0x1f, 0x70, 0x04, 0x07, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
+  0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x1d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x06, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x29, 0x00, 0xeb, 0x04, 0x07, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
+  0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x07,
+  0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x23, 0x00, 0xeb, 0x1f, 0x71, 0x02,
+  0x03, 0x00, 0x00, 0x00, 0x19, 0x07, 0x00, 0x01, 0x00, 0x16, 0x00, 0x00,
+  0x00, 0x10, 0x01, 0x00, 0x01, 0x00, 0x01, 0x16, 0x00, 0x00, 0x00, 0x10,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x1f, 0x00, 0xfc, 0x3c, 0x02, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x00, 0x00, 0x00, 0x0f,
+  0x00, 0x00, 0x00, 0x01, 0x06, 0x21, 0x16, 0x1c, 0x14, 0x15, 0x26, 0x00,
+  0x18, 0x00, 0xfc, 0x09, 0x01, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x01, 0x01, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x18, 0x00, 0xfc, 0x09, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x31, 0x00, 0xfc, 0x3f, 0x03, 0x01, 0x04, 0x19, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x07, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x18, 0x35, 0x2d, 0x2e,
+  0x00, 0x1c, 0x00, 0xfc, 0x3f, 0x04, 0x02, 0x01, 0x25, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x01, 0x01, 0x0a, 0x48, 0x4c, 0x4d, 0x56, 0x57, 0x5a,
+  0x5b, 0x5e, 0x5f, 0x6c, 0x00, 0x1b, 0x00, 0xfc, 0x39, 0x05, 0x25, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x01, 0x0b, 0x31, 0x32, 0x4c, 0x4d,
+  0x56, 0x57, 0x5a, 0x5b, 0x5e, 0x5f, 0x6c, 0x00, 0x0f, 0x00, 0xfc, 0x3f,
+  0x06, 0x03, 0x00, 0x06, 0x48, 0x5a, 0x5b, 0x5e, 0x5f, 0x6c, 0x00, 0x08,
+  0x00, 0xfc, 0x33, 0x07, 0x04, 0x00, 0x00, 0x1d, 0x00, 0xfc, 0x3f, 0x08,
+  0x02, 0x01, 0x25, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x01, 0x01, 0x0b,
+  0x31, 0x32, 0x4c, 0x4d, 0x56, 0x57, 0x5a, 0x5b, 0x5e, 0x5f, 0x6c, 0x00,
+  0x06, 0x00, 0xea, 0x01, 0x05, 0x00, 0x06, 0x00, 0xea, 0x01, 0x06, 0x00,
+  0x06, 0x00, 0xea, 0x01, 0x07, 0x00, 0x06, 0x00, 0xea, 0x01, 0x08, 0x00,
+  0x06, 0x00, 0xea, 0x01, 0x09, 0x00, 0x06, 0x00, 0xea, 0x01, 0x0a, 0x00,
+  0x06, 0x00, 0xea, 0x01, 0x0b, 0x00, 0x06, 0x00, 0xea, 0x01, 0x0c, 0x00,
+  0xa2, 0x00, 0x90, 0x8d, 0x3f, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x41,
+  0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x07, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0xde, 0xa8, 0x00, 0x00, 0x00, 0x39, 0x41, 0x64, 0x76,
+  0x61, 0x6e, 0x63, 0x65, 0x64, 0x20, 0x46, 0x6c, 0x69, 0x67, 0x68, 0x74,
+  0x00, 0x41, 0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x64, 0x20, 0x46, 0x6c,
+  0x69, 0x67, 0x68, 0x74, 0x00, 0x45, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x73,
+  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x6e, 0x75, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20, 0x75, 0x6e, 0x69,
+  0x74, 0x73, 0x2e, 0x03, 0x45, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20,
+  0x61, 0x69, 0x72, 0x6c, 0x69, 0x66, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6d,
+  0x65, 0x64, 0x69, 0x75, 0x6d, 0x20, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74,
+  0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x2e, 0x03, 0x00, 0x61, 0x2e, 0x61,
+  0x64, 0x76, 0x61, 0x6e, 0x63, 0x65, 0x64, 0x5f, 0x66, 0x6c, 0x69, 0x67,
+  0x68, 0x74, 0x00, 0x2d, 0x00, 0x00, 0x2e, 0x00, 0x90, 0x8d, 0x1f, 0x02,
+  0x00, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x01, 0x41, 0x6c, 0x70,
+  0x68, 0x61, 0x62, 0x65, 0x74, 0x00, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x62,
+  0x65, 0x74, 0x00, 0x00, 0x61, 0x2e, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x62,
+  0x65, 0x74, 0x00, 0x00, 0x5d, 0x00, 0x90, 0x8d, 0x17, 0x03, 0x02, 0x01,
+  0x00, 0x00, 0x00, 0x19, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x50, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0xaf, 0xc8, 0x00, 0x00, 0x00,
+  0x2d, 0x41, 0x6d, 0x70, 0x68, 0x69, 0x62, 0x69, 0x6f, 0x75, 0x73, 0x20,
+  0x57, 0x61, 0x72, 0x66, 0x61, 0x72, 0x65, 0x00, 0x41, 0x6d, 0x70, 0x68,
+  0x69, 0x62, 0x69, 0x6f, 0x75, 0x73, 0x20, 0x57, 0x61, 0x72, 0x66, 0x61,
+  0x72, 0x65, 0x00, 0x61, 0x2e, 0x61, 0x6d, 0x70, 0x68, 0x69, 0x62, 0x69,
+  0x6f, 0x75, 0x73, 0x5f, 0x77, 0x61, 0x72, 0x66, 0x61, 0x72, 0x65, 0x00,
+  0x00, 0x6e, 0x00, 0x90, 0x89, 0x1f, 0x04, 0x01, 0x00, 0x00, 0x00, 0x37,
+  0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x07, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x17, 0x70, 0x00, 0x00, 0x00, 0x06, 0x41, 0x73, 0x74,
+  0x72, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x00, 0x41, 0x73, 0x74, 0x72, 0x6f,
+  0x6e, 0x6f, 0x6d, 0x79, 0x00, 0x49, 0x6e, 0x63, 0x72, 0x65, 0x61, 0x73,
+  0x65, 0x73, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x27, 0x20, 0x76, 0x69,
+  0x73, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x69, 0x6e,
+  0x20, 0x66, 0x6f, 0x72, 0x74, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x2e,
+  0x03, 0x00, 0x61, 0x2e, 0x61, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x6f, 0x6d,
+  0x79, 0x00, 0x00, 0x4e, 0x00, 0x90, 0x89, 0x1f, 0x05, 0x01, 0x00, 0x00,
+  0x00, 0x0b, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x07,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x88, 0x00, 0x00, 0x00, 0x25, 0x41,
+  0x74, 0x6f, 0x6d, 0x69, 0x63, 0x20, 0x54, 0x68, 0x65, 0x6f, 0x72, 0x79,
+  0x00, 0x41, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x20, 0x54, 0x68, 0x65, 0x6f,
+  0x72, 0x79, 0x00, 0x00, 0x61, 0x2e, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63,
+  0x5f, 0x74, 0x68, 0x65, 0x6f, 0x72, 0x79, 0x00, 0x00, 0x44, 0x00, 0x90,
+  0x89, 0x17, 0x06, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x4e, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb3,
+  0xb0, 0x00, 0x00, 0x00, 0x2e, 0x41, 0x75, 0x74, 0x6f, 0x6d, 0x6f, 0x62,
+  0x69, 0x6c, 0x65, 0x00, 0x41, 0x75, 0x74, 0x6f, 0x6d, 0x6f, 0x62, 0x69,
+  0x6c, 0x65, 0x00, 0x61, 0x2e, 0x61, 0x75, 0x74, 0x6f, 0x6d, 0x6f, 0x62,
+  0x69, 0x6c, 0x65, 0x00, 0x00, 0x3b, 0x00, 0x90, 0x89, 0x17, 0x07, 0x01,
+  0x00, 0x00, 0x00, 0x56, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x52, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x10, 0x00, 0x00, 0x00,
+  0x0a, 0x42, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x00, 0x42, 0x61, 0x6e,
+  0x6b, 0x69, 0x6e, 0x67, 0x00, 0x61, 0x2e, 0x62, 0x61, 0x6e, 0x6b, 0x69,
+  0x6e, 0x67, 0x00, 0x00, 0x7f, 0x00, 0x90, 0xc9, 0x1f, 0x08, 0x01, 0x00,
+  0x00, 0x00, 0x53, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13,
+  0x07, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1f, 0x40, 0x00, 0x00,
+  0x00, 0x08, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x20, 0x42, 0x75, 0x69,
+  0x6c, 0x64, 0x69, 0x6e, 0x67, 0x00, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65,
+  0x20, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x00, 0x41, 0x6c,
+  0x6c, 0x6f, 0x77, 0x73, 0x20, 0x72, 0x6f, 0x61, 0x64, 0x73, 0x20, 0x74,
+  0x6f, 0x20, 0x62, 0x65, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x20, 0x6f,
+  0x6e, 0x20, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x74, 0x69, 0x6c, 0x65,
+  0x73, 0x2e, 0x03, 0x00, 0x61, 0x2e, 0x62, 0x72, 0x69, 0x64, 0x67, 0x65,
+  0x5f, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x42,
+  0x00, 0x90, 0xcd, 0x1f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe8,
+  0x00, 0x00, 0x00, 0x01, 0x42, 0x72, 0x6f, 0x6e, 0x7a, 0x65, 0x20, 0x57,
+  0x6f, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x00, 0x42, 0x72, 0x6f, 0x6e, 0x7a,
+  0x65, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x61,
+  0x2e, 0x62, 0x72, 0x6f, 0x6e, 0x7a, 0x65, 0x5f, 0x77, 0x6f, 0x72, 0x6b,
+  0x69, 0x6e, 0x67, 0x00, 0x00, 0x3f, 0x00, 0x90, 0x01, 0x16, 0x0a, 0x43,
+  0x65, 0x72, 0x65, 0x6d, 0x6f, 0x6e, 0x69, 0x61, 0x6c, 0x20, 0x42, 0x75,
+  0x72, 0x69, 0x61, 0x6c, 0x00, 0x43, 0x65, 0x72, 0x65, 0x6d, 0x6f, 0x6e,
+  0x69, 0x61, 0x6c, 0x20, 0x42, 0x75, 0x72, 0x69, 0x61, 0x6c, 0x00, 0x61,
+  0x2e, 0x63, 0x65, 0x72, 0x65, 0x6d, 0x6f, 0x6e, 0x69, 0x61, 0x6c, 0x5f,
+  0x62, 0x75, 0x72, 0x69, 0x61, 0x6c, 0x00, 0x00, 0x42, 0x00, 0x90, 0x8d,
+  0x17, 0x0b, 0x02, 0x01, 0x00, 0x00, 0x00, 0x57, 0x07, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x31, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3e,
+  0x80, 0x00, 0x00, 0x00, 0x10, 0x43, 0x68, 0x65, 0x6d, 0x69, 0x73, 0x74,
+  0x72, 0x79, 0x00, 0x43, 0x68, 0x65, 0x6d, 0x69, 0x73, 0x74, 0x72, 0x79,
+  0x00, 0x61, 0x2e, 0x63, 0x68, 0x65, 0x6d, 0x69, 0x73, 0x74, 0x72, 0x79,
+  0x00, 0x00, 0x3e, 0x00, 0x90, 0x89, 0x17, 0x0c, 0x01, 0x00, 0x00, 0x00,
+  0x1d, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0x07, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x27, 0x10, 0x00, 0x00, 0x00, 0x0a, 0x43, 0x68,
+  0x69, 0x76, 0x61, 0x6c, 0x72, 0x79, 0x00, 0x43, 0x68, 0x69, 0x76, 0x61,
+  0x6c, 0x72, 0x79, 0x00, 0x61, 0x2e, 0x63, 0x68, 0x69, 0x76, 0x61, 0x6c,
+  0x72, 0x79, 0x00, 0x00, 0x42, 0x00, 0x90, 0x8d, 0x17, 0x0d, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0xd0,
+  0x00, 0x00, 0x00, 0x02, 0x43, 0x6f, 0x64, 0x65, 0x20, 0x6f, 0x66, 0x20,
+  0x4c, 0x61, 0x77, 0x73, 0x00, 0x43, 0x6f, 0x64, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x4c, 0x61, 0x77, 0x73, 0x00, 0x61, 0x2e, 0x63, 0x6f, 0x64, 0x65,
+  0x5f, 0x6f, 0x66, 0x5f, 0x6c, 0x61, 0x77, 0x73, 0x00, 0x00, 0x4e, 0x00,
+  0x90, 0x8d, 0x17, 0x0e, 0x02, 0x01, 0x00, 0x00, 0x00, 0x34, 0x07, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0xea, 0x60, 0x00, 0x00, 0x00, 0x3c, 0x43, 0x6f, 0x6d, 0x62, 0x69,
+  0x6e, 0x65, 0x64, 0x20, 0x41, 0x72, 0x6d, 0x73, 0x00, 0x43, 0x6f, 0x6d,
+  0x62, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x41, 0x72, 0x6d, 0x73, 0x00, 0x61,
+  0x2e, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x5f, 0x61, 0x72,
+  0x6d, 0x73, 0x00, 0x00, 0x44, 0x00, 0x90, 0x89, 0x17, 0x0f, 0x01, 0x00,
+  0x00, 0x00, 0x44, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19,
+  0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0xab, 0xe0, 0x00, 0x00, 0x00, 0x2c,
+  0x43, 0x6f, 0x6d, 0x62, 0x75, 0x73, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x43,
+  0x6f, 0x6d, 0x62, 0x75, 0x73, 0x74, 0x65, 0x72, 0x73, 0x65, 0x61, 0x73,
+  0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x76, 0x69, 0x74,
+  0x79, 0x20, 0x6f, 0x66, 0x20, 0x46, 0x72, 0x61, 0x6e, 0x63, 0x65, 0x20,
+  0x74, 0x6f, 0x64, 0x61, 0x79, 0x20, 0x62, 0x75, 0x74, 0x20, 0x74, 0x68,
+  0x65, 0x79, 0x20, 0x65, 0x6e, 0x6a, 0x6f, 0x79, 0x20, 0x61, 0x20, 0x6c,
+  0x61, 0x72, 0x67, 0x65, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61,
+  0x6c, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x2e, 0x20,
+  0x42, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x69,
+  0x74, 0x73, 0x20, 0x6c, 0x75, 0x73, 0x68, 0x20, 0x76, 0x65, 0x67, 0x65,
+  0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x50,
+  0x6f, 0x6c, 0x79, 0x6e, 0x65, 0x73, 0x69, 0x61, 0x6e, 0x20, 0x63, 0x75,
+  0x6c, 0x74, 0x75, 0x72, 0x65, 0x2c, 0x20, 0x54, 0x61, 0x68, 0x69, 0x74,
+  0x69, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x63, 0x6f, 0x6d, 0x65,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x63, 0x68, 0x65, 0x74, 0x79,
+  0x70, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x78, 0x6f, 0x74, 0x69, 0x63,
+  0x20, 0x69, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x2e, 0x00, 0x02, 0x07, 0x50,
+  0x6f, 0x6d, 0x61, 0x72, 0x65, 0x20, 0x49, 0x00, 0x50, 0x6f, 0x6d, 0x61,
+  0x72, 0x65, 0x20, 0x49, 0x49, 0x00, 0x50, 0x6f, 0x6d, 0x61, 0x72, 0x65,
+  0x20, 0x49, 0x56, 0x00, 0x50, 0x6f, 0x6d, 0x61, 0x72, 0x65, 0x20, 0x56,
+  0x00, 0x50, 0x6f, 0x75, 0x76, 0x61, 0x6e, 0x61, 0x27, 0x61, 0x20, 0x61,
+  0x20, 0x4f, 0x27, 0x6f, 0x70, 0x61, 0x00, 0x41, 0x6c, 0x65, 0x78, 0x61,
+  0x6e, 0x64, 0x72, 0x65, 0x20, 0x4c, 0xc3, 0xa9, 0x6f, 0x6e, 0x74, 0x69,
+  0x65, 0x66, 0x66, 0x00, 0x4f, 0x73, 0x63, 0x61, 0x72, 0x20, 0x54, 0x65,
+  0x6d, 0x61, 0x72, 0x75, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x08, 0x09, 0x03, 0x6f, 0x00, 0x94, 0xfe, 0xef, 0x03,
+  0x01, 0xe2, 0x54, 0x61, 0x69, 0x6e, 0x6f, 0x00, 0x54, 0x61, 0x69, 0x6e,
+  0x6f, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x54, 0x61,
+  0x69, 0x6e, 0x6f, 0x00, 0x74, 0x61, 0x69, 0x6e, 0x6f, 0x00, 0x2d, 0x00,
+  0x4e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x69, 0x6e, 0x68, 0x61, 0x62,
+  0x69, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x42, 0x61, 0x68, 0x61, 0x6d, 0x61, 0x73, 0x2c, 0x20, 0x43,
+  0x75, 0x62, 0x61, 0x2c, 0x20, 0x48, 0x69, 0x73, 0x70, 0x61, 0x6e, 0x69,
+  0x6f, 0x6c, 0x61, 0x2c, 0x20, 0x50, 0x75, 0x65, 0x72, 0x74, 0x6f, 0x20,
+  0x52, 0x69, 0x63, 0x6f, 0x2c, 0x20, 0x4a, 0x61, 0x6d, 0x61, 0x69, 0x63,
+  0x61, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72,
+  0x20, 0x43, 0x61, 0x72, 0x69, 0x62, 0x62, 0x65, 0x61, 0x6e, 0x20, 0x69,
+  0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x20, 0x77, 0x68, 0x6f, 0x20, 0x67,
+  0x61, 0x76, 0x65, 0x20, 0x75, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+  0x6f, 0x6f, 0x74, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x68, 0x75, 0x72, 0x72, 0x69, 0x63, 0x61, 0x6e, 0x65, 0x2c,
+  0x20, 0x74, 0x6f, 0x62, 0x61, 0x63, 0x63, 0x6f, 0x2c, 0x20, 0x70, 0x6f,
+  0x74, 0x61, 0x74, 0x6f, 0x2c, 0x20, 0x63, 0x61, 0x6e, 0x6f, 0x65, 0x2c,
+  0x20, 0x62, 0x61, 0x72, 0x62, 0x65, 0x71, 0x75, 0x65, 0x2c, 0x20, 0x68,
+  0x61, 0x6d, 0x6d, 0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x79, 0x75, 0x63, 0x63, 0x61, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20,
+  0x77, 0x65, 0x72, 0x65, 0x20, 0x61, 0x20, 0x6d, 0x61, 0x74, 0x72, 0x69,
+  0x6c, 0x69, 0x6e, 0x65, 0x61, 0x6c, 0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c,
+  0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+  0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x43, 0x6f,
+  0x6c, 0x75, 0x6d, 0x62, 0x75, 0x73, 0x20, 0x63, 0x61, 0x6d, 0x65, 0x20,
+  0x69, 0x6e, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x63, 0x74,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x34, 0x39,
+  0x32, 0x2e, 0x20, 0x54, 0x68, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x6e, 0x75,
+  0x6d, 0x62, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x68, 0x75, 0x6e, 0x64, 0x72, 0x65, 0x64, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x6f, 0x75, 0x73, 0x61, 0x6e, 0x64, 0x73, 0x2c, 0x20, 0x69,
+  0x66, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6d, 0x69, 0x6c, 0x6c, 0x69, 0x6f,
+  0x6e, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x6f,
+  0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x61, 0x72, 0x69, 0x62,
+  0x62, 0x65, 0x61, 0x6e, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x54, 0x61,
+  0x69, 0x6e, 0x6f, 0x20, 0x66, 0x65, 0x6c, 0x6c, 0x20, 0x76, 0x69, 0x63,
+  0x74, 0x69, 0x6d, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x6c, 0x61, 0x76, 0x65,
+  0x72, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x69, 0x73, 0x65, 0x61,
+  0x73, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x69,
+  0x72, 0x20, 0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x64, 0x65, 0x63, 0x6c, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x72, 0x61,
+  0x70, 0x69, 0x64, 0x6c, 0x79, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x72,
+  0x65, 0x73, 0x75, 0x6c, 0x74, 0x2e, 0x20, 0x53, 0x70, 0x61, 0x6e, 0x69,
+  0x73, 0x68, 0x20, 0x61, 0x63, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x73, 0x20,
+  0x70, 0x61, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x61,
+  0x73, 0x20, 0x61, 0x20, 0x70, 0x65, 0x61, 0x63, 0x65, 0x66, 0x75, 0x6c,
+  0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70,
+  0x61, 0x72, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x69,
+  0x72, 0x20, 0x43, 0x61, 0x72, 0x69, 0x62, 0x20, 0x6e, 0x65, 0x69, 0x67,
+  0x68, 0x62, 0x6f, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x73, 0x6f, 0x75, 0x74, 0x68, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x69,
+  0x72, 0x20, 0x64, 0x75, 0x67, 0x6f, 0x75, 0x74, 0x20, 0x63, 0x61, 0x6e,
+  0x6f, 0x65, 0x73, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x77,
+  0x65, 0x72, 0x65, 0x20, 0x6f, 0x66, 0x74, 0x65, 0x6e, 0x20, 0x6e, 0x65,
+  0x61, 0x72, 0x6c, 0x79, 0x20, 0x61, 0x73, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+  0x20, 0x61, 0x73, 0x20, 0x43, 0x6f, 0x6c, 0x75, 0x6d, 0x62, 0x75, 0x73,
+  0x27, 0x20, 0x73, 0x68, 0x69, 0x70, 0x73, 0x2c, 0x20, 0x66, 0x65, 0x72,
+  0x72, 0x69, 0x65, 0x64, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x72, 0x73,
+  0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x69, 0x73, 0x6c,
+  0x61, 0x6e, 0x64, 0x73, 0x2e, 0x20, 0x52, 0x65, 0x63, 0x65, 0x6e, 0x74,
+  0x20, 0x67, 0x65, 0x6e, 0x65, 0x74, 0x69, 0x63, 0x20, 0x73, 0x74, 0x75,
+  0x64, 0x69, 0x65, 0x73, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x20, 0x74, 0x68,
+  0x61, 0x74, 0x20, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x6c, 0x79, 0x20, 0x68,
+  0x61, 0x6c, 0x66, 0x20, 0x6f, 0x66, 0x20, 0x50, 0x75, 0x65, 0x72, 0x74,
+  0x6f, 0x20, 0x52, 0x69, 0x63, 0x61, 0x6e, 0x73, 0x20, 0x68, 0x61, 0x76,
+  0x65, 0x20, 0x54, 0x61, 0x69, 0x6e, 0x6f, 0x20, 0x6d, 0x61, 0x74, 0x65,
+  0x72, 0x6e, 0x61, 0x6c, 0x20, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x74,
+  0x2e, 0x00, 0x02, 0x06, 0x41, 0x67, 0xc3, 0xbc, 0x65, 0x79, 0x62, 0x61,
+  0x6e, 0x61, 0x00, 0x4a, 0x75, 0x6d, 0x61, 0x63, 0x61, 0x6f, 0x00, 0x43,
+  0x61, 0x6e, 0x6f, 0x62, 0x61, 0x6e, 0xc3, 0xa1, 0x00, 0x48, 0x61, 0x79,
+  0x75, 0x79, 0x61, 0x00, 0x4c, 0x6f, 0x71, 0x75, 0x69, 0x6c, 0x6c, 0x6f,
+  0x00, 0x48, 0x61, 0x74, 0x75, 0x65, 0x79, 0x00, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x02, 0x01, 0x00, 0x01, 0x05, 0x09, 0x02, 0x94, 0x00, 0x94,
+  0xff, 0xef, 0x03, 0x01, 0xe3, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76,
+  0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x54, 0x61, 0x69,
+  0x72, 0x6f, 0x6e, 0x61, 0x00, 0x54, 0x61, 0x69, 0x72, 0x6f, 0x6e, 0x61,
+  0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x54, 0x61, 0x69,
+  0x72, 0x6f, 0x6e, 0x61, 0x00, 0x74, 0x61, 0x69, 0x72, 0x6f, 0x6e, 0x61,
+  0x00, 0x2d, 0x00, 0x41, 0x20, 0x43, 0x68, 0x69, 0x62, 0x63, 0x68, 0x61,
+  0x6e, 0x2d, 0x73, 0x70, 0x65, 0x61, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x70,
+  0x65, 0x6f, 0x70, 0x6c, 0x65, 0x20, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
+  0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4b, 0x75, 0x6e,
+  0x61, 0x20, 0x6f, 0x66, 0x20, 0x50, 0x61, 0x6e, 0x61, 0x6d, 0x61, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4d, 0x75, 0x69, 0x73,
+  0x63, 0x61, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x72, 0x61,
+  0x6c, 0x20, 0x43, 0x6f, 0x6c, 0x6f, 0x6d, 0x62, 0x69, 0x61, 0x2c, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x54, 0x61, 0x69, 0x72, 0x6f, 0x6e, 0x61, 0x20,
+  0x69, 0x6e, 0x68, 0x61, 0x62, 0x69, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6d, 0x6f, 0x64, 0x65, 0x72, 0x6e, 0x20, 0x4d, 0x61, 0x67, 0x64, 0x61,
+  0x6c, 0x65, 0x6e, 0x61, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x4c, 0x61, 0x20,
+  0x47, 0x75, 0x61, 0x6a, 0x69, 0x72, 0x61, 0x20, 0x44, 0x65, 0x70, 0x61,
+  0x72, 0x74, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6e,
+  0x6f, 0x72, 0x74, 0x68, 0x65, 0x72, 0x6e, 0x20, 0x43, 0x6f, 0x6c, 0x6f,
+  0x6d, 0x62, 0x69, 0x61, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x69, 0x72, 0x20,
+  0x63, 0x69, 0x74, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x54, 0x65, 0x79, 0x75,
+  0x6e, 0x61, 0x20, 0x77, 0x61, 0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64,
+  0x65, 0x64, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x74, 0x69, 0x6d, 0x65, 0x20,
+  0x61, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x35, 0x30, 0x30, 0x20, 0x42,
+  0x43, 0x45, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x54, 0x61, 0x69, 0x72,
+  0x6f, 0x6e, 0x61, 0x2c, 0x20, 0x6c, 0x69, 0x76, 0x69, 0x6e, 0x67, 0x20,
+  0x69, 0x6e, 0x20, 0x61, 0x20, 0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x61, 0x69,
+  0x6e, 0x6f, 0x75, 0x73, 0x20, 0x61, 0x72, 0x65, 0x61, 0x2c, 0x20, 0x62,
+  0x75, 0x69, 0x6c, 0x74, 0x20, 0x73, 0x74, 0x6f, 0x6e, 0x65, 0x20, 0x73,
+  0x74, 0x65, 0x70, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x65, 0x72,
+  0x72, 0x61, 0x63, 0x65, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x73, 0x74, 0x65,
+  0x65, 0x70, 0x20, 0x68, 0x69, 0x6c, 0x6c, 0x73, 0x69, 0x64, 0x65, 0x73,
+  0x20, 0x69, 0x6e, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20, 0x74, 0x6f,
+  0x20, 0x66, 0x61, 0x72, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+  0x67, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x54, 0x68, 0x6f, 0x75, 0x67, 0x68,
+  0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x66, 0x6f, 0x75, 0x67, 0x68, 0x74,
+  0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x53, 0x70, 0x61, 0x6e, 0x69, 0x73, 0x68, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x37, 0x35, 0x20, 0x79, 0x65, 0x61, 0x72, 0x73, 0x2c, 0x20, 0x65,
+  0x76, 0x65, 0x6e, 0x74, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x74, 0x68,
+  0x65, 0x79, 0x20, 0x73, 0x75, 0x63, 0x63, 0x75, 0x6d, 0x62, 0x65, 0x64,
+  0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x72, 0x69,
+  0x6f, 0x75, 0x73, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65,
+  0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x4e,
+  0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x6e, 0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x73, 0x20, 0x77,
+  0x65, 0x72, 0x65, 0x20, 0x73, 0x75, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20,
+  0x74, 0x6f, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68,
+  0x69, 0x73, 0x20, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x2e, 0x00, 0x02,
+  0x04, 0x4e, 0x61, 0x62, 0x6f, 0x62, 0xc3, 0xa1, 0x00, 0x4e, 0x75, 0x67,
+  0x69, 0x20, 0x54, 0xc3, 0xba, 0x78, 0x65, 0x00, 0x48, 0xc3, 0xa1, 0x62,
+  0x61, 0x20, 0x48, 0x61, 0x78, 0x74, 0x6f, 0x78, 0xc3, 0xa9, 0x00, 0x4b,
+  0x75, 0x6e, 0x68, 0x77, 0x69, 0x6e, 0x67, 0x75, 0x6d, 0x75, 0x00, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x09, 0x02, 0x22, 0x00, 0x94,
+  0xff, 0xef, 0x03, 0x01, 0xe4, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76,
+  0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x54, 0x61, 0x69,
+  0x77, 0x61, 0x6e, 0x65, 0x73, 0x65, 0x00, 0x54, 0x61, 0x69, 0x77, 0x61,
+  0x6e, 0x65, 0x73, 0x65, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c,
+  0x3a, 0x54, 0x61, 0x69, 0x77, 0x61, 0x6e, 0x65, 0x73, 0x65, 0x00, 0x74,
+  0x61, 0x69, 0x77, 0x61, 0x6e, 0x00, 0x2d, 0x00, 0x54, 0x68, 0x65, 0x20,
+  0x52, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x6f, 0x66, 0x20,
+  0x43, 0x68, 0x69, 0x6e, 0x61, 0x20, 0x77, 0x61, 0x73, 0x20, 0x65, 0x73,
+  0x74, 0x61, 0x62, 0x6c, 0x69, 0x73, 0x68, 0x65, 0x64, 0x20, 0x69, 0x6e,
+  0x20, 0x31, 0x39, 0x31, 0x32, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6f, 0x72, 0x20, 0x73,
+  0x74, 0x61, 0x74, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x51, 0x69, 0x6e, 0x67, 0x20, 0x45, 0x6d, 0x70, 0x69, 0x72, 0x65, 0x2c,
+  0x20, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x76, 0x65, 0x72,
+  0x6f, 0x72, 0x74, 0x00, 0x48, 0x6f, 0x77, 0x20, 0x6d, 0x61, 0x6e, 0x79,
+  0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x73, 0x68, 0x6f, 0x75,
+  0x6c, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x54, 0x6f, 0x70, 0x20, 0x43,
+  0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74,
+  0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x3f, 0x20, 0x49, 0x66,
+  0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x7a, 0x65, 0x72,
+  0x6f, 0x2c, 0x20, 0x54, 0x6f, 0x70, 0x20, 0x43, 0x69, 0x74, 0x69, 0x65,
+  0x73, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x69, 0x73, 0x20,
+  0x6e, 0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c,
+  0x65, 0x20, 0x61, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x2e, 0x00, 0x05, 0x03,
+  0x10, 0x00, 0xa5, 0x07, 0x00, 0x05, 0x74, 0x6f, 0x70, 0x6f, 0x6c, 0x6f,
+  0x67, 0x79, 0x00, 0x4d, 0x61, 0x70, 0x20, 0x74, 0x6f, 0x70, 0x6f, 0x6c,
+  0x6f, 0x67, 0x79, 0x00, 0x46, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x20,
+  0x6d, 0x61, 0x70, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6c, 0x77,
+  0x61, 0x79, 0x73, 0x20, 0x74, 0x77, 0x6f, 0x2d, 0x64, 0x69, 0x6d, 0x65,
+  0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x2e, 0x20, 0x49, 0x6e, 0x64,
+  0x69, 0x76, 0x69, 0x64, 0x75, 0x61, 0x6c, 0x20, 0x74, 0x69, 0x6c, 0x65,
+  0x73, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x63,
+  0x74, 0x61, 0x6e, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x20, 0x6f, 0x72, 0x20,
+  0x68, 0x65, 0x78, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x2c, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x61,
+  0x6e, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x68, 0x65, 0x61, 0x64, 0x20, 0x28,
+  0x22, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x63, 0x22, 0x29, 0x20, 0x6f,
+  0x72, 0x20, 0x69, 0x73, 0x6f, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x20,
+  0x61, 0x6c, 0x69, 0x67, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x0a, 0x54,
+  0x6f, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x61, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x75, 0x6c, 0x61, 0x72,
+  0x20, 0x74, 0x6f, 0x70, 0x6f, 0x6c, 0x6f, 0x67, 0x79, 0x2c, 0x20, 0x63,
+  0x6c, 0x69, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20,
+  0x6e, 0x65, 0x65, 0x64, 0x20, 0x61, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x69, 0x6e, 0x67, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x73, 0x65, 0x74, 0x2e,
+  0x0a, 0x4f, 0x76, 0x65, 0x72, 0x68, 0x65, 0x61, 0x64, 0x20, 0x72, 0x65,
+  0x63, 0x74, 0x61, 0x6e, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x3a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x49, 0x73, 0x6f, 0x6d, 0x65, 0x74, 0x72, 0x69,
+  0x63, 0x20, 0x72, 0x65, 0x63, 0x74, 0x61, 0x6e, 0x67, 0x75, 0x6c, 0x61,
+  0x72, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x5f,
+  0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x5c, 0x2f,
+  0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7c, 0x5f, 0x7c, 0x5f, 0x7c, 0x5f, 0x7c, 0x5f, 0x7c, 0x5f, 0x7c,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x2f,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x5f, 0x7c, 0x5f, 0x7c, 0x5f,
+  0x7c, 0x5f, 0x7c, 0x5f, 0x7c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x2f,
+  0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c,
+  0x5f, 0x7c, 0x5f, 0x7c, 0x5f, 0x7c, 0x5f, 0x7c, 0x5f, 0x7c, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x2f, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x2f,
+  0x5c, 0x2f, 0x0a, 0x48, 0x65, 0x78, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x73, 0x6f, 0x2d, 0x68, 0x65,
+  0x78, 0x3a, 0x0a, 0x20, 0x20, 0x2f, 0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x2f,
+  0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x20, 0x20, 0x20,
+  0x5f, 0x20, 0x20, 0x20, 0x5f, 0x20, 0x20, 0x20, 0x5f, 0x20, 0x20, 0x20,
+  0x5f, 0x0a, 0x20, 0x20, 0x7c, 0x20, 0x7c, 0x20, 0x7c, 0x20, 0x7c, 0x20,
+  0x7c, 0x20, 0x7c, 0x20, 0x7c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x20, 0x5c, 0x5f, 0x2f, 0x20,
+  0x5c, 0x5f, 0x2f, 0x20, 0x5c, 0x5f, 0x2f, 0x20, 0x5c, 0x5f, 0x2f, 0x20,
+  0x5c, 0x0a, 0x20, 0x20, 0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x2f,
+  0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5c, 0x5f, 0x2f, 0x20, 0x5c, 0x5f,
+  0x2f, 0x20, 0x5c, 0x5f, 0x2f, 0x20, 0x5c, 0x5f, 0x2f, 0x20, 0x5c, 0x5f,
+  0x2f, 0x0a, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x7c, 0x20, 0x7c, 0x20, 0x7c,
+  0x20, 0x7c, 0x20, 0x7c, 0x20, 0x7c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x20, 0x5c, 0x5f, 0x2f, 0x20,
+  0x5c, 0x5f, 0x2f, 0x20, 0x5c, 0x5f, 0x2f, 0x20, 0x5c, 0x5f, 0x2f, 0x20,
+  0x5c, 0x0a, 0x20, 0x20, 0x20, 0x5c, 0x2f, 0x5c, 0x2f, 0x5c, 0x2f, 0x5c,
+  0x2f, 0x5c, 0x2f, 0x5c, 0x2f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5c, 0x5f, 0x2f, 0x20, 0x5c, 0x5f,
+  0x2f, 0x20, 0x5c, 0x5f, 0x2f, 0x20, 0x5c, 0x5f, 0x2f, 0x20, 0x5c, 0x5f,
+  0x2f, 0x0a, 0x00, 0x01, 0x4a, 0x00, 0xa5, 0x0f, 0x00, 0x47, 0x74, 0x72,
+  0x61, 0x64, 0x65, 0x5f, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x75, 0x65, 0x5f,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x00, 0x54, 0x72, 0x61, 0x64, 0x65, 0x20,
+  0x72, 0x65, 0x76, 0x65, 0x6e, 0x75, 0x65, 0x20, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x00, 0x54, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x75, 0x6c,
+  0x61, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x72,
+  0x61, 0x64, 0x65, 0x20, 0x61, 0x20, 0x63, 0x69, 0x74, 0x79, 0x20, 0x72,
+  0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x20, 0x61, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x72, 0x6f, 0x75, 0x74,
+  0x65, 0x2e, 0x20, 0x43, 0x4c, 0x41, 0x53, 0x53, 0x49, 0x43, 0x20, 0x72,
+  0x65, 0x76, 0x65, 0x6e, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x73, 0x75, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x74, 0x77, 0x6f, 0x20, 0x63, 0x69, 0x74, 0x79, 0x20, 0x73, 0x69, 0x7a,
+  0x65, 0x73, 0x20, 0x70, 0x6c, 0x75, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x62, 0x65, 0x74,
+  0x77, 0x65, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x2c, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x69,
+  0x65, 0x72, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6f, 0x76, 0x65, 0x72,
+  0x73, 0x65, 0x61, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x74,
+  0x65, 0x72, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x72,
+  0x6f, 0x75, 0x74, 0x65, 0x73, 0x2e, 0x20, 0x53, 0x49, 0x4d, 0x50, 0x4c,
+  0x45, 0x20, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x75, 0x65, 0x73, 0x20, 0x61,
+  0x72, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x6f, 0x72, 0x74, 0x69, 0x6f,
+  0x6e, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+  0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x77, 0x6f, 0x20,
+  0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x2e, 0x00, 0x02, 0x01, 0x3f, 0x00,
+  0xa5, 0x0f, 0x00, 0x48, 0x74, 0x72, 0x61, 0x64, 0x65, 0x6d, 0x69, 0x6e,
+  0x64, 0x69, 0x73, 0x74, 0x00, 0x4d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d,
+  0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x72, 0x6f, 0x75, 0x74,
+  0x65, 0x73, 0x00, 0x49, 0x6e, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x63, 0x69, 0x74, 0x69,
+  0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61,
+  0x6d, 0x65, 0x20, 0x63, 0x69, 0x76, 0x69, 0x6c, 0x69, 0x7a, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x65, 0x73, 0x74, 0x61, 0x62,
+  0x6c, 0x69, 0x73, 0x68, 0x20, 0x61, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65,
+  0x20, 0x72, 0x6f, 0x75, 0x74, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x79,
+  0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x74, 0x20,
+  0x6c, 0x65, 0x61, 0x73, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66,
+  0x61, 0x72, 0x20, 0x61, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x70, 0x2e, 0x20, 0x46, 0x6f, 0x72,
+  0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x67, 0x72, 0x69, 0x64,
+  0x73, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61,
+  0x6e, 0x63, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x61, 0x6c, 0x63, 0x75,
+  0x6c, 0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x22, 0x4d, 0x61,
+  0x6e, 0x68, 0x61, 0x74, 0x74, 0x61, 0x6e, 0x20, 0x64, 0x69, 0x73, 0x74,
+  0x61, 0x6e, 0x63, 0x65, 0x22, 0x2c, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+  0x69, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6d, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c,
+  0x61, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x6c, 0x6f,
+  0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x78, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x79, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x2e, 0x00, 0x02, 0x01, 0x44, 0x00, 0xa5, 0x0f, 0x00, 0x41, 0x74,
+  0x72, 0x61, 0x64, 0x65, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x72, 0x65, 0x6c,
+  0x70, 0x63, 0x74, 0x00, 0x48, 0x6f, 0x77, 0x20, 0x6c, 0x61, 0x72, 0x67,
+  0x65, 0x6c, 0x79, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x64, 0x69,
+  0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65,
+  0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x77, 0x6f,
+  0x72, 0x6c, 0x64, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x57, 0x68, 0x65,
+  0x6e, 0x20, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x69, 0x6e,
+  0x67, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x62, 0x65, 0x74, 0x77,
+  0x65, 0x65, 0x6e, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x2c, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+  0x20, 0x66, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x63, 0x61, 0x6e, 0x20,
+  0x62, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x6c, 0x79, 0x20, 0x6f, 0x72,
+  0x20, 0x66, 0x75, 0x6c, 0x6c, 0x79, 0x20, 0x72, 0x65, 0x6c, 0x61, 0x74,
+  0x69, 0x76, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64,
+  0x20, 0x73, 0x69, 0x7a, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20,
+  0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x65, 0x74, 0x65,
+  0x72, 0x6d, 0x69, 0x6e, 0x65, 0x73, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x62,
+  0x69, 0x67, 0x20, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x61, 0x67,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6f, 0x6e,
+  0x75, 0x73, 0x20, 0x63, 0x61, 0x6c, 0x63, 0x75, 0x6c, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69,
+  0x76, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x20,
+  0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x68, 0x6f,
+  0x77, 0x20, 0x6d, 0x75, 0x63, 0x68, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20,
+  0x61, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x20, 0x64, 0x69, 0x73,
+  0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x74, 0x65, 0x72,
+  0x73, 0x2e, 0x00, 0x02, 0x00, 0x68, 0x00, 0xa5, 0x0f, 0x00, 0x45, 0x74,
+  0x72, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x5f, 0x63, 0x69, 0x74, 0x79, 0x00,
+  0x43, 0x69, 0x74, 0x79, 0x20, 0x74, 0x72, 0x61, 0x64, 0x69, 0x6e, 0x67,
+  0x00, 0x49, 0x66, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x6f,
+  0x66, 0x66, 0x2c, 0x20, 0x74, 0x72, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20,
+  0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x64, 0x69, 0x70, 0x6c, 0x6f, 0x6d, 0x61, 0x63, 0x79, 0x20,
+  0x64, 0x69, 0x61, 0x6c, 0x6f, 0x67, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f,
+  0x74, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x2e, 0x00, 0x01,
+  0x00, 0x66, 0x00, 0xa5, 0x0f, 0x00, 0x44, 0x74, 0x72, 0x61, 0x64, 0x69,
+  0x6e, 0x67, 0x5f, 0x67, 0x6f, 0x6c, 0x69, 0x7a, 0x65, 0x00, 0x4d, 0x61,
+  0x78, 0x69, 0x6d, 0x75, 0x6d, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f,
+  0x66, 0x20, 0x61, 0x20, 0x63, 0x69, 0x74, 0x79, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x6f, 0x75, 0x74, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x00, 0x43,
+  0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x64, 0x6f, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x65, 0x20, 0x61, 0x6e, 0x79,
+  0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x61, 0x74, 0x20, 0x61, 0x6c,
+  0x6c, 0x20, 0x75, 0x6e, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x69, 0x72, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6c,
+  0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x74,
+  0x68, 0x69, 0x73, 0x20, 0x61, 0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x2e, 0x20,
+  0x54, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x65, 0x64,
+  0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x69, 0x6e, 0x63, 0x72, 0x65,
+  0x61, 0x73, 0x65, 0x73, 0x20, 0x67, 0x72, 0x61, 0x64, 0x75, 0x61, 0x6c,
+  0x6c, 0x79, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65,
+  0x73, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61,
+  0x6e, 0x20, 0x27, 0x6e, 0x6f, 0x74, 0x72, 0x61, 0x64, 0x65, 0x73, 0x69,
+  0x7a, 0x65, 0x27, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x6d, 0x61, 0x6c,
+  0x6c, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x27, 0x66, 0x75,
+  0x6c, 0x6c, 0x74, 0x72, 0x61, 0x64, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x27,
+  0x2e, 0x20, 0x53, 0x65, 0x65, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x27,
+  0x66, 0x75, 0x6c, 0x6c, 0x74, 0x72, 0x61, 0x64, 0x65, 0x73, 0x69, 0x7a,
+  0x65, 0x27, 0x2e, 0x00, 0x02, 0x00, 0x6d, 0x00, 0xa5, 0x07, 0x00, 0x15,
+  0x6e, 0x75, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x77, 0x69, 0x6e, 0x74, 0x65,
+  0x72, 0x00, 0x4e, 0x75, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20, 0x77, 0x69,
+  0x6e, 0x74, 0x65, 0x72, 0x00, 0x49, 0x66, 0x20, 0x74, 0x75, 0x72, 0x6e,
+  0x65, 0x64, 0x20, 0x6f, 0x66, 0x66, 0x2c, 0x20, 0x6e, 0x75, 0x63, 0x6c,
+  0x65, 0x61, 0x72, 0x20, 0x77, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x77,
+  0x69, 0x6c, 0x6c, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6f, 0x63, 0x63, 0x75,
+  0x72, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x75, 0x63, 0x6c, 0x65, 0x61, 0x72,
+  0x20, 0x77, 0x61, 0x72, 0x2e, 0x00, 0x00, 0x79, 0x00, 0xa5, 0x07, 0x00,
+  0x16, 0x6e, 0x75, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x77, 0x69, 0x6e, 0x74,
+  0x65, 0x72, 0x5f, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x00, 0x4e,
+  0x75, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20, 0x77, 0x69, 0x6e, 0x74, 0x65,
+  0x72, 0x20, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x00, 0x54, 0x68,
+  0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x6d, 0x75, 0x6c, 0x74,
+  0x69, 0x70, 0x6c, 0x69, 0x65, 0x72, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61,
+  0x63, 0x63, 0x75, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x6f, 0x66, 0x20, 0x6e, 0x75, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20, 0x77,
+  0x69, 0x6e, 0x74, 0x65, 0x72, 0x2e, 0x00, 0x01, 0x7e, 0x00, 0xa5, 0x0f,
+  0x00, 0x4d, 0x6f, 0x63, 0x63, 0x75, 0x70, 0x79, 0x63, 0x68, 0x61, 0x6e,
+  0x63, 0x65, 0x00, 0x43, 0x68, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x6d, 0x6f, 0x76, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e, 0x74, 0x6f,
+  0x20, 0x74, 0x69, 0x6c, 0x65, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20,
+  0x61, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x00, 0x49, 0x66, 0x20, 0x73, 0x65,
+  0x74, 0x20, 0x74, 0x6f, 0x20, 0x30, 0x2c, 0x20, 0x63, 0x6f, 0x6d, 0x62,
+  0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x43, 0x69, 0x76, 0x31, 0x2f, 0x32,
+  0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x28, 0x77, 0x68, 0x65, 0x6e,
+  0x20, 0x79, 0x6f, 0x75, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x2c,
+  0x20, 0x79, 0x6f, 0x75, 0x20, 0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x20,
+  0x69, 0x6e, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x29, 0x2e, 0x20, 0x49,
+  0x66, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x31, 0x30, 0x30,
+  0x2c, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x20,
+  0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x61,
+  0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x69,
+  0x6e, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x69, 0x6c, 0x65,
+  0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6b,
+  0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x79,
+  0x20, 0x77, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d,
+  0x62, 0x61, 0x74, 0x20, 0x28, 0x61, 0x6e, 0x64, 0x20, 0x6e, 0x6f, 0x20,
+  0x65, 0x6e, 0x65, 0x6d, 0x79, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20,
+  0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x29, 0x2e, 0x20, 0x49, 0x66, 0x20,
+  0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x30,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x31, 0x30, 0x30, 0x2c, 0x20, 0x74, 0x68,
+  0x69, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x75,
+  0x73, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+  0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x63,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x22, 0x6f, 0x63, 0x63, 0x75, 0x70, 0x79,
+  0x69, 0x6e, 0x67, 0x22, 0x20, 0x74, 0x65, 0x72, 0x72, 0x69, 0x74, 0x6f,
+  0x72, 0x79, 0x2e, 0x00, 0x03, 0x00, 0x55, 0x00, 0xa5, 0x0f, 0x00, 0x58,
+  0x6f, 0x6e, 0x73, 0x65, 0x74, 0x62, 0x61, 0x72, 0x62, 0x73, 0x00, 0x42,
+  0x61, 0x72, 0x62, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x20, 0x6f, 0x6e, 0x73,
+  0x65, 0x74, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x00, 0x42, 0x61, 0x72, 0x62,
+  0x61, 0x72, 0x69, 0x61, 0x6e, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20,
+  0x6e, 0x6f, 0x74, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x20, 0x62,
+  0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x74,
+  0x75, 0x72, 0x6e, 0x2e, 0x00, 0x03, 0x01, 0x3b, 0x00, 0xa5, 0x0f, 0x00,
+  0x21, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x74, 0x72,
+  0x65, 0x61, 0x64, 0x79, 0x00, 0x57, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x52, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x65, 0x73, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x61, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x20,
+  0x67, 0x65, 0x74, 0x73, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x74, 0x6f, 0x67,
+  0x67, 0x6c, 0x65, 0x64, 0x20, 0x6f, 0x66, 0x66, 0x00, 0x49, 0x6e, 0x20,
+  0x70, 0x72, 0x65, 0x2d, 0x67, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x75, 0x73,
+  0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x6e,
+  0x65, 0x77, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x20, 0x6a,
+  0x6f, 0x69, 0x6e, 0x20, 0x6f, 0x72, 0x20, 0x6f, 0x6c, 0x64, 0x20, 0x6f,
+  0x6e, 0x65, 0x73, 0x20, 0x6c, 0x65, 0x61, 0x76, 0x65, 0x2c, 0x20, 0x74,
+  0x68, 0x6f, 0x73, 0x65, 0x20, 0x77, 0x68, 0x6f, 0x20, 0x68, 0x61, 0x76,
+  0x65, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x61, 0x63,
+  0x63, 0x65, 0x70, 0x74, 0x65, 0x64, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x20,
+  0x74, 0x6f, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x62, 0x79, 0x20,
+  0x74, 0x6f, 0x67, 0x67, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x22, 0x52, 0x65,
+  0x61, 0x64, 0x79, 0x22, 0x20, 0x67, 0x65, 0x74, 0x20, 0x74, 0x68, 0x61,
+  0x74, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65,
+  0x64, 0x20, 0x6f, 0x66, 0x66, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x20, 0x73, 0x69, 0x74,
+  0x75, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73,
+  0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x61, 0x6e,
+  0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20,
+  0x6d, 0x61, 0x6b, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x65,
+  0x73, 0x73, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x70, 0x65, 0x72, 0x73,
+  0x69, 0x73, 0x74, 0x65, 0x6e, 0x74, 0x2e, 0x00, 0x06, 0x00, 0xbc, 0x00,
+  0xa5, 0x0f, 0x00, 0x77, 0x70, 0x68, 0x61, 0x73, 0x65, 0x6d, 0x6f, 0x64,
+  0x65, 0x00, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x6f, 0x66,
+  0x20, 0x73, 0x69, 0x6d, 0x75, 0x6c, 0x74, 0x61, 0x6e, 0x65, 0x6f, 0x75,
+  0x73, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x2f, 0x74, 0x65, 0x61,
+  0x6d, 0x20, 0x70, 0x68, 0x61, 0x73, 0x65, 0x73, 0x00, 0x54, 0x68, 0x69,
+  0x73, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f,
+  0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68,
+  0x65, 0x72, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x20, 0x6d,
+  0x61, 0x79, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x73, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d,
+  0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6e,
+  0x67, 0x20, 0x61, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x2e, 0x20, 0x43, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x65, 0x74, 0x74,
+  0x69, 0x6e, 0x67, 0x20, 0x74, 0x61, 0x6b, 0x65, 0x73, 0x20, 0x65, 0x66,
+  0x66, 0x65, 0x63, 0x74, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x74, 0x75,
+  0x72, 0x6e, 0x2e, 0x00, 0x05, 0x00, 0x7b, 0x00, 0xa5, 0x0f, 0x00, 0x7b,
+  0x70, 0x69, 0x6e, 0x67, 0x74, 0x69, 0x6d, 0x65, 0x00, 0x53, 0x65, 0x63,
+  0x6f, 0x6e, 0x64, 0x73, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e,
+  0x20, 0x50, 0x49, 0x4e, 0x47, 0x73, 0x00, 0x54, 0x68, 0x65, 0x20, 0x73,
+  0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x70,
+  0x6f, 0x6c, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6c, 0x69, 0x65,
+  0x6e, 0x74, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x50,
+  0x49, 0x4e, 0x47, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x20,
+  0x65, 0x61, 0x63, 0x68, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x74, 0x68,
+  0x69, 0x73, 0x20, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x20, 0x65, 0x6c,
+  0x61, 0x70, 0x73, 0x65, 0x73, 0x2e, 0x00, 0x06, 0x00, 0x76, 0x00, 0xa5,
+  0x0f, 0x00, 0x7c, 0x70, 0x69, 0x6e, 0x67, 0x74, 0x69, 0x6d, 0x65, 0x6f,
+  0x75, 0x74, 0x00, 0x54, 0x69, 0x6d, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x63,
+  0x75, 0x74, 0x20, 0x61, 0x20, 0x63, 0x6c, 0x69, 0x65, 0x6e, 0x74, 0x00,
+  0x49, 0x66, 0x20, 0x61, 0x20, 0x63, 0x6c, 0x69, 0x65, 0x6e, 0x74, 0x20,
+  0x64, 0x6f, 0x65, 0x73, 0x6e, 0x27, 0x74, 0x20, 0x72, 0x65, 0x70, 0x6c,
+  0x79, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x50, 0x49, 0x4e, 0x47, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x74, 0x69, 0x6d, 0x65,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6c, 0x69, 0x65, 0x6e, 0x74, 0x20,
+  0x69, 0x73, 0x20, 0x64, 0x69, 0x73, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63,
+  0x74, 0x65, 0x64, 0x2e, 0x00, 0x06, 0x04, 0x9f, 0x00, 0xa5, 0x0f, 0x00,
+  0x56, 0x70, 0x6c, 0x72, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x6d, 0x6f, 0x64,
+  0x65, 0x00, 0x48, 0x6f, 0x77, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x69, 0x63,
+  0x6b, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x73, 0x00, 0x54, 0x68, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74,
+  0x74, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6d, 0x69,
+  0x6e, 0x65, 0x73, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x70, 0x6c, 0x61, 0x79,
+  0x65, 0x72, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x20, 0x61, 0x72,
+  0x65, 0x20, 0x63, 0x68, 0x6f, 0x73, 0x65, 0x6e, 0x2e, 0x20, 0x50, 0x6c,
+  0x61, 0x79, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x20,
+  0x61, 0x72, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x4e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20,
+  0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x2c, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x62, 0x6f, 0x72,
+  0x64, 0x65, 0x72, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6d, 0x61, 0x70, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x6f, 0x20,
+  0x6f, 0x6e, 0x2e, 0x0a, 0x2d, 0x20, 0x22, 0x50, 0x65, 0x72, 0x2d, 0x70,
+  0x6c, 0x61, 0x79, 0x65, 0x72, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x6f, 0x72,
+  0x64, 0x65, 0x72, 0x22, 0x20, 0x28, 0x50, 0x4c, 0x52, 0x5f, 0x4f, 0x52,
+  0x44, 0x45, 0x52, 0x29, 0x3a, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x73,
+  0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x65,
+  0x64, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x76, 0x69, 0x64,
+  0x75, 0x61, 0x6c, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x20,
+  0x69, 0x6e, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x20, 0x61, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x64, 0x65, 0x66,
+  0x00, 0xe3, 0x03, 0x08, 0x00, 0x64, 0x00, 0x08, 0x00, 0xe3, 0x03, 0x09,
+  0x00, 0xc8, 0x00, 0x20, 0x00, 0xf6, 0x02, 0x04, 0x45, 0x73, 0x74, 0x61,
+  0x62, 0x6c, 0x69, 0x73, 0x68, 0x20, 0x25, 0x73, 0x45, 0x6d, 0x62, 0x61,
+  0x73, 0x73, 0x79, 0x25, 0x73, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1d,
+  0x00, 0xf6, 0x23, 0x00, 0x01, 0x42, 0x65, 0x63, 0x6f, 0x6d, 0x25, 0x73,
+  0x65, 0x20, 0x41, 0x6d, 0x62, 0x61, 0x73, 0x73, 0x61, 0x64, 0x6f, 0x72,
+  0x25, 0x73, 0x00, 0x00, 0x1d, 0x00, 0xf6, 0x0b, 0x00, 0x02, 0x25, 0x73,
+  0x49, 0x6e, 0x76, 0x65, 0x73, 0x74, 0x69, 0x67, 0x61, 0x74, 0x65, 0x20,
+  0x43, 0x69, 0x74, 0x79, 0x25, 0x73, 0x00, 0x01, 0x00, 0x2e, 0x00, 0xf6,
+  0x23, 0x00, 0x03, 0x25, 0x73, 0x49, 0x6e, 0x76, 0x65, 0x73, 0x74, 0x69,
+  0x67, 0x61, 0x74, 0x65, 0x20, 0x43, 0x69, 0x74, 0x79, 0x20, 0x28, 0x73,
+  0x70, 0x65, 0x6e, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x6e,
+  0x69, 0x74, 0x29, 0x25, 0x73, 0x00, 0x00, 0x18, 0x00, 0xf6, 0x2b, 0x00,
+  0x04, 0x25, 0x73, 0x50, 0x6f, 0x69, 0x73, 0x6f, 0x6e, 0x20, 0x43, 0x69,
+  0x74, 0x79, 0x25, 0x73, 0x00, 0x02, 0x00, 0x07, 0x00, 0xf6, 0x01, 0x00,
+  0x05, 0x00, 0x17, 0x00, 0xf6, 0x2b, 0x00, 0x06, 0x53, 0x74, 0x65, 0x61,
+  0x6c, 0x20, 0x25, 0x73, 0x47, 0x6f, 0x6c, 0x64, 0x25, 0x73, 0x00, 0x03,
+  0x00, 0x21, 0x00, 0xf6, 0x03, 0x00, 0x07, 0x53, 0x74, 0x65, 0x61, 0x6c,
+  0x20, 0x25, 0x73, 0x47, 0x6f, 0x6c, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x45, 0x73, 0x63, 0x61, 0x70, 0x65, 0x25, 0x73, 0x00, 0x00, 0x1a, 0x00,
+  0xf6, 0x2b, 0x00, 0x08, 0x25, 0x73, 0x53, 0x61, 0x62, 0x6f, 0x74, 0x61,
+  0x67, 0x65, 0x20, 0x43, 0x69, 0x74, 0x79, 0x25, 0x73, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0xf6, 0x03, 0x00, 0x09, 0x25, 0x73, 0x53, 0x61, 0x62, 0x6f,
+  0x74, 0x61, 0x67, 0x65, 0x20, 0x43, 0x69, 0x74, 0x79, 0x20, 0x45, 0x73,
+  0x63, 0x61, 0x70, 0x65, 0x25, 0x73, 0x00, 0x00, 0x21, 0x00, 0xf6, 0x2b,
+  0x01, 0x0a, 0x49, 0x6e, 0x64, 0x75, 0x73, 0x74, 0x72, 0x69, 0x61, 0x25,
+  0x73, 0x6c, 0x20, 0x53, 0x61, 0x62, 0x6f, 0x74, 0x61, 0x67, 0x65, 0x25,
+  0x73, 0x00, 0x05, 0x01, 0x00, 0x1f, 0x00, 0xf6, 0x03, 0x00, 0x0b, 0x49,
+  0x6e, 0x64, 0x75, 0x73, 0x74, 0x72, 0x69, 0x61, 0x6c, 0x20, 0x25, 0x73,
+  0x53, 0x61, 0x62, 0x6f, 0x74, 0x61, 0x67, 0x65, 0x25, 0x73, 0x00, 0x00,
+  0x2c, 0x00, 0xf6, 0x2b, 0x01, 0x0c, 0x49, 0x6e, 0x64, 0x75, 0x73, 0x74,
+  0x72, 0x69, 0x61, 0x25, 0x73, 0x6c, 0x20, 0x53, 0x61, 0x62, 0x6f, 0x74,
+  0x61, 0x67, 0x65, 0x20, 0x50, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x25, 0x73, 0x00, 0x06, 0x00, 0x00, 0x2a, 0x00, 0xf6, 0x03,
+  0x00, 0x0d, 0x49, 0x6e, 0x64, 0x75, 0x73, 0x74, 0x72, 0x69, 0x61, 0x6c,
+  0x20, 0x25, 0x73, 0x53, 0x61, 0x62, 0x6f, 0x74, 0x61, 0x67, 0x65, 0x20,
+  0x50, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x25, 0x73,
+  0x00, 0x00, 0x1d, 0x00, 0xf6, 0x2b, 0x00, 0x0e, 0x53, 0x74, 0x65, 0x61,
+  0x6c, 0x20, 0x25, 0x73, 0x54, 0x65, 0x63, 0x68, 0x6e, 0x6f, 0x6c, 0x6f,
+  0x67, 0x79, 0x25, 0x73, 0x00, 0x07, 0x00, 0x27, 0x00, 0xf6, 0x03, 0x00,
+  0x0f, 0x53, 0x74, 0x65, 0x61, 0x6c, 0x20, 0x25, 0x73, 0x54, 0x65, 0x63,
+  0x68, 0x6e, 0x6f, 0x6c, 0x6f, 0x67, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x45, 0x73, 0x63, 0x61, 0x70, 0x65, 0x25, 0x73, 0x00, 0x00, 0x22, 0x00,
+  0xf6, 0x2b, 0x01, 0x10, 0x49, 0x6e, 0x25, 0x73, 0x64, 0x75, 0x73, 0x74,
+  0x72, 0x69, 0x61, 0x6c, 0x20, 0x45, 0x73, 0x70, 0x69, 0x6f, 0x6e, 0x61,
+  0x67, 0x65, 0x25, 0x73, 0x00, 0x08, 0x02, 0x00, 0x20, 0x00, 0xf6, 0x03,
+  0x00, 0x11, 0x49, 0x6e, 0x64, 0x75, 0x73, 0x25, 0x73, 0x74, 0x72, 0x69,
+  0x61, 0x6c, 0x20, 0x45, 0x73, 0x70, 0x69, 0x6f, 0x6e, 0x61, 0x67, 0x65,
+  0x25, 0x73, 0x00, 0x00, 0x1d, 0x00, 0xf6, 0x2b, 0x01, 0x12, 0x49, 0x6e,
+  0x63, 0x69, 0x74, 0x65, 0x20, 0x61, 0x20, 0x25, 0x73, 0x52, 0x65, 0x76,
+  0x6f, 0x6c, 0x74, 0x25, 0x73, 0x00, 0x09, 0x00, 0x00, 0x26, 0x00, 0xf6,
+  0x03, 0x00, 0x13, 0x49, 0x6e, 0x63, 0x69, 0x74, 0x65, 0x20, 0x61, 0x20,
+  0x52, 0x65, 0x25, 0x73, 0x76, 0x6f, 0x6c, 0x74, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x45, 0x73, 0x63, 0x61, 0x70, 0x65, 0x25, 0x73, 0x00, 0x00, 0x22,
+  0x00, 0xf6, 0x2b, 0x00, 0x14, 0x45, 0x73, 0x74, 0x61, 0x62, 0x6c, 0x69,
+  0x73, 0x68, 0x20, 0x54, 0x72, 0x61, 0x64, 0x65, 0x20, 0x25, 0x73, 0x52,
+  0x6f, 0x75, 0x74, 0x65, 0x25, 0x73, 0x00, 0x0a, 0x00, 0x1e, 0x00, 0xf6,
+  0x2b, 0x00, 0x15, 0x45, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x25, 0x73, 0x4d,
+  0x61, 0x72, 0x6b, 0x65, 0x74, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x25, 0x73,
+  0x00, 0x0b, 0x00, 0x1e, 0x00, 0xf6, 0x2b, 0x00, 0x16, 0x48, 0x65, 0x6c,
+  0x70, 0x20, 0x25, 0x73, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x57, 0x6f,
+  0x6e, 0x64, 0x65, 0x72, 0x25, 0x73, 0x00, 0x0c, 0x00, 0x1e, 0x00, 0xf6,
+  0x8b, 0x00, 0x17, 0x25, 0x73, 0x42, 0x72, 0x69, 0x62, 0x65, 0x20, 0x45,
+  0x6e, 0x65, 0x6d, 0x79, 0x20, 0x55, 0x6e, 0x69, 0x74, 0x25, 0x73, 0x00,
+  0x0d, 0x01, 0x00, 0x1f, 0x00, 0xf6, 0x8b, 0x02, 0x18, 0x25, 0x73, 0x43,
+  0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x20, 0x55, 0x6e, 0x69, 0x74, 0x73,
+  0x25, 0x73, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x25, 0x00,
+  0xf6, 0xab, 0x02, 0x19, 0x53, 0x25, 0x73, 0x61, 0x62, 0x6f, 0x74, 0x61,
+  0x67, 0x65, 0x20, 0x45, 0x6e, 0x65, 0x6d, 0x79, 0x20, 0x55, 0x6e, 0x69,
+  0x74, 0x25, 0x73, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0xf6, 0x03, 0x00, 0x1a, 0x25, 0x73, 0x53, 0x61, 0x62, 0x6f, 0x74,
+  0x61, 0x67, 0x65, 0x20, 0x45, 0x6e, 0x65, 0x6d, 0x79, 0x20, 0x55, 0x6e,
+  0x69, 0x74, 0x25, 0x73, 0x00, 0x00, 0x1c, 0x00, 0xf6, 0xab, 0x04, 0x1b,
+  0x25, 0x73, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x43, 0x69, 0x74, 0x79,
+  0x25, 0x73, 0x00, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0xf6, 0xab, 0x04, 0x1c, 0x25, 0x73, 0x41, 0x64, 0x64, 0x20, 0x74, 0x6f,
+  0x20, 0x43, 0x69, 0x74, 0x79, 0x25, 0x73, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x17, 0x00, 0xf6, 0x2b, 0x00, 0x1d, 0x53, 0x74, 0x65,
+  0x61, 0x6c, 0x20, 0x25, 0x73, 0x4d, 0x61, 0x70, 0x73, 0x25, 0x73, 0x00,
+  0x12, 0x00, 0x21, 0x00, 0xf6, 0x03, 0x00, 0x1e, 0x53, 0x74, 0x65, 0x61,
+  0x6c, 0x20, 0x25, 0x73, 0x4d, 0x61, 0x70, 0x73, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x45, 0x73, 0x63, 0x61, 0x70, 0x65, 0x25, 0x73, 0x00, 0x00, 0x1a,
+  0x00, 0xf6, 0x2b, 0x00, 0x1f, 0x53, 0x75, 0x69, 0x74, 0x63, 0x61, 0x73,
+  0x65, 0x20, 0x25, 0x73, 0x4e, 0x75, 0x6b, 0x65, 0x25, 0x73, 0x00, 0x14,
+  0x00, 0x24, 0x00, 0xf6, 0x03, 0x00, 0x20, 0x53, 0x75, 0x69, 0x74, 0x63,
+  0x61, 0x73, 0x65, 0x20, 0x25, 0x73, 0x4e, 0x75, 0x6b, 0x65, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x45, 0x73, 0x63, 0x61, 0x70, 0x65, 0x25, 0x73, 0x00,
+  0x00, 0x39, 0x00, 0xf6, 0xab, 0x0c, 0x21, 0x45, 0x78, 0x70, 0x6c, 0x6f,
+  0x64, 0x65, 0x20, 0x25, 0x73, 0x4e, 0x75, 0x63, 0x6c, 0x65, 0x61, 0x72,
+  0x20, 0x49, 0x6e, 0x20, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x25, 0x73, 0x00,
+  0x15, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0xf6, 0xa3, 0x06, 0x22, 0x25, 0x73, 0x4e, 0x75, 0x6b, 0x65, 0x20, 0x43,
+  0x69, 0x74, 0x79, 0x25, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x18, 0x00, 0xf6, 0xab, 0x00, 0x23, 0x25, 0x73,
+  0x4e, 0x75, 0x6b, 0x65, 0x20, 0x55, 0x6e, 0x69, 0x74, 0x73, 0x25, 0x73,
+  0x00, 0x16, 0x02, 0x00, 0x2d, 0x00, 0xf6, 0x8b, 0x0a, 0x24, 0x44, 0x65,
+  0x73, 0x74, 0x72, 0x6f, 0x79, 0x20, 0x25, 0x73, 0x43, 0x69, 0x74, 0x79,
+  0x25, 0x73, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x00, 0xf6, 0x8b, 0x00, 0x25, 0x25, 0x73, 0x45, 0x78, 0x70,
+  0x65, 0x6c, 0x20, 0x55, 0x6e, 0x69, 0x74, 0x25, 0x73, 0x00, 0x18, 0x01,
+  0x00, 0x3a, 0x00, 0xf6, 0xab, 0x08, 0x26, 0x44, 0x69, 0x73, 0x25, 0x73,
+  0x62, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x76, 0x65, 0x72,
+  0x69, 0x6e, 0x67, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x25, 0x73, 0x00, 0x19, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46,
+  0x00, 0xf6, 0xab, 0x0c, 0x27, 0x44, 0x69, 0x73, 0x25, 0x73, 0x62, 0x61,
+  0x6e, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x72,
+  0x65, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x70, 0x72,
+  0x6f, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x25, 0x73, 0x00, 0x1a,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0xf6,
+  0x8b, 0x08, 0x28, 0x53, 0x65, 0x74, 0x20, 0x25, 0x73, 0x48, 0x6f, 0x6d,
+  0x65, 0x20, 0x43, 0x69, 0x74, 0x79, 0x25, 0x73, 0x00, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1b, 0x00, 0xf6, 0x8b, 0x00, 0x29, 0x4d, 0x61, 0x6b,
+  0x65, 0x20, 0x25, 0x73, 0x48, 0x6f, 0x6d, 0x65, 0x6c, 0x65, 0x73, 0x73,
+  0x25, 0x73, 0x00, 0x3c, 0x05, 0x00, 0x1a, 0x00, 0xf6, 0x8b, 0x00, 0x2a,
+  0x25, 0x73, 0x55, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x20, 0x55, 0x6e,
+  0x69, 0x74, 0x25, 0x73, 0x00, 0x1c, 0x00, 0x00, 0x1a, 0x00, 0xf6, 0x8b,
+  0x00, 0x2b, 0x25, 0x73, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x20,
+  0x55, 0x6e, 0x69, 0x74, 0x25, 0x73, 0x00, 0x2a, 0x05, 0x00, 0x25, 0x00,
+  0xf6, 0x8b, 0x06, 0x2c, 0x25, 0x73, 0x41, 0x69, 0x72, 0x6c, 0x69, 0x66,
+  0x74, 0x20, 0x74, 0x6f, 0x20, 0x43, 0x69, 0x74, 0x79, 0x25, 0x73, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xf4, 0x11, 0x00, 0x27,
+  0x00, 0xf6, 0x8b, 0x0c, 0x2d, 0x25, 0x73, 0x41, 0x74, 0x74, 0x61, 0x63,
+  0x6b, 0x25, 0x73, 0x00, 0x1f, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x01, 0x0e, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0xf6, 0x23, 0x00, 0x2e, 0x25, 0x73, 0x45, 0x78,
+  0x70, 0x6c, 0x6f, 0x64, 0x65, 0x20, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c,
+  0x65, 0x25, 0x73, 0x00, 0x00, 0x36, 0x00, 0xf6, 0x8b, 0x09, 0x2f, 0x53,
+  0x75, 0x72, 0x67, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x53, 0x74, 0x72, 0x25,
+  0x73, 0x69, 0x6b, 0x65, 0x20, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x69, 0x6e,
+  0x67, 0x25, 0x73, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+  0x00, 0xf6, 0x0b, 0x01, 0x30, 0x53, 0x75, 0x72, 0x67, 0x69, 0x63, 0x61,
+  0x6c, 0x20, 0x53, 0x74, 0x72, 0x25, 0x73, 0x69, 0x6b, 0x65, 0x20, 0x50,
+  0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x25, 0x73, 0x00,
+  0x21, 0x00, 0x00, 0x28, 0x00, 0xf6, 0x0b, 0x08, 0x31, 0x25, 0x73, 0x43,
+  0x6f, 0x6e, 0x71, 0x75, 0x65, 0x72, 0x20, 0x43, 0x69, 0x74, 0x79, 0x25,
+  0x73, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x60, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xf6, 0x07, 0x00,
+  0x32, 0x25, 0x73, 0x43, 0x6f, 0x6e, 0x71, 0x75, 0x65, 0x72, 0x20, 0x43,
+  0x69, 0x74, 0x79, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x6e, 0x6f, 0x6e,
+  0x20, 0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x25, 0x73, 0x00, 0x00, 0x27,
+  0x00, 0xf6, 0x03, 0x08, 0x33, 0x25, 0x73, 0x43, 0x6f, 0x6e, 0x71, 0x75,
+  0x65, 0x72, 0x20, 0x43, 0x69, 0x74, 0x79, 0x25, 0x73, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0xf6, 0x01, 0x00, 0x34, 0x00, 0x25, 0x00, 0xf6,
+  0x9b, 0x08, 0x35, 0x25, 0x73, 0x42, 0x6f, 0x6d, 0x62, 0x61, 0x72, 0x64,
+  0x25, 0x73, 0x00, 0x13, 0x08, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0xf6, 0x03, 0x08, 0x36, 0x42, 0x25, 0x73, 0x6f, 0x6d, 0x62, 0x61, 0x72,
+  0x64, 0x20, 0x32, 0x25, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0xf6, 0x03, 0x00, 0x37, 0x42, 0x25, 0x73, 0x6f, 0x6d, 0x62, 0x61, 0x72,
+  0x64, 0x20, 0x33, 0x25, 0x73, 0x00, 0x00, 0x1b, 0x00, 0xf6, 0x13, 0x00,
+  0x38, 0x4c, 0x65, 0x74, 0x68, 0x61, 0x6c, 0x20, 0x42, 0x25, 0x73, 0x6f,
+  0x6d, 0x62, 0x61, 0x72, 0x64, 0x25, 0x73, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0xf6, 0x8b, 0x06, 0x39, 0x25, 0x73, 0x46, 0x6f, 0x72, 0x74, 0x69, 0x66,
+  0x79, 0x25, 0x73, 0x00, 0x28, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x26, 0x00, 0xf6, 0x8b, 0x00, 0x3a, 0x54, 0x72, 0x61,
+  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x62, 0x79, 0x20, 0x25, 0x73,
+  0x43, 0x75, 0x6c, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x25,
+  0x73, 0x00, 0x25, 0x03, 0x00, 0x22, 0x00, 0xf6, 0x0b, 0x00, 0x3b, 0x54,
+  0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x68, 0x65, 0x20, 0x69, 0x73, 0x6c,
+  0x61, 0x6e, 0x64, 0x73, 0x27, 0x20, 0x65, 0x63, 0x6f, 0x6e, 0x6f, 0x6d,
+  0x79, 0x20, 0x69, 0x73, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x6f,
+  0x6e, 0x20, 0x6f, 0x69, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x73,
+  0x20, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x6c, 0x79, 0x20,
+  0x64, 0x65, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 0x64, 0x20, 0x77, 0x68,
+  0x65, 0x6e, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 0x64, 0x20,
+  0x74, 0x6f, 0x20, 0x69, 0x74, 0x73, 0x20, 0x43, 0x61, 0x72, 0x69, 0x62,
+  0x62, 0x65, 0x61, 0x6e, 0x20, 0x6e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f,
+  0x72, 0x73, 0x2e, 0x20, 0x54, 0x72, 0x69, 0x6e, 0x69, 0x64, 0x61, 0x64,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x54, 0x6f, 0x62, 0x61, 0x67, 0x6f, 0x20,
+  0x69, 0x73, 0x20, 0x66, 0x61, 0x6d, 0x6f, 0x75, 0x73, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6d, 0x75, 0x73, 0x69, 0x63, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x69, 0x74, 0x73, 0x20, 0x43, 0x61, 0x72, 0x6e,
+  0x69, 0x76, 0x61, 0x6c, 0x2e, 0x00, 0x02, 0x08, 0x52, 0x61, 0x6c, 0x70,
+  0x68, 0x20, 0x41, 0x62, 0x65, 0x72, 0x63, 0x72, 0x6f, 0x6d, 0x62, 0x79,
+  0x00, 0x4a, 0x65, 0x61, 0x6e, 0x20, 0x42, 0x61, 0x70, 0x74, 0x69, 0x73,
+  0x74, 0x65, 0x20, 0x50, 0x68, 0x69, 0x6c, 0x6c, 0x69, 0x70, 0x65, 0x00,
+  0x42, 0x75, 0x7a, 0x7a, 0x20, 0x42, 0x75, 0x74, 0x6c, 0x65, 0x72, 0x00,
+  0x41, 0x6c, 0x62, 0x65, 0x72, 0x74, 0x20, 0x47, 0x6f, 0x6d, 0x65, 0x73,
+  0x00, 0x45, 0x72, 0x69, 0x63, 0x20, 0x57, 0x69, 0x6c, 0x6c, 0x69, 0x61,
+  0x6d, 0x73, 0x00, 0x45, 0x6c, 0x6c, 0x69, 0x73, 0x20, 0x43, 0x6c, 0x61,
+  0x72, 0x6b, 0x65, 0x00, 0x41, 0x2e, 0x20, 0x4e, 0x2e, 0x20, 0x52, 0x2e,
+  0x20, 0x52, 0x6f, 0x62, 0x69, 0x6e, 0x73, 0x6f, 0x6e, 0x00, 0x4b, 0x61,
+  0x6d, 0x6c, 0x61, 0x20, 0x50, 0x65, 0x72, 0x73, 0x61, 0x64, 0x2d, 0x42,
+  0x69, 0x73, 0x73, 0x65, 0x73, 0x73, 0x61, 0x72, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x03, 0x05, 0x09, 0x01,
+  0xb0, 0x00, 0x94, 0xff, 0xef, 0x03, 0x01, 0xf8, 0x66, 0x72, 0x65, 0x65,
+  0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00,
+  0x54, 0x73, 0x77, 0x61, 0x6e, 0x61, 0x00, 0x54, 0x73, 0x77, 0x61, 0x6e,
+  0x61, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x42, 0x61,
+  0x74, 0x73, 0x77, 0x61, 0x6e, 0x61, 0x00, 0x62, 0x6f, 0x70, 0x68, 0x75,
+  0x74, 0x68, 0x61, 0x74, 0x73, 0x77, 0x61, 0x6e, 0x61, 0x00, 0x2d, 0x00,
+  0x54, 0x68, 0x65, 0x20, 0x42, 0x61, 0x74, 0x73, 0x77, 0x61, 0x6e, 0x61,
+  0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x20, 0x42, 0x61, 0x6e, 0x74, 0x75,
+  0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x53,
+  0x6f, 0x75, 0x74, 0x68, 0x65, 0x72, 0x6e, 0x20, 0x41, 0x66, 0x72, 0x69,
+  0x63, 0x61, 0x2e, 0x20, 0x57, 0x69, 0x74, 0x68, 0x20, 0x61, 0x62, 0x6f,
+  0x75, 0x74, 0x20, 0x32, 0x30, 0x25, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x64, 0x6f, 0x6d, 0x69, 0x6e, 0x61, 0x6e, 0x74, 0x20, 0x65,
+  0x74, 0x68, 0x6e, 0x69, 0x63, 0x69, 0x74, 0x79, 0x20, 0x6f, 0x66, 0x20,
+  0x42, 0x6f, 0x74, 0x73, 0x77, 0x61, 0x6e, 0x61, 0x2c, 0x20, 0x77, 0x68,
+  0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x64,
+  0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x2e,
+  0x20, 0x49, 0x6e, 0x20, 0x53, 0x6f, 0x75, 0x74, 0x68, 0x20, 0x41, 0x66,
+  0x72, 0x69, 0x63, 0x61, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x20, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x20, 0x66, 0x6f,
+  0x75, 0x72, 0x20, 0x6d, 0x69, 0x6c, 0x6c, 0x69, 0x6f, 0x6e, 0x20, 0x42,
+  0x61, 0x74, 0x73, 0x77, 0x61, 0x6e, 0x61, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41, 0x70, 0x61, 0x72, 0x74,
+  0x68, 0x65, 0x69, 0x64, 0x20, 0x65, 0x72, 0x61, 0x20, 0x74, 0x68, 0x65,
+  0x79, 0x20, 0x68, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x42, 0x61,
+  0x6e, 0x74, 0x75, 0x73, 0x74, 0x61, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x42,
+  0x6f, 0x70, 0x68, 0x75, 0x74, 0x68, 0x61, 0x74, 0x73, 0x77, 0x61, 0x6e,
+  0x61, 0x2e, 0x00, 0x02, 0x06, 0x53, 0x65, 0x62, 0x65, 0x6c, 0x65, 0x00,
+  0x42, 0x61, 0x74, 0x68, 0x6f, 0x65, 0x6e, 0x00, 0x4b, 0x68, 0x61, 0x6d,
+  0x61, 0x20, 0x49, 0x49, 0x49, 0x00, 0x4c, 0x75, 0x63, 0x61, 0x73, 0x20,
+  0x4d, 0x61, 0x6e, 0x67, 0x6f, 0x70, 0x65, 0x00, 0x46, 0x72, 0x61, 0x6e,
+  0x63, 0x65, 0x73, 0x20, 0x42, 0x61, 0x61, 0x72, 0x64, 0x00, 0x53, 0x65,
+  0x72, 0x65, 0x74, 0x73, 0x65, 0x20, 0x4b, 0x68, 0x61, 0x6d, 0x61, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x04, 0x09, 0x02,
+  0x74, 0x00, 0x94, 0xff, 0xef, 0x03, 0x01, 0xf9, 0x66, 0x72, 0x65, 0x65,
+  0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00,
+  0x54, 0x75, 0x61, 0x72, 0x65, 0x67, 0x00, 0x54, 0x75, 0x61, 0x72, 0x65,
+  0x67, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x54, 0x75,
+  0x61, 0x72, 0x65, 0x67, 0x73, 0x00, 0x74, 0x75, 0x61, 0x72, 0x65, 0x67,
+  0x00, 0x2d, 0x00, 0x54, 0x68, 0x65, 0x20, 0x54, 0x75, 0x61, 0x72, 0x65,
+  0x67, 0x20, 0x6f, 0x72, 0x20, 0x49, 0x6d, 0x75, 0x68, 0x61, 0x67, 0x68,
+  0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x20, 0x70, 0x61, 0x73, 0x74, 0x6f,
+  0x72, 0x61, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6e, 0x6f, 0x6d, 0x61, 0x64,
+  0x69, 0x63, 0x20, 0x42, 0x65, 0x72, 0x62, 0x65, 0x72, 0x20, 0x70, 0x65,
+  0x6f, 0x70, 0x6c, 0x65, 0x20, 0x69, 0x6e, 0x68, 0x61, 0x62, 0x69, 0x74,
+  0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x74, 0x65,
+  0x72, 0x69, 0x6f, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x53, 0x61, 0x68, 0x61, 0x72, 0x61, 0x20, 0x44, 0x65, 0x73, 0x65, 0x72,
+  0x74, 0x2c, 0x20, 0x6d, 0x6f, 0x73, 0x74, 0x6c, 0x79, 0x20, 0x69, 0x6e,
+  0x20, 0x41, 0x6c, 0x67, 0x65, 0x72, 0x69, 0x61, 0x2c, 0x20, 0x4e, 0x69,
+  0x67, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x4d, 0x61, 0x6c, 0x69,
+  0x2e, 0x20, 0x44, 0x65, 0x73, 0x70, 0x69, 0x74, 0x65, 0x20, 0x74, 0x68,
+  0x65, 0x69, 0x72, 0x20, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x6c, 0x69, 0x6e,
+  0x65, 0x61, 0x6c, 0x20, 0x6f, 0x72, 0x67, 0x61, 0x6e, 0x69, 0x7a, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72,
+  0x65, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x49, 0x73, 0x6c, 0x61, 0x6d, 0x2e, 0x20, 0x46, 0x6f,
+  0x72, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75,
+  0x72, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x65, 0x6e,
+  0x67, 0x61, 0x67, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x6c, 0x61,
+  0x76, 0x65, 0x20, 0x68, 0x75, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x2c, 0x20,
+  0x65, 0x76, 0x65, 0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6c, 0x75, 0x65, 0x6e,
+  0x63, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6c, 0x61,
+  0x76, 0x65, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x74, 0x6f, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x73,
+  0x2e, 0x00, 0x02, 0x10, 0x41, 0x6d, 0x61, 0x74, 0x74, 0x61, 0x7a, 0x61,
+  0x00, 0x41, 0x62, 0x6f, 0x75, 0x20, 0x41, 0x67, 0x20, 0x41, 0x6a, 0x61,
+  0x63, 0x6b, 0x6f, 0x00, 0x41, 0x66, 0x61, 0x64, 0x61, 0x6e, 0x64, 0x61,
+  0x6e, 0x00, 0x4b, 0x61, 0x72, 0x69, 0x64, 0x61, 0x6e, 0x6e, 0x61, 0x00,
+  0x41, 0x6c, 0x6a, 0x69, 0x6c, 0x61, 0x6e, 0x69, 0x20, 0x41, 0x67, 0x20,
+  0x49, 0x62, 0x72, 0x61, 0x68, 0x69, 0x6d, 0x00, 0x42, 0x75, 0x73, 0x61,
+  0x72, 0x69, 0x20, 0x41, 0x67, 0x20, 0x41, 0x6b, 0x68, 0x6d, 0x61, 0x64,
+  0x00, 0x4d, 0x75, 0x73, 0x61, 0x20, 0x41, 0x67, 0x20, 0x41, 0x6d, 0x61,
+  0x73, 0x74, 0x61, 0x6e, 0x00, 0x57, 0x61, 0x6e, 0x20, 0x41, 0x67, 0x6f,
+  0x64, 0x61, 0x00, 0x41, 0x6b, 0x68, 0x61, 0x6e, 0x6f, 0x6b, 0x68, 0x61,
+  0x6e, 0x00, 0x4b, 0x68, 0x61, 0x64, 0x61, 0x6b, 0x68, 0x61, 0x64, 0x61,
+  0x00, 0x41, 0x6c, 0x6b, 0x68, 0x75, 0x72, 0x65, 0x72, 0x00, 0x41, 0x62,
+  0x64, 0x75, 0x72, 0x72, 0x61, 0x6b, 0x68, 0x6d, 0x61, 0x6e, 0x20, 0x54,
+  0x61, 0x67, 0x61, 0x6d, 0x61, 0x00, 0x46, 0x69, 0x68, 0x72, 0x75, 0x6e,
+  0x20, 0x41, 0x67, 0x20, 0x41, 0x6d, 0x61, 0x6e, 0x73, 0x61, 0x72, 0x00,
+  0x41, 0x74, 0x69, 0x73, 0x69, 0x20, 0x41, 0x67, 0x20, 0x41, 0x6d, 0x65,
+  0x6c, 0x6c, 0x61, 0x6c, 0x00, 0x42, 0x61, 0x79, 0x20, 0x41, 0x67, 0x20,
+  0x41, 0x6b, 0x68, 0x61, 0x6d, 0x6f, 0x6b, 0x00, 0x4b, 0x68, 0x61, 0x6d,
+  0x7a, 0x61, 0x74, 0x61, 0x20, 0x41, 0x67, 0x20, 0x4d, 0x61, 0x6b, 0x68,
+  0x61, 0x6d, 0x6d, 0x61, 0x64, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x04, 0x09, 0x02, 0xfc, 0x00, 0x94, 0xff, 0xef, 0x03, 0x01, 0xfa,
+  0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x00, 0x54, 0x75, 0x6e, 0x69, 0x73, 0x69, 0x61, 0x6e,
+  0x00, 0x54, 0x75, 0x6e, 0x69, 0x73, 0x69, 0x61, 0x6e, 0x00, 0x3f, 0x70,
+  0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x54, 0x75, 0x6e, 0x69, 0x73, 0x69,
+  0x61, 0x6e, 0x73, 0x00, 0x74, 0x75, 0x6e, 0x69, 0x73, 0x69, 0x61, 0x00,
+  0x2d, 0x00, 0x54, 0x68, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x65, 0x6e, 0x69,
+  0x63, 0x69, 0x61, 0x6e, 0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x65,
+  0x64, 0x20, 0x43, 0x61, 0x72, 0x74, 0x68, 0x61, 0x67, 0x65, 0x20, 0x69,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x65, 0x61, 0x20, 0x77,
+  0x68, 0x65, 0x72, 0x65, 0x20, 0x54, 0x75, 0x6e, 0x69, 0x73, 0x69, 0x61,
+  0x20, 0x69, 0x73, 0x20, 0x74, 0x6f, 0x64, 0x61, 0x79, 0x2e, 0x20, 0x43,
+  0x61, 0x72, 0x74, 0x68, 0x61, 0x67, 0x65, 0x20, 0x6c, 0x61, 0x74, 0x65,
+  0x72, 0x20, 0x62, 0x65, 0x63, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x20, 0x6d,
+  0x61, 0x6a, 0x6f, 0x72, 0x20, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x69,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4d, 0x65, 0x64, 0x69, 0x74, 0x65,
+  0x72, 0x72, 0x61, 0x6e, 0x65, 0x61, 0x6e, 0x20, 0x72, 0x65, 0x67, 0x69,
+  0x6f, 0x6e, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x69, 0x74, 0x20,
+  0x77, 0x61, 0x73, 0x20, 0x64, 0x65, 0x66, 0x65, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52, 0x6f, 0x6d, 0x61,
+  0x6e, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x34, 0x36, 0x20, 0x42, 0x43,
+  0x45, 0x2e, 0x20, 0x4c, 0x61, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x41, 0x72, 0x61, 0x62, 0x20, 0x4d, 0x75, 0x73, 0x6c, 0x69, 0x6d,
+  0x20, 0x63, 0x6f, 0x6e, 0x71, 0x75, 0x65, 0x73, 0x74, 0x20, 0x69, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x37, 0x74, 0x68, 0x20, 0x63, 0x65, 0x6e,
+  0x74, 0x75, 0x72, 0x79, 0x20, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20,
+  0x6d, 0x69, 0x67, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41, 0x72, 0x61, 0x62, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x4f, 0x74, 0x74, 0x6f, 0x6d, 0x61, 0x6e, 0x20,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x2e, 0x20, 0x42,
+  0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x77, 0x65, 0x72,
+  0x65, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x61, 0x20, 0x6c, 0x6f, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x4a, 0x65, 0x77, 0x73, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x53, 0x70, 0x61, 0x6e, 0x69, 0x73, 0x68, 0x20, 0x4d, 0x6f, 0x6f,
+  0x72, 0x73, 0x20, 0x77, 0x68, 0x6f, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x64,
+  0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x31, 0x36, 0x74, 0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72,
+  0x79, 0x2e, 0x20, 0x54, 0x75, 0x6e, 0x69, 0x73, 0x69, 0x61, 0x20, 0x62,
+  0x65, 0x63, 0x61, 0x6d, 0x65, 0x20, 0x6d, 0x6f, 0x73, 0x74, 0x6c, 0x79,
+  0x20, 0x61, 0x75, 0x74, 0x6f, 0x6e, 0x6f, 0x6d, 0x6f, 0x75, 0x73, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4f, 0x74, 0x74,
+  0x6f, 0x6d, 0x61, 0x6e, 0x20, 0x65, 0x6d, 0x70, 0x69, 0x72, 0x65, 0x20,
+  0x69, 0x6e, 0x20, 0x31, 0x38, 0x36, 0x31, 0x2e, 0x20, 0x42, 0x75, 0x74,
+  0x20, 0x69, 0x6e, 0x20, 0x31, 0x38, 0x38, 0x31, 0x20, 0x54, 0x75, 0x6e,
+  0x69, 0x73, 0x69, 0x61, 0x20, 0x77, 0x61, 0x73, 0x20, 0x69, 0x6e, 0x76,
+  0x61, 0x64, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x46, 0x72, 0x65, 0x6e, 0x63, 0x68, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x77,
+  0x61, 0x73, 0x20, 0x6d, 0x61, 0x64, 0x65, 0x20, 0x61, 0x20, 0x46, 0x72,
+  0x65, 0x6e, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6f, 0x74, 0x65, 0x63, 0x74,
+  0x6f, 0x72, 0x61, 0x74, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x62, 0x65, 0x63, 0x61, 0x6d,
+  0x74, 0x6e, 0x61, 0x6d, 0x00, 0x53, 0x6f, 0x75, 0x74, 0x68, 0x20, 0x56,
+  0x69, 0x65, 0x74, 0x6e, 0x61, 0x6d, 0x2c, 0x20, 0x6f, 0x66, 0x66, 0x69,
+  0x63, 0x69, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52,
+  0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x6f, 0x66, 0x20, 0x56,
+  0x69, 0x65, 0x74, 0x6e, 0x61, 0x6d, 0x2c, 0x20, 0x77, 0x61, 0x73, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6e,
+  0x2d, 0x62, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x73, 0x74, 0x61, 0x74,
+  0x65, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x56, 0x69, 0x65, 0x74, 0x6e, 0x61, 0x6d, 0x20, 0x57, 0x61, 0x72,
+  0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72,
+  0x79, 0x20, 0x77, 0x61, 0x73, 0x20, 0x72, 0x65, 0x75, 0x6e, 0x69, 0x74,
+  0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x4e, 0x6f, 0x72, 0x74,
+  0x68, 0x20, 0x56, 0x69, 0x65, 0x74, 0x6e, 0x61, 0x6d, 0x20, 0x61, 0x66,
+  0x74, 0x65, 0x72, 0x20, 0x69, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x63,
+  0x6f, 0x6e, 0x71, 0x75, 0x65, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
+  0x63, 0x6f, 0x6d, 0x6d, 0x75, 0x6e, 0x69, 0x73, 0x74, 0x20, 0x66, 0x6f,
+  0x72, 0x63, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x39, 0x37, 0x35,
+  0x2e, 0x00, 0x03, 0x06, 0x4e, 0x67, 0xc3, 0xb4, 0x20, 0xc4, 0x90, 0xc3,
+  0xac, 0x6e, 0x68, 0x20, 0x44, 0x69, 0xe1, 0xbb, 0x87, 0x6d, 0x00, 0x4e,
+  0x67, 0xc3, 0xb4, 0x20, 0xc4, 0x90, 0xc3, 0xac, 0x6e, 0x68, 0x20, 0x4e,
+  0x68, 0x75, 0x00, 0x54, 0x72, 0xe1, 0xba, 0xa7, 0x6e, 0x20, 0x4c, 0xe1,
+  0xbb, 0x87, 0x20, 0x58, 0x75, 0xc3, 0xa2, 0x6e, 0x00, 0x44, 0xc6, 0xb0,
+  0xc6, 0xa1, 0x6e, 0x67, 0x20, 0x56, 0xc4, 0x83, 0x6e, 0x20, 0x4d, 0x69,
+  0x6e, 0x68, 0x00, 0x4e, 0x67, 0x75, 0x79, 0xe1, 0xbb, 0x85, 0x6e, 0x20,
+  0x43, 0x61, 0x6f, 0x20, 0x4b, 0xe1, 0xbb, 0xb3, 0x00, 0x4e, 0x67, 0x75,
+  0x79, 0xe1, 0xbb, 0x85, 0x6e, 0x20, 0x56, 0xc4, 0x83, 0x6e, 0x20, 0x54,
+  0x68, 0x69, 0xe1, 0xbb, 0x87, 0x75, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x06, 0x09, 0x01, 0x75, 0x00, 0x94, 0xff, 0xef,
+  0x03, 0x01, 0xd4, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x53, 0x6f, 0x75, 0x74, 0x68,
+  0x20, 0x59, 0x65, 0x6d, 0x65, 0x6e, 0x69, 0x00, 0x53, 0x6f, 0x75, 0x74,
+  0x68, 0x20, 0x59, 0x65, 0x6d, 0x65, 0x6e, 0x69, 0x00, 0x3f, 0x70, 0x6c,
+  0x75, 0x72, 0x61, 0x6c, 0x3a, 0x53, 0x6f, 0x75, 0x74, 0x68, 0x20, 0x59,
+  0x65, 0x6d, 0x65, 0x6e, 0x69, 0x73, 0x00, 0x73, 0x6f, 0x75, 0x74, 0x68,
+  0x5f, 0x79, 0x65, 0x6d, 0x65, 0x6e, 0x00, 0x2d, 0x00, 0x54, 0x68, 0x65,
+  0x20, 0x61, 0x72, 0x65, 0x61, 0x20, 0x61, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+  0x20, 0x41, 0x64, 0x65, 0x6e, 0x20, 0x77, 0x61, 0x73, 0x20, 0x63, 0x6f,
+  0x6c, 0x6f, 0x6e, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x42, 0x72, 0x69, 0x74, 0x69, 0x73, 0x68, 0x20, 0x69,
+  0x6e, 0x20, 0x31, 0x38, 0x33, 0x39, 0x2e, 0x20, 0x53, 0x6f, 0x75, 0x74,
+  0x68, 0x20, 0x59, 0x65, 0x6d, 0x65, 0x6e, 0x20, 0x64, 0x65, 0x63, 0x6c,
+  0x61, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x70, 0x65, 0x6e,
+  0x64, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x39, 0x36,
+  0x37, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x65, 0x64,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x75, 0x6e, 0x69,
+  0x73, 0x74, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x2e, 0x20, 0x49, 0x74, 0x20,
+  0x77, 0x61, 0x73, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x65, 0x64, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x4e, 0x6f, 0x72, 0x74, 0x68, 0x20, 0x59, 0x65,
+  0x6d, 0x65, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x39, 0x39, 0x30, 0x2e,
+  0x00, 0x04, 0x05, 0x51, 0x61, 0x68, 0x74, 0x61, 0x6e, 0x20, 0x4d, 0x75,
+  0x68, 0x61, 0x6d, 0x6d, 0x61, 0x64, 0x20, 0x61, 0x6c, 0x2d, 0x53, 0x68,
+  0x61, 0x61, 0x62, 0x69, 0x00, 0x4d, 0x75, 0x68, 0x61, 0x6d, 0x6d, 0x61,
+  0x64, 0x20, 0x41, 0x6c, 0x69, 0x20, 0x48, 0x61, 0x69, 0x74, 0x68, 0x61,
+  0x6d, 0x00, 0x53, 0x61, 0x6c, 0x69, 0x6d, 0x20, 0x52, 0x75, 0x62, 0x61,
+  0x69, 0x20, 0x41, 0x6c, 0x69, 0x00, 0x41, 0x62, 0x64, 0x75, 0x6c, 0x20,
+  0x46, 0x61, 0x74, 0x74, 0x61, 0x68, 0x20, 0x49, 0x73, 0x6d, 0x61, 0x69,
+  0x6c, 0x00, 0x41, 0x6c, 0x69, 0x20, 0x4e, 0x61, 0x73, 0x69, 0x72, 0x20,
+  0x4d, 0x75, 0x68, 0x61, 0x6d, 0x6d, 0x61, 0x64, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x09, 0x02, 0x42, 0x00, 0x94, 0x7f,
+  0xef, 0x03, 0x01, 0xd5, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d,
+  0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x53, 0x6f, 0x76, 0x69,
+  0x65, 0x74, 0x00, 0x53, 0x6f, 0x76, 0x69, 0x65, 0x74, 0x00, 0x3f, 0x70,
+  0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x53, 0x6f, 0x76, 0x69, 0x65, 0x74,
+  0x73, 0x00, 0x73, 0x6f, 0x76, 0x69, 0x65, 0x74, 0x00, 0x2d, 0x00, 0x54,
+  0x68, 0x65, 0x20, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6f, 0x76, 0x69, 0x65, 0x74,
+  0x20, 0x55, 0x6e, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+  0x73, 0x20, 0x69, 0x6e, 0x20, 0x4e, 0x6f, 0x76, 0x65, 0x6d, 0x62, 0x65,
+  0x72, 0x20, 0x31, 0x39, 0x31, 0x37, 0x2c, 0x20, 0x77, 0x68, 0x65, 0x6e,
+  0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x4c, 0x65, 0x6e, 0x69, 0x6e,
+  0x27, 0x73, 0x20, 0x6c, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x68, 0x69,
+  0x70, 0x20, 0x61, 0x20, 0x42, 0x6f, 0x6c, 0x73, 0x68, 0x65, 0x76, 0x69,
+  0x6b, 0x20, 0x72, 0x65, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x6f, 0x63, 0x63, 0x75, 0x72, 0x72, 0x65, 0x64, 0x2e, 0x20, 0x4f,
+  0x6e, 0x20, 0x44, 0x65, 0x63, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x33,
+  0x31, 0x20, 0x31, 0x39, 0x32, 0x32, 0x2c, 0x20, 0x66, 0x6f, 0x75, 0x72,
+  0x20, 0x53, 0x6f, 0x76, 0x69, 0x65, 0x74, 0x20, 0x72, 0x65, 0x70, 0x75,
+  0x62, 0x6c, 0x69, 0x63, 0x73, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x72,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x6f, 0x6e,
+  0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72, 0x79, 0x2e, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x53, 0x6f, 0x76, 0x69, 0x65, 0x74, 0x20, 0x55, 0x6e,
+  0x69, 0x6f, 0x6e, 0x20, 0x62, 0x65, 0x63, 0x61, 0x6d, 0x65, 0x20, 0x6f,
+  0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f,
+  0x73, 0x74, 0x20, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x66, 0x75, 0x6c, 0x20,
+  0x73, 0x74, 0x61, 0x74, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x32, 0x30, 0x74, 0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75,
+  0x72, 0x79, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x62, 0x79, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x31, 0x39,
+  0x39, 0x31, 0x20, 0x69, 0x74, 0x20, 0x68, 0x61, 0x64, 0x20, 0x64, 0x69,
+  0x73, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20,
+  0x69, 0x6e, 0x74, 0x6f, 0x20, 0x66, 0x69, 0x66, 0x74, 0x65, 0x65, 0x6e,
+  0x20, 0x69, 0x6e, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74,
+  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x64,
+  0x75, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x6c,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x65, 0x63, 0x6f, 0x6e, 0x6f, 0x6d, 0x69,
+  0x63, 0x20, 0x70, 0x72, 0x6f, 0x62, 0x6c, 0x65, 0x6d, 0x73, 0x2e, 0x00,
+  0x07, 0x56, 0x6c, 0x61, 0x64, 0x69, 0x6d, 0x69, 0x72, 0x20, 0x4c, 0x65,
+  0x6e, 0x69, 0x6e, 0x00, 0x49, 0x6f, 0x73, 0x69, 0x66, 0x20, 0x53, 0x74,
+  0x61, 0x6c, 0x69, 0x6e, 0x00, 0x4e, 0x69, 0x6b, 0x69, 0x74, 0x61, 0x20,
+  0x4b, 0x68, 0x72, 0x75, 0x73, 0x63, 0x68, 0x6f, 0x76, 0x00, 0x4c, 0x65,
+  0x6f, 0x6e, 0x69, 0x64, 0x20, 0x42, 0x72, 0x65, 0x7a, 0x68, 0x6e, 0x65,
+  0x76, 0x00, 0x59, 0x75, 0x72, 0x69, 0x79, 0x20, 0x41, 0x6e, 0x64, 0x72,
+  0x6f, 0x70, 0x6f, 0x76, 0x00, 0x4e, 0x61, 0x64, 0x65, 0x7a, 0x68, 0x64,
+  0x61, 0x20, 0x4b, 0x72, 0x75, 0x70, 0x73, 0x6b, 0x61, 0x79, 0x61, 0x00,
+  0x41, 0x6c, 0x65, 0x78, 0x61, 0x6e, 0x64, 0x72, 0x61, 0x20, 0x4b, 0x6f,
+  0x6c, 0x6c, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x00, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x02, 0x07, 0x06, 0x09, 0x02, 0xa5, 0x00,
+  0x94, 0xfe, 0xef, 0x03, 0x01, 0xd6, 0x53, 0x70, 0x61, 0x6e, 0x69, 0x73,
+  0x68, 0x00, 0x53, 0x70, 0x61, 0x6e, 0x69, 0x73, 0x68, 0x00, 0x3f, 0x70,
+  0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x53, 0x70, 0x61, 0x6e, 0x69, 0x73,
+  0x68, 0x00, 0x73, 0x70, 0x61, 0x69, 0x6e, 0x00, 0x2d, 0x00, 0x54, 0x68,
+  0x65, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x72, 0x6e, 0x20, 0x53, 0x70, 0x61,
+  0x6e, 0x69, 0x73, 0x68, 0x20, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x77, 0x61, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 0x20, 0x77,
+  0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6c, 0x65,
+  0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6b, 0x69,
+  0x6e, 0x67, 0x64, 0x6f, 0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x43, 0x61,
+  0x73, 0x74, 0x69, 0x6c, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x41, 0x72,
+  0x61, 0x67, 0x6f, 0x6e, 0x20, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x72, 0x65, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x49, 0x62, 0x65, 0x72, 0x69, 0x61,
+  0x6e, 0x20, 0x70, 0x65, 0x6e, 0x69, 0x6e, 0x73, 0x75, 0x6c, 0x61, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4d, 0x6f, 0x73,
+  0x6c, 0x65, 0x6d, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x52, 0x65,
+  0x63, 0x6f, 0x6e, 0x71, 0x75, 0x69, 0x73, 0x74, 0x61, 0x20, 0x77, 0x61,
+  0x73, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x64, 0x20,
+  0x69, 0x6e, 0x20, 0x31, 0x34, 0x39, 0x32, 0x2c, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x79, 0x65, 0x61, 0x72, 0x20, 0x43,
+  0x6f, 0x6c, 0x75, 0x6d, 0x62, 0x75, 0x73, 0x20, 0x73, 0x61, 0x69, 0x6c,
+  0x65, 0x64, 0x2e, 0x20, 0x53, 0x70, 0x61, 0x69, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x6e, 0x20, 0x77, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x74,
+  0x6f, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6e, 0x20,
+  0x65, 0x6d, 0x70, 0x69, 0x72, 0x65, 0x20, 0x6f, 0x6e, 0x20, 0x77, 0x68,
+  0x69, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6e, 0x20,
+  0x6e, 0x65, 0x76, 0x65, 0x72, 0x20, 0x73, 0x65, 0x74, 0x2e, 0x00, 0x01,
+  0x15, 0x50, 0x65, 0x6c, 0x61, 0x79, 0x6f, 0x00, 0x52, 0x6f, 0x64, 0x72,
+  0x69, 0x67, 0x6f, 0x20, 0x44, 0xc3, 0xad, 0x61, 0x7a, 0x20, 0x64, 0x65,
+  0x20, 0x56, 0x69, 0x76, 0x61, 0x72, 0x00, 0x41, 0x6c, 0x66, 0x6f, 0x6e,
+  0x73, 0x6f, 0x20, 0x65, 0x6c, 0x20, 0x53, 0x61, 0x62, 0x69, 0x6f, 0x00,
+  0x46, 0x65, 0x72, 0x6e, 0x61, 0x6e, 0x64, 0x6f, 0x20, 0x56, 0x00, 0x49,
+  0x73, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x6c, 0x61, 0x20, 0x43, 0x61, 0x74,
+  0xc3, 0xb3, 0x6c, 0x69, 0x63, 0x61, 0x00, 0x43, 0x61, 0x72, 0x6c, 0x6f,
+  0x73, 0x20, 0x49, 0x00, 0x46, 0x65, 0x6c, 0x69, 0x70, 0x65, 0x20, 0x49,
+  0x49, 0x00, 0x46, 0x65, 0x6c, 0x69, 0x70, 0x65, 0x20, 0x56, 0x00, 0x43,
+  0x61, 0x72, 0x6c, 0x6f, 0x73, 0x20, 0x49, 0x49, 0x49, 0x00, 0x4d, 0x61,
+  0x6e, 0x75, 0x65, 0x6c, 0x20, 0x64, 0x65, 0x20, 0x47, 0x6f, 0x64, 0x6f,
+  0x79, 0x00, 0x47, 0xc3, 0xa1, 0x73, 0x70, 0x61, 0x72, 0x20, 0x4d, 0x65,
+  0x6c, 0x63, 0x68, 0x6f, 0x72, 0x20, 0x64, 0x65, 0x20, 0x4a, 0x6f, 0x76,
+  0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x6f, 0x73, 0x00, 0x46, 0x65, 0x72, 0x6e,
+  0x61, 0x6e, 0x64, 0x6f, 0x20, 0x56, 0x49, 0x49, 0x00, 0x52, 0x61, 0x66,
+  0x61, 0x65, 0x6c, 0x20, 0x64, 0x65, 0x6c, 0x20, 0x52, 0x69, 0x65, 0x67,
+  0x6f, 0x00, 0x49, 0x73, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x49, 0x49, 0x00,
+  0x4a, 0x75, 0x61, 0x6e, 0x20, 0x50, 0x72, 0x69, 0x6d, 0x00, 0x45, 0x6d,
+  0x69, 0x6c, 0x69, 0x6f, 0x20, 0x43, 0x61, 0x73, 0x74, 0x65, 0x6c, 0x61,
+  0x72, 0x00, 0x41, 0x6c, 0x66, 0x6f, 0x6e, 0x73, 0x6f, 0x20, 0x58, 0x49,
+  0x49, 0x49, 0x00, 0x4d, 0x69, 0x67, 0x75, 0x65, 0x6c, 0x20, 0x50, 0x72,
+  0x69, 0x6d, 0x6f, 0x20, 0x64, 0x65, 0x20, 0x52, 0x69, 0x76, 0x65, 0x72,
+  0x61, 0x00, 0x4d, 0x61, 0x6e, 0x75, 0x65, 0x6c, 0x20, 0x41, 0x7a, 0x61,
+  0xc3, 0xb1, 0x61, 0x00, 0x46, 0x72, 0x61, 0x6e, 0x63, 0x69, 0x73, 0x63,
+  0x6f, 0x20, 0x46, 0x72, 0x61, 0x6e, 0x63, 0x6f, 0x00, 0x4a, 0x75, 0x61,
+  0x6e, 0x20, 0x43, 0x61, 0x72, 0x6c, 0x6f, 0x73, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03, 0x02, 0x03,
+  0x07, 0x09, 0x02, 0x04, 0x00, 0x94, 0xff, 0xef, 0x03, 0x01, 0xd7, 0x66,
+  0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x73, 0x00, 0x53, 0x72, 0x69, 0x20, 0x56, 0x69, 0x6a, 0x61, 0x79,
+  0x61, 0x00, 0x53, 0x72, 0x69, 0x20, 0x61, 0x6e, 0x74, 0x73, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x77, 0x69, 0x73, 0x73, 0x20,
+  0x63, 0x61, 0x6e, 0x74, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x47, 0x72,
+  0x69, 0x73, 0x6f, 0x6e, 0x73, 0x20, 0x77, 0x68, 0x6f, 0x20, 0x73, 0x70,
+  0x65, 0x61, 0x6b, 0x20, 0x52, 0x6f, 0x6d, 0x61, 0x6e, 0x73, 0x68, 0x2c,
+  0x20, 0x61, 0x20, 0x52, 0x6f, 0x6d, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x6c,
+  0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74,
+  0x20, 0x72, 0x65, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x20, 0x73, 0x6f, 0x6d,
+  0x65, 0x20, 0x75, 0x6e, 0x69, 0x71, 0x75, 0x65, 0x20, 0x63, 0x68, 0x61,
+  0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x69, 0x73, 0x74, 0x69, 0x63, 0x73,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20,
+  0x72, 0x69, 0x63, 0x68, 0x20, 0x6f, 0x72, 0x61, 0x6c, 0x20, 0x74, 0x72,
+  0x61, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x41, 0x6c, 0x74,
+  0x68, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x52, 0x6f, 0x6d, 0x61, 0x6e, 0x73,
+  0x68, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x75, 0x72, 0x20, 0x6e, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61,
+  0x67, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x53, 0x77, 0x69, 0x74, 0x7a,
+  0x65, 0x72, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70,
+  0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x62, 0x65, 0x69, 0x6e, 0x67, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x74,
+  0x61, 0x6b, 0x65, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x61, 0x76, 0x65,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67,
+  0x65, 0x2c, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6c, 0x6f, 0x73,
+  0x69, 0x6e, 0x67, 0x20, 0x74, 0x65, 0x72, 0x72, 0x61, 0x69, 0x6e, 0x20,
+  0x61, 0x73, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x69,
+  0x74, 0x73, 0x20, 0x73, 0x70, 0x65, 0x61, 0x6b, 0x65, 0x72, 0x73, 0x20,
+  0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x74, 0x6f, 0x20, 0x47, 0x65,
+  0x72, 0x6d, 0x61, 0x6e, 0x2e, 0x20, 0x42, 0x65, 0x66, 0x6f, 0x72, 0x65,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x4e, 0x61, 0x70, 0x6f, 0x6c, 0x65, 0x6f,
+  0x6e, 0x69, 0x63, 0x20, 0x45, 0x72, 0x61, 0x2c, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x54, 0x68, 0x72, 0x65, 0x65, 0x20, 0x4c, 0x65, 0x61, 0x67, 0x75,
+  0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x47, 0x72, 0x69, 0x73, 0x6f, 0x6e,
+  0x73, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f,
+  0x6e, 0x6c, 0x79, 0x20, 0x74, 0x65, 0x72, 0x72, 0x69, 0x74, 0x6f, 0x72,
+  0x79, 0x20, 0x6f, 0x66, 0x20, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x20,
+  0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x64, 0x65, 0x63, 0x69, 0x73, 0x69,
+  0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x77, 0x61,
+  0x73, 0x20, 0x6f, 0x72, 0x67, 0x61, 0x6e, 0x69, 0x7a, 0x65, 0x64, 0x20,
+  0x62, 0x79, 0x20, 0x74, 0x61, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x76, 0x6f,
+  0x74, 0x65, 0x73, 0x2e, 0x00, 0x06, 0x54, 0x65, 0x6c, 0x6c, 0x6f, 0x00,
+  0x46, 0x69, 0x6c, 0x69, 0x70, 0x20, 0x47, 0x61, 0x6c, 0x6c, 0x69, 0x63,
+  0x69, 0x75, 0x73, 0x00, 0x50, 0x6c, 0x61, 0x63, 0x69, 0x20, 0x61, 0x20,
+  0x53, 0x70, 0x65, 0x73, 0x63, 0x68, 0x61, 0x00, 0x43, 0x61, 0x73, 0x70,
+  0x61, 0x72, 0x20, 0x44, 0x65, 0x63, 0x75, 0x72, 0x74, 0x69, 0x6e, 0x73,
+  0x00, 0x50, 0x65, 0x69, 0x64, 0x65, 0x72, 0x20, 0x4c, 0x61, 0x6e, 0x73,
+  0x65, 0x6c, 0x00, 0x48, 0x65, 0x69, 0x6e, 0x72, 0x69, 0x63, 0x68, 0x20,
+  0x53, 0x63, 0x68, 0x6d, 0x69, 0x64, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x02, 0x07, 0x01, 0x09, 0x04, 0x63, 0x00, 0x94, 0x7e,
+  0xef, 0x03, 0x01, 0x99, 0x52, 0x75, 0x73, 0x73, 0x69, 0x61, 0x6e, 0x00,
+  0x52, 0x75, 0x73, 0x73, 0x69, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75,
+  0x72, 0x61, 0x6c, 0x3a, 0x52, 0x75, 0x73, 0x73, 0x69, 0x61, 0x6e, 0x73,
+  0x00, 0x72, 0x75, 0x73, 0x73, 0x69, 0x61, 0x00, 0x2d, 0x00, 0x52, 0x75,
+  0x73, 0x73, 0x69, 0x61, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6c, 0x61, 0x72, 0x67, 0x65, 0x73, 0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x72, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77,
+  0x6f, 0x72, 0x6c, 0x64, 0x2c, 0x20, 0x6f, 0x63, 0x63, 0x75, 0x70, 0x79,
+  0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 0x68, 0x75, 0x67, 0x65, 0x20, 0x70,
+  0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20,
+  0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x41,
+  0x73, 0x69, 0x61, 0x2e, 0x20, 0x41, 0x63, 0x63, 0x6f, 0x72, 0x64, 0x69,
+  0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x65, 0x67, 0x65, 0x6e, 0x64,
+  0x2c, 0x20, 0x53, 0x6c, 0x61, 0x76, 0x69, 0x63, 0x20, 0x74, 0x72, 0x69,
+  0x62, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x4e, 0x6f, 0x76, 0x67, 0x6f,
+  0x72, 0x6f, 0x64, 0x20, 0x69, 0x6e, 0x76, 0x69, 0x74, 0x65, 0x64, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x56, 0x61, 0x72, 0x61, 0x6e, 0x67, 0x69, 0x61,
+  0x6e, 0x20, 0x28, 0x56, 0x69, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x20, 0x6b,
+  0x69, 0x6e, 0x67, 0x20, 0x4f, 0x6c, 0x65, 0x67, 0x20, 0x74, 0x6f, 0x20,
+  0x62, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20,
+  0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x6c, 0x61, 0x6e,
+  0x64, 0x2e, 0x20, 0x4f, 0x6c, 0x65, 0x67, 0x20, 0x65, 0x73, 0x74, 0x61,
+  0x62, 0x6c, 0x69, 0x73, 0x68, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x4b, 0x69, 0x65, 0x76, 0x61, 0x6e, 0x20, 0x52, 0x75, 0x73, 0x27, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x72, 0x65, 0x61, 0x6c,
+  0x6d, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+  0x20, 0x52, 0x75, 0x73, 0x73, 0x69, 0x61, 0x6e, 0x20, 0x73, 0x74, 0x61,
+  0x74, 0x65, 0x2e, 0x20, 0x42, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31,
+  0x31, 0x74, 0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x2c,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x4b, 0x69, 0x65, 0x76, 0x61, 0x6e, 0x20,
+  0x52, 0x75, 0x73, 0x27, 0x20, 0x68, 0x61, 0x64, 0x20, 0x64, 0x69, 0x73,
+  0x69, 0x6e, 0x74, 0x65, 0x67, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x69,
+  0x6e, 0x74, 0x6f, 0x20, 0x6c, 0x65, 0x73, 0x73, 0x65, 0x72, 0x20, 0x70,
+  0x72, 0x69, 0x6e, 0x63, 0x65, 0x64, 0x6f, 0x6d, 0x73, 0x2c, 0x20, 0x77,
+  0x68, 0x69, 0x63, 0x68, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x6f, 0x6e,
+  0x63, 0x65, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x20, 0x75, 0x6e, 0x69,
+  0x74, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x6f, 0x6e, 0x65,
+  0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x62, 0x79, 0x20, 0x49, 0x76,
+  0x61, 0x6e, 0x20, 0x49, 0x49, 0x49, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x31, 0x35, 0x74, 0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75,
+  0x72, 0x79, 0x2e, 0x20, 0x41, 0x66, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20,
+  0x64, 0x65, 0x63, 0x69, 0x73, 0x69, 0x76, 0x65, 0x20, 0x76, 0x69, 0x63,
+  0x74, 0x6f, 0x72, 0x79, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x53, 0x77,
+  0x65, 0x64, 0x65, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6c, 0x61, 0x72,
+  0x67, 0x65, 0x20, 0x74, 0x65, 0x72, 0x72, 0x69, 0x74, 0x6f, 0x72, 0x69,
+  0x61, 0x6c, 0x20, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x2c, 0x20, 0x50, 0x65,
+  0x74, 0x65, 0x72, 0x20, 0x49, 0x20, 0x70, 0x72, 0x6f, 0x6e, 0x6f, 0x75,
+  0x6e, 0x63, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52, 0x75, 0x73,
+  0x73, 0x69, 0x61, 0x6e, 0x20, 0x45, 0x6d, 0x70, 0x69, 0x72, 0x65, 0x20,
+  0x69, 0x6e, 0x20, 0x31, 0x37, 0x32, 0x31, 0x2e, 0x20, 0x54, 0x68, 0x65,
+  0x20, 0x52, 0x75, 0x73, 0x73, 0x69, 0x61, 0x6e, 0x20, 0x45, 0x6d, 0x70,
+  0x69, 0x72, 0x65, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x65, 0x64, 0x20, 0x75,
+  0x6e, 0x74, 0x69, 0x6c, 0x20, 0x31, 0x39, 0x31, 0x37, 0x20, 0x77, 0x68,
+  0x65, 0x6e, 0x20, 0x61, 0x20, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x6c, 0x69,
+  0x73, 0x74, 0x20, 0x72, 0x65, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x64, 0x65, 0x74, 0x68, 0x72, 0x6f, 0x6e, 0x65, 0x64, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x20, 0x52, 0x75, 0x73,
+  0x73, 0x69, 0x61, 0x6e, 0x20, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x6f, 0x72,
+  0x2e, 0x20, 0x41, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x64, 0x69, 0x73, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x55, 0x53, 0x53, 0x52, 0x20,
+  0x69, 0x6e, 0x20, 0x31, 0x39, 0x39, 0x31, 0x20, 0x52, 0x75, 0x73, 0x73,
+  0x69, 0x61, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x65, 0x64, 0x20,
+  0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64,
+  0x20, 0x6d, 0x61, 0x70, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x2c, 0x20,
+  0x6e, 0x6f, 0x77, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x66, 0x65, 0x64,
+  0x65, 0x72, 0x61, 0x6c, 0x20, 0x72, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69,
+  0x63, 0x2e, 0x00, 0x14, 0x4f, 0x6c, 0x65, 0x67, 0x00, 0x52, 0x79, 0x75,
+  0x72, 0x69, 0x6b, 0x00, 0x56, 0x6c, 0x61, 0x64, 0x69, 0x6d, 0x69, 0x72,
+  0x20, 0x4b, 0x72, 0x61, 0x73, 0x6e, 0x6f, 0x20, 0x53, 0x6f, 0x6c, 0x6e,
+  0x79, 0x73, 0x68, 0x6b, 0x6f, 0x00, 0x56, 0x6c, 0x61, 0x64, 0x69, 0x6d,
+  0x69, 0x72, 0x20, 0x4d, 0x6f, 0x6e, 0x6f, 0x6d, 0x61, 0x6b, 0x68, 0x00,
+  0x56, 0x73, 0x65, 0x76, 0x6f, 0x6c, 0x6f, 0x64, 0x20, 0x42, 0x6f, 0x6c,
+  0x73, 0x68, 0x6f, 0x65, 0x20, 0x47, 0x6e, 0x65, 0x7a, 0x64, 0x6f, 0x00,
+  0x41, 0x6c, 0x65, 0x6b, 0x73, 0x61, 0x6e, 0x64, 0x72, 0x20, 0x4e, 0x65,
+  0x76, 0x73, 0x6b, 0x79, 0x00, 0x44, 0x6d, 0x69, 0x74, 0x72, 0x69, 0x79,
+  0x20, 0x44, 0x6f, 0x6e, 0x73, 0x6b, 0x6f, 0x79, 0x00, 0x49, 0x76, 0x61,
+  0x6e, 0x20, 0x49, 0x49, 0x49, 0x00, 0x49, 0x76, 0x61, 0x6e, 0x20, 0x47,
+  0x72, 0x6f, 0x7a, 0x6e, 0x79, 0x00, 0x50, 0x65, 0x74, 0x72, 0x20, 0x49,
+  0x00, 0x41, 0x6e, 0x6e, 0x61, 0x20, 0x49, 0x6f, 0x61, 0x6e, 0x6e, 0x6f,
+  0x76, 0x6e, 0x61, 0x00, 0x45, 0x6c, 0x69, 0x7a, 0x61, 0x76, 0x65, 0x74,
+  0x61, 0x20, 0x50, 0x65, 0x74, 0x72, 0x6f, 0x76, 0x6e, 0x61, 0x00, 0x45,
+  0x6b, 0x61, 0x74, 0x65, 0x72, 0x69, 0x6e, 0x61, 0x20, 0x49, 0x49, 0x00,
+  0x50, 0x61, 0x76, 0x65, 0x6c, 0x20, 0x49, 0x00, 0x4e, 0x69, 0x6b, 0x6f,
+  0x6c, 0x61, 0x79, 0x20, 0x49, 0x00, 0x41, 0x6c, 0x65, 0x6b, 0x73, 0x61,
+  0x6e, 0x64, 0x72, 0x20, 0x49, 0x49, 0x00, 0x41, 0x6c, 0x65, 0x6b, 0x73,
+  0x61, 0x6e, 0x64, 0x72, 0x20, 0x4b, 0x65, 0x72, 0x65, 0x6e, 0x73, 0x6b,
+  0x79, 0x00, 0x56, 0x6c, 0x61, 0x64, 0x69, 0x6d, 0x69, 0x72, 0x20, 0x4c,
+  0x65, 0x6e, 0x69, 0x6e, 0x00, 0x49, 0x6f, 0x73, 0x69, 0x66, 0x20, 0x53,
+  0x74, 0x61, 0x6c, 0x69, 0x6e, 0x00, 0x56, 0x6c, 0x61, 0x64, 0x69, 0x6d,
+  0x69, 0x72, 0x20, 0x50, 0x75, 0x74, 0x69, 0x6e, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x07,
+  0x06, 0x09, 0x02, 0xc4, 0x00, 0x94, 0xff, 0xef, 0x03, 0x01, 0x9a, 0x66,
+  0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x73, 0x00, 0x52, 0x75, 0x73, 0x79, 0x6e, 0x00, 0x52, 0x75, 0x73,
+  0x79, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x52,
+  0x75, 0x73, 0x79, 0x6e, 0x73, 0x00, 0x72, 0x75, 0x73, 0x79, 0x6e, 0x00,
+  0x2d, 0x00, 0x54, 0x68, 0x65, 0x20, 0x52, 0x75, 0x73, 0x79, 0x6e, 0x73,
+  0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x74, 0x68, 0x6e,
+  0x69, 0x63, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x6f, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x77, 0x65, 0x73, 0x74, 0x65, 0x72, 0x6e, 0x20,
+  0x70, 0x65, 0x72, 0x69, 0x70, 0x68, 0x65, 0x72, 0x79, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x45, 0x61, 0x73, 0x74, 0x20, 0x53, 0x6c,
+  0x61, 0x76, 0x69, 0x63, 0x20, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+  0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 0x6c, 0x69, 0x76, 0x65, 0x20,
+  0x6d, 0x61, 0x69, 0x6e, 0x6c, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x50, 0x6f, 0x6c, 0x69, 0x73, 0x68, 0x2d, 0x55, 0x6b, 0x72,
+  0x61, 0x69, 0x6e, 0x69, 0x61, 0x6e, 0x2d, 0x53, 0x6c, 0x6f, 0x76, 0x61,
+  0x6b, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x6c, 0x61, 0x6e, 0x64,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x56, 0x6f, 0x6a, 0x76, 0x6f, 0x64, 0x69, 0x6e, 0x61, 0x2e, 0x20, 0x49,
+  0x6e, 0x20, 0x6d, 0x65, 0x64, 0x69, 0x65, 0x76, 0x61, 0x6c, 0x20, 0x74,
+  0x69, 0x6d, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52, 0x75, 0x73,
+  0x79, 0x6e, 0x20, 0x68, 0x6f, 0x6d, 0x65, 0x6c, 0x61, 0x6e, 0x64, 0x20,
+  0x77, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x74, 0x65,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x44, 0x75, 0x63, 0x68,
+  0x79, 0x20, 0x6f, 0x66, 0x20, 0x47, 0x61, 0x6c, 0x69, 0x63, 0x69, 0x61,
+  0xff, 0x05, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00,
+  0x04, 0xf5, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff,
+  0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x04, 0xf6, 0xff, 0xfd,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x04, 0xf7, 0xff, 0xfd, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x04, 0xf8,
+  0xff, 0xfd, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x04, 0xf9, 0xff, 0xfd, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x04, 0xfa, 0xff, 0xfd, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x04, 0xfb, 0xff, 0xfd, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x04, 0xfc, 0xff, 0xfd, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x04, 0xfd, 0xff,
+  0xfd, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x23, 0x00, 0x0f,
+  0xcf, 0x01, 0x00, 0x00, 0x04, 0xfe, 0xff, 0xfd, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x0b, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x04, 0xff, 0xff, 0xfd, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x00,
+  0xff, 0xfd, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x05, 0x01, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x05, 0x02, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x05, 0x03, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x05, 0x04, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x08, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x05, 0x05, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x23, 0x00, 0x0f, 0xcf, 0x01, 0x00, 0x00, 0x05, 0x06, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x07, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x05, 0x08, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x09, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x05, 0x0a, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05,
+  0x0b, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x0c, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x05, 0x0d, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x0e, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x05, 0x0f, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x10,
+  0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x11, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x05, 0x12, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x13, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x05, 0x14, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x05, 0x15, 0x00,
+  0x05, 0x02, 0x00, 0xff, 0x00, 0xff, 0x09, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x16, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x23, 0x00, 0x0f, 0xcf, 0x01, 0x00, 0x00,
+  0x05, 0x17, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x00, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05,
+  0x18, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x19, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x05, 0x1a, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x05, 0x1b, 0x00, 0x04,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x05, 0x1c, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05,
+  0x1d, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x1e, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x05, 0x1f, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x20, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x23, 0x00, 0x0f, 0xcf,
+  0x01, 0x00, 0x00, 0x05, 0x21, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x0b, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01,
+  0x00, 0x00, 0x05, 0x22, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x09,
+  0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x05, 0x23,
+  0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0xff, 0x00, 0x24,
+  0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x05, 0x24, 0x00, 0x03, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x07, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14,
+  0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x05, 0x25, 0x00, 0x03, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01,
+  0x00, 0x00, 0x05, 0x26, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02,
+  0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x05, 0x27,
+  0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14,
+  0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x05, 0x28, 0x00, 0x03, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x07, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01,
+  0x00, 0x00, 0x05, 0x29, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05,
+  0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x05, 0x2a,
+  0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x80, 0xff, 0x00, 0x24,
+  0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x05, 0x2b, 0x00, 0x03, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x07, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14,
+  0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x05, 0x2c, 0x00, 0x03, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x05, 0x2d, 0xff, 0xfd, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x2e, 0xff,
+  0xfd, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x05, 0x2f, 0xff, 0xfd, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05,
+  0x30, 0xff, 0xfd, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x31, 0xff, 0xfd, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x05, 0x32, 0xff, 0xfd, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x33, 0xff, 0xfd,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x05, 0x34, 0xff, 0xfd, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x35,
+  0xff, 0xfd, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x36, 0xff, 0xfd, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00,
+  0x05, 0x37, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x05, 0x38, 0x00, 0x03,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f,
+  0x6f, 0x01, 0x00, 0x00, 0x05, 0x39, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x02, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00,
+  0x05, 0x3a, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x0e, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00,
+  0x05, 0x3b, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x05, 0x3c, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x3d, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x05, 0x3e, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x3f, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x05, 0x40, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05,
+  0x41, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x42, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x05, 0x43, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x44, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x05, 0x45, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x46,
+  0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x47, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x05, 0x48, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x05, 0x49, 0x00, 0x05, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x08, 0x0d, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+  0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x05, 0x4a, 0x00, 0x05, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f,
+  0x01, 0x00, 0x00, 0x05, 0x4b, 0x00, 0x05, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x05, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x05,
+  0x4c, 0x00, 0x05, 0x02, 0x00, 0xff, 0x00, 0xff, 0x08, 0x80, 0xff, 0x00,
+  0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x05, 0x4d, 0x00, 0x05, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x05, 0x4e, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x4f,
+  0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x50, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x05, 0x51, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x52, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x05, 0x53, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x05, 0x54, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x6f, 0x01, 0x00, 0x00, 0x02, 0x7d,
+  0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x08, 0x80, 0xff, 0x00, 0x13,
+  0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x02, 0x7e, 0xff, 0xff, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x02, 0x7f, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x02, 0x80, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x02, 0x81, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0x82,
+  0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0xff, 0x00, 0x14,
+  0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0x83, 0x00, 0x03, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01,
+  0x00, 0x00, 0x02, 0x84, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05,
+  0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0x85,
+  0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14,
+  0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0x86, 0x00, 0x03, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x05, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01,
+  0x00, 0x00, 0x02, 0x87, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05,
+  0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0x88,
+  0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05, 0x80, 0xff, 0x00, 0x14,
+  0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0x89, 0x00, 0x03, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x05, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01,
+  0x00, 0x00, 0x02, 0x8a, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05,
+  0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01,
+  0x00, 0x00, 0x02, 0x8b, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05,
+  0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0x8c,
+  0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05, 0x80, 0xff, 0x00, 0x14,
+  0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0x8d, 0x00, 0x03, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01,
+  0x00, 0x00, 0x02, 0x8e, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03,
+  0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x02, 0x8f,
+  0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0x90,
+  0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14,
+  0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0x91, 0x00, 0x03, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01,
+  0x00, 0x00, 0x02, 0x92, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x08,
+  0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0x93,
+  0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x80, 0xff, 0x00, 0x14,
+  0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0x94, 0x00, 0x03, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x05, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01,
+  0x00, 0x00, 0x02, 0x95, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05,
+  0x0a, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01,
+  0x00, 0x00, 0x02, 0x96, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05,
+  0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0x97,
+  0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05, 0x80, 0xff, 0x00, 0x24,
+  0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x02, 0x98, 0x00, 0x03, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x03, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14,
+  0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0x99, 0x00, 0x03, 0x02, 0x00,
+  0xff, 0x00, 0xff, 0x04, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01,
+  0x00, 0x00, 0x02, 0x9a, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03,
+  0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x02, 0x9b,
+  0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x02, 0x9c, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x02, 0x9d, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x02, 0x9e, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x02, 0x9f, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x02, 0xa0, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f,
+  0x4f, 0x01, 0x00, 0x00, 0x02, 0xa1, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x02,
+  0xa2, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x10, 0x80, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02,
+  0xa3, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00,
+  0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0xa4, 0x00, 0x03, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f,
+  0x01, 0x00, 0x00, 0x02, 0xa5, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x08, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02,
+  0xa6, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0xff, 0x00,
+  0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0xa7, 0x00, 0x03, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x05, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f,
+  0x01, 0x00, 0x00, 0x02, 0xa8, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x05, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x02,
+  0xa9, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02,
+  0xaa, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x80, 0xff, 0x00,
+  0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x02, 0xab, 0x00, 0x03, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x02, 0xac, 0xff, 0xfe, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x02, 0xad, 0xff, 0xfe, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x02, 0xae, 0xff,
+  0xfe, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f,
+  0x6f, 0x01, 0x00, 0x00, 0x02, 0xaf, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x08, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00,
+  0x02, 0xb0, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0xb1, 0x00, 0x03,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x05, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f,
+  0xef, 0x01, 0x00, 0x00, 0x02, 0xb2, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x07, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f,
+  0x6f, 0x01, 0x00, 0x00, 0x02, 0xb3, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x03, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00,
+  0x02, 0xb4, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x02, 0xb5, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x02, 0xb6, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01,
+  0x00, 0x00, 0x02, 0xb7, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0xb8, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x09, 0x80, 0xff, 0x00, 0x13, 0x00,
+  0x0f, 0x4f, 0x01, 0x00, 0x00, 0x02, 0xb9, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00,
+  0x02, 0xba, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x09, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00,
+  0x02, 0xbb, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00,
+  0x02, 0xbc, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05, 0x80, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00,
+  0x02, 0xbd, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05, 0x80, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0xbe, 0x00, 0x03,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f,
+  0xef, 0x01, 0x00, 0x00, 0x02, 0xbf, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x05, 0x0a, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f,
+  0x6f, 0x01, 0x00, 0x00, 0x02, 0xc0, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x05, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00,
+  0x02, 0xc1, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x80, 0xff,
+  0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x02, 0xc2, 0x00, 0x03,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0xc3, 0x00, 0x03,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f,
+  0x6f, 0x01, 0x00, 0x00, 0x02, 0xc4, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00,
+  0xff, 0x08, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00,
+  0x02, 0xc5, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00,
+  0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0xc6, 0x00, 0x03, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x09, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef,
+  0x01, 0x00, 0x00, 0x02, 0xc7, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x04, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef,
+  0x01, 0x00, 0x00, 0x02, 0xc8, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x03, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef,
+  0x01, 0x00, 0x00, 0x02, 0xc9, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x04, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f,
+  0x01, 0x00, 0x00, 0x02, 0xca, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x05, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02,
+  0xcb, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05, 0x80, 0xff, 0x00,
+  0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02, 0xcc, 0x00, 0x03, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x07, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f,
+  0x01, 0x00, 0x00, 0x02, 0xcd, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x05, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x02,
+  0xce, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0xff, 0x00,
+  0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x02, 0xcf, 0xff, 0xff, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x23, 0x00, 0x0f, 0xcf, 0x01,
+  0x00, 0x00, 0x02, 0xd0, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0b,
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00,
+  0x00, 0x02, 0xd1, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff,
+  0x00, 0x13, 0x00, 0x0f, 0x4f, 0x01, 0x00, 0x00, 0x02, 0xd2, 0xff, 0xff,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0x13, 0x00, 0x0f, 0x4f,
+  0x01, 0x00, 0x00, 0x02, 0xd3, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x00, 0x00, 0x80, 0x00, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x6b, 0x00, 0x00, 0x04, 0x2e, 0x07, 0x00, 0x0b, 0x00, 0x3c,
+  0x30, 0x03, 0x00, 0x00, 0x00, 0x01, 0x25, 0x00, 0x10, 0x00, 0x3f, 0x00,
+  0x00, 0x60, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x03, 0xbd, 0x07, 0x00,
+  0x13, 0x00, 0x3f, 0x04, 0x08, 0x01, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00,
+  0x09, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x0f, 0xa0,
+  0xa2, 0x06, 0x00, 0x00, 0x8c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x09,
+  0xfd, 0x07, 0x33, 0xff, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x71, 0x00, 0x1f, 0x3f, 0x99, 0x3b, 0x78, 0x00, 0x00, 0x02, 0x00,
+  0xa1, 0x00, 0x00, 0x05, 0xb1, 0x00, 0x03, 0x00, 0x03, 0x01, 0x05, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x32, 0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x05, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x03, 0x00, 0x02, 0x00, 0x02, 0x56, 0x61, 0x6c, 0x65,
+  0x6e, 0x63, 0x69, 0x61, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40,
+  0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60,
+  0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x05, 0xb7, 0x07, 0x00, 0x1e, 0x00,
+  0x3f, 0x0f, 0xa0, 0xa2, 0x06, 0x00, 0x00, 0x7d, 0x00, 0x04, 0x00, 0x04,
+  0x00, 0x00, 0x03, 0x6d, 0x03, 0x30, 0xff, 0x0a, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0x13, 0x00, 0x3f, 0x04, 0x08, 0x01, 0x00, 0x00,
+  0x00, 0x6d, 0x00, 0x00, 0x04, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
+  0x00, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x05, 0x65, 0x00, 0x03, 0x00, 0x09,
+  0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x84, 0x00, 0x00, 0x0d, 0xa8, 0x07, 0x00, 0x09, 0x00, 0x3b,
+  0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x00,
+  0x00, 0x09, 0x4d, 0x00, 0x01, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x04, 0xff,
+  0x00, 0x03, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x06, 0x04, 0x00,
+  0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x09, 0x00, 0x3b,
+  0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x00, 0x70, 0x00, 0x28, 0x00, 0x28, 0x00, 0x1a, 0x00, 0x3f,
+  0x0c, 0xa0, 0xa2, 0x06, 0x00, 0x00, 0x72, 0x00, 0x00, 0x0b, 0x26, 0x04,
+  0x33, 0xff, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0c,
+  0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x81, 0x07, 0x00, 0x09,
+  0x00, 0x3b, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x0f, 0x00, 0x3f, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x06, 0x00, 0x09,
+  0x00, 0x3b, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x09, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x79, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x79, 0x00, 0x00, 0x15, 0x00, 0x3f, 0x00, 0x00, 0x19, 0x03,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x0a, 0x03,
+  0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+  0x00, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x1e, 0x00, 0x3f, 0x0f, 0xa0, 0xa2, 0x06, 0x00, 0x00, 0x71,
+  0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x05, 0x66, 0x06, 0x30, 0xff, 0x0a,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x10, 0x00, 0x3f, 0x00,
+  0x00, 0x60, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x03, 0x6c, 0x07, 0x00,
+  0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x10, 0x00, 0x3f,
+  0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x01, 0x75, 0x07,
+  0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x06, 0x04, 0x00, 0x0c, 0x00,
+  0x0f, 0x10, 0x00, 0x00, 0x00, 0x0d, 0xa8, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00,
+  0x00, 0x08, 0x04, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x02, 0x03,
+  0x00, 0x13, 0x00, 0x3f, 0x04, 0x08, 0x01, 0x00, 0x00, 0x00, 0x76, 0x00,
+  0x00, 0x0a, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x3f, 0x00,
+  0x00, 0x60, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x05, 0xed, 0x07, 0x00,
+  0x17, 0x00, 0x1f, 0x00, 0x80, 0xc0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6e,
+  0x00, 0x00, 0x00, 0x5f, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x09,
+  0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x3f, 0x00,
+  0x00, 0x60, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x0a, 0x9a, 0x07, 0x00,
+  0x0c, 0x00, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x08, 0xf6, 0x00, 0x02, 0x00,
+  0x14, 0x00, 0x3f, 0x0c, 0x08, 0x01, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00,
+  0x00, 0x1b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x02, 0x03, 0x00, 0x0a, 0x00, 0x3c, 0x10, 0x02, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00,
+  0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0d, 0x00, 0x3f,
+  0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x6d, 0x0d, 0x0b, 0x00, 0x14, 0x00,
+  0x3f, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x03, 0xda,
+  0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x14, 0x00, 0x3f, 0x0c, 0x08, 0x01, 0x00, 0x00, 0x00,
+  0x76, 0x00, 0x00, 0x0b, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+  0x00, 0x3f, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x0d,
+  0x28, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x3f, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x68, 0x01, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x14, 0x00, 0x3f, 0x0c, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x90, 0x04, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x0e, 0x01,
+  0x00, 0x02, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x6d, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x82, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x79, 0x00, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x75, 0x00, 0x00, 0x06, 0x73, 0x07, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x06, 0x00, 0x4e, 0x00,
+  0x33, 0x14, 0x00, 0x05, 0x00, 0x31, 0x00, 0x00, 0x03, 0x00, 0x05, 0x5d,
+  0x55, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30,
+  0x10, 0xdb, 0x0e, 0xfd, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2a, 0x4a, 0xf4, 0x5e, 0x5d, 0x55, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x2e, 0xa4, 0x7c, 0x5d,
+  0x55, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+  0x10, 0xdb, 0x0e, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x06, 0x04,
+  0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x6b, 0x00,
+  0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x7e, 0x00,
+  0x1f, 0x3f, 0x99, 0x39, 0x78, 0x00, 0x80, 0x02, 0x00, 0x6e, 0x00, 0x00,
+  0x08, 0xc1, 0x00, 0x01, 0x00, 0x01, 0x01, 0x05, 0x02, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00,
+  0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x69, 0x6d, 0x62, 0x61, 0x62,
+  0x77, 0x65, 0x00, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00, 0x18, 0x00, 0x00,
+  0x00, 0x75, 0x00, 0x28, 0x00, 0x28, 0x00, 0x0a, 0x00, 0x3c, 0x10, 0x03,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x02, 0x04, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x08,
+  0x04, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6e,
+  0x00, 0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x06,
+  0x02, 0x00, 0x4e, 0x00, 0x33, 0x14, 0x00, 0x05, 0x00, 0x31, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x05, 0x56, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x30, 0x2d, 0x78, 0x78, 0xff, 0x7f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x0a, 0x59, 0xab, 0x05,
+  0x56, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0,
+  0xde, 0x58, 0xc0, 0x05, 0x56, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x30, 0x2d, 0x78, 0x78, 0x00, 0x1a, 0x00, 0x0f, 0x80,
+  0x00, 0x00, 0x00, 0x0b, 0x5e, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x3f, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x56,
+  0x07, 0x00, 0x56, 0x00, 0x33, 0x14, 0x00, 0x16, 0x00, 0x35, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4d, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x66, 0x00, 0x13, 0x00, 0x3f, 0x04, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x6c, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x04, 0x00, 0x11,
+  0x00, 0x3f, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x78, 0x00, 0x0a, 0x00,
+  0x0a, 0x0d, 0x0b, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x72, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00,
+  0x00, 0x00, 0x05, 0xe3, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x0b, 0x00, 0x2e, 0x07, 0x00,
+  0x7d, 0x01, 0x00, 0x01, 0x01, 0x00, 0x13, 0x00, 0x3f, 0x04, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x01, 0x3b, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x80, 0x00, 0x1f, 0x19, 0x99, 0x39, 0x78, 0x00, 0x80, 0x02, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x53, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x02, 0x00,
+  0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00,
+  0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00,
+  0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x00,
+  0x02, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x53, 0x61, 0x6e, 0x6b, 0x74, 0x2d, 0x50, 0x65,
+  0x74, 0x65, 0x72, 0x62, 0x75, 0x72, 0x67, 0x00, 0x00, 0x09, 0x00, 0x3b,
+  0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x52, 0x00, 0x33, 0x14, 0x00, 0x16,
+  0x00, 0x31, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+  0xb7, 0xa8, 0x50, 0x2d, 0x56, 0x00, 0x00, 0x70, 0x3d, 0x04, 0x36, 0x2d,
+  0x56, 0x00, 0x00, 0xd3, 0x33, 0xcd, 0x35, 0x2d, 0x56, 0x00, 0x00, 0xa0,
+  0x3b, 0x04, 0x36, 0x2d, 0x56, 0x00, 0x00, 0xa0, 0x3b, 0x04, 0x36, 0x2d,
+  0x56, 0x00, 0x00, 0xd0, 0xac, 0x66, 0x4f, 0x2d, 0x56, 0x00, 0x00, 0x60,
+  0xa9, 0x62, 0x51, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00, 0x00,
+  0x00, 0x82, 0x00, 0x00, 0x0d, 0x80, 0x07, 0x00, 0x09, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x04, 0x04, 0x00, 0x0e, 0x00, 0x33, 0x14, 0x00, 0x05, 0x00,
+  0x30, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x01, 0xe3, 0x07, 0x00, 0x4e,
+  0x00, 0x33, 0x14, 0x00, 0x05, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x05, 0x56, 0x00, 0x00, 0x01, 0x00, 0x13, 0x02, 0x00, 0xff, 0x00, 0xff,
+  0x04, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x0f,
+  0x2e, 0x00, 0x13, 0x02, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0xff, 0x00,
+  0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x0f, 0x2f, 0x00, 0x13, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x04, 0x1c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+  0x0d, 0x00, 0x89, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x0f,
+  0x00, 0x0d, 0x00, 0x89, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x27,
+  0x0f, 0x00, 0x0d, 0x00, 0x89, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x27, 0x0f, 0x00, 0x0d, 0x00, 0x89, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x27, 0x0f, 0x00, 0x0d, 0x00, 0x89, 0x00, 0x02, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x27, 0x0f, 0x00, 0x12, 0x00, 0x33, 0x14, 0x00, 0x16, 0x00,
+  0x30, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x0c,
+  0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x6a, 0x07, 0x00, 0x10,
+  0x00, 0x3f, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x07,
+  0x85, 0x07, 0x00, 0x13, 0x00, 0x3f, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x73, 0x00, 0x00, 0x05, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x14, 0x00, 0x3f, 0x0c, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x05, 0xf2, 0x04, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x80, 0xc0, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x88, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x08, 0x20, 0x00, 0x00, 0x00, 0x91,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x06, 0x04, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x06,
+  0x04, 0x00, 0x13, 0x00, 0x3f, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7c,
+  0x00, 0x00, 0x0d, 0x7c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x0f,
+  0x04, 0x00, 0x00, 0x00, 0x0a, 0x34, 0x00, 0x03, 0x00, 0x14, 0x00, 0x3f,
+  0x0c, 0x08, 0x01, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x04, 0x68, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x00,
+  0x0b, 0x26, 0x00, 0x00, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0xb3, 0x07, 0x00, 0x14, 0x00, 0x3f,
+  0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x0c, 0x58, 0x04,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x3c, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x0f,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x82, 0x00, 0x75, 0x00, 0x0f, 0x00, 0x3f,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x0c, 0x00, 0x3f,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x14, 0x00, 0x3f,
+  0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0xad, 0x03,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x6d, 0x00, 0x3c, 0x99, 0x03, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x32, 0x30,
+  0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x32, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x31, 0x30, 0x30, 0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x06, 0x03, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x0d, 0x00, 0x3f, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x76, 0x02, 0x01, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00,
+  0x00, 0x6f, 0x00, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00, 0x00,
+  0x00, 0x6c, 0x00, 0x00, 0x00, 0xcf, 0x07, 0x00, 0x14, 0x00, 0x3f, 0x0c,
+  0x08, 0x01, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x03, 0xdb, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x06, 0x02,
+  0x00, 0x14, 0x00, 0x3f, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6d, 0x00,
+  0x00, 0x03, 0x58, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x00, 0x3b,
+  0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x00,
+  0x00, 0x05, 0xb9, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40,
+  0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x14, 0x00, 0x3f, 0x0c, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x04, 0x10, 0x06, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x06, 0x01, 0x00, 0x08,
+  0x00, 0xa9, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x0b, 0x19, 0x07, 0x00, 0x13,
+  0x00, 0x3f, 0x04, 0x08, 0x01, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60,
+  0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x05, 0x9c, 0x07, 0x00, 0x0c, 0x00,
+  0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x09, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00,
+  0x00, 0x06, 0x02, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x80, 0xc0, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x09, 0x00, 0x06,
+  0x00, 0x06, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x7c,
+  0x00, 0x04, 0x00, 0x0c, 0x00, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x08, 0xf1,
+  0x00, 0x87, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x06, 0x01, 0x00,
+  0x52, 0x00, 0x33, 0x14, 0x00, 0x04, 0x00, 0x31, 0x04, 0x00, 0x01, 0xb6,
+  0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0,
+  0x62, 0x90, 0x36, 0xb6, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x10, 0x00,
+  0x3f, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x0d, 0x7c,
+  0x07, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x79,
+  0x00, 0x00, 0x0b, 0x9f, 0x07, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x06, 0x03, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x00,
+  0x00, 0x02, 0x5b, 0x00, 0x04, 0x00, 0x0b, 0x00, 0xa7, 0x11, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x48, 0x00, 0x14, 0x00, 0x3f, 0x0c, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x84, 0x00, 0x00, 0x0c, 0xa2, 0x04, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x0e, 0x00, 0x33, 0x14, 0x00, 0x05, 0x00, 0x30, 0x00, 0x00, 0x03,
+  0x00, 0x04, 0x00, 0x1e, 0x00, 0x3f, 0x0f, 0xa0, 0xa2, 0x06, 0x00, 0x00,
+  0x76, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x0b, 0x76, 0x03, 0x01, 0xff,
+  0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x6d, 0x00, 0x3c,
+  0xb9, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x51, 0x32, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x32, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x30, 0x00, 0x00, 0x09, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x14, 0x00, 0x3f, 0x0c, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x03, 0xc0, 0x03, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x09, 0x00, 0x3b,
+  0x00, 0x00, 0x00, 0x06, 0x01, 0x00, 0x0d, 0x00, 0x3f, 0x00, 0x00, 0xc0,
+  0x00, 0x00, 0x00, 0x73, 0x02, 0x01, 0x00, 0x56, 0x00, 0x33, 0x14, 0x00,
+  0x16, 0x00, 0x35, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x35,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x3b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x23, 0x00, 0x1f, 0x00, 0xe0, 0xc0,
+  0x90, 0x12, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06,
+  0x00, 0x03, 0x00, 0x03, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x7d, 0x00, 0x00, 0x02, 0xc0, 0x07, 0x00, 0x09, 0x00, 0x3b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x3f, 0x00, 0x00, 0xd8,
+  0x03, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff,
+  0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x77, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00,
+  0x00, 0x8a, 0x00, 0x00, 0x13, 0x00, 0x3f, 0x04, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x7a, 0x00, 0x00, 0x0b, 0xfa, 0x00, 0x00, 0x00, 0x03, 0x00, 0x09,
+  0x00, 0x3b, 0x00, 0x00, 0x00, 0x06, 0x04, 0x00, 0x09, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x06, 0x02, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0xcb, 0x07, 0x00, 0x09, 0x00, 0x3b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40,
+  0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40,
+  0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40,
+  0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x13, 0x00, 0x3f, 0x04, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x05, 0xdb, 0x00, 0x00, 0x00, 0x05,
+  0x00, 0x13, 0x00, 0x3f, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x81, 0x00,
+  0x00, 0x0d, 0x7d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x02,
+  0x04, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x72,
+  0x00, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x6f,
+  0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0c,
+  0x00, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x0b, 0x1e, 0x00, 0x04, 0x00, 0x13,
+  0x00, 0x3f, 0x04, 0x08, 0x01, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40,
+  0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x08, 0x00, 0xaa, 0x01, 0x00, 0x00,
+  0x5f, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x74,
+  0x00, 0x00, 0x00, 0x0c, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x04,
+  0x04, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x09,
+  0x00, 0x3b, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x17, 0x00, 0x1f, 0x00,
+  0x80, 0xc0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x44,
+  0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00,
+  0x00, 0x00, 0x05, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x3f, 0x0c, 0x08,
+  0x01, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x03, 0xf8, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00,
+  0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00,
+  0x08, 0x00, 0xaa, 0x01, 0x00, 0x00, 0x5d, 0x00, 0x09, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x26, 0x07, 0x00, 0x1e, 0x00, 0x0f,
+  0x94, 0x00, 0x00, 0x00, 0x0a, 0x9f, 0x00, 0x03, 0x00, 0x78, 0x80, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00,
+  0x0c, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x05, 0x22, 0x00, 0x04, 0x00,
+  0x08, 0x00, 0xa9, 0x01, 0x00, 0x00, 0x94, 0x00, 0x14, 0x00, 0x3f, 0x0c,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xd4, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00,
+  0x00, 0x07, 0xd5, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x13,
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x07, 0xd6, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xd7, 0x00,
+  0x07, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80, 0xff, 0x00, 0x24, 0x00,
+  0x0f, 0xef, 0x01, 0x00, 0x00, 0x07, 0xd8, 0x00, 0x07, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x09, 0x80, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00,
+  0x0f, 0xef, 0x01, 0x00, 0x00, 0x07, 0xd9, 0x00, 0x07, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x06, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xda, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x07, 0xdb, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xdc, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xdd, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x07, 0xde, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xdf, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xe0, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x07, 0xe1, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xe2, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xe3, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x07, 0xe4, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xe5, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x24, 0x00,
+  0x0f, 0xef, 0x01, 0x00, 0x00, 0x07, 0xe6, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x07, 0x80, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xe7, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x09, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00,
+  0x00, 0x07, 0xe8, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00,
+  0x00, 0x07, 0xe9, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x80,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x07, 0xea, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xeb, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xec, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x07, 0xed, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xee, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xef, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x07, 0xf0, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80,
+  0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x07, 0xf1, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x80, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xf2, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0a, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xf3, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x09, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x07, 0xf4, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xf5, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xf6, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x07, 0xf7, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xf8, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xf9, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x07, 0xfa, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xfb, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x06, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x0c, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x07, 0xfd, 0x00, 0x06, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x80,
+  0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x07, 0xfe, 0x00,
+  0x06, 0x02, 0x00, 0xff, 0x00, 0xff, 0x09, 0x15, 0x00, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x07, 0xff, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x00, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x08, 0x01, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x02, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x03, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x08, 0x04, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x05, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x06, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x08, 0x07, 0x00, 0x07, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0a, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x08, 0x00,
+  0x07, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x09, 0x00, 0x07, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x0c, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x08, 0x0a, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x0b, 0x00,
+  0x07, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x0c, 0x00, 0x07, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x06, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00,
+  0x00, 0x08, 0x0d, 0x00, 0x07, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x80,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x08, 0x0e, 0x00, 0x07, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x0f, 0x00,
+  0x07, 0x02, 0x00, 0xff, 0x00, 0xff, 0x09, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x10, 0x00, 0x07, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x06, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00,
+  0x00, 0x08, 0x11, 0x00, 0x08, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x80,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00,
+  0x00, 0x08, 0x12, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x1f,
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x08, 0x13, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x14, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x15, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x08, 0x16, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x17, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x18, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x08, 0x19, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x1a, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x1b, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x08, 0x1c, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x1d, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x09, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x1e, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x09, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x08, 0x1f, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x20, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x21, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x08, 0x22, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x23, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x24, 0x00,
+  0x0f, 0xef, 0x01, 0x00, 0x00, 0x08, 0x24, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x1f, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x08, 0x25, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x07, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00,
+  0x00, 0x08, 0x26, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x80,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00,
+  0x00, 0x08, 0x27, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x08, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00,
+  0x00, 0x08, 0x28, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x1b,
+  0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00,
+  0x00, 0x08, 0x29, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x09, 0x80,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x08, 0x2a, 0xff, 0xfb, 0x02, 0x00, 0xff, 0x00, 0xff, 0x01, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x03, 0x27, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x17, 0x00, 0x00, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x03, 0x28, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x1d, 0x00, 0x20, 0x00, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x29, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x2a, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x07, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x2b, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x2c, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x2d, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x2e, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x2f, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x24, 0x00,
+  0x0f, 0xef, 0x01, 0x00, 0x00, 0x03, 0x30, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x13, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x31, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x32, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x33, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x24, 0x00,
+  0x0f, 0xef, 0x01, 0x00, 0x00, 0x03, 0x34, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x1f, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x35, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x0c, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00,
+  0x00, 0x03, 0x36, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x16,
+  0x00, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00,
+  0x00, 0x03, 0x37, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x08, 0x12,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x38, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80,
+  0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x03, 0x39, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x1b, 0x00, 0x00, 0x00, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x3a, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x3b, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x3c, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x3d, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x3e, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x3f, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x40, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x41, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x0a, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00,
+  0x00, 0x03, 0x42, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x43, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x44, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x45, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x0b, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00,
+  0x00, 0x03, 0x46, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x08, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x47, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0a, 0x80,
+  0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x03, 0x48, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x08, 0x12, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x49, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x08, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x4a, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x0a, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x4b, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x08, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x4c, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x05, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x4d, 0xff, 0xfe, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x4e, 0xff, 0xfe, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x4f, 0xff,
+  0xfe, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x50, 0xff, 0xfe, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00,
+  0x00, 0x03, 0x51, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x1b,
+  0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x52, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0a, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x53, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0a, 0x80, 0xff, 0x00, 0x24, 0x00,
+  0x0f, 0xef, 0x01, 0x00, 0x00, 0x03, 0x54, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x08, 0x12, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x55, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x08, 0x80, 0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00,
+  0x00, 0x03, 0x56, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x1d,
+  0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x57, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x58, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x59, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x0c, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x5a, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x80,
+  0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x03, 0x5b, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x5c, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x80, 0xff, 0x00, 0x24, 0x00,
+  0x0f, 0xef, 0x01, 0x00, 0x00, 0x03, 0x5d, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x06, 0x80, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00,
+  0x0f, 0xef, 0x01, 0x00, 0x00, 0x03, 0x5e, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x06, 0x80, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x00,
+  0x0f, 0xef, 0x01, 0x00, 0x00, 0x03, 0x5f, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x06, 0x1d, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x60, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x61, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x62, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x63, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x64, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x65, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x66, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x67, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x68, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x69, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x6a, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x6b, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x6c, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x07, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x6d, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x80,
+  0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x03, 0x6e, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x80, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x24, 0x00, 0x0f, 0xef, 0x01, 0x00, 0x00, 0x03, 0x6f, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x07, 0x80, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x70, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x71, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x02, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x72, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x73, 0xff,
+  0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x74, 0xff, 0xff, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x03, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x75, 0xff, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0x02, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x76, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80, 0xff, 0x00, 0x14, 0x00,
+  0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x77, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x08, 0x80, 0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00,
+  0x00, 0x03, 0x78, 0x00, 0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80,
+  0xff, 0x00, 0x14, 0x00, 0x0f, 0x6f, 0x01, 0x00, 0x00, 0x03, 0x79, 0x00,
+  0x03, 0x02, 0x00, 0xff, 0x00, 0xff, 0x06, 0x80, 0xff, 0x00, 0x24, 0x00,
+  0x0f, 0xef, 0x01, 0x00, 0x00, 0x03, 0x7a, 0x00, 0x03, 0x02, 0x00, 0xff,
+  0x00, 0xff, 0x07, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x73, 0x00, 0x65, 0x73, 0x70, 0x65, 0x72, 0x61, 0x6e, 0x74, 0x6f, 0x00,
+  0x2d, 0x00, 0x54, 0x68, 0x65, 0x20, 0x45, 0x73, 0x70, 0x65, 0x72, 0x61,
+  0x6e, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x20, 0x77, 0x6f,
+  0x72, 0x6c, 0x64, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x75, 0x6e, 0x69, 0x74,
+  0x79, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x45, 0x73, 0x70, 0x65, 0x72, 0x61, 0x6e, 0x74,
+  0x6f, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x2e, 0x00,
+  0x06, 0x4c, 0x2e, 0x4c, 0x2e, 0x20, 0x5a, 0x41, 0x4d, 0x45, 0x4e, 0x48,
+  0x4f, 0x46, 0x00, 0x54, 0x68, 0xc3, 0xa9, 0x6f, 0x70, 0x68, 0x69, 0x6c,
+  0x65, 0x20, 0x43, 0x41, 0x52, 0x54, 0x00, 0x46, 0x65, 0x72, 0x6e, 0x61,
+  0x6e, 0x64, 0x20, 0x44, 0x4f, 0x52, 0xc3, 0x89, 0x00, 0x47, 0x65, 0x6f,
+  0x72, 0x67, 0x65, 0x73, 0x20, 0x4b, 0x45, 0x52, 0x53, 0x41, 0x55, 0x44,
+  0x59, 0x00, 0x47, 0x65, 0x6f, 0x72, 0x67, 0x65, 0x73, 0x20, 0x4c, 0x41,
+  0x47, 0x52, 0x41, 0x4e, 0x47, 0x45, 0x00, 0x46, 0x72, 0x65, 0x64, 0x65,
+  0x72, 0x69, 0x63, 0x20, 0x50, 0x55, 0x4a, 0x55, 0x4c, 0xc3, 0x80, 0x20,
+  0x49, 0x20, 0x56, 0x41, 0x4c, 0x4c, 0xc3, 0x88, 0x53, 0x00, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x07, 0x01, 0x24, 0x00,
+  0x94, 0x7f, 0xef, 0x03, 0x00, 0x9d, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69,
+  0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x45, 0x73,
+  0x74, 0x6f, 0x6e, 0x69, 0x61, 0x6e, 0x00, 0x45, 0x73, 0x74, 0x6f, 0x6e,
+  0x69, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a,
+  0x45, 0x73, 0x74, 0x6f, 0x6e, 0x69, 0x61, 0x6e, 0x73, 0x00, 0x65, 0x73,
+  0x74, 0x6f, 0x6e, 0x69, 0x61, 0x00, 0x2d, 0x00, 0x45, 0x73, 0x74, 0x6f,
+  0x6e, 0x69, 0x61, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x6d, 0x61,
+  0x6c, 0x6c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x6f,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6f, 0x75, 0x74, 0x68, 0x20,
+  0x73, 0x68, 0x6f, 0x72, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x65, 0x61, 0x73, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x42, 0x61, 0x6c,
+  0x74, 0x69, 0x63, 0x20, 0x53, 0x65, 0x61, 0x2e, 0x20, 0x20, 0x49, 0x74,
+  0x73, 0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x61, 0x72,
+  0x65, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x6c, 0x79, 0x20, 0x72, 0x65,
+  0x6c, 0x61, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x6f,
+  0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x46, 0x69, 0x6e, 0x6c, 0x61, 0x6e,
+  0x64, 0x2e, 0x00, 0x05, 0x4b, 0x61, 0x6c, 0x65, 0x76, 0x69, 0x70, 0x6f,
+  0x65, 0x67, 0x00, 0x4c, 0x65, 0x6d, 0x62, 0x69, 0x74, 0x75, 0x00, 0x43,
+  0x61, 0x72, 0x6c, 0x20, 0x52, 0x6f, 0x62, 0x65, 0x72, 0x74, 0x20, 0x4a,
+  0x61, 0x6b, 0x6f, 0x62, 0x73, 0x6f, 0x6e, 0x00, 0x4b, 0x6f, 0x6e, 0x73,
+  0x74, 0x61, 0x6e, 0x74, 0x69, 0x6e, 0x20, 0x50, 0xc3, 0xa4, 0x74, 0x73,
+  0x00, 0x4c, 0x65, 0x6e, 0x6e, 0x61, 0x72, 0x74, 0x20, 0x4d, 0x65, 0x72,
+  0x69, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x07,
+  0x07, 0x02, 0x0f, 0x00, 0x94, 0xff, 0xef, 0x03, 0x00, 0x9e, 0x66, 0x72,
+  0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x00, 0x45, 0x72, 0x69, 0x74, 0x72, 0x65, 0x61, 0x6e, 0x00, 0x45,
+  0x72, 0x69, 0x74, 0x72, 0x65, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75,
+  0x72, 0x61, 0x6c, 0x3a, 0x45, 0x72, 0x69, 0x74, 0x72, 0x65, 0x61, 0x6e,
+  0x73, 0x00, 0x65, 0x72, 0x69, 0x74, 0x72, 0x65, 0x61, 0x00, 0x2d, 0x00,
+  0x45, 0x72, 0x69, 0x74, 0x72, 0x65, 0x61, 0x20, 0x69, 0x73, 0x20, 0x61,
+  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x69, 0x6e, 0x20,
+  0x65, 0x61, 0x73, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x41, 0x66, 0x72, 0x69,
+  0x63, 0x61, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x62, 0x6f, 0x72,
+  0x64, 0x65, 0x72, 0x73, 0x20, 0x53, 0x75, 0x64, 0x61, 0x6e, 0x2c, 0x20,
+  0x45, 0x74, 0x68, 0x69, 0x6f, 0x70, 0x69, 0x61, 0x2c, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x44, 0x6a, 0x69, 0x62, 0x6f, 0x75, 0x74, 0x69, 0x2e, 0x20,
+  0x49, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6f, 0x6e, 0x63, 0x65, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x4b, 0x69, 0x6e, 0x67, 0x64, 0x6f, 0x6d, 0x20,
+  0x6f, 0x66, 0x20, 0x44, 0x27, 0x6d, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x77, 0x61, 0x73, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x72, 0x20, 0x63, 0x6f,
+  0x6e, 0x71, 0x75, 0x65, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x49,
+  0x74, 0x61, 0x6c, 0x79, 0x2e, 0x20, 0x49, 0x6e, 0x20, 0x31, 0x39, 0x35,
+  0x31, 0x20, 0x69, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x66, 0x65, 0x64,
+  0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x45, 0x74, 0x68, 0x69, 0x6f, 0x70, 0x69, 0x61, 0x2c, 0x20, 0x77, 0x68,
+  0x69, 0x63, 0x68, 0x20, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x64, 0x65, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x20, 0x69, 0x6e, 0x64,
+  0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x6d, 0x6f,
+  0x76, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x31, 0x39, 0x36, 0x30, 0x73, 0x2e, 0x20, 0x49, 0x6e, 0x20,
+  0x31, 0x39, 0x39, 0x31, 0x20, 0x74, 0x68, 0x65, 0x20, 0x33, 0x31, 0x2d,
+  0x79, 0x65, 0x61, 0x72, 0x20, 0x77, 0x61, 0x72, 0x20, 0x65, 0x6e, 0x64,
+  0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x45, 0x72, 0x69, 0x74,
+  0x72, 0x65, 0x61, 0x20, 0x67, 0x61, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20,
+  0x69, 0x6e, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x65,
+  0x2e, 0x00, 0x04, 0x07, 0x49, 0x73, 0x61, 0x69, 0x61, 0x73, 0x20, 0x41,
+  0x66, 0x65, 0x77, 0x65, 0x72, 0x6b, 0x69, 0x00, 0x48, 0x61, 0x6d, 0x69,
+  0x64, 0x20, 0x49, 0x64, 0x72, 0x69, 0x73, 0x20, 0x41, 0x77, 0x61, 0x74,
+  0x65, 0x00, 0x41, 0x6c, 0x69, 0x20, 0x53, 0x61, 0x69, 0x64, 0x20, 0x41,
+  0x62, 0x64, 0x65, 0x6c, 0x6c, 0x61, 0x00, 0x42, 0x61, 0x68, 0x74, 0x61,
+  0x20, 0x48, 0x61, 0x67, 0x6f, 0x73, 0x00, 0x57, 0x6f, 0x6c, 0x64, 0x65,
+  0x61, 0x62, 0x20, 0x57, 0x6f, 0x6c, 0x64, 0x65, 0x6d, 0x61, 0x72, 0x69,
+  0x61, 0x6d, 0x00, 0x49, 0x62, 0x72, 0x61, 0x68, 0x69, 0x6d, 0x20, 0x53,
+  0x75, 0x6c, 0x74, 0x61, 0x6e, 0x20, 0x41, 0x6c, 0x69, 0x00, 0x46, 0x6f,
+  0x7a, 0x69, 0x61, 0x20, 0x48, 0x61, 0x73, 0x68, 0x69, 0x6d, 0x00, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x07,
+  0x01, 0x2a, 0x00, 0x94, 0xfe, 0xef, 0x03, 0x00, 0x9f, 0x45, 0x74, 0x68,
+  0x69, 0x6f, 0x70, 0x69, 0x61, 0x6e, 0x00, 0x45, 0x74, 0x68, 0x69, 0x6f,
+  0x70, 0x69, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c,
+  0x3a, 0x45, 0x74, 0x68, 0x69, 0x6f, 0x70, 0x69, 0x61, 0x6e, 0x73, 0x00,
+  0x65, 0x74, 0x68, 0x69, 0x6f, 0x70, 0x69, 0x61, 0x00, 0x69, 0x74, 0x61,
+  0x6c, 0x79, 0x00, 0x45, 0x74, 0x68, 0x69, 0x6f, 0x70, 0x69, 0x61, 0x20,
+  0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x6c, 0x64, 0x65, 0x73,
+  0x74, 0x20, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x20,
+  0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x6f, 0x6e, 0x65, 0x20,
+  0x74, 0x6f, 0x20, 0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x20, 0x69, 0x6e,
+  0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x20, 0x64, 0x75,
+  0x72, 0x69, 0x6e, 0x67, 0x20, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x61,
+  0x6e, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x6e, 0x69, 0x61, 0x6c, 0x69, 0x73,
+  0x6d, 0x2e, 0x00, 0x04, 0x09, 0x59, 0x65, 0x6b, 0x75, 0x6e, 0x6f, 0x20,
+  0x41, 0x6d, 0x6c, 0x61, 0x6b, 0x00, 0x5a, 0x6f, 0x73, 0x6b, 0x61, 0x6c,
+  0x65, 0x73, 0x00, 0x47, 0x65, 0x64, 0x61, 0x72, 0x61, 0x00, 0x4c, 0x61,
+  0x6c, 0x69, 0x62, 0x65, 0x6c, 0x61, 0x00, 0x5a, 0x61, 0x72, 0x61, 0x20,
+  0x59, 0x61, 0x6b, 0x6f, 0x62, 0x00, 0x54, 0x65, 0x77, 0x6f, 0x64, 0x72,
+  0x6f, 0x73, 0x20, 0x49, 0x49, 0x00, 0x4d, 0x65, 0x6e, 0x65, 0x6c, 0x69,
+  0x6b, 0x20, 0x49, 0x49, 0x00, 0x48, 0x61, 0x69, 0x6c, 0x65, 0x20, 0x53,
+  0x65, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x65, 0x00, 0x4d, 0x65, 0x6e, 0x67,
+  0x69, 0x73, 0x74, 0x75, 0x20, 0x48, 0x61, 0x69, 0x6c, 0x65, 0x20, 0x4d,
+  0x61, 0x72, 0x69, 0x61, 0x6d, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x02, 0x04, 0x03, 0x07, 0x03, 0x45,
+  0x00, 0x94, 0xff, 0xef, 0x03, 0x00, 0xa0, 0x66, 0x72, 0x65, 0x65, 0x63,
+  0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x45,
+  0x74, 0x72, 0x75, 0x73, 0x63, 0x61, 0x6e, 0x00, 0x45, 0x74, 0x72, 0x75,
+  0x73, 0x63, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c,
+  0x3a, 0x45, 0x74, 0x72, 0x75, 0x73, 0x63, 0x61, 0x6e, 0x73, 0x00, 0x65,
+  0x74, 0x72, 0x75, 0x73, 0x63, 0x61, 0x6e, 0x00, 0x69, 0x74, 0x61, 0x6c,
+  0x79, 0x00, 0x54, 0x68, 0x65, 0x20, 0x45, 0x74, 0x72, 0x75, 0x73, 0x63,
+  0x61, 0x6e, 0x73, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x20,
+  0x61, 0x6e, 0x63, 0x69, 0x65, 0x6e, 0x74, 0x20, 0x63, 0x69, 0x76, 0x69,
+  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x20,
+  0x45, 0x74, 0x72, 0x75, 0x72, 0x69, 0x61, 0x2c, 0x20, 0x49, 0x74, 0x61,
+  0x6c, 0x79, 0x2c, 0x20, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x61, 0x72, 0x74, 0x69,
+  0x73, 0x74, 0x69, 0x63, 0x20, 0x61, 0x63, 0x68, 0x69, 0x65, 0x76, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x62, 0x75,
+  0x69, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x65,
+  0x63, 0x72, 0x6f, 0x70, 0x6f, 0x6c, 0x69, 0x73, 0x65, 0x73, 0x2e, 0x20,
+  0x54, 0x68, 0x65, 0x69, 0x72, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61,
+  0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x70,
+  0x61, 0x72, 0x74, 0x6c, 0x79, 0x20, 0x64, 0x65, 0x63, 0x69, 0x70, 0x68,
+  0x65, 0x72, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65,
+  0x69, 0x72, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x73, 0x20, 0x61,
+  0x72, 0x65, 0x20, 0x73, 0x74, 0x69, 0x6c, 0x6c, 0x20, 0x64, 0x65, 0x62,
+  0x61, 0x74, 0x65, 0x64, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 0x63,
+  0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x73, 0x65,
+  0x6c, 0x76, 0x65, 0x73, 0x20, 0x52, 0x61, 0x73, 0x6e, 0x61, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 0x20, 0x61, 0x20,
+  0x63, 0x6f, 0x6e, 0x66, 0x65, 0x64, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x77, 0x65, 0x6c, 0x76, 0x65, 0x20,
+  0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x2e, 0x20, 0x49, 0x6e, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x36, 0x74, 0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75,
+  0x72, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x45, 0x74, 0x72, 0x75, 0x73,
+  0x63, 0x61, 0x6e, 0x20, 0x63, 0x69, 0x76, 0x69, 0x6c, 0x69, 0x7a, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x64,
+  0x20, 0x74, 0x6f, 0x20, 0x63, 0x72, 0x75, 0x6d, 0x62, 0x6c, 0x65, 0x20,
+  0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x52, 0x6f, 0x6d, 0x61, 0x6e, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x47, 0x61, 0x6c, 0x6c, 0x69, 0x63, 0x20, 0x69,
+  0x6e, 0x63, 0x75, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x20, 0x52,
+  0x6f, 0x6d, 0x65, 0x20, 0x69, 0x74, 0x73, 0x65, 0x6c, 0x66, 0x20, 0x70,
+  0x72, 0x6f, 0x62, 0x61, 0x62, 0x6c, 0x79, 0x20, 0x6f, 0x72, 0x69, 0x67,
+  0x69, 0x6e, 0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20,
+  0x63, 0x69, 0x74, 0x79, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x74,
+  0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x72, 0x65, 0x77, 0x20, 0x6f, 0x66,
+  0x66, 0x20, 0x45, 0x74, 0x72, 0x75, 0x73, 0x63, 0x61, 0x6e, 0x20, 0x64,
+  0x6f, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x41,
+  0x73, 0x20, 0x61, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x2c, 0x20,
+  0x52, 0x6f, 0x6d, 0x61, 0x6e, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+  0x73, 0x20, 0x6f, 0x66, 0x74, 0x65, 0x6e, 0x20, 0x70, 0x75, 0x74, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x45, 0x74, 0x72, 0x75, 0x73, 0x63, 0x61, 0x6e,
+  0x73, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x6e, 0x65, 0x67, 0x61, 0x74,
+  0x69, 0x76, 0x65, 0x20, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x2c, 0x20, 0x64,
+  0x65, 0x70, 0x69, 0x63, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65,
+  0x6d, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65, 0x78, 0x75, 0x61,
+  0x6c, 0x6c, 0x79, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x74, 0x69, 0x6f,
+  0x75, 0x73, 0x20, 0x63, 0x75, 0x6c, 0x74, 0x75, 0x72, 0x65, 0x2e, 0x20,
+  0x48, 0x6f, 0x77, 0x65, 0x76, 0x65, 0x72, 0x2c, 0x20, 0x52, 0x6f, 0x6d,
+  0x61, 0x6e, 0x20, 0x63, 0x69, 0x76, 0x69, 0x73, 0x74, 0x2e, 0x20, 0x4c,
+  0x61, 0x74, 0x65, 0x72, 0x20, 0x61, 0x74, 0x74, 0x65, 0x6d, 0x70, 0x74,
+  0x73, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x65, 0x75, 0x6e, 0x69, 0x66, 0x69,
+  0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x66,
+  0x61, 0x69, 0x6c, 0x65, 0x64, 0x2c, 0x20, 0x74, 0x68, 0x6f, 0x75, 0x67,
+  0x68, 0x20, 0x73, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x31, 0x39, 0x39, 0x33,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x65, 0x6e, 0x74, 0x72, 0x61, 0x6c,
+  0x20, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6e, 0x20, 0x72, 0x65,
+  0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x73, 0x20, 0x63, 0x6f, 0x6f, 0x70,
+  0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x43, 0x65, 0x6e, 0x74, 0x72, 0x61, 0x6c, 0x20, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x6e, 0x20, 0x49, 0x6e, 0x74, 0x65, 0x67, 0x72,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d,
+  0x20, 0x28, 0x53, 0x49, 0x43, 0x41, 0x29, 0x2e, 0x00, 0x02, 0x05, 0x47,
+  0x61, 0x62, 0x69, 0x6e, 0x6f, 0x20, 0x47, 0x61, 0xc3, 0xad, 0x6e, 0x7a,
+  0x61, 0x00, 0x56, 0x69, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x20, 0x46, 0x69,
+  0x6c, 0xc3, 0xad, 0x73, 0x6f, 0x6c, 0x61, 0x00, 0x4d, 0x61, 0x6e, 0x75,
+  0x65, 0x6c, 0x20, 0x4a, 0x6f, 0x73, 0xc3, 0xa9, 0x20, 0x41, 0x72, 0x63,
+  0x65, 0x00, 0x46, 0x72, 0x61, 0x6e, 0x63, 0x69, 0x73, 0x63, 0x6f, 0x20,
+  0x4d, 0x6f, 0x72, 0x61, 0x7a, 0xc3, 0xa1, 0x6e, 0x00, 0x4d, 0x61, 0x6e,
+  0x75, 0x65, 0x6c, 0x20, 0x43, 0x6f, 0x72, 0x6f, 0x6e, 0x65, 0x6c, 0x20,
+  0x4d, 0x61, 0x74, 0x75, 0x73, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x05, 0x07, 0x05, 0x4a, 0x00, 0x94, 0xff, 0xef, 0x03, 0x00,
+  0x61, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x73, 0x00, 0x43, 0x65, 0x6e, 0x74, 0x72, 0x61, 0x6c,
+  0x20, 0x4c, 0x69, 0x74, 0x68, 0x75, 0x61, 0x6e, 0x69, 0x61, 0x6e, 0x00,
+  0x43, 0x65, 0x6e, 0x74, 0x72, 0x61, 0x6c, 0x20, 0x4c, 0x69, 0x74, 0x68,
+  0x75, 0x61, 0x6e, 0x69, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72,
+  0x61, 0x6c, 0x3a, 0x43, 0x65, 0x6e, 0x74, 0x72, 0x61, 0x6c, 0x20, 0x4c,
+  0x69, 0x74, 0x68, 0x75, 0x61, 0x6e, 0x69, 0x61, 0x6e, 0x73, 0x00, 0x63,
+  0x65, 0x6e, 0x74, 0x72, 0x61, 0x6c, 0x5f, 0x6c, 0x69, 0x74, 0x68, 0x75,
+  0x61, 0x6e, 0x69, 0x61, 0x00, 0x2d, 0x00, 0x4c, 0x69, 0x74, 0x68, 0x75,
+  0x61, 0x6e, 0x69, 0x61, 0x6e, 0x20, 0x50, 0x6f, 0x6c, 0x65, 0x73, 0x20,
+  0x61, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x74, 0x68, 0x6e, 0x69,
+  0x63, 0x20, 0x6d, 0x69, 0x6e, 0x6f, 0x72, 0x69, 0x74, 0x79, 0x20, 0x69,
+  0x6e, 0x20, 0x4c, 0x69, 0x74, 0x68, 0x75, 0x61, 0x6e, 0x69, 0x61, 0x2c,
+  0x20, 0x6d, 0x61, 0x69, 0x6e, 0x6c, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x41, 0x75, 0x6b, 0x73, 0x68, 0x74, 0x6f, 0x74, 0x61,
+  0x20, 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x54, 0x68, 0x65,
+  0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x20, 0x72, 0x65, 0x6d, 0x6e,
+  0x61, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50,
+  0x6f, 0x6c, 0x69, 0x73, 0x68, 0x2d, 0x4c, 0x69, 0x74, 0x68, 0x75, 0x61,
+  0x6e, 0x69, 0x61, 0x6e, 0x20, 0x43, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x77,
+  0x65, 0x61, 0x6c, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x43, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x77, 0x65, 0x61, 0x6c, 0x74, 0x68,
+  0x20, 0x6f, 0x66, 0x20, 0x54, 0x77, 0x6f, 0x20, 0x4e, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x77,
+  0x61, 0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x55, 0x6e, 0x69, 0x6f,
+  0x6e, 0x20, 0x6f, 0x66, 0x20, 0x4c, 0x75, 0x62, 0x6c, 0x69, 0x6e, 0x20,
+  0x69, 0x6e, 0x20, 0x31, 0x35, 0x36, 0x39, 0x2e, 0x20, 0x54, 0x68, 0x69,
+  0x73, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x75, 0x6e, 0x69, 0x74,
+  0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4b, 0x69, 0x6e, 0x67, 0x64,
+  0x6f, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x50, 0x6f, 0x6c, 0x61, 0x6e, 0x64,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x72,
+  0x61, 0x6e, 0x64, 0x20, 0x44, 0x75, 0x63, 0x68, 0x79, 0x20, 0x6f, 0x66,
+  0x20, 0x4c, 0x69, 0x74, 0x68, 0x75, 0x61, 0x6e, 0x69, 0x61, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x77, 0x61, 0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64,
+  0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69,
+  0x74, 0x68, 0x75, 0x61, 0x6e, 0x69, 0x61, 0x6e, 0x20, 0x67, 0x72, 0x61,
+  0x6e, 0x64, 0x20, 0x64, 0x75, 0x6b, 0x65, 0x20, 0x4a, 0x6f, 0x67, 0x61,
+  0x69, 0x6c, 0x61, 0x2c, 0x20, 0x77, 0x68, 0x6f, 0x20, 0x77, 0x61, 0x73,
+  0x20, 0x62, 0x61, 0x70, 0x74, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20,
+  0x57, 0xc5, 0x82, 0x61, 0x64, 0x79, 0x73, 0xc5, 0x82, 0x61, 0x77, 0x2e,
+  0x20, 0x54, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x63,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x20, 0x50, 0x6f, 0x6c, 0x69, 0x73, 0x68, 0x20, 0x63, 0x6f,
+  0x6d, 0x6d, 0x75, 0x6e, 0x69, 0x74, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x4c,
+  0x69, 0x74, 0x68, 0x75, 0x61, 0x6e, 0x69, 0x61, 0x20, 0x64, 0x61, 0x74,
+  0x65, 0x73, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x74, 0x6f, 0x20, 0x64,
+  0x75, 0x6b, 0x65, 0x20, 0x4d, 0x69, 0x6e, 0x64, 0x61, 0x75, 0x67, 0x61,
+  0x73, 0x20, 0x6f, 0x66, 0x20, 0x4c, 0x69, 0x74, 0x68, 0x75, 0x61, 0x6e,
+  0x69, 0x61, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+  0x74, 0x20, 0x50, 0x6f, 0x6c, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6d, 0x65,
+  0x20, 0x74, 0x6f, 0x20, 0x4c, 0x69, 0x74, 0x68, 0x75, 0x61, 0x6e, 0x69,
+  0x61, 0x20, 0x61, 0x73, 0x20, 0x70, 0x72, 0x69, 0x73, 0x6f, 0x6e, 0x65,
+  0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x77, 0x61, 0x72, 0x20, 0x74, 0x61,
+  0x6b, 0x65, 0x6e, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x72,
+  0x61, 0x69, 0x64, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x66, 0x72, 0x6f, 0x6e, 0x74, 0x69, 0x65, 0x72, 0x20, 0x6c, 0x61, 0x6e,
+  0x64, 0x73, 0x20, 0x28, 0x6d, 0x61, 0x69, 0x6e, 0x6c, 0x79, 0x20, 0x74,
+  0x6f, 0x20, 0x4d, 0x61, 0x7a, 0x6f, 0x76, 0x69, 0x61, 0x29, 0x2e, 0x20,
+  0x41, 0x66, 0x74, 0x65, 0x72, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x69, 0x6e,
+  0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x72,
+  0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x61, 0x20, 0x76, 0x65, 0x72, 0x79,
+  0x20, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x20, 0x50, 0x6f, 0x6c, 0x6f,
+  0x6e, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x74, 0x68, 0x75, 0x61, 0x6e, 0x69,
+  0x61, 0x6e, 0x20, 0x6e, 0x6f, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x2e,
+  0x20, 0x54, 0x68, 0x65, 0x20, 0x50, 0x6f, 0x6c, 0x69, 0x73, 0x68, 0x2d,
+  0x73, 0x70, 0x65, 0x61, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x6d,
+  0x6d, 0x75, 0x6e, 0x69, 0x74, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x4c, 0x69,
+  0x74, 0x68, 0x75, 0x61, 0x6e, 0x69, 0x61, 0x20, 0x73, 0x75, 0x72, 0x76,
+  0x69, 0x76, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6c,
+  0x6c, 0x61, 0x70, 0x73, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x61,
+  0x72, 0x74, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x50, 0x6f, 0x6c, 0x69, 0x73, 0x68, 0x20, 0x73, 0x74,
+  0x61, 0x74, 0x65, 0x2c, 0x20, 0x63, 0x6f, 0x2d, 0x65, 0x78, 0x69, 0x73,
+  0x74, 0x69, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x4c, 0x69,
+  0x74, 0x68, 0x75, 0x61, 0x6e, 0x69, 0x61, 0x6e, 0x2d, 0x73, 0x70, 0x65,
+  0x61, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65,
+  0x2e, 0x20, 0x49, 0x6e, 0x20, 0x31, 0x39, 0x32, 0x30, 0x2c, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x72, 0x65, 0x62, 0x65, 0x6c, 0x6c, 0x69, 0x6f, 0x75,
+  0x73, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0xc5, 0xbb,
+  0x65, 0x6c, 0x69, 0x67, 0x6f, 0x77, 0x73, 0x6b, 0x69, 0x20, 0x61, 0x6e,
+  0x6e, 0x6f, 0x75, 0x6e, 0x63, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20,
+  0x61, 0x20, 0x52, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x6f,
+  0x66, 0x20, 0x43, 0x65, 0x6e, 0x74, 0x72, 0x61, 0x6c, 0x20, 0x4c, 0x69,
+  0x74, 0x68, 0x75, 0x61, 0x6e, 0x69, 0x61, 0x2c, 0x20, 0x77, 0x68, 0x69,
+  0x63, 0x68, 0x20, 0x77, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20,
+  0x69, 0x6e, 0x63, 0x6f, 0x72, 0x70, 0x6f, 0x72, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x50, 0x6f, 0x6c, 0x61, 0x6e, 0x64,
+  0x2e, 0x20, 0x41, 0x66, 0x74, 0x65, 0x72, 0x20, 0x57, 0x6f, 0x72, 0x6c,
+  0x64, 0x20, 0x57, 0x61, 0x72, 0x20, 0x49, 0x49, 0x20, 0x6d, 0x6f, 0x73,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x74,
+  0x68, 0x75, 0x61, 0x6e, 0x69, 0x61, 0x6e, 0x20, 0x50, 0x6f, 0x6c, 0x65,
+  0x73, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c,
+  0x61, 0x63, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x50, 0x6f, 0x6c, 0x61,
+  0x6e, 0x64, 0x27, 0x73, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x77, 0x65, 0x73,
+  0x74, 0x65, 0x72, 0x6e, 0x20, 0x74, 0x65, 0x72, 0x72, 0x69, 0x74, 0x6f,
+  0x72, 0x69, 0x65, 0x73, 0x2e, 0x00, 0x05, 0x07, 0x47, 0x61, 0x62, 0x72,
+  0x69, 0x65, 0x6c, 0x20, 0x4e, 0x61, 0x72, 0x75, 0x74, 0x6f, 0x77, 0x69,
+  0x63, 0x7a, 0x00, 0x4a, 0xc3, 0xb3, 0x7a, 0x65, 0x66, 0x20, 0x50, 0x69,
+  0xc5, 0x82, 0x73, 0x75, 0x64, 0x73, 0x6b, 0x69, 0x00, 0x4c, 0x75, 0x63,
+  0x6a, 0x61, 0x6e, 0x20, 0xc5, 0xbb, 0x65, 0x6c, 0x69, 0x67, 0x6f, 0x77,
+  0x73, 0x6b, 0x69, 0x00, 0x57, 0x69, 0x74, 0x6f, 0x6c, 0x64, 0x20, 0x41,
+  0x62, 0x72, 0x61, 0x6d, 0x6f, 0x77, 0x69, 0x63, 0x7a, 0x00, 0x4d, 0x69,
+  0x65, 0x63, 0x7a, 0x79, 0x73, 0xc5, 0x82, 0x61, 0x77, 0x20, 0x45, 0x6e,
+  0x67, 0x69, 0x65, 0x6c, 0x00, 0x4a, 0x65, 0x72, 0x7a, 0x79, 0x20, 0x49,
+  0x77, 0x61, 0x6e, 0x6f, 0x77, 0x73, 0x6b, 0x69, 0x00, 0x53, 0x74, 0x65,
+  0x66, 0x61, 0x6e, 0x20, 0x4d, 0x6f, 0x6b, 0x72, 0x7a, 0x65, 0x63, 0x6b,
+  0x69, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x07, 0x07, 0x01, 0x8f, 0x00, 0x94, 0xff, 0xef, 0x03, 0x00, 0x62, 0x66,
+  0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x73, 0x00, 0x43, 0x68, 0x61, 0x64, 0x69, 0x61, 0x6e, 0x00, 0x43,
+  0x68, 0x61, 0x64, 0x69, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72,
+  0x61, 0x6c, 0x3a, 0x43, 0x68, 0x61, 0x64, 0x69, 0x61, 0x6e, 0x73, 0x00,
+  0x63, 0x68, 0x61, 0x64, 0x00, 0x2d, 0x00, 0x43, 0x68, 0x61, 0x64, 0x20,
+  0x69, 0x73, 0x20, 0x61, 0x20, 0x6c, 0x61, 0x6e, 0x64, 0x6c, 0x6f, 0x63,
+  0x6b, 0x65, 0x64, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72, 0x79, 0x20,
+  0x69, 0x6e, 0x20, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2e, 0x20, 0x4f,
+  0x6e, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x74, 0x65,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4b, 0x61, 0x6e, 0x65,
+  0x6d, 0x2d, 0x42, 0x6f, 0x72, 0x6e, 0x75, 0x20, 0x45, 0x6d, 0x70, 0x69,
+  0x72, 0x65, 0x2c, 0x20, 0x43, 0x68, 0x61, 0x64, 0x20, 0x77, 0x61, 0x73,
+  0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x6e, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x62,
+  0x79, 0x20, 0x46, 0x72, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x20,
+  0x31, 0x39, 0x30, 0x30, 0x2e, 0x20, 0x49, 0x6e, 0x64, 0x65, 0x70, 0x65,
+  0x6e, 0x64, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x6e, 0x63, 0x65, 0x20,
+  0x31, 0x39, 0x36, 0x30, 0x2c, 0x20, 0x43, 0x68, 0x61, 0x64, 0x20, 0x72,
+  0x65, 0x6d, 0x61, 0x69, 0x6e, 0x73, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x6f, 0x72, 0x65, 0x73,
+  0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64,
+  0x2e, 0x20, 0x46, 0x72, 0x6f, 0x6d, 0x20, 0x31, 0x39, 0x38, 0x32, 0x20,
+  0x74, 0x6f, 0x20, 0x31, 0x39, 0x39, 0x30, 0x20, 0x48, 0x69, 0x73, 0x73,
+  0x65, 0x6e, 0x65, 0x20, 0x48, 0x61, 0x62, 0x72, 0xc3, 0xa9, 0x20, 0x6c,
+  0x65, 0x64, 0x20, 0x61, 0x20, 0x6e, 0x6f, 0x74, 0x6f, 0x72, 0x69, 0x6f,
+  0x75, 0x73, 0x6c, 0x79, 0x20, 0x62, 0x72, 0x75, 0x74, 0x61, 0x6c, 0x20,
+  0x64, 0x69, 0x63, 0x74, 0x61, 0x74, 0x6f, 0x72, 0x73, 0x68, 0x69, 0x70,
+  0x2e, 0x00, 0x02, 0x03, 0x46, 0x72, 0x61, 0x6e, 0xc3, 0xa7, 0x6f, 0x69,
+  0x73, 0x20, 0x54, 0x6f, 0x6d, 0x62, 0x61, 0x6c, 0x62, 0x61, 0x79, 0x65,
+  0x00, 0x46, 0xc3, 0xa9, 0x6c, 0x69, 0x78, 0x20, 0x4d, 0x61, 0x6c, 0x6c,
+  0x6f, 0x75, 0x6d, 0x00, 0x48, 0x69, 0x73, 0x73, 0xc3, 0xa8, 0x6e, 0x65,
+  0x69, 0x73, 0x68, 0x00, 0x75, 0x6e, 0x69, 0x74, 0x65, 0x64, 0x5f, 0x6b,
+  0x69, 0x6e, 0x67, 0x64, 0x6f, 0x6d, 0x00, 0x2d, 0x00, 0x54, 0x68, 0x65,
+  0x20, 0x55, 0x6e, 0x69, 0x74, 0x65, 0x64, 0x20, 0x4b, 0x69, 0x6e, 0x67,
+  0x64, 0x6f, 0x6d, 0x20, 0x77, 0x61, 0x73, 0x20, 0x63, 0x72, 0x65, 0x61,
+  0x74, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x37, 0x30, 0x37, 0x20,
+  0x61, 0x73, 0x20, 0x61, 0x20, 0x6e, 0x65, 0x67, 0x6f, 0x74, 0x69, 0x61,
+  0x74, 0x65, 0x64, 0x20, 0x61, 0x67, 0x72, 0x65, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x64, 0x6f, 0x6d, 0x20, 0x6f, 0x66,
+  0x20, 0x45, 0x6e, 0x67, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x64, 0x6f, 0x6d,
+  0x20, 0x6f, 0x66, 0x20, 0x53, 0x63, 0x6f, 0x74, 0x6c, 0x61, 0x6e, 0x64,
+  0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72,
+  0x79, 0x20, 0x2d, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x6b, 0x6e, 0x6f,
+  0x77, 0x6e, 0x20, 0x61, 0x73, 0x20, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20,
+  0x42, 0x72, 0x69, 0x74, 0x61, 0x69, 0x6e, 0x20, 0x2d, 0x20, 0x62, 0x65,
+  0x63, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x65, 0x61,
+  0x64, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e, 0x64, 0x75, 0x73, 0x74, 0x72,
+  0x69, 0x61, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6d, 0x61, 0x72, 0x69,
+  0x74, 0x69, 0x6d, 0x65, 0x20, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x69,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x39, 0x74, 0x68, 0x20, 0x63,
+  0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x2e, 0x00, 0x06, 0x42, 0x65, 0x6e,
+  0x6a, 0x61, 0x6d, 0x69, 0x6e, 0x20, 0x44, 0x69, 0x73, 0x72, 0x61, 0x65,
+  0x6c, 0x69, 0x00, 0x57, 0x69, 0x6c, 0x6c, 0x69, 0x61, 0x6d, 0x20, 0x47,
+  0x6c, 0x61, 0x64, 0x73, 0x74, 0x6f, 0x6e, 0x65, 0x00, 0x47, 0x65, 0x6f,
+  0x72, 0x67, 0x65, 0x20, 0x56, 0x49, 0x00, 0x56, 0x69, 0x63, 0x74, 0x6f,
+  0x72, 0x69, 0x61, 0x00, 0x57, 0x69, 0x6e, 0x73, 0x74, 0x6f, 0x6e, 0x20,
+  0x43, 0x68, 0x75, 0x72, 0x63, 0x68, 0x69, 0x6c, 0x6c, 0x00, 0x4d, 0x61,
+  0x72, 0x67, 0x61, 0x72, 0x65, 0x74, 0x20, 0x54, 0x68, 0x61, 0x74, 0x63,
+  0x68, 0x65, 0x72, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01,
+  0x03, 0x02, 0x03, 0x07, 0x07, 0x01, 0x48, 0x00, 0x94, 0xff, 0xef, 0x03,
+  0x00, 0x48, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x42, 0x72, 0x69, 0x74, 0x6f, 0x6e,
+  0x00, 0x42, 0x72, 0x69, 0x74, 0x6f, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75,
+  0x72, 0x61, 0x6c, 0x3a, 0x42, 0x72, 0x69, 0x74, 0x6f, 0x6e, 0x73, 0x00,
+  0x62, 0x72, 0x69, 0x74, 0x61, 0x6e, 0x6e, 0x69, 0x61, 0x00, 0x67, 0x61,
+  0x75, 0x6c, 0x00, 0x54, 0x68, 0x65, 0x20, 0x42, 0x72, 0x69, 0x74, 0x6f,
+  0x6e, 0x73, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x69, 0x6e, 0x68, 0x61, 0x62, 0x69, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x6d, 0x6f, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x47,
+  0x72, 0x65, 0x61, 0x74, 0x20, 0x42, 0x72, 0x69, 0x74, 0x61, 0x69, 0x6e,
+  0x20, 0x64, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x49, 0x72, 0x6f, 0x6e, 0x20, 0x41, 0x67, 0x65, 0x2e, 0x20, 0x54, 0x68,
+  0x65, 0x79, 0x20, 0x73, 0x70, 0x6f, 0x6b, 0x65, 0x20, 0x42, 0x72, 0x79,
+  0x74, 0x68, 0x6f, 0x6e, 0x69, 0x63, 0x20, 0x43, 0x65, 0x6c, 0x74, 0x69,
+  0x63, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x73, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x61, 0x6e, 0x63, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x73, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x72, 0x6e, 0x20,
+  0x57, 0x65, 0x6c, 0x73, 0x68, 0x2c, 0x20, 0x43, 0x6f, 0x72, 0x6e, 0x69,
+  0x73, 0x68, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x42, 0x72, 0x65, 0x74, 0x6f,
+  0x6e, 0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x2e, 0x00, 0x05, 0x05,
+  0x43, 0x75, 0x6e, 0x6f, 0x62, 0x65, 0x6c, 0x69, 0x6e, 0x6f, 0x73, 0x00,
+  0x43, 0x61, 0x73, 0x73, 0x69, 0x77, 0x65, 0x6c, 0x6c, 0x61, 0x75, 0x6e,
+  0x6f, 0x73, 0x00, 0x43, 0x61, 0x72, 0x61, 0x74, 0x61, 0x63, 0x6f, 0x73,
+  0x00, 0x43, 0x61, 0x72, 0x74, 0x69, 0x73, 0x6d, 0x61, 0x6e, 0x64, 0x75,
+  0x61, 0x00, 0x42, 0x6f, 0x75, 0x64, 0x69, 0x63, 0x61, 0x00, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x02, 0x00, 0x07, 0x07, 0x01, 0xc5, 0x00,
+  0x94, 0xff, 0xef, 0x03, 0x00, 0x49, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69,
+  0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x42, 0x72,
+  0x75, 0x6e, 0x65, 0x69, 0x61, 0x6e, 0x00, 0x42, 0x72, 0x75, 0x6e, 0x65,
+  0x69, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a,
+  0x42, 0x72, 0x75, 0x6e, 0x65, 0x69, 0x61, 0x6e, 0x73, 0x00, 0x62, 0x72,
+  0x75, 0x6e, 0x65, 0x69, 0x00, 0x2d, 0x00, 0x42, 0x72, 0x75, 0x6e, 0x65,
+  0x69, 0x20, 0x44, 0x61, 0x72, 0x75, 0x73, 0x73, 0x61, 0x6c, 0x61, 0x6d,
+  0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72,
+  0x79, 0x20, 0x6f, 0x6e, 0x20, 0x42, 0x6f, 0x72, 0x6e, 0x65, 0x6f, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4d, 0x61, 0x6c, 0x61, 0x79,
+  0x20, 0x61, 0x63, 0x68, 0x69, 0x70, 0x65, 0x6c, 0x61, 0x67, 0x6f, 0x2e,
+  0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6c, 0x74, 0x61, 0x6e, 0x61,
+  0x74, 0x65, 0x20, 0x64, 0x61, 0x74, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x34, 0x74, 0x68, 0x20, 0x63,
+  0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x62,
+  0x65, 0x63, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x20, 0x66, 0x61, 0x69, 0x72,
+  0x6c, 0x79, 0x20, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x66, 0x75, 0x6c, 0x20,
+  0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x63, 0x65, 0x6e, 0x74,
+  0x75, 0x72, 0x79, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68,
+  0x61, 0x6e, 0x6b, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x74, 0x73, 0x20,
+  0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6d, 0x61, 0x72, 0x69, 0x74, 0x69, 0x6d, 0x65, 0x20,
+  0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x6d, 0x75, 0x63,
+  0x68, 0x20, 0x6f, 0x66, 0x20, 0x53, 0x6f, 0x75, 0x74, 0x68, 0x65, 0x61,
+  0x73, 0x74, 0x20, 0x41, 0x73, 0x69, 0x61, 0x2e, 0x20, 0x42, 0x72, 0x75,
+  0x6e, 0x65, 0x69, 0x20, 0x77, 0x61, 0x73, 0x20, 0x61, 0x20, 0x42, 0x72,
+  0x69, 0x74, 0x69, 0x73, 0x68, 0x20, 0x70, 0x72, 0x6f, 0x74, 0x65, 0x63,
+  0x74, 0x6f, 0x72, 0x61, 0x74, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20,
+  0x31, 0x38, 0x38, 0x38, 0x20, 0x74, 0x6f, 0x20, 0x31, 0x39, 0x38, 0x34,
+  0x2e, 0x00, 0x03, 0x06, 0x4d, 0x75, 0x68, 0x61, 0x6d, 0x6d, 0x61, 0x64,
+  0x20, 0x53, 0x68, 0x61, 0x68, 0x00, 0x42, 0x6f, 0x6c, 0x6b, 0x69, 0x61,
+  0x68, 0x00, 0x53, 0x61, 0x69, 0x66, 0x75, 0x6c, 0x20, 0x52, 0x69, 0x6a,
+  0x61, 0x6c, 0x00, 0x48, 0x75, 0x73, 0x73, 0x69, 0x6e, 0x20, 0x4b, 0x61,
+  0x6d, 0x61, 0x6c, 0x75, 0x64, 0x64, 0x69, 0x6e, 0x00, 0x41, 0x2e, 0x20,
+  0x4d, 0x2e, 0x20, 0x41, 0x7a, 0x61, 0x68, 0x61, 0x72, 0x69, 0x00, 0x48,
+  0x61, 0x73, 0x73, 0x61, 0x6e, 0x61, 0x6c, 0x20, 0x42, 0x6f, 0x6c, 0x6b,
+  0x69, 0x61, 0x68, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x04, 0x01, 0x02, 0x03, 0x06, 0x07, 0x01, 0x73, 0x00, 0x94, 0x7f, 0xef,
+  0x03, 0x00, 0x4a, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x42, 0x75, 0x6c, 0x67, 0x61,
+  0x72, 0x69, 0x61, 0x6e, 0x00, 0x42, 0x75, 0x6c, 0x67, 0x61, 0x72, 0x69,
+  0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x42,
+  0x75, 0x6c, 0x67, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x73, 0x00, 0x62, 0x75,
+  0x6c, 0x67, 0x61, 0x72, 0x69, 0x61, 0x00, 0x2d, 0x00, 0x42, 0x75, 0x6c,
+  0x67, 0x61, 0x72, 0x20, 0x6c, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x4b,
+  0x68, 0x61, 0x6e, 0x20, 0x41, 0x73, 0x70, 0x61, 0x72, 0x75, 0x6b, 0x68,
+  0x20, 0x6c, 0x65, 0x64, 0x20, 0x68, 0x69, 0x73, 0x20, 0x70, 0x65, 0x6f,
+  0x70, 0x6c, 0x65, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6e, 0x6f, 0x72, 0x74, 0x68, 0x65, 0x72, 0x6e, 0x20, 0x42, 0x61,
+  0x6c, 0x6b, 0x61, 0x6e, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x66,
+  0x6f, 0x75, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x42, 0x75, 0x6c, 0x67, 0x61,
+  0x72, 0x69, 0x61, 0x20, 0x69, 0x6e, 0x20, 0x36, 0x38, 0x31, 0x2e, 0x20,
+  0x54, 0x68, 0x69, 0x73, 0x20, 0x77, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x53, 0x6c, 0x61, 0x76, 0x69,
+  0x63, 0x20, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x73, 0x74, 0x61,
+  0x74, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72,
+  0x79, 0x2e, 0x00, 0x0e, 0x41, 0x73, 0x70, 0x61, 0x72, 0x75, 0x6b, 0x68,
+  0x00, 0x4f, 0x6d, 0x75, 0x72, 0x74, 0x61, 0x67, 0x00, 0x4b, 0x61, 0x72,
+  0x64, 0x61, 0x6d, 0x00, 0x4b, 0x72, 0x75, 0x6d, 0x00, 0x42, 0x6f, 0x72,
+  0x69, 0x73, 0x00, 0x53, 0x69, 0x6d, 0x65, 0x6f, 0x6e, 0x00, 0x53, 0x61,
+  0x6d, 0x75, 0x69, 0x6c, 0x00, 0x50, 0x65, 0x74, 0x61, 0x72, 0x00, 0x41,
+  0x73, 0x73, 0x65, 0x6e, 0x00, 0x4b, 0x61, 0x6c, 0x6f, 0x79, 0x61, 0x6e,
+  0x00, 0x49, 0x76, 0x61, 0x6e, 0x2d, 0x41, 0x73, 0x73, 0x65, 0x6e, 0x00,
+  0x49, 0x76, 0x61, 0x79, 0x6c, 0x6f, 0x00, 0x49, 0x76, 0x61, 0x6e, 0x20,
+  0x53, 0x68, 0x69, 0x73, 0x68, 0x6d, 0x61, 0x6e, 0x00, 0x41, 0x6c, 0x65,
+  0x78, 0x61, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x49, 0x20, 0x42, 0x61, 0x74,
+  0x74, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x67, 0x00, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x03, 0x03, 0x01, 0x07, 0x07, 0x02, 0x34, 0x00, 0x94, 0x7f, 0xef, 0x03,
+  0x00, 0x4b, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x42, 0x75, 0x72, 0x67, 0x75, 0x6e,
+  0x64, 0x69, 0x61, 0x6e, 0x00, 0x42, 0x75, 0x72, 0x67, 0x75, 0x6e, 0x64,
+  0x69, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a,
+  0x42, 0x75, 0x72, 0x67, 0x75, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x73, 0x00,
+  0x62, 0x75, 0x72, 0x67, 0x75, 0x6e, 0x64, 0x79, 0x00, 0x2d, 0x00, 0x41,
+  0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x6c,
+  0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x65, 0x73,
+  0x74, 0x65, 0x72, 0x6e, 0x20, 0x52, 0x6f, 0x6d, 0x61, 0x6e, 0x20, 0x45,
+  0x6d, 0x70, 0x69, 0x72, 0x65, 0x2c, 0x20, 0x61, 0x20, 0x47, 0x65, 0x72,
+  0x6d, 0x61, 0x6e, 0x69, 0x63, 0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65,
+  0x20, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x42, 0x75, 0x72, 0x67, 0x75, 0x6e, 0x64, 0x69, 0x61, 0x6e,
+  0x73, 0x20, 0x73, 0x65, 0x74, 0x74, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x76,
+  0x61, 0x6c, 0x6c, 0x65, 0x79, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x61,
+  0x73, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x47, 0x61, 0x75, 0x6c, 0x2c, 0x20,
+  0x6c, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x69,
+  0x72, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x43, 0x65,
+  0x6e, 0x74, 0x75, 0x72, 0x69, 0x65, 0x73, 0x20, 0x6c, 0x61, 0x74, 0x65,
+  0x72, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x44, 0x75, 0x63, 0x68, 0x79,
+  0x20, 0x6f, 0x66, 0x20, 0x42, 0x75, 0x72, 0x67, 0x75, 0x6e, 0x64, 0x79,
+  0x20, 0x77, 0x61, 0x73, 0x20, 0x61, 0x20, 0x70, 0x72, 0x6f, 0x73, 0x70,
+  0x65, 0x72, 0x6f, 0x75, 0x73, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72,
+  0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+  0x6f, 0x75, 0x72, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x44, 0x69, 0x6a, 0x6f,
+  0x6e, 0x20, 0x6f, 0x75, 0x74, 0x73, 0x68, 0x69, 0x6e, 0x69, 0x6e, 0x67,
+  0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x50, 0x61, 0x72,
+  0x69, 0x73, 0x2e, 0x20, 0x54, 0x6f, 0x64, 0x61, 0x79, 0x2c, 0x20, 0x69,
+  0x74, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x46, 0x72, 0x61, 0x6e, 0x63, 0x65, 0x2e, 0x00, 0x0a,
+  0x52, 0x69, 0x63, 0x68, 0x61, 0x72, 0x64, 0x20, 0x6c, 0x65, 0x20, 0x4a,
+  0x75, 0x73, 0x74, 0x69, 0x63, 0x69, 0x65, 0x72, 0x00, 0x48, 0x65, 0x6e,
+  0x72, 0x69, 0x20, 0x6c, 0x65, 0x20, 0x47, 0x72, 0x61, 0x6e, 0x64, 0x00,
+  0x48, 0x75, 0x67, 0x75, 0x65, 0x73, 0x20, 0x49, 0x49, 0x49, 0x00, 0x45,
+  0x75, 0x64, 0x65, 0x73, 0x20, 0x49, 0x56, 0x00, 0x50, 0x68, 0x69, 0x6c,
+  0x69, 0x70, 0x70, 0x65, 0x20, 0x6c, 0x65, 0x20, 0x48, 0x61, 0x72, 0x64,
+  0x69, 0x00, 0x4a, 0x65, 0x61, 0x6e, 0x72, 0x20, 0x54, 0x68, 0x61, 0x6e,
+  0x69, 0x00, 0x54, 0x61, 0x6a, 0x20, 0x75, 0x6c, 0x2d, 0x41, 0x6c, 0x61,
+  0x6d, 0x00, 0x5a, 0x61, 0x69, 0x6e, 0x61, 0x74, 0x75, 0x64, 0x64, 0x69,
+  0x6e, 0x00, 0x54, 0x75, 0x61, 0x6e, 0x6b, 0x75, 0x20, 0x49, 0x62, 0x72,
+  0x61, 0x68, 0x69, 0x6d, 0x00, 0x4d, 0x75, 0x68, 0x61, 0x6d, 0x6d, 0x61,
+  0x64, 0x20, 0x44, 0x61, 0x75, 0x64, 0x20, 0x53, 0x79, 0x61, 0x68, 0x00,
+  0x43, 0x75, 0x74, 0x20, 0x4e, 0x79, 0x61, 0x6b, 0x20, 0x4d, 0x65, 0x75,
+  0x74, 0x69, 0x61, 0x00, 0x48, 0x61, 0x73, 0x61, 0x6e, 0x20, 0x64, 0x69,
+  0x20, 0x54, 0x69, 0x72, 0x6f, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x06, 0x02, 0x07, 0x02, 0x5e,
+  0x00, 0x94, 0xff, 0xef, 0x03, 0x00, 0x05, 0x66, 0x72, 0x65, 0x65, 0x63,
+  0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x41,
+  0x63, 0x72, 0x65, 0x61, 0x6e, 0x00, 0x41, 0x63, 0x72, 0x65, 0x61, 0x6e,
+  0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x41, 0x63, 0x72,
+  0x65, 0x61, 0x6e, 0x73, 0x00, 0x61, 0x63, 0x72, 0x65, 0x00, 0x2d, 0x00,
+  0x41, 0x63, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x77, 0x65, 0x73, 0x74, 0x65, 0x72, 0x6e, 0x6d, 0x6f, 0x73, 0x74, 0x20,
+  0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x42, 0x72, 0x61,
+  0x7a, 0x69, 0x6c, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x65, 0x67,
+  0x69, 0x6f, 0x6e, 0x20, 0x77, 0x61, 0x73, 0x20, 0x70, 0x61, 0x72, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x42, 0x6f, 0x6c, 0x69, 0x76, 0x69, 0x61, 0x20,
+  0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x31, 0x38, 0x39, 0x39, 0x2c, 0x20,
+  0x77, 0x68, 0x65, 0x6e, 0x20, 0x42, 0x72, 0x61, 0x7a, 0x69, 0x6c, 0x69,
+  0x61, 0x6e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x6c, 0x65, 0x72, 0x73, 0x20,
+  0x72, 0x65, 0x76, 0x6f, 0x6c, 0x74, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 0x65, 0x64, 0x20, 0x61, 0x6e,
+  0x20, 0x49, 0x6e, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74,
+  0x20, 0x53, 0x74, 0x61, 0x74, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x41, 0x63,
+  0x72, 0x65, 0x2e, 0x20, 0x42, 0x6f, 0x6c, 0x69, 0x76, 0x69, 0x61, 0x20,
+  0x67, 0x61, 0x76, 0x65, 0x20, 0x75, 0x70, 0x20, 0x69, 0x74, 0x73, 0x20,
+  0x63, 0x6c, 0x61, 0x69, 0x6d, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x74, 0x65, 0x72, 0x72, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x54, 0x72, 0x65, 0x61, 0x74,
+  0x79, 0x20, 0x6f, 0x66, 0x20, 0x50, 0x65, 0x74, 0x72, 0x6f, 0x70, 0x6f,
+  0x6c, 0x69, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x31, 0x39, 0x30, 0x33, 0x2c,
+  0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68,
+  0x20, 0x41, 0x63, 0x72, 0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x61, 0x6e,
+  0x6e, 0x65, 0x78, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x42, 0x72, 0x61,
+  0x7a, 0x69, 0x6c, 0x2e, 0x20, 0x41, 0x63, 0x72, 0x65, 0x20, 0x69, 0x73,
+  0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x77, 0x6f, 0x72, 0x6c, 0x64, 0x27, 0x73, 0x20, 0x6d, 0x6f, 0x73, 0x74,
+  0x20, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x72,
+  0x75, 0x62, 0x62, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63,
+  0x69, 0x6e, 0x67, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e, 0x73, 0x2e,
+  0x00, 0x02, 0x08, 0x4c, 0x75, 0x69, 0x73, 0x20, 0x47, 0xc3, 0xa1, 0x6c,
+  0x76, 0x65, 0x7a, 0x20, 0x52, 0x6f, 0x64, 0x72, 0xc3, 0xad, 0x67, 0x75,
+  0x65, 0x7a, 0x20, 0x64, 0x65, 0x20, 0x41, 0x72, 0x69, 0x61, 0x73, 0x00,
+  0x41, 0x6e, 0x74, 0xc3, 0xb4, 0x6e, 0x69, 0x6f, 0x20, 0x64, 0x65, 0x20,
+  0x53, 0x6f, 0x75, 0x73, 0x61, 0x20, 0x42, 0x72, 0x61, 0x67, 0x61, 0x00,
+  0x4a, 0x6f, 0x73, 0xc3, 0xa9, 0x20, 0x50, 0x61, 0x72, 0x61, 0x6e, 0x68,
+  0x6f, 0x73, 0x20, 0x64, 0x6f, 0x20, 0x52, 0x69, 0x6f, 0x20, 0x42, 0x72,
+  0x61, 0x6e, 0x63, 0x6f, 0x00, 0x4a, 0x6f, 0x73, 0xc3, 0xa9, 0x20, 0x50,
+  0x6c, 0xc3, 0xa1, 0x63, 0x69, 0x64, 0x6f, 0x20, 0x64, 0x65, 0x20, 0x43,
+  0x61, 0x73, 0x74, 0x72, 0x6f, 0x00, 0x4f, 0x73, 0x63, 0x61, 0x72, 0x20,
+  0x50, 0x61, 0x73, 0x73, 0x6f, 0x73, 0x00, 0x46, 0x72, 0x61, 0x6e, 0x63,
+  0x69, 0x73, 0x63, 0x6f, 0x20, 0x57, 0x61, 0x6e, 0x64, 0x65, 0x72, 0x6c,
+  0x65, 0x79, 0x20, 0x44, 0x61, 0x6e, 0x74, 0x61, 0x73, 0x00, 0x43, 0x68,
+  0x69, 0x63, 0x6f, 0x20, 0x4d, 0x65, 0x6e, 0x64, 0x65, 0x73, 0x00, 0x49,
+  0x6f, 0x6c, 0x61, 0x6e, 0x64, 0x61, 0x20, 0x46, 0x6c, 0x65, 0x6d, 0x69,
+  0x6e, 0x67, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x01, 0x05, 0x07, 0x01, 0xf1, 0x00, 0x94, 0xff, 0xef, 0x03, 0x00,
+  0x06, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x73, 0x00, 0x41, 0x66, 0x67, 0x68, 0x61, 0x6e, 0x69,
+  0x00, 0x41, 0x66, 0x67, 0x68, 0x61, 0x6e, 0x69, 0x00, 0x3f, 0x70, 0x6c,
+  0x75, 0x72, 0x61, 0x6c, 0x3a, 0x41, 0x66, 0x67, 0x68, 0x61, 0x6e, 0x69,
+  0x73, 0x00, 0x61, 0x66, 0x67, 0x68, 0x61, 0x6e, 0x69, 0x73, 0x74, 0x61,
+  0x6e, 0x00, 0x2d, 0x00, 0x41, 0x66, 0x67, 0x68, 0x61, 0x6e, 0x69, 0x73,
+  0x74, 0x61, 0x6e, 0x2c, 0x20, 0x6f, 0x66, 0x74, 0x65, 0x6e, 0x20, 0x63,
+  0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x72,
+  0x6f, 0x73, 0x73, 0x72, 0x6f, 0x61, 0x64, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x43, 0x65, 0x6e, 0x74, 0x72, 0x61, 0x6c, 0x20, 0x41, 0x73, 0x69, 0x61,
+  0x2c, 0x20, 0x68, 0x61, 0x73, 0x20, 0x68, 0x61, 0x64, 0x20, 0x61, 0x20,
+  0x76, 0x65, 0x72, 0x79, 0x20, 0x74, 0x75, 0x72, 0x62, 0x75, 0x6c, 0x65,
+  0x6e, 0x74, 0x20, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x2e, 0x20,
+  0x54, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x61, 0x67, 0x65, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65,
+  0x65, 0x6e, 0x20, 0x6f, 0x63, 0x63, 0x75, 0x70, 0x69, 0x65, 0x64, 0x20,
+  0x62, 0x79, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 0x66, 0x6f, 0x72, 0x63,
+  0x65, 0x73, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x65, 0x72, 0x73, 0x69, 0x61, 0x6e,
+  0x20, 0x45, 0x6d, 0x70, 0x69, 0x72, 0x65, 0x2c, 0x20, 0x47, 0x65, 0x6e,
+  0x67, 0x68, 0x69, 0x73, 0x20, 0x4b, 0x68, 0x61, 0x6e, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x41, 0x6c, 0x65, 0x78, 0x61, 0x6e, 0x64, 0x65, 0x72, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x47, 0x72, 0x65, 0x61, 0x74, 0x2e, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x41, 0x66, 0x67, 0x68, 0x61, 0x6e, 0x69, 0x73, 0x74,
+  0x61, 0x6e, 0x20, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x73, 0x74,
+  0x61, 0x74, 0x65, 0x20, 0x61, 0x73, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73,
+  0x20, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x74, 0x6f, 0x64, 0x61, 0x79,
+  0x20, 0x63, 0x61, 0x6d, 0x65, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x65,
+  0x78, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x20,
+  0x31, 0x37, 0x34, 0x36, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x41, 0x68,
+  0x6d, 0x61, 0x64, 0x20, 0x53, 0x68, 0x61, 0x68, 0x20, 0x66, 0x6f, 0x75,
+  0x6e, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x44, 0x75, 0x72,
+  0x72, 0x61, 0x6e, 0x69, 0x20, 0x45, 0x6d, 0x70, 0x69, 0x72, 0x65, 0x2e,
+  0x00, 0x01, 0x05, 0x4b, 0x61, 0x6e, 0x69, 0x73, 0x68, 0x6b, 0x61, 0x00,
+  0x4d, 0x61, 0x68, 0x6d, 0x75, 0x64, 0x20, 0x47, 0x68, 0x61, 0x7a, 0x6e,
+  0x61, 0x77, 0x69, 0x00, 0x41, 0x68, 0x6d, 0x61, 0x64, 0x20, 0x53, 0x68,
+  0x61, 0x68, 0x20, 0x44, 0x75, 0x72, 0x72, 0x61, 0x6e, 0x69, 0x00, 0x5a,
+  0x61, 0x68, 0x69, 0x72, 0x20, 0x53, 0x68, 0x61, 0x68, 0x00, 0x44, 0x61,
+  0x6f, 0x75, 0x64, 0x20, 0x4b, 0x68, 0x61, 0x6e, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x03, 0x06, 0x07, 0x01, 0x50, 0x00,
+  0x94, 0xff, 0xef, 0x03, 0x00, 0x07, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69,
+  0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x41, 0x66,
+  0x72, 0x69, 0x63, 0x61, 0x6e, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61,
+  0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x41, 0x66,
+  0x72, 0x69, 0x63, 0x61, 0x6e, 0x73, 0x00, 0x61, 0x66, 0x72, 0x69, 0x63,
+  0x61, 0x00, 0x2d, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x3a, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x63, 0x72, 0x61, 0x64, 0x6c, 0x65, 0x20, 0x6f,
+  0x66, 0x20, 0x68, 0x75, 0x6d, 0x61, 0x6e, 0x69, 0x74, 0x79, 0x2e, 0x20,
+  0x49, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x6f,
+  0x72, 0x6c, 0x64, 0x27, 0x73, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64,
+  0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x73, 0x74, 0x20, 0x63, 0x6f, 0x6e,
+  0x74, 0x69, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61,
+  0x6c, 0x73, 0x6f, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x65, 0x63, 0x6f,
+  0x6e, 0x64, 0x20, 0x6d, 0x6f, 0x73, 0x74, 0x20, 0x70, 0x6f, 0x70, 0x75,
+  0x6c, 0x6f, 0x75, 0x73, 0x2e, 0x00, 0x02, 0x09, 0x45, 0x64, 0x77, 0x61,
+  0x72, 0x64, 0x20, 0x57, 0x69, 0x6c, 0x6d, 0x6f, 0x74, 0x20, 0x42, 0x6c,
+  0x79, 0x64, 0x65, 0x6e, 0x00, 0x57, 0x2e, 0x20, 0x45, 0x2e, 0x20, 0x42,
+  0x2e, 0x20, 0x44, 0x75, 0x20, 0x42, 0x6f, 0x69, 0x73, 0x00, 0x48, 0x61,
+  0x69, 0x6c, 0x65, 0x20, 0x53, 0x65, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x65,
+  0x00, 0x50, 0x61, 0x74, 0x72, 0x69, 0x63, 0x65, 0x20, 0x4c, 0x75, 0x6d,
+  0x75, 0x6d, 0x62, 0x61, 0x00, 0x4b, 0x77, 0x61, 0x6d, 0x65, 0x20, 0x4e,
+  0x6b, 0x72, 0x75, 0x6d, 0x61, 0x68, 0x00, 0x4a, 0x6f, 0x6d, 0x6f, 0x20,
+  0x4b, 0x65, 0x6e, 0x79, 0x61, 0x74, 0x74, 0x61, 0x00, 0x41, 0x6d, 0xc3,
+  0xad, 0x6c, 0x63, 0x61, 0x72, 0x20, 0x43, 0x61, 0x62, 0x72, 0x61, 0x6c,
+  0x00, 0x4a, 0x75, 0x6c, 0x69, 0x75, 0x73, 0x20, 0x4e, 0x79, 0x65, 0x72,
+  0x65, 0x72, 0x65, 0x00, 0x4e, 0x65, 0x6c, 0x73, 0x6f, 0x6e, 0x20, 0x4d,
+  0x61, 0x6e, 0x64, 0x65, 0x6c, 0x61, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x07, 0x00, 0xf4, 0x00,
+  0x94, 0xff, 0xef, 0x03, 0x00, 0x08, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69,
+  0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x41, 0x69,
+  0x6e, 0x75, 0x00, 0x41, 0x69, 0x6e, 0x75, 0x00, 0x3f, 0x70, 0x6c, 0x75,
+  0x72, 0x61, 0x6c, 0x3a, 0x41, 0x69, 0x6e, 0x75, 0x00, 0x61, 0x69, 0x6e,
+  0x75, 0x00, 0x2d, 0x00, 0x54, 0x68, 0x65, 0x20, 0x41, 0x69, 0x6e, 0x75,
+  0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64,
+  0x69, 0x67, 0x65, 0x6e, 0x6f, 0x75, 0x73, 0x20, 0x70, 0x65, 0x6f, 0x70,
+  0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x6f, 0x72, 0x74, 0x68, 0x65,
+  0x72, 0x6e, 0x20, 0x4a, 0x61, 0x70, 0x61, 0x6e, 0x2c, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x4b, 0x75, 0x72, 0x69, 0x6c, 0x20, 0x69, 0x73, 0x6c, 0x61,
+  0x6e, 0x64, 0x73, 0x2c, 0x20, 0x53, 0x61, 0x6b, 0x68, 0x61, 0x6c, 0x69,
+  0x6e, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+  0x6f, 0x75, 0x74, 0x68, 0x65, 0x72, 0x6e, 0x20, 0x70, 0x61, 0x72, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4b, 0x61, 0x6d, 0x63,
+  0x68, 0x61, 0x74, 0x6b, 0x61, 0x20, 0x70, 0x65, 0x6e, 0x69, 0x6e, 0x73,
+  0x75, 0x6c, 0x61, 0x2e, 0x00, 0x03, 0x04, 0x4b, 0x61, 0x79, 0x61, 0x6e,
+  0x6f, 0x20, 0x53, 0x68, 0x69, 0x67, 0x65, 0x72, 0x75, 0x00, 0x4b, 0x6f,
+  0x73, 0x61, 0x6d, 0x61, 0x79, 0x6e, 0x75, 0x00, 0x53, 0x61, 0x6d, 0x6b,
+  0x75, 0x73, 0x61, 0x79, 0x6e, 0x75, 0x00, 0x54, 0x73, 0x75, 0x6b, 0x69,
+  0x6e, 0x6f, 0x65, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06,
+  0x07, 0x02, 0x4c, 0x00, 0x94, 0xff, 0xef, 0x03, 0x00, 0x09, 0x66, 0x72,
+  0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x00, 0x41, 0x6b, 0x77, 0x65, 0x00, 0x41, 0x6b, 0x77, 0x65, 0x00,
+  0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x41, 0x6b, 0x77, 0x65,
+  0x00, 0x61, 0x6b, 0x77, 0x65, 0x00, 0x2d, 0x00, 0x54, 0x68, 0x65, 0x20,
+  0x41, 0x6b, 0x77, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6c, 0x73,
+  0x6f, 0x20, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x62, 0x79, 0x20, 0x74,
+  0x68, 0x72, 0x65, 0x65, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65,
+  0x6e, 0x74, 0x20, 0x74, 0x72, 0x69, 0x62, 0x61, 0x6c, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x50, 0x6f, 0x72, 0x74, 0x75,
+  0x67, 0x75, 0x65, 0x73, 0x65, 0x2c, 0x20, 0x58, 0x61, 0x76, 0x61, 0x6e,
+  0x74, 0x65, 0x2c, 0x20, 0x58, 0x61, 0x6b, 0x72, 0x69, 0x61, 0x62, 0x61,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x58, 0x65, 0x72, 0x65, 0x6e, 0x74, 0x65,
+  0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20,
+  0x61, 0x20, 0x70, 0x61, 0x74, 0x72, 0x69, 0x6c, 0x69, 0x6e, 0x65, 0x61,
+  0x6c, 0x20, 0x63, 0x6c, 0x61, 0x6e, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65,
+  0x6d, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6c, 0x69, 0x76, 0x65, 0x20, 0x69,
+  0x6c, 0x65, 0x72, 0x73, 0x2c, 0x20, 0x4d, 0x69, 0x67, 0x72, 0x61, 0x6e,
+  0x74, 0x73, 0x2c, 0x20, 0x57, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x73, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x45, 0x6e, 0x67, 0x69, 0x6e, 0x65, 0x65, 0x72,
+  0x73, 0x20, 0x74, 0x6f, 0x20, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65,
+  0x20, 0x72, 0x61, 0x69, 0x6c, 0x72, 0x6f, 0x61, 0x64, 0x73, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x6d, 0x61, 0x67, 0x6c, 0x65, 0x76, 0x2e, 0x03,
+  0x00, 0x61, 0x2e, 0x73, 0x75, 0x70, 0x65, 0x72, 0x63, 0x6f, 0x6e, 0x64,
+  0x75, 0x63, 0x74, 0x6f, 0x72, 0x73, 0x00, 0x00, 0x3c, 0x00, 0x90, 0x89,
+  0x1f, 0x4e, 0x01, 0x00, 0x00, 0x00, 0x12, 0x07, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x29, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x71, 0x48,
+  0x00, 0x00, 0x00, 0x1d, 0x54, 0x61, 0x63, 0x74, 0x69, 0x63, 0x73, 0x00,
+  0x54, 0x61, 0x63, 0x74, 0x69, 0x63, 0x73, 0x00, 0x00, 0x61, 0x2e, 0x74,
+  0x61, 0x63, 0x74, 0x69, 0x63, 0x73, 0x00, 0x00, 0xc7, 0x00, 0x90, 0x89,
+  0x1f, 0x4f, 0x01, 0x00, 0x00, 0x00, 0x16, 0x07, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x24, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x40,
+  0x00, 0x00, 0x00, 0x28, 0x54, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x72, 0x70,
+  0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x54, 0x68, 0x65, 0x20,
+  0x43, 0x6f, 0x72, 0x70, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00,
+  0x48, 0x61, 0x6c, 0x76, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+  0x6f, 0x72, 0x72, 0x75, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x72, 0x65, 0x6c, 0x61, 0x74,
+  0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e,
+  0x63, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x28, 0x6f, 0x72, 0x20,
+  0x65, 0x6c, 0x69, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x73, 0x20, 0x69,
+  0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x46, 0x65, 0x64, 0x65, 0x72, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e, 0x6d,
+  0x65, 0x6e, 0x74, 0x73, 0x29, 0x2e, 0x03, 0x00, 0x61, 0x2e, 0x74, 0x68,
+  0x65, 0x5f, 0x63, 0x6f, 0x72, 0x70, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x00, 0x00, 0x4b, 0x00, 0x90, 0x89, 0x1f, 0x50, 0x01, 0x00, 0x00,
+  0x00, 0x0d, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x07,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x13, 0x88, 0x00, 0x00, 0x00, 0x05, 0x54,
+  0x68, 0x65, 0x20, 0x52, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x00,
+  0x54, 0x68, 0x65, 0x20, 0x52, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63,
+  0x00, 0x00, 0x61, 0x2e, 0x74, 0x68, 0x65, 0x5f, 0x72, 0x65, 0x70, 0x75,
+  0x62, 0x6c, 0x69, 0x63, 0x00, 0x00, 0x39, 0x00, 0x90, 0x8d, 0x17, 0x51,
+  0x01, 0x01, 0x00, 0x00, 0x00, 0x23, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x07, 0xd0, 0x00, 0x00, 0x00, 0x02, 0x54, 0x68, 0x65, 0x20, 0x57, 0x68,
+  0x65, 0x65, 0x6c, 0x00, 0x54, 0x68, 0x65, 0x20, 0x57, 0x68, 0x65, 0x65,
+  0x6c, 0x00, 0x61, 0x2e, 0x74, 0x68, 0x65, 0x5f, 0x77, 0x68, 0x65, 0x65,
+  0x6c, 0x00, 0x00, 0x63, 0x00, 0x90, 0x8d, 0x1f, 0x52, 0x02, 0x01, 0x00,
+  0x00, 0x00, 0x3b, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x36,
+  0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x36, 0xb0, 0x00, 0x00, 0x00, 0x0e,
+  0x54, 0x68, 0x65, 0x6f, 0x6c, 0x6f, 0x67, 0x79, 0x00, 0x54, 0x68, 0x65,
+  0x6f, 0x6c, 0x6f, 0x67, 0x79, 0x00, 0x49, 0x6d, 0x70, 0x72, 0x6f, 0x76,
+  0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x43, 0x61, 0x74, 0x68, 0x65, 0x64, 0x72,
+  0x61, 0x6c, 0x73, 0x2e, 0x03, 0x00, 0x61, 0x2e, 0x74, 0x68, 0x65, 0x6f,
+  0x6c, 0x6f, 0x67, 0x79, 0x00, 0x00, 0x5a, 0x00, 0x90, 0x89, 0x1f, 0x53,
+  0x01, 0x00, 0x00, 0x00, 0x3c, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x55, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4a, 0x38, 0x00, 0x00,
+  0x00, 0x13, 0x54, 0x68, 0x65, 0x6f, 0x72, 0x79, 0x20, 0x6f, 0x66, 0x20,
+  0x47, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79, 0x00, 0x54, 0x68, 0x65, 0x6f,
+  0x72, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x47, 0x72, 0x61, 0x76, 0x69, 0x74,
+  0x79, 0x00, 0x00, 0x61, 0x2e, 0x74, 0x68, 0x65, 0x6f, 0x72, 0x79, 0x5f,
+  0x6f, 0x66, 0x5f, 0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79, 0x00, 0x00,
+  0x7b, 0x00, 0x90, 0x89, 0x1f, 0x54, 0x01, 0x00, 0x00, 0x00, 0x14, 0x07,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3f, 0x07, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x0f, 0xa0, 0x00, 0x00, 0x00, 0x04, 0x54, 0x72, 0x61, 0x64,
+  0x65, 0x00, 0x54, 0x72, 0x61, 0x64, 0x65, 0x00, 0x48, 0x61, 0x6c, 0x76,
+  0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x61, 0x73, 0x74, 0x65,
+  0x20, 0x6f, 0x66, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x20, 0x74,
+  0x6f, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x61, 0x70, 0x69,
+  0x74, 0x61, 0x6c, 0x2e, 0x03, 0x00, 0x61, 0x2e, 0x74, 0x72, 0x61, 0x64,
+  0x65, 0x00, 0x00, 0x45, 0x00, 0x90, 0x89, 0x1f, 0x55, 0x01, 0x00, 0x00,
+  0x00, 0x30, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x07,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x10, 0x00, 0x00, 0x00, 0x0a, 0x55,
+  0x6e, 0x69, 0x76, 0x65, 0x72, 0x73, 0x69, 0x74, 0x79, 0x00, 0x55, 0x6e,
+  0x69, 0x76, 0x65, 0x72, 0x73, 0x69, 0x74, 0x79, 0x00, 0x00, 0x61, 0x2e,
+  0x75, 0x6e, 0x69, 0x76, 0x65, 0x72, 0x73, 0x69, 0x74, 0x79, 0x00, 0x00,
+  0x39, 0x00, 0x90, 0x8d, 0x17, 0x56, 0x00, 0x00, 0x00, 0x03, 0xe8, 0x00,
+  0x00, 0x00, 0x01, 0x57, 0x61, 0x72, 0x72, 0x69, 0x6f, 0x72, 0x20, 0x43,
+  0x6f, 0x64, 0x65, 0x00, 0x57, 0x61, 0x72, 0x72, 0x69, 0x6f, 0x72, 0x20,
+  0x43, 0x6f, 0x64, 0x65, 0x00, 0x61, 0x2e, 0x77, 0x61, 0x72, 0x72, 0x69,
+  0x6f, 0x72, 0x5f, 0x63, 0x6f, 0x64, 0x65, 0x00, 0x00, 0x33, 0x00, 0x90,
+  0x8d, 0x17, 0x57, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0x02, 0x57, 0x72, 0x69,
+  0x74, 0x69, 0x6e, 0x67, 0x00, 0x57, 0x72, 0x69, 0x74, 0x69, 0x6e, 0x67,
+  0x00, 0x61, 0x2e, 0x77, 0x72, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x00, 0x04,
+  0x91, 0x00, 0x91, 0xf8, 0x41, 0x6e, 0x61, 0x72, 0x63, 0x68, 0x79, 0x00,
+  0x41, 0x6e, 0x61, 0x72, 0x63, 0x68, 0x79, 0x00, 0x67, 0x6f, 0x76, 0x2e,
+  0x61, 0x6e, 0x61, 0x72, 0x63, 0x68, 0x79, 0x00, 0x2d, 0x00, 0x41, 0x6e,
+  0x61, 0x72, 0x63, 0x68, 0x79, 0x20, 0x69, 0x73, 0x20, 0x73, 0x69, 0x6d,
+  0x70, 0x6c, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x62, 0x73, 0x65,
+  0x6e, 0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x72,
+  0x65, 0x63, 0x6f, 0x67, 0x6e, 0x69, 0x7a, 0x61, 0x62, 0x6c, 0x65, 0x20,
+  0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x20,
+  0x43, 0x69, 0x74, 0x69, 0x7a, 0x65, 0x6e, 0x73, 0x20, 0x61, 0x72, 0x65,
+  0x20, 0x64, 0x69, 0x73, 0x6f, 0x72, 0x67, 0x61, 0x6e, 0x69, 0x7a, 0x65,
+  0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x75, 0x6e, 0x70, 0x72, 0x6f, 0x64,
+  0x75, 0x63, 0x74, 0x69, 0x76, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x77, 0x69, 0x6c, 0x6c, 0x20, 0x73, 0x70, 0x65, 0x6e, 0x64, 0x20, 0x61,
+  0x6c, 0x6c, 0x20, 0x69, 0x6e, 0x63, 0x6f, 0x6d, 0x65, 0x20, 0x61, 0x73,
+  0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x6c, 0x79, 0x20, 0x61, 0x73, 0x20,
+  0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x2c, 0x20, 0x72, 0x61,
+  0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x70, 0x61,
+  0x79, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x61, 0x78, 0x65, 0x73, 0x20, 0x6f,
+  0x72, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6e, 0x67,
+  0x20, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x2e, 0x03, 0x2a,
+  0x20, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x74, 0x65, 0x63, 0x68, 0x6e, 0x6f, 0x6c, 0x6f, 0x67,
+  0x69, 0x65, 0x73, 0x20, 0x64, 0x6f, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x72,
+  0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x75,
+  0x70, 0x6b, 0x65, 0x65, 0x70, 0x2e, 0x0a, 0x2a, 0x20, 0x45, 0x61, 0x63,
+  0x68, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x64, 0x20, 0x74, 0x69, 0x6c,
+  0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x67, 0x69, 0x76, 0x65, 0x73,
+  0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x32,
+  0x20, 0x46, 0x6f, 0x6f, 0x64, 0x2c, 0x20, 0x53, 0x68, 0x69, 0x65, 0x6c,
+  0x64, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x54, 0x72, 0x61, 0x64, 0x65, 0x20,
+  0x77, 0x69, 0x6c, 0x6c, 0x20, 0x73, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20,
+  0x61, 0x20, 0x2d, 0x31, 0x20, 0x70, 0x65, 0x6e, 0x61, 0x6c, 0x74, 0x79,
+  0x2c, 0x20, 0x75, 0x6e, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x63, 0x69, 0x74, 0x79, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x69, 0x6e,
+  0x67, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x63, 0x65, 0x6c, 0x65,
+  0x62, 0x72, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x28, 0x43, 0x69,
+  0x74, 0x69, 0x65, 0x73, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x20, 0x73,
+  0x69, 0x7a, 0x65, 0x20, 0x33, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x6e,
+  0x6f, 0x74, 0x20, 0x63, 0x65, 0x6c, 0x65, 0x62, 0x72, 0x61, 0x74, 0x65,
+  0x2e, 0x29, 0x0a, 0x2a, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x63, 0x69,
+  0x74, 0x79, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f,
+  0x72, 0x74, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x32, 0x20, 0x75,
+  0x6e, 0x69, 0x74, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x66, 0x72, 0x65,
+  0x65, 0x3b, 0x20, 0x66, 0x75, 0x72, 0x74, 0x68, 0x65, 0x72, 0x20, 0x75,
+  0x6e, 0x69, 0x74, 0x73, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x6f,
+  0x73, 0x74, 0x20, 0x31, 0x20, 0x73, 0x68, 0x69, 0x65, 0x6c, 0x64, 0x20,
+  0x70, 0x65, 0x72, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x2e, 0x0a, 0x2a, 0x20,
+  0x4d, 0x69, 0x6c, 0x69, 0x74, 0x61, 0x72, 0x79, 0x20, 0x75, 0x6e, 0x69,
+  0x74, 0x73, 0x20, 0x64, 0x6f, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x63, 0x61,
+  0x75, 0x73, 0x65, 0x20, 0x75, 0x6e, 0x68, 0x61, 0x70, 0x70, 0x69, 0x6e,
+  0x65, 0x73, 0x73, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x20, 0x77, 0x68, 0x65,
+  0x6e, 0x20, 0x64, 0x65, 0x70, 0x6c, 0x6f, 0x79, 0x65, 0x64, 0x20, 0x61,
+  0x67, 0x67, 0x72, 0x65, 0x73, 0x73, 0x69, 0x76, 0x65, 0x6c, 0x79, 0x2e,
+  0x0a, 0x2a, 0x20, 0x4d, 0x69, 0x6c, 0x69, 0x74, 0x61, 0x72, 0x79, 0x20,
+  0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x69, 0x6d, 0x70, 0x6f, 0x73, 0x65,
+  0x20, 0x6d, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6c, 0x20, 0x6c, 0x61, 0x77,
+  0x2e, 0x20, 0x55, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x33, 0x20, 0x6d, 0x69,
+  0x6c, 0x69, 0x74, 0x61, 0x72, 0x79, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73,
+  0x20, 0x69, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x20, 0x61, 0x20, 0x63, 0x69,
+  0x74, 0x79, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x65, 0x61, 0x63, 0x68,
+  0x20, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x20, 0x31, 0x20, 0x75, 0x6e, 0x68,
+  0x61, 0x70, 0x70, 0x79, 0x20, 0x63, 0x69, 0x74, 0x69, 0x7a, 0x65, 0x6e,
+  0x20, 0x74, 0x6f, 0x20, 0x62, 0x65, 0x63, 0x6f, 0x6d, 0x65, 0x20, 0x63,
+  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2e, 0x0a, 0x2a, 0x20, 0x59, 0x6f,
+  0x75, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x6e, 0x6f, 0x20, 0x63, 0x6f,
+  0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74,
+  0x61, 0x78, 0x20, 0x72, 0x61, 0x74, 0x65, 0x73, 0x2e, 0x20, 0x41, 0x6c,
+  0x6c, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x69, 0x6e, 0x63, 0x6f,
+  0x6d, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x75, 0x78, 0x75, 0x72,
+  0x69, 0x65, 0x73, 0x2e, 0x0a, 0x2a, 0x20, 0x48, 0x61, 0x6c, 0x66, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x75, 0x78, 0x75, 0x72,
+  0x69, 0x65, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69,
+  0x6e, 0x67, 0x20, 0x74, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x63, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20,
+  0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20,
+  0x69, 0x6e, 0x63, 0x6f, 0x6d, 0x65, 0x2c, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x77, 0x61, 0x73, 0x74, 0x65, 0x64, 0x2e, 0x0a, 0x2a, 0x20, 0x43, 0x6f,
+  0x6e, 0x76, 0x65, 0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x63,
+  0x6f, 0x72, 0x72, 0x75, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e,
+  0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74,
+  0x61, 0x6c, 0x20, 0x28, 0x68, 0x61, 0x6c, 0x66, 0x20, 0x61, 0x73, 0x20,
+  0x66, 0x61, 0x73, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6b, 0x6e,
+  0x6f, 0x77, 0x6c, 0x65, 0x64, 0x67, 0x73, 0x00, 0x76, 0x69, 0x73, 0x69,
+  0x67, 0x6f, 0x74, 0x68, 0x00, 0x2d, 0x00, 0x54, 0x68, 0x65, 0x20, 0x54,
+  0x68, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x69, 0x20, 0x6f, 0x72, 0x20,
+  0x56, 0x69, 0x73, 0x69, 0x67, 0x6f, 0x74, 0x68, 0x73, 0x20, 0x77, 0x65,
+  0x72, 0x65, 0x20, 0x61, 0x6e, 0x20, 0x45, 0x61, 0x73, 0x74, 0x20, 0x47,
+  0x65, 0x72, 0x6d, 0x61, 0x6e, 0x69, 0x63, 0x20, 0x70, 0x65, 0x6f, 0x70,
+  0x6c, 0x65, 0x2c, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x74, 0x72, 0x69, 0x62, 0x65,
+  0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x6f, 0x74,
+  0x68, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 0x70, 0x72, 0x6f,
+  0x62, 0x61, 0x62, 0x6c, 0x79, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x53, 0x63,
+  0x61, 0x6e, 0x64, 0x69, 0x6e, 0x61, 0x76, 0x69, 0x61, 0x2e, 0x20, 0x49,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x33, 0x72, 0x64, 0x20, 0x63, 0x65,
+  0x6e, 0x74, 0x75, 0x72, 0x79, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x6d,
+  0x69, 0x67, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x73, 0x6f, 0x75, 0x74,
+  0x68, 0x2c, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x72, 0x6e,
+  0x20, 0x55, 0x6b, 0x72, 0x61, 0x69, 0x6e, 0x65, 0x2e, 0x20, 0x54, 0x68,
+  0x65, 0x79, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x63, 0x72, 0x6f, 0x73,
+  0x73, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x44, 0x61, 0x6e, 0x75,
+  0x62, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x61, 0x63, 0x6b, 0x65,
+  0x64, 0x20, 0x52, 0x6f, 0x6d, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x34, 0x31,
+  0x30, 0x20, 0x43, 0x45, 0x2e, 0x20, 0x52, 0x65, 0x63, 0x6f, 0x67, 0x6e,
+  0x69, 0x7a, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x52, 0x6f, 0x6d, 0x61, 0x6e, 0x73, 0x20, 0x61, 0x73, 0x20, 0x66, 0x6f,
+  0x65, 0x64, 0x65, 0x72, 0x61, 0x74, 0x69, 0x2c, 0x20, 0x74, 0x68, 0x65,
+  0x79, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x75, 0x61, 0x6c, 0x6c, 0x79,
+  0x20, 0x73, 0x65, 0x74, 0x74, 0x6c, 0x65, 0x64, 0x20, 0x61, 0x72, 0x6f,
+  0x75, 0x6e, 0x64, 0x20, 0x54, 0x6f, 0x75, 0x6c, 0x6f, 0x75, 0x73, 0x65,
+  0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 0x20, 0x61, 0x20, 0x6b, 0x69, 0x6e,
+  0x67, 0x64, 0x6f, 0x6d, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x56, 0x69,
+  0x73, 0x69, 0x67, 0x6f, 0x74, 0x68, 0x73, 0x20, 0x6d, 0x61, 0x6e, 0x61,
+  0x67, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x71, 0x75,
+  0x65, 0x72, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x49, 0x62, 0x65, 0x72, 0x69, 0x61, 0x6e, 0x20, 0x50, 0x65,
+  0x6e, 0x69, 0x6e, 0x73, 0x75, 0x6c, 0x61, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x6d, 0x6f, 0x76, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20,
+  0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x20, 0x54,
+  0x6f, 0x6c, 0x65, 0x64, 0x6f, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20,
+  0x6c, 0x6f, 0x73, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x68, 0x65,
+  0x69, 0x72, 0x20, 0x74, 0x65, 0x72, 0x72, 0x69, 0x74, 0x6f, 0x72, 0x69,
+  0x65, 0x73, 0x20, 0x6e, 0x6f, 0x72, 0x74, 0x68, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x50, 0x79, 0x72, 0x65, 0x6e, 0x65, 0x65, 0x73,
+  0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x72, 0x61, 0x6e,
+  0x6b, 0x73, 0x20, 0x62, 0x75, 0x74, 0x20, 0x56, 0x69, 0x73, 0x69, 0x67,
+  0x6f, 0x74, 0x68, 0x69, 0x63, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x72, 0x73,
+  0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x64, 0x20, 0x74,
+  0x6f, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52,
+  0x6f, 0x6d, 0x61, 0x6e, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x49, 0x62, 0x65,
+  0x72, 0x69, 0x61, 0x6e, 0x73, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x70, 0x65, 0x6e, 0x69, 0x6e, 0x73, 0x75, 0x6c,
+  0x61, 0x20, 0x77, 0x61, 0x73, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x75,
+  0x61, 0x6c, 0x6c, 0x79, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x72, 0x75, 0x6e,
+  0x20, 0x62, 0x79, 0x20, 0x4d, 0x75, 0x73, 0x6c, 0x69, 0x6d, 0x20, 0x69,
+  0x6e, 0x76, 0x61, 0x64, 0x65, 0x72, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x37,
+  0x31, 0x31, 0x2e, 0x00, 0x05, 0x0f, 0x41, 0xc3, 0xbe, 0x61, 0x6e, 0x61,
+  0x72, 0x65, 0x69, 0x6b, 0x73, 0x00, 0x46, 0x72, 0x69, 0xc3, 0xbe, 0x75,
+  0x67, 0x61, 0x69, 0x72, 0x6e, 0x73, 0x00, 0x41, 0x6c, 0x61, 0x72, 0x65,
+  0x69, 0x6b, 0x73, 0x20, 0x49, 0x00, 0x57, 0x61, 0x6c, 0x6c, 0x6a, 0x61,
+  0x00, 0x45, 0x75, 0x72, 0x65, 0x69, 0x6b, 0x73, 0x00, 0xc3, 0x9e, 0x69,
+  0x75, 0x64, 0x61, 0x72, 0x65, 0x69, 0x6b, 0x73, 0x20, 0x49, 0x49, 0x00,
+  0x41, 0x6c, 0x61, 0x72, 0x65, 0x69, 0x6b, 0x73, 0x20, 0x49, 0x49, 0x00,
+  0x41, 0x6d, 0x61, 0x6c, 0x61, 0x72, 0x65, 0x69, 0x6b, 0x73, 0x00, 0x43,
+  0x68, 0x72, 0x6f, 0x64, 0x65, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x69, 0x73,
+  0x00, 0x4c, 0x69, 0x75, 0x62, 0x61, 0x67, 0x69, 0x6c, 0x64, 0x73, 0x00,
+  0x57, 0x69, 0x74, 0x74, 0x65, 0x72, 0x65, 0x69, 0x6b, 0x73, 0x00, 0x53,
+  0x77, 0x69, 0x6e, 0xc3, 0xbe, 0x69, 0x6c, 0x61, 0x00, 0x48, 0x72, 0x65,
+  0x6b, 0x6b, 0x61, 0x72, 0x65, 0x64, 0x00, 0x48, 0x72, 0x6f, 0xc3, 0xbe,
+  0x61, 0x72, 0x65, 0x69, 0x6b, 0x73, 0x00, 0x45, 0x67, 0x69, 0x6c, 0x6f,
+  0x6e, 0x61, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x03, 0x00, 0x01, 0x07,
+  0x09, 0x02, 0x5e, 0x00, 0x94, 0xff, 0xef, 0x03, 0x02, 0x16, 0x66, 0x72,
+  0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x00, 0x56, 0x69, 0x73, 0x74, 0x75, 0x6c, 0x61, 0x6e, 0x00, 0x56,
+  0x69, 0x73, 0x74, 0x75, 0x6c, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75,
+  0x72, 0x61, 0x6c, 0x3a, 0x56, 0x69, 0x73, 0x74, 0x75, 0x6c, 0x61, 0x6e,
+  0x73, 0x00, 0x76, 0x69, 0x73, 0x74, 0x75, 0x6c, 0x61, 0x6e, 0x00, 0x2d,
+  0x00, 0x56, 0x69, 0x73, 0x74, 0x75, 0x6c, 0x61, 0x6e, 0x73, 0x20, 0x77,
+  0x65, 0x72, 0x65, 0x20, 0x61, 0x20, 0x57, 0x65, 0x73, 0x74, 0x20, 0x53,
+  0x6c, 0x61, 0x76, 0x69, 0x63, 0x20, 0x74, 0x72, 0x69, 0x62, 0x65, 0x20,
+  0x69, 0x6e, 0x68, 0x61, 0x62, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x77,
+  0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x6f, 0x64, 0x61, 0x79,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x65, 0x61, 0x20, 0x6f, 0x66,
+  0x20, 0x4c, 0x65, 0x73, 0x73, 0x65, 0x72, 0x20, 0x50, 0x6f, 0x6c, 0x61,
+  0x6e, 0x64, 0x2e, 0x20, 0x4c, 0x69, 0x74, 0x74, 0x6c, 0x65, 0x20, 0x69,
+  0x73, 0x20, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x61, 0x62, 0x6f, 0x75,
+  0x74, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x68, 0x69, 0x73, 0x74,
+  0x6f, 0x72, 0x79, 0x2e, 0x20, 0x4d, 0x61, 0x6e, 0x79, 0x20, 0x68, 0x69,
+  0x73, 0x74, 0x6f, 0x72, 0x69, 0x61, 0x6e, 0x73, 0x20, 0x61, 0x67, 0x72,
+  0x65, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x72, 0x6f,
+  0x75, 0x67, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
+  0x61, 0x72, 0x6c, 0x79, 0x20, 0x4d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x20,
+  0x41, 0x67, 0x65, 0x73, 0x20, 0x56, 0x69, 0x73, 0x74, 0x75, 0x6c, 0x61,
+  0x6e, 0x73, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x6f, 0x6e, 0x65, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6e,
+  0x67, 0x65, 0x73, 0x74, 0x20, 0x53, 0x6c, 0x61, 0x76, 0x69, 0x63, 0x20,
+  0x74, 0x72, 0x69, 0x62, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x6f,
+  0x64, 0x61, 0x79, 0x27, 0x73, 0x20, 0x50, 0x6f, 0x6c, 0x61, 0x6e, 0x64,
+  0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x6c, 0x69,
+  0x63, 0x74, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x47, 0x72, 0x65,
+  0x61, 0x74, 0x20, 0x4d, 0x6f, 0x72, 0x61, 0x76, 0x69, 0x61, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x4d, 0x61, 0x67, 0x79, 0x61, 0x72, 0x73, 0x20, 0x70,
+  0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65,
+  0x6d, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x69,
+  0x6e, 0x67, 0x20, 0x61, 0x20, 0x73, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20,
+  0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x20, 0x45, 0x76, 0x65, 0x6e, 0x74,
+  0x75, 0x61, 0x6c, 0x6c, 0x79, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c,
+  0x61, 0x6e, 0x64, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x56, 0x69, 0x73, 0x74,
+  0x75, 0x6c, 0x61, 0x6e, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x65,
+  0x76, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20,
+  0x53, 0x6c, 0x61, 0x76, 0x69, 0x63, 0x20, 0x74, 0x72, 0x69, 0x62, 0x65,
+  0x73, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x75, 0x6e, 0x69, 0x66, 0x69,
+  0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x50, 0x6f, 0x6c, 0x6f, 0x6e, 0x69,
+  0x61, 0x6e, 0x73, 0x2c, 0x20, 0x77, 0x68, 0x6f, 0x20, 0x66, 0x6f, 0x72,
+  0x6d, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+  0x74, 0x20, 0x50, 0x6f, 0x6c, 0x69, 0x73, 0x68, 0x20, 0x73, 0x74, 0x61,
+  0x74, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x30,
+  0x74, 0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x2e, 0x00,
+  0x05, 0x03, 0x4b, 0x72, 0x61, 0x6b, 0x00, 0x57, 0x61, 0x6e, 0x64, 0x61,
+  0x00, 0x44, 0x6f, 0x62, 0x72, 0x6f, 0x6d, 0x69, 0x72, 0x00, 0x01, 0x00,
+  0x01, 0x01, 0x01, 0x02, 0x07, 0x01, 0x09, 0x02, 0x51, 0x00, 0x94, 0xff,
+  0xef, 0x03, 0x02, 0x17, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d,
+  0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x56, 0x6f, 0x6c, 0x61,
+  0x70, 0xc3, 0xbc, 0x6b, 0x61, 0x6e, 0x00, 0x56, 0x6f, 0x6c, 0x61, 0x70,
+  0x75, 0x6b, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c,
+  0x3a, 0x56, 0x6f, 0x6c, 0x61, 0x70, 0xc3, 0xbc, 0x6b, 0x61, 0x6e, 0x73,
+  0x00, 0x76, 0x6f, 0x6c, 0x61, 0x70, 0x75, 0x6b, 0x00, 0x2d, 0x00, 0x56,
+  0x6f, 0x6c, 0x61, 0x70, 0xc3, 0xbc, 0x6b, 0x20, 0x69, 0x73, 0x20, 0x61,
+  0x6e, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x61, 0x6c, 0x20, 0x61, 0x75, 0x78, 0x69, 0x6c, 0x69, 0x61, 0x72,
+  0x79, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x63,
+  0x6f, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x65, 0x64, 0x20, 0x62,
+  0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x65, 0x72, 0x6d, 0x61, 0x6e,
+  0x20, 0x70, 0x72, 0x69, 0x65, 0x73, 0x74, 0x20, 0x4a, 0x6f, 0x68, 0x61,
+  0x6e, 0x6e, 0x20, 0x4d, 0x61, 0x72, 0x74, 0x69, 0x6e, 0x20, 0x53, 0x63,
+  0x68, 0x6c, 0x65, 0x79, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x38,
+  0x37, 0x39, 0x2e, 0x20, 0x49, 0x74, 0x20, 0x65, 0x6e, 0x6a, 0x6f, 0x79,
+  0x65, 0x64, 0x20, 0x61, 0x20, 0x62, 0x72, 0x69, 0x65, 0x66, 0x20, 0x70,
+  0x6f, 0x70, 0x75, 0x6c, 0x61, 0x72, 0x69, 0x74, 0x79, 0x20, 0x69, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x31, 0x39,
+  0x74, 0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x2e, 0x20,
+  0x54, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65,
+  0x20, 0x69, 0x73, 0x20, 0x6f, 0x66, 0x74, 0x65, 0x6e, 0x20, 0x63, 0x6f,
+  0x6e, 0x73, 0x69, 0x64, 0x65, 0x72, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x6e,
+  0x65, 0x63, 0x65, 0x73, 0x73, 0x61, 0x72, 0x69, 0x6c, 0x79, 0x20, 0x63,
+  0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x78, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20,
+  0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x61, 0x6c, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x74, 0x69, 0x76,
+  0x65, 0x73, 0x20, 0x6c, 0x69, 0x6b, 0x65, 0x20, 0x45, 0x73, 0x70, 0x65,
+  0x72, 0x61, 0x6e, 0x74, 0x6f, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68,
+  0x20, 0x68, 0x61, 0x64, 0x20, 0x61, 0x6c, 0x6d, 0x6f, 0x73, 0x74, 0x20,
+  0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x6c, 0x79, 0x20, 0x64,
+  0x69, 0x73, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x64, 0x20, 0x56, 0x6f, 0x6c,
+  0x61, 0x70, 0xc3, 0xbc, 0x6b, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x2e, 0x20, 0x54, 0x6f,
+  0x64, 0x61, 0x79, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x20, 0x66,
+  0x65, 0x77, 0x20, 0x64, 0x6f, 0x7a, 0x65, 0x6e, 0x20, 0x56, 0x6f, 0x6c,
+  0x61, 0x70, 0xc3, 0xbc, 0x6b, 0x20, 0x73, 0x70, 0x65, 0x61, 0x6b, 0x65,
+  0x72, 0x73, 0x20, 0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x2e, 0x00, 0x01,
+  0x06, 0x4a, 0x6f, 0x68, 0x61, 0x6e, 0x6e, 0x20, 0x4d, 0x61, 0x72, 0x74,
+  0x69, 0x6e, 0x20, 0x53, 0x63, 0x68, 0x6c, 0x65, 0x79, 0x65, 0x72, 0x00,
+  0x43, 0x68, 0x61, 0x72, 0x6c, 0x65, 0x73, 0x20, 0x45, 0x2e, 0x20, 0x53,
+  0x70, 0x72, 0x61, 0x67, 0x75, 0x65, 0x00, 0x43, 0x6f, 0x72, 0x69, 0x6e,
+  0x6e, 0x65, 0x20, 0x43, 0x6f, 0x68, 0x6e, 0x00, 0x41, 0x75, 0x67, 0x75,
+  0x74, 0x68, 0x65, 0x20, 0x53, 0x77, 0x61, 0x68, 0x69, 0x6c, 0x69, 0x20,
+  0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x28, 0x4b, 0x69,
+  0x73, 0x77, 0x61, 0x68, 0x69, 0x6c, 0x69, 0x29, 0x20, 0x69, 0x73, 0x20,
+  0x75, 0x73, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x6c, 0x69, 0x6e, 0x67,
+  0x75, 0x61, 0x20, 0x66, 0x72, 0x61, 0x6e, 0x63, 0x61, 0x20, 0x62, 0x79,
+  0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x35,
+  0x30, 0x20, 0x6d, 0x69, 0x6c, 0x6c, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x65,
+  0x6f, 0x70, 0x6c, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x45, 0x61, 0x73, 0x74,
+  0x65, 0x72, 0x6e, 0x20, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x6f, 0x66, 0x66,
+  0x69, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61,
+  0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x4b, 0x65, 0x6e, 0x79, 0x61, 0x2c,
+  0x20, 0x54, 0x61, 0x6e, 0x7a, 0x61, 0x6e, 0x69, 0x61, 0x2c, 0x20, 0x55,
+  0x67, 0x61, 0x6e, 0x64, 0x61, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43,
+  0x6f, 0x6d, 0x6f, 0x72, 0x6f, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x6e, 0x20, 0x55,
+  0x6e, 0x69, 0x6f, 0x6e, 0x2e, 0x00, 0x04, 0x07, 0x46, 0x75, 0x6d, 0x6f,
+  0x20, 0x4c, 0x69, 0x79, 0x6f, 0x6e, 0x67, 0x6f, 0x00, 0x4d, 0x77, 0x61,
+  0x6e, 0x61, 0x20, 0x4d, 0x6b, 0x69, 0x73, 0x69, 0x00, 0x41, 0x6c, 0x2d,
+  0x48, 0x61, 0x73, 0x61, 0x6e, 0x20, 0x69, 0x62, 0x6e, 0x20, 0x53, 0x75,
+  0x6c, 0x61, 0x69, 0x6d, 0x61, 0x6e, 0x00, 0x42, 0x77, 0x61, 0x6e, 0x61,
+  0x20, 0x4d, 0x6b, 0x75, 0x75, 0x00, 0x46, 0x75, 0x6d, 0x6f, 0x20, 0x4d,
+  0x61, 0x64, 0x69, 0x20, 0x69, 0x62, 0x6e, 0x20, 0x41, 0x62, 0x69, 0x20,
+  0x42, 0x61, 0x6b, 0x72, 0x00, 0x41, 0x62, 0x75, 0x73, 0x68, 0x69, 0x72,
+  0x69, 0x00, 0x54, 0x69, 0x70, 0x70, 0x75, 0x20, 0x54, 0x69, 0x70, 0x00,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01,
+  0x09, 0x01, 0x4a, 0x00, 0x94, 0xff, 0xef, 0x03, 0x01, 0xdd, 0x66, 0x72,
+  0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x00, 0x53, 0x77, 0x61, 0x7a, 0x69, 0x00, 0x53, 0x77, 0x61, 0x7a,
+  0x69, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x53, 0x77,
+  0x61, 0x7a, 0x69, 0x73, 0x00, 0x73, 0x77, 0x61, 0x7a, 0x69, 0x6c, 0x61,
+  0x6e, 0x64, 0x00, 0x72, 0x77, 0x61, 0x6e, 0x64, 0x61, 0x00, 0x54, 0x68,
+  0x65, 0x20, 0x53, 0x77, 0x61, 0x7a, 0x69, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x61, 0x20, 0x42, 0x61, 0x6e, 0x74, 0x75, 0x20, 0x70, 0x65, 0x6f, 0x70,
+  0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x6f, 0x75, 0x74, 0x68, 0x65,
+  0x72, 0x6e, 0x20, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2e, 0x20, 0x55,
+  0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x65, 0x61,
+  0x64, 0x65, 0x72, 0x73, 0x68, 0x69, 0x70, 0x20, 0x6f, 0x66, 0x20, 0x4d,
+  0x73, 0x77, 0x61, 0x74, 0x69, 0x20, 0x49, 0x49, 0x20, 0x28, 0x31, 0x38,
+  0x32, 0x30, 0x20, 0x2d, 0x20, 0x31, 0x38, 0x36, 0x38, 0x29, 0x2c, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x53, 0x77, 0x61, 0x7a, 0x69, 0x73, 0x20, 0x65,
+  0x78, 0x70, 0x61, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x69,
+  0x72, 0x20, 0x74, 0x65, 0x72, 0x72, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x73, 0x74, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x7a,
+  0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6f, 0x75, 0x74, 0x68,
+  0x65, 0x72, 0x6e, 0x20, 0x66, 0x72, 0x6f, 0x6e, 0x74, 0x69, 0x65, 0x72,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x5a, 0x75,
+  0x6c, 0x75, 0x73, 0x2e, 0x00, 0x02, 0x06, 0x44, 0x6c, 0x61, 0x6d, 0x69,
+  0x6e, 0x69, 0x20, 0x49, 0x00, 0x53, 0x6f, 0x62, 0x68, 0x75, 0x7a, 0x61,
+  0x20, 0x49, 0x00, 0x4d, 0x73, 0x77, 0x61, 0x74, 0x69, 0x20, 0x49, 0x49,
+  0x00, 0x4c, 0x61, 0x62, 0x6f, 0x74, 0x73, 0x69, 0x62, 0x65, 0x6e, 0x69,
+  0x00, 0x53, 0x6f, 0x62, 0x68, 0x75, 0x7a, 0x61, 0x20, 0x49, 0x49, 0x00,
+  0x4e, 0x74, 0x6f, 0x6d, 0x62, 0x69, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01,
+  0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x09, 0x02, 0xa8, 0x00, 0x94, 0x7e,
+  0xef, 0x03, 0x01, 0xde, 0x53, 0x77, 0x65, 0x64, 0x69, 0x73, 0x68, 0x00,
+  0x53, 0x77, 0x65, 0x64, 0x69, 0x73, 0x68, 0x00, 0x3f, 0x70, 0x6c, 0x75,
+  0x72, 0x61, 0x6c, 0x3a, 0x53, 0x77, 0x65, 0x64, 0x65, 0x73, 0x00, 0x73,
+  0x77, 0x65, 0x64, 0x65, 0x6e, 0x00, 0x2d, 0x00, 0x54, 0x68, 0x65, 0x20,
+  0x4b, 0x69, 0x6e, 0x67, 0x64, 0x6f, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x53,
+  0x77, 0x65, 0x64, 0x65, 0x6e, 0x20, 0x77, 0x61, 0x73, 0x20, 0x63, 0x68,
+  0x72, 0x69, 0x73, 0x74, 0x69, 0x61, 0x6e, 0x69, 0x7a, 0x65, 0x64, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x69, 0x64,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x70, 0x6f,
+  0x6c, 0x69, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x6e, 0x74, 0x69,
+  0x74, 0x79, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x32,
+  0x74, 0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x20, 0x43,
+  0x45, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x72, 0x79, 0x20, 0x72, 0x6f, 0x73, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x70,
+  0x72, 0x6f, 0x6d, 0x69, 0x6e, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x61, 0x73,
+  0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x67, 0x72, 0x65, 0x61, 0x74, 0x20, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x73,
+  0x20, 0x6f, 0x66, 0x20, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x20, 0x69,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x37, 0x74, 0x68, 0x20, 0x63,
+  0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x2c, 0x20, 0x66, 0x6f, 0x6c, 0x6c,
+  0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x61,
+  0x6e, 0x74, 0x69, 0x61, 0x6c, 0x20, 0x6d, 0x69, 0x6c, 0x69, 0x74, 0x61,
+  0x72, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73,
+  0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6f, 0x20, 0x63,
+  0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x57, 0x61, 0x72, 0x72, 0x69, 0x6f,
+  0x72, 0x20, 0x4b, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x20, 0x48, 0x6f, 0x77,
+  0x65, 0x76, 0x65, 0x72, 0x2c, 0x20, 0x64, 0x75, 0x65, 0x20, 0x74, 0x6f,
+  0x20, 0x61, 0x20, 0x77, 0x6f, 0x72, 0x73, 0x65, 0x6e, 0x69, 0x6e, 0x67,
+  0x20, 0x65, 0x63, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x73, 0x65, 0x76, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x64, 0x69, 0x73,
+  0x61, 0x73, 0x74, 0x72, 0x6f, 0x75, 0x73, 0x20, 0x64, 0x65, 0x66, 0x65,
+  0x61, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x52, 0x75, 0x73, 0x73, 0x69,
+  0x61, 0x2c, 0x20, 0x53, 0x77, 0x65, 0x64, 0x65, 0x6e, 0x20, 0x73, 0x6f,
+  0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x73, 0x74, 0x20, 0x6d, 0x6f, 0x73, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x69, 0x74, 0x73, 0x20, 0x67, 0x61, 0x69, 0x6e,
+  0x65, 0x64, 0x20, 0x74, 0x65, 0x72, 0x72, 0x69, 0x74, 0x6f, 0x72, 0x79,
+  0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72,
+  0x79, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65,
+  0x65, 0x6e, 0x20, 0x69, 0x6e, 0x76, 0x6f, 0x6c, 0x76, 0x65, 0x64, 0x20,
+  0x69, 0x6e, 0x20, 0x61, 0x6e, 0x20, 0x61, 0x72, 0x6d, 0x65, 0x64, 0x20,
+  0x63, 0x6f, 0x6e, 0x66, 0x6c, 0x69, 0x63, 0x74, 0x20, 0x73, 0x69, 0x6e,
+  0x63, 0x65, 0x20, 0x31, 0x38, 0x31, 0x34, 0x2e, 0x00, 0x0c, 0x45, 0x72,
+  0x69, 0x6b, 0x20, 0x53, 0x65, 0x67, 0x65, 0x72, 0x73, 0xc3, 0xa4, 0x6c,
+  0x6c, 0x00, 0x4f, 0x6c, 0x6f, 0x66, 0x20, 0x53, 0x6b, 0xc3, 0xb6, 0x74,
+  0x6b, 0x6f, 0x6e, 0x75, 0x6e, 0x67, 0x00, 0x4d, 0x61, 0x67, 0x6e, 0x75,
+  0x73, 0x20, 0x4c, 0x61, 0x64, 0x75, 0x6c, 0xc3, 0xa5, 0x73, 0x00, 0x47,
+  0x75, 0x73, 0x74, 0x61, 0x76, 0x20, 0x56, 0x61, 0x73, 0x61, 0x00, 0x45,
+  0x72, 0x69, 0x6b, 0x20, 0x49, 0x58, 0x00, 0x4b, 0x61, 0x72, 0x6c, 0x20,
+  0x58, 0x49, 0x49, 0x00, 0x47, 0x75, 0x73, 0x74, 0x61, 0x76, 0x20, 0x49,
+  0x49, 0x20, 0x41, 0x64, 0x6f, 0x6c, 0x66, 0x00, 0x4b, 0x72, 0x69, 0x73,
+  0x74, 0x69, 0x6e, 0x61, 0x00, 0x4f, 0x73, 0x63, 0x61, 0x72, 0x20, 0x49,
+  0x49, 0x00, 0x50, 0x65, 0x72, 0x20, 0x41, 0x6c, 0x62, 0x69, 0x6e, 0x20,
+  0x48, 0x61, 0x6e, 0x73, 0x73, 0x6f, 0x6e, 0x00, 0x4f, 0x6c, 0x6f, 0x66,
+  0x20, 0x50, 0x61, 0x6c, 0x6d, 0x65, 0x00, 0x41, 0x6e, 0x6e, 0x61, 0x20,
+  0x4c, 0x69, 0x6e, 0x64, 0x68, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x02, 0x01, 0x00, 0x04, 0x01, 0x02,
+  0x03, 0x07, 0x09, 0x03, 0x1f, 0x00, 0x94, 0x7f, 0xef, 0x03, 0x01, 0xdf,
+  0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x00, 0x53, 0x77, 0x69, 0x73, 0x73, 0x00, 0x53, 0x77,
+  0x69, 0x73, 0x73, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a,
+  0x53, 0x77, 0x69, 0x73, 0x73, 0x00, 0x73, 0x77, 0x69, 0x74, 0x7a, 0x65,
+  0x72, 0x6c, 0x61, 0x6e, 0x64, 0x00, 0x2d, 0x00, 0x53, 0x77, 0x69, 0x74,
+  0x7a, 0x65, 0x72, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x68, 0x61, 0x73, 0x20,
+  0x65, 0x78, 0x69, 0x73, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61,
+  0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x69, 0x74,
+  0x73, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x20, 0x73, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x61, 0x64, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x77, 0x69, 0x73, 0x73, 0x20, 0x46,
+  0x65, 0x64, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x43, 0x6f, 0x6e, 0x73, 0x74,
+  0x69, 0x74, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x31,
+  0x38, 0x34, 0x38, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65,
+  0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6d,
+  0x6f, 0x64, 0x65, 0x72, 0x6e, 0x20, 0x53, 0x77, 0x69, 0x74, 0x7a, 0x65,
+  0x72, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x65, 0x73, 0x74, 0x61, 0x62, 0x6c,
+  0x69, 0x73, 0x68, 0x65, 0x64, 0x20, 0x61, 0x20, 0x70, 0x72, 0x6f, 0x74,
+  0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x61, 0x6c, 0x6c, 0x69, 0x61,
+  0x6e, 0x63, 0x65, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
+  0x6e, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x33,
+  0x74, 0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x2c, 0x20,
+  0x66, 0x6f, 0x72, 0x6d, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 0x6c, 0x6f,
+  0x6f, 0x73, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x65, 0x64, 0x65, 0x72,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x74, 0x61,
+  0x74, 0x65, 0x73, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x70, 0x65,
+  0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x69, 0x65, 0x73, 0x2e, 0x00, 0x14,
+  0x57, 0x69, 0x6c, 0x68, 0x65, 0x6c, 0x6d, 0x20, 0x54, 0x65, 0x6c, 0x6c,
+  0x00, 0x41, 0x72, 0x6e, 0x6f, 0x6c, 0x64, 0x20, 0x76, 0x6f, 0x6e, 0x20,
+  0x57, 0x69, 0x6e, 0x6b, 0x65, 0x6c, 0x72, 0x69, 0x65, 0x64, 0x00, 0x48,
+  0x65, 0x72, 0x6d, 0x61, 0x6e, 0x6e, 0x20, 0x47, 0x65, 0x73, 0x73, 0x6c,
+  0x65, 0x72, 0x00, 0x55, 0x6c, 0x72, 0x69, 0x63, 0x68, 0x20, 0x76, 0x6f,
+  0x6e, 0x20, 0x48, 0x6f, 0x68, 0x65, 0x6e, 0x73, 0x61, 0x78, 0x00, 0x48,
+  0x61, 0x6e, 0x73, 0x20, 0x4c, 0x75, 0x64, 0x77, 0x69, 0x67, 0x20, 0x76,
+  0x6f, 0x6e, 0x20, 0x45, 0x72, 0x6c, 0x61, 0x63, 0x68, 0x00, 0x57, 0x69,
+  0x6c, 0x68, 0x65, 0x6c, 0x6d, 0x20, 0x42, 0x65, 0x72, 0x6e, 0x68, 0x61,
+  0x72, 0x64, 0x20, 0x76, 0x6f, 0x6e, 0x20, 0x4d, 0x75, 0x72, 0x61, 0x6c,
+  0x74, 0x00, 0x4b, 0x61, 0x72, 0x6c, 0x20, 0x4c, 0x75, 0x64, 0x77, 0x69,
+  0x67, 0x20, 0x76, 0x6f, 0x6e, 0x20, 0x45, 0x72, 0x6c, 0x61, 0x63, 0x68,
+  0x00, 0x41, 0x75, 0x67, 0x75, 0x73, 0x74, 0x69, 0x6e, 0x20, 0x4b, 0x65,
+  0x6c, 0x6c, 0x65, 0x72, 0x00, 0x4a, 0x6f, 0x68, 0x61, 0x6e, 0x6e, 0x20,
+  0x57, 0x65, 0x62, 0x65, 0x72, 0x00, 0x4a, 0x6f, 0x73, 0x65, 0x70, 0x68,
+  0x20, 0x4c, 0x65, 0x6f, 0x6e, 0x7a, 0x20, 0x41, 0x6e, 0x64, 0x65, 0x72,
+  0x6d, 0x61, 0x74, 0x74, 0x00, 0x50, 0x69, 0x65, 0x72, 0x72, 0x65, 0x20,
+  0x76, 0x6f, 0x6e, 0x20, 0x64, 0x65, 0x72, 0x20, 0x57, 0x65, 0x69, 0x64,
+  0x00, 0x4e, 0x69, 0x6b, 0x6c, 0x61, 0x75, 0x73, 0x20, 0x52, 0x75, 0x64,
+  0x6f, 0x6c, 0x66, 0x20, 0x76, 0x6f, 0x6e, 0x20, 0x57, 0x61, 0x74, 0x74,
+  0x65, 0x6e, 0x77, 0x79, 0x6c, 0x00, 0x4e, 0x69, 0x6b, 0x6c, 0x61, 0x75,
+  0x73, 0x20, 0x46, 0x72, 0x61, 0x6e, 0x7a, 0x20, 0x76, 0x6f, 0x6e, 0x20,
+  0x42, 0x61, 0x63, 0x68, 0x6d, 0x61, 0x6e, 0x6e, 0x00, 0x43, 0x2e, 0x4a,
+  0x2e, 0x20, 0x47, 0x75, 0x69, 0x67, 0x75, 0x65, 0x72, 0x20, 0x64, 0x65,
+  0x20, 0x50, 0x72, 0x61, 0x6e, 0x67, 0x69, 0x6e, 0x73, 0x00, 0x50, 0x65,
+  0x74, 0x65, 0x72, 0x20, 0x4c, 0x75, 0x64, 0x77, 0x69, 0x67, 0x20, 0x76,
+  0x6f, 0x6e, 0x20, 0x44, 0x6f, 0x6e, 0x6c, 0x69, 0x66, 0x74, 0x65, 0x64,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x61, 0x6c, 0x6c, 0x69, 0x65, 0x64,
+  0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x00, 0x41, 0x6c, 0x6c, 0x6f,
+  0x77, 0x73, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20,
+  0x62, 0x65, 0x20, 0x61, 0x69, 0x72, 0x6c, 0x69, 0x66, 0x74, 0x65, 0x64,
+  0x20, 0x74, 0x6f, 0x20, 0x61, 0x6c, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x63,
+  0x69, 0x74, 0x69, 0x65, 0x73, 0x00, 0x55, 0x6e, 0x6c, 0x69, 0x6d, 0x69,
+  0x74, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x63, 0x69,
+  0x74, 0x79, 0x00, 0x55, 0x6e, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64,
+  0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x65,
+  0x73, 0x74, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x69,
+  0x74, 0x79, 0x00, 0x00, 0x07, 0x00, 0xa7, 0x04, 0x00, 0x1f, 0x00, 0x07,
+  0x00, 0xa8, 0x04, 0x00, 0x95, 0x00, 0x17, 0x00, 0xa8, 0x37, 0x00, 0x6f,
+  0x48, 0x41, 0x68, 0x61, 0x64, 0x4f, 0x6f, 0x00, 0x48, 0x41, 0x68, 0x61,
+  0x64, 0x4f, 0x6f, 0x00, 0x00, 0x13, 0x00, 0xa7, 0xb7, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0xf4, 0x00,
+  0x0b, 0x00, 0xa7, 0x87, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x64, 0x00, 0x07,
+  0x00, 0xa6, 0x07, 0x00, 0x4e, 0x00, 0x08, 0x00, 0xaa, 0x04, 0x00, 0x00,
+  0x85, 0x00, 0x07, 0x00, 0xa6, 0x07, 0x00, 0x70, 0x00, 0x94, 0x00, 0xa9,
+  0xf7, 0x01, 0x00, 0x57, 0x02, 0x02, 0x05, 0x44, 0x49, 0x53, 0x41, 0x42,
+  0x4c, 0x45, 0x44, 0x00, 0x48, 0x55, 0x54, 0x53, 0x5f, 0x4f, 0x4e, 0x4c,
+  0x59, 0x00, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x00, 0x46, 0x52, 0x45,
+  0x51, 0x55, 0x45, 0x4e, 0x54, 0x00, 0x48, 0x4f, 0x52, 0x44, 0x45, 0x53,
+  0x00, 0x4e, 0x6f, 0x20, 0x62, 0x61, 0x72, 0x62, 0x61, 0x72, 0x69, 0x61,
+  0x6e, 0x73, 0x00, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x68,
+  0x75, 0x74, 0x73, 0x00, 0x4e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 0x72,
+  0x61, 0x74, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61,
+  0x72, 0x61, 0x6e, 0x63, 0x65, 0x00, 0x46, 0x72, 0x65, 0x71, 0x75, 0x65,
+  0x6e, 0x74, 0x20, 0x62, 0x61, 0x72, 0x62, 0x61, 0x72, 0x69, 0x61, 0x6e,
+  0x20, 0x75, 0x70, 0x72, 0x69, 0x73, 0x69, 0x6e, 0x67, 0x00, 0x52, 0x61,
+  0x67, 0x69, 0x6e, 0x67, 0x20, 0x68, 0x6f, 0x72, 0x64, 0x65, 0x73, 0x00,
+  0x00, 0x88, 0x00, 0xa9, 0xf7, 0x01, 0x00, 0x52, 0x01, 0x01, 0x04, 0x44,
+  0x49, 0x53, 0x41, 0x42, 0x4c, 0x45, 0x44, 0x00, 0x45, 0x4e, 0x41, 0x42,
+  0x4c, 0x45, 0x44, 0x00, 0x53, 0x45, 0x45, 0x5f, 0x49, 0x4e, 0x53, 0x49,
+  0x44, 0x45, 0x00, 0x45, 0x58, 0x50, 0x41, 0x4e, 0x44, 0x00, 0x44, 0x69,
+  0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x00, 0x45, 0x6e, 0x61, 0x62, 0x6c,
+  0x65, 0x64, 0x00, 0x53, 0x65, 0x65, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79,
+  0x74, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e, 0x73, 0x69, 0x64, 0x65,
+  0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x73, 0x00, 0x42, 0x6f, 0x72,
+  0x64, 0x65, 0x72, 0x73, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x20,
+  0x74, 0x6f, 0x20, 0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x2c, 0x20,
+  0x72, 0x65, 0x76, 0x65, 0x61, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x69,
+  0x6c, 0x65, 0x73, 0x00, 0x00, 0x3b, 0x00, 0xa9, 0xc7, 0x01, 0x00, 0x46,
+  0x02, 0x43, 0x4c, 0x41, 0x53, 0x53, 0x49, 0x43, 0x00, 0x4c, 0x4f, 0x47,
+  0x41, 0x52, 0x49, 0x54, 0x48, 0x4d, 0x49, 0x43, 0x00, 0x43, 0x6c, 0x61,
+  0x73, 0x73, 0x69, 0x63, 0x20, 0x46, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76,
+  0x00, 0x4c, 0x6f, 0x67, 0x5e, 0x32, 0x20, 0x4e, 0x20, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x00, 0x00, 0x07, 0x00, 0xa7, 0x04, 0x00, 0x83, 0x00, 0x18,
+  0x00, 0xa7, 0xff, 0x00, 0x42, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x8c,
+  0x00, 0xa9, 0xf7, 0x01, 0x00, 0x55, 0x01, 0x01, 0x04, 0x4e, 0x4f, 0x5f,
+  0x52, 0x45, 0x53, 0x54, 0x52, 0x49, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x53,
+  0x00, 0x50, 0x4c, 0x41, 0x59, 0x45, 0x52, 0x5f, 0x55, 0x4e, 0x49, 0x51,
+  0x55, 0x45, 0x00, 0x47, 0x4c, 0x4f, 0x42, 0x41, 0x4c, 0x5f, 0x55, 0x4e,
+  0x49, 0x51, 0x55, 0x45, 0x00, 0x4e, 0x4f, 0x5f, 0x53, 0x54, 0x45, 0x41,
+  0x4c, 0x49, 0x4e, 0x47, 0x00, 0x4e, 0x6f, 0x20, 0x72, 0x65, 0x73, 0x74,
+  0x72, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x55, 0x6e, 0x69,
+  0x71, 0x75, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x70, 0x6c, 0x61,
+  0x79, 0x65, 0x72, 0x00, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x6c, 0x79,
+  0x20, 0x75, 0x6e, 0x69, 0x71, 0x75, 0x65, 0x00, 0x4e, 0x6f, 0x20, 0x63,
+  0x69, 0x74, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x73, 0x74, 0x65,
+  0x61, 0x6c, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x17, 0x00, 0xa7, 0xf7, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x07, 0x00, 0xa7, 0x04, 0x00, 0x20,
+  0x00, 0x07, 0x00, 0xa7, 0x04, 0x00, 0x87, 0x00, 0x07, 0x00, 0xa7, 0x04,
+  0x00, 0x89, 0x00, 0x08, 0x00, 0xa9, 0x04, 0x00, 0x00, 0x88, 0x00, 0x0b,
+  0x00, 0xa7, 0x87, 0x00, 0x38, 0x00, 0x00, 0x00, 0x64, 0x00, 0x13, 0x00,
+  0xa7, 0xb7, 0x00, 0x65, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x23, 0x00, 0xa8, 0x37, 0x00, 0x81, 0x4e,
+  0x41, 0x53, 0x52, 0x4c, 0x50, 0x45, 0x4d, 0x4f, 0x43, 0x71, 0x72, 0x62,
+  0x00, 0x4e, 0x41, 0x53, 0x52, 0x4c, 0x50, 0x45, 0x4d, 0x4f, 0x43, 0x71,
+  0x72, 0x62, 0x00, 0x00, 0x0b, 0x00, 0xa7, 0x87, 0x00, 0x34, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x17, 0x00, 0xa7, 0xf7, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x64, 0x00, 0x0b, 0x00, 0xa7, 0x87, 0x00, 0x35, 0x00, 0x00, 0x00, 0x64,
+  0x01, 0x07, 0x00, 0xa9, 0xc7, 0x01, 0x00, 0x54, 0x07, 0x41, 0x4c, 0x4c,
+  0x00, 0x48, 0x55, 0x4d, 0x41, 0x4e, 0x00, 0x41, 0x49, 0x00, 0x4e, 0x4f,
+  0x41, 0x49, 0x00, 0x4e, 0x4f, 0x4d, 0x49, 0x58, 0x45, 0x44, 0x00, 0x54,
+  0x45, 0x41, 0x4d, 0x00, 0x44, 0x49, 0x53, 0x41, 0x42, 0x4c, 0x45, 0x44,
+  0x00, 0x45, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x6f, 0x6e, 0x65, 0x00, 0x4f, 0x6e,
+  0x6c, 0x79, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x20, 0x62,
+  0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x68, 0x75, 0x6d, 0x61, 0x6e,
+  0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x00, 0x4f, 0x6e, 0x6c,
+  0x79, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x20, 0x62, 0x65,
+  0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x41, 0x49, 0x20, 0x70, 0x6c, 0x61,
+  0x79, 0x65, 0x72, 0x73, 0x00, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x6c,
+  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x68,
+  0x75, 0x6d, 0x61, 0x6e, 0x20, 0x69, 0x6e, 0x76, 0x6f, 0x6c, 0x76, 0x65,
+  0x64, 0x00, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
+  0x65, 0x64, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x74,
+  0x77, 0x6f, 0x20, 0x68, 0x75, 0x6d, 0x61, 0x6e, 0x73, 0x2c, 0x20, 0x6f,
+  0x72, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x41, 0x49, 0x20, 0x70, 0x6c, 0x61,
+  0x79, 0x65, 0x72, 0x73, 0x00, 0x52, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63,
+  0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x65, 0x61, 0x6d, 0x73,
+  0x00, 0x44, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x6f, 0x6e, 0x65, 0x00, 0x00,
+  0x13, 0x00, 0xa7, 0xb7, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00,
+  0x00, 0x0a, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x0b, 0x00, 0xa7, 0x87, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x07, 0x00, 0xa6, 0x37, 0x00, 0x25,
+  0x00, 0x07, 0x00, 0xa6, 0x07, 0x00, 0x26, 0x00, 0x17, 0x00, 0xa7, 0xf7,
+  0x00, 0x24, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0x00, 0x00, 0x4e, 0x20, 0x00, 0x13, 0x00, 0xa7, 0xb7, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80,
+  0x00, 0x00, 0x07, 0x00, 0xa6, 0x37, 0x00, 0x60, 0x00, 0x17, 0x00, 0xa7,
+  0xf7, 0x00, 0x71, 0x00, 0x00, 0x13, 0x88, 0x00, 0x00, 0x13, 0x88, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x17, 0x00, 0xa7, 0xf7,
+  0x00, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0x83, 0xd5, 0xff, 0x00, 0x07, 0x00, 0xa6, 0x07, 0x00,
+  0x7f, 0x00, 0x13, 0x00, 0xa7, 0xb7, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x07, 0x00, 0xa6,
+  0x07, 0x00, 0x5c, 0x00, 0x07, 0x00, 0xa6, 0x37, 0x00, 0x5b, 0x00, 0x18,
+  0x00, 0xa7, 0xff, 0x00, 0x3c, 0x01, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x27, 0x10, 0x00, 0x0b,
+  0x00, 0xa7, 0x87, 0x00, 0x39, 0x00, 0x00, 0x00, 0x64, 0x00, 0x17, 0x00,
+  0xa7, 0xf7, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x32, 0x00, 0x08, 0x00, 0xa7,
+  0x0c, 0x00, 0x18, 0x02, 0x00, 0x96, 0x00, 0xa9, 0xf7, 0x01, 0x00, 0x07,
+  0x01, 0x01, 0x06, 0x53, 0x43, 0x45, 0x4e, 0x41, 0x52, 0x49, 0x4f, 0x00,
+  0x52, 0x41, 0x4e, 0x44, 0x4f, 0x4d, 0x00, 0x46, 0x52, 0x41, 0x43, 0x54,
+  0x41, 0x4c, 0x00, 0x49, 0x53, 0x4c, 0x41, 0x4e, 0x44, 0x00, 0x46, 0x41,
+  0x49, 0x52, 0x00, 0x46, 0x52, 0x41, 0x43, 0x54, 0x55, 0x52, 0x45, 0x00,
+  0x53, 0x63, 0x65, 0x6e, 0x61, 0x72, 0x69, 0x6f, 0x20, 0x6d, 0x61, 0x70,
+  0x00, 0x46, 0x75, 0x6c, 0x6c, 0x79, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f,
+  0x6d, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x00, 0x50, 0x73, 0x65,
+  0x75, 0x64, 0x6f, 0x2d, 0x66, 0x72, 0x61, 0x63, 0x74, 0x61, 0x6c, 0x20,
+  0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x00, 0x49, 0x73, 0x6c, 0x61, 0x6e,
+  0x64, 0x2d, 0x62, 0x61, 0x73, 0x65, 0x64, 0x00, 0x46, 0x61, 0x69, 0x72,
+  0x20, 0x69, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x00, 0x46, 0x72, 0x61,
+  0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x6d, 0x61, 0x70, 0x00, 0x00, 0x07,
+  0x00, 0xa6, 0x37, 0x00, 0x13, 0x00, 0x17, 0x00, 0xa7, 0xf7, 0x00, 0x14,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x27, 0x10, 0x00, 0x13, 0x00, 0xa7, 0xb7, 0x00, 0x2a, 0x00,
+  0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0xc3, 0x50, 0x00,
+  0x71, 0x00, 0xa9, 0xf7, 0x01, 0x00, 0x53, 0x01, 0x01, 0x03, 0x44, 0x49,
+  0x53, 0x41, 0x42, 0x4c, 0x45, 0x44, 0x00, 0x4e, 0x41, 0x54, 0x49, 0x4f,
+  0x4e, 0x41, 0x4c, 0x00, 0x41, 0x4c, 0x4c, 0x49, 0x45, 0x44, 0x00, 0x42,
+  0x6f, 0x72, 0x64, 0x65, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e,
+  0x6f, 0x74, 0x20, 0x68, 0x65, 0x6c, 0x70, 0x69, 0x6e, 0x67, 0x00, 0x48,
+  0x61, 0x70, 0x70, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20,
+  0x6f, 0x77, 0x6e, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x73, 0x00,
+  0x48, 0x61, 0x70, 0x70, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e,
+  0x20, 0x61, 0x6c, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x62, 0x6f, 0x72, 0x64,
+  0x65, 0x72, 0x73, 0x00, 0x00, 0x07, 0x00, 0xa6, 0x37, 0x00, 0x67, 0x00,
+  0x13, 0x00, 0xa7, 0xb7, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x0b, 0x00, 0xa7, 0x87, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x64, 0x00, 0x0b, 0x00, 0xa7, 0x87, 0x00, 0x36,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x0b, 0x00, 0xa7, 0x87, 0x00, 0x2b, 0x00,
+  0x00, 0xc3, 0x50, 0x00, 0x07, 0x00, 0xa6, 0x05, 0x00, 0x7d, 0x00, 0x07,
+  0x00, 0xa7, 0x04, 0x00, 0x92, 0x00, 0x07, 0x00, 0xa6, 0x37, 0x00, 0x50,
+  0x00, 0x07, 0x00, 0xa6, 0x37, 0x00, 0x4f, 0x00, 0x0b, 0x00, 0xa7, 0x87,
+  0x00, 0x51, 0x00, 0x00, 0x00, 0x64, 0x00, 0x17, 0x00, 0xa7, 0xf7, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x55, 0x00, 0x08, 0x00, 0xa7, 0x0c, 0x00, 0x17,
+  0x02, 0x00, 0x54, 0x00, 0xa9, 0xdf, 0x01, 0x00, 0x00, 0x01, 0x01, 0x03,
+  0x46, 0x55, 0x4c, 0x4c, 0x53, 0x49, 0x5a, 0x45, 0x00, 0x50, 0x4c, 0x41,
+  0x59, 0x45, 0x52, 0x00, 0x58, 0x59, 0x53, 0x49, 0x5a, 0x45, 0x00, 0x4e,
+  0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x69, 0x6c,
+  0x65, 0x73, 0x00, 0x54, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x70, 0x65, 0x72,
+  0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x00, 0x57, 0x69, 0x64, 0x74,
+  0x68, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74,
+  0x00, 0x00, 0x13, 0x00, 0xa7, 0xb7, 0x00, 0x91, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x17, 0x00, 0xa7,
+  0xf7, 0x00, 0x1d, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x07, 0x00, 0xa8, 0x04,
+  0x00, 0x93, 0x00, 0x0f, 0x00, 0xa7, 0xc7, 0x00, 0x6c, 0xff, 0xff, 0xff,
+  0x61, 0x74, 0x69, 0x74, 0x75, 0x64, 0x65, 0x00, 0x43, 0x6f, 0x6d, 0x62,
+  0x69, 0x6e, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x27, 0x6e,
+  0x6f, 0x72, 0x74, 0x68, 0x6c, 0x61, 0x74, 0x69, 0x74, 0x75, 0x64, 0x65,
+  0x27, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x20,
+  0x77, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6c, 0x69, 0x6d, 0x61, 0x74, 0x69,
+  0x63, 0x20, 0x7a, 0x6f, 0x6e, 0x65, 0x73, 0x20, 0x65, 0x78, 0x69, 0x73,
+  0x74, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x70,
+  0x2e, 0x20, 0x48, 0x69, 0x67, 0x68, 0x65, 0x72, 0x20, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66, 0x75, 0x72, 0x74,
+  0x68, 0x65, 0x72, 0x20, 0x6e, 0x6f, 0x72, 0x74, 0x68, 0x2c, 0x20, 0x6c,
+  0x6f, 0x77, 0x65, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20,
+  0x61, 0x72, 0x65, 0x20, 0x66, 0x75, 0x72, 0x74, 0x68, 0x65, 0x72, 0x20,
+  0x73, 0x6f, 0x75, 0x74, 0x68, 0x2e, 0x0a, 0x0a, 0x31, 0x30, 0x30, 0x30,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x2d, 0x31, 0x30, 0x30, 0x30, 0x20, 0x67,
+  0x69, 0x76, 0x65, 0x73, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6c, 0x6c, 0x20,
+  0x70, 0x6c, 0x61, 0x6e, 0x65, 0x74, 0x61, 0x72, 0x79, 0x20, 0x6d, 0x61,
+  0x70, 0x2e, 0x0a, 0x31, 0x30, 0x30, 0x30, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x20, 0x67, 0x69, 0x76, 0x65, 0x73, 0x20,
+  0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x20, 0x6e, 0x6f, 0x72, 0x74, 0x68,
+  0x65, 0x72, 0x6e, 0x20, 0x68, 0x65, 0x6d, 0x69, 0x73, 0x70, 0x68, 0x65,
+  0x72, 0x65, 0x2e, 0x0a, 0x20, 0x35, 0x30, 0x30, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x20, 0x20, 0x35, 0x30, 0x30, 0x20, 0x67, 0x69, 0x76, 0x65, 0x73,
+  0x20, 0x61, 0x20, 0x6d, 0x61, 0x70, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x6d, 0x69, 0x64,
+  0x64, 0x6c, 0x65, 0x2d, 0x6c, 0x61, 0x74, 0x69, 0x74, 0x75, 0x64, 0x65,
+  0x20, 0x63, 0x6c, 0x69, 0x6d, 0x61, 0x74, 0x65, 0x20, 0x65, 0x76, 0x65,
+  0x72, 0x79, 0x77, 0x68, 0x65, 0x72, 0x65, 0x2e, 0x0a, 0x20, 0x33, 0x30,
+  0x30, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x20, 0x2d, 0x33, 0x30, 0x30, 0x20,
+  0x67, 0x69, 0x76, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x71, 0x75,
+  0x61, 0x74, 0x6f, 0x72, 0x69, 0x61, 0x6c, 0x20, 0x6d, 0x61, 0x70, 0x2e,
+  0x0a, 0x0a, 0x49, 0x6e, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x73, 0x65, 0x74,
+  0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f,
+  0x72, 0x74, 0x20, 0x69, 0x74, 0x2c, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x74,
+  0x75, 0x64, 0x65, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x61, 0x6c, 0x73, 0x6f,
+  0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x63, 0x65, 0x72, 0x74, 0x61, 0x69,
+  0x6e, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x73, 0x20, 0x64, 0x75,
+  0x72, 0x69, 0x6e, 0x67, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x70, 0x6c, 0x61,
+  0x79, 0x2e, 0x00, 0x00, 0xb3, 0x00, 0xa5, 0x0f, 0x00, 0x61, 0x73, 0x70,
+  0x61, 0x63, 0x65, 0x73, 0x68, 0x69, 0x70, 0x5f, 0x74, 0x72, 0x61, 0x76,
+  0x65, 0x6c, 0x5f, 0x70, 0x63, 0x74, 0x00, 0x50, 0x65, 0x72, 0x63, 0x65,
+  0x6e, 0x74, 0x61, 0x67, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x75, 0x6c,
+  0x74, 0x69, 0x70, 0x6c, 0x79, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x73,
+  0x68, 0x69, 0x70, 0x20, 0x74, 0x72, 0x61, 0x76, 0x65, 0x6c, 0x20, 0x74,
+  0x69, 0x6d, 0x65, 0x20, 0x62, 0x79, 0x00, 0x54, 0x68, 0x69, 0x73, 0x20,
+  0x70, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x61, 0x67, 0x65, 0x20, 0x69,
+  0x73, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x69, 0x65, 0x64,
+  0x20, 0x6f, 0x6e, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x69,
+  0x6d, 0x65, 0x20, 0x69, 0x74, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x74,
+  0x61, 0x6b, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x73, 0x70,
+  0x61, 0x63, 0x65, 0x73, 0x68, 0x69, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x61,
+  0x72, 0x72, 0x69, 0x76, 0x65, 0x20, 0x61, 0x74, 0x20, 0x41, 0x6c, 0x70,
+  0x68, 0x61, 0x20, 0x43, 0x65, 0x6e, 0x74, 0x61, 0x75, 0x72, 0x69, 0x2e,
+  0x00, 0x04, 0x00, 0xa4, 0x00, 0xa5, 0x07, 0x00, 0x19, 0x73, 0x70, 0x65,
+  0x63, 0x69, 0x61, 0x6c, 0x73, 0x00, 0x41, 0x6d, 0x6f, 0x75, 0x6e, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x22, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c,
+  0x22, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x74,
+  0x69, 0x6c, 0x65, 0x73, 0x00, 0x53, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c,
+  0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x73, 0x20, 0x69,
+  0x6d, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+  0x61, 0x73, 0x69, 0x63, 0x20, 0x74, 0x65, 0x72, 0x72, 0x61, 0x69, 0x6e,
+  0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61,
+  0x72, 0x65, 0x20, 0x6f, 0x6e, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73,
+  0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62,
+  0x6c, 0x65, 0x27, 0x73, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x20, 0x69,
+  0x73, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20,
+  0x74, 0x68, 0x6f, 0x75, 0x73, 0x61, 0x6e, 0x64, 0x2e, 0x00, 0x00, 0x93,
+  0x00, 0xa5, 0x0f, 0x00, 0x28, 0x73, 0x74, 0x61, 0x72, 0x74, 0x63, 0x69,
+  0x74, 0x79, 0x00, 0x57, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70,
+  0x6c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x63, 0x69, 0x74, 0x79,
+  0x00, 0x49, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20,
+  0x73, 0x65, 0x74, 0x2c, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x20, 0x77, 0x69,
+  0x6c, 0x6c, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x27, 0x73, 0x20, 0x66,
+  0x69, 0x72, 0x73, 0x74, 0x20, 0x63, 0x69, 0x74, 0x79, 0x20, 0x61, 0x6c,
+  0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x65,
+  0x64, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6e,
+  0x67, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x00,
+  0x01, 0x05, 0x17, 0x00, 0xa5, 0x07, 0x00, 0x08, 0x73, 0x74, 0x61, 0x72,
+  0x74, 0x70, 0x6f, 0x73, 0x00, 0x4d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x20,
+  0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x68, 0x6f, 0x6f,
+  0x73, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x70, 0x6f, 0x73,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x54, 0x68, 0x65, 0x20, 0x6d,
+  0x65, 0x74, 0x68, 0x6f, 0x64, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74,
+  0x6f, 0x20, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x20, 0x77, 0x68, 0x65,
+  0x72, 0x65, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x6c, 0x61, 0x79,
+  0x65, 0x72, 0x27, 0x73, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c,
+  0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+  0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x70, 0x2e,
+  0x20, 0x28, 0x46, 0x6f, 0x72, 0x20, 0x73, 0x63, 0x65, 0x6e, 0x61, 0x72,
+  0x69, 0x6f, 0x73, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x6e,
+  0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x70, 0x72, 0x65, 0x2d, 0x73, 0x65,
+  0x74, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
+  0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 0x69,
+  0x67, 0x6e, 0x6f, 0x72, 0x65, 0x64, 0x2e, 0x29, 0x0a, 0x2d, 0x20, 0x22,
+  0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x27, 0x73, 0x20,
+  0x63, 0x68, 0x6f, 0x69, 0x63, 0x65, 0x22, 0x20, 0x28, 0x44, 0x45, 0x46,
+  0x41, 0x55, 0x4c, 0x54, 0x29, 0x3a, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+  0x74, 0x61, 0x72, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x77, 0x69, 0x6c, 0x6c, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x20,
+  0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x70, 0x20, 0x67,
+  0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x20, 0x63, 0x68, 0x6f,
+  0x73, 0x65, 0x6e, 0x2e, 0x20, 0x53, 0x65, 0x65, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x27, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x27,
+  0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x2e, 0x0a, 0x2d, 0x20,
+  0x22, 0x4f, 0x6e, 0x65, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x20,
+  0x70, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x65, 0x6e,
+  0x74, 0x22, 0x20, 0x28, 0x53, 0x49, 0x4e, 0x47, 0x4c, 0x45, 0x29, 0x3a,
+  0x20, 0x6f, 0x6e, 0x65, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x20,
+  0x69, 0x73, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x64, 0x20, 0x6f, 0x6e,
+  0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x73,
+  0x65, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e,
+  0x65, 0x6e, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x70, 0x70, 0x72,
+  0x6f, 0x78, 0x69, 0x6d, 0x61, 0x74, 0x65, 0x6c, 0x79, 0x20, 0x65, 0x71,
+  0x75, 0x69, 0x76, 0x61, 0x6c, 0x65, 0x6e, 0x74, 0x20, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x28, 0x69, 0x66, 0x20, 0x70, 0x6f, 0x73, 0x73, 0x69,
+  0x62, 0x6c, 0x65, 0x29, 0x2e, 0x0a, 0x2d, 0x20, 0x22, 0x54, 0x77, 0x6f,
+  0x20, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x72, 0x65, 0x65, 0x20, 0x70, 0x6c,
+  0x61, 0x79, 0x65, 0x72, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x63, 0x6f,
+  0x6e, 0x74, 0x69, 0x6e, 0x65, 0x6e, 0x74, 0x22, 0x20, 0x28, 0x32, 0x6f,
+  0x72, 0x33, 0x29, 0x3a, 0x20, 0x73, 0x69, 0x6d, 0x69, 0x6c, 0x61, 0x72,
+  0x20, 0x74, 0x6f, 0x20, 0x53, 0x49, 0x4e, 0x47, 0x4c, 0x45, 0x20, 0x65,
+  0x78, 0x63, 0x65, 0x70, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74,
+  0x77, 0x6f, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x20, 0x77,
+  0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65,
+  0x64, 0x20, 0x6f, 0x6e, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x6f,
+  0x6e, 0x74, 0x69, 0x6e, 0x65, 0x6e, 0x74, 0x2c, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x74, 0x68, 0x72, 0x65, 0x65, 0x20, 0x6f, 0x6e, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x27, 0x62, 0x65, 0x73, 0x74, 0x27, 0x20, 0x63, 0x6f,
+  0x6e, 0x74, 0x69, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x6f,
+  0x64, 0x64, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66,
+  0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x2e, 0x0a, 0x2d, 0x20,
+  0x22, 0x41, 0x6c, 0x6c, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73,
+  0x20, 0x6f, 0x6e, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65,
+  0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x65, 0x6e, 0x74, 0x22, 0x20,
+  0x28, 0x41, 0x4c, 0x4c, 0x29, 0x3a, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x70,
+  0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20,
+  0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x27, 0x62, 0x65, 0x73, 0x74, 0x27, 0x20, 0x61, 0x76, 0x61, 0x69,
+  0x6c, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e,
+  0x65, 0x6e, 0x74, 0x2e, 0x0a, 0x2d, 0x20, 0x22, 0x44, 0x65, 0x70, 0x65,
+  0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x6e, 0x20, 0x73, 0x69, 0x7a,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x65,
+  0x6e, 0x74, 0x73, 0x22, 0x20, 0x28, 0x56, 0x41, 0x52, 0x49, 0x41, 0x42,
+  0x4c, 0x45, 0x29, 0x3a, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73,
+  0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x70, 0x6c, 0x61,
+  0x63, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x27,
+  0x62, 0x65, 0x73, 0x74, 0x27, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x65, 0x6e,
+  0x74, 0x73, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x74, 0x68, 0x61, 0x74,
+  0x2c, 0x20, 0x61, 0x73, 0x20, 0x66, 0x61, 0x72, 0x20, 0x61, 0x73, 0x20,
+  0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x2c, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20,
+  0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x65,
+  0x61, 0x63, 0x68, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x65, 0x6e,
+  0x74, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x6f, 0x72, 0x74,
+  0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x74, 0x73,
+  0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x0a, 0x49, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x63, 0x61,
+  0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x61, 0x74, 0x69, 0x73, 0x66, 0x79,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
+  0x65, 0x64, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x64,
+  0x75, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20,
+  0x62, 0x65, 0x69, 0x6e, 0x67, 0x20, 0x6d, 0x61, 0x72, 0x69, 0x6e, 0x65,
+  0x00, 0x6d, 0x5f, 0x73, 0x75, 0x62, 0x6d, 0x61, 0x72, 0x69, 0x6e, 0x65,
+  0x00, 0x66, 0x5f, 0x73, 0x75, 0x62, 0x6d, 0x61, 0x72, 0x69, 0x6e, 0x65,
+  0x00, 0x05, 0x00, 0x3c, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x06, 0x07,
+  0x00, 0x01, 0x00, 0x14, 0x6f, 0x00, 0x00, 0x00, 0x42, 0x75, 0x72, 0x72,
+  0x6f, 0x77, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x65,
+  0x61, 0x72, 0x74, 0x68, 0x2e, 0x20, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x73,
+  0x6f, 0x6d, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20,
+  0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x61, 0x74,
+  0x74, 0x61, 0x63, 0x6b, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x74,
+  0x20, 0x45, 0x61, 0x72, 0x74, 0x68, 0x20, 0x53, 0x75, 0x62, 0x2e, 0x20,
+  0x54, 0x68, 0x65, 0x73, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x70, 0x61,
+  0x73, 0x73, 0x20, 0x6f, 0x63, 0x65, 0x61, 0x6e, 0x20, 0x74, 0x69, 0x6c,
+  0x65, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x74, 0x68, 0x72, 0x6f,
+  0x75, 0x67, 0x68, 0x20, 0x42, 0x75, 0x72, 0x72, 0x6f, 0x77, 0x20, 0x54,
+  0x75, 0x62, 0x65, 0x73, 0x2e, 0x03, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x19, 0x00, 0x8c, 0xbf, 0x34, 0x09, 0x00, 0x80, 0x78, 0x0f,
+  0x48, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x00, 0x48, 0x75, 0x6e, 0x74, 0x65,
+  0x72, 0x00, 0x75, 0x2e, 0x68, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x00, 0x75,
+  0x2e, 0x66, 0x72, 0x69, 0x67, 0x61, 0x74, 0x65, 0x00, 0x6d, 0x5f, 0x66,
+  0x72, 0x69, 0x67, 0x61, 0x74, 0x65, 0x00, 0x66, 0x5f, 0x66, 0x72, 0x69,
+  0x67, 0x61, 0x74, 0x65, 0x00, 0x00, 0xa0, 0x07, 0x03, 0x01, 0x00, 0x00,
+  0x00, 0x38, 0x07, 0x00, 0x01, 0x00, 0x1e, 0x7f, 0x00, 0x00, 0x00, 0x42,
+  0x75, 0x72, 0x72, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x75, 0x6e, 0x69,
+  0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20,
+  0x68, 0x61, 0x73, 0x20, 0x63, 0x61, 0x70, 0x61, 0x62, 0x69, 0x6c, 0x69,
+  0x74, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6b,
+  0x20, 0x41, 0x6e, 0x74, 0x69, 0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79,
+  0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x69, 0x74, 0x73, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x6d, 0x69, 0x6e, 0x69,
+  0x6d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x49,
+  0x74, 0x27, 0x73, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x61, 0x6e, 0x20,
+  0x73, 0x65, 0x74, 0x74, 0x6c, 0x65, 0x72, 0x20, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x75, 0x6e, 0x69, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x68, 0x6f,
+  0x73, 0x74, 0x69, 0x6c, 0x65, 0x20, 0x61, 0x72, 0x65, 0x61, 0x73, 0x2c,
+  0x20, 0x77, 0x65, 0x6c, 0x6c, 0x20, 0x63, 0x61, 0x70, 0x61, 0x62, 0x6c,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x64, 0x65, 0x66, 0x65, 0x6e, 0x64, 0x69,
+  0x6e, 0x67, 0x20, 0x69, 0x74, 0x73, 0x65, 0x6c, 0x66, 0x2e, 0x03, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x8c, 0xbf, 0x76,
+  0x0b, 0x00, 0x80, 0x38, 0x10, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x20, 0x53,
+  0x61, 0x75, 0x63, 0x65, 0x72, 0x00, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x20,
+  0x53, 0x61, 0x75, 0x63, 0x65, 0x72, 0x00, 0x75, 0x2e, 0x6c, 0x69, 0x67,
+  0x68, 0x74, 0x5f, 0x73, 0x61, 0x75, 0x63, 0x65, 0x72, 0x00, 0x75, 0x2e,
+  0x66, 0x69, 0x67, 0x68, 0x74, 0x65, 0x72, 0x00, 0x6d, 0x5f, 0x66, 0x69,
+  0x67, 0x68, 0x74, 0x65, 0x72, 0x00, 0x66, 0x5f, 0x66, 0x69, 0x67, 0x68,
+  0x74, 0x65, 0x72, 0x00, 0x04, 0x00, 0x50, 0x04, 0x02, 0x00, 0x00, 0x00,
+  0x0c, 0x01, 0x00, 0x00, 0x00, 0x05, 0x07, 0x00, 0x01, 0x00, 0x00, 0x04,
+  0x14, 0x5f, 0x00, 0x00, 0x00, 0x4e, 0x6f, 0x62, 0x6f, 0x64, 0x79, 0x2c,
+  0x20, 0x62, 0x75, 0x74, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x41,
+  0x6e, 0x74, 0x69, 0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79, 0x20, 0x75,
+  0x6e, 0x69, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x48, 0x75, 0x6e,
+  0x74, 0x65, 0x72, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x61, 0x74, 0x74,
+  0x61, 0x63, 0x6b, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x75, 0x6e, 0x69,
+  0x74, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x75, 0x6e, 0x69, 0x74,
+  0x20, 0x69, 0x74, 0x73, 0x65, 0x6c, 0x66, 0x20, 0x63, 0x61, 0x6e, 0x20,
+  0x61, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72,
+  0x20, 0x41, 0x6e, 0x74, 0x69, 0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79,
+  0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x2e, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x8c, 0xbf, 0x74, 0x01, 0x00, 0x84,
+  0x18, 0x11, 0x42, 0x6f, 0x6d, 0x62, 0x20, 0x53, 0x61, 0x75, 0x63, 0x65,
+  0x72, 0x00, 0x42, 0x6f, 0x6d, 0x62, 0x20, 0x53, 0x61, 0x75, 0x63, 0x65,
+  0x72, 0x00, 0x75, 0x2e, 0x62, 0x6f, 0x6d, 0x62, 0x5f, 0x73, 0x61, 0x75,
+  0x63, 0x65, 0x72, 0x00, 0x75, 0x2e, 0x62, 0x6f, 0x6d, 0x62, 0x65, 0x72,
+  0x00, 0x6d, 0x5f, 0x62, 0x6f, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x66, 0x5f,
+  0x62, 0x6f, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x5a, 0x09, 0x03, 0x00,
+  0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x3e, 0x07, 0x00, 0x01, 0x00,
+  0x0a, 0x4f, 0x00, 0x00, 0x00, 0x4e, 0x6f, 0x62, 0x6f, 0x64, 0x79, 0x2c,
+  0x20, 0x62, 0x75, 0x74, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x41,
+  0x6e, 0x74, 0x69, 0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x48, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x20, 0x75,
+  0x6e, 0x69, 0x74, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x61, 0x74, 0x74,
+  0x61, 0x63, 0x6b, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x75, 0x6e, 0x69,
+  0x74, 0x2e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x96, 0x00, 0x8c, 0xbf, 0x76, 0x2b, 0x00, 0x04, 0x18,
+  0x12, 0x53, 0x70, 0x69, 0x74, 0x74, 0x65, 0x72, 0x00, 0x53, 0x70, 0x69,
+  0x74, 0x74, 0x65, 0x72, 0x00, 0x75, 0x2e, 0x73, 0x70, 0x69, 0x74, 0x74,
+  0x65, 0x72, 0x00, 0x75, 0x2e, 0x63, 0x61, 0x74, 0x61, 0x70, 0x75, 0x6c,
+  0x74, 0x00, 0x6d, 0x5f, 0x63, 0x61, 0x74, 0x61, 0x70, 0x75, 0x6c, 0x74,
+  0x00, 0x66, 0x5f, 0x63, 0x61, 0x74, 0x61, 0x70, 0x75, 0x6c, 0x74, 0x00,
+  0x01, 0x00, 0x0a, 0x03, 0x01, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x00, 0x34, 0x07, 0x00, 0x01, 0x00, 0x00, 0x02, 0x0a, 0x13, 0x05, 0x54,
+  0x68, 0x69, 0x73, 0x20, 0x61, 0x6c, 0x69, 0x65, 0x6e, 0x20, 0x6c, 0x69,
+  0x66, 0x65, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x73, 0x20, 0x66, 0x69,
+  0x72, 0x73, 0x74, 0x20, 0x62, 0x6f, 0x6d, 0x62, 0x61, 0x72, 0x64, 0x69,
+  0x6e, 0x67, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x2e, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x8c,
+  0xbf, 0x34, 0x2d, 0x00, 0x44, 0x18, 0x13, 0x48, 0x65, 0x61, 0x76, 0x79,
+  0x20, 0x53, 0x70, 0x69, 0x74, 0x74, 0x65, 0x72, 0x00, 0x48, 0x65, 0x61,
+  0x76, 0x79, 0x20, 0x53, 0x70, 0x69, 0x74, 0x74, 0x65, 0x72, 0x00, 0x75,
+  0x2e, 0x68, 0x65, 0x61, 0x76, 0x79, 0x5f, 0x73, 0x70, 0x69, 0x74, 0x74,
+  0x65, 0x72, 0x00, 0x75, 0x2e, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x6e, 0x00,
+  0x6d, 0x5f, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x6e, 0x00, 0x66, 0x5f, 0x63,
+  0x61, 0x6e, 0x6e, 0x6f, 0x6e, 0x00, 0x00, 0x14, 0x05, 0x02, 0x01, 0x00,
+  0x00, 0x00, 0x25, 0x07, 0x00, 0x01, 0x00, 0x03, 0x14, 0x21, 0x0a, 0x40,
+  0x00, 0x00, 0x00, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x6d, 0x70, 0x72,
+  0x6f, 0x76, 0x65, 0x64, 0x20, 0x73, 0x70, 0x69, 0x74, 0x74, 0x65, 0x72,
+  0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x6d, 0x61,
+  0x6b, 0x65, 0x20, 0x62, 0x6f, 0x6d, 0x62, 0x61, 0x72, 0x64, 0x20, 0x61,
+  0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x6d, 0x69,
+  0x73, 0x73, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20,
+  0x74, 0x6f, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x73, 0x2e, 0x03,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe2, 0x00, 0x8c, 0xbf, 0x10, 0x05, 0x00, 0x44, 0x18, 0x14, 0x42, 0x69,
+  0x6f, 0x6d, 0x61, 0x73, 0x73, 0x00, 0x42, 0x69, 0x6f, 0x6d, 0x61, 0x73,
+  0x73, 0x00, 0x75, 0x2e, 0x62, 0x69, 0x6f, 0x6d, 0x61, 0x73, 0x73, 0x00,
+  0x75, 0x2e, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x00,
+  0x6d, 0x5f, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x00,
+  0x66, 0x5f, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x4a, 0x75, 0x73, 0x74, 0x20, 0x6c, 0x65, 0x74,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x6f, 0x6d, 0x61, 0x73, 0x73,
+  0x20, 0x74, 0x6f, 0x20, 0x65, 0x6e, 0x67, 0x75, 0x6c, 0x66, 0x20, 0x79,
+  0x6f, 0x75, 0x72, 0x20, 0x74, 0x61, 0x6e, 0x6b, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x70, 0x69, 0x63, 0x6b, 0x20, 0x69, 0x74, 0x20, 0x75, 0x70, 0x2c,
+  0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x65, 0x6e, 0x6a, 0x6f, 0x79, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x72, 0x69, 0x64, 0x65, 0x20, 0x69, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x72, 0x61, 0x64, 0x69, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x2d, 0x73, 0x61, 0x66, 0x65, 0x20, 0x69, 0x6e, 0x73, 0x69, 0x64,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6c, 0x69,
+  0x6d, 0x79, 0x20, 0x62, 0x65, 0x69, 0x6e, 0x67, 0x2e, 0x03, 0x00, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x00,
+  0x8c, 0xbf, 0xe2, 0x2d, 0x04, 0x40, 0x38, 0x15, 0x45, 0x78, 0x70, 0x6c,
+  0x6f, 0x72, 0x65, 0x72, 0x00, 0x45, 0x78, 0x70, 0x6c, 0x6f, 0x72, 0x65,
+  0x72, 0x00, 0x75, 0x2e, 0x65, 0x78, 0x70, 0x6c, 0x6f, 0x72, 0x65, 0x72,
+  0x00, 0x2d, 0x00, 0x6d, 0x5f, 0x65, 0x78, 0x70, 0x6c, 0x6f, 0x72, 0x65,
+  0x72, 0x00, 0x66, 0x5f, 0x65, 0x78, 0x70, 0x6c, 0x6f, 0x72, 0x65, 0x72,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0a, 0x16, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x69, 0x6b,
+  0x65, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x45, 0x61, 0x72, 0x74, 0x68, 0x6c,
+  0x79, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x45, 0x78, 0x70,
+  0x6c, 0x6f, 0x72, 0x65, 0x72, 0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 0x6e,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x65, 0x6e, 0x74, 0x65,
+  0x72, 0x20, 0x72, 0x61, 0x64, 0x69, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x20,
+  0x74, 0x69, 0x6c, 0x65, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20,
+  0x63, 0x61, 0x6e, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x61, 0x69, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x6d, 0x73, 0x65, 0x6c, 0x76, 0x65, 0x73, 0x2c,
+  0x20, 0x6e, 0x6f, 0x20, 0x75, 0x70, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x63,
+  0x6f, 0x73, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x68, 0x6f, 0x6d, 0x65, 0x63,
+  0x69, 0x74, 0x79, 0x2e, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xa9, 0x00, 0x8c, 0xbf, 0x86, 0x21, 0x00, 0x00, 0x28, 0x16, 0x53,
+  0x63, 0x6f, 0x75, 0x74, 0x20, 0x41, 0x6e, 0x69, 0x6d, 0x61, 0x6c, 0x00,
+  0x53, 0x63, 0x6f, 0x75, 0x74, 0x20, 0x41, 0x6e, 0x69, 0x6d, 0x61, 0x6c,
+  0x00, 0x75, 0x2e, 0x73, 0x63, 0x6f, 0x75, 0x74, 0x5f, 0x61, 0x6e, 0x69,
+  0x6d, 0x61, 0x6c, 0x00, 0x75, 0x2e, 0x77, 0x61, 0x72, 0x72, 0x69, 0x6f,
+  0x72, 0x73, 0x00, 0x6d, 0x5f, 0x77, 0x61, 0x72, 0x72, 0x69, 0x6f, 0x72,
+  0x73, 0x00, 0x66, 0x5f, 0x77, 0x61, 0x72, 0x72, 0x69, 0x6f, 0x72, 0x73,
+  0x00, 0x01, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00,
+  0x01, 0x00, 0x21, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x6e,
+  0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x73, 0x63, 0x6f, 0x75, 0x74, 0x20,
+  0x61, 0x6e, 0x69, 0x6d, 0x61, 0x6c, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+  0x63, 0x61, 0x6e, 0x20, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x61, 0x6e,
+  0x79, 0x20, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x65, 0x72, 0x72, 0x61,
+  0x69, 0x6e, 0x2e, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x94, 0x00, 0x8c, 0xbf, 0x86, 0x05, 0x00, 0x40, 0x38, 0x17,
+  0x52, 0x61, 0x66, 0x74, 0x00, 0x52, 0x61, 0x66, 0x74, 0x00, 0x75, 0x2e,
+  0x72, 0x61, 0x66, 0x74, 0x00, 0x75, 0x2e, 0x74, 0x72, 0x69, 0x72, 0x65,
+  0x6d, 0x65, 0x00, 0x6d, 0x5f, 0x74, 0x72, 0x69, 0x72, 0x65, 0x6d, 0x65,
+  0x00, 0x66, 0x5f, 0x74, 0x72, 0x69, 0x72, 0x65, 0x6d, 0x65, 0x00, 0x02,
+  0x00, 0x14, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x20, 0x20, 0x54, 0x68,
+  0x69, 0x73, 0x20, 0x76, 0x65, 0x73, 0x73, 0x65, 0x6c, 0x20, 0x61, 0x6c,
+  0x6e, 0x67, 0x25, 0x73, 0x00, 0x26, 0x00, 0x1e, 0x00, 0xf6, 0x0b, 0x00,
+  0x3c, 0x25, 0x73, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d,
+  0x20, 0x54, 0x65, 0x72, 0x72, 0x61, 0x69, 0x6e, 0x25, 0x73, 0x00, 0x24,
+  0x00, 0x18, 0x00, 0xf6, 0x0b, 0x01, 0x3d, 0x42, 0x75, 0x69, 0x6c, 0x64,
+  0x20, 0x25, 0x73, 0x52, 0x6f, 0x61, 0x64, 0x25, 0x73, 0x00, 0x29, 0x04,
+  0x00, 0x1d, 0x00, 0xf6, 0x0b, 0x00, 0x3e, 0x42, 0x75, 0x69, 0x6c, 0x64,
+  0x20, 0x25, 0x73, 0x49, 0x72, 0x72, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x25, 0x73, 0x00, 0x2d, 0x00, 0x17, 0x00, 0xf6, 0x0b, 0x00, 0x3f,
+  0x42, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x25, 0x73, 0x4d, 0x69, 0x6e, 0x65,
+  0x25, 0x73, 0x00, 0x2c, 0x00, 0x17, 0x00, 0xf6, 0x0b, 0x00, 0x40, 0x25,
+  0x73, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x42, 0x61, 0x73, 0x65, 0x25,
+  0x73, 0x00, 0x2b, 0x00, 0x15, 0x00, 0xf6, 0x0b, 0x01, 0x41, 0x50, 0x69,
+  0x6c, 0x6c, 0x61, 0x25, 0x73, 0x67, 0x65, 0x25, 0x73, 0x00, 0x27, 0x03,
+  0x00, 0x1c, 0x00, 0xf6, 0x0b, 0x00, 0x42, 0x43, 0x6c, 0x65, 0x61, 0x6e,
+  0x20, 0x25, 0x73, 0x50, 0x6f, 0x6c, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e,
+  0x25, 0x73, 0x00, 0x2e, 0x00, 0x1a, 0x00, 0xf6, 0x0b, 0x00, 0x43, 0x43,
+  0x6c, 0x65, 0x61, 0x6e, 0x20, 0x25, 0x73, 0x46, 0x61, 0x6c, 0x6c, 0x6f,
+  0x75, 0x74, 0x25, 0x73, 0x00, 0x2f, 0x00, 0x14, 0x00, 0xf6, 0x8b, 0x01,
+  0x44, 0x25, 0x73, 0x42, 0x6f, 0x61, 0x72, 0x64, 0x25, 0x73, 0x00, 0x33,
+  0x01, 0x00, 0x00, 0x07, 0x00, 0xf6, 0x01, 0x00, 0x45, 0x00, 0x07, 0x00,
+  0xf6, 0x01, 0x00, 0x46, 0x00, 0x14, 0x00, 0xf6, 0x0b, 0x00, 0x47, 0x25,
+  0x73, 0x44, 0x65, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x25, 0x73, 0x00, 0x30,
+  0x00, 0x1b, 0x00, 0xf6, 0x0b, 0x06, 0x48, 0x25, 0x73, 0x45, 0x6d, 0x62,
+  0x61, 0x72, 0x6b, 0x25, 0x73, 0x00, 0x34, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0xf6, 0x01, 0x00, 0x49, 0x00, 0x07,
+  0x00, 0xf6, 0x01, 0x00, 0x4a, 0x00, 0x07, 0x00, 0xf6, 0x01, 0x00, 0x4b,
+  0x00, 0x26, 0x00, 0xf6, 0x8b, 0x08, 0x4c, 0x25, 0x73, 0x44, 0x69, 0x73,
+  0x65, 0x6d, 0x62, 0x61, 0x72, 0x6b, 0x25, 0x73, 0x00, 0x32, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x03,
+  0x00, 0x00, 0x00, 0x25, 0x00, 0xf6, 0x07, 0x00, 0x4d, 0x25, 0x73, 0x44,
+  0x69, 0x73, 0x65, 0x6d, 0x62, 0x61, 0x72, 0x6b, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x20, 0x6e, 0x6f, 0x6e, 0x20, 0x6e, 0x61, 0x74, 0x69, 0x76, 0x65,
+  0x25, 0x73, 0x00, 0x00, 0x15, 0x00, 0xf6, 0x03, 0x00, 0x4e, 0x25, 0x73,
+  0x44, 0x69, 0x73, 0x65, 0x6d, 0x62, 0x61, 0x72, 0x6b, 0x25, 0x73, 0x00,
+  0x00, 0x07, 0x00, 0xf6, 0x01, 0x00, 0x4f, 0x00, 0x29, 0x00, 0xf6, 0x8b,
+  0x0e, 0x50, 0x25, 0x73, 0x4c, 0x6f, 0x61, 0x64, 0x25, 0x73, 0x00, 0x3f,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0xf6, 0x01, 0x00, 0x51, 0x00, 0x07, 0x00, 0xf6, 0x01,
+  0x00, 0x52, 0x00, 0x13, 0x00, 0xf6, 0x0b, 0x00, 0x53, 0x25, 0x73, 0x55,
+  0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x25, 0x73, 0x00, 0x31, 0x00, 0x1f, 0x00,
+  0xf6, 0x8b, 0x04, 0x54, 0x53, 0x70, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25,
+  0x73, 0x50, 0x6c, 0x61, 0x67, 0x75, 0x65, 0x25, 0x73, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x24, 0x00, 0xf6, 0x8b, 0x02, 0x55, 0x25,
+  0x73, 0x45, 0x6c, 0x69, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x20, 0x44,
+  0x69, 0x70, 0x6c, 0x6f, 0x6d, 0x61, 0x74, 0x25, 0x73, 0x00, 0x36, 0x02,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x2b, 0x00, 0xf6, 0x8b, 0x08, 0x56, 0x25,
+  0x73, 0x43, 0x6f, 0x6e, 0x71, 0x75, 0x65, 0x72, 0x20, 0x45, 0x78, 0x74,
+  0x72, 0x61, 0x73, 0x25, 0x73, 0x00, 0x37, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0xf6, 0x03, 0x00, 0x57, 0x25, 0x73, 0x43, 0x6f, 0x6e, 0x71,
+  0x75, 0x65, 0x72, 0x20, 0x45, 0x78, 0x74, 0x72, 0x61, 0x73, 0x20, 0x32,
+  0x25, 0x73, 0x00, 0x00, 0x1a, 0x00, 0xf6, 0x03, 0x00, 0x58, 0x25, 0x73,
+  0x43, 0x6f, 0x6e, 0x71, 0x75, 0x65, 0x72, 0x20, 0x45, 0x78, 0x74, 0x72,
+  0x61, 0x73, 0x25, 0x73, 0x00, 0x00, 0x07, 0x00, 0xf6, 0x01, 0x00, 0x59,
+  0x00, 0x27, 0x00, 0xf6, 0x9b, 0x08, 0x5a, 0x45, 0x6e, 0x74, 0x65, 0x72,
+  0x20, 0x25, 0x73, 0x48, 0x75, 0x74, 0x25, 0x73, 0x00, 0x38, 0x01, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0xf6, 0x07, 0x00, 0x5b, 0x45, 0x6e,
+  0x74, 0x65, 0x72, 0x20, 0x25, 0x73, 0x48, 0x75, 0x74, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x20, 0x6e, 0x6f, 0x6e, 0x20, 0x6e, 0x61, 0x74, 0x69, 0x76,
+  0x65, 0x25, 0x73, 0x00, 0x00, 0x15, 0x00, 0xf6, 0x03, 0x00, 0x5c, 0x45,
+  0x6e, 0x74, 0x65, 0x72, 0x20, 0x25, 0x73, 0x48, 0x75, 0x74, 0x25, 0x73,
+  0x00, 0x00, 0x07, 0x00, 0xf6, 0x01, 0x00, 0x5d, 0x00, 0x1a, 0x00, 0xf6,
+  0x1b, 0x00, 0x5e, 0x46, 0x72, 0x69, 0x67, 0x68, 0x74, 0x65, 0x6e, 0x20,
+  0x25, 0x73, 0x48, 0x75, 0x74, 0x25, 0x73, 0x00, 0x39, 0x02, 0x00, 0x07,
+  0x00, 0xf6, 0x01, 0x00, 0x5f, 0x00, 0x07, 0x00, 0xf6, 0x01, 0x00, 0x60,
+  0x00, 0x07, 0x00, 0xf6, 0x01, 0x00, 0x61, 0x00, 0x1c, 0x00, 0xf6, 0x9b,
+  0x02, 0x62, 0x48, 0x65, 0x61, 0x6c, 0x20, 0x25, 0x73, 0x55, 0x6e, 0x69,
+  0x74, 0x25, 0x73, 0x00, 0x23, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0xf6, 0x01, 0x00, 0x63, 0x00, 0x26, 0x00, 0xf6, 0x8b, 0x06,
+  0x64, 0x44, 0x72, 0x6f, 0x70, 0x20, 0x25, 0x73, 0x50, 0x61, 0x72, 0x61,
+  0x74, 0x72, 0x6f, 0x6f, 0x70, 0x65, 0x72, 0x25, 0x73, 0x00, 0x1d, 0x03,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xf4, 0x11, 0x00, 0x08, 0x00, 0xf6,
+  0x09, 0x00, 0x65, 0x3b, 0x00, 0x09, 0x00, 0xf6, 0x19, 0x00, 0x66, 0x1d,
+  0x02, 0x00, 0x08, 0x00, 0xf6, 0x09, 0x00, 0x67, 0x3b, 0x00, 0x09, 0x00,
+  0xf6, 0x19, 0x00, 0x68, 0x1d, 0x01, 0x00, 0x2a, 0x00, 0xf6, 0x0b, 0x00,
+  0x69, 0x25, 0x73, 0x50, 0x61, 0x72, 0x61, 0x64, 0x72, 0x6f, 0x70, 0x20,
+  0x74, 0x6f, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x73, 0x74, 0x65, 0x64,
+  0x20, 0x4c, 0x61, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x25, 0x73, 0x00, 0x3b,
+  0x00, 0x1d, 0x00, 0xf6, 0x9b, 0x04, 0x6a, 0x25, 0x73, 0x57, 0x69, 0x70,
+  0x65, 0x20, 0x55, 0x6e, 0x69, 0x74, 0x73, 0x25, 0x73, 0x00, 0x3d, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x28, 0x00, 0xf6, 0x8b, 0x02, 0x6b,
+  0x25, 0x73, 0x45, 0x73, 0x63, 0x61, 0x70, 0x65, 0x20, 0x54, 0x6f, 0x20,
+  0x4e, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x20, 0x43, 0x69, 0x74, 0x79,
+  0x25, 0x73, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00,
+  0xf6, 0x8f, 0x0a, 0x6c, 0x25, 0x73, 0x4b, 0x65, 0x65, 0x70, 0x20, 0x6d,
+  0x6f, 0x76, 0x69, 0x6e, 0x67, 0x25, 0x73, 0x00, 0x3a, 0x03, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+  0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0xf6, 0x03, 0x08, 0x6d,
+  0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x20, 0x25, 0x73, 0x4d, 0x6f,
+  0x76, 0x65, 0x25, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xf6,
+  0x01, 0x00, 0x6e, 0x00, 0x1b, 0x00, 0xf6, 0x0b, 0x07, 0x6f, 0x25, 0x73,
+  0x43, 0x6c, 0x65, 0x61, 0x6e, 0x25, 0x73, 0x00, 0x40, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xf6, 0x8b, 0x05,
+  0x70, 0x25, 0x73, 0x55, 0x73, 0x65, 0x72, 0x20, 0x41, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x31, 0x25, 0x73, 0x00, 0x41, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x19, 0x00, 0xf6, 0x03, 0x00, 0x71, 0x25, 0x73, 0x55,
+  0x73, 0x65, 0x72, 0x20, 0x41, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x32,
+  0x25, 0x73, 0x00, 0x00, 0x19, 0x00, 0xf6, 0x03, 0x00, 0x72, 0x25, 0x73,
+  0x55, 0x73, 0x65, 0x72, 0x20, 0x41, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x33, 0x25, 0x73, 0x00, 0x00, 0x19, 0x00, 0xf6, 0x03, 0x00, 0x73, 0x25,
+  0x73, 0x55, 0x73, 0x65, 0x72, 0x20, 0x41, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x34, 0x25, 0x73, 0x00, 0x00, 0x2b, 0x00, 0xeb, 0x07, 0x03, 0x04,
+  0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x1d, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x2a, 0x00, 0xeb, 0x05, 0x08, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x1e, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x34, 0x00, 0xeb, 0x1d, 0x0e,
+  0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x1d, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00,
+  0x01, 0x22, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x50,
+  0x00, 0xeb, 0x1f, 0x12, 0x06, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x02,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0xeb, 0x1f, 0x14,
+  0x02, 0x07, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x01, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0xeb,
+  0x01, 0x15, 0x00, 0x22, 0x00, 0xeb, 0x1d, 0x16, 0x07, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x50, 0x00, 0xeb, 0x1f, 0x17, 0x06, 0x07, 0x00, 0x00, 0x00, 0x08,
+  0x00, 0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01,
+  0x00, 0x02, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x47, 0x00, 0xeb,
+  0x1f, 0x18, 0x04, 0x07, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x01, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x1e, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x01, 0x00, 0x03, 0x07, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x01,
+  0x00, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0xeb, 0x1f,
+  0x1b, 0x03, 0x07, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x01, 0x00, 0x1d,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x11, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x3c, 0x00, 0xeb, 0x16, 0x04, 0x07, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x00, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x19, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x2b, 0x00, 0xeb, 0x1d, 0x26, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xeb, 0x07,
+  0x27, 0x00, 0x00, 0x19, 0x00, 0xeb, 0x07, 0x28, 0x02, 0x1d, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xeb, 0x07, 0x2a, 0x01, 0x19, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0xeb, 0x07,
+  0x2c, 0x04, 0x09, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x1d,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0x34, 0x00, 0xeb, 0x07, 0x2d, 0x05, 0x07, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x19, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x32, 0x00, 0xeb, 0x04, 0x07,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c,
+  0x65, 0x3a, 0x43, 0x6f, 0x75, 0x6e, 0x63, 0x69, 0x6c, 0x6c, 0x6f, 0x72,
+  0x20, 0x25, 0x73, 0x00, 0x00, 0x33, 0x00, 0x8f, 0x0e, 0x02, 0x29, 0x43,
+  0x68, 0x69, 0x65, 0x66, 0x20, 0x4d, 0x69, 0x6e, 0x69, 0x73, 0x74, 0x65,
+  0x72, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65,
+  0x3a, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x4d, 0x69, 0x6e, 0x69, 0x73,
+  0x74, 0x65, 0x72, 0x20, 0x25, 0x73, 0x00, 0x00, 0x35, 0x00, 0x8f, 0x0e,
+  0x01, 0x6a, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x20,
+  0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65,
+  0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70,
+  0x61, 0x6c, 0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00,
+  0x00, 0x2b, 0x00, 0x8f, 0x0e, 0x01, 0x6b, 0x43, 0x68, 0x61, 0x6e, 0x63,
+  0x65, 0x6c, 0x6c, 0x6f, 0x72, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65,
+  0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x43, 0x68, 0x61, 0x6e, 0x63, 0x65, 0x6c,
+  0x6c, 0x6f, 0x72, 0x20, 0x25, 0x73, 0x00, 0x00, 0x35, 0x00, 0x8f, 0x0e,
+  0x01, 0x6c, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x20,
+  0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65,
+  0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70,
+  0x61, 0x6c, 0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00,
+  0x00, 0x07, 0x00, 0x8f, 0x02, 0x02, 0x2d, 0x00, 0x2b, 0x00, 0x8f, 0x0e,
+  0x00, 0xac, 0x43, 0x68, 0x61, 0x6e, 0x63, 0x65, 0x6c, 0x6c, 0x6f, 0x72,
+  0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a,
+  0x43, 0x68, 0x61, 0x6e, 0x63, 0x65, 0x6c, 0x6c, 0x6f, 0x72, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x3b, 0x00, 0x8f, 0x0e, 0x01, 0x6d, 0x4d, 0x69, 0x6e,
+  0x69, 0x73, 0x74, 0x65, 0x72, 0x2d, 0x50, 0x72, 0x65, 0x73, 0x69, 0x64,
+  0x65, 0x6e, 0x74, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61,
+  0x6c, 0x65, 0x3a, 0x4d, 0x69, 0x6e, 0x69, 0x73, 0x74, 0x65, 0x72, 0x2d,
+  0x50, 0x72, 0x65, 0x73, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x20, 0x25, 0x73,
+  0x00, 0x00, 0x1e, 0x00, 0x8f, 0x0e, 0x00, 0xad, 0x50, 0x72, 0x65, 0x6d,
+  0x69, 0x65, 0x72, 0x20, 0x25, 0x73, 0x00, 0x50, 0x72, 0x65, 0x6d, 0x69,
+  0x65, 0x72, 0x65, 0x20, 0x25, 0x73, 0x00, 0x00, 0x2f, 0x00, 0x8f, 0x0e,
+  0x00, 0xae, 0x43, 0x6f, 0x6d, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e,
+  0x65, 0x72, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c,
+  0x65, 0x3a, 0x43, 0x6f, 0x6d, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e,
+  0x65, 0x72, 0x20, 0x25, 0x73, 0x00, 0x00, 0x33, 0x00, 0x8f, 0x0e, 0x02,
+  0x30, 0x50, 0x72, 0x69, 0x6d, 0x65, 0x20, 0x4d, 0x69, 0x6e, 0x69, 0x73,
+  0x74, 0x65, 0x72, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61,
+  0x6c, 0x65, 0x3a, 0x50, 0x72, 0x69, 0x6d, 0x65, 0x20, 0x4d, 0x69, 0x6e,
+  0x69, 0x73, 0x74, 0x65, 0x72, 0x20, 0x25, 0x73, 0x00, 0x00, 0x29, 0x00,
+  0x8f, 0x0e, 0x00, 0xb2, 0x54, 0x61, 0x6f, 0x69, 0x73, 0x65, 0x61, 0x63,
+  0x68, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65,
+  0x3a, 0x54, 0x61, 0x6f, 0x69, 0x73, 0x65, 0x61, 0x63, 0x68, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x3b, 0x00, 0x8f, 0x0e, 0x01, 0x77, 0x4d, 0x69, 0x6e,
+  0x69, 0x73, 0x74, 0x65, 0x72, 0x2d, 0x50, 0x72, 0x65, 0x73, 0x69, 0x64,
+  0x65, 0x6e, 0x74, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61,
+  0x6c, 0x65, 0x3a, 0x4d, 0x69, 0x6e, 0x69, 0x73, 0x74, 0x65, 0x72, 0x2d,
+  0x50, 0x72, 0x65, 0x73, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x20, 0x25, 0x73,
+  0x00, 0x00, 0x25, 0x00, 0x8f, 0x0e, 0x00, 0xb8, 0x53, 0x70, 0x65, 0x61,
+  0x6b, 0x65, 0x72, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61,
+  0x6c, 0x65, 0x3a, 0x53, 0x70, 0x65, 0x61, 0x6b, 0x65, 0x72, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x2b, 0x00, 0x8f, 0x0e, 0x00, 0xb9, 0x43, 0x68, 0x61,
+  0x6e, 0x63, 0x65, 0x6c, 0x6c, 0x6f, 0x72, 0x20, 0x25, 0x73, 0x00, 0x3f,
+  0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x43, 0x68, 0x61, 0x6e, 0x63,
+  0x65, 0x6c, 0x6c, 0x6f, 0x72, 0x20, 0x25, 0x73, 0x00, 0x00, 0x3b, 0x00,
+  0x8f, 0x0e, 0x00, 0xba, 0x4d, 0x69, 0x6e, 0x69, 0x73, 0x74, 0x65, 0x72,
+  0x2d, 0x50, 0x72, 0x65, 0x73, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x20, 0x25,
+  0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x4d, 0x69,
+  0x6e, 0x69, 0x73, 0x74, 0x65, 0x72, 0x2d, 0x50, 0x72, 0x65, 0x73, 0x69,
+  0x64, 0x65, 0x6e, 0x74, 0x20, 0x25, 0x73, 0x00, 0x02, 0x54, 0x00, 0x91,
+  0xbd, 0x06, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x07, 0x00, 0x01, 0x00, 0x46,
+  0x75, 0x6e, 0x64, 0x61, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x6c, 0x69, 0x73,
+  0x6d, 0x00, 0x46, 0x75, 0x6e, 0x64, 0x61, 0x6d, 0x65, 0x6e, 0x74, 0x61,
+  0x6c, 0x69, 0x73, 0x6d, 0x00, 0x67, 0x6f, 0x76, 0x2e, 0x66, 0x75, 0x6e,
+  0x64, 0x61, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x6c, 0x69, 0x73, 0x6d, 0x00,
+  0x46, 0x75, 0x6e, 0x64, 0x61, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x6c, 0x69,
+  0x73, 0x6d, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x20, 0x6f, 0x66, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x6f, 0x72, 0x67, 0x61, 0x6e, 0x69, 0x7a, 0x65, 0x64,
+  0x20, 0x61, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x61, 0x20, 0x63, 0x65,
+  0x6e, 0x74, 0x72, 0x61, 0x6c, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x62, 0x65, 0x6c, 0x69, 0x65, 0x66, 0x73, 0x2e, 0x20, 0x54, 0x68,
+  0x65, 0x20, 0x62, 0x65, 0x6c, 0x69, 0x65, 0x66, 0x73, 0x2c, 0x20, 0x75,
+  0x73, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x72, 0x65, 0x6c, 0x69, 0x67,
+  0x69, 0x6f, 0x75, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x6e, 0x61, 0x74, 0x75,
+  0x72, 0x65, 0x2c, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x61, 0x20, 0x72,
+  0x69, 0x67, 0x69, 0x64, 0x20, 0x67, 0x75, 0x69, 0x64, 0x65, 0x6c, 0x69,
+  0x6e, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x61, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x6f, 0x74, 0x68,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x72, 0x73, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x65, 0x6f, 0x70,
+  0x6c, 0x65, 0x2e, 0x03, 0x49, 0x6e, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6e,
+  0x64, 0x61, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x6c, 0x69, 0x73, 0x74, 0x20,
+  0x73, 0x6f, 0x63, 0x69, 0x65, 0x74, 0x79, 0x2c, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x72, 0x73, 0x20, 0x61,
+  0x72, 0x65, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x72, 0x65, 0x6c, 0x79, 0x20,
+  0x64, 0x65, 0x76, 0x6f, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74,
+  0x68, 0x65, 0x69, 0x72, 0x20, 0x62, 0x65, 0x6c, 0x69, 0x65, 0x66, 0x73,
+  0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 0x73,
+  0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x69, 0x6e,
+  0x67, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x69, 0x65, 0x20, 0x74, 0x6f, 0x20,
+  0x70, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65,
+  0x6d, 0x2e, 0x03, 0x49, 0x6d, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6e, 0x6f, 0x72,
+  0x6d, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72,
+  0x74, 0x20, 0x75, 0x6e, 0x68, 0x61, 0x70, 0x70, 0x79, 0x20, 0x63, 0x69,
+  0x74, 0x69, 0x7a, 0x65, 0x6e, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f,
+  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x63, 0x69, 0x74, 0x69, 0x7a, 0x65,
+  0x6e, 0x73, 0x2c, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x65, 0x20,
+  0x60, 0x74, 0x69, 0x74, 0x68, 0x65, 0x73, 0x27, 0x20, 0x28, 0x67, 0x6f,
+  0x6c, 0x64, 0x29, 0x20, 0x65, 0x71, 0x75, 0x69, 0x76, 0x61, 0x6c, 0x65,
+  0x6e, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x75,
+  0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x65, 0x6f, 0x70,
+  0x6c, 0x65, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x77, 0x6f, 0x75, 0x6c,
+  0x64, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x2c, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x20, 0x6e,
+  0x6f, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x65, 0x6e, 0x61, 0x6e, 0x63,
+  0x65, 0x2e, 0x03, 0x00, 0x00, 0x19, 0x00, 0x8f, 0x0f, 0x06, 0x00, 0x00,
+  0x49, 0x6d, 0x61, 0x6d, 0x20, 0x25, 0x73, 0x00, 0x49, 0x6d, 0x61, 0x6d,
+  0x61, 0x20, 0x25, 0x73, 0x00, 0x00, 0x21, 0x00, 0x8f, 0x0e, 0x00, 0x01,
+  0x45, 0x6c, 0x64, 0x65, 0x72, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65,
+  0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x45, 0x6c, 0x64, 0x65, 0x72, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x21, 0x00, 0x8f, 0x0e, 0x00, 0x02, 0x50, 0x61, 0x74,
+  0x72, 0x69, 0x61, 0x72, 0x63, 0x68, 0x20, 0x25, 0x73, 0x00, 0x4d, 0x61,
+  0x74, 0x72, 0x69, 0x61, 0x72, 0x63, 0x68, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x23, 0x00, 0x8f, 0x0e, 0x00, 0x03, 0x41, 0x62, 0x62, 0x6f, 0x74, 0x20,
+  0x25, 0x73, 0x00, 0x4d, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x53, 0x75,
+  0x70, 0x65, 0x72, 0x69, 0x6f, 0x72, 0x20, 0x25, 0x73, 0x00, 0x00, 0x18,
+  0x00, 0x8f, 0x0e, 0x00, 0x04, 0x49, 0x6d, 0x61, 0x6d, 0x20, 0x25, 0x73,
+  0x00, 0x49, 0x6d, 0x61, 0x6d, 0x61, 0x20, 0x25, 0x73, 0x00, 0x00, 0x19,
+  0x00, 0x8f, 0x0e, 0x00, 0x05, 0x50, 0x61, 0x64, 0x72, 0x65, 0x20, 0x25,
+  0x73, 0x00, 0x4d, 0x61, 0x64, 0x72, 0x65, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x23, 0x00, 0x8f, 0x0e, 0x00, 0x06, 0x4d, 0x75, 0x6c, 0x6c, 0x61, 0x68,
+  0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a,
+  0x4d, 0x75, 0x6c, 0x6c, 0x61, 0x68, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1c,
+  0x00, 0x8f, 0x0e, 0x00, 0x0a, 0x43, 0x61, 0x6c, 0x69, 0x70, 0x68, 0x20,
+  0x25, 0x73, 0x00, 0x43, 0x61, 0x6c, 0x69, 0x70, 0x68, 0x61, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x21, 0x00, 0x8f, 0x0e, 0x00, 0x0b, 0x56, 0x69, 0x63,
+  0x61, 0x72, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c,
+  0x65, 0x3a, 0x56, 0x69, 0x63, 0x61, 0x72, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x23, 0x00, 0x8f, 0x0e, 0x00, 0x0d, 0x53, 0x68, 0x61, 0x6d, 0x61, 0x6e,
+  0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a,
+  0x53, 0x68, 0x61, 0x6d, 0x61, 0x6e, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1c,
+  0x00, 0x8f, 0x0e, 0x00, 0x0e, 0x43, 0x61, 0x6c, 0x69, 0x70, 0x68, 0x20,
+  0x25, 0x73, 0x00, 0x43, 0x61, 0x6c, 0x69, 0x70, 0x68, 0x61, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x23, 0x00, 0x8f, 0x0e, 0x00, 0x0f, 0x42, 0x69, 0x73,
+  0x68, 0x6f, 0x70, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61,
+  0x6c, 0x65, 0x3a, 0x42, 0x69, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x25, 0x73,
+  0x00, 0x00, 0x1c, 0x00, 0x8f, 0x0e, 0x00, 0x10, 0x43, 0x61, 0x6c, 0x69,
+  0x70, 0x68, 0x20, 0x25, 0x73, 0x00, 0x43, 0x61, 0x6c, 0x69, 0x70, 0x68,
+  0x61, 0x20, 0x25, 0x73, 0x00, 0x00, 0x27, 0x00, 0x8f, 0x0e, 0x00, 0x12,
+  0x52, 0x65, 0x76, 0x65, 0x72, 0x65, 0x6e, 0x64, 0x20, 0x25, 0x73, 0x00,
+  0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x52, 0x65, 0x76, 0x65,
+  0x72, 0x65, 0x6e, 0x64, 0x20, 0x25, 0x73, 0x00, 0x00, 0x23, 0x00, 0x8f,
+  0x0e, 0x00, 0x13, 0x42, 0x69, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x25, 0x73,
+  0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x42, 0x69, 0x73,
+  0x68, 0x6f, 0x70, 0x20, 0x25, 0x73, 0x00, 0x00, 0x07, 0x00, 0x8f, 0x02,
+  0x00, 0x15, 0x00, 0x2f, 0x00, 0x8f, 0x0e, 0x00, 0x16, 0x47, 0x72, 0x65,
+  0x61, 0x74, 0x20, 0x53, 0x68, 0x61, 0x6d, 0x61, 0x6e, 0x20, 0x25, 0x73,
+  0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x47, 0x72, 0x65,
+  0x61, 0x74, 0x20, 0x53, 0x68, 0x61, 0x6d, 0x61, 0x6e, 0x20, 0x25, 0x73,
+  0x00, 0x00, 0x23, 0x00, 0x8f, 0x0e, 0x00, 0x18, 0x42, 0x69, 0x73, 0x68,
+  0x6f, 0x70, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c,
+  0x65, 0x3a, 0x42, 0x69, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x25, 0x73, 0x00,
+  0x00, 0x2f, 0x00, 0x8f, 0x0e, 0x00, 0x1a, 0x47, 0x72, 0x65, 0x61, 0x74,
+  0x20, 0x53, 0x68, 0x61, 0x6d, 0x61, 0x6e, 0x20, 0x25, 0x73, 0x00, 0x3f,
+  0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x47, 0x72, 0x65, 0x61, 0x74,
+  0x20, 0x53, 0x68, 0x61, 0x6d, 0x61, 0x6e, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x1c, 0x00, 0x8f, 0x0e, 0x00, 0x1b, 0x43, 0x61, 0x6c, 0x69, 0x70, 0x68,
+  0x20, 0x25, 0x73, 0x00, 0x43, 0x61, 0x6c, 0x69, 0x70, 0x68, 0x61, 0x20,
+  0x25, 0x73, 0x00, 0x00, 0x24, 0x00, 0x8f, 0x0e, 0x00, 0x1c, 0x42, 0x69,
+  0x73, 0x68, 0x6f, 0x70, 0x20, 0x25, 0x73, 0x00, 0x4d, 0x6f, 0x74, 0x68,
+  0x65, 0x72, 0x20, 0x53, 0x75, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x72, 0x20,
+  0x25, 0x73, 0x00, 0x00, 0x13, 0x00, 0x8f, 0x06, 0x00, 0x1e, 0x43, 0x61,
+  0x72, 0x64, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x25, 0x73, 0x00, 0x00, 0x21,
+  0x00, 0x8f, 0x0e, 0x00, 0x1f, 0x50, 0x61, 0x74, 0x72, 0x69, 0x61, 0x72,
+  0x64, 0x65, 0x72, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1d, 0x00, 0x8f, 0x0e,
+  0x02, 0x30, 0x57, 0x61, 0x72, 0x6c, 0x6f, 0x72, 0x64, 0x20, 0x25, 0x73,
+  0x00, 0x57, 0x61, 0x72, 0x6c, 0x61, 0x64, 0x79, 0x20, 0x25, 0x73, 0x00,
+  0x00, 0x25, 0x00, 0x8f, 0x0e, 0x00, 0xac, 0x55, 0x73, 0x75, 0x72, 0x70,
+  0x65, 0x72, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c,
+  0x65, 0x3a, 0x55, 0x73, 0x75, 0x72, 0x70, 0x65, 0x72, 0x20, 0x25, 0x73,
+  0x00, 0x00, 0x25, 0x00, 0x8f, 0x0e, 0x00, 0xad, 0x43, 0x69, 0x74, 0x69,
+  0x7a, 0x65, 0x6e, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61,
+  0x6c, 0x65, 0x3a, 0x43, 0x69, 0x74, 0x69, 0x7a, 0x65, 0x6e, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x25, 0x00, 0x8f, 0x0e, 0x01, 0x71, 0x55, 0x73, 0x75,
+  0x72, 0x70, 0x65, 0x72, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d,
+  0x61, 0x6c, 0x65, 0x3a, 0x55, 0x73, 0x75, 0x72, 0x70, 0x65, 0x72, 0x20,
+  0x25, 0x73, 0x00, 0x00, 0x07, 0x00, 0x8f, 0x02, 0x01, 0x11, 0x00, 0x07,
+  0x00, 0x8f, 0x02, 0x00, 0x51, 0x00, 0x3d, 0x00, 0x8f, 0x0e, 0x01, 0xd5,
+  0x45, 0x6e, 0x65, 0x6d, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x50, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x20, 0x25, 0x73, 0x00, 0x3f,
+  0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x45, 0x6e, 0x65, 0x6d, 0x79,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x65, 0x6f, 0x70,
+  0x6c, 0x65, 0x20, 0x25, 0x73, 0x00, 0x00, 0x29, 0x00, 0x8f, 0x0e, 0x01,
+  0xd6, 0x50, 0x72, 0x65, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x25,
+  0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x50, 0x72,
+  0x65, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x25, 0x00, 0x8f, 0x0e, 0x01, 0x77, 0x55, 0x73, 0x75, 0x72, 0x70, 0x65,
+  0x72, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65,
+  0x3a, 0x55, 0x73, 0x75, 0x72, 0x70, 0x65, 0x72, 0x20, 0x25, 0x73, 0x00,
+  0x00, 0x07, 0x00, 0x8f, 0x02, 0x01, 0xda, 0x00, 0x07, 0x00, 0x8f, 0x02,
+  0x00, 0xb8, 0x00, 0x07, 0x00, 0x8f, 0x02, 0x01, 0x7a, 0x00, 0x07, 0x00,
+  0x8f, 0x02, 0x00, 0x5a, 0x00, 0x07, 0x00, 0x8f, 0x02, 0x01, 0x7f, 0x00,
+  0x07, 0x00, 0x8f, 0x02, 0x01, 0x80, 0x00, 0xfa, 0x00, 0x91, 0xb9, 0x01,
+  0x44, 0x65, 0x73, 0x70, 0x6f, 0x74, 0x69, 0x73, 0x6d, 0x00, 0x44, 0x65,
+  0x73, 0x70, 0x6f, 0x74, 0x69, 0x73, 0x6d, 0x00, 0x67, 0x6f, 0x76, 0x2e,
+  0x64, 0x65, 0x73, 0x70, 0x6f, 0x74, 0x69, 0x73, 0x6d, 0x00, 0x55, 0x6e,
+  0x64, 0x65, 0x72, 0x20, 0x44, 0x65, 0x73, 0x70, 0x6f, 0x74, 0x69, 0x73,
+  0x6d, 0x2c, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x61, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x20,
+  0x72, 0x75, 0x6c, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x79, 0x6f, 0x75,
+  0x72, 0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x2e, 0x20, 0x20, 0x59,
+  0x6f, 0x75, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20,
+  0x6f, 0x76, 0x65, 0x72, 0x20, 0x79, 0x6f, 0x75, 0x72, 0x20, 0x63, 0x69,
+  0x74, 0x69, 0x7a, 0x65, 0x6e, 0x73, 0x20, 0x69, 0x73, 0x20, 0x6d, 0x61,
+  0x69, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x61, 0x72,
+  0x67, 0x65, 0x6c, 0x79, 0x20, 0x62, 0x79, 0x20, 0x6d, 0x61, 0x72, 0x74,
+  0x69, 0x61, 0x6c, 0x20, 0x6c, 0x61, 0x77, 0x2e, 0x03, 0x44, 0x65, 0x73,
+  0x70, 0x6f, 0x74, 0x69, 0x73, 0x6d, 0x20, 0x73, 0x75, 0x66, 0x66, 0x65,
+  0x72, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65,
+  0x73, 0x74, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x20, 0x6f, 0x66, 0x20,
+  0x63, 0x6f, 0x72, 0x72, 0x75, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f,
+  0x66, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e, 0x6d, 0x65, 0x6e,
+  0x74, 0x2e, 0x03, 0x00, 0x00, 0x1d, 0x00, 0x8f, 0x0f, 0x01, 0x01, 0x87,
+  0x43, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x25, 0x73, 0x00, 0x43, 0x6f, 0x75,
+  0x6e, 0x74, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1d, 0x00,
+  0x8f, 0x0e, 0x01, 0x88, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x25,
+  0x73, 0x00, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x65, 0x73, 0x73, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x1c, 0x00, 0x8f, 0x0e, 0x00, 0x05, 0x42, 0x61, 0x72,
+  0x6f, 0x6e, 0x20, 0x25, 0x73, 0x00, 0x42, 0x61, 0x72, 0x6f, 0x6e, 0x65,
+  0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x23, 0x00, 0x8f, 0x0e, 0x01,
+  0x8a, 0x44, 0x65, 0x73, 0x70, 0x6f, 0x74, 0x20, 0x25, 0x73, 0x00, 0x3f,
+  0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x44, 0x65, 0x73, 0x70, 0x6f,
+  0x74, 0x20, 0x25, 0x73, 0x00, 0x00, 0x22, 0x00, 0x8f, 0x0e, 0x01, 0x8b,
+  0x56, 0x69, 0x73, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x25, 0x73, 0x00,
+  0x56, 0x69, 0x73, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x73, 0x73, 0x20,
+  0x25, 0x73, 0x00, 0x00, 0x1a, 0x00, 0x8f, 0x0e, 0x01, 0x8c, 0x44, 0x75,
+  0x6b, 0x65, 0x20, 0x25, 0x73, 0x00, 0x44, 0x75, 0x63, 0x68, 0x65, 0x73,
+  0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x35, 0x00, 0x8f, 0x0e, 0x01, 0x8d,
+  0x43, 0x61, 0x70, 0x74, 0x61, 0x69, 0x6e, 0x20, 0x47, 0x65, 0x6e, 0x65,
+  0x72, 0x61, 0x6c, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61,
+  0x6c, 0x65, 0x3a, 0x43, 0x61, 0x70, 0x74, 0x61, 0x69, 0x6e, 0x20, 0x47,
+  0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1c,
+  0x00, 0x8f, 0x0e, 0x00, 0x0a, 0x53, 0x68, 0x65, 0x69, 0x6b, 0x68, 0x20,
+  0x25, 0x73, 0x00, 0x53, 0x68, 0x61, 0x79, 0x6b, 0x68, 0x61, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x07, 0x00, 0x8f, 0x02, 0x01, 0x8f, 0x00, 0x1f, 0x00,
+  0x8f, 0x0e, 0x00, 0x0b, 0x45, 0x61, 0x72, 0x6c, 0x20, 0x25, 0x73, 0x00,
+  0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x45, 0x61, 0x72, 0x6c,
+  0x20, 0x25, 0x73, 0x00, 0x00, 0x1d, 0x00, 0x8f, 0x0e, 0x00, 0x0c, 0x50,
+  0x72, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x25, 0x73, 0x00, 0x50, 0x72, 0x69,
+  0x6e, 0x63, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1d, 0x00,
+  0x8f, 0x0e, 0x00, 0x0e, 0x25, 0x73, 0x20, 0x44, 0x65, 0x79, 0x00, 0x3f,
+  0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x25, 0x73, 0x20, 0x44, 0x65,
+  0x79, 0x00, 0x00, 0x1c, 0x00, 0x8f, 0x0e, 0x01, 0x93, 0x43, 0x6f, 0x75,
+  0x6e, 0x74, 0x20, 0x25, 0x73, 0x00, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65,
+  0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x25, 0x00, 0x8f, 0x0e, 0x00,
+  0x0f, 0x42, 0x61, 0x69, 0x6c, 0x69, 0x66, 0x66, 0x20, 0x25, 0x73, 0x00,
+  0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x42, 0x61, 0x69, 0x6c,
+  0x69, 0x66, 0x66, 0x20, 0x25, 0x73, 0x00, 0x00, 0x21, 0x00, 0x8f, 0x0e,
+  0x01, 0x94, 0x25, 0x73, 0x20, 0x50, 0x61, 0x73, 0x68, 0x61, 0x00, 0x3f,
+  0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x25, 0x73, 0x20, 0x50, 0x61,
+  0x73, 0x68, 0x61, 0x00, 0x00, 0x1c, 0x00, 0x8f, 0x0e, 0x00, 0x10, 0x53,
+  0x68, 0x65, 0x69, 0x6b, 0x68, 0x20, 0x25, 0x73, 0x00, 0x53, 0x68, 0x61,
+  0x79, 0x6b, 0x68, 0x61, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1d, 0x00, 0x8f,
+  0x0e, 0x01, 0x96, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x25, 0x73,
+  0x00, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73,
+  0x00, 0x00, 0x20, 0x00, 0x8f, 0x0e, 0x01, 0x97, 0x44, 0x69, 0x63, 0x74,
+  0x61, 0x74, 0x6f, 0x72, 0x20, 0x25, 0x73, 0x00, 0x44, 0x69, 0x63, 0x74,
+  0x61, 0x74, 0x72, 0x69, 0x78, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1b, 0x00,
+  0x8f, 0x0a, 0x00, 0x13, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a,
+  0x44, 0x69, 0x63, 0x74, 0x61, 0x74, 0x6f, 0x72, 0x20, 0x25, 0x73, 0x00,
+  0x00, 0x25, 0x00, 0x8f, 0x0e, 0x01, 0x98, 0x42, 0x61, 0x69, 0x6c, 0x69,
+  0x66, 0x66, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c,
+  0x65, 0x3a, 0x42, 0x61, 0x69, 0x6c, 0x69, 0x66, 0x66, 0x20, 0x25, 0x73,
+  0x00, 0x00, 0x1d, 0x00, 0x8f, 0x0e, 0x01, 0x99, 0x50, 0x72, 0x69, 0x6e,
+  0x63, 0x65, 0x20, 0x25, 0x73, 0x00, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x65,
+  0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1c, 0x00, 0x8f, 0x0e, 0x00,
+  0x15, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x25, 0x73, 0x00, 0x43, 0x6f,
+  0x75, 0x6e, 0x74, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1d,
+  0x00, 0x8f, 0x0e, 0x01, 0x9a, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x65, 0x20,
+  0x25, 0x73, 0x00, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x65, 0x73, 0x73, 0x20,
+  0x25, 0x73, 0x00, 0x00, 0x07, 0x00, 0x8f, 0x02, 0x01, 0x9b, 0x00, 0x1c,
+  0x00, 0x8f, 0x0e, 0x00, 0x1b, 0x53, 0x68, 0x65, 0x69, 0x6b, 0x68, 0x20,
+  0x25, 0x73, 0x00, 0x53, 0x68, 0x61, 0x79, 0x6b, 0x68, 0x61, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x1c, 0x00, 0x8f, 0x0e, 0x00, 0x1c, 0x43, 0x6f, 0x75,
+  0x6e, 0x74, 0x20, 0x25, 0x73, 0x00, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65,
+  0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1f, 0x00, 0x8f, 0x0e, 0x00,
+  0x1e, 0x43, 0x61, 0x75, 0x64, 0x69, 0x6c, 0x6c, 0x6f, 0x20, 0x25, 0x73,
+  0x00, 0x43, 0x61, 0x75, 0x64, 0x69, 0x6c, 0x6c, 0x61, 0x20, 0x25, 0x73,
+  0x00, 0x00, 0x25, 0x00, 0x8f, 0x0e, 0x01, 0xa3, 0x47, 0x65, 0x6e, 0x65,
+  0x72, 0x61, 0x6c, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61,
+  0x6c, 0x65, 0x3a, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x1d, 0x00, 0x8f, 0x0e, 0x00, 0x23, 0x50, 0x72, 0x69,
+  0x6e, 0x63, 0x65, 0x20, 0x25, 0x73, 0x00, 0x50, 0x72, 0x69, 0x6e, 0x63,
+  0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1a, 0x00, 0x8f, 0x0e,
+  0x01, 0xa8, 0x44, 0x75, 0x6b, 0x65, 0x20, 0x25, 0x73, 0x00, 0x44, 0x75,
+  0x63, 0x68, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x25, 0x00,
+  0x8f, 0x0e, 0x01, 0xa9, 0x41, 0x64, 0x6d, 0x69, 0x72, 0x61, 0x6c, 0x20,
+  0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x41,
+  0x64, 0x6d, 0x69, 0x72, 0x61, 0x6c, 0x20, 0x25, 0x73, 0x00, 0x00, 0x22,
+  0x00, 0x8f, 0x0e, 0x00, 0x26, 0x41, 0x72, 0x63, 0x68, 0x64, 0x75, 0x6b,
+  0x65, 0x20, 0x25, 0x73, 0x00, 0x41, 0x72, 0x63, 0x68, 0x64, 0x75, 0x63,
+  0x68, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x19, 0x00, 0x8f,
+  0x0e, 0x00, 0x27, 0x25, 0x73, 0x20, 0x4b, 0x68, 0x61, 0x6e, 0x00, 0x25,
+  0x73, 0x20, 0x4b, 0x68, 0x61, 0x74, 0x61, 0x6e, 0x00, 0x00, 0x1a, 0x00,
+  0x8f, 0x0e, 0x01, 0xad, 0x44, 0x75, 0x6b, 0x65, 0x20, 0x25, 0x73, 0x00,
+  0x44, 0x75, 0x63, 0x68, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x19, 0x00, 0x8f, 0x0e, 0x00, 0x29, 0x25, 0x73, 0x20, 0x4b, 0x68, 0x61,
+  0x6e, 0x00, 0x25, 0x73, 0x20, 0x4b, 0x68, 0x61, 0x74, 0x61, 0x6e, 0x00,
+  0x00, 0x1a, 0x00, 0x8f, 0x0e, 0x01, 0xae, 0x44, 0x75, 0x6b, 0x65, 0x20,
+  0x25, 0x73, 0x00, 0x44, 0x75, 0x63, 0x68, 0x65, 0x73, 0x73, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x1f, 0x00, 0x8f, 0x0e, 0x01, 0xaf, 0x45, 0x61, 0x72,
+  0x6c, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65,
+  0x3a, 0x45, 0x61, 0x72, 0x6c, 0x20, 0x25, 0x73, 0x00, 0x00, 0x21, 0x00,
+  0x8f, 0x0e, 0x00, 0x2b, 0x4d, 0x61, 0x72, 0x67, 0x72, 0x61, 0x76, 0x65,
+  0x20, 0x25, 0x73, 0x00, 0x4d, 0x61, 0x72, 0x67, 0x72, 0x61, 0x76, 0x69,
+  0x6e, 0x65, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1a, 0x00, 0x8f, 0x0e, 0x01,
+  0xb0, 0x44, 0x75, 0x6b, 0x65, 0x20, 0x25, 0x73, 0x00, 0x44, 0x75, 0x63,
+  0x68, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x29, 0x00, 0x8f,
+  0x0e, 0x01, 0xb1, 0x43, 0x68, 0x69, 0x65, 0x66, 0x74, 0x61, 0x69, 0x6e,
+  0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a,
+  0x43, 0x68, 0x69, 0x65, 0x66, 0x74, 0x61, 0x69, 0x6e, 0x20, 0x25, 0x73,
+  0x00, 0x00, 0x2b, 0x00, 0x8f, 0x0e, 0x01, 0xb2, 0x43, 0x6c, 0x61, 0x6e,
+  0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66,
+  0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x43, 0x6c, 0x61, 0x6e, 0x20, 0x43,
+  0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1c, 0x00, 0x8f,
+  0x0e, 0x00, 0x2e, 0x53, 0x68, 0x65, 0x69, 0x6b, 0x68, 0x20, 0x25, 0x73,
+  0x00, 0x53, 0x68, 0x61, 0x79, 0x6b, 0x68, 0x61, 0x20, 0x25, 0x73, 0x00,
+  0x00, 0x17, 0x00, 0x8f, 0x0e, 0x00, 0x2f, 0x52, 0x61, 0x6a, 0x61, 0x20,
+  0x25, 0x73, 0x00, 0x52, 0x61, 0x6e, 0x69, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x23, 0x00, 0x8f, 0x0e, 0x01, 0xb4, 0x53, 0x61, 0x74, 0x72, 0x61, 0x70,
+  0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a,
+  0x53, 0x61, 0x74, 0x72, 0x61, 0x70, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1d,
+  0x00, 0x8f, 0x0e, 0x01, 0xb5, 0x25, 0x73, 0x20, 0x42, 0x65, 0x79, 0x00,
+  0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x25, 0x73, 0x20, 0x42,
+  0x65, 0x79, 0x00, 0x00, 0x19, 0x00, 0x8f, 0x0e, 0x00, 0x31, 0x25, 0x73,
+  0x20, 0x4b, 0x68, 0x61, 0x6e, 0x00, 0x25, 0x73, 0x20, 0x4b, 0x68, 0x61,
+  0x74, 0x61, 0x6e, 0x00, 0x00, 0x23, 0x00, 0x8f, 0x0e, 0x00, 0x32, 0x4c,
+  0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65,
+  0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x4c, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20,
+  0x25, 0x73, 0x00, 0x00, 0x1a, 0x00, 0x69, 0x64, 0x00, 0x54, 0x69, 0x6d,
+  0x75, 0x72, 0x69, 0x64, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c,
+  0x3a, 0x54, 0x69, 0x6d, 0x75, 0x72, 0x69, 0x64, 0x73, 0x00, 0x74, 0x69,
+  0x6d, 0x75, 0x72, 0x00, 0x2d, 0x00, 0x54, 0x69, 0x6d, 0x75, 0x72, 0x20,
+  0x77, 0x61, 0x73, 0x20, 0x61, 0x20, 0x6d, 0x69, 0x6c, 0x69, 0x74, 0x61,
+  0x72, 0x79, 0x20, 0x67, 0x65, 0x6e, 0x69, 0x75, 0x73, 0x20, 0x77, 0x68,
+  0x6f, 0x20, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x65, 0x64, 0x20, 0x6c, 0x69,
+  0x6e, 0x65, 0x61, 0x67, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x43,
+  0x68, 0x69, 0x6e, 0x67, 0x67, 0x69, 0x73, 0x20, 0x4b, 0x68, 0x61, 0x6e,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x68, 0x69,
+  0x73, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x69, 0x6e,
+  0x20, 0x53, 0x61, 0x6d, 0x61, 0x72, 0x6b, 0x61, 0x6e, 0x64, 0x20, 0x63,
+  0x6f, 0x6e, 0x71, 0x75, 0x65, 0x72, 0x65, 0x64, 0x20, 0x61, 0x6c, 0x6c,
+  0x20, 0x6f, 0x66, 0x20, 0x43, 0x65, 0x6e, 0x74, 0x72, 0x61, 0x6c, 0x20,
+  0x41, 0x73, 0x69, 0x61, 0x20, 0x61, 0x73, 0x20, 0x77, 0x65, 0x6c, 0x6c,
+  0x20, 0x61, 0x73, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x4d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x20,
+  0x45, 0x61, 0x73, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x49, 0x6e, 0x64,
+  0x69, 0x61, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x72,
+  0x74, 0x20, 0x63, 0x75, 0x6c, 0x74, 0x75, 0x72, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x54, 0x69, 0x6d, 0x75, 0x72, 0x69, 0x64, 0x20, 0x45, 0x6d, 0x70,
+  0x69, 0x72, 0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x68, 0x65, 0x61, 0x76,
+  0x69, 0x6c, 0x79, 0x20, 0x50, 0x65, 0x72, 0x73, 0x69, 0x61, 0x6e, 0x69,
+  0x7a, 0x65, 0x64, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x69, 0x6d, 0x70, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x20,
+  0x61, 0x64, 0x6d, 0x69, 0x6e, 0x69, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6d, 0x69, 0x6c, 0x69, 0x74,
+  0x61, 0x72, 0x79, 0x20, 0x6f, 0x72, 0x67, 0x61, 0x6e, 0x69, 0x7a, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79,
+  0x65, 0x64, 0x20, 0x69, 0x6e, 0x66, 0x6c, 0x75, 0x65, 0x6e, 0x63, 0x65,
+  0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x54,
+  0x69, 0x6d, 0x75, 0x72, 0x69, 0x64, 0x20, 0x72, 0x75, 0x6c, 0x69, 0x6e,
+  0x67, 0x20, 0x65, 0x6c, 0x69, 0x74, 0x65, 0x27, 0x73, 0x20, 0x4d, 0x6f,
+  0x6e, 0x67, 0x6f, 0x6c, 0x69, 0x61, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x54, 0x75, 0x72, 0x6b, 0x69, 0x63, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69,
+  0x6e, 0x73, 0x2e, 0x00, 0x01, 0x06, 0x48, 0x75, 0x73, 0x61, 0x79, 0x6e,
+  0x20, 0x42, 0x61, 0x79, 0x71, 0x61, 0x72, 0x61, 0x68, 0x00, 0x41, 0x62,
+  0x75, 0x20, 0x53, 0x61, 0x27, 0x69, 0x64, 0x00, 0x55, 0x6c, 0x75, 0x67,
+  0x68, 0x20, 0x42, 0x65, 0x67, 0x00, 0x47, 0x6f, 0x68, 0x61, 0x72, 0x73,
+  0x68, 0x61, 0x64, 0x00, 0x53, 0x68, 0x61, 0x68, 0x20, 0x52, 0x75, 0x6b,
+  0x68, 0x00, 0x54, 0x69, 0x6d, 0x75, 0x72, 0x00, 0x01, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x06, 0x07, 0x04, 0x53, 0x00, 0x94,
+  0xff, 0xef, 0x03, 0x01, 0xf1, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76,
+  0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x54, 0x6f, 0x63,
+  0x68, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x00, 0x54, 0x6f, 0x63, 0x68, 0x61,
+  0x72, 0x69, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c,
+  0x3a, 0x54, 0x6f, 0x63, 0x68, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x73, 0x00,
+  0x74, 0x6f, 0x63, 0x68, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x00, 0x2d, 0x00,
+  0x54, 0x68, 0x65, 0x20, 0x54, 0x6f, 0x63, 0x68, 0x61, 0x72, 0x69, 0x61,
+  0x6e, 0x73, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x20, 0x49,
+  0x6e, 0x64, 0x6f, 0x2d, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x61, 0x6e,
+  0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x20, 0x6c, 0x69, 0x76, 0x69,
+  0x6e, 0x67, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x61, 0x74, 0x20, 0x69,
+  0x73, 0x20, 0x6e, 0x6f, 0x77, 0x20, 0x58, 0x69, 0x6e, 0x6a, 0x69, 0x61,
+  0x6e, 0x67, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x65, 0x73, 0x74, 0x65, 0x72,
+  0x6e, 0x20, 0x43, 0x68, 0x69, 0x6e, 0x61, 0x2e, 0x20, 0x42, 0x65, 0x63,
+  0x61, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x69,
+  0x72, 0x20, 0x75, 0x6e, 0x69, 0x71, 0x75, 0x65, 0x20, 0x67, 0x65, 0x6f,
+  0x70, 0x6f, 0x6c, 0x69, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x70, 0x6f,
+  0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x69,
+  0x72, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x64, 0x6f, 0x6d, 0x73, 0x20, 0x6f,
+  0x66, 0x20, 0x53, 0x68, 0x61, 0x6e, 0x73, 0x68, 0x61, 0x6e, 0x2c, 0x20,
+  0x4b, 0x75, 0x63, 0x68, 0x61, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x4b,
+  0x68, 0x6f, 0x74, 0x61, 0x6e, 0x20, 0x28, 0x61, 0x73, 0x20, 0x77, 0x65,
+  0x6c, 0x6c, 0x20, 0x61, 0x73, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x2c,
+  0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x6f, 0x6e, 0x65,
+  0x73, 0x29, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6c,
+  0x75, 0x65, 0x6e, 0x63, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x43, 0x68,
+  0x69, 0x6e, 0x65, 0x73, 0x65, 0x2c, 0x20, 0x50, 0x65, 0x72, 0x73, 0x69,
+  0x61, 0x6e, 0x2c, 0x20, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x2c, 0x20,
+  0x53, 0x6f, 0x67, 0x64, 0x69, 0x61, 0x6e, 0x2c, 0x20, 0x53, 0x63, 0x79,
+  0x74, 0x68, 0x69, 0x61, 0x6e, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x54,
+  0x69, 0x62, 0x65, 0x74, 0x61, 0x6e, 0x20, 0x63, 0x75, 0x6c, 0x74, 0x75,
+  0x72, 0x65, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x69, 0x72, 0x20, 0x72,
+  0x65, 0x6c, 0x69, 0x67, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x64, 0x72, 0x65,
+  0x73, 0x73, 0x2c, 0x20, 0x77, 0x72, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x2c,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x72, 0x74, 0x20, 0x61, 0x6c, 0x6c,
+  0x20, 0x72, 0x65, 0x66, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65,
+  0x73, 0x65, 0x20, 0x76, 0x61, 0x72, 0x69, 0x65, 0x64, 0x20, 0x69, 0x6e,
+  0x66, 0x6c, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x73, 0x2e, 0x20, 0x54, 0x68,
+  0x65, 0x79, 0x20, 0x6c, 0x69, 0x76, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20,
+  0x6f, 0x61, 0x73, 0x69, 0x73, 0x20, 0x74, 0x6f, 0x77, 0x6e, 0x73, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x61,
+  0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x69, 0x6c,
+  0x6b, 0x20, 0x52, 0x6f, 0x61, 0x64, 0x2c, 0x20, 0x61, 0x6c, 0x6f, 0x6e,
+  0x67, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x42, 0x75, 0x64, 0x64,
+  0x68, 0x69, 0x73, 0x6d, 0x20, 0x77, 0x61, 0x73, 0x20, 0x63, 0x61, 0x72,
+  0x72, 0x69, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x43, 0x68,
+  0x69, 0x6e, 0x61, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x61, 0x72, 0x65,
+  0x61, 0x20, 0x77, 0x61, 0x73, 0x20, 0x61, 0x74, 0x20, 0x76, 0x61, 0x72,
+  0x69, 0x6f, 0x75, 0x73, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x20, 0x61,
+  0x20, 0x6d, 0x69, 0x6c, 0x69, 0x74, 0x61, 0x72, 0x79, 0x20, 0x70, 0x72,
+  0x6f, 0x74, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6f,
+  0x66, 0x20, 0x43, 0x68, 0x69, 0x6e, 0x61, 0x2c, 0x20, 0x73, 0x75, 0x63,
+  0x68, 0x20, 0x61, 0x73, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x48, 0x61, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x54, 0x61, 0x6e, 0x67, 0x20, 0x64, 0x79, 0x6e, 0x61, 0x73, 0x74, 0x69,
+  0x65, 0x73, 0x2e, 0x20, 0x44, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x64, 0x65, 0x63, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x72,
+  0x20, 0x64, 0x79, 0x6e, 0x61, 0x73, 0x74, 0x79, 0x2c, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x54, 0x75, 0x72, 0x6b, 0x69, 0x63, 0x20, 0x55, 0x79, 0x67,
+  0x68, 0x75, 0x72, 0x20, 0x74, 0x72, 0x69, 0x62, 0x65, 0x20, 0x6d, 0x6f,
+  0x76, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x54, 0x61, 0x72, 0x69, 0x6d, 0x20, 0x62, 0x61, 0x73, 0x69, 0x6e,
+  0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x69,
+  0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64,
+  0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x6b, 0x68,
+  0x61, 0x6e, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67,
+  0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x54, 0x6f, 0x63, 0x68, 0x61, 0x72,
+  0x69, 0x61, 0x6e, 0x20, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x2e, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x55, 0x79, 0x67, 0x68, 0x75, 0x72, 0x20, 0x69, 0x6e,
+  0x74, 0x65, 0x72, 0x6d, 0x61, 0x72, 0x72, 0x69, 0x65, 0x64, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x54, 0x6f, 0x63, 0x68,
+  0x61, 0x72, 0x69, 0x61, 0x6e, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73,
+  0x75, 0x70, 0x70, 0x6c, 0x61, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x74, 0x68,
+  0x65, 0x69, 0x72, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x62, 0x75, 0x74,
+  0x20, 0x6c, 0x69, 0x74, 0x75, 0x72, 0x67, 0x69, 0x63, 0x61, 0x6c, 0x20,
+  0x70, 0x75, 0x72, 0x70, 0x6f, 0x73, 0x65, 0x73, 0x2e, 0x20, 0x45, 0x76,
+  0x65, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x20,
+  0x66, 0x65, 0x6c, 0x6c, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x49, 0x73,
+  0x6c, 0x61, 0x6d, 0x20, 0x73, 0x70, 0x72, 0x65, 0x61, 0x64, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6b, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x70, 0x6c, 0x61, 0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x42, 0x75, 0x64,
+  0x64, 0x68, 0x69, 0x73, 0x6d, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x70, 0x72, 0x65, 0x64, 0x6f, 0x6d, 0x69, 0x6e, 0x61, 0x6e, 0x74,
+  0x20, 0x72, 0x65, 0x6c, 0x69, 0x67, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e, 0x2e,
+  0x00, 0x04, 0x06, 0x4a, 0x69, 0x76, 0x61, 0x00, 0x4d, 0x61, 0x79, 0x61,
+  0x00, 0x44, 0x68, 0x61, 0x6e, 0x69, 0x6b, 0x61, 0x00, 0x41, 0x6d, 0x62,
+  0x61, 0x72, 0x65, 0x00, 0x59, 0x73, 0x61, 0x73, 0x73, 0x61, 0x2d, 0x50,
+  0x79, 0x61, 0x70, 0x6f, 0x00, 0x53, 0x75, 0x6c, 0x69, 0x63, 0x61, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x07, 0x01,
+  0xc6, 0x00, 0x94, 0xff, 0xef, 0x03, 0x01, 0xf2, 0x66, 0x72, 0x65, 0x65,
+  0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00,
+  0x54, 0x6f, 0x67, 0x6f, 0x6c, 0x65, 0x73, 0x65, 0x00, 0x54, 0x6f, 0x67,
+  0x6f, 0x6c, 0x65, 0x73, 0x65, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61,
+  0x6c, 0x3a, 0x54, 0x6f, 0x67, 0x6f, 0x6c, 0x65, 0x73, 0x65, 0x00, 0x74,
+  0x6f, 0x67, 0x6f, 0x00, 0x2d, 0x00, 0x54, 0x6f, 0x67, 0x6f, 0x20, 0x62,
+  0x65, 0x63, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x20, 0x47, 0x65, 0x72, 0x6d,
+  0x61, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x74, 0x65, 0x63, 0x74, 0x6f, 0x72,
+  0x61, 0x74, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x38, 0x38, 0x35, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x77, 0x61, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x71,
+  0x75, 0x65, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x46, 0x72, 0x65, 0x6e, 0x63, 0x68, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x42, 0x72, 0x69, 0x74, 0x69, 0x73, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x57,
+  0x6f, 0x72, 0x6c, 0x64, 0x20, 0x57, 0x61, 0x72, 0x20, 0x49, 0x49, 0x2e,
+  0x20, 0x54, 0x6f, 0x67, 0x6f, 0x20, 0x62, 0x65, 0x63, 0x61, 0x6d, 0x65,
+  0x20, 0x69, 0x6e, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74,
+  0x20, 0x69, 0x6e, 0x20, 0x31, 0x39, 0x36, 0x30, 0x2e, 0x20, 0x53, 0x69,
+  0x6e, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x74, 0x65,
+  0x20, 0x31, 0x39, 0x36, 0x30, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x72, 0x79, 0x27, 0x73, 0x20, 0x70, 0x6f, 0x6c,
+  0x69, 0x74, 0x69, 0x63, 0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x62,
+  0x65, 0x65, 0x6e, 0x20, 0x64, 0x6f, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x65,
+  0x64, 0x20, 0x62, 0x79, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c,
+  0x20, 0x47, 0x6e, 0x61, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x62, 0x65, 0x20,
+  0x45, 0x79, 0x61, 0x64, 0x65, 0x6d, 0x61, 0x2c, 0x20, 0x77, 0x68, 0x6f,
+  0x20, 0x77, 0x61, 0x73, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x65, 0x64,
+  0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x68, 0x69, 0x73, 0x20, 0x73, 0x6f,
+  0x6e, 0x20, 0x46, 0x61, 0x75, 0x72, 0x65, 0x20, 0x75, 0x70, 0x6f, 0x6e,
+  0x20, 0x68, 0x69, 0x73, 0x20, 0x64, 0x65, 0x61, 0x74, 0x68, 0x20, 0x69,
+  0x6e, 0x20, 0x32, 0x30, 0x30, 0x35, 0x2e, 0x00, 0x02, 0x05, 0x4d, 0x6c,
+  0x61, 0x70, 0x61, 0x20, 0x49, 0x49, 0x49, 0x00, 0x53, 0x79, 0x6c, 0x76,
+  0x61, 0x6e, 0x75, 0x73, 0x20, 0x4f, 0x6c, 0x79, 0x6d, 0x70, 0x69, 0x6f,
+  0x00, 0x4e, 0x69, 0x63, 0x6f, 0x6c, 0x61, 0x73, 0x20, 0x47, 0x72, 0x75,
+  0x77, 0x61, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x6d, 0x70, 0x69, 0x72,
+  0x65, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x65, 0x64, 0x20, 0x6f,
+  0x6e, 0x20, 0x50, 0x61, 0x6c, 0x65, 0x6d, 0x62, 0x61, 0x6e, 0x67, 0x20,
+  0x69, 0x6e, 0x20, 0x65, 0x61, 0x73, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x53,
+  0x75, 0x6d, 0x61, 0x74, 0x72, 0x61, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x65,
+  0x78, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x69, 0x74, 0x73, 0x20,
+  0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x74, 0x68, 0x72, 0x6f,
+  0x75, 0x67, 0x68, 0x20, 0x6d, 0x75, 0x63, 0x68, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x61, 0x73, 0x74, 0x61, 0x6c, 0x20,
+  0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x53,
+  0x75, 0x6d, 0x61, 0x74, 0x72, 0x61, 0x2c, 0x20, 0x4a, 0x61, 0x76, 0x61,
+  0x2c, 0x20, 0x42, 0x6f, 0x72, 0x6e, 0x65, 0x6f, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x4d, 0x61, 0x6c, 0x61, 0x79, 0x20, 0x70,
+  0x65, 0x6e, 0x69, 0x6e, 0x73, 0x75, 0x6c, 0x61, 0x2e, 0x20, 0x49, 0x74,
+  0x20, 0x77, 0x61, 0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x65, 0x64,
+  0x20, 0x73, 0x6f, 0x6d, 0x65, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x69, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x33, 0x72, 0x64, 0x20, 0x63, 0x65, 0x6e,
+  0x74, 0x75, 0x72, 0x79, 0x20, 0x43, 0x45, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x6c, 0x61, 0x73, 0x74, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c,
+  0x20, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x6c, 0x79, 0x20, 0x31, 0x34, 0x30,
+  0x30, 0x2c, 0x20, 0x66, 0x61, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x66,
+  0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x4a, 0x61, 0x6d, 0x62,
+  0x69, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x53,
+  0x69, 0x6e, 0x67, 0x68, 0x61, 0x73, 0x61, 0x72, 0x69, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x72, 0x65, 0x67, 0x69,
+  0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x73, 0x2c,
+  0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x53, 0x6f, 0x75, 0x74, 0x68, 0x20, 0x49, 0x6e, 0x64,
+  0x69, 0x61, 0x6e, 0x20, 0x43, 0x68, 0x6f, 0x6c, 0x61, 0x20, 0x64, 0x79,
+  0x6e, 0x61, 0x73, 0x74, 0x79, 0x2e, 0x00, 0x02, 0x05, 0x42, 0x61, 0x6c,
+  0x61, 0x70, 0x75, 0x74, 0x72, 0x61, 0x00, 0x50, 0x72, 0x61, 0x6d, 0x6f,
+  0x64, 0x61, 0x76, 0x61, 0x72, 0x64, 0x68, 0x61, 0x6e, 0x69, 0x00, 0x53,
+  0x61, 0x6d, 0x61, 0x72, 0x61, 0x74, 0x75, 0x6e, 0x67, 0x67, 0x61, 0x00,
+  0x44, 0x68, 0x61, 0x72, 0x6d, 0x61, 0x73, 0x65, 0x74, 0x75, 0x00, 0x4a,
+  0x61, 0x79, 0x61, 0x6e, 0x61, 0x73, 0x61, 0x00, 0x01, 0x00, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x07, 0x00, 0xf3, 0x00, 0x94, 0xff,
+  0xef, 0x03, 0x01, 0xd8, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d,
+  0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x53, 0x75, 0x64, 0x61,
+  0x6e, 0x65, 0x73, 0x65, 0x00, 0x53, 0x75, 0x64, 0x61, 0x6e, 0x65, 0x73,
+  0x65, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x53, 0x75,
+  0x64, 0x61, 0x6e, 0x65, 0x73, 0x65, 0x00, 0x73, 0x75, 0x64, 0x61, 0x6e,
+  0x00, 0x2d, 0x00, 0x49, 0x6e, 0x20, 0x31, 0x38, 0x32, 0x30, 0x20, 0x53,
+  0x75, 0x64, 0x61, 0x6e, 0x20, 0x63, 0x61, 0x6d, 0x65, 0x20, 0x75, 0x6e,
+  0x64, 0x65, 0x72, 0x20, 0x45, 0x67, 0x79, 0x70, 0x74, 0x69, 0x61, 0x6e,
+  0x20, 0x72, 0x75, 0x6c, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6c, 0x61,
+  0x74, 0x65, 0x72, 0x20, 0x42, 0x72, 0x69, 0x74, 0x69, 0x73, 0x68, 0x20,
+  0x72, 0x75, 0x6c, 0x65, 0x2e, 0x20, 0x53, 0x75, 0x64, 0x61, 0x6e, 0x20,
+  0x62, 0x65, 0x63, 0x61, 0x6d, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x70,
+  0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x39,
+  0x35, 0x36, 0x2e, 0x00, 0x01, 0x04, 0x4d, 0x75, 0x68, 0x61, 0x6d, 0x6d,
+  0x61, 0x64, 0x20, 0x69, 0x62, 0x6e, 0x20, 0x41, 0x62, 0x64, 0x61, 0x6c,
+  0x6c, 0x61, 0x00, 0x47, 0x61, 0x61, 0x66, 0x61, 0x72, 0x20, 0x4e, 0x69,
+  0x6d, 0x65, 0x69, 0x72, 0x79, 0x00, 0x49, 0x62, 0x72, 0x61, 0x68, 0x69,
+  0x6d, 0x20, 0x41, 0x62, 0x62, 0x6f, 0x75, 0x64, 0x00, 0x4f, 0x6d, 0x61,
+  0x72, 0x20, 0x61, 0x6c, 0x2d, 0x42, 0x61, 0x73, 0x68, 0x69, 0x72, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x07, 0x03, 0xf6,
+  0x00, 0x94, 0xff, 0xef, 0x03, 0x01, 0xd9, 0x66, 0x72, 0x65, 0x65, 0x63,
+  0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x53,
+  0x75, 0x65, 0x62, 0x69, 0x61, 0x6e, 0x00, 0x53, 0x75, 0x65, 0x62, 0x69,
+  0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x53,
+  0x75, 0x65, 0x62, 0x69, 0x61, 0x6e, 0x73, 0x00, 0x73, 0x75, 0x65, 0x62,
+  0x69, 0x61, 0x6e, 0x00, 0x2d, 0x00, 0x54, 0x68, 0x65, 0x20, 0x53, 0x75,
+  0x65, 0x62, 0x69, 0x61, 0x6e, 0x73, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20,
+  0x61, 0x6e, 0x20, 0x61, 0x6e, 0x63, 0x69, 0x65, 0x6e, 0x74, 0x20, 0x57,
+  0x65, 0x73, 0x74, 0x20, 0x47, 0x65, 0x72, 0x6d, 0x61, 0x6e, 0x69, 0x63,
+  0x20, 0x74, 0x72, 0x69, 0x62, 0x61, 0x6c, 0x20, 0x63, 0x6f, 0x6e, 0x66,
+  0x65, 0x64, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x77,
+  0x68, 0x69, 0x63, 0x68, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x68, 0x61, 0x76,
+  0x65, 0x20, 0x62, 0x65, 0x65, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x65,
+  0x64, 0x20, 0x62, 0x79, 0x20, 0x41, 0x72, 0x69, 0x6f, 0x76, 0x69, 0x73,
+  0x74, 0x75, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x68, 0x69, 0x73, 0x20,
+  0x65, 0x78, 0x70, 0x65, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74,
+  0x6f, 0x20, 0x47, 0x61, 0x75, 0x6c, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20,
+  0x53, 0x75, 0x65, 0x62, 0x69, 0x61, 0x6e, 0x73, 0x20, 0x69, 0x6e, 0x63,
+  0x6c, 0x75, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x65,
+  0x72, 0x6d, 0x61, 0x6e, 0x69, 0x63, 0x20, 0x74, 0x72, 0x69, 0x62, 0x65,
+  0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x45,
+  0x6c, 0x62, 0x65, 0x20, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x62, 0x61,
+  0x73, 0x69, 0x6e, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x6e, 0x67, 0x69, 0x6e,
+  0x67, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x48, 0x65, 0x72,
+  0x6d, 0x69, 0x6e, 0x6f, 0x6e, 0x69, 0x63, 0x20, 0x6c, 0x61, 0x6e, 0x67,
+  0x75, 0x61, 0x67, 0x65, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x2c, 0x20,
+  0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x4d, 0x61, 0x72, 0x63, 0x6f, 0x6d, 0x61, 0x6e, 0x6e, 0x69, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x51, 0x75, 0x61, 0x64, 0x69, 0x2e, 0x20, 0x42, 0x65,
+  0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+  0x72, 0x73, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x66, 0x6f, 0x75, 0x72,
+  0x74, 0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x69, 0x65, 0x73,
+  0x20, 0x43, 0x45, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x77, 0x65, 0x72,
+  0x65, 0x20, 0x61, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x74, 0x20, 0x74,
+  0x6f, 0x20, 0x52, 0x6f, 0x6d, 0x65, 0x2c, 0x20, 0x6f, 0x66, 0x74, 0x65,
+  0x6e, 0x20, 0x65, 0x6e, 0x63, 0x72, 0x6f, 0x61, 0x63, 0x68, 0x69, 0x6e,
+  0x67, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x44, 0x61, 0x6e,
+  0x75, 0x62, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x6e, 0x63, 0x65,
+  0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6d, 0x70,
+  0x69, 0x72, 0x65, 0x2e, 0x20, 0x49, 0x6e, 0x20, 0x34, 0x30, 0x35, 0x2d,
+  0x34, 0x30, 0x36, 0x20, 0x43, 0x45, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53,
+  0x75, 0x65, 0x62, 0x69, 0x61, 0x6e, 0x73, 0x20, 0x77, 0x65, 0x72, 0x65,
+  0x20, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x6c,
+  0x65, 0x61, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x6c,
+  0x61, 0x6e, 0x64, 0x73, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x48, 0x75, 0x6e, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x75, 0x72,
+  0x69, 0x6e, 0x67, 0x20, 0x4e, 0x65, 0x77, 0x20, 0x59, 0x65, 0x61, 0x72,
+  0x27, 0x73, 0x20, 0x6e, 0x69, 0x67, 0x68, 0x74, 0x20, 0x69, 0x6e, 0x20,
+  0x34, 0x30, 0x35, 0x20, 0x43, 0x45, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20,
+  0x63, 0x72, 0x6f, 0x73, 0x73, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x66, 0x72, 0x6f, 0x7a, 0x65, 0x6e, 0x20, 0x52, 0x68, 0x69, 0x6e, 0x65,
+  0x20, 0x74, 0x6f, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x56, 0x61, 0x6e, 0x64, 0x61,
+  0x6c, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41,
+  0x6c, 0x61, 0x6e, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 0x73,
+  0x65, 0x74, 0x74, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6e, 0x6f, 0x72, 0x74, 0x68, 0x77, 0x65, 0x73, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x49, 0x62, 0x65, 0x72, 0x69,
+  0x61, 0x6e, 0x20, 0x50, 0x65, 0x6e, 0x69, 0x6e, 0x73, 0x75, 0x6c, 0x61,
+  0x2c, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x79,
+  0x20, 0x65, 0x73, 0x74, 0x61, 0x62, 0x6c, 0x69, 0x73, 0x68, 0x65, 0x64,
+  0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x6b,
+  0x69, 0x6e, 0x67, 0x64, 0x6f, 0x6d, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63,
+  0x68, 0x20, 0x77, 0x61, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x71, 0x75, 0x65,
+  0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x56,
+  0x69, 0x73, 0x69, 0x67, 0x6f, 0x74, 0x68, 0x73, 0x20, 0x69, 0x6e, 0x20,
+  0x35, 0x38, 0x35, 0x20, 0x43, 0x45, 0x2e, 0x00, 0x05, 0x15, 0x41, 0x72,
+  0x69, 0x6f, 0x76, 0x69, 0x73, 0x74, 0x75, 0x73, 0x00, 0x4d, 0x61, 0x72,
+  0x6f, 0x62, 0x6f, 0x64, 0x77, 0x75, 0x73, 0x00, 0x48, 0x65, 0x72, 0x6d,
+  0x65, 0x6e, 0x65, 0x72, 0x69, 0x6b, 0x00, 0x48, 0x61, 0x72, 0x6a, 0x61,
+  0x6d, 0x69, 0x67, 0x61, 0x72, 0x6a, 0x61, 0x73, 0x00, 0x52, 0x65, 0x78,
+  0x77, 0x69, 0x6c, 0x61, 0x00, 0x52, 0x65, 0x78, 0x6a, 0x61, 0x72, 0x00,
+  0x41, 0x6a, 0x75, 0x6c, 0x66, 0x00, 0x4d, 0x61, 0x6c, 0x64, 0x72, 0x61,
+  0x73, 0x00, 0x46, 0x72, 0x61, 0x6d, 0x74, 0x61, 0x00, 0x52, 0x65, 0x78,
+  0x69, 0x6d, 0x75, 0x6e, 0x64, 0x00, 0x46, 0x72, 0x75, 0x6d, 0x61, 0x72,
+  0x00, 0x52, 0x65, 0x6d, 0x69, 0x73, 0x6d, 0x75, 0x6e, 0x64, 0x00, 0x57,
+  0x65, 0x72, 0x65, 0x6d, 0x75, 0x6e, 0x64, 0x00, 0x54, 0x68, 0x65, 0x75,
+  0x64, 0x65, 0x6d, 0x75, 0x6e, 0x64, 0x00, 0x58, 0x61, 0x72, 0x61, 0x72,
+  0x69, 0x6b, 0x00, 0x41, 0x72, 0x6a, 0x61, 0x6d, 0x69, 0x72, 0x00, 0x54,
+  0x68, 0x65, 0x75, 0x64, 0x65, 0x6d, 0x69, 0x72, 0x00, 0x4d, 0x69, 0x72,
+  0x6f, 0x00, 0x45, 0x62, 0x6f, 0x72, 0x69, 0x6b, 0x00, 0x41, 0x6e, 0x64,
+  0x65, 0x6b, 0x61, 0x00, 0x4d, 0x61, 0x6c, 0x61, 0x72, 0x69, 0x6b, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03,
+  0x00, 0x01, 0x07, 0x07, 0x01, 0x5b, 0x00, 0x94, 0xfe, 0xef, 0x03, 0x01,
+  0xda, 0x53, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x61, 0x6e, 0x00, 0x53, 0x75,
+  0x6d, 0x65, 0x72, 0x69, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72,
+  0x61, 0x6c, 0x3a, 0x53, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x61, 0x6e, 0x73,
+  0x00, 0x73, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x61, 0x00, 0x2d, 0x00, 0x53,
+  0x75, 0x6d, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c,
+  0x6c, 0x65, 0x64, 0x20, 0x73, 0x6f, 0x75, 0x74, 0x68, 0x65, 0x72, 0x6e,
+  0x20, 0x4d, 0x65, 0x73, 0x6f, 0x70, 0x6f, 0x74, 0x61, 0x6d, 0x69, 0x61,
+  0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+  0x69, 0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x42, 0x61, 0x62, 0x79, 0x6c,
+  0x6f, 0x6e, 0x69, 0x61, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x74,
+  0x73, 0x20, 0x6f, 0x66, 0x20, 0x53, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x61,
+  0x6e, 0x20, 0x77, 0x72, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x6f,
+  0x6d, 0x65, 0x20, 0x35, 0x35, 0x30, 0x30, 0x20, 0x79, 0x65, 0x61, 0x72,
+  0x73, 0x20, 0x6f, 0x6c, 0x64, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x62,
+  0x65, 0x65, 0x6e, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x2c, 0x20, 0x70,
+  0x72, 0x65, 0x2d, 0x64, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x76,
+  0x65, 0x72, 0x79, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x77, 0x72,
+  0x69, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e, 0x20, 0x68, 0x69, 0x73,
+  0x74, 0x6f, 0x72, 0x79, 0x2e, 0x00, 0x04, 0x0a, 0x53, 0x68, 0x75, 0x6c,
+  0x67, 0x69, 0x00, 0x47, 0x69, 0x6c, 0x67, 0x61, 0x6d, 0x65, 0x73, 0x68,
+  0x00, 0x55, 0x72, 0x2d, 0x4e, 0x61, 0x6e, 0x73, 0x68, 0x65, 0x00, 0x4c,
+  0x75, 0x67, 0x61, 0x6c, 0x2d, 0x5a, 0x61, 0x2d, 0x47, 0x65, 0x73, 0x69,
+  0x00, 0x45, 0x6e, 0x2d, 0x4d, 0x65, 0x72, 0x2d, 0x4b, 0x61, 0x72, 0x00,
+  0x55, 0x72, 0x75, 0x6b, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x00, 0x45, 0x74,
+  0x61, 0x6e, 0x61, 0x00, 0x55, 0x72, 0x2d, 0x4e, 0x61, 0x6d, 0x6d, 0x75,
+  0x00, 0x49, 0x62, 0x62, 0x69, 0x2d, 0x00, 0x48, 0x6f, 0x77, 0x20, 0x74,
+  0x72, 0x61, 0x69, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20,
+  0x61, 0x72, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x74, 0x6f,
+  0x20, 0x41, 0x49, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x2e,
+  0x00, 0x01, 0x00, 0xaf, 0x00, 0xa5, 0x0f, 0x00, 0x7e, 0x74, 0x75, 0x72,
+  0x6e, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x00, 0x54, 0x75, 0x72, 0x6e, 0x2d,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x67, 0x61, 0x6d,
+  0x65, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x00,
+  0x49, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74,
+  0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x2c, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x20,
+  0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x64, 0x76, 0x61, 0x6e,
+  0x63, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x61, 0x6c,
+  0x6c, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x20, 0x68, 0x61,
+  0x76, 0x65, 0x20, 0x66, 0x69, 0x6e, 0x69, 0x73, 0x68, 0x65, 0x64, 0x20,
+  0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x2c, 0x20,
+  0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x69,
+  0x73, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x70,
+  0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x2e, 0x00, 0x05, 0x01, 0xcd, 0x00,
+  0xa5, 0x0f, 0x00, 0x76, 0x75, 0x6e, 0x69, 0x74, 0x77, 0x61, 0x69, 0x74,
+  0x74, 0x69, 0x6d, 0x65, 0x00, 0x4d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d,
+  0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65,
+  0x6e, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x73, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74, 0x75, 0x72, 0x6e,
+  0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x00, 0x54, 0x68, 0x69, 0x73,
+  0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x67, 0x69, 0x76,
+  0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x69, 0x6e, 0x69, 0x6d,
+  0x75, 0x6d, 0x20, 0x61, 0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x65, 0x63,
+  0x6f, 0x6e, 0x64, 0x73, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e,
+  0x20, 0x75, 0x6e, 0x69, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x73, 0x69,
+  0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x20, 0x61, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x28, 0x73, 0x75, 0x63, 0x68, 0x20,
+  0x61, 0x73, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x20,
+  0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x29, 0x20, 0x61, 0x66, 0x74, 0x65,
+  0x72, 0x20, 0x61, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x63, 0x68, 0x61,
+  0x6e, 0x67, 0x65, 0x20, 0x6f, 0x63, 0x63, 0x75, 0x72, 0x73, 0x2e, 0x20,
+  0x46, 0x6f, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2c,
+  0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74,
+  0x74, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20,
+  0x74, 0x6f, 0x20, 0x32, 0x30, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x20,
+  0x75, 0x6e, 0x69, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x35,
+  0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x20, 0x62, 0x65, 0x66,
+  0x6f, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x75, 0x72, 0x6e,
+  0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x2c, 0x20, 0x69, 0x74, 0x20,
+  0x77, 0x69, 0x6c, 0x6c, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x20, 0x6f, 0x72, 0x20, 0x61, 0x63, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x74, 0x75, 0x72, 0x6e,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x74, 0x20, 0x6c, 0x65, 0x61, 0x73,
+  0x74, 0x20, 0x31, 0x35, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73,
+  0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x65, 0x64, 0x20,
+  0x74, 0x6f, 0x20, 0x61, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d,
+  0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x32, 0x2f,
+  0x33, 0x20, 0x27, 0x74, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x27, 0x2e,
+  0x00, 0x05, 0x01, 0x89, 0x00, 0xa5, 0x0f, 0x00, 0x64, 0x75, 0x6e, 0x72,
+  0x65, 0x61, 0x63, 0x68, 0x61, 0x62, 0x6c, 0x65, 0x70, 0x72, 0x6f, 0x74,
+  0x65, 0x63, 0x74, 0x73, 0x00, 0x44, 0x6f, 0x65, 0x73, 0x20, 0x75, 0x6e,
+  0x72, 0x65, 0x61, 0x63, 0x68, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x75, 0x6e,
+  0x69, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x74, 0x65, 0x63, 0x74, 0x20, 0x72,
+  0x65, 0x61, 0x63, 0x68, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x6e, 0x65,
+  0x73, 0x00, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x20, 0x77,
+  0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x73,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x75,
+  0x6e, 0x72, 0x65, 0x61, 0x63, 0x68, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x72, 0x65, 0x61, 0x63, 0x68, 0x61, 0x62, 0x6c, 0x65,
+  0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62,
+  0x65, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x2e, 0x20,
+  0x49, 0x66, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x2c,
+  0x20, 0x61, 0x6e, 0x79, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x72, 0x65, 0x61, 0x63, 0x68, 0x61, 0x62, 0x6c, 0x65,
+  0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62,
+  0x65, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x2e, 0x20,
+  0x49, 0x66, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x2c, 0x20,
+  0x74, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61,
+  0x6e, 0x20, 0x75, 0x6e, 0x72, 0x65, 0x61, 0x63, 0x68, 0x61, 0x62, 0x6c,
+  0x65, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x6d, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65,
+  0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x2e, 0x20, 0x53,
+  0x6f, 0x6d, 0x65, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x69, 0x6e,
+  0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x73, 0x65,
+  0x74, 0x73, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x72,
+  0x69, 0x64, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2c, 0x20, 0x6e, 0x65,
+  0x76, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x74, 0x65, 0x63, 0x74, 0x69,
+  0x6e, 0x67, 0x20, 0x72, 0x65, 0x61, 0x63, 0x68, 0x61, 0x62, 0x6c, 0x65,
+  0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x69, 0x72, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x2e, 0x00, 0x03, 0x01,
+  0xbb, 0x00, 0xa5, 0x0f, 0x00, 0x5f, 0x76, 0x69, 0x63, 0x74, 0x6f, 0x72,
+  0x69, 0x65, 0x73, 0x00, 0x57, 0x68, 0x61, 0x74, 0x20, 0x6b, 0x69, 0x6e,
+  0x64, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x76, 0x69, 0x63, 0x74, 0x6f, 0x72,
+  0x69, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x73,
+  0x69, 0x62, 0x6c, 0x65, 0x00, 0x54, 0x68, 0x69, 0x73, 0x20, 0x73, 0x65,
+  0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f,
+  0x6c, 0x73, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x20,
+  0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x77, 0x6f, 0x6e, 0x2e, 0x20,
+  0x4f, 0x6e, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x61, 0x6c, 0x77, 0x61,
+  0x79, 0x73, 0x20, 0x77, 0x69, 0x6e, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6f,
+  0x6e, 0x71, 0x75, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x6e, 0x74,
+  0x69, 0x72, 0x65, 0x20, 0x70, 0x6c, 0x61, 0x6e, 0x65, 0x74, 0x2c, 0x20,
+  0x62, 0x75, 0x74, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x76, 0x69,
+  0x63, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74,
+  0x69, 0x6f, 0x6e, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20,
+  0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x6f, 0x72, 0x20, 0x64,
+  0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x3a, 0x0a, 0x2d, 0x20, 0x22,
+  0x53, 0x70, 0x61, 0x63, 0x65, 0x72, 0x61, 0x63, 0x65, 0x22, 0x20, 0x28,
+  0x53, 0x50, 0x41, 0x43, 0x45, 0x52, 0x41, 0x43, 0x45, 0x29, 0x3a, 0x20,
+  0x53, 0x70, 0x61, 0x63, 0x65, 0x73, 0x68, 0x69, 0x70, 0x20, 0x69, 0x73,
+  0x20, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74,
+  0x72, 0x61, 0x76, 0x65, 0x6c, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x41, 0x6c,
+  0x70, 0x68, 0x61, 0x20, 0x43, 0x65, 0x6e, 0x74, 0x61, 0x75, 0x72, 0x69,
+  0x2e, 0x0a, 0x2d, 0x20, 0x22, 0x41, 0x6c, 0x6c, 0x69, 0x65, 0x64, 0x22,
+  0x20, 0x28, 0x41, 0x4c, 0x4c, 0x49, 0x45, 0x44, 0x29, 0x3a, 0x20, 0x41,
+  0x66, 0x74, 0x65, 0x72, 0x20, 0x64, 0x65, 0x66, 0x65, 0x61, 0x74, 0x69,
+  0x6e, 0x67, 0x20, 0x65, 0x6e, 0x65, 0x6d, 0x69, 0x65, 0x73, 0x2c, 0x20,
+  0x61, 0x6c, 0x6c, 0x20, 0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x69, 0x6e,
+  0x67, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x20, 0x61, 0x72,
+  0x65, 0x20, 0x61, 0x6c, 0x6c, 0x69, 0x65, 0x64, 0x2e, 0x0a, 0x2d, 0x20,
+  0x22, 0x43, 0x75, 0x6c, 0x74, 0x75, 0x72, 0x65, 0x22, 0x20, 0x28, 0x43,
+  0x55, 0x4c, 0x54, 0x55, 0x52, 0x45, 0x29, 0x3a, 0x20, 0x50, 0x6c, 0x61,
+  0x79, 0x65, 0x72, 0x20, 0x6d, 0x65, 0x65, 0x74, 0x73, 0x20, 0x72, 0x75,
+  0x6c, 0x65, 0x73, 0x65, 0x74, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x64, 0x20, 0x63, 0x75, 0x6c, 0x74, 0x75, 0x72, 0x61, 0x6c, 0x20, 0x64,
+  0x6f, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x72,
+  0x69, 0x74, 0x65, 0x72, 0x69, 0x61, 0x2e, 0x0a, 0x00, 0x05, 0x00, 0xa5,
+  0x00, 0xa5, 0x07, 0x00, 0x12, 0x77, 0x65, 0x74, 0x6e, 0x65, 0x73, 0x73,
+  0x00, 0x41, 0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x77,
+  0x61, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x6e, 0x20, 0x6c, 0x61, 0x6e, 0x64,
+  0x6d, 0x61, 0x73, 0x73, 0x65, 0x73, 0x00, 0x53, 0x6d, 0x61, 0x6c, 0x6c,
+  0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x6d, 0x65, 0x61, 0x6e,
+  0x20, 0x6c, 0x6f, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x64, 0x72, 0x79,
+  0x2c, 0x20, 0x64, 0x65, 0x73, 0x65, 0x72, 0x74, 0x2d, 0x6c, 0x69, 0x6b,
+  0x65, 0x20, 0x6c, 0x61, 0x6e, 0x64, 0x3b, 0x20, 0x68, 0x69, 0x67, 0x68,
+  0x65, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x67, 0x69,
+  0x76, 0x65, 0x20, 0x61, 0x20, 0x77, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20,
+  0x6d, 0x61, 0x70, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6d, 0x6f, 0x72,
+  0x65, 0x20, 0x73, 0x77, 0x61, 0x6d, 0x70, 0x73, 0x2c, 0x20, 0x6a, 0x75,
+  0x6e, 0x67, 0x6c, 0x65, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72,
+  0x69, 0x76, 0x65, 0x72, 0x73, 0x2e, 0x00, 0x00, 0x8b, 0x00, 0xa5, 0x07,
+  0x00, 0x06, 0x77, 0x72, 0x61, 0x70, 0x00, 0x4d, 0x61, 0x70, 0x20, 0x77,
+  0x72, 0x61, 0x70, 0x00, 0x46, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x20,
+  0x6d, 0x61, 0x70, 0x73, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x77, 0x72, 0x61,
+  0x70, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x72,
+  0x74, 0x68, 0x2d, 0x73, 0x6f, 0x75, 0x74, 0x68, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x65, 0x61, 0x73, 0x74, 0x2d, 0x77, 0x65, 0x73, 0x74, 0x20, 0x64,
+  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x74, 0x6f,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x61, 0x20, 0x66, 0x6c, 0x61, 0x74,
+  0x20, 0x6d, 0x61, 0x70, 0x2c, 0x20, 0x61, 0x20, 0x63, 0x79, 0x6c, 0x69,
+  0x6e, 0x64, 0x65, 0x72, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x74,
+  0x6f, 0x72, 0x75, 0x73, 0x20, 0x28, 0x64, 0x6f, 0x6e, 0x75, 0x74, 0x29,
+  0x2e, 0x00, 0x00, 0xb0, 0x00, 0xa5, 0x07, 0x00, 0x03, 0x78, 0x73, 0x69,
+  0x7a, 0x65, 0x00, 0x4d, 0x61, 0x70, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68,
+  0x20, 0x69, 0x6e, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x73, 0x00, 0x44, 0x65,
+  0x66, 0x69, 0x6e, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61,
+  0x70, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2e, 0x0a, 0x46, 0x6f, 0x72,
+  0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x74, 0x6f, 0x20, 0x74, 0x61, 0x6b, 0x65, 0x20, 0x65, 0x66, 0x66,
+  0x65, 0x63, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x22, 0x4d, 0x61,
+  0x70, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x28, 0x27, 0x6d, 0x61, 0x70, 0x73, 0x69, 0x7a, 0x65, 0x27,
+  0x29, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x73, 0x65,
+  0x74, 0x20, 0x74, 0x6f, 0x20, 0x22, 0x57, 0x69, 0x64, 0x74, 0x68, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x22, 0x20,
+  0x28, 0x58, 0x59, 0x53, 0x49, 0x5a, 0x45, 0x29, 0x2e, 0x00, 0x00, 0xb2,
+  0x6c, 0x65, 0x73, 0x65, 0x74, 0x2e, 0x0a, 0x2d, 0x20, 0x22, 0x50, 0x65,
+  0x72, 0x2d, 0x74, 0x65, 0x61, 0x6d, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x6f,
+  0x72, 0x64, 0x65, 0x72, 0x22, 0x20, 0x28, 0x54, 0x45, 0x41, 0x4d, 0x5f,
+  0x4f, 0x52, 0x44, 0x45, 0x52, 0x29, 0x3a, 0x20, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x73, 0x73, 0x69, 0x67,
+  0x6e, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x65, 0x61, 0x6d, 0x73,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69,
+  0x73, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75,
+  0x6c, 0x65, 0x73, 0x65, 0x74, 0x2e, 0x20, 0x45, 0x76, 0x65, 0x72, 0x79,
+  0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x6f, 0x6e, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x65, 0x61, 0x6d,
+  0x20, 0x67, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61,
+  0x6d, 0x65, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x2e, 0x0a, 0x2d, 0x20,
+  0x22, 0x50, 0x65, 0x72, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c,
+  0x20, 0x69, 0x6e, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x22, 0x20, 0x28,
+  0x4e, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x5f, 0x4f, 0x52, 0x44, 0x45, 0x52,
+  0x29, 0x3a, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75,
+  0x6c, 0x65, 0x73, 0x65, 0x74, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x73, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x61, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x27, 0x73,
+  0x20, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x74, 0x61, 0x6b, 0x65,
+  0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x2e, 0x20, 0x41, 0x6e, 0x79, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72,
+  0x73, 0x20, 0x77, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x6e, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x20, 0x64, 0x6f, 0x6e, 0x27, 0x74, 0x20, 0x68, 0x61,
+  0x76, 0x65, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65,
+  0x64, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x20, 0x67, 0x65, 0x74,
+  0x20, 0x61, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x20, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x72, 0x75, 0x6c, 0x65, 0x73, 0x65, 0x74, 0x2e, 0x0a, 0x52, 0x65,
+  0x67, 0x61, 0x72, 0x64, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67,
+  0x2c, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x76, 0x69, 0x64, 0x75, 0x61, 0x6c,
+  0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x63, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x64, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x20, 0x73, 0x74, 0x61,
+  0x72, 0x74, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x27, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x27, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x2e, 0x00,
+  0x05, 0x00, 0x70, 0x00, 0xa5, 0x0f, 0x00, 0x90, 0x70, 0x72, 0x6f, 0x66,
+  0x66, 0x69, 0x6c, 0x65, 0x00, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c,
+  0x65, 0x20, 0x6c, 0x6f, 0x67, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x54,
+  0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x6c, 0x6f, 0x67, 0x20,
+  0x66, 0x69, 0x6c, 0x65, 0x20, 0x69, 0x73, 0x20, 0x27, 0x66, 0x72, 0x65,
+  0x65, 0x63, 0x69, 0x76, 0x2d, 0x70, 0x72, 0x6f, 0x66, 0x2e, 0x6c, 0x6f,
+  0x67, 0x27, 0x2e, 0x00, 0x05, 0x01, 0x4e, 0x00, 0xa5, 0x0f, 0x00, 0x8f,
+  0x70, 0x72, 0x6f, 0x66, 0x6c, 0x6f, 0x67, 0x00, 0x46, 0x6f, 0x72, 0x6d,
+  0x61, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65,
+  0x72, 0x76, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+  0x20, 0x6c, 0x6f, 0x67, 0x00, 0x49, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73,
+  0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x64, 0x69, 0x73, 0x61,
+  0x62, 0x6c, 0x65, 0x64, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x69,
+  0x6d, 0x65, 0x20, 0x73, 0x70, 0x65, 0x6e, 0x74, 0x20, 0x62, 0x79, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x69,
+  0x6e, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x68, 0x61, 0x73, 0x65,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x75, 0x72, 0x6e,
+  0x2c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e,
+  0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x65, 0x6d,
+  0x6f, 0x72, 0x79, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+  0x20, 0x69, 0x74, 0x20, 0x63, 0x61, 0x75, 0x73, 0x65, 0x64, 0x2c, 0x20,
+  0x69, 0x73, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20,
+  0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x27, 0x70,
+  0x72, 0x6f, 0x66, 0x66, 0x69, 0x6c, 0x65, 0x27, 0x20, 0x65, 0x76, 0x65,
+  0x72, 0x79, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x2c, 0x20, 0x65, 0x69, 0x74,
+  0x68, 0x65, 0x72, 0x20, 0x61, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61,
+  0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x73, 0x20,
+  0x6f, 0x6e, 0x65, 0x20, 0x4a, 0x53, 0x4f, 0x4e, 0x20, 0x6f, 0x62, 0x6a,
+  0x65, 0x63, 0x74, 0x20, 0x70, 0x65, 0x72, 0x20, 0x6c, 0x69, 0x6e, 0x65,
+  0x2e, 0x00, 0x05, 0x00, 0xb5, 0x00, 0xa5, 0x0f, 0x00, 0x49, 0x72, 0x61,
+  0x70, 0x74, 0x75, 0x72, 0x65, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x00, 0x4e,
+  0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x75, 0x72,
+  0x6e, 0x73, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x72,
+  0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63,
+  0x74, 0x00, 0x53, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e,
+  0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x75, 0x72,
+  0x6e, 0x73, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x72,
+  0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x20, 0x67, 0x72, 0x6f, 0x77, 0x74,
+  0x68, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x63, 0x69, 0x74, 0x79, 0x2e,
+  0x20, 0x49, 0x66, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x6e,
+  0x20, 0x61, 0x20, 0x63, 0x69, 0x74, 0x79, 0x20, 0x77, 0x69, 0x6c, 0x6c,
+  0x20, 0x67, 0x72, 0x6f, 0x77, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20,
+  0x63, 0x65, 0x6c, 0x65, 0x62, 0x72, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x6e, 0x2b, 0x31, 0x20, 0x74, 0x75, 0x72, 0x6e,
+  0x73, 0x2e, 0x00, 0x01, 0x00, 0x9e, 0x00, 0xa5, 0x0f, 0x00, 0x4c, 0x72,
+  0x61, 0x7a, 0x65, 0x63, 0x68, 0x61, 0x6e, 0x63, 0x65, 0x00, 0x43, 0x68,
+  0x61, 0x6e, 0x63, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e,
+  0x71, 0x75, 0x65, 0x72, 0x65, 0x64, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64,
+  0x69, 0x6e, 0x67, 0x20, 0x64, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x00, 0x57, 0x68, 0x65, 0x6e, 0x20, 0x61, 0x20, 0x70,
+  0x6c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x71, 0x75, 0x65,
+  0x72, 0x73, 0x20, 0x61, 0x20, 0x63, 0x69, 0x74, 0x79, 0x2c, 0x20, 0x65,
+  0x61, 0x63, 0x68, 0x20, 0x63, 0x69, 0x74, 0x79, 0x20, 0x69, 0x6d, 0x70,
+  0x72, 0x6f, 0x76, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x68, 0x61, 0x73,
+  0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6e,
+  0x74, 0x61, 0x67, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x63, 0x65, 0x20,
+  0x74, 0x6f, 0x20, 0x62, 0x65, 0x20, 0x64, 0x65, 0x73, 0x74, 0x72, 0x6f,
+  0x79, 0x65, 0x64, 0x2e, 0x00, 0x03, 0x00, 0xa7, 0x00, 0xa5, 0x0f, 0x00,
+  0x63, 0x72, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x69, 0x6e, 0x66,
+  0x72, 0x61, 0x00, 0x52, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x72, 0x61, 0x73, 0x74, 0x72, 0x75,
+  0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x6e,
+  0x65, 0x6d, 0x79, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x73, 0x00, 0x49, 0x66,
+  0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x69, 0x73, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x2c,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x66, 0x20,
+  0x72, 0x6f, 0x61, 0x64, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x61,
+  0x69, 0x6c, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20,
+  0x72, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x65, 0x64, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x65, 0x6e, 0x65, 0x6d, 0x79, 0x20, 0x75, 0x6e, 0x69,
+  0x74, 0x73, 0x2e, 0x00, 0x03, 0x01, 0x68, 0x00, 0xa5, 0x0f, 0x00, 0x72,
+  0x72, 0x65, 0x76, 0x65, 0x61, 0x6c, 0x6d, 0x61, 0x70, 0x00, 0x52, 0x65,
+  0x76, 0x65, 0x61, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x70,
+  0x00, 0x49, 0x66, 0x20, 0x22, 0x52, 0x65, 0x76, 0x65, 0x61, 0x6c, 0x20,
+  0x6d, 0x61, 0x70, 0x20, 0x61, 0x74, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x20,
+  0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x20, 0x28, 0x53, 0x54, 0x41, 0x52,
+  0x54, 0x29, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x2c, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x20, 0x73,
+  0x74, 0x61, 0x74, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x65, 0x6e, 0x74, 0x69, 0x72, 0x65, 0x20, 0x6d, 0x61, 0x70, 0x20, 0x77,
+  0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x6b, 0x6e, 0x6f, 0x77, 0x6e,
+  0x20, 0x74, 0x6f, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x70, 0x6c, 0x61, 0x79,
+  0x65, 0x72, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x61, 0x6c, 0x74, 0x68,
+  0x6f, 0x75, 0x67, 0x68, 0x20, 0x69, 0x74, 0x20, 0x6d, 0x61, 0x79, 0x20,
+  0x73, 0x74, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x66, 0x6f, 0x67,
+  0x67, 0x65, 0x64, 0x20, 0x28, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x69,
+  0x6e, 0x67, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x27, 0x66,
+  0x6f, 0x67, 0x6f, 0x66, 0x77, 0x61, 0x72, 0x27, 0x20, 0x73, 0x65, 0x74,
+  0x74, 0x69, 0x6e, 0x67, 0x29, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x22, 0x55,
+  0x6e, 0x66, 0x6f, 0x67, 0x20, 0x6d, 0x61, 0x70, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x64, 0x65, 0x61, 0x64, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72,
+  0x73, 0x22, 0x20, 0x28, 0x44, 0x45, 0x41, 0x44, 0x29, 0x20, 0x69, 0x73,
+  0x20, 0x73, 0x65, 0x74, 0x2c, 0x20, 0x64, 0x65, 0x61, 0x64, 0x20, 0x70,
+  0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x73,
+  0x65, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x72,
+  0x65, 0x20, 0x6d, 0x61, 0x70, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6c, 0x6f, 0x6e, 0x65,
+  0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x74, 0x65,
+  0x61, 0x6d, 0x2e, 0x00, 0x03, 0x00, 0xc7, 0x00, 0xa5, 0x0f, 0x00, 0x5a,
+  0x72, 0x65, 0x76, 0x6f, 0x6c, 0x65, 0x6e, 0x00, 0x4c, 0x65, 0x6e, 0x67,
+  0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x65, 0x76, 0x6f, 0x6c, 0x75,
+  0x74, 0x69, 0x6f, 0x6e, 0x00, 0x57, 0x68, 0x65, 0x6e, 0x20, 0x63, 0x68,
+  0x61, 0x6e, 0x67, 0x69, 0x6e, 0x67, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72,
+  0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2c, 0x20, 0x61, 0x20, 0x70, 0x65,
+  0x72, 0x69, 0x6f, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x61, 0x72,
+  0x63, 0x68, 0x79, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x6f, 0x63, 0x63,
+  0x75, 0x72, 0x2e, 0x20, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e,
+  0x67, 0x2c, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x77, 0x61, 0x79, 0x20, 0x27, 0x72, 0x65, 0x76, 0x6f, 0x6c, 0x65, 0x6e,
+  0x74, 0x79, 0x70, 0x65, 0x27, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e,
+  0x67, 0x20, 0x64, 0x69, 0x63, 0x74, 0x61, 0x74, 0x65, 0x73, 0x2c, 0x20,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x65, 0x73, 0x74, 0x72, 0x6f, 0x79,
+  0x20, 0x69, 0x74, 0x2e, 0x03, 0x43, 0x69, 0x74, 0x79, 0x20, 0x63, 0x65,
+  0x6e, 0x74, 0x65, 0x72, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x67,
+  0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x74, 0x65, 0x72,
+  0x72, 0x61, 0x69, 0x6e, 0x27, 0x73, 0x20, 0x69, 0x72, 0x72, 0x69, 0x67,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x6f, 0x6e, 0x75, 0x73, 0x20,
+  0x61, 0x75, 0x74, 0x6f, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x6c,
+  0x79, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20,
+  0x69, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x6c, 0x69,
+  0x63, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x6d, 0x69, 0x6e, 0x65, 0x20, 0x6f,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x3b, 0x20,
+  0x68, 0x6f, 0x77, 0x65, 0x76, 0x65, 0x72, 0x2c, 0x20, 0x74, 0x68, 0x69,
+  0x73, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6d,
+  0x61, 0x6b, 0x65, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x77, 0x61,
+  0x74, 0x65, 0x72, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x66, 0x75, 0x72, 0x74, 0x68, 0x65, 0x72, 0x20, 0x69,
+  0x72, 0x72, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x49,
+  0x72, 0x72, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x61,
+  0x6e, 0x20, 0x62, 0x65, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x20, 0x6f,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x69, 0x74, 0x79, 0x20, 0x74,
+  0x69, 0x6c, 0x65, 0x20, 0x73, 0x69, 0x6d, 0x70, 0x6c, 0x79, 0x20, 0x74,
+  0x6f, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x20, 0x62, 0x75, 0x69, 0x6c,
+  0x64, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x75, 0x72, 0x74, 0x68, 0x65, 0x72,
+  0x20, 0x69, 0x72, 0x72, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x65, 0x6c, 0x73, 0x65, 0x77, 0x68, 0x65, 0x72, 0x65, 0x2c, 0x20, 0x62,
+  0x75, 0x74, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x67, 0x69, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x69, 0x6c,
+  0x65, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x66, 0x75, 0x72, 0x74, 0x68, 0x65,
+  0x72, 0x20, 0x62, 0x6f, 0x6e, 0x75, 0x73, 0x2e, 0x03, 0x00, 0x01, 0x6f,
+  0x00, 0xe8, 0xd7, 0x08, 0x00, 0x03, 0xa8, 0x01, 0x3f, 0x65, 0x78, 0x74,
+  0x72, 0x61, 0x3a, 0x4d, 0x69, 0x6e, 0x65, 0x00, 0x4d, 0x69, 0x6e, 0x65,
+  0x00, 0x02, 0x00, 0x75, 0x6e, 0x69, 0x74, 0x2e, 0x6d, 0x69, 0x6e, 0x65,
+  0x00, 0x75, 0x6e, 0x69, 0x74, 0x2e, 0x70, 0x6c, 0x61, 0x6e, 0x74, 0x00,
+  0x74, 0x78, 0x2e, 0x6d, 0x69, 0x6e, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4d, 0x69, 0x6e, 0x65, 0x73, 0x20, 0x63, 0x61,
+  0x6e, 0x20, 0x62, 0x65, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x20, 0x6f,
+  0x6e, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x65, 0x72, 0x72, 0x61, 0x69, 0x6e, 0x2c,
+  0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x6e, 0x63, 0x72, 0x65,
+  0x61, 0x73, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d,
+  0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73,
+  0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x65, 0x64, 0x20, 0x62, 0x79,
+  0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x2e, 0x20,
+  0x48, 0x69, 0x6c, 0x6c, 0x73, 0x20, 0x67, 0x65, 0x74, 0x20, 0x61, 0x6e,
+  0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x33, 0x20, 0x70, 0x72, 0x6f,
+  0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x6f, 0x69, 0x6e,
+  0x74, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x3b,
+  0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x65, 0x72, 0x72, 0x61,
+  0x69, 0x6e, 0x73, 0x20, 0x67, 0x65, 0x74, 0x20, 0x31, 0x20, 0x65, 0x78,
+  0x74, 0x72, 0x61, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2e, 0x03, 0x42, 0x75,
+  0x69, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 0x6d, 0x69, 0x6e,
+  0x65, 0x20, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x20, 0x69, 0x72, 0x72, 0x69,
+  0x67, 0x61, 0x74, 0x65, 0x64, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x20, 0x77,
+  0x69, 0x6c, 0x6c, 0x20, 0x64, 0x65, 0x73, 0x74, 0x72, 0x6f, 0x79, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x69, 0x72, 0x72, 0x69, 0x67, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x2e, 0x03, 0x00, 0x07, 0x9f, 0x00, 0xe8, 0xff, 0x6a, 0x00,
+  0x02, 0xa4, 0x02, 0x50, 0x6f, 0x6c, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e,
+  0x00, 0x50, 0x6f, 0x6c, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x02,
+  0x30, 0x00, 0x02, 0x4e, 0x6f, 0x6e, 0x65, 0x00, 0x2d, 0x00, 0x75, 0x6e,
+  0x69, 0x74, 0x2e, 0x70, 0x6f, 0x6c, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e,
+  0x00, 0x74, 0x78, 0x2e, 0x70, 0x6f, 0x6c, 0x6c, 0x75, 0x74, 0x69, 0x6f,
+  0x6e, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x6f, 0x6c, 0x6c, 0x75,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x73,
+  0x20, 0x6f, 0x6e, 0x20, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x69, 0x6c,
+  0x65, 0x73, 0x20, 0x61, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x63, 0x69,
+  0x74, 0x69, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x68, 0x69,
+  0x67, 0x68, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x6f, 0x72, 0x20, 0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x77, 0x68, 0x65, 0x6e,
+  0x20, 0x61, 0x20, 0x4e, 0x75, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20, 0x75,
+  0x6e, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x64, 0x65, 0x74, 0x6f, 0x6e,
+  0x61, 0x74, 0x65, 0x64, 0x2e, 0x20, 0x49, 0x74, 0x20, 0x68, 0x61, 0x6c,
+  0x76, 0x65, 0x73, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x69, 0x74, 0x73, 0x20,
+  0x74, 0x69, 0x6c, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f,
+  0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6f,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x69, 0x73, 0x6b, 0x20, 0x6f, 0x66,
+  0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x77, 0x61, 0x72, 0x6d,
+  0x69, 0x6e, 0x67, 0x2e, 0x03, 0x54, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x6c,
+  0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x6f,
+  0x6e, 0x6c, 0x79, 0x20, 0x62, 0x65, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72,
+  0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74,
+  0x63, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x53, 0x65, 0x74, 0x74, 0x6c, 0x65,
+  0x72, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x45, 0x6e, 0x67, 0x69, 0x6e, 0x65,
+  0x65, 0x72, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x22, 0x63, 0x6c, 0x65, 0x61, 0x6e, 0x20, 0x70, 0x6f, 0x6c, 0x6c,
+  0x75, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72,
+  0x2e, 0x03, 0x50, 0x6f, 0x6c, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x6b, 0x65, 0x6c,
+  0x79, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x62,
+  0x65, 0x63, 0x6f, 0x6d, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x6d, 0x70, 0x6f,
+  0x72, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x61, 0x73, 0x20, 0x79, 0x6f, 0x75,
+  0x72, 0x20, 0x63, 0x69, 0x76, 0x69, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x62, 0x65, 0x63, 0x6f, 0x6d, 0x65, 0x73, 0x20, 0x6d,
+  0x6f, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x75, 0x73, 0x74, 0x72, 0x69,
+  0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x2c, 0x20, 0x67, 0x69, 0x76, 0x69,
+  0x6e, 0x67, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64,
+  0x69, 0x6e, 0x67, 0x73, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x73,
+  0x20, 0x46, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x50, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x50, 0x6c, 0x61, 0x6e, 0x74,
+  0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x62, 0x6f, 0x6f, 0x73, 0x74,
+  0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2e,
+  0x20, 0x52, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x20, 0x61,
+  0x20, 0x50, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x50, 0x6c, 0x61, 0x6e, 0x74,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x6e, 0x65,
+  0x72, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x65,
+  0x6e, 0x65, 0x72, 0x67, 0x79, 0x20, 0x2d, 0x2d, 0x20, 0x61, 0x20, 0x48,
+  0x79, 0x64, 0x72, 0x6f, 0x20, 0x50, 0x6c, 0x61, 0x6e, 0x74, 0x20, 0x2f,
+  0x20, 0x48, 0x6f, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x44, 0x61, 0x6d, 0x2c,
+  0x20, 0x4e, 0x75, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20, 0x50, 0x6c, 0x61,
+  0x6e, 0x74, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x53, 0x6f, 0x6c, 0x61, 0x72,
+  0x20, 0x50, 0x6c, 0x61, 0x6e, 0x74, 0x20, 0x2d, 0x2d, 0x20, 0x77, 0x69,
+  0x6c, 0x6c, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x20, 0x70, 0x6f,
+  0x6c, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2c,
+  0x20, 0x61, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x61, 0x20, 0x52,
+  0x65, 0x63, 0x79, 0x63, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x43, 0x65, 0x6e,
+  0x74, 0x65, 0x72, 0x2e, 0x03, 0x54, 0x68, 0x65, 0x20, 0x63, 0x69, 0x74,
+  0x79, 0x27, 0x73, 0x20, 0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x20, 0x61, 0x64,
+  0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x6f, 0x6c, 0x6c,
+  0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x64, 0x69, 0x73, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x79,
+  0x20, 0x6f, 0x66, 0x20, 0x49, 0x6e, 0x64, 0x75, 0x73, 0x74, 0x72, 0x69,
+  0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x41, 0x75, 0x74, 0x6f, 0x6d, 0x6f, 0x62, 0x69, 0x6c,
+  0x65, 0x2c, 0x20, 0x4d, 0x61, 0x73, 0x73, 0x20, 0x50, 0x72, 0x6f, 0x64,
+  0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x50, 0x6c, 0x61, 0x73, 0x74, 0x69, 0x63, 0x73, 0x20, 0x6d, 0x61, 0x6b,
+  0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x77, 0x6f, 0x72, 0x73, 0x65,
+  0x2e, 0x20, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61,
+  0x20, 0x4d, 0x61, 0x73, 0x73, 0x20, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x69,
+  0x74, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x63, 0x69, 0x74, 0x79, 0x20,
+  0x65, 0x6c, 0x69, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x27, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x6f, 0x6c, 0x6c,
+  0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x03, 0x54, 0x68, 0x65, 0x20, 0x63,
+  0x6f, 0x6e, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x73, 0x65, 0x20, 0x66, 0x61, 0x63,
+  0x74, 0x6f, 0x72, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20,
+  0x73, 0x65, 0x65, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x63, 0x69, 0x74, 0x79, 0x20, 0x64, 0x69, 0x61, 0x6c, 0x6f, 0x67, 0x3b,
+  0x20, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x74, 0x20, 0x65, 0x78, 0x63,
+  0x65, 0x65, 0x64, 0x73, 0x20, 0x61, 0x20, 0x74, 0x68, 0x72, 0x65, 0x73,
+  0x68, 0x6f, 0x6c, 0x64, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78,
+  0x63, 0x65, 0x73, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x70, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x20, 0x63, 0x68, 0x61, 0x6e,
+  0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x6f, 0x6c, 0x6c, 0x75, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x69, 0x6e,
+  0x67, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x2e,
+  0x03, 0x57, 0x68, 0x65, 0x6e, 0x20, 0x61, 0x6e, 0x20, 0x75, 0x6e, 0x75,
+  0x73, 0x65, 0x64, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x20, 0x62, 0x65, 0x63,
+  0x6f, 0x6d, 0x65, 0x73, 0x20, 0x70, 0x6f, 0x6c, 0x6c, 0x75, 0x74, 0x65,
+  0x64, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x74, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x76, 0x6f, 0x69, 0x64, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x65, 0x66, 0x66, 0x6f, 0x72, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x69,
+  0x74, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x25, 0x73, 0x00, 0x4c, 0x61,
+  0x64, 0x79, 0x20, 0x50, 0x72, 0x6f, 0x74, 0x65, 0x63, 0x74, 0x6f, 0x72,
+  0x20, 0x25, 0x73, 0x00, 0x00, 0x2b, 0x00, 0x8f, 0x0e, 0x00, 0x08, 0x41,
+  0x72, 0x63, 0x68, 0x62, 0x69, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x25, 0x73,
+  0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x41, 0x72, 0x63,
+  0x68, 0x62, 0x69, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x07, 0x00, 0x8f, 0x02, 0x00, 0x09, 0x00, 0x1f, 0x00, 0x8f, 0x0e, 0x00,
+  0x0b, 0x47, 0x75, 0x72, 0x75, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65,
+  0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x47, 0x75, 0x72, 0x75, 0x20, 0x25, 0x73,
+  0x00, 0x00, 0x29, 0x00, 0x8f, 0x0e, 0x00, 0x0e, 0x41, 0x79, 0x61, 0x74,
+  0x6f, 0x6c, 0x6c, 0x61, 0x68, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65,
+  0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x41, 0x79, 0x61, 0x74, 0x6f, 0x6c, 0x6c,
+  0x61, 0x68, 0x20, 0x25, 0x73, 0x00, 0x00, 0x21, 0x00, 0x8f, 0x0e, 0x00,
+  0x10, 0x50, 0x61, 0x74, 0x72, 0x69, 0x61, 0x72, 0x63, 0x68, 0x20, 0x25,
+  0x73, 0x00, 0x4d, 0x61, 0x74, 0x72, 0x69, 0x61, 0x72, 0x63, 0x68, 0x20,
+  0x25, 0x73, 0x00, 0x00, 0x27, 0x00, 0x8f, 0x0e, 0x00, 0x12, 0x43, 0x61,
+  0x72, 0x64, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66,
+  0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x43, 0x61, 0x72, 0x64, 0x69, 0x6e,
+  0x61, 0x6c, 0x20, 0x25, 0x73, 0x00, 0x00, 0x28, 0x00, 0x8f, 0x0e, 0x00,
+  0x17, 0x48, 0x69, 0x67, 0x68, 0x20, 0x50, 0x72, 0x69, 0x65, 0x73, 0x74,
+  0x20, 0x25, 0x73, 0x00, 0x48, 0x69, 0x67, 0x68, 0x20, 0x50, 0x72, 0x69,
+  0x65, 0x73, 0x74, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x01, 0x84,
+  0x00, 0x91, 0xbd, 0x05, 0x01, 0x00, 0x00, 0x00, 0x51, 0x07, 0x00, 0x01,
+  0x00, 0x52, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x00, 0x52, 0x65,
+  0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x00, 0x67, 0x6f, 0x76, 0x2e, 0x72,
+  0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x00, 0x55, 0x6e, 0x64, 0x65,
+  0x72, 0x20, 0x61, 0x20, 0x52, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63,
+  0x61, 0x6e, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e, 0x6d, 0x65, 0x6e,
+  0x74, 0x2c, 0x20, 0x63, 0x69, 0x74, 0x69, 0x7a, 0x65, 0x6e, 0x73, 0x20,
+  0x68, 0x6f, 0x6c, 0x64, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x20, 0x61, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65,
+  0x6e, 0x74, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x77, 0x68, 0x6f, 0x20,
+  0x77, 0x69, 0x6c, 0x6c, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x6d, 0x3b, 0x20, 0x73, 0x69, 0x6e, 0x63, 0x65, 0x20,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6c, 0x65, 0x61, 0x64,
+  0x65, 0x72, 0x73, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x72, 0x65, 0x6d,
+  0x61, 0x69, 0x6e, 0x20, 0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x72, 0x20,
+  0x74, 0x6f, 0x20, 0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x20, 0x69, 0x6e,
+  0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x2c, 0x20, 0x63, 0x69,
+  0x74, 0x69, 0x7a, 0x65, 0x6e, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x67,
+  0x69, 0x76, 0x65, 0x6e, 0x20, 0x61, 0x20, 0x67, 0x72, 0x65, 0x61, 0x74,
+  0x65, 0x72, 0x20, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x66, 0x72, 0x65, 0x65, 0x64, 0x6f, 0x6d, 0x2e, 0x20, 0x20, 0x43,
+  0x69, 0x74, 0x69, 0x7a, 0x65, 0x6e, 0x73, 0x20, 0x75, 0x6e, 0x64, 0x65,
+  0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52, 0x65, 0x70, 0x75, 0x62, 0x6c,
+  0x69, 0x63, 0x20, 0x62, 0x65, 0x63, 0x6f, 0x6d, 0x65, 0x20, 0x75, 0x6e,
+  0x68, 0x61, 0x70, 0x70, 0x79, 0x20, 0x65, 0x61, 0x73, 0x69, 0x6c, 0x79,
+  0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65,
+  0x6c, 0x66, 0x2d, 0x73, 0x75, 0x66, 0x66, 0x69, 0x63, 0x69, 0x65, 0x6e,
+  0x63, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x72, 0x20, 0x63,
+  0x69, 0x74, 0x69, 0x7a, 0x65, 0x6e, 0x73, 0x20, 0x61, 0x6c, 0x6c, 0x6f,
+  0x77, 0x73, 0x20, 0x68, 0x69, 0x67, 0x68, 0x20, 0x6c, 0x65, 0x76, 0x65,
+  0x6c, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x2e,
+  0x03, 0x00, 0x00, 0x26, 0x00, 0x8f, 0x0f, 0x05, 0x00, 0x00, 0x53, 0x70,
+  0x65, 0x61, 0x6b, 0x65, 0x72, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65,
+  0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x53, 0x70, 0x65, 0x61, 0x6b, 0x65, 0x72,
+  0x20, 0x25, 0x73, 0x00, 0x00, 0x07, 0x00, 0x8f, 0x02, 0x00, 0x01, 0x00,
+  0x23, 0x00, 0x8f, 0x0e, 0x00, 0x04, 0x53, 0x70, 0x6f, 0x6b, 0x65, 0x73,
+  0x6d, 0x61, 0x6e, 0x20, 0x25, 0x73, 0x00, 0x53, 0x70, 0x6f, 0x6b, 0x65,
+  0x73, 0x77, 0x6f, 0x6d, 0x61, 0x6e, 0x20, 0x25, 0x73, 0x00, 0x00, 0x25,
+  0x00, 0x8f, 0x0e, 0x00, 0x0b, 0x4d, 0x61, 0x68, 0x61, 0x74, 0x6d, 0x61,
+  0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a,
+  0x4d, 0x61, 0x68, 0x61, 0x74, 0x6d, 0x61, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x23, 0x00, 0x8f, 0x0e, 0x00, 0x0c, 0x53, 0x68, 0x6f, 0x67, 0x75, 0x6e,
+  0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a,
+  0x53, 0x68, 0x6f, 0x67, 0x75, 0x6e, 0x20, 0x25, 0x73, 0x00, 0x00, 0x23,
+  0x00, 0x8f, 0x0e, 0x00, 0x11, 0x53, 0x70, 0x6f, 0x6b, 0x65, 0x73, 0x6d,
+  0x61, 0x6e, 0x20, 0x25, 0x73, 0x00, 0x53, 0x70, 0x6f, 0x6b, 0x65, 0x73,
+  0x77, 0x6f, 0x6d, 0x61, 0x6e, 0x20, 0x25, 0x73, 0x00, 0x00, 0x07, 0x00,
+  0x8f, 0x02, 0x00, 0x14, 0x00, 0x23, 0x00, 0x8f, 0x0e, 0x00, 0x17, 0x43,
+  0x6f, 0x6e, 0x73, 0x75, 0x6c, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65,
+  0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x43, 0x6f, 0x6e, 0x73, 0x75, 0x6c, 0x20,
+  0x25, 0x73, 0x00, 0x02, 0x2f, 0x00, 0x91, 0xbd, 0x06, 0x01, 0x00, 0x00,
+  0x00, 0x15, 0x07, 0x00, 0x01, 0x00, 0x44, 0x65, 0x6d, 0x6f, 0x63, 0x72,
+  0x61, 0x63, 0x79, 0x00, 0x44, 0x65, 0x6d, 0x6f, 0x63, 0x72, 0x61, 0x63,
+  0x79, 0x00, 0x67, 0x6f, 0x76, 0x2e, 0x64, 0x65, 0x6d, 0x6f, 0x63, 0x72,
+  0x61, 0x63, 0x79, 0x00, 0x55, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x44, 0x65,
+  0x6d, 0x6f, 0x63, 0x72, 0x61, 0x63, 0x79, 0x2c, 0x20, 0x63, 0x69, 0x74,
+  0x69, 0x7a, 0x65, 0x6e, 0x73, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e,
+  0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6c, 0x79, 0x20, 0x62, 0x79,
+  0x20, 0x76, 0x6f, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x6e, 0x20, 0x69,
+  0x73, 0x73, 0x75, 0x65, 0x73, 0x2e, 0x20, 0x44, 0x65, 0x6d, 0x6f, 0x63,
+  0x72, 0x61, 0x63, 0x79, 0x20, 0x6f, 0x66, 0x66, 0x65, 0x72, 0x73, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65, 0x73, 0x74, 0x20,
+  0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x6c, 0x65, 0x76,
+  0x65, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x2c,
+  0x20, 0x62, 0x75, 0x74, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x6f, 0x66,
+  0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x73,
+  0x74, 0x20, 0x70, 0x6f, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x75, 0x6e, 0x68, 0x61, 0x70, 0x70, 0x69, 0x6e,
+  0x65, 0x73, 0x73, 0x2e, 0x20, 0x20, 0x54, 0x68, 0x65, 0x72, 0x65, 0x20,
+  0x69, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x75, 0x70,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x72, 0x20, 0x77, 0x61, 0x73, 0x74,
+  0x65, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x44, 0x65, 0x6d,
+  0x6f, 0x63, 0x72, 0x61, 0x63, 0x79, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20,
+  0x63, 0x69, 0x74, 0x69, 0x7a, 0x65, 0x6e, 0x73, 0x20, 0x62, 0x65, 0x63,
+  0x6f, 0x6d, 0x65, 0x20, 0x76, 0x65, 0x72, 0x79, 0x20, 0x75, 0x70, 0x73,
+  0x65, 0x74, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x77, 0x61,
+  0x72, 0x73, 0x2e, 0x03, 0x42, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 0x20,
+  0x28, 0x68, 0x61, 0x70, 0x70, 0x79, 0x29, 0x20, 0x63, 0x69, 0x74, 0x69,
+  0x7a, 0x65, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x44, 0x65, 0x6d, 0x6f,
+  0x63, 0x72, 0x61, 0x63, 0x79, 0x20, 0x62, 0x65, 0x6c, 0x69, 0x65, 0x76,
+  0x65, 0x20, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x6c, 0x79, 0x20, 0x69,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e,
+  0x6d, 0x65, 0x6e, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20,
+  0x6c, 0x6f, 0x79, 0x61, 0x6c, 0x74, 0x79, 0x20, 0x69, 0x73, 0x20, 0x75,
+  0x6e, 0x73, 0x77, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x20,
+  0x4d, 0x69, 0x6c, 0x69, 0x74, 0x61, 0x72, 0x79, 0x20, 0x75, 0x6e, 0x69,
+  0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x44, 0x65, 0x6d, 0x6f, 0x63, 0x72,
+  0x61, 0x74, 0x69, 0x63, 0x20, 0x63, 0x69, 0x76, 0x69, 0x6c, 0x69, 0x7a,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f,
+  0x74, 0x20, 0x62, 0x65, 0x20, 0x62, 0x72, 0x69, 0x62, 0x65, 0x64, 0x2c,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x44, 0x65, 0x6d, 0x6f, 0x63, 0x72, 0x61,
+  0x74, 0x69, 0x63, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x63,
+  0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6e, 0x63,
+  0x69, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x76, 0x6f,
+  0x6c, 0x74, 0x20, 0x62, 0x79, 0x20, 0x65, 0x6e, 0x65, 0x6d, 0x79, 0x20,
+  0x44, 0x69, 0x70, 0x6c, 0x6f, 0x6d, 0x61, 0x74, 0x73, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x53, 0x70, 0x69, 0x65, 0x73, 0x2e, 0x03, 0x00, 0x00, 0x26,
+  0x00, 0x8f, 0x0f, 0x06, 0x00, 0x04, 0x53, 0x70, 0x65, 0x61, 0x6b, 0x65,
+  0x72, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65,
+  0x3a, 0x53, 0x70, 0x65, 0x61, 0x6b, 0x65, 0x72, 0x20, 0x25, 0x73, 0x00,
+  0x00, 0x33, 0x00, 0x8f, 0x0e, 0x00, 0x07, 0x50, 0x72, 0x69, 0x6d, 0x65,
+  0x20, 0x4d, 0x69, 0x6e, 0x69, 0x73, 0x74, 0x65, 0x72, 0x20, 0x25, 0x73,
+  0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x50, 0x72, 0x69,
+  0x6d, 0x65, 0x20, 0x4d, 0x69, 0x6e, 0x69, 0x73, 0x74, 0x65, 0x72, 0x20,
+  0x25, 0x73, 0x00, 0x00, 0x25, 0x00, 0x8f, 0x0e, 0x00, 0x08, 0x50, 0x72,
+  0x65, 0x6d, 0x69, 0x65, 0x72, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65,
+  0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x50, 0x72, 0x65, 0x6d, 0x69, 0x65, 0x72,
+  0x20, 0x25, 0x73, 0x00, 0x00, 0x2b, 0x00, 0x8f, 0x0e, 0x00, 0x09, 0x43,
+  0x68, 0x61, 0x6e, 0x63, 0x65, 0x6c, 0x6c, 0x6f, 0x72, 0x20, 0x25, 0x73,
+  0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x43, 0x68, 0x61,
+  0x6e, 0x63, 0x65, 0x6c, 0x6c, 0x6f, 0x72, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x33, 0x00, 0x8f, 0x0e, 0x00, 0x0a, 0x50, 0x72, 0x69, 0x6d, 0x65, 0x20,
+  0x4d, 0x69, 0x6e, 0x69, 0x73, 0x74, 0x65, 0x72, 0x20, 0x25, 0x73, 0x00,
+  0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x50, 0x72, 0x69, 0x6d,
+  0x65, 0x20, 0x4d, 0x69, 0x6e, 0x69, 0x73, 0x74, 0x65, 0x72, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x07, 0x00, 0x8f, 0x02, 0x00, 0x0c, 0x00, 0x35, 0x00,
+  0x8f, 0x0e, 0x00, 0x11, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x69, 0x70, 0x61,
+  0x6c, 0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x3f,
+  0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x50, 0x72, 0x69, 0x6e, 0x63,
+  0x69, 0x70, 0x61, 0x6c, 0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x33, 0x00, 0x8f, 0x0e, 0x00, 0x12, 0x50, 0x72, 0x69,
+  0x6d, 0x65, 0x20, 0x4d, 0x69, 0x6e, 0x69, 0x73, 0x74, 0x65, 0x72, 0x20,
+  0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x50,
+  0x72, 0x69, 0x6d, 0x65, 0x20, 0x4d, 0x69, 0x6e, 0x69, 0x73, 0x74, 0x65,
+  0x72, 0x20, 0x25, 0x73, 0x00, 0x00, 0x07, 0x00, 0x8f, 0x02, 0x00, 0x13,
+  0x00, 0x35, 0x00, 0x8f, 0x0e, 0x00, 0x14, 0x50, 0x72, 0x69, 0x6e, 0x63,
+  0x69, 0x70, 0x61, 0x6c, 0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25,
+  0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x50, 0x72,
+  0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x20, 0x43, 0x68, 0x69, 0x65,
+  0x66, 0x20, 0x25, 0x73, 0x00, 0x00, 0x29, 0x00, 0x8f, 0x0e, 0x00, 0x17,
+  0x50, 0x72, 0x65, 0x73, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x20, 0x25, 0x73,
+  0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x50, 0x72, 0x65,
+  0x73, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x20, 0x25, 0x73, 0x00, 0x00, 0x0e,
+  0x00, 0xe6, 0x03, 0x0d, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x00,
+  0x00, 0x11, 0x00, 0xe6, 0x03, 0x0e, 0x43, 0x61, 0x6e, 0x50, 0x69, 0x6c,
+  0x6c, 0x61, 0x67, 0x65, 0x00, 0x00, 0x3d, 0x00, 0xe6, 0x07, 0x0f, 0x43,
+  0x61, 0x6e, 0x46, 0x6f, 0x72, 0x74, 0x69, 0x66, 0x79, 0x00, 0x47, 0x65,
+  0x74, 0x73, 0x20, 0x61, 0x20, 0x35, 0x30, 0x25, 0x20, 0x64, 0x65, 0x66,
+  0x65, 0x6e, 0x73, 0x69, 0x76, 0x65, 0x20, 0x62, 0x6f, 0x6e, 0x75, 0x73,
+  0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x63, 0x69,
+  0x74, 0x69, 0x65, 0x73, 0x2e, 0x00, 0x00, 0x17, 0x00, 0xe6, 0x07, 0x10,
+  0x55, 0x43, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x52, 0x5f, 0x46, 0x4c, 0x41,
+  0x47, 0x5f, 0x34, 0x00, 0x00, 0x00, 0x16, 0x00, 0xe6, 0x03, 0x11, 0x55,
+  0x43, 0x46, 0x5f, 0x55, 0x53, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5a, 0x69, 0x6d, 0x62, 0x61, 0x62, 0x77, 0x65, 0x00, 0x00, 0x09,
+  0x00, 0xf4, 0x02, 0x00, 0x00, 0x00, 0x27, 0x00, 0x0f, 0x00, 0x3f, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14,
+  0x00, 0x3f, 0x0c, 0x08, 0x01, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x0b,
+  0x51, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x3f, 0x00, 0x00,
+  0x18, 0x03, 0x00, 0x00, 0x75, 0x00, 0x14, 0x00, 0x14, 0x02, 0x01, 0x00,
+  0x7e, 0x00, 0x1f, 0x3f, 0x99, 0x39, 0x78, 0x00, 0x80, 0x02, 0x00, 0x7d,
+  0x00, 0x00, 0x05, 0x73, 0x00, 0x01, 0x00, 0x01, 0x01, 0x05, 0x02, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x32, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x05, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x05, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x69, 0x6d, 0x62,
+  0x61, 0x62, 0x77, 0x65, 0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x04, 0x01, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x75, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x93, 0x00, 0x00, 0x0f, 0x00, 0x3c, 0x70, 0x04, 0x00, 0x00, 0x00, 0x02,
+  0x25, 0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0x00, 0x3f, 0x0c, 0x08, 0x01,
+  0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x5a, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4e, 0x00, 0x33, 0x14, 0x00, 0x05, 0x00, 0x31, 0x00, 0x00,
+  0x04, 0x00, 0x03, 0x05, 0x56, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x30, 0x2d, 0x78, 0x78, 0xff, 0x7f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x0a, 0x59, 0xab, 0x05,
+  0x56, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0,
+  0xde, 0x58, 0xc0, 0x05, 0x56, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x30, 0x2d, 0x78, 0x78, 0x00, 0x52, 0x00, 0x33, 0x14,
+  0x00, 0x04, 0x00, 0x31, 0x04, 0x00, 0x01, 0xff, 0x7f, 0x00, 0x00, 0xd0,
+  0x22, 0x48, 0xc1, 0x05, 0x56, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcb, 0x6e, 0x17,
+  0x00, 0x00, 0x00, 0x7d, 0xff, 0x00, 0x14, 0x00, 0x3f, 0x0c, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x03, 0xe8, 0x03, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x4e, 0x00, 0x33, 0x14, 0x00, 0x05, 0x00, 0x31, 0x00, 0x00,
+  0x04, 0x00, 0x07, 0xa0, 0x55, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0xd3, 0x8c, 0xef, 0xff, 0x7f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xca, 0x0b, 0xf1, 0xa0,
+  0x55, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18,
+  0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xb0, 0xd9, 0x8c, 0xef, 0xff,
+  0x7f, 0x00, 0x00, 0xf0, 0xd8, 0x8c, 0xef, 0x00, 0x09, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x02, 0x01, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x71, 0x00, 0x00, 0x03, 0x45, 0x07, 0x00, 0x0f, 0x00, 0x3f,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0x16, 0x00, 0x19, 0x09, 0x59, 0x65, 0x61, 0x72, 0x3a, 0x20, 0x33, 0x37,
+  0x30, 0x30, 0x20, 0x42, 0x43, 0x45, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00,
+  0x00, 0x08, 0x01, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00,
+  0x00, 0x69, 0x00, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00, 0x00,
+  0x00, 0x81, 0x00, 0x00, 0x0d, 0x29, 0x07, 0x00, 0x09, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x02, 0x01, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x00,
+  0x05, 0xd5, 0x00, 0x03, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x71,
+  0x00, 0x00, 0x0b, 0xac, 0x07, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x02, 0x04, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+  0x09, 0x00, 0xf4, 0x02, 0x00, 0x00, 0x00, 0xba, 0x00, 0x0f, 0x00, 0x3f,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0x0c, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x0a, 0x28, 0x00, 0x01, 0x00,
+  0x52, 0x00, 0x33, 0x1c, 0x00, 0x05, 0x00, 0x31, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x01, 0x05, 0x56, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x2d, 0x78, 0x78, 0xff, 0x7f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x0a, 0x59,
+  0xab, 0x05, 0x56, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0xf0, 0xde, 0x58, 0xc0, 0x05, 0x56, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2d, 0x78, 0x78, 0x00, 0x0f, 0x00,
+  0x3f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x06,
+  0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0f, 0x00,
+  0x3f, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x6b, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x10, 0x00,
+  0x3f, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x04, 0xd4,
+  0x07, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x80, 0xc0, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x76, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x06, 0x00, 0x09, 0x00, 0x09,
+  0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x6f, 0x00,
+  0x00, 0x03, 0xcc, 0x07, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00,
+  0x00, 0x00, 0x96, 0x00, 0x00, 0x06, 0xe2, 0x07, 0x00, 0x0c, 0x00, 0x3f,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x01, 0x00, 0x09, 0x00, 0x3b,
+  0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00, 0x20,
+  0x00, 0x00, 0x00, 0x72, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0c, 0x00, 0x0f,
+  0x04, 0x00, 0x00, 0x00, 0x07, 0x4f, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x3f,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x0f, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00,
+  0x00, 0x0c, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x7d, 0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x06, 0x04, 0x00,
+  0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00,
+  0x02, 0x91, 0x07, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x93, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00,
+  0x00, 0x08, 0x03, 0x00, 0x13, 0x00, 0x3f, 0x04, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x6f, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0d,
+  0x00, 0x3f, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x7e, 0x0d, 0x0b, 0x00,
+  0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00,
+  0x03, 0x91, 0x07, 0x00, 0x12, 0x00, 0x33, 0x14, 0x00, 0x16, 0x00, 0x30,
+  0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x36, 0x00, 0x13, 0x00,
+  0x3f, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x73,
+  0x00, 0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x3f, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x83,
+  0x00, 0x00, 0x0e, 0xb3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x0f,
+  0x04, 0x00, 0x00, 0x00, 0x06, 0x8d, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x0f,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x2f, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x3f,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x09, 0x00, 0x3b,
+  0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x0c, 0x00, 0x0f, 0x08, 0x00, 0x00,
+  0x00, 0x01, 0x1f, 0x00, 0x04, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x02, 0x01, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x05, 0xf2, 0x07, 0x00, 0x0c, 0x00, 0x3f, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x72, 0x01, 0x00, 0x0a, 0x00, 0x3c, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0xca, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x6c, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x75, 0x07, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x71, 0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x08,
+  0x04, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x66,
+  0x00, 0x00, 0x02, 0x1a, 0x07, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00,
+  0x17, 0x00, 0x10, 0x20, 0x00, 0x40, 0x01, 0x04, 0x80, 0x00, 0x00, 0x80,
+  0x11, 0x30, 0xb5, 0x8f, 0x10, 0x00, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x0b,
+  0x00, 0xa7, 0x11, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x0c, 0x00,
+  0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x17, 0x00,
+  0x1f, 0x00, 0x80, 0xc0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x28, 0x00, 0x28, 0x00, 0x0a, 0x00, 0x3c,
+  0x10, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x0e, 0xdf, 0x07, 0x00, 0x08,
+  0x00, 0xa9, 0x01, 0x00, 0x00, 0x56, 0x00, 0x6d, 0x00, 0x33, 0xdd, 0x1e,
+  0x44, 0x00, 0x11, 0x00, 0x00, 0x01, 0x4d, 0x61, 0x6c, 0x61, 0x6e, 0x64,
+  0x65, 0x6c, 0x61, 0x20, 0x6b, 0x61, 0x4c, 0x75, 0x7a, 0x75, 0x6d, 0x61,
+  0x6e, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x02, 0x02,
+  0x02, 0x2d, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x3f, 0x0c,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x0d, 0x28, 0x04, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x80, 0xc0, 0x90, 0x12,
+  0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x94, 0x00, 0x02, 0x00, 0x02,
+  0x00, 0x06, 0x00, 0x02, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x10, 0x00, 0x3f, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x73, 0x07, 0x00, 0x0e,
+  0x00, 0x33, 0x14, 0x00, 0x05, 0x00, 0x30, 0x00, 0x00, 0x03, 0x00, 0x01,
+  0x00, 0x14, 0x00, 0x3f, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x77, 0x00,
+  0x00, 0x00, 0x53, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x1f, 0x00, 0x1f,
+  0x00, 0xe0, 0xc0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x09, 0x00,
+  0x09, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x3c, 0x10, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x94,
+  0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x14,
+  0x00, 0x3f, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x05,
+  0xd2, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x52, 0x00, 0x33, 0x1c, 0x00,
+  0x05, 0x00, 0x31, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x04, 0x4e, 0x00, 0x33, 0x14, 0x00, 0x06, 0x00, 0x39, 0x00, 0x00,
+  0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xb4, 0x24, 0xf1, 0xa0, 0x55, 0x00, 0x00, 0xc3, 0x97, 0x15, 0xf1, 0xa0,
+  0x55, 0x00, 0x00, 0x40, 0x9c, 0x24, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x72, 0x65, 0x76, 0x69, 0x73, 0x00, 0x43, 0x61, 0x72, 0x6f, 0x6c, 0x75,
+  0x73, 0x20, 0x4d, 0x61, 0x67, 0x6e, 0x75, 0x73, 0x00, 0x4c, 0x75, 0x64,
+  0x6f, 0x76, 0x69, 0x63, 0x75, 0x73, 0x20, 0x50, 0x69, 0x75, 0x73, 0x00,
+  0x4c, 0x6f, 0x74, 0x68, 0x61, 0x72, 0x69, 0x75, 0x73, 0x00, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x03, 0x07, 0x00, 0x01, 0x09, 0x03, 0x35, 0x00, 0x94, 0xfe,
+  0xef, 0x03, 0x00, 0xad, 0x46, 0x72, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x46,
+  0x72, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61,
+  0x6c, 0x3a, 0x46, 0x72, 0x65, 0x6e, 0x63, 0x68, 0x00, 0x66, 0x72, 0x61,
+  0x6e, 0x63, 0x65, 0x00, 0x66, 0x72, 0x61, 0x6e, 0x63, 0x65, 0x5f, 0x6f,
+  0x6c, 0x64, 0x00, 0x46, 0x72, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x68, 0x61,
+  0x73, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x62, 0x65, 0x65, 0x6e, 0x20,
+  0x61, 0x20, 0x6d, 0x61, 0x6a, 0x6f, 0x72, 0x20, 0x70, 0x6f, 0x77, 0x65,
+  0x72, 0x20, 0x69, 0x6e, 0x20, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2e,
+  0x20, 0x46, 0x72, 0x65, 0x6e, 0x63, 0x68, 0x20, 0x63, 0x6f, 0x6e, 0x71,
+  0x75, 0x65, 0x72, 0x6f, 0x72, 0x73, 0x20, 0x6c, 0x69, 0x6b, 0x65, 0x20,
+  0x45, 0x6d, 0x70, 0x65, 0x72, 0x6f, 0x72, 0x20, 0x4e, 0x61, 0x70, 0x6f,
+  0x6c, 0x65, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x4b, 0x69, 0x6e,
+  0x67, 0x20, 0x43, 0x68, 0x61, 0x72, 0x6c, 0x65, 0x6d, 0x61, 0x67, 0x6e,
+  0x65, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x65, 0x64, 0x20, 0x6c, 0x61, 0x72,
+  0x67, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x72, 0x65, 0x6e, 0x63, 0x68, 0x20,
+  0x66, 0x6c, 0x61, 0x67, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x62,
+  0x75, 0x69, 0x6c, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x6f, 0x72,
+  0x6c, 0x64, 0x27, 0x73, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x20,
+  0x6c, 0x61, 0x72, 0x67, 0x65, 0x73, 0x74, 0x20, 0x63, 0x6f, 0x6c, 0x6f,
+  0x6e, 0x69, 0x61, 0x6c, 0x20, 0x65, 0x6d, 0x70, 0x69, 0x72, 0x65, 0x2e,
+  0x20, 0x54, 0x68, 0x65, 0x20, 0x46, 0x72, 0x65, 0x6e, 0x63, 0x68, 0x20,
+  0x6b, 0x69, 0x6e, 0x67, 0x64, 0x6f, 0x6d, 0x20, 0x66, 0x69, 0x72, 0x73,
+  0x74, 0x20, 0x63, 0x61, 0x6d, 0x65, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20,
+  0x65, 0x78, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x77, 0x68,
+  0x65, 0x6e, 0x20, 0x69, 0x74, 0x20, 0x67, 0x72, 0x65, 0x77, 0x20, 0x6f,
+  0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x65,
+  0x73, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x72, 0x61, 0x6e, 0x6b, 0x69,
+  0x73, 0x68, 0x20, 0x65, 0x6d, 0x70, 0x69, 0x72, 0x65, 0x20, 0x64, 0x75,
+  0x72, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x48, 0x69, 0x67,
+  0x68, 0x20, 0x4d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x20, 0x41, 0x67, 0x65,
+  0x73, 0x2e, 0x20, 0x46, 0x72, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x2d, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x65, 0x64, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x20, 0x2d, 0x20, 0x77,
+  0x61, 0x73, 0x20, 0x73, 0x68, 0x61, 0x6b, 0x65, 0x6e, 0x20, 0x6f, 0x6e,
+  0x20, 0x69, 0x74, 0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x73, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x46, 0x72, 0x65, 0x6e, 0x63, 0x68, 0x20, 0x52, 0x65, 0x76, 0x6f, 0x6c,
+  0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x31, 0x37, 0x38,
+  0x39, 0x2e, 0x00, 0x05, 0x13, 0x43, 0x6c, 0x6f, 0x76, 0x69, 0x73, 0x00,
+  0x43, 0x68, 0x61, 0x72, 0x6c, 0x65, 0x73, 0x20, 0x4d, 0x61, 0x72, 0x74,
+  0x65, 0x6c, 0x00, 0x43, 0x68, 0x61, 0x72, 0x6c, 0x65, 0x6d, 0x61, 0x67,
+  0x6e, 0x65, 0x00, 0x48, 0x75, 0x67, 0x6f, 0x20, 0x43, 0x61, 0x70, 0x65,
+  0x74, 0x00, 0x4c, 0x6f, 0x75, 0x69, 0x73, 0x20, 0x56, 0x49, 0x49, 0x00,
+  0x50, 0x68, 0x69, 0x6c, 0x69, 0x70, 0x70, 0x65, 0x20, 0x41, 0x75, 0x67,
+  0x75, 0x73, 0x74, 0x65, 0x00, 0x4a, 0x65, 0x61, 0x6e, 0x6e, 0x65, 0x20,
+  0x64, 0x27, 0x41, 0x72, 0x63, 0x00, 0x48, 0x65, 0x6e, 0x72, 0x69, 0x20,
+  0x49, 0x56, 0x00, 0x52, 0x69, 0x63, 0x68, 0x65, 0x6c, 0x69, 0x65, 0x75,
+  0x00, 0x4c, 0x6f, 0x75, 0x69, 0x73, 0x20, 0x58, 0x49, 0x56, 0x00, 0x4d,
+  0x61, 0x72, 0x69, 0x65, 0x20, 0x41, 0x6e, 0x74, 0x6f, 0x69, 0x6e, 0x65,
+  0x74, 0x74, 0x65, 0x00, 0x4d, 0x61, 0x78, 0x69, 0x6d, 0x69, 0x6c, 0x69,
+  0x65, 0x6e, 0x20, 0x64, 0x65, 0x20, 0x52, 0x6f, 0x62, 0x65, 0x73, 0x70,
+  0x69, 0x65, 0x72, 0x72, 0x65, 0x00, 0x4e, 0x61, 0x70, 0x6f, 0x6c, 0xc3,
+  0xa9, 0x6f, 0x6e, 0x20, 0x42, 0x6f, 0x6e, 0x61, 0x70, 0x61, 0x72, 0x74,
+  0x65, 0x00, 0x4c, 0x6f, 0x75, 0x69, 0x73, 0x20, 0x50, 0x68, 0x69, 0x6c,
+  0x69, 0x70, 0x70, 0x65, 0x00, 0x4e, 0x61, 0x70, 0x6f, 0x6c, 0xc3, 0xa9,
+  0x6f, 0x6e, 0x20, 0x49, 0x49, 0x49, 0x00, 0x41, 0x64, 0x6f, 0x6c, 0x70,
+  0x68, 0x65, 0x20, 0x54, 0x68, 0x69, 0x65, 0x72, 0x73, 0x00, 0x47, 0x65,
+  0x6f, 0x72, 0x67, 0x65, 0x73, 0x20, 0x43, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x63, 0x65, 0x61, 0x75, 0x00, 0x43, 0x68, 0x61, 0x72, 0x6c, 0x65, 0x73,
+  0x20, 0x64, 0x65, 0x20, 0x47, 0x61, 0x75, 0x6c, 0x6c, 0x65, 0x00, 0x46,
+  0x72, 0x61, 0x6e, 0xc3, 0xa7, 0x6f, 0x69, 0x73, 0x20, 0x4d, 0x69, 0x74,
+  0x74, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x64, 0x00, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x03, 0x02, 0x01, 0x07, 0x09,
+  0x03, 0x7f, 0x00, 0x94, 0xff, 0xef, 0x03, 0x00, 0xae, 0x66, 0x72, 0x65,
+  0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+  0x00, 0x46, 0x72, 0x69, 0x73, 0x69, 0x61, 0x6e, 0x00, 0x46, 0x72, 0x69,
+  0x73, 0x69, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c,
+  0x3a, 0x46, 0x72, 0x69, 0x73, 0x69, 0x61, 0x6e, 0x73, 0x00, 0x66, 0x72,
+  0x69, 0x73, 0x69, 0x61, 0x00, 0x2d, 0x00, 0x52, 0x6f, 0x6d, 0x61, 0x6e,
+  0x73, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x6d, 0x65,
+  0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x46, 0x72, 0x69, 0x73, 0x69, 0x69, 0x20, 0x62, 0x75, 0x74, 0x20, 0x68,
+  0x69, 0x73, 0x74, 0x6f, 0x72, 0x69, 0x61, 0x6e, 0x73, 0x20, 0x61, 0x72,
+  0x65, 0x20, 0x75, 0x6e, 0x73, 0x75, 0x72, 0x65, 0x20, 0x77, 0x68, 0x65,
+  0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x77, 0x65,
+  0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x6e, 0x63, 0x65, 0x73,
+  0x74, 0x6f, 0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x6f, 0x64, 0x61,
+  0x79, 0x27, 0x73, 0x20, 0x46, 0x72, 0x69, 0x73, 0x69, 0x61, 0x6e, 0x73,
+  0x20, 0x6f, 0x72, 0x20, 0x6e, 0x6f, 0x74, 0x2e, 0x20, 0x49, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x65, 0x61, 0x72, 0x6c, 0x79, 0x20, 0x4d, 0x69,
+  0x64, 0x64, 0x6c, 0x65, 0x20, 0x41, 0x67, 0x65, 0x73, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x46, 0x72, 0x69, 0x73, 0x69, 0x61, 0x6e, 0x73, 0x20, 0x63,
+  0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x61, 0x20,
+  0x6b, 0x69, 0x6e, 0x67, 0x64, 0x6f, 0x6d, 0x20, 0x73, 0x74, 0x72, 0x65,
+  0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x53, 0x63, 0x68, 0x65, 0x6c, 0x64, 0x74, 0x20,
+  0x74, 0x6f, 0x20, 0x4a, 0x75, 0x74, 0x6c, 0x61, 0x6e, 0x64, 0x2e, 0x20,
+  0x41, 0x6c, 0x74, 0x68, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x65, 0x76, 0x65,
+  0x6e, 0x74, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x64, 0x65, 0x66, 0x65,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x46, 0x72, 0x61, 0x6e, 0x6b, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x79,
+  0x20, 0x6b, 0x65, 0x70, 0x74, 0x20, 0x65, 0x6e, 0x6a, 0x6f, 0x79, 0x69,
+  0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x6d, 0x6f, 0x75,
+  0x73, 0x20, 0x46, 0x72, 0x69, 0x73, 0x69, 0x61, 0x6e, 0x20, 0x66, 0x72,
+  0x65, 0x65, 0x64, 0x6f, 0x6d, 0x2c, 0x20, 0x72, 0x65, 0x66, 0x75, 0x73,
+  0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x67,
+  0x6e, 0x69, 0x7a, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6c,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x66, 0x65, 0x75,
+  0x64, 0x61, 0x6c, 0x20, 0x6c, 0x6f, 0x72, 0x64, 0x2e, 0x20, 0x49, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x35, 0x74, 0x68, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x31, 0x36, 0x74, 0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75,
+  0x72, 0x69, 0x65, 0x73, 0x20, 0x46, 0x72, 0x69, 0x73, 0x69, 0x61, 0x6e,
+  0x20, 0x74, 0x65, 0x72, 0x72, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x77,
+  0x61, 0x73, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x75, 0x61, 0x6c, 0x6c,
+  0x79, 0x20, 0x63, 0x61, 0x72, 0x76, 0x65, 0x64, 0x20, 0x75, 0x70, 0x2c,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x62, 0x65,
+  0x63, 0x6f, 0x6d, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x20, 0x70, 0x72, 0x6f,
+  0x76, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x55, 0x6e, 0x69, 0x74, 0x65, 0x64, 0x20, 0x4e, 0x65, 0x74, 0x68,
+  0x65, 0x72, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x2e, 0x20, 0x49, 0x6e, 0x20,
+  0x31, 0x37, 0x38, 0x32, 0x20, 0x74, 0x68, 0x65, 0x20, 0x45, 0x73, 0x74,
+  0x61, 0x74, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x46, 0x72, 0x69, 0x65,
+  0x73, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x77, 0x61, 0x73, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x65,
+  0x69, 0x67, 0x6e, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x67, 0x6e,
+  0x69, 0x7a, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65,
+  0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x55, 0x6e, 0x69, 0x74, 0x65, 0x64, 0x20, 0x53,
+  0x74, 0x61, 0x74, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2e, 0x00, 0x05, 0x0c, 0x46, 0x69, 0x6e, 0x6e,
+  0x00, 0x52, 0x65, 0x64, 0x62, 0x61, 0x64, 0x00, 0x45, 0x67, 0x62, 0x65,
+  0x72, 0x74, 0x20, 0x49, 0x49, 0x00, 0x50, 0x69, 0x65, 0x72, 0x20, 0x47,
+  0x65, 0x72, 0x6c, 0x6f, 0x66, 0x73, 0x20, 0x44, 0x6f, 0x6e, 0x69, 0x61,
+  0x00, 0x55, 0x6c, 0x72, 0x69, 0x63, 0x68, 0x20, 0x43, 0x69, 0x72, 0x6b,
+  0x73, 0x65, 0x6d, 0x61, 0x00, 0x45, 0x64, 0x7a, 0x61, 0x72, 0x64, 0x20,
+  0x64, 0x65, 0x20, 0x47, 0x72, 0x75, 0x74, 0x74, 0x65, 0x00, 0x52, 0x65,
+  0x6e, 0x6e, 0x65, 0x6e, 0x62, 0x65, 0x72, 0x67, 0x00, 0x45, 0x72, 0x6e,
+  0x73, 0x74, 0x20, 0x4b, 0x61, 0x73, 0x69, 0x6d, 0x69, 0x72, 0x00, 0x4a,
+  0x6f, 0x68, 0x61, 0x6e, 0x20, 0x57, 0x69, 0x6c, 0x6c, 0x65, 0x6d, 0x20,
+  0x46, 0x72, 0x69, 0x73, 0x6f, 0x00, 0x49, 0x64, 0x73, 0x65, 0x72, 0x74,
+  0x20, 0x41, 0x65, 0x62, 0x69, 0x6e, 0x67, 0x61, 0x20, 0x76, 0x61, 0x6e,
+  0x20, 0x48, 0x75, 0x6d, 0x61, 0x6c, 0x64, 0x61, 0x00, 0x46, 0x65, 0x72,
+  0x64, 0x69, 0x6e, 0x61, 0x6e, 0x64, 0x20, 0x44, 0x6f, 0x6d, 0x65, 0x6c,
+  0x61, 0x20, 0x4e, 0x69, 0x65, 0x75, 0x77, 0x65, 0x6e, 0x68, 0x75, 0x69,
+  0x73, 0x00, 0x4d, 0x61, 0x74, 0x61, 0x20, 0x48, 0x61, 0x72, 0x69, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x03, 0x01, 0x02, 0x07, 0x09, 0x02, 0x02, 0x00, 0x94, 0x7f,
+  0xef, 0x03, 0x00, 0xaf, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d,
+  0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x46, 0x72, 0x69, 0x75,
+  0x6c, 0x69, 0x61, 0x6e, 0x00, 0x46, 0x72, 0x69, 0x75, 0x6c, 0x69, 0x61,
+  0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x46, 0x72,
+  0x69, 0x75, 0x6c, 0x69, 0x61, 0x6e, 0x00, 0x66, 0x72, 0x69, 0x75, 0x6c,
+  0x69, 0x00, 0x2d, 0x00, 0x46, 0x72, 0x69, 0x75, 0x6c, 0x69, 0x20, 0x69,
+  0x73, 0x20, 0x61, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e, 0x20, 0x69,
+  0x6e, 0x20, 0x6e, 0x6f, 0x72, 0x74, 0x68, 0x2d, 0x65, 0x61, 0x73, 0x74,
+  0x65, 0x72, 0x6e, 0x20, 0x49, 0x74, 0x61, 0x6c, 0x79, 0x2e, 0x20, 0x41,
+  0x20, 0x64, 0x75, 0x63, 0x68, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x4c, 0x6f, 0x6d, 0x62, 0x61, 0x72, 0x64, 0x73, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x61, 0x20, 0x6d, 0x61,
+  0x72, 0x63, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46,
+  0x72, 0x61, 0x6e, 0x6b, 0x73, 0x2c, 0x20, 0x69, 0x74, 0x20, 0x77, 0x61,
+  0x73, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x50, 0x61, 0x74, 0x72, 0x69, 0x61, 0x72, 0x63, 0x68,
+  0x73, 0x20, 0x6f, 0x66, 0x20, 0x41, 0x71, 0x75, 0x69, 0x6c, 0x65, 0x69,
+  0x61, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x72, 0x61, 0x6c, 0x3a, 0x43, 0x68,
+  0x69, 0x6e, 0x65, 0x73, 0x65, 0x00, 0x63, 0x68, 0x69, 0x6e, 0x61, 0x00,
+  0x2d, 0x00, 0x43, 0x68, 0x69, 0x6e, 0x61, 0x20, 0x69, 0x73, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6f, 0x6c, 0x64, 0x65, 0x73, 0x74, 0x20, 0x6d, 0x61,
+  0x6a, 0x6f, 0x72, 0x20, 0x63, 0x69, 0x76, 0x69, 0x6c, 0x69, 0x7a, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73,
+  0x20, 0x73, 0x74, 0x69, 0x6c, 0x6c, 0x20, 0x69, 0x6e, 0x20, 0x65, 0x78,
+  0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x6f, 0x64, 0x61,
+  0x79, 0x2c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x77, 0x72, 0x69, 0x74,
+  0x74, 0x65, 0x6e, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x73, 0x20,
+  0x64, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20,
+  0x6f, 0x76, 0x65, 0x72, 0x20, 0x33, 0x2c, 0x35, 0x30, 0x30, 0x20, 0x79,
+  0x65, 0x61, 0x72, 0x73, 0x2e, 0x20, 0x41, 0x66, 0x74, 0x65, 0x72, 0x20,
+  0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x62, 0x65, 0x69, 0x6e, 0x67, 0x20,
+  0x75, 0x6e, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x51, 0x69, 0x6e, 0x20, 0x64, 0x79, 0x6e, 0x61, 0x73,
+  0x74, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x32, 0x32, 0x31, 0x20, 0x42, 0x43,
+  0x45, 0x2c, 0x20, 0x43, 0x68, 0x69, 0x6e, 0x61, 0x20, 0x61, 0x6c, 0x74,
+  0x65, 0x72, 0x6e, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x65, 0x74, 0x77,
+  0x65, 0x65, 0x6e, 0x20, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x79, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x64, 0x69, 0x73, 0x75, 0x6e, 0x69, 0x74, 0x79, 0x2c, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6f, 0x63, 0x63, 0x61, 0x73,
+  0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x71,
+  0x75, 0x65, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x65, 0x78, 0x74,
+  0x65, 0x72, 0x6e, 0x61, 0x6c, 0x20, 0x65, 0x74, 0x68, 0x6e, 0x69, 0x63,
+  0x69, 0x74, 0x69, 0x65, 0x73, 0x2e, 0x20, 0x54, 0x6f, 0x64, 0x61, 0x79,
+  0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x65, 0x6f, 0x70, 0x6c, 0x65,
+  0x27, 0x73, 0x20, 0x52, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20,
+  0x6f, 0x66, 0x20, 0x43, 0x68, 0x69, 0x6e, 0x61, 0x2c, 0x20, 0x65, 0x73,
+  0x74, 0x61, 0x62, 0x6c, 0x69, 0x73, 0x68, 0x65, 0x64, 0x20, 0x62, 0x79,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x6d, 0x6d, 0x75, 0x6e, 0x69,
+  0x73, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x39, 0x34, 0x39, 0x2c,
+  0x20, 0x6f, 0x63, 0x63, 0x75, 0x70, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x6c, 0x61, 0x6e, 0x64, 0x2c, 0x20,
+  0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x65, 0x72, 0x20, 0x4e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x61,
+  0x6c, 0x69, 0x73, 0x74, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52,
+  0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x6f, 0x66, 0x20, 0x43,
+  0x68, 0x69, 0x6e, 0x61, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x20,
+  0x6f, 0x66, 0x20, 0x54, 0x61, 0x69, 0x77, 0x61, 0x6e, 0x2e, 0x00, 0x03,
+  0x06, 0x44, 0x65, 0x6e, 0x67, 0x20, 0x58, 0x69, 0x61, 0x6f, 0x70, 0x69,
+  0x6e, 0x67, 0x00, 0x48, 0x75, 0x61, 0x20, 0x47, 0x75, 0x6f, 0x66, 0x65,
+  0x6e, 0x67, 0x00, 0x57, 0x61, 0x6e, 0x67, 0x20, 0x47, 0x75, 0x61, 0x6e,
+  0x67, 0x6d, 0x65, 0x69, 0x00, 0x5a, 0x68, 0x6f, 0x75, 0x20, 0x45, 0x6e,
+  0x6c, 0x61, 0x69, 0x00, 0x4d, 0x61, 0x6f, 0x20, 0x5a, 0x65, 0x64, 0x6f,
+  0x6e, 0x67, 0x00, 0x43, 0x68, 0x65, 0x6e, 0x20, 0x44, 0x75, 0x78, 0x69,
+  0x75, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x02,
+  0x03, 0x06, 0x09, 0x02, 0x32, 0x00, 0x94, 0xff, 0xef, 0x03, 0x00, 0x6c,
+  0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x00, 0x43, 0x68, 0x69, 0x6e, 0x6f, 0x6f, 0x6b, 0x00,
+  0x43, 0x68, 0x69, 0x6e, 0x6f, 0x6f, 0x6b, 0x00, 0x3f, 0x70, 0x6c, 0x75,
+  0x72, 0x61, 0x6c, 0x3a, 0x43, 0x68, 0x69, 0x6e, 0x6f, 0x6f, 0x6b, 0x73,
+  0x00, 0x63, 0x6c, 0x61, 0x74, 0x73, 0x6f, 0x70, 0x00, 0x2d, 0x00, 0x54,
+  0x68, 0x65, 0x20, 0x43, 0x68, 0x69, 0x6e, 0x6f, 0x6f, 0x6b, 0x20, 0x43,
+  0x6f, 0x6e, 0x66, 0x65, 0x64, 0x65, 0x72, 0x61, 0x63, 0x79, 0x20, 0x77,
+  0x61, 0x73, 0x20, 0x61, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x6f,
+  0x66, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x75, 0x6e, 0x69, 0x74, 0x69, 0x65,
+  0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
+  0x6e, 0x20, 0x63, 0x75, 0x73, 0x74, 0x6f, 0x6d, 0x73, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x2e, 0x20,
+  0x54, 0x68, 0x65, 0x79, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x61, 0x20,
+  0x73, 0x65, 0x64, 0x65, 0x6e, 0x74, 0x61, 0x72, 0x79, 0x20, 0x70, 0x65,
+  0x6f, 0x70, 0x6c, 0x65, 0x20, 0x6c, 0x69, 0x76, 0x69, 0x6e, 0x67, 0x20,
+  0x61, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f,
+  0x6c, 0x75, 0x6d, 0x62, 0x69, 0x61, 0x20, 0x72, 0x69, 0x76, 0x65, 0x72,
+  0x20, 0x69, 0x6e, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x2d,
+  0x64, 0x61, 0x79, 0x20, 0x4f, 0x72, 0x65, 0x67, 0x6f, 0x6e, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x57, 0x61, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x74, 0x6f,
+  0x6e, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x55, 0x6e, 0x69,
+  0x74, 0x65, 0x64, 0x20, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x2e, 0x20,
+  0x43, 0x68, 0x69, 0x6e, 0x6f, 0x6f, 0x6b, 0x20, 0x72, 0x65, 0x67, 0x69,
+  0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x69, 0x6e, 0x66, 0x6c, 0x75, 0x65, 0x6e,
+  0x63, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x73, 0x65,
+  0x65, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61,
+  0x63, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x69,
+  0x72, 0x20, 0x74, 0x6f, 0x6e, 0x67, 0x75, 0x65, 0x20, 0x62, 0x65, 0x63,
+  0x61, 0x6d, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x73, 0x65,
+  0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x70, 0x69, 0x64, 0x67, 0x69, 0x6e,
+  0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x63, 0x6f, 0x6d, 0x6d, 0x75, 0x6e, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x4e, 0x61,
+  0x74, 0x69, 0x76, 0x65, 0x20, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x6e, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x57, 0x68, 0x69, 0x74, 0x65,
+  0x73, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x6f, 0x75, 0x74,
+  0x20, 0x4f, 0x72, 0x65, 0x67, 0x6f, 0x6e, 0x2c, 0x20, 0x57, 0x61, 0x73,
+  0x68, 0x69, 0x6e, 0x67, 0x74, 0x6f, 0x6e, 0x2c, 0x20, 0x42, 0x72, 0x69,
+  0x74, 0x69, 0x73, 0x68, 0x20, 0x43, 0x6f, 0x6c, 0x75, 0x6d, 0x62, 0x69,
+  0x61, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x77, 0x61, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x41, 0x6c, 0x61,
+  0x73, 0x6b, 0x61, 0x2e, 0x00, 0x05, 0x03, 0x43, 0x61, 0x74, 0x68, 0x65,
+  0x72, 0x69, 0x6e, 0x65, 0x20, 0x54, 0x72, 0x6f, 0x65, 0x68, 0x00, 0x54,
+  0x75, 0x6d, 0x75, 0x6c, 0x74, 0x68, 0x00, 0x43, 0x6f, 0x6d, 0x63, 0x6f,
+  0x6d, 0x6c, 0x79, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x05, 0x02,
+  0x09, 0x03, 0x48, 0x00, 0x94, 0xff, 0xef, 0x03, 0x00, 0x6d, 0x66, 0x72,
+  0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x00, 0x43, 0x68, 0x6f, 0x63, 0x74, 0x61, 0x77, 0x00, 0x43, 0x68,
+  0x6f, 0x63, 0x74, 0x61, 0x77, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61,
+  0x6c, 0x3a, 0x43, 0x68, 0x6f, 0x63, 0x74, 0x61, 0x77, 0x73, 0x00, 0x63,
+  0x68, 0x6f, 0x63, 0x74, 0x61, 0x77, 0x00, 0x2d, 0x00, 0x4f, 0x6e, 0x65,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6f, 0x2d, 0x63,
+  0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x46, 0x69, 0x76, 0x65, 0x20, 0x43,
+  0x69, 0x76, 0x69, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x54, 0x72, 0x69,
+  0x62, 0x65, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x68, 0x6f,
+  0x63, 0x74, 0x61, 0x77, 0x20, 0x74, 0x72, 0x61, 0x64, 0x69, 0x74, 0x69,
+  0x6f, 0x6e, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x6f, 0x63, 0x63, 0x75, 0x70,
+  0x69, 0x65, 0x64, 0x20, 0x6d, 0x75, 0x63, 0x68, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x73, 0x6f, 0x75, 0x74, 0x68, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x6f, 0x64, 0x61, 0x79, 0x27, 0x73, 0x20, 0x55, 0x2e, 0x53, 0x2e,
+  0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x4d, 0x69,
+  0x73, 0x73, 0x69, 0x73, 0x73, 0x69, 0x70, 0x70, 0x69, 0x2e, 0x20, 0x46,
+  0x69, 0x72, 0x73, 0x74, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x65, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x53, 0x70, 0x61, 0x6e,
+  0x69, 0x73, 0x68, 0x20, 0x65, 0x78, 0x70, 0x6c, 0x6f, 0x72, 0x65, 0x72,
+  0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x36, 0x74,
+  0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x2c, 0x20, 0x74,
+  0x68, 0x65, 0x79, 0x20, 0x62, 0x65, 0x63, 0x61, 0x6d, 0x65, 0x20, 0x6c,
+  0x6f, 0x6e, 0x67, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x46, 0x72, 0x65,
+  0x6e, 0x63, 0x68, 0x20, 0x61, 0x6c, 0x6c, 0x69, 0x65, 0x73, 0x20, 0x62,
+  0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x73, 0x69, 0x64, 0x69, 0x6e, 0x67,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x6f,
+  0x6e, 0x66, 0x65, 0x64, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x53, 0x74,
+  0x61, 0x74, 0x65, 0x73, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6e,
+  0x20, 0x43, 0x69, 0x76, 0x69, 0x6c, 0x20, 0x57, 0x61, 0x72, 0x2e, 0x20,
+  0x54, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x6a, 0x6f, 0x72, 0x69, 0x74, 0x79,
+  0x20, 0x6f, 0x66, 0x20, 0x43, 0x68, 0x6f, 0x63, 0x74, 0x61, 0x77, 0x20,
+  0x74, 0x6f, 0x64, 0x61, 0x79, 0x20, 0x6c, 0x69, 0x76, 0x65, 0x20, 0x69,
+  0x6e, 0x20, 0x4f, 0x6b, 0x6c, 0x61, 0x68, 0x6f, 0x6d, 0x61, 0x20, 0x66,
+  0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72,
+  0x63, 0x65, 0x64, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x61, 0x6c, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x68,
+  0x6f, 0x6d, 0x65, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65,
+  0x72, 0x20, 0x70, 0x72, 0x65, 0x73, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x20,
+  0x41, 0x6e, 0x64, 0x72, 0x65, 0x77, 0x20, 0x4a, 0x61, 0x63, 0x6b, 0x73,
+  0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x38, 0x33, 0x31, 0x2c, 0x20,
+  0x62, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x73,
+  0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x61, 0x20, 0x76, 0x69, 0x62, 0x72,
+  0x61, 0x6e, 0x74, 0x20, 0x62, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x20,
+  0x4d, 0x69, 0x73, 0x73, 0x69, 0x73, 0x73, 0x69, 0x70, 0x70, 0x69, 0x20,
+  0x6d, 0x61, 0x64, 0x65, 0x20, 0x75, 0x70, 0x20, 0x6f, 0x66, 0x20, 0x43,
+  0x68, 0x6f, 0x63, 0x74, 0x61, 0x77, 0x20, 0x77, 0x68, 0x6f, 0x20, 0x6d,
+  0x61, 0x6e, 0x61, 0x67, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x65, 0x73,
+  0x63, 0x61, 0x70, 0x65, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x61, 0x6c,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x74, 0x61, 0x79, 0x20, 0x62, 0x65,
+  0x68, 0x69, 0x6e, 0x64, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x77, 0x6f,
+  0x72, 0x64, 0x20, 0x22, 0x4f, 0x6b, 0x6c, 0x61, 0x68, 0x6f, 0x6d, 0x61,
+  0x22, 0x20, 0x69, 0x74, 0x73, 0x65, 0x6c, 0x66, 0x20, 0x69, 0x73, 0x20,
+  0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x20, 0x61, 0x20, 0x43, 0x68, 0x6f, 0x63, 0x74, 0x61, 0x77, 0x20, 0x6c,
+  0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d,
+  0x20, 0x6d, 0x65, 0x61, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x22, 0x72, 0x65,
+  0x64, 0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x22, 0x2e, 0x00, 0x05,
+  0x07, 0x50, 0x68, 0x69, 0x6c, 0x6c, 0x69, 0x70, 0x20, 0x4d, 0x61, 0x72,
+  0x74, 0x69, 0x6e, 0x00, 0x50, 0x65, 0x74, 0x65, 0x72, 0x20, 0x50, 0x69,
+  0x74, 0x63, 0x68, 0x6c, 0x79, 0x6e, 0x6e, 0x00, 0x47, 0x65, 0x6f, 0x72,
+  0x67, 0x65, 0x20, 0x57, 0x2e, 0x20, 0x48, 0x61, 0x72, 0x6b, 0x69, 0x6e,
+  0x73, 0x00, 0x47, 0x72, 0x65, 0x65, 0x6e, 0x77, 0x6f, 0x6f, 0x64, 0x20,
+  0x4c, 0x65, 0x46, 0x6c, 0x6f, 0x72, 0x65, 0x00, 0x4d, 0x75, 0x73, 0x68,
+  0x75, 0x6c, 0x61, 0x74, 0x75, 0x62, 0x62, 0x65, 0x65, 0x00, 0x41, 0x70,
+  0x75, 0x63, 0x6b, 0x73, 0x68, 0x75, 0x6e, 0x75, 0x62, 0x62, 0x65, 0x65,
+  0x00, 0x50, 0x75, 0x73, 0x68, 0x6d, 0x61, 0x74, 0x61, 0x68, 0x61, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x05, 0x02,
+  0x65, 0x72, 0x69, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a,
+  0x41, 0x7a, 0x65, 0x72, 0x69, 0x73, 0x00, 0x61, 0x7a, 0x65, 0x72, 0x62,
+  0x61, 0x69, 0x6a, 0x61, 0x6e, 0x00, 0x2d, 0x00, 0x54, 0x68, 0x65, 0x20,
+  0x41, 0x7a, 0x65, 0x72, 0x69, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x41, 0x7a, 0x65, 0x72, 0x62, 0x61, 0x69, 0x6a, 0x61, 0x6e, 0x2e,
+  0x20, 0x54, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x72, 0x69, 0x74, 0x6f,
+  0x72, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x72, 0x6e,
+  0x20, 0x41, 0x7a, 0x65, 0x72, 0x62, 0x61, 0x69, 0x6a, 0x61, 0x6e, 0x20,
+  0x77, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x63, 0x65, 0x6e,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x69, 0x73, 0x65, 0x73, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x66, 0x61, 0x6c, 0x6c, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x6e,
+  0x63, 0x69, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x73,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x61, 0x75, 0x63,
+  0x61, 0x73, 0x75, 0x73, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e, 0x2e,
+  0x20, 0x49, 0x6e, 0x20, 0x31, 0x38, 0x31, 0x33, 0x20, 0x41, 0x7a, 0x65,
+  0x72, 0x62, 0x61, 0x69, 0x6a, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x63, 0x61,
+  0x6d, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x52, 0x75, 0x73, 0x73, 0x69, 0x61, 0x6e, 0x20, 0x45,
+  0x6d, 0x70, 0x69, 0x72, 0x65, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68,
+  0x20, 0x77, 0x61, 0x73, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
+  0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x73, 0x68, 0x6f, 0x72, 0x74,
+  0x20, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x69,
+  0x6e, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x65, 0x20,
+  0x69, 0x6e, 0x20, 0x31, 0x39, 0x31, 0x38, 0x2d, 0x31, 0x39, 0x32, 0x30,
+  0x20, 0x2d, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+  0x72, 0x73, 0x74, 0x20, 0x49, 0x73, 0x6c, 0x61, 0x6d, 0x69, 0x63, 0x20,
+  0x72, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x69, 0x6e, 0x20,
+  0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x2e, 0x20, 0x54, 0x68, 0x65,
+  0x6e, 0x20, 0x41, 0x7a, 0x65, 0x72, 0x62, 0x61, 0x69, 0x6a, 0x61, 0x6e,
+  0x20, 0x62, 0x65, 0x63, 0x61, 0x6d, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6f, 0x76, 0x69,
+  0x65, 0x74, 0x20, 0x55, 0x6e, 0x69, 0x6f, 0x6e, 0x20, 0x75, 0x6e, 0x74,
+  0x69, 0x6c, 0x20, 0x69, 0x74, 0x73, 0x20, 0x64, 0x69, 0x73, 0x73, 0x6f,
+  0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x39,
+  0x39, 0x31, 0x2e, 0x00, 0x01, 0x0f, 0xc4, 0xb0, 0x73, 0x6d, 0x61, 0x79,
+  0xc4, 0xb1, 0x6c, 0x20, 0x58, 0xc9, 0x99, 0x74, 0x61, 0x69, 0x00, 0x53,
+  0x68, 0x61, 0x6d, 0x73, 0x20, 0x61, 0x64, 0x2d, 0x44, 0x69, 0x6e, 0x20,
+  0x45, 0x6c, 0x64, 0x65, 0x71, 0x69, 0x7a, 0x00, 0x53, 0x68, 0x61, 0x6b,
+  0x68, 0x76, 0x65, 0x72, 0x64, 0x69, 0x00, 0x44, 0x61, 0x72, 0x67, 0x61,
+  0x68, 0x20, 0x51, 0x75, 0x6c, 0x69, 0x00, 0x48, 0x61, 0x79, 0x64, 0x61,
+  0x72, 0x20, 0x51, 0x75, 0x6c, 0x69, 0x00, 0x48, 0x75, 0x73, 0x61, 0x79,
+  0x6e, 0x00, 0x4d, 0x61, 0x6c, 0x69, 0x6b, 0x20, 0x4e, 0x61, 0x6a, 0x61,
+  0x66, 0x00, 0x4d, 0x75, 0x68, 0x61, 0x6d, 0x6d, 0x65, 0x64, 0x20, 0x41,
+  0x6c, 0x69, 0x00, 0x53, 0x65, 0x79, 0x69, 0x64, 0x20, 0x41, 0x62, 0x62,
+  0x61, 0x73, 0x00, 0xc6, 0x8f, 0x62, 0xc3, 0xbc, 0x6c, 0x66, 0xc9, 0x99,
+  0x7a, 0x20, 0x45, 0x6c, 0xc3, 0xa7, 0x69, 0x62, 0xc9, 0x99, 0x79, 0x00,
+  0x48, 0x65, 0x79, 0x64, 0xc9, 0x99, 0x72, 0x20, 0xc6, 0x8f, 0x6c, 0x69,
+  0x79, 0x65, 0x76, 0x00, 0x41, 0x68, 0x6d, 0x65, 0x64, 0x20, 0x62, 0x65,
+  0x79, 0x20, 0x41, 0x67, 0x61, 0x6f, 0x67, 0x6c, 0x75, 0x00, 0x4d, 0x61,
+  0x6d, 0x6d, 0x65, 0x64, 0x20, 0x41, 0x6d, 0x69, 0x6e, 0x20, 0x52, 0x61,
+  0x73, 0x75, 0x6c, 0x7a, 0x61, 0x64, 0x65, 0x00, 0x46, 0x61, 0x74, 0x61,
+  0x6c, 0x69, 0x20, 0x4b, 0x68, 0x61, 0x6e, 0x20, 0x4b, 0x68, 0x6f, 0x79,
+  0x73, 0x6b, 0x69, 0x00, 0x4e, 0x61, 0x72, 0x69, 0x6d, 0x61, 0x6e, 0x20,
+  0x4e, 0x61, 0x72, 0x69, 0x6d, 0x61, 0x6e, 0x6f, 0x76, 0x00, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x03, 0x03, 0x06, 0x07, 0x09, 0x01, 0xd0, 0x00, 0x94,
+  0xfe, 0xef, 0x03, 0x00, 0x2a, 0x41, 0x7a, 0x74, 0x65, 0x63, 0x00, 0x41,
+  0x7a, 0x74, 0x65, 0x63, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c,
+  0x3a, 0x41, 0x7a, 0x74, 0x65, 0x63, 0x73, 0x00, 0x61, 0x7a, 0x74, 0x65,
+  0x63, 0x00, 0x6d, 0x65, 0x78, 0x69, 0x63, 0x6f, 0x00, 0x54, 0x68, 0x65,
+  0x20, 0x41, 0x7a, 0x74, 0x65, 0x63, 0x61, 0x2c, 0x20, 0x61, 0x20, 0x4e,
+  0x61, 0x68, 0x75, 0x61, 0x74, 0x6c, 0x20, 0x73, 0x70, 0x65, 0x61, 0x6b,
+  0x69, 0x6e, 0x67, 0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6f, 0x6e, 0x6f,
+  0x72, 0x61, 0x6e, 0x20, 0x64, 0x65, 0x73, 0x65, 0x72, 0x74, 0x2c, 0x20,
+  0x73, 0x65, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72,
+  0x6f, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x54, 0x6f,
+  0x6c, 0x74, 0x65, 0x63, 0x2d, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+  0x20, 0x63, 0x69, 0x76, 0x69, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x43, 0x65, 0x6e, 0x74, 0x72, 0x61,
+  0x6c, 0x20, 0x4d, 0x65, 0x78, 0x69, 0x63, 0x6f, 0x20, 0x64, 0x75, 0x72,
+  0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x35, 0x74, 0x68,
+  0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x2c, 0x20, 0x72, 0x65,
+  0x76, 0x69, 0x76, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+  0x72, 0x61, 0x63, 0x74, 0x69, 0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x68,
+  0x75, 0x6d, 0x61, 0x6e, 0x20, 0x73, 0x61, 0x63, 0x72, 0x69, 0x66, 0x69,
+  0x63, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 0x77, 0x65, 0x72,
+  0x65, 0x20, 0x63, 0x6f, 0x6e, 0x71, 0x75, 0x65, 0x72, 0x65, 0x64, 0x20,
+  0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x70, 0x61, 0x6e, 0x69,
+  0x73, 0x68, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x43, 0x6f, 0x72,
+  0x74, 0xc3, 0xa9, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x35, 0x32, 0x31,
+  0x2e, 0x00, 0x02, 0x0a, 0x41, 0x63, 0x61, 0x6d, 0x61, 0x70, 0x69, 0x63,
+  0x68, 0x74, 0x6c, 0x69, 0x00, 0x49, 0x74, 0x7a, 0x63, 0x6f, 0x61, 0x74,
+  0x6c, 0x00, 0x4e, 0x65, 0x7a, 0x61, 0x68, 0x75, 0x61, 0x6c, 0x63, 0x6f,
+  0x79, 0x6f, 0x74, 0x6c, 0x00, 0x4d, 0x6f, 0x74, 0x65, 0x63, 0x75, 0x68,
+  0x7a, 0x6f, 0x6d, 0x61, 0x20, 0x49, 0x6c, 0x68, 0x75, 0x69, 0x63, 0x61,
+  0x6d, 0x69, 0x6e, 0x61, 0x00, 0x41, 0x78, 0x61, 0x79, 0x61, 0x63, 0x61,
+  0x74, 0x6c, 0x00, 0x41, 0x68, 0x75, 0x69, 0x74, 0x7a, 0x6f, 0x74, 0x6c,
+  0x00, 0x4d, 0x6f, 0x74, 0x65, 0x63, 0x75, 0x68, 0x7a, 0x6f, 0x6d, 0x61,
+  0x20, 0x58, 0x6f, 0x63, 0x6f, 0x79, 0x6f, 0x74, 0x7a, 0x69, 0x6e, 0x00,
+  0x43, 0x75, 0x61, 0x75, 0x68, 0x74, 0x65, 0x6d, 0x6f, 0x63, 0x00, 0x49,
+  0x78, 0x74, 0x6c, 0x69, 0x6c, 0x78, 0x6f, 0x63, 0x68, 0x69, 0x74, 0x6c,
+  0x00, 0x54, 0x65, 0x63, 0x75, 0x69, 0x63, 0x68, 0x70, 0x6f, 0x00, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x01, 0x00,
+  0x02, 0x01, 0x05, 0x09, 0x01, 0x48, 0x00, 0x94, 0x7f, 0xef, 0x03, 0x00,
+  0x2b, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x73, 0x00, 0x42, 0x61, 0x64, 0x69, 0x61, 0x6e, 0x00,
+  0x42, 0x61, 0x64, 0x69, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72,
+  0x61, 0x6c, 0x3a, 0x42, 0x61, 0x64, 0x69, 0x61, 0x6e, 0x73, 0x00, 0x62,
+  0x61, 0x64, 0x65, 0x6e, 0x00, 0x67, 0x65, 0x72, 0x6d, 0x61, 0x6e, 0x79,
+  0x00, 0x42, 0x61, 0x64, 0x65, 0x6e, 0x20, 0x77, 0x61, 0x73, 0x20, 0x61,
+  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x69, 0x6e, 0x20,
+  0x53, 0x77, 0x61, 0x62, 0x69, 0x61, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x73,
+  0x6f, 0x75, 0x74, 0x68, 0x77, 0x65, 0x73, 0x74, 0x65, 0x72, 0x6e, 0x20,
+  0x47, 0x65, 0x72, 0x6d, 0x61, 0x6e, 0x79, 0x2e, 0x20, 0x41, 0x66, 0x74,
+  0x65, 0x72, 0x20, 0x57, 0x6f, 0x72, 0x6c, 0x64, 0x20, 0x57, 0x61, 0x72,
+  0x20, 0x49, 0x49, 0x20, 0x69, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6d,
+  0x65, 0x72, 0x67, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x57,
+  0x75, 0x65, 0x72, 0x74, 0x74, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x67, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x48, 0x6f, 0x68, 0x65, 0x6e, 0x7a, 0x6f, 0x6c,
+  0x6c, 0x65, 0x72, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x66, 0x6f, 0x72, 0x6d,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x6f, 0x66,
+  0x20, 0x42, 0x61, 0x64, 0x65, 0x6e, 0x2d, 0x57, 0x75, 0x65, 0x72, 0x74,
+  0x74, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x67, 0x2e, 0x00, 0x06, 0x42, 0x65,
+  0x72, 0x74, 0x68, 0x6f, 0x6c, 0x64, 0x20, 0x49, 0x00, 0x48, 0x65, 0x72,
+  0x6d, 0x61, 0x6e, 0x6e, 0x20, 0x49, 0x49, 0x00, 0x4b, 0x61, 0x72, 0x6c,
+  0x20, 0x46, 0x72, 0x69, 0x65, 0x64, 0x72, 0x69, 0x63, 0x68, 0x00, 0x46,
+  0x72, 0x69, 0x65, 0x64, 0x72, 0x69, 0x63, 0x68, 0x20, 0x48, 0x65, 0x63,
+  0x6b, 0x65, 0x72, 0x00, 0x4d, 0x61, 0x78, 0x20, 0x76, 0x6f, 0x6e, 0x20,
+  0x42, 0x61, 0x64, 0x65, 0x6e, 0x00, 0x41, 0x64, 0x61, 0x6d, 0x20, 0x52,
+  0x65, 0x6d, 0x6d, 0x65, 0x6c, 0x65, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x07, 0x09, 0x01, 0x51, 0x00, 0x94,
+  0xfe, 0xef, 0x03, 0x00, 0x2c, 0x42, 0x61, 0x62, 0x79, 0x6c, 0x6f, 0x6e,
+  0x69, 0x61, 0x6e, 0x00, 0x42, 0x61, 0x62, 0x79, 0x6c, 0x6f, 0x6e, 0x69,
+  0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x42,
+  0x61, 0x62, 0x79, 0x6c, 0x6f, 0x6e, 0x69, 0x61, 0x6e, 0x73, 0x00, 0x62,
+  0x61, 0x62, 0x79, 0x6c, 0x6f, 0x6e, 0x00, 0x2d, 0x00, 0x42, 0x61, 0x62,
+  0x79, 0x6c, 0x6f, 0x6e, 0x20, 0x77, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x64, 0x6f, 0x6d, 0x69, 0x6e, 0x61, 0x6e, 0x74, 0x20, 0x63, 0x69,
+  0x74, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x4d, 0x65, 0x73, 0x6f, 0x70, 0x6f,
+  0x74, 0x61, 0x6d, 0x69, 0x61, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x31, 0x38, 0x74, 0x68, 0x20, 0x74, 0x6f, 0x20, 0x37,
+  0x74, 0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x69, 0x65, 0x73,
+  0x20, 0x42, 0x43, 0x45, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x61,
+  0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20,
+  0x6f, 0x66, 0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x73, 0x20, 0x69,
+  0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x41, 0x6d, 0x6f,
+  0x72, 0x69, 0x74, 0x65, 0x73, 0x2c, 0x20, 0x4b, 0x61, 0x73, 0x73, 0x69,
+  0x74, 0x65, 0x73, 0x2c, 0x20, 0x41, 0x73, 0x73, 0x79, 0x72, 0x69, 0x61,
+  0x6e, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x43, 0x68, 0x61, 0x6c,
+  0x64, 0x65, 0x61, 0x6e, 0x73, 0x2e, 0x00, 0x04, 0x06, 0x48, 0x61, 0x6d,
+  0x6d, 0x75, 0x72, 0x61, 0x62, 0x69, 0x00, 0x53, 0x68, 0x61, 0x72, 0x72,
+  0x75, 0x2d, 0x4b, 0x69, 0x6e, 0x20, 0x49, 0x49, 0x00, 0x4e, 0x61, 0x62,
+  0x75, 0x2d, 0x4b, 0x75, 0x64, 0x75, 0x72, 0x72, 0x69, 0x2d, 0x55, 0x73,
+  0x75, 0x72, 0x20, 0x49, 0x49, 0x00, 0x54, 0x75, 0x6b, 0x75, 0x6c, 0x74,
+  0x69, 0x2d, 0x41, 0x70, 0x69, 0x6c, 0x2d, 0x45, 0x73, 0x68, 0x61, 0x72,
+  0x61, 0x20, 0x49, 0x49, 0x49, 0x00, 0x42, 0x75, 0x72, 0x6e, 0x61, 0x62,
+  0x75, 0x72, 0x69, 0x73, 0x68, 0x20, 0x49, 0x49, 0x00, 0x4e, 0x61, 0x62,
+  0x75, 0x2d, 0x4e, 0x61, 0x73, 0x69, 0x72, 0x00, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x02, 0x01, 0x00, 0x02, 0x00, 0x06, 0x09, 0x02, 0xe3, 0x00,
+  0x94, 0xff, 0xef, 0x03, 0x00, 0x2d, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69,
+  0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x42, 0x61,
+  0x68, 0x61, 0x6d, 0x69, 0x61, 0x6e, 0x00, 0x42, 0x61, 0x68, 0x61, 0x6d,
+  0x69, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a,
+  0x42, 0x61, 0x68, 0x61, 0x6d, 0x69, 0x61, 0x6e, 0x73, 0x00, 0x62, 0x61,
+  0x68, 0x61, 0x6d, 0x61, 0x73, 0x00, 0x2d, 0x00, 0x54, 0x68, 0x65, 0x20,
+  0x42, 0x61, 0x68, 0x61, 0x6d, 0x61, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x61, 0x6e, 0x20, 0x69, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x67, 0x72,
+  0x6f, 0x75, 0x70, 0x20, 0x69, 0x6e, 0x20, 0x4e, 0x6f, 0x72, 0x74, 0x68,
+  0x20, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2e, 0x20, 0x49, 0x74,
+  0x20, 0x77, 0x61, 0x73, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x77, 0x68, 0x65,
+  0x72, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x42, 0x61,
+  0x68, 0x61, 0x6d, 0x61, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x43,
+  0x6f, 0x6c, 0x75, 0x6d, 0x62, 0x75, 0x73, 0x20, 0x66, 0x69, 0x72, 0x73,
+  0x74, 0x20, 0x73, 0x65, 0x74, 0x20, 0x00, 0x41, 0x6e, 0x74, 0x69, 0x67,
+  0x75, 0x61, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x42, 0x61, 0x72, 0x62, 0x75,
+  0x64, 0x61, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x72, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x45,
+  0x61, 0x73, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x43, 0x61, 0x72, 0x69, 0x62,
+  0x62, 0x65, 0x61, 0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x69, 0x73, 0x74,
+  0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
+  0x77, 0x6f, 0x20, 0x65, 0x70, 0x6f, 0x6e, 0x79, 0x6d, 0x6f, 0x75, 0x73,
+  0x20, 0x69, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x20, 0x61, 0x73, 0x20,
+  0x77, 0x65, 0x6c, 0x6c, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x6e, 0x75,
+  0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x6d, 0x61, 0x6c,
+  0x6c, 0x65, 0x72, 0x20, 0x69, 0x73, 0x6c, 0x65, 0x74, 0x73, 0x2e, 0x20,
+  0x54, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72, 0x79, 0x20,
+  0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6e, 0x20, 0x69, 0x6e, 0x64,
+  0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x55, 0x6e, 0x69, 0x74, 0x65, 0x64,
+  0x20, 0x4b, 0x69, 0x6e, 0x67, 0x64, 0x6f, 0x6d, 0x20, 0x73, 0x69, 0x6e,
+  0x63, 0x65, 0x20, 0x31, 0x39, 0x38, 0x31, 0x2e, 0x00, 0x02, 0x05, 0x43,
+  0x68, 0x72, 0x69, 0x73, 0x74, 0x6f, 0x70, 0x68, 0x65, 0x72, 0x20, 0x43,
+  0x6f, 0x64, 0x72, 0x69, 0x6e, 0x67, 0x74, 0x6f, 0x6e, 0x00, 0x50, 0x72,
+  0x69, 0x6e, 0x63, 0x65, 0x20, 0x4b, 0x6c, 0x61, 0x61, 0x73, 0x20, 0x53,
+  0x74, 0x6f, 0x6e, 0x65, 0x00, 0x56, 0x65, 0x72, 0x65, 0x20, 0x43, 0x6f,
+  0x72, 0x6e, 0x77, 0x61, 0x6c, 0x6c, 0x20, 0x42, 0x69, 0x72, 0x64, 0x00,
+  0x42, 0x61, 0x6c, 0x64, 0x77, 0x69, 0x6e, 0x20, 0x53, 0x70, 0x65, 0x6e,
+  0x63, 0x65, 0x72, 0x00, 0x4c, 0x6f, 0x75, 0x69, 0x73, 0x65, 0x20, 0x4c,
+  0x61, 0x6b, 0x65, 0x2d, 0x54, 0x61, 0x63, 0x6b, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x02, 0x03, 0x05, 0x09, 0x02, 0xd6, 0x00, 0x94,
+  0xff, 0xef, 0x03, 0x00, 0x19, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76,
+  0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x41, 0x6e, 0x74,
+  0x69, 0x6c, 0x6c, 0x65, 0x61, 0x6e, 0x00, 0x41, 0x6e, 0x74, 0x69, 0x6c,
+  0x6c, 0x65, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c,
+  0x3a, 0x41, 0x6e, 0x74, 0x69, 0x6c, 0x6c, 0x65, 0x61, 0x6e, 0x73, 0x00,
+  0x6e, 0x65, 0x74, 0x68, 0x65, 0x72, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x5f,
+  0x61, 0x6e, 0x74, 0x69, 0x6c, 0x6c, 0x65, 0x73, 0x00, 0x2d, 0x00, 0x54,
+  0x68, 0x65, 0x20, 0x69, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x20, 0x6f,
+  0x66, 0x20, 0x41, 0x72, 0x75, 0x62, 0x61, 0x2c, 0x20, 0x42, 0x6f, 0x6e,
+  0x61, 0x69, 0x72, 0x65, 0x2c, 0x20, 0x43, 0x75, 0x72, 0x61, 0x63, 0x61,
+  0x6f, 0x2c, 0x20, 0x53, 0x61, 0x62, 0x61, 0x2c, 0x20, 0x53, 0x61, 0x69,
+  0x6e, 0x74, 0x20, 0x4d, 0x61, 0x72, 0x74, 0x69, 0x6e, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x53, 0x61, 0x69, 0x6e, 0x74, 0x20, 0x45, 0x75, 0x73, 0x74,
+  0x61, 0x74, 0x69, 0x75, 0x73, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x63,
+  0x6f, 0x6c, 0x6f, 0x6e, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x44, 0x75, 0x74, 0x63, 0x68, 0x20, 0x69, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x37, 0x74, 0x68, 0x20, 0x63, 0x65,
+  0x6e, 0x74, 0x75, 0x72, 0x79, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x69, 0x72,
+  0x20, 0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x69, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x69, 0x78, 0x65, 0x64, 0x20,
+  0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x61, 0x6e, 0x2c, 0x20, 0x41, 0x66,
+  0x72, 0x69, 0x63, 0x61, 0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x4c, 0x61,
+  0x74, 0x69, 0x6e, 0x20, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6e,
+  0x20, 0x68, 0x65, 0x72, 0x69, 0x74, 0x61, 0x67, 0x65, 0x2e, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x4e, 0x65, 0x74, 0x68, 0x65, 0x72, 0x6c, 0x61, 0x6e,
+  0x64, 0x73, 0x20, 0x41, 0x6e, 0x74, 0x69, 0x6c, 0x6c, 0x65, 0x73, 0x20,
+  0x67, 0x61, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x72,
+  0x6e, 0x61, 0x6c, 0x20, 0x73, 0x65, 0x6c, 0x66, 0x20, 0x67, 0x6f, 0x76,
+  0x65, 0x72, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x31,
+  0x39, 0x35, 0x34, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x77, 0x65, 0x72,
+  0x65, 0x20, 0x73, 0x75, 0x62, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74,
+  0x6c, 0x79, 0x20, 0x64, 0x69, 0x73, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x64,
+  0x20, 0x69, 0x6e, 0x20, 0x32, 0x30, 0x31, 0x30, 0x2e, 0x20, 0x41, 0x72,
+  0x75, 0x62, 0x61, 0x2c, 0x20, 0x43, 0x75, 0x72, 0x61, 0x63, 0x61, 0x6f,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x53, 0x61, 0x69, 0x6e, 0x74, 0x20, 0x4d,
+  0x61, 0x72, 0x74, 0x69, 0x6e, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4b, 0x69, 0x6e, 0x67, 0x64,
+  0x6f, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4e, 0x65,
+  0x74, 0x68, 0x65, 0x72, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x3b, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x72,
+  0x65, 0x65, 0x20, 0x69, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x20, 0x68,
+  0x61, 0x76, 0x65, 0x20, 0x62, 0x65, 0x65, 0x6e, 0x20, 0x64, 0x69, 0x72,
+  0x65, 0x63, 0x74, 0x6c, 0x79, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x72,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x4e, 0x65, 0x74, 0x68, 0x65, 0x72, 0x6c, 0x61, 0x6e, 0x64,
+  0x73, 0x20, 0x61, 0x73, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c,
+  0x20, 0x6d, 0x75, 0x6e, 0x69, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x69, 0x74,
+  0x69, 0x65, 0x73, 0x2e, 0x00, 0x02, 0x08, 0x41, 0x6c, 0x6f, 0x6e, 0x73,
+  0x6f, 0x20, 0x64, 0x65, 0x20, 0x4f, 0x6a, 0x65, 0x64, 0x61, 0x00, 0x4a,
+  0x6f, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x73, 0x20, 0x76, 0x61, 0x6e, 0x20,
+  0x57, 0x61, 0x6c, 0x62, 0x65, 0x65, 0x63, 0x6b, 0x00, 0x4a, 0x6f, 0x68,
+  0x61, 0x6e, 0x6e, 0x65, 0x73, 0x20, 0x64, 0x65, 0x20, 0x47, 0x72, 0x61,
+  0x61, 0x66, 0x66, 0x00, 0x54, 0x75, 0x6c, 0x61, 0x00, 0x57, 0x69, 0x6c,
+  0x73, 0x6f, 0x6e, 0x20, 0x47, 0x6f, 0x64, 0x65, 0x74, 0x74, 0x00, 0x42,
+  0x65, 0x74, 0x69, 0x63, 0x6f, 0x20, 0x43, 0x72, 0x6f, 0x65, 0x73, 0x00,
+  0x4d, 0x69, 0x67, 0x75, 0x65, 0x6c, 0x20, 0x50, 0x6f, 0x75, 0x72, 0x69,
+  0x65, 0x72, 0x00, 0x45, 0x6d, 0x69, 0x6c, 0x79, 0x20, 0x64, 0x65, 0x20,
+  0x4a, 0x6f, 0x6e, 0x67, 0x68, 0x2d, 0x45, 0x6c, 0x68, 0x61, 0x67, 0x65,
+  0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01,
+  0x05, 0x09, 0x01, 0xe9, 0x00, 0x94, 0xfe, 0xef, 0x03, 0x00, 0x1a, 0x41,
+  0x70, 0x61, 0x63, 0x68, 0x65, 0x00, 0x41, 0x70, 0x61, 0x63, 0x68, 0x65,
+  0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x41, 0x70, 0x61,
+  0x63, 0x68, 0x65, 0x73, 0x00, 0x61, 0x70, 0x61, 0x63, 0x68, 0x65, 0x00,
+  0x2d, 0x00, 0x54, 0x68, 0x65, 0x20, 0x41, 0x70, 0x61, 0x63, 0x68, 0x65,
+  0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x20, 0x67, 0x72, 0x6f, 0x75,
+  0x70, 0x20, 0x6f, 0x66, 0x20, 0x41, 0x74, 0x68, 0x61, 0x62, 0x61, 0x73,
+  0x63, 0x61, 0x6e, 0x20, 0x73, 0x70, 0x65, 0x61, 0x6b, 0x69, 0x6e, 0x67,
+  0x20, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x20, 0x74, 0x72, 0x69, 0x62,
+  0x65, 0x73, 0x20, 0x6c, 0x69, 0x76, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e,
+  0x20, 0x41, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x61, 0x2c, 0x20, 0x4e, 0x65,
+  0x77, 0x20, 0x4d, 0x65, 0x78, 0x69, 0x63, 0x6f, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x4f, 0x6b, 0x6c, 0x61, 0x68, 0x6f, 0x6d, 0x61, 0x2e, 0x20, 0x41,
+  0x70, 0x61, 0x63, 0x68, 0x65, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73,
+  0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x57, 0x65, 0x73, 0x74, 0x65, 0x72, 0x6e, 0x2c, 0x20, 0x43, 0x68,
+  0x69, 0x72, 0x69, 0x63, 0x61, 0x68, 0x75, 0x61, 0x2c, 0x20, 0x4d, 0x65,
+  0x73, 0x63, 0x61, 0x6c, 0x65, 0x72, 0x6f, 0x2c, 0x20, 0x4a, 0x69, 0x63,
+  0x61, 0x72, 0x69, 0x6c, 0x6c, 0x61, 0x2c, 0x20, 0x4c, 0x69, 0x70, 0x61,
+  0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x50, 0x6c, 0x61, 0x69, 0x6e, 0x73,
+  0x20, 0x41, 0x70, 0x61, 0x63, 0x68, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x65,
+  0x79, 0x20, 0x63, 0x61, 0x6d, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x46, 0x61, 0x72, 0x20, 0x4e, 0x6f, 0x72, 0x74,
+  0x68, 0x20, 0x61, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x31, 0x30, 0x30,
+  0x30, 0x20, 0x43, 0x45, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x41, 0x70,
+  0x61, 0x63, 0x68, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6b, 0x6e, 0x6f,
+  0x77, 0x6e, 0x20, 0x61, 0x73, 0x20, 0x66, 0x69, 0x65, 0x72, 0x63, 0x65,
+  0x20, 0x77, 0x61, 0x72, 0x72, 0x69, 0x6f, 0x72, 0x73, 0x2e, 0x20, 0x49,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x39, 0x74, 0x68, 0x20, 0x63,
+  0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x20, 0x69, 0x74, 0x20, 0x74, 0x6f,
+  0x6f, 0x6b, 0x20, 0x74, 0x68, 0x65, 0x20, 0x55, 0x6e, 0x69, 0x74, 0x65,
+  0x64, 0x20, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x20, 0x68, 0x61, 0x6c,
+  0x66, 0x20, 0x61, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x20,
+  0x74, 0x6f, 0x20, 0x73, 0x75, 0x62, 0x64, 0x75, 0x65, 0x20, 0x74, 0x68,
+  0x65, 0x6d, 0x2e, 0x00, 0x05, 0x06, 0x44, 0x61, 0x73, 0x6f, 0x64, 0x61,
+  0x2d, 0x68, 0x61, 0x65, 0x00, 0x4b, 0x27, 0x75, 0x75, 0x2d, 0x63, 0x68,
+  0x27, 0x69, 0x73, 0x68, 0x00, 0x47, 0x6f, 0x79, 0x61, 0x61, 0xc5, 0x82,
+  0xc3, 0xa9, 0x00, 0x44, 0x6f, 0x73, 0x2d, 0x54, 0x65, 0x68, 0x2d, 0x53,
+  0x65, 0x68, 0x00, 0x47, 0xc3, 0xb3, 0x79, 0xc4, 0x85, 0xcc, 0x81, 0xc5,
+  0x84, 0x00, 0x41, 0x6c, 0x63, 0x68, 0x65, 0x73, 0x61, 0x79, 0x00, 0x01,
+  0x01, 0x01, 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x05, 0x09, 0x00,
+  0xab, 0x00, 0x94, 0xfe, 0xef, 0x03, 0x00, 0x1b, 0x41, 0x72, 0x61, 0x62,
+  0x00, 0x41, 0x72, 0x61, 0x62, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61,
+  0x6c, 0x3a, 0x41, 0x72, 0x61, 0x62, 0x73, 0x00, 0x61, 0x72, 0x61, 0x62,
+  0x00, 0x2d, 0x00, 0x54, 0x68, 0x65, 0x20, 0x41, 0x72, 0x61, 0x62, 0x2f,
+  0x49, 0x73, 0x6c, 0x61, 0x6d, 0x69, 0x63, 0x20, 0x63, 0x69, 0x76, 0x69,
+  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20,
+  0x36, 0x32, 0x32, 0x20, 0x74, 0x6f, 0x20, 0x31, 0x34, 0x39, 0x35, 0x20,
+  0x43, 0x45, 0x2e, 0x00, 0x01, 0x07, 0x4d, 0x6f, 0x68, 0x61, 0x6d, 0x6d,
+  0x61, 0x64, 0x00, 0x46, 0x61, 0x74, 0x69, 0x6d, 0x61, 0x68, 0x00, 0x55,
+  0x6d, 0x61, 0x72, 0x00, 0x48, 0x61, 0x72, 0x75, 0x6e, 0x20, 0x61, 0x6c,
+  0x2d, 0x52, 0x61, 0x73, 0x68, 0x69, 0x64, 0x00, 0x53, 0x61, 0x6c, 0x61,
+  0x64, 0x69, 0x6e, 0x00, 0x41, 0x6c, 0x2d, 0x4d, 0x61, 0x6e, 0x73, 0x75,
+  0x72, 0x00, 0x41, 0x6c, 0x2d, 0x48, 0x61, 0x6b, 0x69, 0x6d, 0x00, 0x01,
+  0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x06,
+  0x04, 0x09, 0x02, 0xa8, 0x00, 0x94, 0x7f, 0xef, 0x03, 0x00, 0x1c, 0x66,
+  0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x73, 0x00, 0x41, 0x72, 0x61, 0x67, 0x6f, 0x6e, 0x65, 0x73, 0x65,
+  0x00, 0x41, 0x72, 0x61, 0x67, 0x6f, 0x6e, 0x65, 0x73, 0x65, 0x00, 0x3f,
+  0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x41, 0x72, 0x61, 0x67, 0x6f,
+  0x6e, 0x65, 0x73, 0x65, 0x00, 0x61, 0x72, 0x61, 0x67, 0x6f, 0x6e, 0x00,
+  0x2d, 0x00, 0x41, 0x72, 0x61, 0x67, 0x6f, 0x6e, 0x20, 0x77, 0x61, 0x73,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61,
+  0x20, 0x46, 0x72, 0x61, 0x6e, 0x6b, 0x69, 0x73, 0x68, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x77, 0x61, 0x73,
+  0x20, 0x65, 0x6c, 0x65, 0x76, 0x61, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f,
+  0x20, 0x61, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x64, 0x6f, 0x6d, 0x20, 0x69,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x31, 0x74, 0x68, 0x20, 0x63,
+  0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x2e, 0x20, 0x49, 0x74, 0x20, 0x65,
+  0x78, 0x70, 0x61, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x69, 0x74, 0x73, 0x20,
+  0x74, 0x65, 0x72, 0x72, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x73, 0x6f,
+  0x75, 0x74, 0x68, 0x77, 0x61, 0x72, 0x64, 0x73, 0x20, 0x64, 0x75, 0x72,
+  0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6f,
+  0x6e, 0x71, 0x75, 0x69, 0x73, 0x74, 0x61, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x73, 0x75, 0x62, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x6c, 0x79,
+  0x20, 0x6d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20,
+  0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x61, 0x20, 0x6c, 0x61,
+  0x72, 0x67, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x4d, 0x65, 0x64, 0x69, 0x74, 0x65, 0x72, 0x72,
+  0x61, 0x6e, 0x65, 0x61, 0x6e, 0x2e, 0x20, 0x49, 0x6e, 0x20, 0x31, 0x34,
+  0x65, 0x6f, 0x70, 0x6c, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x73,
+  0x20, 0x61, 0x6e, 0x20, 0x6f, 0x66, 0x66, 0x69, 0x63, 0x69, 0x61, 0x6c,
+  0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x6f, 0x66, 0x20, 0x50, 0x61, 0x72, 0x61, 0x67, 0x75, 0x61, 0x79, 0x2e,
+  0x00, 0x02, 0x04, 0x53, 0x65, 0x70, 0x65, 0x20, 0x54, 0x69, 0x61, 0x72,
+  0x61, 0x6a, 0x75, 0x00, 0x4e, 0x68, 0x65, 0xc3, 0xa7, 0x75, 0x00, 0x4e,
+  0x69, 0x63, 0x6f, 0x6c, 0xc3, 0xa1, 0x73, 0x20, 0xc3, 0x91, 0x61, 0x6e,
+  0x67, 0x75, 0x69, 0x72, 0xc3, 0xba, 0x00, 0x4d, 0x69, 0x67, 0x75, 0x65,
+  0x6c, 0x20, 0x47, 0x75, 0x61, 0x72, 0x75, 0x6d, 0x62, 0x61, 0x00, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x06, 0x02, 0xd2, 0x00, 0x94,
+  0xff, 0xef, 0x03, 0x00, 0xc8, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76,
+  0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x47, 0x75, 0x61,
+  0x74, 0x65, 0x6d, 0x61, 0x6c, 0x61, 0x6e, 0x00, 0x47, 0x75, 0x61, 0x74,
+  0x65, 0x6d, 0x61, 0x6c, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72,
+  0x61, 0x6c, 0x3a, 0x47, 0x75, 0x61, 0x74, 0x65, 0x6d, 0x61, 0x6c, 0x61,
+  0x6e, 0x73, 0x00, 0x67, 0x75, 0x61, 0x74, 0x65, 0x6d, 0x61, 0x6c, 0x61,
+  0x00, 0x2d, 0x00, 0x54, 0x68, 0x65, 0x20, 0x61, 0x6e, 0x63, 0x69, 0x65,
+  0x6e, 0x74, 0x20, 0x68, 0x65, 0x61, 0x72, 0x74, 0x6c, 0x61, 0x6e, 0x64,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4d, 0x61, 0x79, 0x61,
+  0x73, 0x2c, 0x20, 0x47, 0x75, 0x61, 0x74, 0x65, 0x6d, 0x61, 0x6c, 0x61,
+  0x20, 0x77, 0x61, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x71, 0x75, 0x65, 0x72,
+  0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x70,
+  0x61, 0x6e, 0x69, 0x73, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x31, 0x36, 0x74, 0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72,
+  0x79, 0x2e, 0x20, 0x49, 0x74, 0x20, 0x62, 0x65, 0x63, 0x61, 0x6d, 0x65,
+  0x20, 0x69, 0x6e, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74,
+  0x20, 0x69, 0x6e, 0x20, 0x31, 0x38, 0x32, 0x31, 0x20, 0x62, 0x75, 0x74,
+  0x20, 0x77, 0x61, 0x73, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x55, 0x6e, 0x69, 0x74, 0x65, 0x64, 0x20,
+  0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x43, 0x65,
+  0x6e, 0x74, 0x72, 0x61, 0x6c, 0x20, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x31, 0x38, 0x34, 0x30,
+  0x2e, 0x20, 0x49, 0x74, 0x20, 0x68, 0x61, 0x73, 0x20, 0x65, 0x6e, 0x64,
+  0x75, 0x72, 0x65, 0x64, 0x20, 0x70, 0x6f, 0x6c, 0x69, 0x74, 0x69, 0x63,
+  0x61, 0x6c, 0x20, 0x74, 0x75, 0x72, 0x6d, 0x6f, 0x69, 0x6c, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x6d, 0x75, 0x63, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x69,
+  0x74, 0x73, 0x20, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x2e, 0x20,
+  0x47, 0x75, 0x61, 0x74, 0x65, 0x6d, 0x61, 0x6c, 0x61, 0x20, 0x6c, 0x69,
+  0x76, 0x65, 0x64, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x20,
+  0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d,
+  0x6f, 0x73, 0x74, 0x20, 0x62, 0x72, 0x75, 0x74, 0x61, 0x6c, 0x20, 0x63,
+  0x69, 0x76, 0x69, 0x6c, 0x20, 0x77, 0x61, 0x72, 0x73, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x32, 0x30, 0x74, 0x68, 0x20, 0x63, 0x65,
+  0x6e, 0x74, 0x75, 0x72, 0x79, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20,
+  0x61, 0x20, 0x70, 0x65, 0x61, 0x63, 0x65, 0x20, 0x61, 0x67, 0x72, 0x65,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x73, 0x69,
+  0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x39, 0x39, 0x36,
+  0x2e, 0x00, 0x04, 0x0c, 0x50, 0x65, 0x64, 0x72, 0x6f, 0x20, 0x64, 0x65,
+  0x20, 0x41, 0x6c, 0x76, 0x61, 0x72, 0x61, 0x64, 0x6f, 0x00, 0x4d, 0x61,
+  0x6e, 0x75, 0x65, 0x6c, 0x20, 0x43, 0x61, 0x72, 0x72, 0x65, 0x72, 0x61,
+  0x00, 0x4a, 0x6f, 0x73, 0xc3, 0xa9, 0x20, 0x52, 0x75, 0x66, 0x69, 0x6e,
+  0x6f, 0x20, 0x42, 0x61, 0x72, 0x72, 0x69, 0x6f, 0x73, 0x00, 0x4d, 0x61,
+  0x6e, 0x75, 0x65, 0x6c, 0x20, 0x45, 0x73, 0x74, 0x72, 0x61, 0x64, 0x61,
+  0x20, 0x43, 0x61, 0x62, 0x72, 0x65, 0x72, 0x61, 0x00, 0x4a, 0x6f, 0x72,
+  0x67, 0x65, 0x20, 0x55, 0x62, 0x69, 0x63, 0x6f, 0x00, 0x4a, 0x75, 0x61,
+  0x6e, 0x20, 0x4a, 0x6f, 0x73, 0xc3, 0xa9, 0x20, 0x41, 0x72, 0xc3, 0xa9,
+  0x76, 0x61, 0x6c, 0x6f, 0x00, 0x4a, 0x61, 0x63, 0x6f, 0x62, 0x6f, 0x20,
+  0xc3, 0x81, 0x72, 0x62, 0x65, 0x6e, 0x7a, 0x20, 0x47, 0x75, 0x7a, 0x6d,
+  0xc3, 0xa1, 0x6e, 0x00, 0x43, 0x61, 0x72, 0x6c, 0x6f, 0x73, 0x20, 0x43,
+  0x61, 0x73, 0x74, 0x69, 0x6c, 0x6c, 0x6f, 0x20, 0x41, 0x72, 0x6d, 0x61,
+  0x73, 0x00, 0x4d, 0x69, 0x67, 0x75, 0x65, 0x6c, 0x20, 0x59, 0x64, 0xc3,
+  0xad, 0x67, 0x6f, 0x72, 0x61, 0x73, 0x00, 0x4a, 0x75, 0x6c, 0x69, 0x6f,
+  0x20, 0x43, 0xc3, 0xa9, 0x73, 0x61, 0x72, 0x20, 0x4d, 0xc3, 0xa9, 0x6e,
+  0x64, 0x65, 0x7a, 0x20, 0x4d, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x65, 0x67,
+  0x72, 0x6f, 0x00, 0x46, 0x65, 0x72, 0x6e, 0x61, 0x6e, 0x64, 0x6f, 0x20,
+  0x52, 0x6f, 0x6d, 0x65, 0x6f, 0x20, 0x4c, 0x75, 0x63, 0x61, 0x73, 0x20,
+  0x47, 0x61, 0x72, 0x63, 0xc3, 0xad, 0x61, 0x00, 0x45, 0x66, 0x72, 0x61,
+  0xc3, 0xad, 0x6e, 0x20, 0x52, 0xc3, 0xad, 0x6f, 0x73, 0x20, 0x4d, 0x6f,
+  0x6e, 0x74, 0x74, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x05, 0x06, 0x01, 0x63,
+  0x00, 0x94, 0xff, 0xef, 0x03, 0x00, 0xc9, 0x66, 0x72, 0x65, 0x65, 0x63,
+  0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x47,
+  0x75, 0x69, 0x6e, 0x65, 0x61, 0x6e, 0x00, 0x47, 0x75, 0x69, 0x6e, 0x65,
+  0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x47,
+  0x75, 0x69, 0x6e, 0x65, 0x61, 0x6e, 0x00, 0x67, 0x75, 0x69, 0x6e, 0x65,
+  0x61, 0x00, 0x2d, 0x00, 0x47, 0x75, 0x69, 0x6e, 0x65, 0x61, 0x20, 0x64,
+  0x65, 0x63, 0x6c, 0x61, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x64, 0x65,
+  0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x20, 0x46, 0x72, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x20,
+  0x31, 0x39, 0x35, 0x38, 0x2e, 0x20, 0x49, 0x74, 0x73, 0x20, 0x66, 0x69,
+  0x72, 0x73, 0x74, 0x20, 0x70, 0x72, 0x65, 0x73, 0x69, 0x64, 0x65, 0x6e,
+  0x74, 0x20, 0x41, 0x68, 0x6d, 0x65, 0x64, 0x20, 0x53, 0xc3, 0xa9, 0x6b,
+  0x6f, 0x75, 0x20, 0x54, 0x6f, 0x75, 0x72, 0xc3, 0xa9, 0x20, 0x63, 0x6f,
+  0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x72,
+  0x75, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x72, 0x79, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x68, 0x69,
+  0x73, 0x20, 0x64, 0x65, 0x61, 0x74, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x31,
+  0x39, 0x38, 0x34, 0x2e, 0x20, 0x47, 0x75, 0x69, 0x6e, 0x65, 0x61, 0x20,
+  0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x65,
+  0x20, 0x63, 0x6f, 0x6e, 0x66, 0x75, 0x73, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x6e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 0x72, 0x69,
+  0x6e, 0x67, 0x20, 0x47, 0x75, 0x69, 0x6e, 0x65, 0x61, 0x2d, 0x42, 0x69,
+  0x73, 0x73, 0x61, 0x75, 0x2e, 0x00, 0x02, 0x04, 0x41, 0x68, 0x6d, 0x65,
+  0x64, 0x20, 0x53, 0xc3, 0xa9, 0x6b, 0x6f, 0x75, 0x20, 0x54, 0x6f, 0x75,
+  0x72, 0xc3, 0xa9, 0x00, 0x4c, 0x6f, 0x75, 0x69, 0x73, 0x20, 0x4c, 0x61,
+  0x6e, 0x73, 0x61, 0x6e, 0x61, 0x20, 0x42, 0x65, 0x61, 0x76, 0x6f, 0x67,
+  0x75, 0x69, 0x00, 0x4c, 0x61, 0x6e, 0x73, 0x61, 0x6e, 0x61, 0x20, 0x43,
+  0x6f, 0x6e, 0x74, 0xc3, 0xa9, 0x00, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x20,
+  0x43, 0x6f, 0x6e, 0x64, 0xc3, 0xa9, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x02, 0x04, 0x03, 0x06, 0x00, 0xfd, 0x00, 0x94, 0xff, 0xef, 0x03,
+  0x00, 0xca, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x47, 0x75, 0x70, 0x74, 0x61, 0x00,
+  0x47, 0x75, 0x70, 0x74, 0x61, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61,
+  0x6c, 0x3a, 0x47, 0x75, 0x70, 0x74, 0x61, 0x00, 0x67, 0x75, 0x70, 0x74,
+  0x61, 0x00, 0x2d, 0x00, 0x54, 0x68, 0x65, 0x20, 0x47, 0x75, 0x70, 0x74,
+  0x61, 0x20, 0x45, 0x6d, 0x70, 0x69, 0x72, 0x65, 0x20, 0x77, 0x61, 0x73,
+  0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x67, 0x72, 0x65, 0x61, 0x74, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x69,
+  0x63, 0x61, 0x6c, 0x20, 0x65, 0x6d, 0x70, 0x69, 0x72, 0x65, 0x73, 0x2e,
+  0x20, 0x49, 0x74, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x64, 0x20, 0x6e, 0x6f,
+  0x72, 0x74, 0x68, 0x65, 0x72, 0x6e, 0x20, 0x49, 0x6e, 0x64, 0x69, 0x61,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x61, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+  0x20, 0x32, 0x34, 0x30, 0x20, 0x74, 0x6f, 0x20, 0x35, 0x35, 0x30, 0x20,
+  0x43, 0x45, 0x2e, 0x00, 0x04, 0x05, 0x43, 0x68, 0x61, 0x6e, 0x64, 0x72,
+  0x61, 0x20, 0x47, 0x75, 0x70, 0x74, 0x61, 0x20, 0x49, 0x00, 0x53, 0x75,
+  0x6d, 0x75, 0x64, 0x72, 0x61, 0x20, 0x47, 0x75, 0x70, 0x74, 0x61, 0x00,
+  0x4b, 0x75, 0x6d, 0x61, 0x72, 0x61, 0x20, 0x47, 0x75, 0x70, 0x74, 0x61,
+  0x00, 0x53, 0x6b, 0x61, 0x6e, 0x64, 0x61, 0x20, 0x47, 0x75, 0x70, 0x74,
+  0x61, 0x00, 0x43, 0x68, 0x61, 0x6e, 0x64, 0x72, 0x61, 0x20, 0x47, 0x75,
+  0x70, 0x74, 0x61, 0x20, 0x49, 0x49, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x02, 0x06, 0x00, 0x06, 0x01, 0xcb, 0x00, 0x94, 0xff, 0xef,
+  0x03, 0x00, 0xcb, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x47, 0x75, 0x79, 0x61, 0x6e,
+  0x65, 0x73, 0x65, 0x00, 0x47, 0x75, 0x79, 0x61, 0x6e, 0x65, 0x73, 0x65,
+  0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x47, 0x75, 0x79,
+  0x61, 0x6e, 0x65, 0x73, 0x65, 0x00, 0x67, 0x75, 0x79, 0x61, 0x6e, 0x61,
+  0x00, 0x2d, 0x00, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x6c,
+  0x79, 0x20, 0x69, 0x6e, 0x68, 0x61, 0x62, 0x69, 0x74, 0x65, 0x64, 0x20,
+  0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41, 0x72, 0x61, 0x77, 0x6b,
+  0x2c, 0x20, 0x47, 0x75, 0x79, 0x61, 0x6e, 0x61, 0x20, 0x77, 0x61, 0x73,
+  0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x6e, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x62,
+  0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x44, 0x75, 0x74, 0x63, 0x68, 0x20,
+  0x62, 0x75, 0x74, 0x20, 0x62, 0x65, 0x63, 0x61, 0x6d, 0x65, 0x20, 0x61,
+  0x20, 0x42, 0x72, 0x69, 0x74, 0x69, 0x73, 0x68, 0x20, 0x63, 0x6f, 0x6c,
+  0x6f, 0x6e, 0x79, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x4e, 0x61, 0x70, 0x6f, 0x6c, 0x65, 0x6f, 0x6e, 0x69, 0x63,
+  0x20, 0x57, 0x61, 0x72, 0x73, 0x2e, 0x20, 0x49, 0x74, 0x20, 0x67, 0x61,
+  0x69, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x70, 0x65, 0x6e,
+  0x64, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x39, 0x36,
+  0x36, 0x2e, 0x20, 0x55, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x46, 0x6f, 0x72,
+  0x62, 0x65, 0x73, 0x20, 0x42, 0x75, 0x72, 0x6e, 0x68, 0x61, 0x6d, 0x20,
+  0x47, 0x75, 0x79, 0x61, 0x6e, 0x61, 0x20, 0x62, 0x65, 0x63, 0x61, 0x6d,
+  0x65, 0x20, 0x61, 0x20, 0x4d, 0x61, 0x72, 0x78, 0x69, 0x73, 0x74, 0x20,
+  0x6f, 0x72, 0x69, 0x65, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x72, 0x79, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x69, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x39, 0x38, 0x30, 0x73, 0x20, 0x69,
+  0x74, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x64, 0x20, 0x69, 0x74,
+  0x73, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x65, 0x74,
+  0x20, 0x64, 0x65, 0x6d, 0x6f, 0x63, 0x72, 0x61, 0x63, 0x79, 0x2e, 0x00,
+  0x02, 0x06, 0x43, 0x75, 0x66, 0x66, 0x79, 0x00, 0x47, 0x6f, 0x72, 0x64,
+  0x6f, 0x6e, 0x20, 0x4a, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x4c, 0x65, 0x74,
+  0x68, 0x65, 0x6d, 0x00, 0x46, 0x6f, 0x72, 0x62, 0x65, 0x73, 0x20, 0x42,
+  0x75, 0x72, 0x6e, 0x68, 0x61, 0x6d, 0x00, 0x43, 0x68, 0x65, 0x64, 0x64,
+  0x69, 0x20, 0x4a, 0x61, 0x67, 0x61, 0x6e, 0x00, 0x4a, 0x61, 0x6e, 0x65,
+  0x74, 0x20, 0x52, 0x6f, 0x73, 0x65, 0x6e, 0x62, 0x65, 0x72, 0x67, 0x20,
+  0x4a, 0x61, 0x67, 0x61, 0x6e, 0x00, 0x42, 0x68, 0x61, 0x72, 0x72, 0x61,
+  0x74, 0x20, 0x4a, 0x61, 0x67, 0x64, 0x65, 0x6f, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x05, 0x03, 0x06, 0x01, 0x6f, 0x00,
+  0x94, 0xff, 0xef, 0x03, 0x00, 0xcc, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69,
+  0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x48, 0x61,
+  0x63, 0x6b, 0x65, 0x72, 0x00, 0x48, 0x61, 0x63, 0x6b, 0x65, 0x72, 0x00,
+  0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x48, 0x61, 0x63, 0x6b,
+  0x65, 0x72, 0x73, 0x00, 0x68, 0x61, 0x63, 0x6b, 0x65, 0x72, 0x00, 0x2d,
+  0x00, 0x68, 0x34, 0x78, 0x78, 0x30, 0x72, 0x20, 0x72, 0x30, 0x78, 0x78,
+  0x30, 0x72, 0x7a, 0x21, 0x00, 0x01, 0x65, 0x67, 0x61, 0x6e, 0x20, 0x74,
+  0x6f, 0x20, 0x67, 0x72, 0x6f, 0x77, 0x2e, 0x20, 0x44, 0x75, 0x72, 0x69,
+  0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x31, 0x74, 0x68, 0x20,
+  0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x2c, 0x20, 0x74, 0x68, 0x65,
+  0x79, 0x20, 0x6c, 0x65, 0x64, 0x20, 0x65, 0x78, 0x70, 0x65, 0x64, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x73,
+  0x74, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x49, 0x6e, 0x64, 0x69,
+  0x61, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x73,
+  0x20, 0x66, 0x61, 0x72, 0x20, 0x6e, 0x6f, 0x72, 0x74, 0x68, 0x20, 0x61,
+  0x73, 0x20, 0x42, 0x65, 0x6e, 0x67, 0x61, 0x6c, 0x2c, 0x20, 0x61, 0x73,
+  0x20, 0x77, 0x65, 0x6c, 0x6c, 0x20, 0x61, 0x73, 0x20, 0x61, 0x67, 0x61,
+  0x69, 0x6e, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4d, 0x61, 0x6c,
+  0x64, 0x69, 0x76, 0x65, 0x73, 0x2c, 0x20, 0x53, 0x72, 0x69, 0x20, 0x4c,
+  0x61, 0x6e, 0x6b, 0x61, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x65, 0x76, 0x65,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x49, 0x6e, 0x64, 0x6f, 0x6e, 0x65,
+  0x73, 0x69, 0x61, 0x6e, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x64, 0x6f, 0x6d,
+  0x20, 0x6f, 0x66, 0x20, 0x53, 0x72, 0x69, 0x20, 0x56, 0x69, 0x6a, 0x61,
+  0x79, 0x61, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 0x63, 0x6f, 0x6c,
+  0x6c, 0x61, 0x70, 0x73, 0x65, 0x64, 0x2c, 0x20, 0x68, 0x6f, 0x77, 0x65,
+  0x76, 0x65, 0x72, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x31, 0x32, 0x35, 0x30, 0x73, 0x20, 0x61, 0x73, 0x20, 0x6f, 0x74, 0x68,
+  0x65, 0x72, 0x20, 0x73, 0x6f, 0x75, 0x74, 0x68, 0x65, 0x72, 0x6e, 0x20,
+  0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65,
+  0x73, 0x20, 0x72, 0x6f, 0x73, 0x65, 0x20, 0x75, 0x70, 0x2e, 0x00, 0x02,
+  0x04, 0x41, 0x64, 0x69, 0x74, 0x79, 0x61, 0x20, 0x49, 0x00, 0x52, 0x61,
+  0x6a, 0x61, 0x72, 0x61, 0x6a, 0x61, 0x20, 0x43, 0x68, 0x6f, 0x6c, 0x61,
+  0x20, 0x49, 0x00, 0x52, 0x61, 0x6a, 0x65, 0x6e, 0x64, 0x72, 0x61, 0x20,
+  0x43, 0x68, 0x6f, 0x6c, 0x61, 0x20, 0x49, 0x49, 0x00, 0x4b, 0x75, 0x6c,
+  0x6f, 0x74, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x20, 0x43, 0x68, 0x6f, 0x6c,
+  0x61, 0x20, 0x49, 0x49, 0x49, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x02, 0x06, 0x01, 0x06, 0x02, 0x51, 0x00, 0x94, 0xff, 0xef, 0x03, 0x00,
+  0x6f, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x73, 0x00, 0x43, 0x68, 0x72, 0x6f, 0x62, 0x61, 0x74,
+  0x69, 0x61, 0x6e, 0x00, 0x43, 0x68, 0x72, 0x6f, 0x62, 0x61, 0x74, 0x69,
+  0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x43,
+  0x68, 0x72, 0x6f, 0x62, 0x61, 0x74, 0x69, 0x61, 0x6e, 0x73, 0x00, 0x63,
+  0x68, 0x72, 0x6f, 0x62, 0x61, 0x74, 0x69, 0x61, 0x6e, 0x00, 0x2d, 0x00,
+  0x43, 0x68, 0x72, 0x6f, 0x62, 0x61, 0x74, 0x69, 0x61, 0x20, 0x77, 0x61,
+  0x73, 0x20, 0x61, 0x6e, 0x20, 0x45, 0x61, 0x72, 0x6c, 0x79, 0x20, 0x4d,
+  0x65, 0x64, 0x69, 0x65, 0x76, 0x61, 0x6c, 0x2c, 0x20, 0x73, 0x65, 0x6d,
+  0x69, 0x2d, 0x6c, 0x65, 0x67, 0x65, 0x6e, 0x64, 0x61, 0x72, 0x79, 0x20,
+  0x53, 0x6c, 0x61, 0x76, 0x69, 0x63, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65,
+  0x20, 0x6f, 0x72, 0x67, 0x61, 0x6e, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x62,
+  0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x68, 0x69, 0x74, 0x65, 0x20,
+  0x43, 0x72, 0x6f, 0x61, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20,
+  0x70, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x43, 0x65, 0x6e, 0x74,
+  0x72, 0x61, 0x6c, 0x20, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x20, 0x74,
+  0x68, 0x61, 0x74, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x62, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x63, 0x6c, 0x75, 0x73, 0x69, 0x76,
+  0x65, 0x6c, 0x79, 0x20, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69,
+  0x65, 0x64, 0x20, 0x74, 0x6f, 0x64, 0x61, 0x79, 0x2e, 0x20, 0x54, 0x68,
+  0x65, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x69,
+  0x73, 0x74, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20,
+  0x57, 0x68, 0x69, 0x74, 0x65, 0x20, 0x43, 0x72, 0x6f, 0x61, 0x74, 0x69,
+  0x61, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x69, 0x73, 0x20,
+  0x61, 0x20, 0x6d, 0x65, 0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x79,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x42, 0x79, 0x7a, 0x61, 0x6e, 0x74, 0x69,
+  0x6e, 0x65, 0x20, 0x45, 0x6d, 0x70, 0x65, 0x72, 0x6f, 0x72, 0x20, 0x43,
+  0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x69, 0x6e, 0x65, 0x20, 0x56,
+  0x49, 0x49, 0x20, 0x50, 0x6f, 0x72, 0x70, 0x68, 0x79, 0x72, 0x6f, 0x67,
+  0x65, 0x6e, 0x6e, 0x65, 0x74, 0x6f, 0x73, 0x2e, 0x20, 0x57, 0x68, 0x69,
+  0x74, 0x65, 0x20, 0x43, 0x72, 0x6f, 0x61, 0x74, 0x69, 0x61, 0x20, 0x69,
+  0x73, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x20,
+  0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x63, 0x65,
+  0x20, 0x53, 0x6c, 0x61, 0x76, 0x6e, 0x69, 0x6b, 0x2c, 0x20, 0x6c, 0x6f,
+  0x72, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x4c, 0x69, 0x62, 0x69, 0x63, 0x65,
+  0x2c, 0x20, 0x77, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6c,
+  0x75, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64,
+  0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+  0x67, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x53, 0x69, 0x6c, 0x65,
+  0x73, 0x69, 0x61, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6c, 0x61, 0x6e, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x4b, 0x72, 0x61, 0x6b,
+  0x6f, 0x77, 0x2e, 0x00, 0x05, 0x07, 0x4b, 0x72, 0x6f, 0x6b, 0x00, 0x52,
+  0x61, 0x64, 0x73, 0x6c, 0x61, 0x76, 0x00, 0x56, 0x6f, 0x6b, 0x00, 0x53,
+  0x6c, 0x61, 0x76, 0x6e, 0x69, 0x6b, 0x00, 0x53, 0x6f, 0x62, 0xc4, 0x95,
+  0x73, 0x6c, 0x61, 0x76, 0x00, 0x56, 0x6f, 0x6a, 0x74, 0xc4, 0x95, 0x63,
+  0x68, 0x00, 0x52, 0x61, 0x64, 0x69, 0x6d, 0x00, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x07, 0x01, 0x06, 0x02, 0xaa, 0x00,
+  0x94, 0xff, 0xef, 0x03, 0x00, 0x70, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69,
+  0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x43, 0x68,
+  0x75, 0x6d, 0x61, 0x73, 0x68, 0x00, 0x43, 0x68, 0x75, 0x6d, 0x61, 0x73,
+  0x68, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x43, 0x68,
+  0x75, 0x6d, 0x61, 0x73, 0x68, 0x00, 0x63, 0x68, 0x75, 0x6d, 0x61, 0x73,
+  0x68, 0x00, 0x2d, 0x00, 0x49, 0x6e, 0x68, 0x61, 0x62, 0x69, 0x74, 0x69,
+  0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x61, 0x6e, 0x74, 0x61,
+  0x20, 0x42, 0x61, 0x72, 0x62, 0x61, 0x72, 0x61, 0x20, 0x43, 0x68, 0x61,
+  0x6e, 0x6e, 0x65, 0x6c, 0x20, 0x49, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6f, 0x75,
+  0x74, 0x68, 0x65, 0x72, 0x6e, 0x20, 0x43, 0x61, 0x6c, 0x69, 0x66, 0x6f,
+  0x72, 0x6e, 0x69, 0x61, 0x20, 0x63, 0x6f, 0x61, 0x73, 0x74, 0x6c, 0x69,
+  0x6e, 0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x4d,
+  0x61, 0x6c, 0x69, 0x62, 0x75, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x50, 0x61,
+  0x73, 0x6f, 0x20, 0x52, 0x6f, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x69, 0x6e,
+  0x6c, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x77, 0x61, 0x72, 0x64, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x61, 0x6e, 0x20, 0x4a, 0x6f, 0x61,
+  0x71, 0x75, 0x69, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x6c, 0x65, 0x79, 0x2c,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x68, 0x75, 0x6d, 0x61, 0x73, 0x68,
+  0x20, 0x6c, 0x69, 0x76, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x6c, 0x61,
+  0x72, 0x67, 0x65, 0x20, 0x70, 0x65, 0x72, 0x6d, 0x61, 0x6e, 0x65, 0x6e,
+  0x74, 0x20, 0x76, 0x69, 0x6c, 0x6c, 0x61, 0x67, 0x65, 0x73, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65,
+  0x64, 0x20, 0x61, 0x20, 0x73, 0x65, 0x6d, 0x69, 0x2d, 0x6d, 0x6f, 0x6e,
+  0x65, 0x74, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x65, 0x63, 0x6f, 0x6e, 0x6f,
+  0x6d, 0x79, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x73, 0x65, 0x20, 0x76, 0x69,
+  0x6c, 0x6c, 0x61, 0x67, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6d, 0x65, 0x20,
+  0x74, 0x6f, 0x20, 0x62, 0x65, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x64, 0x20,
+  0x62, 0x79, 0x20, 0x68, 0x65, 0x72, 0x65, 0x64, 0x69, 0x74, 0x61, 0x72,
+  0x79, 0x20, 0x63, 0x68, 0x69, 0x65, 0x66, 0x73, 0x2c, 0x20, 0x77, 0x68,
+  0x6f, 0x20, 0x63, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x6d,
+  0x61, 0x6c, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x66, 0x65, 0x6d, 0x61, 0x6c,
+  0x65, 0x2e, 0x20, 0x41, 0x74, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x6f,
+  0x66, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x63, 0x74, 0x2c, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6c, 0x69, 0x6b, 0x65, 0x6c, 0x79,
+  0x20, 0x38, 0x2d, 0x31, 0x38, 0x2c, 0x30, 0x30, 0x30, 0x20, 0x70, 0x65,
+  0x6f, 0x70, 0x6c, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x6f, 0x75, 0x67, 0x68,
+  0x20, 0x70, 0x65, 0x72, 0x68, 0x61, 0x70, 0x73, 0x20, 0x61, 0x73, 0x20,
+  0x68, 0x69, 0x67, 0x68, 0x20, 0x61, 0x73, 0x20, 0x32, 0x32, 0x2c, 0x30,
+  0x30, 0x30, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x53, 0x70, 0x61, 0x6e,
+  0x69, 0x73, 0x68, 0x20, 0x65, 0x73, 0x74, 0x61, 0x62, 0x6c, 0x69, 0x73,
+  0x68, 0x65, 0x64, 0x20, 0x66, 0x69, 0x76, 0x65, 0x20, 0x6d, 0x69, 0x73,
+  0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x43, 0x68, 0x75,
+  0x6d, 0x61, 0x73, 0x68, 0x20, 0x6c, 0x61, 0x6e, 0x64, 0x2e, 0x20, 0x41,
+  0x73, 0x20, 0x61, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x64, 0x69, 0x73, 0x65, 0x61, 0x73, 0x65, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x62, 0x79, 0x70, 0x72,
+  0x6f, 0x64, 0x75, 0x63, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f,
+  0x6c, 0x6f, 0x6e, 0x69, 0x61, 0x6c, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x2c,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x66, 0x65, 0x6c, 0x6c, 0x20, 0x74, 0x6f, 0x20,
+  0x6c, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x33, 0x2c,
+  0x30, 0x30, 0x30, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x38, 0x33, 0x31, 0x2e,
+  0x00, 0x05, 0x02, 0x59, 0x61, 0x6e, 0x6f, 0x6e, 0x61, 0x6c, 0x69, 0x74,
+  0x00, 0x4b, 0x69, 0x74, 0x73, 0x65, 0x70, 0x61, 0x77, 0x69, 0x74, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x06, 0x01, 0xeb, 0x00, 0x94, 0xff,
+  0xef, 0x03, 0x00, 0x71, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d,
+  0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x43, 0x68, 0x75, 0x76,
+  0x61, 0x73, 0x68, 0x00, 0x43, 0x68, 0x75, 0x76, 0x61, 0x73, 0x68, 0x00,
+  0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x43, 0x68, 0x75, 0x76,
+  0x61, 0x73, 0x68, 0x65, 0x73, 0x00, 0x63, 0x68, 0x75, 0x76, 0x61, 0x73,
+  0x68, 0x69, 0x61, 0x00, 0x2d, 0x00, 0x43, 0x68, 0x75, 0x76, 0x61, 0x73,
+  0x68, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x20, 0x54, 0x75,
+  0x72, 0x6b, 0x69, 0x63, 0x20, 0x65, 0x74, 0x68, 0x6e, 0x69, 0x63, 0x20,
+  0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x69, 0x6e, 0x20, 0x45, 0x61, 0x73,
+  0x74, 0x65, 0x72, 0x6e, 0x20, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x61,
+  0x6e, 0x20, 0x52, 0x75, 0x73, 0x73, 0x69, 0x61, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x57, 0x65, 0x73, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x53, 0x69, 0x62,
+  0x65, 0x72, 0x69, 0x61, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 0x6d,
+  0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6e,
+  0x64, 0x61, 0x6e, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x4f, 0x6c, 0x64,
+  0x20, 0x42, 0x75, 0x6c, 0x67, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x20, 0x54,
+  0x75, 0x72, 0x6b, 0x69, 0x63, 0x20, 0x74, 0x72, 0x69, 0x62, 0x65, 0x73,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c,
+  0x79, 0x20, 0x48, 0x75, 0x6e, 0x73, 0x2e, 0x20, 0x54, 0x6f, 0x64, 0x61,
+  0x79, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x61, 0x62, 0x6f, 0x75, 0x74, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x6d, 0x69,
+  0x6c, 0x6c, 0x69, 0x6f, 0x6e, 0x20, 0x43, 0x68, 0x75, 0x76, 0x61, 0x73,
+  0x68, 0x65, 0x73, 0x2c, 0x20, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x20, 0x68,
+  0x61, 0x6c, 0x66, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52, 0x65, 0x70, 0x75, 0x62,
+  0x6c, 0x69, 0x63, 0x20, 0x6f, 0x66, 0x20, 0x43, 0x68, 0x75, 0x76, 0x61,
+  0x73, 0x68, 0x69, 0x61, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20,
+  0x69, 0x73, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x52, 0x75, 0x73, 0x73, 0x69, 0x61, 0x6e, 0x20, 0x46,
+  0x65, 0x64, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x00, 0x05,
+  0xb1, 0x61, 0x72, 0x69, 0x73, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x61,
+  0x20, 0x70, 0x72, 0x65, 0x2d, 0x43, 0x6f, 0x6c, 0x75, 0x6d, 0x62, 0x69,
+  0x61, 0x6e, 0x20, 0x63, 0x69, 0x76, 0x69, 0x6c, 0x69, 0x7a, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x61, 0x74, 0x20,
+  0x69, 0x73, 0x20, 0x6e, 0x6f, 0x77, 0x20, 0x45, 0x63, 0x75, 0x61, 0x64,
+  0x6f, 0x72, 0x2c, 0x20, 0x77, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x65, 0x78,
+  0x69, 0x73, 0x74, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x20,
+  0x62, 0x65, 0x20, 0x74, 0x72, 0x61, 0x63, 0x65, 0x64, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x36, 0x74, 0x68, 0x20, 0x63,
+  0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x20, 0x6f, 0x6e, 0x77, 0x61, 0x72,
+  0x64, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 0x77, 0x65, 0x72,
+  0x65, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x66, 0x65, 0x77, 0x20, 0x41, 0x6e, 0x64, 0x65, 0x61, 0x6e, 0x20,
+  0x63, 0x75, 0x6c, 0x74, 0x75, 0x72, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x74, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x73, 0x68, 0x69, 0x70, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6e, 0x2e, 0x20, 0x54, 0x68, 0x65,
+  0x20, 0x43, 0x61, 0xc3, 0xb1, 0x61, 0x72, 0x69, 0x20, 0x6c, 0x61, 0x6e,
+  0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x70, 0x72,
+  0x6f, 0x62, 0x61, 0x62, 0x6c, 0x79, 0x20, 0x72, 0x65, 0x6c, 0x61, 0x74,
+  0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4d, 0x6f,
+  0x63, 0x68, 0x69, 0x63, 0x61, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61,
+  0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x50, 0x65, 0x72, 0x75, 0x2c, 0x20,
+  0x62, 0x75, 0x74, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
+  0x69, 0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53,
+  0x70, 0x61, 0x6e, 0x69, 0x73, 0x68, 0x20, 0x63, 0x6f, 0x6e, 0x71, 0x75,
+  0x65, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x61, 0xc3, 0xb1,
+  0x61, 0x72, 0x69, 0x73, 0x20, 0x68, 0x61, 0x64, 0x20, 0x6d, 0x6f, 0x73,
+  0x74, 0x6c, 0x79, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x65, 0x64,
+  0x20, 0x74, 0x6f, 0x20, 0x51, 0x75, 0x65, 0x63, 0x68, 0x75, 0x61, 0x2e,
+  0x20, 0x54, 0x68, 0x65, 0x20, 0x43, 0x61, 0xc3, 0xb1, 0x61, 0x72, 0x69,
+  0x73, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 0x20, 0x61, 0x20, 0x6c,
+  0x6f, 0x6f, 0x73, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x65, 0x64, 0x65,
+  0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x20, 0x70,
+  0x6f, 0x6c, 0x69, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x63, 0x65, 0x6e,
+  0x74, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x47, 0x75, 0x61, 0x70, 0x64,
+  0x6f, 0x6e, 0x64, 0x65, 0x6c, 0x69, 0x67, 0x2c, 0x20, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x74, 0x6c, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+  0x69, 0x74, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x43, 0x75, 0x65, 0x6e, 0x63,
+  0x61, 0x2c, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x6e,
+  0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x41, 0x7a, 0x75, 0x61, 0x79, 0x2e,
+  0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x73,
+  0x75, 0x62, 0x6a, 0x75, 0x67, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x49, 0x6e, 0x63, 0x61, 0x73, 0x20, 0x69,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x31,
+  0x35, 0x74, 0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x2c,
+  0x20, 0x74, 0x68, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x74, 0x68, 0x65, 0x79,
+  0x20, 0x70, 0x75, 0x74, 0x20, 0x75, 0x70, 0x20, 0x61, 0x20, 0x66, 0x69,
+  0x65, 0x72, 0x63, 0x65, 0x20, 0x72, 0x65, 0x73, 0x69, 0x73, 0x74, 0x61,
+  0x6e, 0x63, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 0x72, 0x65,
+  0x62, 0x65, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6e,
+  0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x49, 0x6e, 0x63, 0x61, 0x6e, 0x20,
+  0x63, 0x69, 0x76, 0x69, 0x6c, 0x20, 0x77, 0x61, 0x72, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x73, 0x69, 0x64, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x70, 0x61, 0x6e, 0x69, 0x73, 0x68,
+  0x20, 0x64, 0x75, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x69,
+  0x72, 0x20, 0x63, 0x6f, 0x6e, 0x71, 0x75, 0x65, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x49, 0x6e, 0x63, 0x61, 0x20, 0x65,
+  0x6d, 0x70, 0x69, 0x72, 0x65, 0x2e, 0x00, 0x04, 0x03, 0x54, 0x65, 0x6e,
+  0x65, 0x6d, 0x61, 0x7a, 0x61, 0x00, 0x43, 0x61, 0x72, 0x63, 0x68, 0x69,
+  0x70, 0x75, 0x6c, 0x6c, 0x61, 0x00, 0x44, 0x75, 0x6d, 0x61, 0x00, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x05, 0x06, 0x03, 0x1d, 0x00, 0x94,
+  0xff, 0xef, 0x03, 0x00, 0x57, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76,
+  0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x43, 0x61, 0x6e,
+  0x74, 0x6f, 0x6e, 0x65, 0x73, 0x65, 0x00, 0x43, 0x61, 0x6e, 0x74, 0x6f,
+  0x6e, 0x65, 0x73, 0x65, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c,
+  0x3a, 0x43, 0x61, 0x6e, 0x74, 0x6f, 0x6e, 0x65, 0x73, 0x65, 0x00, 0x63,
+  0x61, 0x6e, 0x74, 0x6f, 0x6e, 0x65, 0x73, 0x65, 0x00, 0x2d, 0x00, 0x54,
+  0x68, 0x65, 0x20, 0x43, 0x61, 0x6e, 0x74, 0x6f, 0x6e, 0x65, 0x73, 0x65,
+  0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x20, 0x73, 0x75, 0x62, 0x2d, 0x67,
+  0x72, 0x6f, 0x75, 0x70, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x43, 0x68, 0x69, 0x6e, 0x65, 0x73, 0x65, 0x20, 0x70, 0x65, 0x6f, 0x70,
+  0x6c, 0x65, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x74, 0x69,
+  0x6e, 0x67, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x47, 0x75, 0x61, 0x6e,
+  0x67, 0x64, 0x6f, 0x6e, 0x67, 0x20, 0x50, 0x72, 0x6f, 0x76, 0x69, 0x6e,
+  0x63, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x53, 0x6f, 0x75, 0x74, 0x68, 0x65,
+  0x72, 0x6e, 0x20, 0x43, 0x68, 0x69, 0x6e, 0x61, 0x20, 0x63, 0x6f, 0x6d,
+  0x70, 0x72, 0x69, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x62, 0x6f, 0x75,
+  0x74, 0x20, 0x37, 0x30, 0x20, 0x6d, 0x69, 0x6c, 0x6c, 0x69, 0x6f, 0x6e,
+  0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x65,
+  0x20, 0x43, 0x61, 0x6e, 0x74, 0x6f, 0x6e, 0x65, 0x73, 0x65, 0x20, 0x61,
+  0x72, 0x65, 0x20, 0x72, 0x65, 0x6e, 0x6f, 0x77, 0x6e, 0x65, 0x64, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x6d, 0x75,
+  0x73, 0x69, 0x63, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x66, 0x6f, 0x6f, 0x64,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x69, 0x74,
+  0x75, 0x74, 0x65, 0x20, 0x61, 0x6e, 0x20, 0x69, 0x6d, 0x70, 0x6f, 0x72,
+  0x74, 0x61, 0x6e, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x69, 0x6e, 0x20, 0x4f, 0x76, 0x65, 0x72, 0x73, 0x65, 0x61, 0x73,
+  0x20, 0x43, 0x68, 0x69, 0x6e, 0x65, 0x73, 0x65, 0x20, 0x63, 0x6f, 0x6d,
+  0x6d, 0x75, 0x6e, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x77, 0x6f, 0x72,
+  0x6c, 0x64, 0x77, 0x69, 0x64, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x79,
+  0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x61,
+  0x20, 0x6d, 0x61, 0x6a, 0x6f, 0x72, 0x69, 0x74, 0x79, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53,
+  0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x41, 0x75, 0x74, 0x6f, 0x6e,
+  0x6f, 0x6d, 0x6f, 0x75, 0x73, 0x20, 0x52, 0x65, 0x67, 0x69, 0x6f, 0x6e,
+  0x73, 0x20, 0x6f, 0x66, 0x20, 0x48, 0x6f, 0x6e, 0x67, 0x20, 0x4b, 0x6f,
+  0x6e, 0x67, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x4d, 0x61, 0x63, 0x61, 0x6f,
+  0x2e, 0x20, 0x49, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63,
+  0x6f, 0x6e, 0x64, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x20,
+  0x42, 0x43, 0x45, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x61, 0x6e,
+  0x74, 0x6f, 0x6e, 0x65, 0x73, 0x65, 0x2d, 0x64, 0x6f, 0x6d, 0x69, 0x6e,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x64, 0x6f, 0x6d,
+  0x20, 0x6f, 0x66, 0x20, 0x4e, 0x61, 0x6e, 0x79, 0x75, 0x65, 0x20, 0x72,
+  0x75, 0x6c, 0x65, 0x64, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x6d, 0x75,
+  0x63, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x53, 0x6f, 0x75, 0x74, 0x68, 0x65,
+  0x72, 0x6e, 0x20, 0x43, 0x68, 0x69, 0x6e, 0x61, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x64, 0x6f, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x64, 0x20, 0x56,
+  0x69, 0x65, 0x74, 0x6e, 0x61, 0x6d, 0x2e, 0x20, 0x49, 0x6e, 0x20, 0x31,
+  0x31, 0x31, 0x20, 0x42, 0x43, 0x45, 0x20, 0x4e, 0x61, 0x6e, 0x79, 0x75,
+  0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x69, 0x6e, 0x63, 0x6f, 0x72, 0x70,
+  0x6f, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20,
+  0x48, 0x61, 0x6e, 0x20, 0x44, 0x79, 0x6e, 0x61, 0x73, 0x74, 0x79, 0x20,
+  0x43, 0x68, 0x69, 0x6e, 0x61, 0x2e, 0x20, 0x43, 0x61, 0x6e, 0x74, 0x6f,
+  0x6e, 0x65, 0x73, 0x65, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x20, 0x6d, 0x6f, 0x73, 0x74, 0x20,
+  0x73, 0x70, 0x6f, 0x6b, 0x65, 0x6e, 0x20, 0x43, 0x68, 0x69, 0x6e, 0x65,
+  0x73, 0x65, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20,
+  0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x4d, 0x61, 0x6e, 0x64, 0x61, 0x72,
+  0x69, 0x6e, 0x2e, 0x00, 0x03, 0x07, 0x4a, 0x69, 0x75, 0x20, 0x54, 0x6f,
+  0x00, 0x4a, 0x69, 0x75, 0x20, 0x47, 0x69, 0x6e, 0x64, 0x65, 0x67, 0x00,
+  0x59, 0x75, 0x6e, 0x20, 0x53, 0x75, 0x6e, 0x67, 0x20, 0x57, 0x75, 0x6e,
+  0x00, 0x4a, 0x69, 0x68, 0x6e, 0x67, 0x20, 0x53, 0x69, 0x68, 0x00, 0x4c,
+  0x65, 0x75, 0x6e, 0x67, 0x20, 0x4b, 0x61, 0x69, 0x20, 0x43, 0x68, 0x69,
+  0x75, 0x00, 0x43, 0x61, 0x6e, 0x20, 0x47, 0x77, 0x69, 0x6e, 0x67, 0x6d,
+  0x69, 0x6e, 0x67, 0x00, 0x53, 0x79, 0x75, 0x6e, 0x20, 0x46, 0x6f, 0x00,
+  0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x06, 0x00,
+  0x06, 0x02, 0x22, 0x00, 0x94, 0xff, 0xef, 0x03, 0x00, 0x58, 0x66, 0x72,
+  0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x00, 0x43, 0x61, 0x70, 0x65, 0x20, 0x56, 0x65, 0x72, 0x64, 0x65,
+  0x61, 0x6e, 0x00, 0x43, 0x61, 0x70, 0x65, 0x20, 0x56, 0x65, 0x72, 0x64,
+  0x65, 0x61, 0x6e, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a,
+  0x43, 0x61, 0x70, 0x65, 0x20, 0x56, 0x65, 0x72, 0x64, 0x65, 0x61, 0x6e,
+  0x00, 0x63, 0x61, 0x70, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x64, 0x65, 0x00,
+  0x2d, 0x00, 0x43, 0x61, 0x70, 0x65, 0x20, 0x56, 0x65, 0x72, 0x64, 0x65,
+  0x20, 0x69, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69,
+  0x70, 0x65, 0x6c, 0x61, 0x67, 0x6f, 0x20, 0x6f, 0x66, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x63, 0x6f, 0x61, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x57, 0x65, 0x73, 0x74, 0x20, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2e,
+  0x20, 0x42, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x69, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x20, 0x77, 0x65, 0x72, 0x65,
+  0x20, 0x73, 0x65, 0x74, 0x74, 0x6c, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x67, 0x75, 0x65,
+  0x73, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x35,
+  0x74, 0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x20, 0x74,
+  0x68, 0x65, 0x79, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x70, 0x72, 0x6f,
+  0x62, 0x61, 0x62, 0x6c, 0x79, 0x20, 0x75, 0x6e, 0x69, 0x6e, 0x68, 0x61,
+  0x62, 0x69, 0x74, 0x65, 0x64, 0x2e, 0x20, 0x43, 0x61, 0x70, 0x65, 0x20,
+  0x56, 0x65, 0x72, 0x64, 0x65, 0x20, 0x73, 0x75, 0x62, 0x73, 0x65, 0x71,
+  0x75, 0x65, 0x6e, 0x74, 0x6c, 0x79, 0x20, 0x62, 0x65, 0x63, 0x61, 0x6d,
+  0x65, 0x20, 0x61, 0x20, 0x6d, 0x61, 0x6a, 0x6f, 0x72, 0x20, 0x63, 0x65,
+  0x6e, 0x74, 0x65, 0x72, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x41, 0x74, 0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x20, 0x73, 0x6c,
+  0x61, 0x76, 0x65, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x2e, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x69, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x20, 0x64,
+  0x65, 0x63, 0x6c, 0x61, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x64, 0x65,
+  0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x20, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x67, 0x61, 0x6c, 0x20, 0x69,
+  0x6e, 0x20, 0x31, 0x39, 0x37, 0x35, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20,
+  0x43, 0x61, 0x70, 0x65, 0x20, 0x56, 0x65, 0x72, 0x64, 0x65, 0x61, 0x6e,
+  0x20, 0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x69, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x69, 0x78, 0x65, 0x64, 0x20,
+  0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x61, 0x6e, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x6e, 0x20, 0x64, 0x65, 0x73,
+  0x63, 0x65, 0x6e, 0x74, 0x2e, 0x00, 0x67, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x69, 0x6c, 0x6c, 0x20, 0x69, 0x6e,
+  0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73,
+  0x73, 0x6f, 0x72, 0x73, 0x20, 0x2d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x62, 0x69, 0x73, 0x68, 0x6f,
+  0x70, 0x20, 0x6f, 0x66, 0x20, 0x55, 0x72, 0x67, 0x65, 0x6c, 0x6c, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x72, 0x65, 0x73,
+  0x69, 0x64, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x46, 0x72, 0x65, 0x6e, 0x63, 0x68, 0x20, 0x52, 0x65, 0x70, 0x75,
+  0x62, 0x6c, 0x69, 0x63, 0x20, 0x2d, 0x20, 0x62, 0x65, 0x61, 0x72, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x28, 0x6d, 0x6f, 0x73, 0x74, 0x6c, 0x79, 0x20,
+  0x68, 0x6f, 0x6e, 0x6f, 0x72, 0x69, 0x66, 0x69, 0x63, 0x29, 0x20, 0x74,
+  0x69, 0x74, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x2d, 0x70,
+  0x72, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x41, 0x6e, 0x64,
+  0x6f, 0x72, 0x72, 0x61, 0x2e, 0x00, 0x04, 0x42, 0x6f, 0x72, 0xc3, 0xad,
+  0x73, 0x20, 0x49, 0x00, 0x50, 0x65, 0x72, 0x65, 0x20, 0x64, 0x27, 0x55,
+  0x72, 0x74, 0x78, 0x00, 0x52, 0x6f, 0x67, 0x65, 0x72, 0x20, 0x42, 0x65,
+  0x72, 0x6e, 0x61, 0x74, 0x20, 0x49, 0x49, 0x49, 0x00, 0x43, 0x61, 0x72,
+  0x6c, 0x65, 0x6d, 0x61, 0x6e, 0x79, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x04, 0x03, 0x02, 0x01, 0x07, 0x06, 0x02, 0x5e, 0x00, 0x94, 0xff,
+  0xef, 0x03, 0x00, 0x14, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d,
+  0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x41, 0x6e, 0x67, 0x6f,
+  0x6c, 0x61, 0x6e, 0x00, 0x41, 0x6e, 0x67, 0x6f, 0x6c, 0x61, 0x6e, 0x00,
+  0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x41, 0x6e, 0x67, 0x6f,
+  0x6c, 0x61, 0x6e, 0x73, 0x00, 0x61, 0x6e, 0x67, 0x6f, 0x6c, 0x61, 0x00,
+  0x2d, 0x00, 0x57, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50,
+  0x6f, 0x72, 0x74, 0x75, 0x67, 0x75, 0x65, 0x73, 0x65, 0x20, 0x61, 0x72,
+  0x72, 0x69, 0x76, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x41, 0x6e, 0x67,
+  0x6f, 0x6c, 0x61, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31,
+  0x35, 0x74, 0x68, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e, 0x20, 0x77,
+  0x61, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65,
+  0x64, 0x20, 0x62, 0x79, 0x20, 0x73, 0x65, 0x76, 0x65, 0x72, 0x61, 0x6c,
+  0x20, 0x42, 0x61, 0x6e, 0x74, 0x75, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x64,
+  0x6f, 0x6d, 0x73, 0x2e, 0x20, 0x41, 0x6e, 0x67, 0x6f, 0x6c, 0x61, 0x20,
+  0x62, 0x65, 0x63, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x6e, 0x20, 0x69, 0x6d,
+  0x70, 0x6f, 0x72, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x73, 0x6f, 0x75, 0x72,
+  0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x6c, 0x61, 0x76, 0x65, 0x20,
+  0x74, 0x72, 0x61, 0x64, 0x65, 0x72, 0x73, 0x20, 0x75, 0x6e, 0x74, 0x69,
+  0x6c, 0x20, 0x77, 0x65, 0x6c, 0x6c, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x31, 0x39, 0x74, 0x68, 0x20, 0x63, 0x65, 0x6e,
+  0x74, 0x75, 0x72, 0x79, 0x2e, 0x20, 0x41, 0x66, 0x74, 0x65, 0x72, 0x20,
+  0x74, 0x77, 0x6f, 0x20, 0x64, 0x65, 0x63, 0x61, 0x64, 0x65, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x67, 0x75, 0x65, 0x72, 0x72, 0x69, 0x6c, 0x6c, 0x61,
+  0x20, 0x77, 0x61, 0x72, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x74,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x67, 0x75,
+  0x65, 0x73, 0x65, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x6e, 0x69, 0x61, 0x6c,
+  0x20, 0x61, 0x75, 0x74, 0x68, 0x6f, 0x72, 0x69, 0x74, 0x69, 0x65, 0x73,
+  0x20, 0x41, 0x6e, 0x67, 0x6f, 0x6c, 0x61, 0x20, 0x66, 0x69, 0x6e, 0x61,
+  0x6c, 0x6c, 0x79, 0x20, 0x61, 0x63, 0x68, 0x69, 0x65, 0x76, 0x65, 0x64,
+  0x20, 0x69, 0x6e, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63,
+  0x65, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x39, 0x37, 0x35, 0x2e, 0x20, 0x53,
+  0x6f, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x72, 0x69,
+  0x6f, 0x75, 0x73, 0x20, 0x67, 0x75, 0x65, 0x72, 0x69, 0x6c, 0x6c, 0x61,
+  0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x20, 0x73, 0x74, 0x61, 0x72,
+  0x74, 0x65, 0x64, 0x20, 0x66, 0x69, 0x67, 0x68, 0x74, 0x69, 0x6e, 0x67,
+  0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x2e,
+  0x20, 0x41, 0x66, 0x74, 0x65, 0x72, 0x20, 0x68, 0x61, 0x6c, 0x66, 0x20,
+  0x61, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x79, 0x20, 0x6f, 0x66,
+  0x20, 0x77, 0x61, 0x72, 0x20, 0x61, 0x20, 0x70, 0x65, 0x61, 0x63, 0x65,
+  0x20, 0x61, 0x67, 0x72, 0x65, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x77,
+  0x61, 0x73, 0x20, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x72,
+  0x65, 0x61, 0x63, 0x68, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x32, 0x30,
+  0x30, 0x32, 0x2e, 0x00, 0x02, 0x04, 0x48, 0x6f, 0x6c, 0x64, 0x65, 0x6e,
+  0x20, 0x52, 0x6f, 0x62, 0x65, 0x72, 0x74, 0x6f, 0x00, 0x41, 0x67, 0x6f,
+  0x73, 0x74, 0x69, 0x6e, 0x68, 0x6f, 0x20, 0x4e, 0x65, 0x74, 0x6f, 0x00,
+  0x4a, 0x6f, 0x6e, 0x61, 0x73, 0x20, 0x53, 0x61, 0x76, 0x69, 0x6d, 0x62,
+  0x69, 0x00, 0x4a, 0x6f, 0x73, 0xc3, 0xa9, 0x20, 0x45, 0x64, 0x75, 0x61,
+  0x72, 0x64, 0x6f, 0x20, 0x64, 0x6f, 0x73, 0x20, 0x53, 0x61, 0x6e, 0x74,
+  0x6f, 0x73, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04,
+  0x06, 0x03, 0x1c, 0x00, 0x94, 0x7f, 0xef, 0x03, 0x00, 0x15, 0x66, 0x72,
+  0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x00, 0x41, 0x6e, 0x68, 0x61, 0x6c, 0x74, 0x69, 0x61, 0x6e, 0x00,
+  0x41, 0x6e, 0x68, 0x61, 0x6c, 0x74, 0x69, 0x61, 0x6e, 0x00, 0x3f, 0x70,
+  0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x41, 0x6e, 0x68, 0x61, 0x6c, 0x74,
+  0x69, 0x61, 0x6e, 0x73, 0x00, 0x61, 0x6e, 0x68, 0x61, 0x6c, 0x74, 0x00,
+  0x2d, 0x00, 0x41, 0x6e, 0x68, 0x61, 0x6c, 0x74, 0x20, 0x77, 0x61, 0x73,
+  0x20, 0x61, 0x20, 0x47, 0x65, 0x72, 0x6d, 0x61, 0x6e, 0x20, 0x73, 0x74,
+  0x61, 0x74, 0x65, 0x2e, 0x20, 0x49, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c,
+  0x6c, 0x79, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x79, 0x2c,
+  0x20, 0x69, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x73, 0x70, 0x6c, 0x69,
+  0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x53, 0x61, 0x78, 0x6f, 0x6e,
+  0x79, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x32, 0x31, 0x32, 0x2e, 0x20, 0x46,
+  0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x69,
+  0x74, 0x73, 0x20, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x2c, 0x20,
+  0x69, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20,
+  0x73, 0x65, 0x76, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x74, 0x65, 0x72, 0x72,
+  0x69, 0x74, 0x6f, 0x72, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74,
+  0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x64, 0x20,
+  0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20,
+  0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x41, 0x6e,
+  0x68, 0x61, 0x6c, 0x74, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x72, 0x61,
+  0x69, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x75, 0x6b, 0x65,
+  0x73, 0x20, 0x75, 0x70, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64,
+  0x69, 0x73, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x48, 0x6f, 0x6c, 0x79, 0x20, 0x52,
+  0x6f, 0x6d, 0x61, 0x6e, 0x20, 0x45, 0x6d, 0x70, 0x69, 0x72, 0x65, 0x20,
+  0x62, 0x79, 0x20, 0x4e, 0x61, 0x70, 0x6f, 0x6c, 0x65, 0x6f, 0x6e, 0x20,
+  0x69, 0x6e, 0x20, 0x31, 0x38, 0x30, 0x36, 0x2e, 0x20, 0x41, 0x6e, 0x68,
+  0x61, 0x6c, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x72, 0x65, 0x75, 0x6e,
+  0x69, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x61, 0x20,
+  0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x64, 0x75, 0x63, 0x68, 0x79,
+  0x20, 0x69, 0x6e, 0x20, 0x31, 0x38, 0x36, 0x33, 0x2e, 0x20, 0x55, 0x70,
+  0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x66,
+  0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47,
+  0x65, 0x72, 0x6d, 0x61, 0x6e, 0x20, 0x6d, 0x6f, 0x6e, 0x61, 0x72, 0x63,
+  0x68, 0x69, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x39, 0x31, 0x38,
+  0x2c, 0x20, 0x69, 0x74, 0x20, 0x62, 0x65, 0x63, 0x61, 0x6d, 0x65, 0x20,
+  0x61, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65,
+  0x2e, 0x20, 0x41, 0x66, 0x74, 0x65, 0x72, 0x20, 0x57, 0x6f, 0x72, 0x6c,
+  0x64, 0x20, 0x57, 0x61, 0x72, 0x20, 0x49, 0x49, 0x2c, 0x20, 0x41, 0x6e,
+  0x68, 0x61, 0x6c, 0x74, 0x20, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x6c, 0x79,
+  0x20, 0x63, 0x65, 0x61, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x65,
+  0x78, 0x69, 0x73, 0x74, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x61, 0x6c, 0x6c, 0x69, 0x65, 0x73, 0x20, 0x64, 0x65, 0x63,
+  0x69, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x65, 0x72, 0x67,
+  0x65, 0x20, 0x69, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x72, 0x20, 0x50, 0x72, 0x75,
+  0x73, 0x73, 0x69, 0x61, 0x6e, 0x20, 0x50, 0x72, 0x6f, 0x76, 0x69, 0x6e,
+  0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x53, 0x61, 0x78, 0x6f, 0x6e, 0x79,
+  0x20, 0x74, 0x6f, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x53, 0x61,
+  0x78, 0x6f, 0x6e, 0x79, 0x2d, 0x41, 0x6e, 0x68, 0x61, 0x6c, 0x74, 0x2e,
+  0x00, 0x08, 0x48, 0x65, 0x69, 0x6e, 0x72, 0x69, 0x63, 0x68, 0x20, 0x49,
+  0x00, 0x47, 0x65, 0x6f, 0x72, 0x67, 0x20, 0x49, 0x00, 0x57, 0x6f, 0x6c,
+  0x66, 0x67, 0x61, 0x6e, 0x67, 0x20, 0x64, 0x65, 0x72, 0x20, 0x42, 0x65,
+  0x6b, 0x65, 0x6e, 0x6e, 0x65, 0x72, 0x00, 0x4a, 0x6f, 0x68, 0x61, 0x6e,
+  0x6e, 0x20, 0x49, 0x56, 0x00, 0x43, 0x68, 0x72, 0x69, 0x73, 0x74, 0x69,
+  0x61, 0x6e, 0x20, 0x49, 0x00, 0x53, 0x6f, 0x70, 0x68, 0x69, 0x65, 0x20,
+  0x41, 0x75, 0x67, 0x75, 0x73, 0x74, 0x61, 0x20, 0x46, 0x72, 0x65, 0x64,
+  0x65, 0x72, 0x69, 0x6b, 0x61, 0x00, 0x46, 0x72, 0x69, 0x65, 0x64, 0x72,
+  0x69, 0x63, 0x68, 0x20, 0x41, 0x75, 0x67, 0x75, 0x73, 0x74, 0x00, 0x48,
+  0x65, 0x69, 0x6e, 0x72, 0x69, 0x63, 0x68, 0x20, 0x44, 0x65, 0x69, 0x73,
+  0x74, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01,
+  0x03, 0x01, 0x02, 0x07, 0x06, 0x02, 0x03, 0x00, 0x94, 0xff, 0xef, 0x03,
+  0x00, 0x16, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x41, 0x6e, 0x69, 0x73, 0x68, 0x69,
+  0x6e, 0x61, 0x61, 0x62, 0x65, 0x00, 0x41, 0x6e, 0x69, 0x73, 0x68, 0x69,
+  0x6e, 0x61, 0x61, 0x62, 0x65, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61,
+  0x6c, 0x3a, 0x41, 0x6e, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x61, 0x61, 0x62,
+  0x65, 0x67, 0x00, 0x61, 0x6e, 0x69, 0x73, 0x68, 0x69, 0x6e, 0x61, 0x61,
+  0x62, 0x65, 0x00, 0x2d, 0x00, 0x54, 0x68, 0x65, 0x20, 0x41, 0x6e, 0x69,
+  0x73, 0x68, 0x69, 0x6e, 0x61, 0x61, 0x62, 0x65, 0x67, 0x20, 0x61, 0x72,
+  0x65, 0x20, 0x61, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x6f, 0x66,
+  0x20, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x6c, 0x79, 0x20, 0x72, 0x65, 0x6c,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x4e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6e, 0x20, 0x74, 0x72, 0x69,
+  0x62, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4e,
+  0x6f, 0x72, 0x74, 0x68, 0x20, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x6e, 0x20, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20, 0x4c, 0x61, 0x6b, 0x65,
+  0x73, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x69, 0x6e,
+  0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x4f, 0x74, 0x74, 0x61, 0x77, 0x61, 0x2c, 0x20, 0x4f, 0x6a, 0x69, 0x62,
+  0x77, 0x65, 0x2c, 0x20, 0x41, 0x6c, 0x67, 0x6f, 0x6e, 0x6b, 0x69, 0x6e,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x50, 0x6f, 0x74, 0x61, 0x77, 0x61, 0x74,
+  0x6f, 0x6d, 0x69, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x79, 0x20, 0x73, 0x70,
+  0x65, 0x61, 0x6b, 0x20, 0x41, 0x6c, 0x67, 0x6f, 0x6e, 0x71, 0x75, 0x69,
+  0x61, 0x6e, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x73,
+  0x2e, 0x20, 0x54, 0x6f, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74,
+  0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6f, 0x6e, 0x65, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x73, 0x74, 0x20,
+  0x6e, 0x75, 0x6d, 0x65, 0x72, 0x6f, 0x75, 0x73, 0x20, 0x69, 0x6e, 0x64,
+  0x69, 0x67, 0x65, 0x6e, 0x6f, 0x75, 0x73, 0x20, 0x70, 0x65, 0x6f, 0x70,
+  0x6c, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x4e, 0x6f, 0x72, 0x74, 0x68,
+  0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e,
+  0x20, 0x61, 0x20, 0x66, 0x6f, 0x72, 0x65, 0x69, 0x67, 0x6e, 0x20, 0x63,
+  0x69, 0x74, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x62, 0x65, 0x63, 0x6f,
+  0x6d, 0x65, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x65, 0x78, 0x70, 0x65,
+  0x72, 0x69, 0x65, 0x6e, 0x63, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61,
+  0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x2e, 0x20, 0x53, 0x70, 0x69,
+  0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20,
+  0x6d, 0x6f, 0x72, 0x65, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x69,
+  0x76, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x44, 0x69, 0x70, 0x6c,
+  0x6f, 0x6d, 0x61, 0x74, 0x73, 0x20, 0x61, 0x74, 0x20, 0x64, 0x65, 0x66,
+  0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65,
+  0x73, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x74, 0x20, 0x66, 0x6f,
+  0x72, 0x65, 0x69, 0x67, 0x6e, 0x20, 0x44, 0x69, 0x70, 0x6c, 0x6f, 0x6d,
+  0x61, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x53, 0x70, 0x69, 0x65,
+  0x73, 0x2e, 0x03, 0x41, 0x20, 0x53, 0x70, 0x79, 0x20, 0x63, 0x61, 0x6e,
+  0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65,
+  0x64, 0x20, 0x74, 0x6f, 0x3a, 0x0a, 0x20, 0x2d, 0x20, 0x73, 0x61, 0x62,
+  0x6f, 0x74, 0x61, 0x67, 0x65, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x6e, 0x65,
+  0x6d, 0x79, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x20, 0x28, 0x72, 0x65, 0x64,
+  0x75, 0x63, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x74, 0x73, 0x20, 0x68, 0x69,
+  0x74, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20,
+  0x68, 0x61, 0x6c, 0x66, 0x29, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x69, 0x74,
+  0x20, 0x69, 0x73, 0x20, 0x61, 0x6c, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x6e,
+  0x20, 0x61, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x70, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x20,
+  0x61, 0x72, 0x65, 0x20, 0x61, 0x74, 0x20, 0x77, 0x61, 0x72, 0x3b, 0x0a,
+  0x20, 0x2d, 0x20, 0x70, 0x6f, 0x69, 0x73, 0x6f, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x77, 0x61, 0x74, 0x65, 0x72, 0x20, 0x73, 0x75, 0x70, 0x70,
+  0x6c, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x6e, 0x65,
+  0x6d, 0x79, 0x20, 0x63, 0x69, 0x74, 0x79, 0x20, 0x28, 0x72, 0x65, 0x64,
+  0x75, 0x63, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6f,
+  0x70, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x79, 0x20,
+  0x6f, 0x6e, 0x65, 0x29, 0x3b, 0x0a, 0x20, 0x2d, 0x20, 0x73, 0x74, 0x65,
+  0x61, 0x6c, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20,
+  0x74, 0x65, 0x63, 0x68, 0x6e, 0x6f, 0x6c, 0x6f, 0x67, 0x79, 0x20, 0x28,
+  0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63,
+  0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x29, 0x3b, 0x0a, 0x20,
+  0x2d, 0x20, 0x73, 0x74, 0x65, 0x61, 0x6c, 0x20, 0x66, 0x75, 0x72, 0x74,
+  0x68, 0x65, 0x72, 0x20, 0x74, 0x65, 0x63, 0x68, 0x6e, 0x6f, 0x6c, 0x6f,
+  0x67, 0x69, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x61, 0x20,
+  0x63, 0x69, 0x74, 0x79, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x68,
+  0x61, 0x73, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x62,
+  0x65, 0x65, 0x6e, 0x20, 0x73, 0x74, 0x6f, 0x6c, 0x65, 0x6e, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x20, 0x28, 0x61, 0x6c, 0x74, 0x68, 0x6f, 0x75, 0x67,
+  0x68, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x62, 0x65, 0x63,
+  0x6f, 0x6d, 0x65, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x72, 0x65, 0x73,
+  0x69, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+  0x74, 0x69, 0x6d, 0x65, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72,
+  0x65, 0x20, 0x73, 0x74, 0x6f, 0x6c, 0x65, 0x6e, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x29, 0x3b, 0x0a, 0x20, 0x2d, 0x20, 0x73, 0x61, 0x62, 0x6f, 0x74,
+  0x61, 0x67, 0x65, 0x20, 0x70, 0x72, 0x65, 0x64, 0x65, 0x74, 0x65, 0x72,
+  0x6d, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x69, 0x74, 0x79, 0x20, 0x74,
+  0x61, 0x72, 0x67, 0x65, 0x74, 0x73, 0x20, 0x28, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x61, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x64, 0x20, 0x63,
+  0x68, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x75, 0x63,
+  0x63, 0x65, 0x73, 0x73, 0x29, 0x2e, 0x03, 0x41, 0x20, 0x53, 0x70, 0x79,
+  0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x75, 0x72, 0x76, 0x69, 0x76,
+  0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20,
+  0x61, 0x67, 0x67, 0x72, 0x65, 0x73, 0x73, 0x69, 0x76, 0x65, 0x20, 0x61,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x28, 0x73, 0x61, 0x62, 0x6f,
+  0x74, 0x61, 0x67, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x66, 0x74, 0x2c,
+  0x20, 0x69, 0x6e, 0x63, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x72, 0x65,
+  0x62, 0x65, 0x6c, 0x6c, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x70, 0x6f, 0x69, 0x73, 0x6f, 0x6e, 0x69, 0x6e, 0x67, 0x29, 0x20,
+  0x65, 0x73, 0x63, 0x61, 0x70, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x73, 0x61, 0x66, 0x65, 0x74, 0x79, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74,
+  0x20, 0x66, 0x72, 0x69, 0x65, 0x6e, 0x64, 0x6c, 0x79, 0x20, 0x63, 0x69,
+  0x74, 0x79, 0x2e, 0x03, 0x53, 0x70, 0x69, 0x65, 0x73, 0x20, 0x62, 0x75,
+  0x69, 0x6c, 0x74, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x61, 0x20,
+  0x43, 0x6f, 0x6d, 0x6d, 0x75, 0x6e, 0x69, 0x73, 0x74, 0x20, 0x67, 0x6f,
+  0x76, 0x65, 0x72, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x77, 0x69, 0x6c,
+  0x6c, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x61, 0x74, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x76, 0x65, 0x74,
+  0x65, 0x72, 0x61, 0x6e, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x20, 0x28,
+  0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x29, 0x2e, 0x03, 0x00, 0x27,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe5, 0x00,
+  0x8c, 0xaf, 0x64, 0x23, 0xf0, 0x03, 0x38, 0x2e, 0x43, 0x61, 0x72, 0x61,
+  0x76, 0x61, 0x6e, 0x00, 0x43, 0x61, 0x72, 0x61, 0x76, 0x61, 0x6e, 0x00,
+  0x75, 0x2e, 0x63, 0x61, 0x72, 0x61, 0x76, 0x61, 0x6e, 0x00, 0x6d, 0x5f,
+  0x63, 0x61, 0x72, 0x61, 0x76, 0x61, 0x6e, 0x00, 0x66, 0x5f, 0x63, 0x61,
+  0x72, 0x61, 0x76, 0x61, 0x6e, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x01, 0x00, 0x00, 0x00, 0x54, 0x07, 0x00, 0x01, 0x00, 0x00, 0x02,
+  0x2f, 0x00, 0x41, 0x20, 0x43, 0x61, 0x72, 0x61, 0x76, 0x61, 0x6e, 0x20,
+  0x63, 0x61, 0x72, 0x72, 0x69, 0x65, 0x73, 0x20, 0x67, 0x6f, 0x6f, 0x64,
+  0x73, 0x20, 0x6f, 0x72, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61,
+  0x6c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x72, 0x61, 0x64, 0x69, 0x6e,
+  0x67, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61,
+  0x6e, 0x74, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x66, 0x6f, 0x72, 0x65, 0x69, 0x67, 0x6e, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x2c, 0x20, 0x6f, 0x72, 0x20,
+  0x74, 0x6f, 0x20, 0x68, 0x65, 0x6c, 0x70, 0x20, 0x62, 0x75, 0x69, 0x6c,
+  0x64, 0x20, 0x77, 0x6f, 0x6e, 0x64, 0x65, 0x72, 0x73, 0x20, 0x69, 0x6e,
+  0x20, 0x79, 0x6f, 0x75, 0x72, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73,
+  0x2e, 0x03, 0x43, 0x61, 0x72, 0x61, 0x76, 0x61, 0x6e, 0x73, 0x20, 0x63,
+  0x61, 0x6e, 0x20, 0x65, 0x73, 0x74, 0x61, 0x62, 0x6c, 0x69, 0x73, 0x68,
+  0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x72, 0x6f, 0x75, 0x74, 0x65,
+  0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x79, 0x6f, 0x75, 0x72, 0x20,
+  0x6f, 0x77, 0x6e, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x6f,
+  0x72, 0x20, 0x74, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6f,
+  0x74, 0x68, 0x65, 0x72, 0x20, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+  0x20, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x20, 0x65, 0x6e, 0x65, 0x6d, 0x69,
+  0x65, 0x73, 0x29, 0x20, 0x62, 0x79, 0x20, 0x74, 0x72, 0x61, 0x76, 0x65,
+  0x6c, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x6d,
+  0x2e, 0x20, 0x41, 0x20, 0x72, 0x6f, 0x75, 0x74, 0x65, 0x27, 0x73, 0x20,
+  0x6f, 0x6e, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x20, 0x72, 0x65, 0x76, 0x65,
+  0x6e, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c,
+  0x65, 0x64, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x77,
+  0x6f, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x76,
+  0x6f, 0x6c, 0x76, 0x65, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6f, 0x6e,
+  0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x63,
+  0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x65, 0x6e, 0x74, 0x73, 0x2c, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x61,
+  0x67, 0x61, 0x69, 0x6e, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e,
+  0x74, 0x20, 0x63, 0x69, 0x76, 0x69, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x61,
+  0x73, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x6d, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e,
+  0x65, 0x74, 0x20, 0x62, 0x65, 0x6e, 0x65, 0x66, 0x69, 0x74, 0x20, 0x74,
+  0x6f, 0x20, 0x79, 0x6f, 0x75, 0x72, 0x20, 0x63, 0x69, 0x76, 0x69, 0x6c,
+  0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x61,
+  0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x72, 0x6f, 0x75, 0x74, 0x65,
+  0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65,
+  0x20, 0x72, 0x65, 0x67, 0x61, 0x72, 0x64, 0x6c, 0x65, 0x73, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x79,
+  0x6f, 0x75, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20,
+  0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x6f, 0x6e,
+  0x6c, 0x79, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x6d, 0x3b, 0x20, 0x69, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x6f,
+  0x6e, 0x6c, 0x79, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x6f, 0x6e, 0x65, 0x20,
+  0x63, 0x69, 0x74, 0x79, 0x2c, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20,
+  0x69, 0x6e, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x69, 0x74, 0x79,
+  0x20, 0x69, 0x73, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x64, 0x2c,
+  0x20, 0x62, 0x75, 0x74, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x6f, 0x6e, 0x6c,
+  0x79, 0x20, 0x67, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x65,
+  0x6e, 0x65, 0x66, 0x69, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x6f,
+  0x6e, 0x65, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x72, 0x6f, 0x75, 0x74, 0x65, 0x2e, 0x03, 0x49, 0x6e, 0x69,
+  0x74, 0x69, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65,
+  0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72,
+  0x74, 0x20, 0x61, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65,
+  0x20, 0x72, 0x6f, 0x75, 0x74, 0x65, 0x73, 0x2e, 0x20, 0x4b, 0x6e, 0x6f,
+  0x77, 0x6c, 0x65, 0x64, 0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x74, 0x65, 0x63, 0x68, 0x6e, 0x6f, 0x6c, 0x6f, 0x67, 0x69,
+  0x65, 0x73, 0x20, 0x4d, 0x61, 0x67, 0x6e, 0x65, 0x74, 0x69, 0x73, 0x6d,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x54, 0x68, 0x65, 0x20, 0x43, 0x6f, 0x72,
+  0x70, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x65, 0x61, 0x63,
+  0x68, 0x20, 0x69, 0x6e, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x20, 0x74,
+  0x68, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x20, 0x62, 0x79,
+  0x20, 0x6f, 0x6e, 0x65, 0x3b, 0x20, 0x6b, 0x6e, 0x6f, 0x77, 0x69, 0x6e,
+  0x67, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
+  0x73, 0x20, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x20,
+  0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x72,
+  0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x72, 0x6f, 0x75, 0x74, 0x65,
+  0x73, 0x20, 0x65, 0x61, 0x63, 0x68, 0x2e, 0x03, 0x45, 0x76, 0x65, 0x72,
+  0x79, 0x20, 0x43, 0x61, 0x72, 0x61, 0x76, 0x61, 0x6e, 0x20, 0x74, 0x68,
+  0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74,
+  0x6f, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x61, 0x20, 0x77, 0x6f,
+  0x6e, 0x64, 0x65, 0x72, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x61, 0x64,
+  0x64, 0x20, 0x35, 0x30, 0x20, 0x73, 0x68, 0x69, 0x65, 0x6c, 0x64, 0x73,
+  0x20, 0x74, 0x6f, 0x77, 0x61, 0x72, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x68, 0x69, 0x65, 0x66,
+  0x20, 0x25, 0x73, 0x00, 0x00, 0x1d, 0x00, 0x8f, 0x0e, 0x01, 0x5c, 0x45,
+  0x6d, 0x70, 0x65, 0x72, 0x6f, 0x72, 0x20, 0x25, 0x73, 0x00, 0x45, 0x6d,
+  0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x2d, 0x00,
+  0x8f, 0x0e, 0x01, 0x62, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20, 0x43, 0x68,
+  0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61,
+  0x6c, 0x65, 0x3a, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20, 0x43, 0x68, 0x69,
+  0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x00, 0x2f, 0x00, 0x8f, 0x0e, 0x01,
+  0x64, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20, 0x4c, 0x65, 0x61, 0x64, 0x65,
+  0x72, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65,
+  0x3a, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20, 0x4c, 0x65, 0x61, 0x64, 0x65,
+  0x72, 0x20, 0x25, 0x73, 0x00, 0x00, 0x29, 0x00, 0x8f, 0x0e, 0x01, 0x67,
+  0x47, 0x72, 0x61, 0x6e, 0x64, 0x20, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x65,
+  0x20, 0x25, 0x73, 0x00, 0x47, 0x72, 0x61, 0x6e, 0x64, 0x20, 0x50, 0x72,
+  0x69, 0x6e, 0x63, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x31,
+  0x00, 0x8f, 0x0e, 0x01, 0x68, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20, 0x50,
+  0x68, 0x61, 0x72, 0x61, 0x6f, 0x68, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66,
+  0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20,
+  0x50, 0x68, 0x61, 0x72, 0x61, 0x6f, 0x68, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x2d, 0x00, 0x8f, 0x0e, 0x01, 0x6a, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20,
+  0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65,
+  0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20, 0x43,
+  0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x00, 0x26, 0x00, 0x8f,
+  0x0e, 0x01, 0x6b, 0x47, 0x72, 0x61, 0x6e, 0x64, 0x20, 0x44, 0x75, 0x6b,
+  0x65, 0x20, 0x25, 0x73, 0x00, 0x47, 0x72, 0x61, 0x6e, 0x64, 0x20, 0x44,
+  0x75, 0x63, 0x68, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x2d,
+  0x00, 0x8f, 0x0e, 0x01, 0x6c, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20, 0x43,
+  0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d,
+  0x61, 0x6c, 0x65, 0x3a, 0x47, 0x72, 0x65, 0x61, 0x74, 0x20, 0x43, 0x68,
+  0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x00, 0x26, 0x00, 0x8f, 0x0e,
+  0x01, 0x6d, 0x47, 0x72, 0x61, 0x6e, 0x64, 0x20, 0x44, 0x75, 0x6b, 0x65,
+  0x20, 0x25, 0x73, 0x00, 0x47, 0x72, 0x61, 0x6e, 0x64, 0x20, 0x44, 0x75,
+  0x63, 0x68, 0x65, 0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1c, 0x00,
+  0x8f, 0x0e, 0x01, 0x6f, 0x53, 0x75, 0x6c, 0x74, 0x61, 0x6e, 0x20, 0x25,
+  0x73, 0x00, 0x53, 0x75, 0x6c, 0x74, 0x61, 0x6e, 0x61, 0x20, 0x25, 0x73,
+  0x00, 0x00, 0x1b, 0x00, 0x8f, 0x0e, 0x01, 0x70, 0x54, 0x73, 0x61, 0x72,
+  0x20, 0x25, 0x73, 0x00, 0x54, 0x73, 0x61, 0x72, 0x69, 0x74, 0x73, 0x61,
+  0x20, 0x25, 0x73, 0x00, 0x00, 0x2d, 0x00, 0x8f, 0x0e, 0x01, 0x72, 0x47,
+  0x72, 0x65, 0x61, 0x74, 0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25,
+  0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x47, 0x72,
+  0x65, 0x61, 0x74, 0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73,
+  0x00, 0x00, 0x27, 0x00, 0x8f, 0x0e, 0x01, 0x73, 0x50, 0x61, 0x64, 0x69,
+  0x73, 0x68, 0x61, 0x68, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d,
+  0x61, 0x6c, 0x65, 0x3a, 0x50, 0x61, 0x64, 0x69, 0x73, 0x68, 0x61, 0x68,
+  0x20, 0x25, 0x73, 0x00, 0x00, 0x1f, 0x00, 0x8f, 0x0e, 0x01, 0x76, 0x4d,
+  0x61, 0x68, 0x61, 0x72, 0x61, 0x6a, 0x61, 0x20, 0x25, 0x73, 0x00, 0x4d,
+  0x61, 0x68, 0x61, 0x72, 0x61, 0x6e, 0x69, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x1f, 0x00, 0x8f, 0x0e, 0x01, 0x77, 0x45, 0x6c, 0x65, 0x63, 0x74, 0x6f,
+  0x72, 0x20, 0x25, 0x73, 0x00, 0x45, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x65,
+  0x73, 0x73, 0x20, 0x25, 0x73, 0x00, 0x00, 0x35, 0x00, 0x8f, 0x0e, 0x01,
+  0x7c, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x43,
+  0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d,
+  0x61, 0x6c, 0x65, 0x3a, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x6f, 0x75, 0x6e,
+  0x74, 0x20, 0x43, 0x68, 0x69, 0x65, 0x66, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x1b, 0x00, 0x8f, 0x0e, 0x01, 0x7f, 0x53, 0x68, 0x61, 0x68, 0x20, 0x25,
+  0x73, 0x00, 0x53, 0x68, 0x61, 0x68, 0x62, 0x61, 0x6e, 0x75, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x1b, 0x00, 0x8f, 0x0e, 0x01, 0x81, 0x25, 0x73, 0x20,
+  0x53, 0x68, 0x61, 0x68, 0x00, 0x25, 0x73, 0x20, 0x53, 0x68, 0x61, 0x68,
+  0x62, 0x61, 0x6e, 0x75, 0x00, 0x00, 0x1f, 0x00, 0x8f, 0x0e, 0x01, 0x82,
+  0x56, 0x69, 0x63, 0x65, 0x72, 0x6f, 0x79, 0x20, 0x25, 0x73, 0x00, 0x56,
+  0x69, 0x63, 0x65, 0x72, 0x65, 0x69, 0x6e, 0x65, 0x20, 0x25, 0x73, 0x00,
+  0x00, 0x18, 0x00, 0x8f, 0x0e, 0x01, 0x83, 0x45, 0x6d, 0x69, 0x72, 0x20,
+  0x25, 0x73, 0x00, 0x45, 0x6d, 0x69, 0x72, 0x61, 0x20, 0x25, 0x73, 0x00,
+  0x01, 0x9e, 0x00, 0x91, 0xbd, 0x03, 0x01, 0x00, 0x00, 0x00, 0x10, 0x07,
+  0x00, 0x01, 0x00, 0x43, 0x6f, 0x6d, 0x6d, 0x75, 0x6e, 0x69, 0x73, 0x6d,
+  0x00, 0x43, 0x6f, 0x6d, 0x6d, 0x75, 0x6e, 0x69, 0x73, 0x6d, 0x00, 0x67,
+  0x6f, 0x76, 0x2e, 0x63, 0x6f, 0x6d, 0x6d, 0x75, 0x6e, 0x69, 0x73, 0x6d,
+  0x00, 0x41, 0x20, 0x43, 0x6f, 0x6d, 0x6d, 0x75, 0x6e, 0x69, 0x73, 0x74,
+  0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x69, 0x73, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x69, 0x64, 0x65, 0x61, 0x6c, 0x20, 0x74, 0x68,
+  0x61, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x70, 0x65, 0x6f, 0x70, 0x6c,
+  0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x2e,
+  0x20, 0x20, 0x41, 0x6c, 0x6c, 0x20, 0x67, 0x6f, 0x6f, 0x64, 0x73, 0x20,
+  0x61, 0x72, 0x65, 0x20, 0x6f, 0x77, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2c, 0x20,
+  0x72, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20,
+  0x62, 0x79, 0x20, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x20, 0x63,
+  0x69, 0x74, 0x69, 0x7a, 0x65, 0x6e, 0x73, 0x2e, 0x20, 0x20, 0x43, 0x6f,
+  0x6d, 0x6d, 0x75, 0x6e, 0x69, 0x73, 0x6d, 0x20, 0x67, 0x69, 0x76, 0x65,
+  0x73, 0x20, 0x61, 0x20, 0x62, 0x61, 0x6c, 0x61, 0x6e, 0x63, 0x65, 0x20,
+  0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x6d, 0x69, 0x6c, 0x69,
+  0x74, 0x61, 0x72, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f, 0x6d,
+  0x6d, 0x65, 0x72, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e,
+  0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x03, 0x55, 0x6e, 0x64, 0x65, 0x72, 0x20,
+  0x43, 0x6f, 0x6d, 0x6d, 0x75, 0x6e, 0x69, 0x73, 0x6d, 0x2c, 0x20, 0x63,
+  0x6f, 0x72, 0x72, 0x75, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x64, 0x6f,
+  0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x76, 0x61, 0x72, 0x79, 0x20,
+  0x62, 0x79, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x61, 0x70,
+  0x69, 0x74, 0x61, 0x6c, 0x3b, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x63, 0x69,
+  0x74, 0x69, 0x65, 0x73, 0x20, 0x28, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64,
+  0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x61, 0x70, 0x69,
+  0x74, 0x61, 0x6c, 0x29, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x20,
+  0x6d, 0x6f, 0x64, 0x65, 0x73, 0x74, 0x20, 0x61, 0x6d, 0x6f, 0x75, 0x6e,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x75, 0x70, 0x74,
+  0x69, 0x6f, 0x6e, 0x2e, 0x03, 0x00, 0x00, 0x24, 0x00, 0x8f, 0x0f, 0x03,
+  0x01, 0x82, 0x43, 0x6f, 0x6d, 0x61, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x65,
+  0x20, 0x25, 0x73, 0x00, 0x43, 0x6f, 0x6d, 0x61, 0x6e, 0x64, 0x61, 0x6e,
+  0x74, 0x61, 0x20, 0x25, 0x73, 0x00, 0x00, 0x35, 0x00, 0x8f, 0x0e, 0x00,
+  0xc2, 0x46, 0x69, 0x72, 0x73, 0x74, 0x20, 0x53, 0x65, 0x63, 0x72, 0x65,
+  0x74, 0x61, 0x72, 0x79, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d,
+  0x61, 0x6c, 0x65, 0x3a, 0x46, 0x69, 0x72, 0x73, 0x74, 0x20, 0x53, 0x65,
+  0x63, 0x72, 0x65, 0x74, 0x61, 0x72, 0x79, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x39, 0x00, 0x8f, 0x0e, 0x00, 0x06, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61,
+  0x6c, 0x20, 0x53, 0x65, 0x63, 0x72, 0x65, 0x74, 0x61, 0x72, 0x79, 0x20,
+  0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x47,
+  0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x53, 0x65, 0x63, 0x72, 0x65,
+  0x74, 0x61, 0x72, 0x79, 0x20, 0x25, 0x73, 0x00, 0x00, 0x35, 0x00, 0x8f,
+  0x0e, 0x01, 0x88, 0x46, 0x69, 0x72, 0x73, 0x74, 0x20, 0x53, 0x65, 0x63,
+  0x72, 0x65, 0x74, 0x61, 0x72, 0x79, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66,
+  0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x46, 0x69, 0x72, 0x73, 0x74, 0x20,
+  0x53, 0x65, 0x63, 0x72, 0x65, 0x74, 0x61, 0x72, 0x79, 0x20, 0x25, 0x73,
+  0x00, 0x00, 0x23, 0x00, 0x8f, 0x0e, 0x00, 0xc8, 0x43, 0x6f, 0x6d, 0x61,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x65, 0x20, 0x25, 0x73, 0x00, 0x43, 0x6f,
+  0x6d, 0x61, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x61, 0x20, 0x25, 0x73, 0x00,
+  0x00, 0x21, 0x00, 0x8f, 0x0e, 0x00, 0xcb, 0x43, 0x68, 0x61, 0x69, 0x72,
+  0x6d, 0x61, 0x6e, 0x20, 0x25, 0x73, 0x00, 0x43, 0x68, 0x61, 0x69, 0x72,
+  0x77, 0x6f, 0x6d, 0x61, 0x6e, 0x20, 0x25, 0x73, 0x00, 0x00, 0x35, 0x00,
+  0x8f, 0x0e, 0x01, 0x8c, 0x46, 0x69, 0x72, 0x73, 0x74, 0x20, 0x53, 0x65,
+  0x63, 0x72, 0x65, 0x74, 0x61, 0x72, 0x79, 0x20, 0x25, 0x73, 0x00, 0x3f,
+  0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x46, 0x69, 0x72, 0x73, 0x74,
+  0x20, 0x53, 0x65, 0x63, 0x72, 0x65, 0x74, 0x61, 0x72, 0x79, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x07, 0x00, 0x8f, 0x02, 0x00, 0x0c, 0x00, 0x21, 0x00,
+  0x8f, 0x0e, 0x00, 0xce, 0x43, 0x68, 0x61, 0x69, 0x72, 0x6d, 0x61, 0x6e,
+  0x20, 0x25, 0x73, 0x00, 0x43, 0x68, 0x61, 0x69, 0x72, 0x77, 0x6f, 0x6d,
+  0x61, 0x6e, 0x20, 0x25, 0x73, 0x00, 0x00, 0x39, 0x00, 0x8f, 0x0e, 0x00,
+  0x0e, 0x53, 0x65, 0x63, 0x72, 0x65, 0x74, 0x61, 0x72, 0x79, 0x20, 0x47,
+  0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66,
+  0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x53, 0x65, 0x63, 0x72, 0x65, 0x74,
+  0x61, 0x72, 0x79, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20,
+  0x25, 0x73, 0x00, 0x00, 0x35, 0x00, 0x8f, 0x0e, 0x00, 0x15, 0x46, 0x69,
+  0x72, 0x73, 0x74, 0x20, 0x53, 0x65, 0x63, 0x72, 0x65, 0x74, 0x61, 0x72,
+  0x79, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65,
+  0x3a, 0x46, 0x69, 0x72, 0x73, 0x74, 0x20, 0x53, 0x65, 0x63, 0x72, 0x65,
+  0x74, 0x61, 0x72, 0x79, 0x20, 0x25, 0x73, 0x00, 0x00, 0x3b, 0x00, 0x8f,
+  0x0e, 0x01, 0x9a, 0x50, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x27, 0x73, 0x20,
+  0x43, 0x6f, 0x6d, 0x6d, 0x69, 0x73, 0x73, 0x61, 0x72, 0x20, 0x25, 0x73,
+  0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x50, 0x65, 0x6f,
+  0x70, 0x6c, 0x65, 0x27, 0x73, 0x20, 0x43, 0x6f, 0x6d, 0x6d, 0x69, 0x73,
+  0x73, 0x61, 0x72, 0x20, 0x25, 0x73, 0x00, 0x00, 0x1c, 0x00, 0x8f, 0x0e,
+  0x00, 0xda, 0x42, 0x72, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x25, 0x73,
+  0x00, 0x53, 0x69, 0x73, 0x74, 0x65, 0x72, 0x20, 0x25, 0x73, 0x00, 0x00,
+  0x23, 0x00, 0x8f, 0x0e, 0x00, 0x1e, 0x43, 0x6f, 0x6d, 0x61, 0x6e, 0x64,
+  0x61, 0x6e, 0x74, 0x65, 0x20, 0x25, 0x73, 0x00, 0x43, 0x6f, 0x6d, 0x61,
+  0x6e, 0x64, 0x61, 0x6e, 0x74, 0x61, 0x20, 0x25, 0x73, 0x00, 0x00, 0x07,
+  0x00, 0x8f, 0x02, 0x01, 0xa3, 0x00, 0x21, 0x00, 0x8f, 0x0e, 0x01, 0xa5,
+  0x43, 0x68, 0x61, 0x69, 0x72, 0x6d, 0x61, 0x6e, 0x20, 0x25, 0x73, 0x00,
+  0x43, 0x68, 0x61, 0x69, 0x72, 0x77, 0x6f, 0x6d, 0x61, 0x6e, 0x20, 0x25,
+  0x73, 0x00, 0x00, 0x35, 0x00, 0x8f, 0x0e, 0x00, 0x26, 0x46, 0x69, 0x72,
+  0x73, 0x74, 0x20, 0x53, 0x65, 0x63, 0x72, 0x65, 0x74, 0x61, 0x72, 0x79,
+  0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a,
+  0x46, 0x69, 0x72, 0x73, 0x74, 0x20, 0x53, 0x65, 0x63, 0x72, 0x65, 0x74,
+  0x61, 0x72, 0x79, 0x20, 0x25, 0x73, 0x00, 0x00, 0x21, 0x00, 0x8f, 0x0e,
+  0x00, 0xe8, 0x43, 0x68, 0x61, 0x69, 0x72, 0x6d, 0x61, 0x6e, 0x20, 0x25,
+  0x73, 0x00, 0x43, 0x68, 0x61, 0x69, 0x72, 0x77, 0x6f, 0x6d, 0x61, 0x6e,
+  0x20, 0x25, 0x73, 0x00, 0x00, 0x39, 0x00, 0x8f, 0x0e, 0x01, 0xa9, 0x53,
+  0x65, 0x63, 0x72, 0x65, 0x74, 0x61, 0x72, 0x79, 0x20, 0x47, 0x65, 0x6e,
+  0x65, 0x72, 0x61, 0x6c, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66, 0x65, 0x6d,
+  0x61, 0x6c, 0x65, 0x3a, 0x53, 0x65, 0x63, 0x72, 0x65, 0x74, 0x61, 0x72,
+  0x79, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x25, 0x73,
+  0x00, 0x00, 0x2d, 0x00, 0x8f, 0x0e, 0x00, 0xeb, 0x4b, 0x69, 0x62, 0x62,
+  0x75, 0x74, 0x7a, 0x6e, 0x69, 0x6b, 0x20, 0x25, 0x73, 0x00, 0x3f, 0x66,
+  0x65, 0x6d, 0x61, 0x6c, 0x65, 0x3a, 0x4b, 0x69, 0x62, 0x62, 0x75, 0x74,
+  0x7a, 0x6e, 0x69, 0x6b, 0x69, 0x74, 0x20, 0x25, 0x73, 0x00, 0x00, 0x35,
+  0x00, 0x8f, 0x0e, 0x00, 0xed, 0x46, 0x69, 0x72, 0x73, 0x74, 0x20, 0x53,
+  0x65, 0x6e, 0x65, 0x74, 0x69, 0x63, 0x00, 0x56, 0x65, 0x6e, 0x65, 0x74,
+  0x69, 0x63, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x56,
+  0x65, 0x6e, 0x65, 0x74, 0x69, 0x00, 0x76, 0x65, 0x6e, 0x65, 0x74, 0x69,
+  0x63, 0x00, 0x2d, 0x00, 0x54, 0x68, 0x65, 0x20, 0x56, 0x65, 0x6e, 0x65,
+  0x74, 0x69, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x20, 0x61,
+  0x6e, 0x63, 0x69, 0x65, 0x6e, 0x74, 0x20, 0x49, 0x6e, 0x64, 0x6f, 0x2d,
+  0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x61, 0x6e, 0x20, 0x70, 0x65, 0x6f,
+  0x70, 0x6c, 0x65, 0x20, 0x77, 0x68, 0x6f, 0x20, 0x69, 0x6e, 0x68, 0x61,
+  0x62, 0x69, 0x74, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x20, 0x61, 0x72, 0x65,
+  0x61, 0x20, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x6c, 0x79, 0x20, 0x63, 0x6f,
+  0x69, 0x6e, 0x63, 0x69, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x72, 0x6e,
+  0x20, 0x49, 0x74, 0x61, 0x6c, 0x69, 0x61, 0x6e, 0x20, 0x72, 0x65, 0x67,
+  0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x56, 0x65, 0x6e, 0x65, 0x74,
+  0x6f, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x69, 0x72, 0x20, 0x6c, 0x61, 0x6e,
+  0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x6f, 0x72, 0x69, 0x67,
+  0x69, 0x6e, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x62,
+  0x61, 0x62, 0x6c, 0x79, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x43, 0x65,
+  0x6e, 0x74, 0x72, 0x61, 0x6c, 0x20, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65,
+  0x2c, 0x20, 0x62, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 0x20, 0x69, 0x74,
+  0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x73, 0x20, 0x73, 0x6f, 0x6d, 0x65,
+  0x20, 0x66, 0x65, 0x61, 0x74, 0x75, 0x72, 0x65, 0x73, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x43, 0x65, 0x6c, 0x74, 0x69, 0x63, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x47, 0x65, 0x72, 0x6d, 0x61, 0x6e, 0x69, 0x63, 0x20, 0x6c,
+  0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x73, 0x2e, 0x20, 0x54, 0x68,
+  0x65, 0x20, 0x56, 0x65, 0x6e, 0x65, 0x74, 0x69, 0x20, 0x61, 0x6c, 0x6c,
+  0x69, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x52, 0x6f, 0x6d, 0x61, 0x6e, 0x73, 0x20, 0x64, 0x75, 0x72, 0x69,
+  0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x75, 0x6e, 0x69, 0x63,
+  0x20, 0x57, 0x61, 0x72, 0x73, 0x2e, 0x20, 0x42, 0x79, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x31, 0x73, 0x74, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x75, 0x72,
+  0x79, 0x20, 0x42, 0x43, 0x45, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x68,
+  0x61, 0x64, 0x20, 0x62, 0x65, 0x65, 0x6e, 0x20, 0x61, 0x62, 0x73, 0x6f,
+  0x72, 0x62, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x52, 0x6f, 0x6d, 0x61, 0x6e, 0x20, 0x52, 0x65, 0x70, 0x75,
+  0x62, 0x6c, 0x69, 0x63, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x72, 0x65, 0x67, 0x69, 0x6f, 0x6e, 0x20, 0x67, 0x72, 0x61, 0x64,
+  0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x52, 0x6f, 0x6d, 0x61, 0x6e, 0x69,
+  0x7a, 0x65, 0x64, 0x2e, 0x00, 0x05, 0x0a, 0x53, 0x75, 0x72, 0x6f, 0x73,
+  0x00, 0x52, 0x65, 0x73, 0x75, 0x6e, 0x6b, 0x6f, 0x73, 0x00, 0x4b, 0x61,
+  0x6e, 0x74, 0x65, 0x73, 0x00, 0x56, 0x6f, 0x74, 0x74, 0x6f, 0x73, 0x00,
+  0x41, 0x6b, 0x75, 0x74, 0x6f, 0x73, 0x00, 0x4e, 0x65, 0x72, 0x6b, 0x61,
+  0x00, 0x4c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x6f, 0x72, 0x00, 0x46, 0x75,
+  0x67, 0x69, 0x61, 0x00, 0x41, 0x6e, 0x64, 0x65, 0x74, 0x6f, 0x73, 0x00,
+  0x52, 0x65, 0x69, 0x74, 0x69, 0x61, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x02, 0x00, 0x07, 0x06, 0x02,
+  0xe5, 0x00, 0x94, 0xff, 0xef, 0x03, 0x02, 0x10, 0x66, 0x72, 0x65, 0x65,
+  0x63, 0x69, 0x76, 0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00,
+  0x56, 0x65, 0x6e, 0x65, 0x7a, 0x75, 0x65, 0x6c, 0x61, 0x6e, 0x00, 0x56,
+  0x65, 0x6e, 0x65, 0x7a, 0x75, 0x65, 0x6c, 0x61, 0x6e, 0x00, 0x3f, 0x70,
+  0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x56, 0x65, 0x6e, 0x65, 0x7a, 0x75,
+  0x65, 0x6c, 0x61, 0x6e, 0x73, 0x00, 0x76, 0x65, 0x6e, 0x65, 0x7a, 0x75,
+  0x65, 0x6c, 0x61, 0x00, 0x2d, 0x00, 0x56, 0x65, 0x6e, 0x65, 0x7a, 0x75,
+  0x65, 0x6c, 0x61, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e,
+  0x6f, 0x72, 0x74, 0x68, 0x65, 0x72, 0x6e, 0x6d, 0x6f, 0x73, 0x74, 0x20,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x53,
+  0x6f, 0x75, 0x74, 0x68, 0x20, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2e, 0x20, 0x48, 0x61, 0x76, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x65, 0x65,
+  0x6e, 0x20, 0x61, 0x20, 0x53, 0x70, 0x61, 0x6e, 0x69, 0x73, 0x68, 0x20,
+  0x63, 0x6f, 0x6c, 0x6f, 0x6e, 0x79, 0x20, 0x73, 0x69, 0x6e, 0x63, 0x65,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x36, 0x74, 0x68, 0x20, 0x63, 0x65,
+  0x6e, 0x74, 0x75, 0x72, 0x79, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x67, 0x61, 0x69, 0x6e, 0x65,
+  0x64, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e,
+  0x63, 0x65, 0x20, 0x6f, 0x6e, 0x20, 0x4a, 0x75, 0x6c, 0x79, 0x20, 0x35,
+  0x74, 0x68, 0x20, 0x31, 0x38, 0x31, 0x31, 0x20, 0x75, 0x6e, 0x64, 0x65,
+  0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x65, 0x61, 0x64, 0x65, 0x72,
+  0x73, 0x68, 0x69, 0x70, 0x20, 0x6f, 0x66, 0x20, 0x45, 0x6c, 0x20, 0x4c,
+  0x69, 0x62, 0x65, 0x72, 0x74, 0x61, 0x64, 0x6f, 0x72, 0x20, 0x53, 0x69,
+  0x6d, 0xc3, 0xb3, 0x6e, 0x20, 0x42, 0x6f, 0x6c, 0x69, 0x76, 0x61, 0x72,
+  0x20, 0x2d, 0x20, 0x54, 0x68, 0x65, 0x20, 0x4c, 0x69, 0x62, 0x65, 0x72,
+  0x61, 0x74, 0x6f, 0x72, 0x2e, 0x20, 0x56, 0x65, 0x6e, 0x65, 0x7a, 0x75,
+  0x65, 0x6c, 0x61, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6f, 0x6e, 0x65, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65,
+  0x73, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x65, 0x6e, 0x20, 0x6f, 0x69,
+  0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x67, 0x61, 0x73, 0x20, 0x72, 0x65,
+  0x73, 0x65, 0x72, 0x76, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x3b, 0x20, 0x64, 0x75, 0x72,
+  0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x69, 0x6c, 0x20,
+  0x62, 0x6f, 0x6f, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x31, 0x39, 0x37, 0x30, 0x73, 0x20, 0x69, 0x74, 0x20, 0x77, 0x61, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x65, 0x61, 0x6c, 0x74, 0x68, 0x69,
+  0x65, 0x73, 0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72, 0x79, 0x20,
+  0x6f, 0x66, 0x20, 0x4c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x6b, 0x6e, 0x6f,
+  0x77, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x74, 0x73, 0x20, 0x76,
+  0x61, 0x72, 0x69, 0x65, 0x64, 0x20, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x63,
+  0x61, 0x70, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x68, 0x69, 0x67,
+  0x68, 0x20, 0x62, 0x69, 0x6f, 0x64, 0x69, 0x76, 0x65, 0x72, 0x73, 0x69,
+  0x74, 0x79, 0x2e, 0x00, 0x02, 0x0a, 0x4e, 0x69, 0x63, 0x6f, 0x6c, 0xc3,
+  0xa1, 0x73, 0x20, 0x64, 0x65, 0x20, 0x46, 0x65, 0x64, 0x65, 0x72, 0x6d,
+  0xc3, 0xa1, 0x6e, 0x00, 0x46, 0x72, 0x61, 0x6e, 0x63, 0x69, 0x73, 0x63,
+  0x6f, 0x20, 0x64, 0x65, 0x20, 0x4d, 0x69, 0x72, 0x61, 0x6e, 0x64, 0x61,
+  0x00, 0x53, 0x69, 0x6d, 0xc3, 0xb3, 0x6e, 0x20, 0x42, 0x6f, 0x6c, 0xc3,
+  0xad, 0x76, 0x61, 0x72, 0x00, 0x43, 0x72, 0x69, 0x73, 0x74, 0xc3, 0xb3,
+  0x62, 0x61, 0x6c, 0x20, 0x4d, 0x65, 0x6e, 0x64, 0x6f, 0x7a, 0x61, 0x00,
+  0x4a, 0x6f, 0x73, 0xc3, 0xa9, 0x20, 0x41, 0x6e, 0x74, 0x6f, 0x6e, 0x69,
+  0x6f, 0x20, 0x50, 0xc3, 0xa1, 0x65, 0x7a, 0x00, 0x4a, 0x75, 0x61, 0x6e,
+  0x20, 0x56, 0x69, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x20, 0x47, 0xc3, 0xb3,
+  0x6d, 0x65, 0x7a, 0x00, 0x52, 0xc3, 0xb3, 0x6d, 0x75, 0x6c, 0x6f, 0x20,
+  0x47, 0x61, 0x6c, 0x6c, 0x65, 0x67, 0x6f, 0x73, 0x00, 0x4d, 0x61, 0x72,
+  0x63, 0x6f, 0x73, 0x20, 0x50, 0xc3, 0xa9, 0x72, 0x65, 0x7a, 0x20, 0x4a,
+  0x69, 0x6d, 0xc3, 0xa9, 0x6e, 0x65, 0x7a, 0x00, 0x52, 0xc3, 0xb3, 0x6d,
+  0x75, 0x6c, 0x6f, 0x20, 0x42, 0x65, 0x74, 0x61, 0x6e, 0x63, 0x6f, 0x75,
+  0x72, 0x74, 0x00, 0x48, 0x75, 0x67, 0x6f, 0x20, 0x43, 0x68, 0xc3, 0xa1,
+  0x76, 0x65, 0x7a, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x02, 0x05, 0x03, 0x06, 0x01, 0xd2, 0x00, 0x94,
+  0x7f, 0xef, 0x03, 0x02, 0x11, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76,
+  0x2d, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x56, 0x65, 0x72,
+  0x6d, 0x6f, 0x6e, 0x74, 0x00, 0x56, 0x65, 0x72, 0x6d, 0x6f, 0x6e, 0x74,
+  0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c, 0x3a, 0x56, 0x65, 0x72,
+  0x6d, 0x6f, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x00, 0x76, 0x65, 0x72, 0x6d,
+  0x6f, 0x6e, 0x74, 0x00, 0x75, 0x73, 0x61, 0x00, 0x56, 0x65, 0x72, 0x6d,
+  0x6f, 0x6e, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x69,
+  0x6e, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x20, 0x73,
+  0x74, 0x61, 0x74, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x31, 0x34, 0x20,
+  0x79, 0x65, 0x61, 0x72, 0x73, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
+  0x20, 0x69, 0x74, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x55, 0x6e, 0x69, 0x74, 0x65, 0x64, 0x20, 0x53, 0x74,
+  0x61, 0x74, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x37, 0x39, 0x31,
+  0x2e, 0x20, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x6c, 0x79, 0x20,
+  0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x65, 0x73,
+  0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x55, 0x6e, 0x69, 0x74, 0x65, 0x64, 0x20, 0x53,
+  0x74, 0x61, 0x74, 0x65, 0x73, 0x2c, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20,
+  0x69, 0x6e, 0x20, 0x70, 0x6f, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x72, 0x65, 0x61, 0x2e, 0x20,
+  0x56, 0x65, 0x72, 0x6d, 0x6f, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 0x66,
+  0x61, 0x6d, 0x6f, 0x75, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x74,
+  0x73, 0x20, 0x64, 0x61, 0x69, 0x72, 0x79, 0x20, 0x70, 0x72, 0x6f, 0x64,
+  0x75, 0x63, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6d, 0x61, 0x70,
+  0x6c, 0x65, 0x20, 0x73, 0x79, 0x72, 0x75, 0x70, 0x2e, 0x00, 0x08, 0x45,
+  0x74, 0x68, 0x61, 0x6e, 0x20, 0x41, 0x6c, 0x6c, 0x65, 0x6e, 0x00, 0x54,
+  0x68, 0x6f, 0x6d, 0x61, 0x73, 0x20, 0x43, 0x68, 0x69, 0x74, 0x74, 0x65,
+  0x6e, 0x64, 0x65, 0x6e, 0x00, 0x54, 0x68, 0x61, 0x64, 0x64, 0x65, 0x75,
+  0x73, 0x20, 0x53, 0x74, 0x65, 0x76, 0x65, 0x6e, 0x73, 0x00, 0x4d, 0x6f,
+  0x73, 0x65, 0x73, 0x20, 0x52, 0x6f, 0x62, 0x69, 0x6e, 0x73, 0x6f, 0x6e,
+  0x00, 0x45, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x41, 0x2e, 0x20, 0x48, 0x69,
+  0x74, 0x63, 0x68, 0x63, 0x6f, 0x63, 0x6b, 0x00, 0x45, 0x72, 0x6e, 0x65,
+  0x73, 0x74, 0x20, 0x57, 0x2e, 0x20, 0x47, 0x69, 0x62, 0x73, 0x6f, 0x6e,
+  0x2c, 0x20, 0x4a, 0x72, 0x2e, 0x00, 0x4d, 0x61, 0x64, 0x65, 0x6c, 0x65,
+  0x69, 0x6e, 0x65, 0x20, 0x4d, 0x2e, 0x20, 0x4b, 0x75, 0x6e, 0x69, 0x6e,
+  0x00, 0x42, 0x65, 0x72, 0x6e, 0x69, 0x65, 0x20, 0x53, 0x61, 0x6e, 0x64,
+  0x65, 0x72, 0x73, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x01, 0x02, 0x05, 0x02, 0x06, 0x01, 0x39, 0x00, 0x94, 0xff, 0xef,
+  0x03, 0x02, 0x12, 0x66, 0x72, 0x65, 0x65, 0x63, 0x69, 0x76, 0x2d, 0x6e,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x56, 0x69, 0x65, 0x74, 0x6e,
+  0x61, 0x6d, 0x65, 0x73, 0x65, 0x00, 0x56, 0x69, 0x65, 0x74, 0x6e, 0x61,
+  0x6d, 0x65, 0x73, 0x65, 0x00, 0x3f, 0x70, 0x6c, 0x75, 0x72, 0x61, 0x6c,
+  0x3a, 0x56, 0x69, 0x65, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x65, 0x00,
+  0x76, 0x69, 0x65, 0x74, 0x6e, 0x61, 0x6d, 0x00, 0x2d, 0x00, 0x54, 0x68,
+  0x65, 0x20, 0x56, 0x69, 0x65, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x65,
+  0x20, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x61, 0x73, 0x20,
+  0x66, 0x6f, 0x75, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x63, 0x65, 0x6e,
+  0x74, 0x75, 0x72, 0x79, 0x20, 0x43, 0x45, 0x20, 0x62, 0x79, 0x20, 0x74,
+  0x77, 0x69, 0x6e, 0x20, 0x73, 0x69, 0x73, 0x74, 0x65, 0x72, 0x73, 0x20,
+  0x77, 0x68, 0x6f, 0x20, 0x62, 0x65, 0x63, 0x61, 0x6d, 0x65, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x77, 0x61, 0x72, 0x20, 0x6c, 0x65, 0x61, 0x64, 0x65,
+  0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x72, 0x65, 0x76, 0x6f,
+  0x6c, 0x74, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x74, 0x20, 0x61,
+  0x20, 0x43, 0x68, 0x69, 0x6e, 0x65, 0x73, 0x65, 0x20, 0x6d, 0x69, 0x6c,
+  0x69, 0x74, 0x61, 0x72, 0x79, 0x20, 0x67, 0x6f, 0x76, 0x65, 0x72, 0x6e,
+  0x6f, 0x72, 0x2e, 0x00, 0x03, 0x06, 0x3b, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x6f, 0x00,
+  0x00, 0x1d, 0x00, 0x10, 0x20, 0x00, 0x40, 0x00, 0x04, 0x80, 0x00, 0x00,
+  0x80, 0x19, 0x30, 0xb5, 0x8f, 0x10, 0x80, 0xbc, 0x08, 0x00, 0x01, 0x00,
+  0x08, 0xff, 0xff, 0xf1, 0xbe, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0xe0, 0xc0,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+  0x00, 0x17, 0x00, 0x1f, 0x00, 0x80, 0xc0, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+  0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x14, 0x00, 0x3f,
+  0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x0c, 0xfc, 0x01,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x82, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x37, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x82, 0x07, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0x00, 0x6d, 0x00, 0x33, 0xdd,
+  0x1e, 0x44, 0x00, 0x11, 0x00, 0x00, 0x01, 0x4d, 0x61, 0x6c, 0x61, 0x6e,
+  0x64, 0x65, 0x6c, 0x61, 0x20, 0x6b, 0x61, 0x4c, 0x75, 0x7a, 0x75, 0x6d,
+  0x61, 0x6e, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x00, 0x02,
+  0x02, 0x02, 0x2d, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x3f,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x14, 0x00, 0x3f,
+  0x0c, 0x08, 0x01, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x09, 0xc6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x04,
+  0x02, 0x00, 0x08, 0x00, 0xa9, 0x01, 0x00, 0x00, 0x46, 0x00, 0x09, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x06, 0x04, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x00, 0x00,
+  0x00, 0x74, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x0b,
+  0xce, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x72, 0x01, 0x00, 0x11, 0x00, 0x3f, 0x00, 0x00, 0x18, 0x03, 0x00,
+  0x00, 0x77, 0x00, 0x0a, 0x00, 0x0a, 0x02, 0x01, 0x00, 0x09, 0x00, 0x3b,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40,
+  0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x52, 0x00, 0x33, 0x14, 0x00, 0x16,
+  0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
+  0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x72, 0x00, 0x00, 0x00, 0x06, 0x00, 0x14, 0x00, 0x3f, 0x0c, 0x08,
+  0x01, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x02, 0xc6, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x70,
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+  0x14, 0x00, 0x3f, 0x0c, 0x08, 0x01, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00,
+  0x06, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x3f, 0x00,
+  0x00, 0x60, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x04, 0x5a, 0x07, 0x00,
+  0x0c, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x05, 0xd6, 0x00, 0x03, 0x00,
+  0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x3f,
+  0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x04, 0xd7, 0x07,
+  0x00, 0x17, 0x00, 0x10, 0x20, 0x00, 0x40, 0x01, 0x04, 0x80, 0x00, 0x00,
+  0x82, 0x1d, 0x30, 0x35, 0x40, 0x10, 0x80, 0x1c, 0x08, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x1f, 0x00, 0x80, 0xc0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x84,
+  0x00, 0x00, 0x00, 0x51, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f,
+  0x00, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7b,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x7f, 0x05, 0xff, 0xff, 0xf0,
+  0x9c, 0x00, 0x04, 0x00, 0x08, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x85, 0x00,
+  0x12, 0x00, 0x33, 0x14, 0x00, 0x16, 0x00, 0x30, 0x00, 0x00, 0x01, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x00, 0x40,
+  0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x52, 0x00, 0x33, 0x14, 0x00, 0x04,
+  0x00, 0x31, 0x04, 0x00, 0x02, 0x46, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcb, 0x6e, 0x17, 0x00, 0x00,
+  0x00, 0x7b, 0xff, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x06, 0x01,
+  0x00, 0x0f, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x85, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x02, 0x02,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x1e, 0x00,
+  0x08, 0x00, 0xaa, 0x05, 0x00, 0x00, 0x5d, 0x00, 0x07, 0x00, 0xa8, 0x05,
+  0x00, 0x6f, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x1b, 0x00, 0x07, 0x00,
+  0xa7, 0x05, 0x00, 0x3d, 0x00, 0x07, 0x00, 0xa6, 0x05, 0x00, 0x4e, 0x00,
+  0x07, 0x00, 0xa6, 0x05, 0x00, 0x70, 0x00, 0x08, 0x00, 0xa9, 0x05, 0x00,
+  0x00, 0x57, 0x00, 0x08, 0x00, 0xa9, 0x05, 0x00, 0x00, 0x52, 0x00, 0x08,
+  0x00, 0xa9, 0x05, 0x00, 0x00, 0x46, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00,
+  0x42, 0x00, 0x08, 0x00, 0xa9, 0x05, 0x00, 0x00, 0x55, 0x00, 0x07, 0x00,
+  0xa7, 0x05, 0x00, 0x62, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x38, 0x00,
+  0x07, 0x00, 0xa7, 0x05, 0x00, 0x65, 0x00, 0x07, 0x00, 0xa8, 0x05, 0x00,
+  0x81, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x34, 0x00, 0x07, 0x00, 0xa7,
+  0x05, 0x00, 0x5e, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x35, 0x00, 0x08,
+  0x00, 0xa9, 0x05, 0x00, 0x00, 0x54, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00,
+  0x4a, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x29, 0x00, 0x07, 0x00, 0xa6,
+  0x35, 0x00, 0x25, 0x00, 0x07, 0x00, 0xa6, 0x05, 0x00, 0x26, 0x00, 0x07,
+  0x00, 0xa7, 0x05, 0x00, 0x24, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x23,
+  0x00, 0x07, 0x00, 0xa6, 0x35, 0x00, 0x60, 0x00, 0x07, 0x00, 0xa7, 0x05,
+  0x00, 0x71, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x74, 0x00, 0x07, 0x00,
+  0xa6, 0x05, 0x00, 0x7f, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x0c, 0x00,
+  0x07, 0x00, 0xa6, 0x05, 0x00, 0x5c, 0x00, 0x07, 0x00, 0xa6, 0x35, 0x00,
+  0x5b, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x3c, 0x00, 0x07, 0x00, 0xa7,
+  0x05, 0x00, 0x39, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x3f, 0x00, 0x08,
+  0x00, 0xa9, 0x05, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0xa6, 0x35, 0x00,
+  0x13, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x14, 0x00, 0x07, 0x00, 0xa7,
+  0x05, 0x00, 0x2a, 0x00, 0x08, 0x00, 0xa9, 0x05, 0x00, 0x00, 0x53, 0x00,
+  0x07, 0x00, 0xa6, 0x35, 0x00, 0x67, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00,
+  0x1a, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x37, 0x00, 0x07, 0x00, 0xa7,
+  0x05, 0x00, 0x36, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x2b, 0x00, 0x07,
+  0x00, 0xa6, 0x35, 0x00, 0x50, 0x00, 0x07, 0x00, 0xa6, 0x35, 0x00, 0x4f,
+  0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x51, 0x00, 0x07, 0x00, 0xa7, 0x05,
+  0x00, 0x10, 0x00, 0x08, 0x00, 0xa9, 0x05, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0xa7, 0x05, 0x00, 0x91, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x1d,
+  0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x6c, 0x00, 0x07, 0x00, 0xa6, 0x35,
+  0x00, 0x6b, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x6d, 0x00, 0x07, 0x00,
+  0xa7, 0x05, 0x00, 0x6a, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x6e, 0x00,
+  0x07, 0x00, 0xa6, 0x05, 0x00, 0x69, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00,
+  0x1c, 0x00, 0x07, 0x00, 0xa6, 0x05, 0x00, 0x2e, 0x00, 0x07, 0x00, 0xa8,
+  0x05, 0x00, 0x22, 0x00, 0x07, 0x00, 0xa6, 0x35, 0x00, 0x68, 0x00, 0x07,
+  0x00, 0xa7, 0x05, 0x00, 0x78, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x79,
+  0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x0d, 0x00, 0x07, 0x00, 0xa7, 0x05,
+  0x00, 0x40, 0x00, 0x07, 0x00, 0xa6, 0x35, 0x00, 0x15, 0x00, 0x07, 0x00,
+  0xa7, 0x05, 0x00, 0x16, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x4d, 0x00,
+  0x07, 0x00, 0xa7, 0x05, 0x00, 0x58, 0x00, 0x08, 0x00, 0xa9, 0x05, 0x00,
+  0x00, 0x21, 0x00, 0x08, 0x00, 0xa9, 0x05, 0x00, 0x00, 0x77, 0x00, 0x07,
+  0x00, 0xa7, 0x05, 0x00, 0x7b, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x7c,
+  0x00, 0x08, 0x00, 0xa9, 0x05, 0x00, 0x00, 0x56, 0x00, 0x07, 0x00, 0xa7,
+  0x05, 0x00, 0x49, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x4c, 0x00, 0x07,
+  0x00, 0xa6, 0x05, 0x00, 0x63, 0x00, 0x08, 0x00, 0xaa, 0x05, 0x00, 0x00,
+  0x72, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x5a, 0x00, 0x08, 0x00, 0xa9,
+  0x05, 0x00, 0x00, 0x59, 0x00, 0x07, 0x00, 0xa6, 0x35, 0x00, 0x66, 0x00,
+  0x07, 0x00, 0xa7, 0x05, 0x00, 0x2d, 0x00, 0x07, 0x00, 0xa6, 0x35, 0x00,
+  0x0b, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x3e, 0x00, 0x07, 0x00, 0xa7,
+  0x05, 0x00, 0x01, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x0e, 0x00, 0x07,
+  0x00, 0xa7, 0x05, 0x00, 0x61, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x19,
+  0x00, 0x07, 0x00, 0xa6, 0x05, 0x00, 0x28, 0x00, 0x08, 0x00, 0xa9, 0x05,
+  0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0xa8, 0x05, 0x00, 0x27, 0x00, 0x07,
+  0x00, 0xa7, 0x05, 0x00, 0x11, 0x00, 0x07, 0x00, 0xa6, 0x35, 0x00, 0x33,
+  0x00, 0x08, 0x00, 0xa9, 0x05, 0x00, 0x00, 0x09, 0x00, 0x07, 0x00, 0xa7,
+  0x05, 0x00, 0x32, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x2c, 0x00, 0x07,
+  0x00, 0xa7, 0x05, 0x00, 0x3a, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x3b,
+  0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x31, 0x00, 0x07, 0x00, 0xa7, 0x05,
+  0x00, 0x30, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x2f, 0x00, 0x07, 0x00,
+  0xa7, 0x05, 0x00, 0x0f, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x02, 0x00,
+  0x07, 0x00, 0xa7, 0x05, 0x00, 0x75, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00,
+  0x73, 0x00, 0x07, 0x00, 0xa6, 0x05, 0x00, 0x0a, 0x00, 0x07, 0x00, 0xa7,
+  0x05, 0x00, 0x80, 0x00, 0x08, 0x00, 0xaa, 0x05, 0x00, 0x00, 0x05, 0x00,
+  0x08, 0x00, 0xa9, 0x05, 0x00, 0x00, 0x47, 0x00, 0x07, 0x00, 0xa7, 0x05,
+  0x00, 0x48, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x41, 0x00, 0x07, 0x00,
+  0xa6, 0x35, 0x00, 0x45, 0x00, 0x07, 0x00, 0xa6, 0x35, 0x00, 0x44, 0x00,
+  0x07, 0x00, 0xa6, 0x35, 0x00, 0x43, 0x00, 0x07, 0x00, 0xa6, 0x35, 0x00,
+  0x7e, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x76, 0x00, 0x07, 0x00, 0xa6,
+  0x35, 0x00, 0x64, 0x00, 0x08, 0x00, 0xaa, 0x05, 0x00, 0x00, 0x5f, 0x00,
+  0x07, 0x00, 0xa7, 0x05, 0x00, 0x12, 0x00, 0x08, 0x00, 0xaa, 0x05, 0x00,
+  0x00, 0x06, 0x00, 0x07, 0x00, 0xa7, 0x05, 0x00, 0x03, 0x00, 0x07, 0x00,
+  0xa7, 0x05, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x73, 0x1b, 0x00, 0x01, 0x02,
+  0x00, 0x01, 0x00, 0x41, 0x00, 0x19, 0x01, 0x5b, 0x63, 0x20, 0x66, 0x67,
+  0x3d, 0x22, 0x23, 0x38, 0x42, 0x30, 0x30, 0x30, 0x30, 0x22, 0x5d, 0x43,
+  0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62,
+  0x65, 0x65, 0x6e, 0x20, 0x72, 0x65, 0x6d, 0x6f,
+};
+
+const size_t packet_zstd_dict_size = sizeof(packet_zstd_dict);
+#endif /* FREECIV_HAVE_LIBZSTD */
@@ -0,0 +1,35 @@
+/***********************************************************************
+ Freeciv - Copyright (C) 1996 - A Kjeldberg, L Gregersen, P Unold
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2, or (at your option)
+   any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+***********************************************************************/
+#ifndef FC__PACKETS_ZSTD_DICT_H
+#define FC__PACKETS_ZSTD_DICT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stddef.h>
+
+/* Both ends of a connection must use the same dictionary, so its
+ * version is part of the capability, and is also the zstd dictionary
+ * ID. Bump both when the dictionary is trained again. */
+#define PACKET_ZSTD_CAPABILITY "zstd_dict1"
+#define PACKET_ZSTD_DICT_ID 1
+
+extern const unsigned char packet_zstd_dict[];
+extern const size_t packet_zstd_dict_size;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* FC__PACKETS_ZSTD_DICT_H */
@@ -19,7 +19,9 @@
 /* utility */
 #include "astring.h"
 #include "fcintl.h"
+#include "fcthread.h"
 #include "log.h"
+#include "mem.h"
 #include "support.h"
 
 /* common */
@@ -5140,6 +5142,308 @@ bool are_reqs_active_ranges(const enum req_range min_range,
   return TRUE;
 }
 
+/* One requirement of a compiled requirement vector, with the callback
+ * evaluating it already looked up. */
+struct req_program_step {
+  is_req_active_cb cb;
+  struct requirement req;
+  int cost;
+};
+
+/* The state of a requirement program. The program of a vector with
+ * calendar or topology requirements folded away is only valid for the
+ * calendar and topology it was compiled for. These are packed, by
+ * req_program_world_key(), in the state above REQ_PROG_STATE_BITS, so
+ * that the state and the validity are read in one go. */
+#define REQ_PROG_DIRTY      0
+#define REQ_PROG_COMPILING  1
+#define REQ_PROG_COMPILED   2
+#define REQ_PROG_FOLDED     3
+#define REQ_PROG_STATE_BITS 2
+
+/* The state of a requirement program is a plain int in the header, which
+ * C++ code includes too. It's only accessed as an atomic int here, which
+ * has the same size and alignment. */
+#define REQ_PROG_STATE(_prog_) ((fc_atomic_int *) &(_prog_)->state)
+
+/**********************************************************************//**
+  Estimate how costly the requirement is to evaluate. Requirements of
+  the narrow ranges only look at the target itself, while the wide
+  ranges iterate over cities, players or tiles. Requirements that never
+  change are usually selectors (output type, unit type, ...) that fail
+  for most of the targets, so they go first within their range.
+**************************************************************************/
+static int req_eval_cost(const struct requirement *req)
+{
+  int cost;
+
+  switch (req->range) {
+  case REQ_RANGE_LOCAL:
+    cost = 0;
+    break;
+  case REQ_RANGE_TILE:
+  case REQ_RANGE_CITY:
+    cost = 1;
+    break;
+  case REQ_RANGE_PLAYER:
+  case REQ_RANGE_WORLD:
+    cost = 2;
+    break;
+  case REQ_RANGE_TEAM:
+  case REQ_RANGE_ALLIANCE:
+    cost = 3;
+    break;
+  case REQ_RANGE_TRADEROUTE:
+    cost = 4;
+    break;
+  case REQ_RANGE_CADJACENT:
+  case REQ_RANGE_ADJACENT:
+    cost = 5;
+    break;
+  case REQ_RANGE_CONTINENT:
+  case REQ_RANGE_COUNT:
+  default:
+    cost = 6;
+    break;
+  }
+  cost *= 4;
+
+  switch (req->source.kind) {
+  case VUT_MINCULTURE:
+  case VUT_MINFOREIGNPCT:
+  case VUT_NATIONALITY:
+  case VUT_MAXTILEUNITS:
+  case VUT_DIPLREL:
+  case VUT_DIPLREL_TILE:
+  case VUT_DIPLREL_TILE_O:
+  case VUT_DIPLREL_UNITANY:
+  case VUT_DIPLREL_UNITANY_O:
+    /* Count or compute something over a whole set of items. */
+    cost += 2;
+    break;
+  default:
+    break;
+  }
+
+  if (req_definitions[req->source.kind].unchanging != REQUCH_YES) {
+    cost++;
+  }
+
+  return cost;
+}
+
+/**********************************************************************//**
+  Pack the current calendar and map topology, which the calendar and
+  topology requirements depend on, to a key. Returns -1 if they don't
+  fit in it, and then these requirements can't be folded.
+**************************************************************************/
+static int req_program_world_key(void)
+{
+  int year = game.info.year + 0x8000;
+  int fragment = game.info.fragment_count;
+  int topology = CURRENT_TOPOLOGY;
+
+  if (year < 0 || year > 0xffff
+      || fragment < 0 || fragment > 0x3f
+      || topology < 0 || topology > 0x3) {
+    return -1;
+  }
+
+  return year | (fragment << 16) | (topology << 22);
+}
+
+/**********************************************************************//**
+  Return the value of the requirement if it's the same for any target,
+  as long as the ruleset, or the calendar and the map topology if
+  world_key is not -1, don't change. Sets 'world' if it depends on the
+  latter. Returns TRI_MAYBE if the requirement must be evaluated.
+**************************************************************************/
+static enum fc_tristate req_program_fold(const struct requirement *preq,
+                                         int world_key, bool *world)
+{
+  if (preq->source.kind >= VUT_COUNT
+      || req_definitions[preq->source.kind].cb == NULL) {
+    log_error("req_program_fold(): invalid source kind %d.",
+              preq->source.kind);
+    return TRI_NO;
+  }
+
+  switch (preq->source.kind) {
+  case VUT_NONE:
+    return TRI_YES;
+  case VUT_MINYEAR:
+  case VUT_MINCALFRAG:
+  case VUT_TOPO:
+    /* Whatever the range, only the game calendar or the map topology
+     * are looked at. */
+    if (world_key < 0) {
+      return TRI_MAYBE;
+    }
+    *world = TRUE;
+    return req_definitions[preq->source.kind].cb(req_context_empty(),
+                                                 NULL, preq);
+  default:
+    return TRI_MAYBE;
+  }
+}
+
+/**********************************************************************//**
+  Initialize an empty, dirty, requirement program.
+**************************************************************************/
+void req_program_init(struct req_program *prog)
+{
+  fc_atomic_init(REQ_PROG_STATE(prog), REQ_PROG_DIRTY);
+  prog->never = FALSE;
+  prog->steps_num = 0;
+  prog->steps = NULL;
+}
+
+/**********************************************************************//**
+  Compile the requirement vector to the program, replacing whatever
+  the program had before. Returns the state of the compiled program.
+  The caller must have marked the program as being compiled.
+**************************************************************************/
+static int req_program_compile(struct req_program *prog,
+                               const struct requirement_vector *reqs)
+{
+  int world_key = req_program_world_key();
+  bool world = FALSE;
+  int i;
+
+  free(prog->steps);
+  prog->steps = NULL;
+  prog->steps_num = 0;
+  prog->never = FALSE;
+
+  if (requirement_vector_size(reqs) > 0) {
+    prog->steps = fc_malloc(requirement_vector_size(reqs)
+                            * sizeof(*prog->steps));
+  }
+
+  requirement_vector_iterate(reqs, preq) {
+    enum fc_tristate folded = req_program_fold(preq, world_key, &world);
+    struct req_program_step step;
+
+    if (folded != TRI_MAYBE) {
+      /* A requirement which is not met never will be for any target, and
+       * one which is doesn't need to be looked at again. */
+      if (preq->present ? folded == TRI_NO : folded == TRI_YES) {
+        prog->never = TRUE;
+      }
+      continue;
+    }
+
+    step.cb = req_definitions[preq->source.kind].cb;
+    step.req = *preq;
+    step.cost = req_eval_cost(preq);
+
+    /* Insertion sort, keeping the ruleset order for equal costs. */
+    for (i = prog->steps_num;
+         i > 0 && prog->steps[i - 1].cost > step.cost; i--) {
+      prog->steps[i] = prog->steps[i - 1];
+    }
+    prog->steps[i] = step;
+    prog->steps_num++;
+  } requirement_vector_iterate_end;
+
+  if (world) {
+    return (world_key << REQ_PROG_STATE_BITS) | REQ_PROG_FOLDED;
+  }
+
+  return REQ_PROG_COMPILED;
+}
+
+/**********************************************************************//**
+  Can a program in the given state be evaluated as it is?
+**************************************************************************/
+static inline bool req_program_valid(int state)
+{
+  switch (state & ((1 << REQ_PROG_STATE_BITS) - 1)) {
+  case REQ_PROG_COMPILED:
+    return TRUE;
+  case REQ_PROG_FOLDED:
+    return state >> REQ_PROG_STATE_BITS == req_program_world_key();
+  default:
+    return FALSE;
+  }
+}
+
+/**********************************************************************//**
+  Mark the requirement program dirty, after its vector changed, so that
+  it gets compiled again. Must not be called while other threads may be
+  evaluating it.
+**************************************************************************/
+void req_program_invalidate(struct req_program *prog)
+{
+  free(prog->steps);
+  req_program_init(prog);
+}
+
+/**********************************************************************//**
+  Free the steps of the requirement program, and mark it dirty.
+**************************************************************************/
+void req_program_free(struct req_program *prog)
+{
+  req_program_invalidate(prog);
+}
+
+/**********************************************************************//**
+  Same as are_reqs_active() for the requirement vector 'reqs', but using
+  its compiled program 'prog'. The program is compiled first if it is
+  dirty, or was folded for another calendar or map topology. Meanwhile,
+  other threads evaluating it evaluate the vector itself.
+
+  The vector, the calendar and the map topology must not change while
+  other threads evaluate the program.
+**************************************************************************/
+bool are_reqs_active_prog(const struct req_context *context,
+                          const struct player *other_player,
+                          const struct requirement_vector *reqs,
+                          const struct req_program *prog,
+                          const enum   req_problem_type prob_type)
+{
+  int state = fc_atomic_load(REQ_PROG_STATE(prog));
+  int i;
+
+  if (!req_program_valid(state)) {
+    /* The program is only a cache of the vector, owned with it by
+     * something const here. */
+    struct req_program *cache = (struct req_program *)prog;
+
+    if (state == REQ_PROG_COMPILING
+        || !fc_atomic_cas(REQ_PROG_STATE(cache), &state,
+                          REQ_PROG_COMPILING)) {
+      /* Another thread is compiling it. */
+      return are_reqs_active(context, other_player, reqs, prob_type);
+    }
+    fc_atomic_store(REQ_PROG_STATE(cache),
+                    req_program_compile(cache, reqs));
+  }
+
+  if (prog->never) {
+    return FALSE;
+  }
+
+  if (context == NULL) {
+    context = req_context_empty();
+  }
+
+  for (i = 0; i < prog->steps_num; i++) {
+    const struct req_program_step *step = &prog->steps[i];
+    enum fc_tristate eval = step->cb(context, other_player, &step->req);
+
+    if (eval == TRI_MAYBE) {
+      if (prob_type != RPT_POSSIBLE) {
+        return FALSE;
+      }
+    } else if (step->req.present ? eval == TRI_NO : eval == TRI_YES) {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
 /**********************************************************************//**
   For requirements changing with time, will they be active for the target
   after pass in period turns if nothing else changes?
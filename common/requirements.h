@@ -110,6 +110,21 @@ struct req_context {
   const enum unit_activity activity;
 };
 
+/* A requirement vector compiled for faster evaluation with
+ * are_reqs_active_prog(). The requirements are copied in the order they
+ * are cheapest to evaluate and most likely to fail in, with those of a
+ * constant value folded away. The program is compiled by its first
+ * evaluation. Whoever changes the vector must then mark the program
+ * dirty with req_program_invalidate(). */
+struct req_program_step;
+struct req_program {
+  int state;            /* Dirty, being compiled or compiled. Only
+                         * accessed atomically, in requirements.c */
+  bool never;           /* Never active, whatever the target */
+  int steps_num;
+  struct req_program_step *steps;
+};
+
 enum req_unchanging_status {
   REQUCH_NO = 0, /* Changes regulary */
   REQUCH_CTRL, /* Can't be changed by game means as long as target player
@@ -177,6 +192,14 @@ bool are_reqs_active_ranges(const enum req_range min_range,
                             const struct player *other_player,
                             const struct requirement_vector *reqs,
                             const enum   req_problem_type prob_type);
+void req_program_init(struct req_program *prog);
+void req_program_invalidate(struct req_program *prog);
+void req_program_free(struct req_program *prog);
+bool are_reqs_active_prog(const struct req_context *context,
+                          const struct player *other_player,
+                          const struct requirement_vector *reqs,
+                          const struct req_program *prog,
+                          const enum   req_problem_type prob_type);
 enum fc_tristate
 tri_req_active_turns(int pass, int period,
                      const struct req_context *context,
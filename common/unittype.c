@@ -2822,6 +2822,21 @@ void set_unit_class_caches(struct unit_class *pclass)
     }
   } extra_type_iterate_end;
 
+  /* Moves from or to non-native tiles cost SINGLE_MOVE. Tiles may be
+   * native because of extras, so consider all terrains. */
+  pclass->cache.min_move_cost = SINGLE_MOVE;
+  if (uclass_has_flag(pclass, UCF_TERRAIN_SPEED)) {
+    terrain_type_iterate(pterrain) {
+      pclass->cache.min_move_cost = MIN(pclass->cache.min_move_cost,
+                                        pterrain->movement_cost
+                                        * SINGLE_MOVE);
+    } terrain_type_iterate_end;
+    extra_type_list_iterate(pclass->cache.bonus_roads, pextra) {
+      pclass->cache.min_move_cost = MIN(pclass->cache.min_move_cost,
+                                        extra_road_get(pextra)->move_cost);
+    } extra_type_list_iterate_end;
+  }
+
   unit_class_iterate(pcharge) {
     bool subset_mover = TRUE;
 
@@ -159,6 +159,7 @@ struct unit_class {
     struct extra_type_list *native_bases;
     struct extra_type_list *bonus_roads;
     struct unit_class_list *subset_movers;
+    int min_move_cost;    /* Lowest cost of a single move. */
   } cache;
 };
 
@@ -49,3 +49,32 @@ static void func(void)
     AC_DEFINE([HAVE_AT_QUICK_EXIT], [1], [C11 at_quick_exit() available])
   fi
 ])
+
+# Check for C11 atomics
+#
+AC_DEFUN([FC_C11_ATOMICS],
+[
+  AC_CACHE_CHECK([for C11 atomics], [ac_cv_c11_atomics],
+    [AC_LINK_IFELSE([AC_LANG_PROGRAM([[#include <stdatomic.h>
+static atomic_ulong counter;
+]], [[ atomic_fetch_add_explicit(&counter, 1, memory_order_relaxed);
+  return atomic_load_explicit(&counter, memory_order_acquire) != 1; ]])],
+[ac_cv_c11_atomics=yes], [ac_cv_c11_atomics=no])])
+  if test "x${ac_cv_c11_atomics}" = "xyes" ; then
+    AC_DEFINE([FREECIV_HAVE_C11_ATOMICS], [1], [C11 atomics available])
+  fi
+])
+
+# Check for C11 thread local storage
+#
+AC_DEFUN([FC_C11_THREAD_LOCAL],
+[
+  AC_CACHE_CHECK([for C11 thread local storage], [ac_cv_c11_thread_local],
+    [AC_LINK_IFELSE([AC_LANG_PROGRAM([[static _Thread_local int var;
+]], [[ var = 1; return var != 1; ]])],
+[ac_cv_c11_thread_local=yes], [ac_cv_c11_thread_local=no])])
+  if test "x${ac_cv_c11_thread_local}" = "xyes" ; then
+    AC_DEFINE([FREECIV_HAVE_C11_THREAD_LOCAL], [1],
+              [C11 thread local storage available])
+  fi
+])
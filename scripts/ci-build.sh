@@ -193,6 +193,7 @@ cd build
  --enable-fcmp=cli,gtk3,qt,gtk4 \
  --enable-fcdb=sqlite3,mysql,postgres,odbc \
  --enable-freeciv-manual \
+ --enable-freeciv-bench \
  --enable-ruledit=experimental \
  --enable-ai-static=classic,tex,stub \
  --prefix=${HOME}/freeciv/default \
@@ -223,6 +224,10 @@ echo "Checking ruleset upgrade"
 echo "Checking ruleset auto help generation"
 ./tests/rulesets_autohelp.sh
 
+# Check the optimized code paths against the plain ones
+echo "Checking optimized code paths"
+./tests/bench_verify.sh
+
 echo "Running Freeciv server autogame"
 cd ${HOME}/freeciv/default/bin/
 ./freeciv-server --Announce none -e -F --read ${basedir}/scripts/test-autogame.serv
@@ -20,12 +20,17 @@
 #endif
 
 /* utility */
+#include "fcthreadpool.h"
 #include "support.h"
 
 /* common */
 #include "ai.h"
+#include "game.h"
 #include "player.h"
 
+/* server */
+#include "plrhand.h"
+
 /* server/advisors */
 #include "autosettlers.h"
 
@@ -34,6 +39,8 @@
 
 #include "aiiface.h"
 
+static struct fc_threadpool *planning_pool = NULL;
+
 #ifdef AI_MOD_STATIC_THREADED
 bool fc_ai_threaded_setup(struct ai_type *ai);
 #endif
@@ -260,6 +267,63 @@ void call_ai_refresh(void)
   } players_iterate_end;
 }
 
+/**********************************************************************//**
+  Thread pool job: call the phase_planning() callback of one player.
+**************************************************************************/
+static void ai_phase_planning_job(void *data, int index)
+{
+  struct player *pplayer = ((struct player **) data)[index];
+
+  /* Not CALL_PLR_AI_FUNC(): the AI timers are not thread safe. */
+  pplayer->ai->funcs.phase_planning(pplayer);
+}
+
+/**********************************************************************//**
+  Call ai phase_planning() callback for all AI players of the phase. It is
+  called for several players at once, when the 'aithreads' setting allows
+  it.
+**************************************************************************/
+void call_ai_phase_planning(void)
+{
+  struct player *planners[MAX_NUM_PLAYER_SLOTS];
+  int planners_num = 0;
+  int threads = game.server.ai_threads;
+
+  phase_players_iterate(pplayer) {
+    if (is_ai(pplayer) && pplayer->ai->funcs.phase_planning != NULL) {
+      planners[planners_num++] = pplayer;
+    }
+  } phase_players_iterate_end;
+
+#ifdef FREECIV_DEBUG
+  /* The AI code logs its timings in this mode, which is not thread safe. */
+  threads = 1;
+#endif /* FREECIV_DEBUG */
+
+  if (planning_pool != NULL
+      && fc_threadpool_threads(planning_pool) != threads - 1) {
+    ai_phase_planning_free();
+  }
+  if (planning_pool == NULL && threads > 1) {
+    /* The calling thread is one of the 'threads'. */
+    planning_pool = fc_threadpool_new(threads - 1);
+  }
+
+  fc_threadpool_run(planning_pool, ai_phase_planning_job,
+                    planners, planners_num);
+}
+
+/**********************************************************************//**
+  Stop the threads used by call_ai_phase_planning().
+**************************************************************************/
+void ai_phase_planning_free(void)
+{
+  if (planning_pool != NULL) {
+    fc_threadpool_destroy(planning_pool);
+    planning_pool = NULL;
+  }
+}
+
 /**********************************************************************//**
   Return name of default ai type.
 **************************************************************************/
@@ -25,6 +25,8 @@ void call_incident(enum incident_type type, enum casus_belli_range scope,
                    const struct action *paction,
                    struct player *violator, struct player *victim);
 void call_ai_refresh(void);
+void call_ai_phase_planning(void);
+void ai_phase_planning_free(void);
 
 bool set_default_ai_type_name(const char *name);
 
@@ -35,6 +35,7 @@
 #include "city.h"
 #include "counters.h"
 #include "culture.h"
+#include "effects.h"
 #include "events.h"
 #include "game.h"
 #include "government.h"
@@ -56,6 +57,7 @@
 
 /* common/aicore */
 #include "cm.h"
+#include "path_finding.h"
 
 /* common/scriptcore */
 #include "luascript_types.h"
@@ -1181,6 +1183,7 @@ bool transfer_city(struct player *ptaker, struct city *pcity,
 
   pcity->owner = ptaker;
   pcity->capital = CAPITAL_NOT;
+  pf_map_cache_invalidate();
   map_claim_ownership(pcenter, ptaker, pcenter, TRUE);
   city_list_prepend(ptaker->cities, pcity);
 
@@ -1546,6 +1549,7 @@ void create_city(struct player *pplayer, struct tile *ptile,
    * It is possible to build a city on a tile that is already worked;
    * this will displace the worker on the newly-built city's tile -- Syela */
   tile_set_worked(ptile, pcity); /* instead of city_map_update_worker() */
+  pf_map_cache_invalidate();
 
   if (NULL != pwork) {
     /* was previously worked by another city */
@@ -1873,6 +1877,7 @@ void remove_city(struct city *pcity)
   fc_mutex_allocate(&game.server.mutexes.city_list);
   game_remove_city(&wld, pcity);
   fc_mutex_release(&game.server.mutexes.city_list);
+  pf_map_cache_invalidate();
 
   /* Remove any extras that were only there because the city was there. */
   extra_type_iterate(pextra) {
@@ -3623,6 +3628,118 @@ void city_add_improvement_with_gov_notice(struct city *pcity,
   }
 }
 
+/************************************************************************//**
+  Refresh and send the cities whose effects may have changed when a source
+  held by 'pplayer' changed, and the effects requiring the source reach
+  'range' from it: the cities of the players within that range, and the
+  trade route partners of the changed cities, since route values depend
+  on the cities at both ends.
+
+  The caller has already refreshed the cities the source itself belongs
+  to: 'pcity' if not NULL, else all the cities of 'pplayer'.
+****************************************************************************/
+void city_refresh_effects_range(const struct player *pplayer,
+                                const struct city *pcity,
+                                enum req_range range)
+{
+  bool changed[player_slot_count()];
+  bool refreshed[player_slot_count()];
+
+  players_iterate(aplayer) {
+    int i = player_index(aplayer);
+
+    refreshed[i] = (pcity == NULL && aplayer == pplayer);
+    changed[i] = (range >= REQ_RANGE_WORLD
+                  || (range >= REQ_RANGE_CONTINENT && aplayer == pplayer)
+                  || (range >= REQ_RANGE_TEAM
+                      && players_on_same_team(pplayer, aplayer))
+                  || (range >= REQ_RANGE_ALLIANCE
+                      && pplayers_allied(pplayer, aplayer)));
+  } players_iterate_end;
+
+  players_iterate(aplayer) {
+    int i = player_index(aplayer);
+
+    conn_list_do_buffer(aplayer->connections);
+    city_list_iterate(aplayer->cities, acity) {
+      bool refresh = changed[i];
+
+      if (acity == pcity || refreshed[i]) {
+        continue;
+      }
+
+      if (!refresh) {
+        trade_partners_iterate(acity, partner) {
+          if (partner == pcity
+              || changed[player_index(city_owner(partner))]
+              || refreshed[player_index(city_owner(partner))]) {
+            refresh = TRUE;
+            break;
+          }
+        } trade_partners_iterate_end;
+      }
+
+      if (refresh) {
+        if (city_refresh(acity)) {
+          auto_arrange_workers(acity);
+        }
+        send_city_info(aplayer, acity);
+      }
+    } city_list_iterate_end;
+    conn_list_do_unbuffer(aplayer->connections);
+  } players_iterate_end;
+}
+
+/************************************************************************//**
+  Refresh and send the cities other than 'pcity' whose effects may have
+  changed when the building was added to 'pcity': through the effects
+  requiring it, or its genus or flags, through the effects of the
+  buildings it may make obsolete, or through the distance to the
+  government centers.
+****************************************************************************/
+void city_refresh_building_effects_range(const struct city *pcity,
+                                         const struct impr_type *pimprove)
+{
+  const struct universal source = {
+    .kind = VUT_IMPROVEMENT,
+    .value.building = pimprove
+  };
+  const enum universals_n impr_kinds[] = { VUT_IMPR_GENUS, VUT_IMPR_FLAG };
+  enum req_range range = get_req_source_effects_range(&source);
+  int i;
+
+  for (i = 0; i < ARRAY_SIZE(impr_kinds); i++) {
+    range = MAX(range, get_req_source_effects_range(
+                         &(const struct universal) {
+                           .kind = impr_kinds[i]
+                         }));
+  }
+
+  improvement_iterate(pobsolete) {
+    requirement_vector_iterate(&pobsolete->obsolete_by, pobs) {
+      if (are_universals_equal(&pobs->source, &source)) {
+        range = MAX(range, get_req_source_effects_range(
+                             &(const struct universal) {
+                               .kind = VUT_IMPROVEMENT,
+                               .value.building = pobsolete
+                             }));
+        break;
+      }
+    } requirement_vector_iterate_end;
+  } improvement_iterate_end;
+
+  /* The waste of the other cities of the owner depends on their distance
+   * to the nearest government center. */
+  effect_list_iterate(get_req_source_effects(&source), peffect) {
+    if (peffect->type == EFT_GOV_CENTER) {
+      range = MAX(range, REQ_RANGE_PLAYER);
+      break;
+    }
+  } effect_list_iterate_end;
+
+  city_refresh_effects_range(city_owner(pcity), pcity, range);
+}
+
 /************************************************************************//**
   Return city's original owner id, as known by specified player.
   NULL known_for is expected to mean global observer.
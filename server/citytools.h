@@ -131,6 +131,11 @@ int city_production_buy_gold_cost(const struct city *pcity);
 void city_add_improvement_with_gov_notice(struct city *pcity,
                                           const struct impr_type *pimprove,
                                           const char *format);
+void city_refresh_effects_range(const struct player *pplayer,
+                                const struct city *pcity,
+                                enum req_range range);
+void city_refresh_building_effects_range(const struct city *pcity,
+                                         const struct impr_type *pimprove);
 
 int city_original_owner(const struct city *pcity,
                         const struct player *known_for);
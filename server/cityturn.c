@@ -15,6 +15,7 @@
 #include <fc_config.h>
 #endif
 
+#include <limits.h> /* INT_MAX */
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -22,6 +23,7 @@
 
 /* utility */
 #include "fcintl.h"
+#include "fcthreadpool.h"
 #include "log.h"
 #include "mem.h"
 #include "rand.h"
@@ -81,6 +83,20 @@
 /* server/scripting */
 #include "script_server.h"
 
+/* Threads for auto_arrange_workers_list() */
+static struct fc_threadpool *cm_pool = NULL;
+
+/* The claims of the cities of the batches of auto_arrange_workers_list()
+ * on the tiles of their city maps, by tile index. A claim only holds
+ * if it has the number of the current batch, so that starting a batch
+ * doesn't need to clear them. */
+static struct arrange_claim {
+  const struct city *pcity;
+  int batch;
+} *arrange_claims = NULL;
+static int arrange_claims_size = 0;
+static int arrange_batch = 0;
+
 /* Queue for pending city_refresh() */
 static struct city_list *city_refresh_queue = NULL;
 
@@ -348,26 +364,26 @@ static void set_default_city_manager(struct cm_parameter *cmp,
 }
 
 /**********************************************************************//**
-  Call sync_cities() to send the affected cities to the clients.
+  First step of the arrangement of the workers of a city: update the city
+  and set up the parameter of the query. The query is done with 'cmp'
+  unless the city has its own parameter. Returns FALSE if the workers
+  are frozen, and the arrangement must wait.
 **************************************************************************/
-void auto_arrange_workers(struct city *pcity)
+static bool arrange_workers_begin(struct city *pcity,
+                                  struct cm_parameter *cmp,
+                                  bool *broadcast_needed)
 {
-  struct cm_parameter cmp;
-  struct cm_parameter *pcmp;
-  struct cm_result *cmr;
-  bool broadcast_needed;
-
   /* See comment in freeze_workers(): we can't rearrange while
    * workers are frozen (i.e. multiple updates need to be done). */
   if (pcity->server.workers_frozen > 0) {
     if (pcity->server.needs_arrange == CNA_NOT) {
       pcity->server.needs_arrange = CNA_NORMAL;
     }
-    return;
+    return FALSE;
   }
   TIMING_LOG(AIT_CITIZEN_ARRANGE, TIMER_START);
 
-  broadcast_needed = (pcity->server.needs_arrange == CNA_BROADCAST_PENDING);
+  *broadcast_needed = (pcity->server.needs_arrange == CNA_BROADCAST_PENDING);
 
   /* Freeze the workers and make sure all the tiles around the city
    * are up to date. Then thaw, but hackishly make sure that thaw
@@ -386,18 +402,24 @@ void auto_arrange_workers(struct city *pcity)
   sanity_check_city(pcity);
   cm_clear_cache(pcity);
 
-  if (pcity->cm_parameter) {
-    pcmp = pcity->cm_parameter;
-  } else {
-    pcmp = &cmp;
-    cm_init_parameter(pcmp);
-    set_default_city_manager(pcmp, pcity);
-  }
+  cm_init_parameter(cmp);
+  set_default_city_manager(cmp, pcity);
 
-  /* This must be after city_refresh() so that the result gets created for the right
-   * city radius */
-  cmr = cm_result_new(pcity);
-  cm_query_result(pcity, pcmp, cmr, FALSE);
+  return TRUE;
+}
+
+/**********************************************************************//**
+  Last step of the arrangement of the workers of a city, once the query
+  with the parameter of the city has been done: get some result anyway,
+  and apply it. Call sync_cities() to send the affected cities to the
+  clients.
+**************************************************************************/
+static void arrange_workers_end(struct city *pcity, struct cm_parameter *cmp,
+                                struct cm_result *cmr,
+                                bool broadcast_needed)
+{
+  struct cm_parameter *pcmp = (pcity->cm_parameter != NULL
+                               ? pcity->cm_parameter : cmp);
 
   if (!cmr->found_a_valid) {
     if (pcity->cm_parameter) {
@@ -412,17 +434,15 @@ void auto_arrange_workers(struct city *pcity)
                     city_link(pcity));
 
       /* Switch to default parameters, and try with them */
-      pcmp = &cmp;
-      cm_init_parameter(pcmp);
-      set_default_city_manager(pcmp, pcity);
+      pcmp = cmp;
       cm_query_result(pcity, pcmp, cmr, FALSE);
     }
 
     if (!cmr->found_a_valid) {
       /* Drop surpluses and try again. */
-      cmp.minimal_surplus[O_FOOD] = 0;
-      cmp.minimal_surplus[O_SHIELD] = 0;
-      cmp.minimal_surplus[O_GOLD] = -FC_INFINITY;
+      cmp->minimal_surplus[O_FOOD] = 0;
+      cmp->minimal_surplus[O_SHIELD] = 0;
+      cmp->minimal_surplus[O_GOLD] = -FC_INFINITY;
       cm_query_result(pcity, pcmp, cmr, FALSE);
     }
   }
@@ -431,16 +451,16 @@ void auto_arrange_workers(struct city *pcity)
      * cm_init_emergency_parameter so we can keep the factors from
      * above. */
     output_type_iterate(o) {
-      cmp.minimal_surplus[o] = MIN(cmp.minimal_surplus[o],
-				   MIN(pcity->surplus[o], 0));
+      cmp->minimal_surplus[o] = MIN(cmp->minimal_surplus[o],
+                                    MIN(pcity->surplus[o], 0));
     } output_type_iterate_end;
-    cmp.require_happy = FALSE;
-    cmp.allow_disorder = is_ai(city_owner(pcity)) ? FALSE : TRUE;
+    cmp->require_happy = FALSE;
+    cmp->allow_disorder = is_ai(city_owner(pcity)) ? FALSE : TRUE;
     cm_query_result(pcity, pcmp, cmr, FALSE);
   }
   if (!cmr->found_a_valid) {
     CITY_LOG(LOG_DEBUG, pcity, "emergency management");
-    pcmp = &cmp;
+    pcmp = cmp;
     cm_init_emergency_parameter(pcmp);
     cm_query_result(pcity, pcmp, cmr, TRUE);
   }
@@ -466,10 +486,234 @@ void auto_arrange_workers(struct city *pcity)
     broadcast_city_info(pcity);
   }
 
-  cm_result_destroy(cmr);
   TIMING_LOG(AIT_CITIZEN_ARRANGE, TIMER_STOP);
 }
 
+/**********************************************************************//**
+  Call sync_cities() to send the affected cities to the clients.
+**************************************************************************/
+void auto_arrange_workers(struct city *pcity)
+{
+  struct cm_parameter cmp;
+  struct cm_result *cmr;
+  bool broadcast_needed;
+
+  if (!arrange_workers_begin(pcity, &cmp, &broadcast_needed)) {
+    return;
+  }
+
+  /* This must be after city_refresh() so that the result gets created for the right
+   * city radius */
+  cmr = cm_result_new(pcity);
+  cm_query_result(pcity, pcity->cm_parameter != NULL
+                         ? pcity->cm_parameter : &cmp, cmr, FALSE);
+
+  arrange_workers_end(pcity, &cmp, cmr, broadcast_needed);
+  cm_result_destroy(cmr);
+}
+
+/* A city of a batch of auto_arrange_workers_list(). */
+struct arrange_job {
+  struct city *pcity;
+  struct cm_parameter cmp;
+  struct cm_result *cmr;
+  bool broadcast_needed;
+};
+
+/**********************************************************************//**
+  Thread pool job: do the main query of one city of the batch.
+**************************************************************************/
+static void arrange_workers_query_job(void *data, int index)
+{
+  struct arrange_job *job = (struct arrange_job *) data + index;
+
+  cm_query_result(job->pcity, job->pcity->cm_parameter != NULL
+                              ? job->pcity->cm_parameter : &job->cmp,
+                  job->cmr, FALSE);
+}
+
+/**********************************************************************//**
+  Stop the threads of auto_arrange_workers_list().
+**************************************************************************/
+static void arrange_workers_pool_free(void)
+{
+  if (NULL != cm_pool) {
+    fc_threadpool_destroy(cm_pool);
+    cm_pool = NULL;
+  }
+}
+
+/**********************************************************************//**
+  Arrange the workers of the cities of the batch: the queries are done in
+  parallel, then the results are applied in order.
+**************************************************************************/
+static void arrange_workers_batch(struct arrange_job *jobs, int jobs_num)
+{
+  int i;
+
+  if (game.server.cm_threads <= 1) {
+    arrange_workers_pool_free();
+  } else if (NULL == cm_pool
+             || fc_threadpool_threads(cm_pool) != game.server.cm_threads - 1) {
+    arrange_workers_pool_free();
+    /* The calling thread is one of the 'cm_threads'. */
+    cm_pool = fc_threadpool_new(game.server.cm_threads - 1);
+  }
+
+  fc_threadpool_run(cm_pool, arrange_workers_query_job, jobs, jobs_num);
+
+  for (i = 0; i < jobs_num; i++) {
+    arrange_workers_end(jobs[i].pcity, &jobs[i].cmp, jobs[i].cmr,
+                        jobs[i].broadcast_needed);
+    cm_result_destroy(jobs[i].cmr);
+  }
+}
+
+/**********************************************************************//**
+  Start a new batch of auto_arrange_workers_list(), without any claims.
+**************************************************************************/
+static void arrange_workers_new_batch(void)
+{
+  if (arrange_claims_size != MAP_INDEX_SIZE) {
+    free(arrange_claims);
+    arrange_claims_size = MAP_INDEX_SIZE;
+    arrange_claims = fc_calloc(arrange_claims_size,
+                               sizeof(*arrange_claims));
+    arrange_batch = 0;
+  }
+
+  if (arrange_batch == INT_MAX) {
+    /* The old numbers would come again. */
+    memset(arrange_claims, 0,
+           arrange_claims_size * sizeof(*arrange_claims));
+    arrange_batch = 0;
+  }
+  arrange_batch++;
+}
+
+/**********************************************************************//**
+  Return whether pcity claimed the tile for the current batch.
+**************************************************************************/
+static bool arrange_workers_claimed(const struct tile *ptile,
+                                    const struct city *pcity)
+{
+  const struct arrange_claim *claim = &arrange_claims[tile_index(ptile)];
+
+  return claim->batch == arrange_batch && claim->pcity == pcity;
+}
+
+/**********************************************************************//**
+  Claim the tiles of the city map of pcity for the current batch. Fails
+  if the result of the city could depend on the one of a city already in
+  the batch: when they share tiles, or have a trade route.
+**************************************************************************/
+static bool arrange_workers_claim(struct city *pcity)
+{
+  struct tile *pcenter = city_tile(pcity);
+  int radius_sq = city_map_radius_sq_get(pcity);
+
+  city_tile_iterate(radius_sq, pcenter, ptile) {
+    const struct arrange_claim *claim = &arrange_claims[tile_index(ptile)];
+
+    if (claim->batch == arrange_batch && claim->pcity != pcity) {
+      return FALSE;
+    }
+  } city_tile_iterate_end;
+
+  trade_partners_iterate(pcity, partner) {
+    if (arrange_workers_claimed(city_tile(partner), partner)) {
+      return FALSE;
+    }
+  } trade_partners_iterate_end;
+
+  city_tile_iterate(radius_sq, pcenter, ptile) {
+    struct arrange_claim *claim = &arrange_claims[tile_index(ptile)];
+
+    claim->pcity = pcity;
+    claim->batch = arrange_batch;
+  } city_tile_iterate_end;
+
+  return TRUE;
+}
+
+/**********************************************************************//**
+  Call auto_arrange_workers() for all the cities of the list, in order.
+  The results are the same, but the cities which don't depend on each
+  other are done together, in up to 'cmthreads' threads.
+**************************************************************************/
+void auto_arrange_workers_list(struct city_list *pcities)
+{
+  int size = city_list_size(pcities);
+  struct arrange_job *jobs;
+  int jobs_num = 0;
+
+  if (size <= 1) {
+    city_list_iterate(pcities, pcity) {
+      auto_arrange_workers(pcity);
+    } city_list_iterate_end;
+    return;
+  }
+
+  jobs = fc_malloc(size * sizeof(*jobs));
+  arrange_workers_new_batch();
+
+  city_list_iterate(pcities, pcity) {
+    struct arrange_job *job;
+    int radius_sq = city_map_radius_sq_get(pcity);
+
+    if (!arrange_workers_claim(pcity)) {
+      arrange_workers_batch(jobs, jobs_num);
+      jobs_num = 0;
+      arrange_workers_new_batch();
+      arrange_workers_claim(pcity);
+    }
+
+    job = &jobs[jobs_num];
+    if (!arrange_workers_begin(pcity, &job->cmp, &job->broadcast_needed)) {
+      continue;
+    }
+
+    if (radius_sq != city_map_radius_sq_get(pcity)
+        && !arrange_workers_claim(pcity)) {
+      /* The new city map overlaps another one. The city must be updated
+       * again after the previous cities are arranged. */
+      bool broadcast_needed = job->broadcast_needed;
+
+      arrange_workers_batch(jobs, jobs_num);
+      jobs_num = 0;
+      arrange_workers_new_batch();
+      arrange_workers_claim(pcity);
+
+      job = &jobs[jobs_num];
+      arrange_workers_begin(pcity, &job->cmp, &job->broadcast_needed);
+      job->broadcast_needed |= broadcast_needed;
+    }
+
+    /* This must be after city_refresh() so that the result gets created
+     * for the right city radius */
+    job->pcity = pcity;
+    job->cmr = cm_result_new(pcity);
+    jobs_num++;
+  } city_list_iterate_end;
+
+  arrange_workers_batch(jobs, jobs_num);
+
+  free(jobs);
+}
+
+/**********************************************************************//**
+  Free the threads and the tile claims of auto_arrange_workers_list().
+**************************************************************************/
+void auto_arrange_workers_free(void)
+{
+  arrange_workers_pool_free();
+
+  free(arrange_claims);
+  arrange_claims = NULL;
+  arrange_claims_size = 0;
+  arrange_batch = 0;
+}
+
 /**********************************************************************//**
   Notices about cities that should be sent to all players.
 **************************************************************************/
@@ -2512,11 +2756,13 @@ static bool city_build_building(struct player *pplayer, struct city *pcity)
   }
   if (pcity->shield_stock >= impr_build_shield_cost(pcity, pimprove)) {
     int cost;
+    int old_wonder_id = IDENTITY_NUMBER_ZERO;
 
     if (is_small_wonder(pimprove)) {
       city_list_iterate(pplayer->cities, wcity) {
 	if (city_has_building(wcity, pimprove)) {
 	  city_remove_improvement(wcity, pimprove);
+	  old_wonder_id = wcity->id;
 	  break;
 	}
       } city_list_iterate_end;
@@ -2607,10 +2853,22 @@ static bool city_build_building(struct player *pplayer, struct city *pcity)
       /* space ship part build */
       send_spaceship_info(pplayer, NULL);
     } else {
+      struct city *old_wonder_city = game_city_by_number(old_wonder_id);
+
       /* Update city data. */
       if (city_refresh(pcity)) {
         auto_arrange_workers(pcity);
       }
+
+      /* Update the city the small wonder moved from, and the cities the
+       * effects of the building reach. */
+      if (old_wonder_city != NULL) {
+        if (city_refresh(old_wonder_city)) {
+          auto_arrange_workers(old_wonder_city);
+        }
+        send_city_info(pplayer, old_wonder_city);
+      }
+      city_refresh_building_effects_range(pcity, pimprove);
     }
 
     /* Move to the next thing in the worklist */
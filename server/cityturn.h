@@ -30,6 +30,8 @@ void city_refresh_queue_add(struct city *pcity);
 void city_refresh_queue_processing(void);
 
 void auto_arrange_workers(struct city *pcity); /* will arrange the workers */
+void auto_arrange_workers_list(struct city_list *pcities);
+void auto_arrange_workers_free(void);
 void apply_cmresult_to_city(struct city *pcity, const struct cm_result *cmr);
 
 bool city_change_size(struct city *pcity, citizens new_size,
@@ -97,7 +97,8 @@ static struct command commands[] = {
              "list scenarios\n"
              "list nationsets\n"
              "list teams\n"
-             "list votes\n"),
+             "list votes\n"
+             "list caches\n"),
    N_("Show a list of various things."),
    /* TRANS: don't translate text in '' */
    N_("Show a list of:\n"
@@ -110,8 +111,9 @@ static struct command commands[] = {
       " - the available rulesets (for 'read' command),\n"
       " - the available scenarios,\n"
       " - the available nation sets in this ruleset,\n"
-      " - the teams of players or\n"
-      " - the running votes.\n"
+      " - the teams of players,\n"
+      " - the running votes or\n"
+      " - the memory used by the delta caches of connections.\n"
       "The argument may be abbreviated, and defaults to 'players' if "
       "absent."), NULL,
    CMD_ECHO_NONE, VCF_NONE, 0
@@ -210,6 +212,10 @@ static struct command commands[] = {
       "debug units <x> <y>\n"
       "debug unit <id>\n"
       "debug timing\n"
+      "debug reqs [rounds]\n"
+      "debug memo\n"
+      "debug registry\n"
+      "debug delta\n"
       "debug info"),
    N_("Turn on or off AI debugging of given entity."),
    N_("Print AI debug information about given entity and turn continuous "
@@ -148,6 +148,7 @@ void establish_new_connection(struct connection *pconn)
   sz_strlcpy(packet.challenge_file, new_challenge_filename(pconn));
   packet.conn_id = pconn->id;
   send_packet_server_join_reply(pconn, &packet);
+  conn_compression_negotiate(pconn, pconn->capability);
 
   /* "establish" the connection */
   pconn->established = TRUE;
@@ -782,6 +783,11 @@ static bool connection_attach_real(struct connection *pconn,
     break;
   }
 
+  if (conn_is_global_observer(pconn)) {
+    /* Share the delta state of the other global observers. */
+    observer_group_join(pconn);
+  }
+
   send_updated_vote_totals(NULL);
 
   return TRUE;
@@ -872,6 +878,7 @@ void connection_detach(struct connection *pconn, bool remove_unused_player)
       }
     }
   } else {
+    observer_group_leave(pconn, TRUE);
     pconn->observer = FALSE;
     restore_access_level(pconn);
     send_conn_info(pconn->self, game.est_connections);
@@ -35,6 +35,9 @@
 #include "research.h"
 #include "unit.h"
 
+/* common/aicore */
+#include "path_finding.h"
+
 /* common/scriptcore */
 #include "luascript_types.h"
 
@@ -138,6 +141,7 @@ void set_diplstate_type(struct player_diplstate *state1,
 
   state1->type = type;
   state2->type = type;
+  pf_map_cache_invalidate();
   state1->max_state = max;
   state2->max_state = max;
 }
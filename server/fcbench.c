@@ -0,0 +1,513 @@
+/***********************************************************************
+ Freeciv - Copyright (C) 1996 - A Kjeldberg, L Gregersen, P Unold
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2, or (at your option)
+   any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+***********************************************************************/
+
+/**********************************************************************
+  freeciv-bench: plays a number of turns of an all-AI game, either
+  loaded from a savegame or generated from a fixed seed, without any
+  client, then reports the turn throughput, the time spent in the
+  phases of the turn, the peak memory use and a checksum of the final
+  game state. Given the checksum of a previous run, it fails if the
+  game took another course, so that a change can be shown to make the
+  server faster without altering the outcome of the game. With --verify,
+  it also makes the turn autosaves, as deltas between checkpoints, and
+  checks on the final game state that the optimized code paths of the
+  server give the same results as the plain ones.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <fc_config.h>
+#endif
+
+#include "fc_prehdrs.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HAVE_SYS_RESOURCE_H
+#include <sys/resource.h>
+#endif
+
+/* utility */
+#include "fc_cmdline.h"
+#include "fciconv.h"
+#include "fcintl.h"
+#include "log.h"
+#include "rand.h"
+#include "shared.h"
+#include "support.h"
+
+/* common */
+#include "capstr.h"
+#include "city.h"
+#include "fc_cmdhelp.h"
+#include "game.h"
+#include "government.h"
+#include "map.h"
+#include "player.h"
+#include "research.h"
+#include "unit.h"
+#include "unitlist.h"
+#include "version.h"
+
+/* server */
+#include "aiiface.h"
+#include "console.h"
+#include "sernet.h"
+#include "srv_main.h"
+#include "srv_prof.h"
+#include "stdinhand.h"
+
+#define BENCH_DEFAULT_TURNS     50
+#define BENCH_DEFAULT_SEED      1
+#define BENCH_DEFAULT_AIFILL    5
+#define BENCH_DEFAULT_SIZE      4
+#define BENCH_DEFAULT_LEVEL     "hard"
+#define BENCH_DEFAULT_PROFFILE  "freeciv-bench-prof.csv"
+
+static struct {
+  int turns;
+  int seed;
+  int aifill;
+  int size;
+  char *level;
+  char *proffile;
+  bool check;
+  unsigned int checksum;
+  bool verify;
+} bench = {
+  BENCH_DEFAULT_TURNS, BENCH_DEFAULT_SEED, BENCH_DEFAULT_AIFILL,
+  BENCH_DEFAULT_SIZE, NULL, NULL, FALSE, 0, FALSE
+};
+
+/**********************************************************************//**
+  Run a server command, as if typed at the console.
+**************************************************************************/
+static void bench_command(const char *format, ...)
+                          fc__attribute((__format__ (__printf__, 1, 2)));
+static void bench_command(const char *format, ...)
+{
+  char buf[MAX_LEN_CONSOLE_LINE];
+  va_list args;
+
+  va_start(args, format);
+  fc_vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+
+  if (!handle_stdin_input(NULL, buf)) {
+    log_fatal(_("Benchmark command \"%s\" failed."), buf);
+    exit(EXIT_FAILURE);
+  }
+}
+
+/**********************************************************************//**
+  Set up the game to be benchmarked, and start it. Called by the server
+  once the savegame and the startup script have been loaded.
+**************************************************************************/
+static void bench_pregame(void)
+{
+  if (!game_was_started()) {
+    bench_command("set gameseed %d", bench.seed);
+    bench_command("set mapseed %d", bench.seed);
+    bench_command("set mapsize FULLSIZE");
+    bench_command("set size %d", bench.size);
+    bench_command("set minplayers 0");
+    bench_command("set aifill %d", bench.aifill);
+    bench_command("%s", bench.level);
+  }
+
+  /* Nobody will connect to play the human players. */
+  players_iterate(pplayer) {
+    if (is_human(pplayer)) {
+      toggle_ai_player_direct(NULL, pplayer);
+    }
+  } players_iterate_end;
+
+  bench_command("set timeout -1");
+  if (bench.verify) {
+    /* Turn autosaves written as deltas, for "debug delta" to check. */
+    bench_command("set autosaves TURN");
+    bench_command("set checkpointturns 10");
+  } else {
+    bench_command("set autosaves \"\"");
+  }
+  bench_command("set endturn %d",
+                MAX(game.info.turn, 1) + bench.turns - 1);
+  bench_command("set proffile \"%s\"", bench.proffile);
+  bench_command("set proflog CSV");
+  bench_command("start");
+}
+
+/**********************************************************************//**
+  Mix 'value' into the FNV-1a hash 'hash'.
+**************************************************************************/
+static unsigned int bench_hash(unsigned int hash, const void *value,
+                               size_t size)
+{
+  const unsigned char *byte = value;
+  size_t i;
+
+  for (i = 0; i < size; i++) {
+    hash = (hash ^ byte[i]) * 16777619U;
+  }
+
+  return hash;
+}
+
+/**********************************************************************//**
+  Mix an integer into the hash 'hash', the same way whatever the byte
+  order of the machine.
+**************************************************************************/
+static unsigned int bench_hash_int(unsigned int hash, int value)
+{
+  unsigned char bytes[4];
+
+  bytes[0] = value & 0xff;
+  bytes[1] = (value >> 8) & 0xff;
+  bytes[2] = (value >> 16) & 0xff;
+  bytes[3] = (value >> 24) & 0xff;
+
+  return bench_hash(hash, bytes, sizeof(bytes));
+}
+
+/**********************************************************************//**
+  Return a checksum of the game state: the random number generator, the
+  map, the players, their cities and their units. Two runs which took
+  the same course have the same checksum.
+**************************************************************************/
+static unsigned int bench_state_checksum(void)
+{
+  unsigned int hash = 2166136261U;
+  RANDOM_STATE rstate = fc_rand_state();
+  int i;
+
+  hash = bench_hash_int(hash, game.info.turn);
+  hash = bench_hash_int(hash, game.info.year);
+  for (i = 0; i < ARRAY_SIZE(rstate.v); i++) {
+    hash = bench_hash_int(hash, rstate.v[i]);
+  }
+  hash = bench_hash_int(hash, rstate.j);
+  hash = bench_hash_int(hash, rstate.k);
+  hash = bench_hash_int(hash, rstate.x);
+
+  whole_map_iterate(&(wld.map), ptile) {
+    const struct player *owner = tile_owner(ptile);
+    const struct city *worked = tile_worked(ptile);
+
+    hash = bench_hash_int(hash, terrain_number(tile_terrain(ptile)));
+    hash = bench_hash(hash, ptile->extras.vec, sizeof(ptile->extras.vec));
+    hash = bench_hash_int(hash, owner != NULL ? player_number(owner) : -1);
+    hash = bench_hash_int(hash, worked != NULL ? worked->id : 0);
+  } whole_map_iterate_end;
+
+  players_iterate(pplayer) {
+    const struct research *presearch = research_get(pplayer);
+
+    hash = bench_hash_int(hash, player_number(pplayer));
+    hash = bench_hash_int(hash, pplayer->is_alive);
+    hash = bench_hash_int(hash, pplayer->economic.gold);
+    hash = bench_hash_int(hash, pplayer->score.game);
+    hash = bench_hash_int(hash,
+                          government_number(government_of_player(pplayer)));
+    hash = bench_hash_int(hash, presearch->techs_researched);
+    hash = bench_hash_int(hash, presearch->researching);
+    hash = bench_hash_int(hash, presearch->bulbs_researched);
+
+    city_list_iterate(pplayer->cities, pcity) {
+      hash = bench_hash_int(hash, pcity->id);
+      hash = bench_hash_int(hash, tile_index(city_tile(pcity)));
+      hash = bench_hash_int(hash, city_size_get(pcity));
+      hash = bench_hash_int(hash, pcity->food_stock);
+      hash = bench_hash_int(hash, pcity->shield_stock);
+      hash = bench_hash_int(hash, pcity->production.kind);
+      hash = bench_hash_int(hash, universal_number(&pcity->production));
+      city_built_iterate(pcity, pimprove) {
+        hash = bench_hash_int(hash, improvement_number(pimprove));
+      } city_built_iterate_end;
+    } city_list_iterate_end;
+
+    unit_list_iterate(pplayer->units, punit) {
+      hash = bench_hash_int(hash, punit->id);
+      hash = bench_hash_int(hash, utype_number(unit_type_get(punit)));
+      hash = bench_hash_int(hash, tile_index(unit_tile(punit)));
+      hash = bench_hash_int(hash, punit->hp);
+      hash = bench_hash_int(hash, punit->moves_left);
+      hash = bench_hash_int(hash, punit->veteran);
+      hash = bench_hash_int(hash, punit->activity);
+    } unit_list_iterate_end;
+  } players_iterate_end;
+
+  return hash;
+}
+
+/**********************************************************************//**
+  Return the peak resident set size of the process in kilobytes, or -1
+  if it is unknown.
+**************************************************************************/
+static long bench_peak_rss(void)
+{
+#if defined(HAVE_GETRUSAGE) && defined(HAVE_SYS_RESOURCE_H)
+  struct rusage usage;
+
+  if (0 == getrusage(RUSAGE_SELF, &usage)) {
+#ifdef __APPLE__
+    /* In bytes there. */
+    return usage.ru_maxrss / 1024;
+#else  /* __APPLE__ */
+    return usage.ru_maxrss;
+#endif /* __APPLE__ */
+  }
+#endif /* HAVE_GETRUSAGE && HAVE_SYS_RESOURCE_H */
+
+  return -1;
+}
+
+/**********************************************************************//**
+  Check that the optimized code paths of the server give the same
+  results as the plain ones on the final game state. Exits with a
+  failure if any doesn't.
+**************************************************************************/
+static void bench_verify(void)
+{
+  fc_fprintf(stdout, "\n");
+  fflush(stdout);
+
+  bench_command("debug reqs 1");
+  bench_command("debug memo");
+  bench_command("debug registry");
+  bench_command("debug delta");
+
+  fc_fprintf(stdout, "All the verifications passed.\n");
+}
+
+/**********************************************************************//**
+  Report the results of the benchmark. Called by the server when the
+  game is over, before it is freed. Exits with a failure if the
+  checksum doesn't match the expected one, or if a verification fails.
+**************************************************************************/
+static void bench_game_over(void)
+{
+  const struct srv_prof_record *turns = srv_prof_turn_total();
+  unsigned int checksum = bench_state_checksum();
+  long peak_rss = bench_peak_rss();
+  int phase;
+
+  fc_fprintf(stdout, "\n%s\n", freeciv_name_version());
+  fc_fprintf(stdout, "Turns played:     %d\n", turns->calls);
+  fc_fprintf(stdout, "Wall clock time:  %.3f s\n", turns->wall);
+  fc_fprintf(stdout, "CPU time:         %.3f s\n", turns->cpu);
+  if (turns->wall > 0.0) {
+    fc_fprintf(stdout, "Turns per second: %.3f\n",
+               turns->calls / turns->wall);
+  }
+  if (peak_rss >= 0) {
+    fc_fprintf(stdout, "Peak RSS:         %ld kB\n", peak_rss);
+  }
+
+  fc_fprintf(stdout, "\n%-24s %8s %12s %12s %14s\n",
+             "Phase", "Calls", "Wall (s)", "CPU (s)", "Allocations");
+  for (phase = 0; phase < SRV_PROF_COUNT; phase++) {
+    const struct srv_prof_record *total = srv_prof_phase_total(phase);
+
+    fc_fprintf(stdout, "%-24s %8d %12.3f %12.3f %14lu\n",
+               srv_prof_phase_name(phase), total->calls, total->wall,
+               total->cpu, total->allocations);
+  }
+  fc_fprintf(stdout, "\nPer turn records written to '%s'.\n",
+             bench.proffile);
+
+  fc_fprintf(stdout, "\nState checksum:   %08x\n", checksum);
+  if (bench.check) {
+    if (checksum != bench.checksum) {
+      fc_fprintf(stdout, "Checksum MISMATCH, expected %08x: "
+                 "the game took another course.\n", bench.checksum);
+      exit(EXIT_FAILURE);
+    }
+    fc_fprintf(stdout, "Checksum matches the expected one.\n");
+  }
+  if (bench.verify) {
+    bench_verify();
+  }
+  fflush(stdout);
+}
+
+/**********************************************************************//**
+  Parse a positive integer option value into 'value'. Returns FALSE if
+  it's not valid.
+**************************************************************************/
+static bool bench_parse_int(char *option, int *value)
+{
+  bool ok = str_to_int(option, value) && *value > 0;
+
+  free(option);
+
+  return ok;
+}
+
+/**********************************************************************//**
+  Entry point of freeciv-bench.
+**************************************************************************/
+int main(int argc, char *argv[])
+{
+  int inx;
+  bool showhelp = FALSE;
+  char *option = NULL;
+
+  srv_init();
+
+  srvarg.announce = ANNOUNCE_NONE;
+  srvarg.exit_on_end = TRUE;
+  srvarg.loglevel = LOG_ERROR;
+  /* Listen only locally, on any free port, as nobody will connect. */
+  srvarg.bind_addr = "localhost";
+  srvarg.port = 0;
+  srvarg.pregame_callback = bench_pregame;
+  srvarg.game_over_callback = bench_game_over;
+
+  bench.level = fc_strdup(BENCH_DEFAULT_LEVEL);
+  bench.proffile = fc_strdup(BENCH_DEFAULT_PROFFILE);
+
+  inx = 1;
+  while (inx < argc) {
+    if ((option = get_option_malloc("--file", argv, &inx, argc,
+                                    FALSE))) {
+      sz_strlcpy(srvarg.load_filename, option);
+      free(option);
+    } else if ((option = get_option_malloc("--turns", argv, &inx, argc,
+                                           FALSE))) {
+      showhelp = !bench_parse_int(option, &bench.turns);
+    } else if ((option = get_option_malloc("--seed", argv, &inx, argc,
+                                           FALSE))) {
+      showhelp = !bench_parse_int(option, &bench.seed);
+    } else if ((option = get_option_malloc("--aifill", argv, &inx, argc,
+                                           FALSE))) {
+      showhelp = !bench_parse_int(option, &bench.aifill);
+    } else if ((option = get_option_malloc("--Size", argv, &inx, argc,
+                                           FALSE))) {
+      showhelp = !bench_parse_int(option, &bench.size);
+    } else if ((option = get_option_malloc("--Level", argv, &inx, argc,
+                                           FALSE))) {
+      free(bench.level);
+      bench.level = option;
+    } else if ((option = get_option_malloc("--checksum", argv, &inx, argc,
+                                           FALSE))) {
+      char *end;
+
+      bench.checksum = strtoul(option, &end, 16);
+      bench.check = TRUE;
+      showhelp = ('\0' == option[0] || '\0' != *end);
+      free(option);
+    } else if ((option = get_option_malloc("--Proffile", argv, &inx, argc,
+                                           FALSE))) {
+      free(bench.proffile);
+      bench.proffile = option;
+    } else if ((option = get_option_malloc("--read", argv, &inx, argc,
+                                           TRUE))) {
+      srvarg.script_filename = option;
+    } else if ((option = get_option_malloc("--ruleset", argv, &inx, argc,
+                                           TRUE))) {
+      srvarg.ruleset = option;
+    } else if ((option = get_option_malloc("--log", argv, &inx, argc,
+                                           TRUE))) {
+      srvarg.log_filename = option;
+    } else if ((option = get_option_malloc("--debug", argv, &inx, argc,
+                                           FALSE))) {
+      showhelp = !log_parse_level_str(option, &srvarg.loglevel);
+      free(option);
+    } else if (is_option("--verify", argv[inx])) {
+      bench.verify = TRUE;
+    } else if (is_option("--help", argv[inx])) {
+      showhelp = TRUE;
+    } else {
+      fc_fprintf(stderr, _("Error: unknown option '%s'\n"), argv[inx]);
+      showhelp = TRUE;
+    }
+    if (showhelp) {
+      break;
+    }
+    inx++;
+  }
+
+  if (showhelp) {
+    struct cmdhelp *help = cmdhelp_new(argv[0]);
+
+    cmdhelp_add(help, "a",
+                /* TRANS: "aifill" is exactly what user must type, do not translate. */
+                _("aifill NUMBER"),
+                _("Number of AI players of a new game"));
+    cmdhelp_add(help, "c",
+                /* TRANS: "checksum" is exactly what user must type, do not translate. */
+                _("checksum HEX"),
+                _("Fail if the final state checksum is not HEX"));
+    cmdhelp_add(help, "d",
+                /* TRANS: "debug" is exactly what user must type, do not translate. */
+                _("debug LEVEL"),
+                _("Set debug log level (one of f,e,w,n,v)"));
+    cmdhelp_add(help, "f",
+                /* TRANS: "file" is exactly what user must type, do not translate. */
+                _("file FILE"),
+                _("Load saved game FILE instead of generating one"));
+    cmdhelp_add(help, "h", "help",
+                _("Print a summary of the options"));
+    cmdhelp_add(help, "l",
+                /* TRANS: "log" is exactly what user must type, do not translate. */
+                _("log FILE"),
+                _("Use FILE as logfile"));
+    cmdhelp_add(help, "L",
+                /* TRANS: "Level" is exactly what user must type, do not translate. */
+                _("Level LEVEL"),
+                _("Skill level of the AI players of a new game"));
+    cmdhelp_add(help, "P",
+                /* TRANS: "Proffile" is exactly what user must type, do not translate. */
+                _("Proffile FILE"),
+                _("Write the per turn profile records to FILE"));
+    cmdhelp_add(help, "r",
+                /* TRANS: "read" is exactly what user must type, do not translate. */
+                _("read FILE"),
+                _("Read startup script FILE"));
+    cmdhelp_add(help, NULL,
+                /* TRANS: "ruleset" is exactly what user must type, do not translate. */
+                _("ruleset RULESET"),
+                _("Load ruleset RULESET"));
+    cmdhelp_add(help, "s",
+                /* TRANS: "seed" is exactly what user must type, do not translate. */
+                _("seed SEED"),
+                _("Game and map seed of a new game"));
+    cmdhelp_add(help, "S",
+                /* TRANS: "Size" is exactly what user must type, do not translate. */
+                _("Size SIZE"),
+                _("Map size of a new game, in thousands of tiles"));
+    cmdhelp_add(help, "t",
+                /* TRANS: "turns" is exactly what user must type, do not translate. */
+                _("turns NUMBER"),
+                _("Number of turns to play"));
+    cmdhelp_add(help, "v", "verify",
+                _("Check the optimized code paths against the plain ones "
+                  "at the end"));
+
+    cmdhelp_display(help, TRUE, FALSE, TRUE);
+    cmdhelp_destroy(help);
+
+    exit(EXIT_SUCCESS);
+  }
+
+  dont_run_as_root(argv[0], "freeciv_bench");
+
+  init_our_capability();
+
+  /* Returns only through server_quit(), or exits on a failure. */
+  srv_main();
+
+  exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,410 @@
+/***********************************************************************
+ Freeciv - Copyright (C) 1996 - A Kjeldberg, L Gregersen, P Unold
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2, or (at your option)
+   any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+***********************************************************************/
+
+/**********************************************************************
+  freeciv-fzbench: writes a file, normally a savegame, through the same
+  compressing file layer as the savegames with every compression method
+  available at every compression level, reads it back, and reports the
+  size of the result and the throughput of compressing and
+  decompressing in MB/s of uncompressed data. The methods that can
+  compress with several threads are measured with one thread and with
+  the number of threads asked. The benchmark fails if a file read back
+  differs from the original.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <fc_config.h>
+#endif
+
+#include "fc_prehdrs.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+
+/* utility */
+#include "fc_cmdline.h"
+#include "fciconv.h"
+#include "fcintl.h"
+#include "ioz.h"
+#include "log.h"
+#include "mem.h"
+#include "shared.h"
+#include "support.h"
+#include "timing.h"
+
+/* common */
+#include "fc_cmdhelp.h"
+#include "game.h"
+
+#define FZBENCH_DEFAULT_ROUNDS  3
+#define FZBENCH_DEFAULT_THREADS 4
+#define FZBENCH_DEFAULT_OUTPUT  "freeciv-fzbench.tmp"
+
+/* Size of the writes, about what a savegame line or binary column
+ * array gets written at once. */
+#define FZBENCH_CHUNK           (16 * 1024)
+
+struct fzbench_method {
+  enum fz_method method;
+  const char *name;
+  bool threads;         /* Can compress with several threads */
+};
+
+static const struct fzbench_method fzbench_methods[] = {
+  { FZ_PLAIN, "PLAIN", FALSE },
+#ifdef FREECIV_HAVE_LIBZ
+  { FZ_ZLIB, "LIBZ", FALSE },
+#endif
+#ifdef FREECIV_HAVE_LIBBZ2
+  { FZ_BZIP2, "BZIP2", FALSE },
+#endif
+#ifdef FREECIV_HAVE_LIBLZMA
+  { FZ_XZ, "XZ", TRUE },
+#endif
+#ifdef FREECIV_HAVE_LIBZSTD
+  { FZ_ZSTD, "ZSTD", TRUE },
+#endif
+};
+
+struct fzbench_result {
+  size_t size;          /* Size of the compressed file */
+  double compress;      /* Seconds to write the file, for all rounds */
+  double decompress;    /* Seconds to read it back, for all rounds */
+  bool mismatch;
+};
+
+/**********************************************************************//**
+  Read the whole file, decompressing it if it is compressed. Returns
+  NULL if it can't be read.
+**************************************************************************/
+static char *fzbench_read_input(const char *filename, size_t *size)
+{
+  fz_FILE *fp = fz_from_file(filename, "r", FZ_PLAIN, 0);
+  size_t allocated = 1024 * 1024;
+  char *data;
+  int len;
+
+  if (NULL == fp) {
+    return NULL;
+  }
+
+  data = fc_malloc(allocated);
+  *size = 0;
+  while (0 < (len = fz_fread(data + *size, allocated - *size, fp))) {
+    *size += len;
+    if (*size == allocated) {
+      allocated *= 2;
+      data = fc_realloc(data, allocated);
+    }
+  }
+  fz_fclose(fp);
+
+  return data;
+}
+
+/**********************************************************************//**
+  Write the data to the output file with the method, level and number
+  of threads, and read it back, 'rounds' times.
+**************************************************************************/
+static bool fzbench_run(const char *data, size_t size, const char *output,
+                        enum fz_method method, int level, int threads,
+                        int rounds, struct fzbench_result *result)
+{
+  struct timer *timer = timer_new(TIMER_USER, TIMER_ACTIVE, NULL);
+  char *back = fc_malloc(size + 1);
+  struct stat buf;
+  int i;
+
+  memset(result, 0, sizeof(*result));
+  fz_set_compress_threads(threads);
+
+  for (i = 0; i < rounds; i++) {
+    fz_FILE *fp;
+    size_t pos, back_size;
+    int len;
+
+    timer_clear(timer);
+    timer_start(timer);
+    fp = fz_from_file(output, "w", method, level);
+    if (NULL == fp) {
+      log_error(_("Could not open %s for writing."), output);
+      break;
+    }
+    for (pos = 0; pos < size; pos += len) {
+      len = fz_fwrite(data + pos, MIN(size - pos, FZBENCH_CHUNK), fp);
+      if (0 >= len) {
+        break;
+      }
+    }
+    if (0 != fz_fclose(fp) || pos < size) {
+      log_error(_("Could not write %s."), output);
+      break;
+    }
+    timer_stop(timer);
+    result->compress += timer_read_seconds(timer);
+
+    timer_clear(timer);
+    timer_start(timer);
+    fp = fz_from_file(output, "r", FZ_PLAIN, 0);
+    if (NULL == fp) {
+      log_error(_("Could not open %s for reading."), output);
+      break;
+    }
+    /* Ask for one more byte, so that extra data is noticed. */
+    back_size = 0;
+    while (back_size <= size
+           && 0 < (len = fz_fread(back + back_size, size + 1 - back_size,
+                                  fp))) {
+      back_size += len;
+    }
+    fz_fclose(fp);
+    timer_stop(timer);
+    result->decompress += timer_read_seconds(timer);
+
+    if (back_size != size || 0 != memcmp(data, back, size)) {
+      result->mismatch = TRUE;
+    }
+  }
+
+  if (0 == fc_stat(output, &buf)) {
+    result->size = buf.st_size;
+  }
+
+  timer_destroy(timer);
+  free(back);
+
+  return i == rounds;
+}
+
+/**********************************************************************//**
+  Print the results of one run.
+**************************************************************************/
+static void fzbench_report(const struct fzbench_method *pmethod, int level,
+                           int threads, size_t size, int rounds,
+                           const struct fzbench_result *result, FILE *csv)
+{
+  double mbytes = (double) size * rounds / 1e6;
+  double compress = mbytes / MAX(result->compress, 1e-9);
+  double decompress = mbytes / MAX(result->decompress, 1e-9);
+  double ratio = 100.0 * result->size / MAX(size, 1);
+
+  fc_fprintf(stdout, "%-6s %5d %7d %10lu %6.1f%% %10.1f %10.1f%s\n",
+             pmethod->name, level, threads, (unsigned long) result->size,
+             ratio, compress, decompress,
+             result->mismatch ? "  MISMATCH" : "");
+
+  if (NULL != csv) {
+    fprintf(csv, "%s,%d,%d,%lu,%lu,%.1f,%.1f,%d\n",
+            pmethod->name, level, threads, (unsigned long) size,
+            (unsigned long) result->size, compress, decompress,
+            result->mismatch ? 1 : 0);
+  }
+}
+
+/**********************************************************************//**
+  Parse a positive integer option value into 'value'. Returns FALSE if
+  it's not valid.
+**************************************************************************/
+static bool fzbench_parse_int(char *option, int *value)
+{
+  bool ok = str_to_int(option, value) && *value > 0;
+
+  free(option);
+
+  return ok;
+}
+
+/**********************************************************************//**
+  Entry point of freeciv-fzbench.
+**************************************************************************/
+int main(int argc, char *argv[])
+{
+  int rounds = FZBENCH_DEFAULT_ROUNDS;
+  int threads = FZBENCH_DEFAULT_THREADS;
+  char *input = NULL;
+  char *output = NULL;
+  char *csv_filename = NULL;
+  enum log_level loglevel = LOG_ERROR;
+  bool showhelp = FALSE;
+  bool failed = FALSE;
+  char *option = NULL;
+  FILE *csv = NULL;
+  char *data;
+  size_t size;
+  int inx;
+  size_t m;
+
+  init_nls();
+  init_character_encodings(FC_DEFAULT_DATA_ENCODING, FALSE);
+
+  inx = 1;
+  while (inx < argc) {
+    if ((option = get_option_malloc("--file", argv, &inx, argc, TRUE))) {
+      free(input);
+      input = option;
+    } else if ((option = get_option_malloc("--output", argv, &inx, argc,
+                                           TRUE))) {
+      free(output);
+      output = option;
+    } else if ((option = get_option_malloc("--rounds", argv, &inx, argc,
+                                           FALSE))) {
+      showhelp = !fzbench_parse_int(option, &rounds);
+    } else if ((option = get_option_malloc("--threads", argv, &inx, argc,
+                                           FALSE))) {
+      showhelp = !fzbench_parse_int(option, &threads);
+    } else if ((option = get_option_malloc("--csv", argv, &inx, argc,
+                                           TRUE))) {
+      free(csv_filename);
+      csv_filename = option;
+    } else if ((option = get_option_malloc("--debug", argv, &inx, argc,
+                                           FALSE))) {
+      showhelp = !log_parse_level_str(option, &loglevel);
+      free(option);
+    } else if (is_option("--help", argv[inx])) {
+      showhelp = TRUE;
+    } else {
+      fc_fprintf(stderr, _("Error: unknown option '%s'\n"), argv[inx]);
+      showhelp = TRUE;
+    }
+    if (showhelp) {
+      break;
+    }
+    inx++;
+  }
+
+  if (!showhelp && NULL == input) {
+    fc_fprintf(stderr, _("Error: no file to compress given.\n"));
+    showhelp = TRUE;
+  }
+
+  if (showhelp) {
+    struct cmdhelp *help = cmdhelp_new(argv[0]);
+
+    cmdhelp_add(help, "c",
+                /* TRANS: "csv" is exactly what user must type, do not translate. */
+                _("csv FILE"),
+                _("Also write the results to FILE, as comma separated "
+                  "values"));
+    cmdhelp_add(help, "d",
+                /* TRANS: "debug" is exactly what user must type, do not translate. */
+                _("debug LEVEL"),
+                _("Set debug log level (one of f,e,w,n,v)"));
+    cmdhelp_add(help, "f",
+                /* TRANS: "file" is exactly what user must type, do not translate. */
+                _("file FILE"),
+                _("Compress FILE, decompressing it first if it is "
+                  "compressed"));
+    cmdhelp_add(help, "h", "help",
+                _("Print a summary of the options"));
+    cmdhelp_add(help, "o",
+                /* TRANS: "output" is exactly what user must type, do not translate. */
+                _("output FILE"),
+                _("Write the compressed files to FILE, which is removed "
+                  "at the end"));
+    cmdhelp_add(help, "r",
+                /* TRANS: "rounds" is exactly what user must type, do not translate. */
+                _("rounds NUMBER"),
+                _("Number of times each method and level is measured"));
+    cmdhelp_add(help, "t",
+                /* TRANS: "threads" is exactly what user must type, do not translate. */
+                _("threads NUMBER"),
+                _("Number of threads of the methods that can use "
+                  "several"));
+
+    cmdhelp_display(help, TRUE, FALSE, TRUE);
+    cmdhelp_destroy(help);
+
+    exit(EXIT_SUCCESS);
+  }
+
+  log_init(NULL, loglevel, NULL, NULL, -1);
+
+  if (NULL == output) {
+    output = fc_strdup(FZBENCH_DEFAULT_OUTPUT);
+  }
+
+  data = fzbench_read_input(input, &size);
+  if (NULL == data) {
+    log_fatal(_("Could not read %s."), input);
+    exit(EXIT_FAILURE);
+  }
+
+  if (NULL != csv_filename) {
+    csv = fc_fopen(csv_filename, "w");
+    if (NULL == csv) {
+      log_fatal(_("Could not open %s: %s"), csv_filename,
+                fc_strerror(fc_get_errno()));
+      exit(EXIT_FAILURE);
+    }
+    fprintf(csv, "method,level,threads,bytes,compressed_bytes,"
+            "compress_mbps,decompress_mbps,mismatch\n");
+  }
+
+  /* TRANS: Column headers of the freeciv-fzbench results. Speeds are
+   * in megabytes of uncompressed data per second. */
+  fc_fprintf(stdout, _("%-6s %5s %7s %10s %7s %10s %10s\n"),
+             _("method"), _("level"), _("threads"), _("bytes"), _("ratio"),
+             _("comp MB/s"), _("dec MB/s"));
+
+  for (m = 0; m < ARRAY_SIZE(fzbench_methods) && !failed; m++) {
+    const struct fzbench_method *pmethod = &fzbench_methods[m];
+    int level, max_level;
+
+    /* Uncompressed files have no levels to compare. */
+    max_level = (FZ_PLAIN == pmethod->method
+                 ? GAME_MIN_COMPRESS_LEVEL : GAME_MAX_COMPRESS_LEVEL);
+
+    for (level = GAME_MIN_COMPRESS_LEVEL; level <= max_level && !failed;
+         level++) {
+      struct fzbench_result result;
+
+      if (!fzbench_run(data, size, output, pmethod->method, level, 1,
+                       rounds, &result)) {
+        failed = TRUE;
+        break;
+      }
+      fzbench_report(pmethod, level, 1, size, rounds, &result, csv);
+      failed = result.mismatch;
+
+      if (pmethod->threads && 1 < threads && !failed) {
+        if (!fzbench_run(data, size, output, pmethod->method, level,
+                         threads, rounds, &result)) {
+          failed = TRUE;
+          break;
+        }
+        fzbench_report(pmethod, level, threads, size, rounds, &result, csv);
+        failed = result.mismatch;
+      }
+    }
+  }
+
+  if (failed) {
+    log_error(_("Compressing %s failed."), input);
+  }
+
+  fc_remove(output);
+  if (NULL != csv) {
+    fclose(csv);
+  }
+  free(data);
+  free(input);
+  free(output);
+  free(csv_filename);
+
+  exit(failed ? EXIT_FAILURE : EXIT_SUCCESS);
+}
@@ -17,6 +17,7 @@
 
 /* utility */
 #include "bitvector.h"
+#include "capability.h"
 #include "fcintl.h"
 #include "log.h"
 #include "mem.h"
@@ -40,6 +41,9 @@
 #include "unitlist.h"
 #include "vision.h"
 
+/* common/aicore */
+#include "path_finding.h"
+
 /* server */
 #include "citytools.h"
 #include "cityturn.h"
@@ -64,6 +68,9 @@
 /* Suppress send_tile_info() during game_load() */
 static bool send_tile_suppressed = FALSE;
 
+/* Bulk tile sends in progress, see tile_chunks_begin(). */
+static int tile_chunk_level = 0;
+
 static void player_tile_init(struct tile *ptile, struct player *pplayer);
 static void player_tile_free(struct tile *ptile, struct player *pplayer);
 static void give_tile_info_from_player_to_player(struct player *pfrom,
@@ -345,6 +352,196 @@ bool really_gives_vision(struct player *me, struct player *them)
   return BV_ISSET(me->server.really_gives_vision, player_index(them));
 }
 
+/**********************************************************************//**
+  Start a bulk send of tiles. Until the matching tile_chunks_end(), the
+  tiles sent to the connections which support it are gathered in
+  PACKET_TILE_INFO_CHUNKs. Whoever sends other packets about the tiles
+  in between must tile_chunks_flush() first, so that the tiles still go
+  before them.
+**************************************************************************/
+static void tile_chunks_begin(void)
+{
+  tile_chunk_level++;
+}
+
+/**********************************************************************//**
+  Send the tiles gathered for the connection.
+**************************************************************************/
+static void tile_chunk_flush(struct connection *pconn)
+{
+  struct packet_tile_info_chunk *chunk = pconn->server.tile_chunk;
+
+  if (chunk != NULL && chunk->count > 0) {
+    send_packet_tile_info_chunk(pconn, chunk);
+    chunk->count = 0;
+  }
+}
+
+/**********************************************************************//**
+  Send the tiles gathered for the connections.
+**************************************************************************/
+static void tile_chunks_flush(struct conn_list *dest)
+{
+  conn_list_iterate(dest, pconn) {
+    tile_chunk_flush(pconn);
+  } conn_list_iterate_end;
+}
+
+/**********************************************************************//**
+  End a bulk send of tiles started with tile_chunks_begin().
+**************************************************************************/
+static void tile_chunks_end(void)
+{
+  fc_assert_ret(0 < tile_chunk_level);
+
+  if (0 == --tile_chunk_level) {
+    tile_chunks_flush(game.all_connections);
+  }
+}
+
+/**********************************************************************//**
+  Return an upper bound of the wire size of the chunk.
+**************************************************************************/
+static int tile_chunk_size(const struct packet_tile_info_chunk *chunk)
+{
+  return 32
+         + chunk->known_runs * 3
+         + chunk->continent_runs * 4
+         + chunk->owner_runs * 4
+         + chunk->extras_owner_runs * 4
+         + chunk->worked_runs * 4
+         + chunk->terrain_runs * 3
+         + chunk->resource_runs * 3
+         + chunk->extras_runs * (2 + (int) sizeof(bv_extras));
+}
+
+/* The most a tile can add to tile_chunk_size(): a skipped run in known
+ * and a new run for each field. */
+#define TILE_CHUNK_TILE_SIZE \
+  (3 + 3 + 4 + 4 + 4 + 4 + 3 + 3 + 2 + (int) sizeof(bv_extras))
+
+/* Continue the last run of the field of the chunk with the value, or
+ * start a new run. */
+#define TILE_CHUNK_APPEND(_chunk, _field, _value, _equal)                  \
+do {                                                                       \
+  int _last_ = (_chunk)->_field##_runs - 1;                                \
+                                                                           \
+  if (0 <= _last_ && _equal((_chunk)->_field[_last_], (_value))) {         \
+    (_chunk)->_field##_len[_last_]++;                                      \
+  } else {                                                                 \
+    (_chunk)->_field[_last_ + 1] = (_value);                               \
+    (_chunk)->_field##_len[_last_ + 1] = 1;                                \
+    (_chunk)->_field##_runs++;                                             \
+  }                                                                        \
+} while (FALSE)
+
+#define TILE_CHUNK_EQUAL(_a, _b) ((_a) == (_b))
+
+/**********************************************************************//**
+  Return whether the tile info can go in a PACKET_TILE_INFO_CHUNK for
+  the connection.
+**************************************************************************/
+static bool tile_chunk_wanted(const struct connection *pconn,
+                              const struct packet_tile_info *info)
+{
+  return (0 < tile_chunk_level
+          /* Chunks are not replicated to the members of an observer
+           * group, see send_packet_data(). */
+          && NULL == pconn->phs.group
+          && has_capability("tilechunk", pconn->capability)
+          && -1 == info->placing
+          && '\0' == info->spec_sprite[0]
+          && '\0' == info->label[0]);
+}
+
+/**********************************************************************//**
+  Add the tile to the chunk of the connection. Tiles are added in native
+  order; the ones between are skipped.
+**************************************************************************/
+static void tile_chunk_add(struct connection *pconn,
+                           const struct packet_tile_info *info)
+{
+  struct packet_tile_info_chunk *chunk = pconn->server.tile_chunk;
+  int gap = 0;
+
+  if (chunk == NULL) {
+    chunk = fc_malloc(sizeof(*chunk));
+    chunk->count = 0;
+    pconn->server.tile_chunk = chunk;
+  }
+
+  if (chunk->count > 0) {
+    gap = info->tile - (chunk->first + chunk->count);
+
+    if (gap < 0
+        || chunk->count + gap + 1 > UINT16_MAX
+        || tile_chunk_size(chunk) + TILE_CHUNK_TILE_SIZE > MAX_LEN_PACKET
+        || chunk->known_runs + 2 > MAX_TILE_CHUNK_RUNS
+        || chunk->continent_runs + 1 > MAX_TILE_CHUNK_RUNS
+        || chunk->owner_runs + 1 > MAX_TILE_CHUNK_RUNS
+        || chunk->extras_owner_runs + 1 > MAX_TILE_CHUNK_RUNS
+        || chunk->worked_runs + 1 > MAX_TILE_CHUNK_RUNS
+        || chunk->terrain_runs + 1 > MAX_TILE_CHUNK_RUNS
+        || chunk->resource_runs + 1 > MAX_TILE_CHUNK_RUNS
+        || chunk->extras_runs + 1 > MAX_TILE_CHUNK_RUNS) {
+      tile_chunk_flush(pconn);
+      gap = 0;
+    }
+  }
+
+  if (chunk->count == 0) {
+    chunk->first = info->tile;
+    chunk->known_runs = 0;
+    chunk->continent_runs = 0;
+    chunk->owner_runs = 0;
+    chunk->extras_owner_runs = 0;
+    chunk->worked_runs = 0;
+    chunk->terrain_runs = 0;
+    chunk->resource_runs = 0;
+    chunk->extras_runs = 0;
+  } else if (gap > 0) {
+    /* The last tile is never skipped, so this starts a new run. */
+    chunk->known[chunk->known_runs] = TILE_CHUNK_SKIPPED;
+    chunk->known_len[chunk->known_runs] = gap;
+    chunk->known_runs++;
+
+    chunk->continent_len[chunk->continent_runs - 1] += gap;
+    chunk->owner_len[chunk->owner_runs - 1] += gap;
+    chunk->extras_owner_len[chunk->extras_owner_runs - 1] += gap;
+    chunk->worked_len[chunk->worked_runs - 1] += gap;
+    chunk->terrain_len[chunk->terrain_runs - 1] += gap;
+    chunk->resource_len[chunk->resource_runs - 1] += gap;
+    chunk->extras_len[chunk->extras_runs - 1] += gap;
+  }
+
+  TILE_CHUNK_APPEND(chunk, known, info->known, TILE_CHUNK_EQUAL);
+  TILE_CHUNK_APPEND(chunk, continent, info->continent, TILE_CHUNK_EQUAL);
+  TILE_CHUNK_APPEND(chunk, owner, info->owner, TILE_CHUNK_EQUAL);
+  TILE_CHUNK_APPEND(chunk, extras_owner, info->extras_owner,
+                    TILE_CHUNK_EQUAL);
+  TILE_CHUNK_APPEND(chunk, worked, info->worked, TILE_CHUNK_EQUAL);
+  TILE_CHUNK_APPEND(chunk, terrain, info->terrain, TILE_CHUNK_EQUAL);
+  TILE_CHUNK_APPEND(chunk, resource, info->resource, TILE_CHUNK_EQUAL);
+  TILE_CHUNK_APPEND(chunk, extras, info->extras, BV_ARE_EQUAL);
+  chunk->count += gap + 1;
+}
+
+/**********************************************************************//**
+  Send the tile info to the connection, or add it to the chunk of the
+  connection during a bulk send.
+**************************************************************************/
+static void send_tile_info_packet(struct connection *pconn,
+                                  const struct packet_tile_info *info)
+{
+  if (tile_chunk_wanted(pconn, info)) {
+    tile_chunk_add(pconn, info);
+  } else {
+    /* The gathered tiles go first. */
+    tile_chunk_flush(pconn);
+    send_packet_tile_info(pconn, info);
+  }
+}
+
 /**********************************************************************//**
   Start buffering shared vision
 **************************************************************************/
@@ -382,11 +579,13 @@ static void unbuffer_shared_vision(struct player *pplayer)
 void give_map_from_player_to_player(struct player *pfrom, struct player *pdest)
 {
   buffer_shared_vision(pdest);
+  tile_chunks_begin();
 
   whole_map_iterate(&(wld.map), ptile) {
     give_tile_info_from_player_to_player(pfrom, pdest, ptile);
   } whole_map_iterate_end;
 
+  tile_chunks_end();
   unbuffer_shared_vision(pdest);
   city_thaw_workers_queue();
   sync_cities();
@@ -398,6 +597,7 @@ void give_map_from_player_to_player(struct player *pfrom, struct player *pdest)
 void give_seamap_from_player_to_player(struct player *pfrom, struct player *pdest)
 {
   buffer_shared_vision(pdest);
+  tile_chunks_begin();
 
   whole_map_iterate(&(wld.map), ptile) {
     if (is_ocean_tile(ptile)) {
@@ -405,6 +605,7 @@ void give_seamap_from_player_to_player(struct player *pfrom, struct player *pdes
     }
   } whole_map_iterate_end;
 
+  tile_chunks_end();
   unbuffer_shared_vision(pdest);
   city_thaw_workers_queue();
   sync_cities();
@@ -419,11 +620,13 @@ void give_citymap_from_player_to_player(struct city *pcity,
   struct tile *pcenter = city_tile(pcity);
 
   buffer_shared_vision(pdest);
+  tile_chunks_begin();
 
   city_tile_iterate(city_map_radius_sq_get(pcity), pcenter, ptile) {
     give_tile_info_from_player_to_player(pfrom, pdest, ptile);
   } city_tile_iterate_end;
 
+  tile_chunks_end();
   unbuffer_shared_vision(pdest);
   city_thaw_workers_queue();
   sync_cities();
@@ -450,10 +653,12 @@ void send_all_known_tiles(struct conn_list *dest)
      of the send buffers better */
   tiles_sent = 0;
   conn_list_do_buffer(dest);
+  tile_chunks_begin();
 
   whole_map_iterate(&(wld.map), ptile) {
     tiles_sent++;
     if ((tiles_sent % wld.map.xsize) == 0) {
+      tile_chunks_flush(dest);
       conn_list_do_unbuffer(dest);
       flush_packets();
       conn_list_do_buffer(dest);
@@ -462,6 +667,7 @@ void send_all_known_tiles(struct conn_list *dest)
     send_tile_info(dest, ptile, FALSE);
   } whole_map_iterate_end;
 
+  tile_chunks_end();
   conn_list_do_unbuffer(dest);
   flush_packets();
 }
@@ -556,7 +762,7 @@ void send_tile_info(struct conn_list *dest, struct tile *ptile,
         info.label[0] = '\0';
       }
 
-      send_packet_tile_info(pconn, &info);
+      send_tile_info_packet(pconn, &info);
     } else if (pplayer && map_is_known(ptile, pplayer)) {
       struct player_tile *plrtile = map_get_player_tile(ptile, pplayer);
       struct vision_site *psite = map_get_player_site(ptile, pplayer);
@@ -591,7 +797,7 @@ void send_tile_info(struct conn_list *dest, struct tile *ptile,
         info.label[0] = '\0';
       }
 
-      send_packet_tile_info(pconn, &info);
+      send_tile_info_packet(pconn, &info);
     } else if (send_unknown) {
       info.known = TILE_UNKNOWN;
       info.continent = 0;
@@ -608,7 +814,7 @@ void send_tile_info(struct conn_list *dest, struct tile *ptile,
 
       info.label[0] = '\0';
 
-      send_packet_tile_info(pconn, &info);
+      send_tile_info_packet(pconn, &info);
     }
   }
   conn_list_iterate_end;
@@ -982,6 +1188,12 @@ void map_change_seen(struct player *pplayer,
   vision_layer_iterate(v) {
     /* Avoid underflow. */
     fc_assert(0 <= change[v] || -change[v] <= plrtile->seen_count[v]);
+    if (0 != change[v]
+        && (0 == plrtile->seen_count[v]
+            || 0 == plrtile->seen_count[v] + change[v])) {
+      /* The paths of this player may change. */
+      pf_map_cache_invalidate();
+    }
     plrtile->seen_count[v] += change[v];
   } vision_layer_iterate_end;
 
@@ -1047,6 +1259,12 @@ void map_change_seen(struct player *pplayer,
      */
     update_player_tile_knowledge(pplayer, ptile);
     send_tile_info(pplayer->connections, ptile, FALSE);
+    /* The following packets must not overtake it in a tile chunk. */
+    if (0 < unit_list_size(ptile->units)
+        || NULL != tile_city(ptile)
+        || NULL != map_get_player_site(ptile, pplayer)) {
+      tile_chunks_flush(pplayer->connections);
+    }
 
     /* Discover units. */
     unit_list_iterate(ptile->units, punit) {
@@ -1073,6 +1291,9 @@ void map_change_seen(struct player *pplayer,
     log_debug("(%d, %d): revealing invisible units to player %s (nb %d).",
               TILE_XY(ptile), player_name(pplayer),
               player_number(pplayer));
+    if (0 < unit_list_size(ptile->units)) {
+      tile_chunks_flush(pplayer->connections);
+    }
     /* Discover units. */
     unit_list_iterate(ptile->units, punit) {
       if (unit_is_on_layer(punit, V_INVIS)) {
@@ -1086,6 +1307,9 @@ void map_change_seen(struct player *pplayer,
     log_debug("(%d, %d): revealing subsurface units to player %s (nb %d).",
               TILE_XY(ptile), player_name(pplayer),
               player_number(pplayer));
+    if (0 < unit_list_size(ptile->units)) {
+      tile_chunks_flush(pplayer->connections);
+    }
     /* Discover units. */
     unit_list_iterate(ptile->units, punit) {
       if (unit_is_on_layer(punit, V_SUBSURFACE)) {
@@ -1146,6 +1370,7 @@ void change_playertile_site(struct player_tile *ptile,
 **************************************************************************/
 void map_set_known(struct tile *ptile, struct player *pplayer)
 {
+  pf_map_cache_invalidate();
   dbv_set(&pplayer->tile_known, tile_index(ptile));
 }
 
@@ -1154,6 +1379,7 @@ void map_set_known(struct tile *ptile, struct player *pplayer)
 **************************************************************************/
 void map_clear_known(struct tile *ptile, struct player *pplayer)
 {
+  pf_map_cache_invalidate();
   dbv_clr(&pplayer->tile_known, tile_index(ptile));
 }
 
@@ -1167,9 +1393,11 @@ void map_know_and_see_all(struct player *pplayer)
   const v_radius_t radius_sq = V_RADIUS(1, 1, 1);
 
   buffer_shared_vision(pplayer);
+  tile_chunks_begin();
   whole_map_iterate(&(wld.map), ptile) {
     map_change_seen(pplayer, ptile, radius_sq, TRUE);
   } whole_map_iterate_end;
+  tile_chunks_end();
   unbuffer_shared_vision(pplayer);
 }
 
@@ -1413,6 +1641,9 @@ void update_tile_knowledge(struct tile *ptile)
     return;
   }
 
+  /* The tile has changed, the cached paths may go through it. */
+  pf_map_cache_invalidate();
+
   /* Players */
   players_iterate(pplayer) {
     if (map_is_known_and_seen(ptile, pplayer, V_MAIN)) {
@@ -1477,6 +1708,9 @@ static void really_give_tile_info_from_player_to_player(struct player *pfrom,
       dest_tile->extras_owner = from_tile->extras_owner;
       dest_tile->last_updated = from_tile->last_updated;
       send_tile_info(pdest->connections, ptile, FALSE);
+      if (dest_tile->site || from_tile->site) {
+        tile_chunks_flush(pdest->connections);
+      }
 
       /* update and send city knowledge */
       /* remove outdated cities */
@@ -1696,9 +1930,11 @@ void enable_fog_of_war_player(struct player *pplayer)
   const v_radius_t radius_sq = V_RADIUS(-1, 0, 0);
 
   buffer_shared_vision(pplayer);
+  tile_chunks_begin();
   whole_map_iterate(&(wld.map), ptile) {
     map_change_seen(pplayer, ptile, radius_sq, FALSE);
   } whole_map_iterate_end;
+  tile_chunks_end();
   unbuffer_shared_vision(pplayer);
 }
 
@@ -1720,9 +1956,11 @@ void disable_fog_of_war_player(struct player *pplayer)
   const v_radius_t radius_sq = V_RADIUS(1, 0, 0);
 
   buffer_shared_vision(pplayer);
+  tile_chunks_begin();
   whole_map_iterate(&(wld.map), ptile) {
     map_change_seen(pplayer, ptile, radius_sq, FALSE);
   } whole_map_iterate_end;
+  tile_chunks_end();
   unbuffer_shared_vision(pplayer);
 }
 
@@ -2310,6 +2548,8 @@ void map_claim_base(struct tile *ptile, struct extra_type *pextra,
     return;
   }
 
+  pf_map_cache_invalidate();
+
   if (pextra->eus != EUS_NORMAL) {
     int i = 0;
 
@@ -2577,6 +2817,7 @@ void give_distorted_map(struct player *pfrom, struct player *pto,
                         int prob, bool reveal_cities)
 {
   buffer_shared_vision(pto);
+  tile_chunks_begin();
 
   whole_map_iterate(&(wld.map), ptile) {
     if (fc_rand(100) < prob) {
@@ -2586,6 +2827,7 @@ void give_distorted_map(struct player *pfrom, struct player *pto,
     }
   } whole_map_iterate_end;
 
+  tile_chunks_end();
   unbuffer_shared_vision(pto);
 }
 
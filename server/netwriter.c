@@ -0,0 +1,437 @@
+/***********************************************************************
+ Freeciv - Copyright (C) 1996 - A Kjeldberg, L Gregersen, P Unold
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2, or (at your option)
+   any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <fc_config.h>
+#endif
+
+#include "fc_prehdrs.h"
+
+#include <errno.h>
+
+/* utility */
+#include "fcintl.h"
+#include "fcthread.h"
+#include "log.h"
+#include "mem.h"
+#include "netintf.h"
+#include "timing.h"
+
+/* common */
+#include "connection.h"
+#include "fc_types.h"           /* MAX_NUM_CONNECTIONS */
+
+/* server */
+#include "connecthand.h"
+
+#include "netwriter.h"
+
+/* How long the writer thread waits for a blocked socket to become
+ * writable before looking at the other connections again. */
+#define NETWRITER_BLOCKED_WAIT_USEC 10000
+
+/* The data a connection hands to the writer thread. Only the main thread
+ * creates and frees the queues, and touches the reference counts of the
+ * segments: the thread gives the segments it has written back in 'sent'
+ * instead of releasing them. */
+struct netwriter_queue {
+  struct connection *pconn;     /* Only used by the main thread. */
+  int sock;
+  int slot;                     /* Index in writer.queues. */
+
+  /* Protected by writer.mutex. */
+  struct socket_send_buffer *buf;   /* Data waiting to be written. */
+  struct socket_send_buffer *sent;  /* Segments written, to release. */
+  bool busy;                    /* The thread uses it without the lock. */
+  bool blocked;                 /* The socket is not writable. */
+  bool wrote;                   /* Written since the last poll. */
+  const char *error;            /* Untranslated reason to close it. */
+};
+
+static struct {
+  bool running;
+  fc_thread thread;
+
+  fc_mutex mutex;               /* Protects all the fields below. */
+  fc_thread_cond wake_cond;     /* Data to write, or quitting. */
+  fc_thread_cond idle_cond;     /* A queue is not busy anymore. */
+  bool quit;
+  struct netwriter_queue *queues[MAX_NUM_CONNECTIONS];
+} writer;
+
+/*******************************************************************//**
+  Write as much of the queue as the socket takes at once. The mutex must
+  be held by the caller; it is released during the write.
+***********************************************************************/
+static void netwriter_write(struct netwriter_queue *queue)
+{
+  struct fc_iovec iov[FC_IOV_MAX];
+  int niov = send_buffer_iovec(queue->buf, iov, FC_IOV_MAX);
+  int i, len = 0, nput, err;
+
+  for (i = 0; i < niov; i++) {
+    len += iov[i].len;
+  }
+
+  queue->busy = TRUE;
+  fc_mutex_release(&writer.mutex);
+  nput = fc_writevsocket(queue->sock, iov, niov);
+  err = errno;
+  fc_mutex_allocate(&writer.mutex);
+  queue->busy = FALSE;
+  fc_thread_cond_signal(&writer.idle_cond);
+
+  if (0 <= nput) {
+    send_buffer_consume(queue->buf, nput, queue->sent);
+    if (0 < nput) {
+      queue->wrote = TRUE;
+    }
+    if (nput < len) {
+      queue->blocked = TRUE;
+    }
+  } else if (EINTR == err) {
+    /* Just try again. */
+#ifdef NONBLOCKING_SOCKETS
+  } else if (EWOULDBLOCK == err || EAGAIN == err) {
+    queue->blocked = TRUE;
+#endif /* NONBLOCKING_SOCKETS */
+  } else {
+    queue->error = N_("lagging connection");
+  }
+}
+
+/*******************************************************************//**
+  Wait a bit for the blocked sockets to become writable. Return FALSE
+  if there is no such socket. The mutex must be held by the caller; it
+  is released during the wait.
+***********************************************************************/
+static bool netwriter_wait_blocked(void)
+{
+  struct netwriter_queue *waiting[MAX_NUM_CONNECTIONS];
+  fd_set writefs, exceptfs;
+  fc_timeval tv;
+  int i, num = 0, maxsock = -1, ret;
+
+  FC_FD_ZERO(&writefs);
+  FC_FD_ZERO(&exceptfs);
+
+  for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
+    struct netwriter_queue *queue = writer.queues[i];
+
+    if (NULL != queue && queue->blocked && NULL == queue->error
+        && 0 < queue->buf->ndata) {
+      FD_SET(queue->sock, &writefs);
+      FD_SET(queue->sock, &exceptfs);
+      maxsock = MAX(maxsock, queue->sock);
+      queue->busy = TRUE;
+      waiting[num++] = queue;
+    }
+  }
+
+  if (0 == num) {
+    return FALSE;
+  }
+
+  tv.tv_sec = 0;
+  tv.tv_usec = NETWRITER_BLOCKED_WAIT_USEC;
+
+  fc_mutex_release(&writer.mutex);
+  ret = fc_select(maxsock + 1, NULL, &writefs, &exceptfs, &tv);
+  fc_mutex_allocate(&writer.mutex);
+
+  for (i = 0; i < num; i++) {
+    struct netwriter_queue *queue = waiting[i];
+
+    queue->busy = FALSE;
+    if (0 < ret) {
+      if (FD_ISSET(queue->sock, &exceptfs)) {
+        queue->error = N_("network exception");
+      } else if (FD_ISSET(queue->sock, &writefs)) {
+        queue->blocked = FALSE;
+      }
+    }
+  }
+  fc_thread_cond_signal(&writer.idle_cond);
+
+  return TRUE;
+}
+
+/*******************************************************************//**
+  Main function of the writer thread: write the queues in turn until
+  they are empty or blocked, then wait for the sockets or for more data.
+***********************************************************************/
+static void netwriter_run(void *arg)
+{
+  fc_mutex_allocate(&writer.mutex);
+  while (!writer.quit) {
+    bool wrote = FALSE;
+    int i;
+
+    for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
+      struct netwriter_queue *queue = writer.queues[i];
+
+      if (NULL != queue && !queue->blocked && NULL == queue->error
+          && 0 < queue->buf->ndata) {
+        netwriter_write(queue);
+        wrote = TRUE;
+      }
+    }
+
+    if (!wrote && !writer.quit && !netwriter_wait_blocked()) {
+      fc_thread_cond_wait(&writer.wake_cond, &writer.mutex);
+    }
+  }
+  fc_mutex_release(&writer.mutex);
+}
+
+/*******************************************************************//**
+  Create the queue of the connection. The mutex must be held by the
+  caller.
+***********************************************************************/
+static struct netwriter_queue *netwriter_queue_new(struct connection *pconn)
+{
+  struct netwriter_queue *queue;
+  int i;
+
+  for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
+    if (NULL == writer.queues[i]) {
+      break;
+    }
+  }
+  fc_assert_ret_val(i < MAX_NUM_CONNECTIONS, NULL);
+
+  queue = fc_calloc(1, sizeof(*queue));
+  queue->pconn = pconn;
+  queue->sock = pconn->sock;
+  queue->slot = i;
+  queue->buf = new_socket_send_buffer();
+  queue->sent = new_socket_send_buffer();
+  writer.queues[i] = queue;
+  pconn->server.write_queue = queue;
+
+  return queue;
+}
+
+/*******************************************************************//**
+  Free the queue of the connection, which the thread must not use
+  anymore.
+***********************************************************************/
+static void netwriter_queue_free(struct netwriter_queue *queue)
+{
+  queue->pconn->server.write_queue = NULL;
+  free_socket_send_buffer(queue->buf);
+  free_socket_send_buffer(queue->sent);
+  free(queue);
+}
+
+/*******************************************************************//**
+  Tell the connection what the thread did with its data.
+***********************************************************************/
+static void netwriter_report(struct connection *pconn, bool wrote,
+                             const char *error)
+{
+  if (wrote) {
+    pconn->last_write = timer_renew(pconn->last_write, TIMER_USER,
+                                    TIMER_ACTIVE,
+                                    pconn->last_write != NULL
+                                    ? NULL : "socket write");
+    timer_start(pconn->last_write);
+  }
+
+  if (NULL != error && !pconn->server.is_closing) {
+    log_verbose("connection (%s) cut by the network writer: %s",
+                conn_description(pconn), error);
+    connection_close_server(pconn, _(error));
+  }
+}
+
+/*******************************************************************//**
+  The 'conn_writer_fn_t' of the connections while the thread runs: move
+  the data of the send buffer to the queue of the connection.
+***********************************************************************/
+static void netwriter_handoff(struct connection *pconn)
+{
+  struct socket_send_buffer *buf = pconn->send_buffer;
+  struct netwriter_queue *queue;
+  bool overflow = FALSE;
+
+  if (0 == buf->ndata) {
+    return;
+  }
+
+  fc_mutex_allocate(&writer.mutex);
+  queue = pconn->server.write_queue;
+  if (NULL == queue) {
+    queue = netwriter_queue_new(pconn);
+  }
+
+  if (NULL == queue) {
+    overflow = TRUE;
+  } else if (queue->buf->ndata + buf->ndata > MAX_LEN_BUFFER) {
+    /* Same limit as when the data waits in the send buffer. */
+    overflow = TRUE;
+  } else {
+    send_buffer_move(queue->buf, buf);
+    fc_thread_cond_signal(&writer.wake_cond);
+  }
+  fc_mutex_release(&writer.mutex);
+
+  if (overflow) {
+    log_verbose("cut connection %s due to huge send queue",
+                conn_description(pconn));
+    send_buffer_clear(buf);
+    connection_close(pconn, _("buffer overflow"));
+  }
+}
+
+/*******************************************************************//**
+  Start the network writer thread. From now on, the data of all the
+  connections is written to the sockets by that thread. Return FALSE if
+  it could not be started; the writes stay then in the main thread.
+***********************************************************************/
+bool netwriter_start(void)
+{
+  if (writer.running) {
+    return TRUE;
+  }
+
+  if (!has_thread_cond_impl()) {
+    log_error(_("This Freeciv compilation has no full threads "
+                "implementation, the network writer thread cannot "
+                "be used."));
+    return FALSE;
+  }
+
+  fc_mutex_init(&writer.mutex);
+  fc_thread_cond_init(&writer.wake_cond);
+  fc_thread_cond_init(&writer.idle_cond);
+  writer.quit = FALSE;
+
+  if (fc_thread_start(&writer.thread, netwriter_run, NULL)) {
+    log_error("Could not start the network writer thread.");
+    fc_thread_cond_destroy(&writer.idle_cond);
+    fc_thread_cond_destroy(&writer.wake_cond);
+    fc_mutex_destroy(&writer.mutex);
+    return FALSE;
+  }
+
+  writer.running = TRUE;
+  connections_set_writer(netwriter_handoff);
+  log_verbose("Network writer thread started.");
+
+  return TRUE;
+}
+
+/*******************************************************************//**
+  Stop the network writer thread. The data it has not written yet goes
+  back to the send buffers of the connections, so that nothing is lost.
+***********************************************************************/
+void netwriter_stop(void)
+{
+  int i;
+
+  if (!writer.running) {
+    return;
+  }
+
+  fc_mutex_allocate(&writer.mutex);
+  writer.quit = TRUE;
+  fc_thread_cond_signal(&writer.wake_cond);
+  fc_mutex_release(&writer.mutex);
+  fc_thread_wait(&writer.thread);
+
+  connections_set_writer(NULL);
+
+  for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
+    struct netwriter_queue *queue = writer.queues[i];
+    struct connection *pconn;
+
+    if (NULL == queue) {
+      continue;
+    }
+
+    /* The queued data goes before what is still buffered. */
+    pconn = queue->pconn;
+    send_buffer_move(queue->buf, pconn->send_buffer);
+    send_buffer_move(pconn->send_buffer, queue->buf);
+
+    netwriter_report(pconn, queue->wrote, queue->error);
+    writer.queues[i] = NULL;
+    netwriter_queue_free(queue);
+  }
+
+  fc_thread_cond_destroy(&writer.idle_cond);
+  fc_thread_cond_destroy(&writer.wake_cond);
+  fc_mutex_destroy(&writer.mutex);
+  writer.running = FALSE;
+  log_verbose("Network writer thread stopped.");
+}
+
+/*******************************************************************//**
+  Called regularly by the main thread for each connection: release the
+  data written by the thread, and close the connection if writing to it
+  failed. Return TRUE if the connection has data which cannot be written
+  because its socket is blocked, so that it may be cut for lagging.
+***********************************************************************/
+bool netwriter_poll(struct connection *pconn)
+{
+  struct netwriter_queue *queue = pconn->server.write_queue;
+  const char *error;
+  bool wrote, blocked;
+
+  if (NULL == queue) {
+    return FALSE;
+  }
+
+  fc_mutex_allocate(&writer.mutex);
+  send_buffer_clear(queue->sent);
+  wrote = queue->wrote;
+  queue->wrote = FALSE;
+  error = queue->error;
+  blocked = queue->blocked && 0 < queue->buf->ndata;
+  fc_mutex_release(&writer.mutex);
+
+  netwriter_report(pconn, wrote, error);
+
+  return NULL == error && blocked;
+}
+
+/*******************************************************************//**
+  Forget the queue of the connection being closed, once the thread does
+  not use it anymore. The data still waiting gets one last chance to be
+  written without waiting, like it would be without the thread.
+***********************************************************************/
+void netwriter_forget(struct connection *pconn)
+{
+  struct netwriter_queue *queue = pconn->server.write_queue;
+
+  if (NULL == queue) {
+    return;
+  }
+
+  fc_mutex_allocate(&writer.mutex);
+  while (queue->busy) {
+    fc_thread_cond_wait(&writer.idle_cond, &writer.mutex);
+  }
+  writer.queues[queue->slot] = NULL;
+  fc_mutex_release(&writer.mutex);
+
+  if (NULL == queue->error && 0 < queue->buf->ndata) {
+    struct fc_iovec iov[FC_IOV_MAX];
+    int niov = send_buffer_iovec(queue->buf, iov, FC_IOV_MAX);
+
+    (void) fc_writevsocket(queue->sock, iov, niov);
+  }
+
+  netwriter_queue_free(queue);
+}
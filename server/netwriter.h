@@ -0,0 +1,27 @@
+/***********************************************************************
+ Freeciv - Copyright (C) 1996 - A Kjeldberg, L Gregersen, P Unold
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2, or (at your option)
+   any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+***********************************************************************/
+#ifndef FC__NETWRITER_H
+#define FC__NETWRITER_H
+
+/* utility */
+#include "support.h"            /* bool type */
+
+struct connection;
+
+bool netwriter_start(void);
+void netwriter_stop(void);
+
+bool netwriter_poll(struct connection *pconn);
+void netwriter_forget(struct connection *pconn);
+
+#endif /* FC__NETWRITER_H */
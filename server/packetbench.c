@@ -0,0 +1,785 @@
+/***********************************************************************
+ Freeciv - Copyright (C) 1996 - A Kjeldberg, L Gregersen, P Unold
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2, or (at your option)
+   any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+***********************************************************************/
+
+/**********************************************************************
+  freeciv-packetbench: sends batches of random packets of every type
+  from a server connection to a client connection (or the other way
+  for the packets sent by the client) over a local socket pair, and
+  reports the time spent to encode them, to compress and write them,
+  and to read and decode them, per packet. Each type is measured with
+  new packets, with packets differing by one field from the last ones
+  sent with the same key, and with packets equal to them, which
+  exercise the delta protocol differently. Every packet received is
+  compared with the packet sent, and the benchmark fails if any of
+  them did not survive the roundtrip.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <fc_config.h>
+#endif
+
+#include "fc_prehdrs.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
+
+/* utility */
+#include "fc_cmdline.h"
+#include "fciconv.h"
+#include "fcintl.h"
+#include "genhash.h"
+#include "log.h"
+#include "netintf.h"
+#include "rand.h"
+#include "shared.h"
+#include "support.h"
+#include "timing.h"
+
+/* common */
+#include "capstr.h"
+#include "connection.h"
+#include "fc_cmdhelp.h"
+#include "game.h"
+#include "packets.h"
+
+#include "packetbench.h"
+#include "packetbench_gen.h"
+
+#define PBENCH_DEFAULT_ROUNDS   20
+#define PBENCH_DEFAULT_SEED     1
+
+/* Packets are sent in batches of about that many bytes of packet
+ * structures, which is about the size of the batches the server
+ * compresses while a turn is processed. */
+#define PBENCH_BATCH_BYTES      (32 * 1024)
+#define PBENCH_BATCH_MIN        16
+#define PBENCH_BATCH_MAX        1024
+
+/* Room of the socket pair, so that a batch is written at once. */
+#define PBENCH_SOCKET_BUFFER    (4 * 1024 * 1024)
+
+enum pbench_mode {
+  PBENCH_NEW,           /* Nothing cached for the packets. */
+  PBENCH_CHANGED,       /* One field changed from the cached packet. */
+  PBENCH_SAME,          /* Same as the cached packet. */
+  PBENCH_MODE_COUNT
+};
+
+static const char *const pbench_mode_names[PBENCH_MODE_COUNT] = {
+  "new", "changed", "same"
+};
+
+struct pbench_stats {
+  int calls;            /* Packets given to the send function */
+  int sent;             /* Packets which were actually sent */
+  int mismatches;       /* Packets lost or altered by the roundtrip */
+  size_t raw_bytes;     /* Size of the packets sent */
+  size_t wire_bytes;    /* Size of the data read by the receiver */
+  struct timer *encode;
+  struct timer *flush;
+  struct timer *decode;
+};
+
+static struct connection server_conn;
+static struct connection client_conn;
+static struct packet_handlers client_handlers;
+
+/* The packets sent while a batch is measured. */
+static struct {
+  bool active;
+  enum packet_type type;
+  int current;          /* Index in the batch of the packet being sent */
+  int *sent;            /* Indices of the packets which were sent */
+  int num_sent;
+  size_t bytes;
+} record;
+
+/**********************************************************************//**
+  Return a random integer in [min, max]. Small values, which are the
+  most frequent in the game and the cheapest to send, are favored.
+**************************************************************************/
+int sample_int(int min, int max)
+{
+  unsigned int range = (unsigned int) max - (unsigned int) min;
+  unsigned int value;
+
+  fc_assert_ret_val(min <= max, min);
+
+  if (0 != fc_rand(4) && MAX(min, -16) <= MIN(max, 99)) {
+    return MAX(min, -16) + fc_rand(MIN(max, 99) - MAX(min, -16) + 1);
+  }
+
+  value = (fc_rand(0x10000) << 16) | fc_rand(0x10000);
+  if (range < UINT_MAX) {
+    value %= range + 1;
+  }
+
+  return (int) ((unsigned int) min + value);
+}
+
+/**********************************************************************//**
+  Return a random boolean.
+**************************************************************************/
+bool sample_bool(void)
+{
+  return 0 == fc_rand(2);
+}
+
+/**********************************************************************//**
+  Return a random float. Only quarters of small values are used, so that
+  the value is exact after the fixed-point transmission of any factor
+  of the protocol.
+**************************************************************************/
+float sample_float(bool sign)
+{
+  return sample_int(sign ? -400 : 0, 400) / 4.0f;
+}
+
+/**********************************************************************//**
+  Fill 'dest' with random bytes.
+**************************************************************************/
+void sample_memory(void *dest, size_t size)
+{
+  unsigned char *bytes = dest;
+  size_t i;
+
+  for (i = 0; i < size; i++) {
+    bytes[i] = fc_rand(256);
+  }
+}
+
+/**********************************************************************//**
+  Fill 'dest' with a random word of up to 16 letters.
+**************************************************************************/
+void sample_string(char *dest, size_t size)
+{
+  int len = fc_rand(MIN(size - 1, 16) + 1);
+  int i;
+
+  for (i = 0; i < len; i++) {
+    dest[i] = 'a' + fc_rand(26);
+  }
+  dest[len] = '\0';
+}
+
+/**********************************************************************//**
+  Fill 'preq' with a random requirement. Only the kinds whose value is a
+  plain number are used, as no ruleset is loaded.
+**************************************************************************/
+void sample_requirement(struct requirement *preq)
+{
+  static const enum universals_n kinds[] = {
+    VUT_NONE, VUT_MINSIZE, VUT_MINYEAR, VUT_MINCULTURE, VUT_MINTECHS,
+    VUT_AGE, VUT_MINMOVES, VUT_MINHP, VUT_MINVETERAN
+  };
+
+  *preq = req_from_values(kinds[fc_rand(ARRAY_SIZE(kinds))],
+                          fc_rand(REQ_RANGE_COUNT),
+                          sample_bool(), sample_bool(), sample_bool(),
+                          sample_int(0, 1000));
+}
+
+/**********************************************************************//**
+  Fill 'prob' with a random action probability.
+**************************************************************************/
+void sample_action_probability(struct act_prob *prob)
+{
+  prob->min = sample_int(0, 255);
+  prob->max = sample_int(0, 255);
+}
+
+/**********************************************************************//**
+  Fill 'order' with a random unit order.
+**************************************************************************/
+void sample_unit_order(struct unit_order *order)
+{
+  order->order = fc_rand(ORDER_LAST);
+  order->activity = fc_rand(ACTIVITY_LAST);
+  order->target = sample_int(INT_MIN, INT_MAX);
+  order->sub_target = sample_int(-32768, 32767);
+  order->action = sample_int(0, 255);
+  order->dir = fc_rand(8);
+}
+
+/**********************************************************************//**
+  Fill 'pwl' with a random worklist. It's always empty, as its items
+  would need a ruleset.
+**************************************************************************/
+void sample_worklist(struct worklist *pwl)
+{
+  worklist_init(pwl);
+}
+
+/**********************************************************************//**
+  Fill 'param' with random city governor parameters.
+**************************************************************************/
+void sample_cm_parameter(struct cm_parameter *param)
+{
+  int i;
+
+  for (i = 0; i < O_LAST; i++) {
+    param->minimal_surplus[i] = sample_int(-32768, 32767);
+    param->factor[i] = sample_int(0, 65535);
+  }
+  param->max_growth = sample_bool();
+  param->require_happy = sample_bool();
+  param->allow_disorder = sample_bool();
+  param->allow_specialists = sample_bool();
+  param->happy_factor = sample_int(0, 65535);
+}
+
+/**********************************************************************//**
+  Make a random packet acceptable to the checks of the send functions.
+**************************************************************************/
+static void pbench_fixup(enum packet_type type, void *packet)
+{
+  switch (type) {
+  case PACKET_SERVER_JOIN_REPLY:
+    /* Joining again would change the packet header of the connection. */
+    ((struct packet_server_join_reply *) packet)->you_can_join = FALSE;
+    break;
+  case PACKET_PLAYER_ATTRIBUTE_CHUNK:
+    {
+      struct packet_player_attribute_chunk *chunk = packet;
+
+      /* See pre_send_packet_player_attribute_chunk(). The offset is the
+       * key, so it's changed the same way for all the packets. */
+      chunk->offset %= MAX_ATTRIBUTE_BLOCK / 2;
+      chunk->chunk_length = MAX(chunk->chunk_length, 1);
+      chunk->total_length = chunk->offset + chunk->chunk_length;
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+/**********************************************************************//**
+  Make the program behave as the end of 'pconn'.
+**************************************************************************/
+static void pbench_set_side(const struct connection *pconn)
+{
+  if (pconn == &server_conn) {
+    i_am_server();
+  } else {
+    i_am_client();
+  }
+}
+
+/**********************************************************************//**
+  Called for every packet sent on the connections.
+**************************************************************************/
+static void pbench_notify(struct connection *pconn, int packet_type,
+                          int size, int request_id)
+{
+  if (record.active && packet_type == record.type) {
+    record.sent[record.num_sent++] = record.current;
+    record.bytes += size;
+  }
+}
+
+/**********************************************************************//**
+  Called if a connection had to be closed, which can't happen unless the
+  network code is broken.
+**************************************************************************/
+static void pbench_close(struct connection *pconn)
+{
+  log_fatal(_("Connection %s closed: %s"), pconn->username,
+            NULL != pconn->closing_reason ? pconn->closing_reason : "");
+  exit(EXIT_FAILURE);
+}
+
+/**********************************************************************//**
+  Forget the packets of the type sent or received by 'pconn'.
+**************************************************************************/
+static void pbench_reset(struct connection *pconn, enum packet_type type)
+{
+  if (NULL != pconn->phs.sent && NULL != pconn->phs.sent[type]) {
+    genhash_clear(pconn->phs.sent[type]);
+  }
+  if (NULL != pconn->phs.received && NULL != pconn->phs.received[type]) {
+    genhash_clear(pconn->phs.received[type]);
+  }
+}
+
+/**********************************************************************//**
+  Read and decode all the data sent by 'sender' to 'receiver', in chunks
+  as large as a client reads them. The packets of the type are stored in
+  'packets', NULL for the packets of another type. Returns the number of
+  packets received, which may be more than 'max'.
+**************************************************************************/
+static int pbench_receive(struct connection *sender,
+                          struct connection *receiver,
+                          enum packet_type type, void **packets, int max,
+                          struct pbench_stats *stats)
+{
+  int count = 0;
+
+  pbench_set_side(receiver);
+  if (NULL != stats) {
+    timer_start(stats->decode);
+  }
+
+  while (TRUE) {
+    enum packet_type ptype;
+    void *packet;
+    int nread = read_socket_data(receiver->sock, receiver->buffer);
+
+    if (0 >= nread) {
+      if (0 == sender->send_buffer->ndata) {
+        break;
+      }
+      /* The socket was full. */
+      pbench_set_side(sender);
+      flush_connection_send_buffer_all(sender);
+      pbench_set_side(receiver);
+      continue;
+    }
+
+    if (NULL != stats) {
+      stats->wire_bytes += nread;
+    }
+    while (NULL != (packet = get_packet_from_connection(receiver, &ptype))) {
+      if (count < max && ptype == type) {
+        packets[count] = packet;
+      } else {
+        if (count < max) {
+          packets[count] = NULL;
+        }
+        free(packet);
+      }
+      count++;
+    }
+  }
+
+  if (NULL != stats) {
+    timer_stop(stats->decode);
+  }
+  i_am_server();
+
+  return count;
+}
+
+/**********************************************************************//**
+  Return the last packet of 'batch' before 'index', or else of 'prime',
+  having the key of prime[index].
+**************************************************************************/
+static const void *pbench_latest(enum packet_type type, size_t size,
+                                 const char *prime, const char *batch,
+                                 int index, int num)
+{
+  const char *key = prime + index * size;
+  int i;
+
+  for (i = index - 1; i >= 0; i--) {
+    if (packetbench_same_key(type, batch + i * size, key)) {
+      return batch + i * size;
+    }
+  }
+  for (i = num - 1; i > index; i--) {
+    if (packetbench_same_key(type, prime + i * size, key)) {
+      return prime + i * size;
+    }
+  }
+
+  return key;
+}
+
+/**********************************************************************//**
+  Measure 'rounds' batches of packets of the type in the mode.
+**************************************************************************/
+static void pbench_run(enum packet_type type, enum pbench_mode mode,
+                       int rounds, struct connection *sender,
+                       struct connection *receiver,
+                       struct pbench_stats *stats)
+{
+  size_t size = MAX(packet_struct_size(type), 1);
+  int num = CLIP(PBENCH_BATCH_MIN, PBENCH_BATCH_BYTES / (int) size,
+                 PBENCH_BATCH_MAX);
+  char *prime = fc_calloc(num, size);
+  char *batch = fc_calloc(num, size);
+  void **received = fc_calloc(num, sizeof(*received));
+  int round, i;
+
+  record.sent = fc_calloc(num, sizeof(*record.sent));
+  record.type = type;
+
+  for (round = 0; round < rounds; round++) {
+    int count;
+
+    pbench_reset(sender, type);
+    pbench_reset(receiver, type);
+
+    for (i = 0; i < num; i++) {
+      packetbench_sample(type, prime + i * size);
+      pbench_fixup(type, prime + i * size);
+    }
+
+    if (PBENCH_NEW == mode) {
+      memcpy(batch, prime, num * size);
+    } else {
+      for (i = 0; i < num; i++) {
+        memcpy(batch + i * size,
+               pbench_latest(type, size, prime, batch, i, num), size);
+        if (PBENCH_CHANGED == mode) {
+          packetbench_change(type, batch + i * size);
+          pbench_fixup(type, batch + i * size);
+        }
+      }
+
+      /* Let both ends know the packets the batch is compared with. */
+      pbench_set_side(sender);
+      conn_compression_freeze(sender);
+      for (i = 0; i < num; i++) {
+        send_packet_by_type(sender, type, prime + i * size);
+      }
+      conn_compression_thaw(sender);
+      pbench_receive(sender, receiver, type, received, 0, NULL);
+    }
+
+    record.active = TRUE;
+    record.num_sent = 0;
+    record.bytes = 0;
+
+    pbench_set_side(sender);
+    conn_compression_freeze(sender);
+    timer_start(stats->encode);
+    for (i = 0; i < num; i++) {
+      record.current = i;
+      send_packet_by_type(sender, type, batch + i * size);
+    }
+    timer_stop(stats->encode);
+    timer_start(stats->flush);
+    conn_compression_thaw(sender);
+    timer_stop(stats->flush);
+
+    record.active = FALSE;
+    stats->calls += num;
+    stats->sent += record.num_sent;
+    stats->raw_bytes += record.bytes;
+
+    count = pbench_receive(sender, receiver, type, received, num, stats);
+
+    if (count != record.num_sent) {
+      log_error(_("%s (%s): %d packets sent, %d received."),
+                packet_name(type), pbench_mode_names[mode],
+                record.num_sent, count);
+      stats->mismatches += abs(count - record.num_sent);
+    }
+    for (i = 0; i < MIN(count, num); i++) {
+      if (i < record.num_sent
+          && (NULL == received[i]
+              || !packetbench_equal(type, batch + record.sent[i] * size,
+                                    received[i]))) {
+        log_error(_("%s (%s): packet %d differs after the roundtrip."),
+                  packet_name(type), pbench_mode_names[mode],
+                  record.sent[i]);
+        stats->mismatches++;
+      }
+      free(received[i]);
+    }
+  }
+
+  free(record.sent);
+  record.sent = NULL;
+  free(received);
+  free(batch);
+  free(prime);
+}
+
+/**********************************************************************//**
+  Set up one end of the socket pair.
+**************************************************************************/
+static void pbench_conn_init(struct connection *pconn, int sock,
+                             const char *name)
+{
+  int bufsize = PBENCH_SOCKET_BUFFER;
+
+  connection_common_init(pconn);
+  pconn->sock = sock;
+  pconn->established = TRUE;
+  pconn->outgoing_packet_notify = pbench_notify;
+  sz_strlcpy(pconn->username, name);
+  fc_nonblock(sock);
+  setsockopt(sock, SOL_SOCKET, SO_SNDBUF, &bufsize, sizeof(bufsize));
+  setsockopt(sock, SOL_SOCKET, SO_RCVBUF, &bufsize, sizeof(bufsize));
+}
+
+/**********************************************************************//**
+  Connect the server and the client ends, and join the client as the
+  server would, so that the connections use their final packet header.
+**************************************************************************/
+static void pbench_connect(void)
+{
+  struct packet_server_join_reply reply;
+  int sv[2];
+  void *packet = NULL;
+
+  if (0 != socketpair(AF_UNIX, SOCK_STREAM, 0, sv)) {
+    log_fatal(_("Could not create a socket pair: %s"),
+              fc_strerror(fc_get_errno()));
+    exit(EXIT_FAILURE);
+  }
+
+  connections_set_close_callback(pbench_close);
+
+  pbench_conn_init(&server_conn, sv[0], "server");
+  conn_set_capability(&server_conn, our_capability);
+
+  i_am_client();
+  pbench_conn_init(&client_conn, sv[1], "client");
+  conn_set_capability(&client_conn, our_capability);
+  packet_handlers_fill_initial(&client_handlers);
+  packet_handlers_fill_capability(&client_handlers, our_capability);
+  client_conn.phs.handlers = &client_handlers;
+  i_am_server();
+
+  memset(&reply, 0, sizeof(reply));
+  reply.you_can_join = TRUE;
+  sz_strlcpy(reply.capability, our_capability);
+  send_packet_server_join_reply(&server_conn, &reply);
+  conn_compression_negotiate(&server_conn, our_capability);
+  pbench_receive(&server_conn, &client_conn, PACKET_SERVER_JOIN_REPLY,
+                 &packet, 1, NULL);
+  free(packet);
+}
+
+/**********************************************************************//**
+  Print the results of a type in the mode, to the table and to the csv
+  file if any.
+**************************************************************************/
+static void pbench_report(enum packet_type type, enum pbench_mode mode,
+                          const struct pbench_stats *stats, FILE *csv)
+{
+  const char *name = packet_name(type) + strlen("PACKET_");
+  double calls = MAX(stats->calls, 1);
+  double encode = timer_read_seconds(stats->encode) * 1e9 / calls;
+  double flush = timer_read_seconds(stats->flush) * 1e9 / calls;
+  double decode = timer_read_seconds(stats->decode) * 1e9 / calls;
+
+  fc_fprintf(stdout, "%-32s %-8s %5.1f%% %8.1f %8.1f %9.0f %9.0f %9.0f%s\n",
+             name, pbench_mode_names[mode],
+             100.0 * stats->sent / calls,
+             stats->raw_bytes / calls, stats->wire_bytes / calls,
+             encode, flush, decode,
+             0 < stats->mismatches ? "  MISMATCH" : "");
+
+  if (NULL != csv) {
+    fprintf(csv, "%s,%s,%d,%d,%lu,%lu,%.1f,%.1f,%.1f,%d\n",
+            name, pbench_mode_names[mode], stats->calls, stats->sent,
+            (unsigned long) stats->raw_bytes,
+            (unsigned long) stats->wire_bytes,
+            encode, flush, decode, stats->mismatches);
+  }
+}
+
+/**********************************************************************//**
+  Returns whether the packet type matches the name given by the user,
+  with or without its "PACKET_" prefix.
+**************************************************************************/
+static bool pbench_type_matches(enum packet_type type, const char *name)
+{
+  const char *type_name = packet_name(type);
+
+  return (0 == fc_strcasecmp(type_name, name)
+          || 0 == fc_strcasecmp(type_name + strlen("PACKET_"), name));
+}
+
+/**********************************************************************//**
+  Parse a positive integer option value into 'value'. Returns FALSE if
+  it's not valid.
+**************************************************************************/
+static bool pbench_parse_int(char *option, int *value)
+{
+  bool ok = str_to_int(option, value) && *value > 0;
+
+  free(option);
+
+  return ok;
+}
+
+/**********************************************************************//**
+  Entry point of freeciv-packetbench.
+**************************************************************************/
+int main(int argc, char *argv[])
+{
+  int rounds = PBENCH_DEFAULT_ROUNDS;
+  int seed = PBENCH_DEFAULT_SEED;
+  char *type_name = NULL;
+  char *csv_filename = NULL;
+  enum log_level loglevel = LOG_ERROR;
+  bool showhelp = FALSE;
+  int mismatches = 0;
+  int measured = 0;
+  char *option = NULL;
+  FILE *csv = NULL;
+  enum packet_type type;
+  int inx;
+
+  init_nls();
+  init_character_encodings(FC_DEFAULT_DATA_ENCODING, FALSE);
+
+  inx = 1;
+  while (inx < argc) {
+    if ((option = get_option_malloc("--rounds", argv, &inx, argc,
+                                    FALSE))) {
+      showhelp = !pbench_parse_int(option, &rounds);
+    } else if ((option = get_option_malloc("--seed", argv, &inx, argc,
+                                           FALSE))) {
+      showhelp = !pbench_parse_int(option, &seed);
+    } else if ((option = get_option_malloc("--type", argv, &inx, argc,
+                                           FALSE))) {
+      free(type_name);
+      type_name = option;
+    } else if ((option = get_option_malloc("--csv", argv, &inx, argc,
+                                           TRUE))) {
+      free(csv_filename);
+      csv_filename = option;
+    } else if ((option = get_option_malloc("--debug", argv, &inx, argc,
+                                           FALSE))) {
+      showhelp = !log_parse_level_str(option, &loglevel);
+      free(option);
+    } else if (is_option("--help", argv[inx])) {
+      showhelp = TRUE;
+    } else {
+      fc_fprintf(stderr, _("Error: unknown option '%s'\n"), argv[inx]);
+      showhelp = TRUE;
+    }
+    if (showhelp) {
+      break;
+    }
+    inx++;
+  }
+
+  if (showhelp) {
+    struct cmdhelp *help = cmdhelp_new(argv[0]);
+
+    cmdhelp_add(help, "c",
+                /* TRANS: "csv" is exactly what user must type, do not translate. */
+                _("csv FILE"),
+                _("Also write the results to FILE, as comma separated "
+                  "values"));
+    cmdhelp_add(help, "d",
+                /* TRANS: "debug" is exactly what user must type, do not translate. */
+                _("debug LEVEL"),
+                _("Set debug log level (one of f,e,w,n,v)"));
+    cmdhelp_add(help, "h", "help",
+                _("Print a summary of the options"));
+    cmdhelp_add(help, "r",
+                /* TRANS: "rounds" is exactly what user must type, do not translate. */
+                _("rounds NUMBER"),
+                _("Number of batches measured per packet type and mode"));
+    cmdhelp_add(help, "s",
+                /* TRANS: "seed" is exactly what user must type, do not translate. */
+                _("seed SEED"),
+                _("Seed of the random packets"));
+    cmdhelp_add(help, "t",
+                /* TRANS: "type" is exactly what user must type, do not translate. */
+                _("type TYPE"),
+                _("Measure only the packets of TYPE, like TILE_INFO"));
+
+    cmdhelp_display(help, TRUE, FALSE, TRUE);
+    cmdhelp_destroy(help);
+
+    exit(EXIT_SUCCESS);
+  }
+
+  log_init(NULL, loglevel, NULL, NULL, -1);
+  init_our_capability();
+  i_am_server();
+  fc_srand(seed);
+
+  if (NULL != csv_filename) {
+    csv = fc_fopen(csv_filename, "w");
+    if (NULL == csv) {
+      log_fatal(_("Could not open %s: %s"), csv_filename,
+                fc_strerror(fc_get_errno()));
+      exit(EXIT_FAILURE);
+    }
+    fprintf(csv, "packet,mode,calls,sent,raw_bytes,wire_bytes,"
+            "encode_ns,flush_ns,decode_ns,mismatches\n");
+  }
+
+  pbench_connect();
+
+  /* TRANS: Column headers of the freeciv-packetbench results. Times are
+   * in nanoseconds per packet. */
+  fc_fprintf(stdout, _("%-32s %-8s %6s %8s %8s %9s %9s %9s\n"),
+             _("packet"), _("mode"), _("sent"), _("raw B"), _("wire B"),
+             _("encode"), _("flush"), _("decode"));
+
+  for (type = 0; type < PACKET_LAST; type++) {
+    struct connection *sender, *receiver;
+    enum pbench_mode mode;
+
+    if (NULL != type_name && !pbench_type_matches(type, type_name)) {
+      continue;
+    }
+
+    /* The packets sent by the server are measured in this direction
+     * only, even if the client can send them too. */
+    if (NULL != server_conn.phs.handlers->send[type].packet
+        && NULL != client_conn.phs.handlers->receive[type]) {
+      sender = &server_conn;
+      receiver = &client_conn;
+    } else if (NULL != client_conn.phs.handlers->send[type].packet
+               && NULL != server_conn.phs.handlers->receive[type]) {
+      sender = &client_conn;
+      receiver = &server_conn;
+    } else {
+      continue;
+    }
+
+    for (mode = 0; mode < PBENCH_MODE_COUNT; mode++) {
+      struct pbench_stats stats;
+
+      memset(&stats, 0, sizeof(stats));
+      stats.encode = timer_new(TIMER_USER, TIMER_ACTIVE, NULL);
+      stats.flush = timer_new(TIMER_USER, TIMER_ACTIVE, NULL);
+      stats.decode = timer_new(TIMER_USER, TIMER_ACTIVE, NULL);
+
+      pbench_run(type, mode, rounds, sender, receiver, &stats);
+      pbench_report(type, mode, &stats, csv);
+      mismatches += stats.mismatches;
+
+      timer_destroy(stats.encode);
+      timer_destroy(stats.flush);
+      timer_destroy(stats.decode);
+    }
+    measured++;
+  }
+
+  if (NULL != csv) {
+    fclose(csv);
+  }
+  connection_common_close(&server_conn);
+  connection_common_close(&client_conn);
+  free(type_name);
+  free(csv_filename);
+
+  if (0 == measured) {
+    log_error(_("No packet type to measure."));
+    exit(EXIT_FAILURE);
+  }
+  if (0 < mismatches) {
+    log_error(_("%d packets did not survive the roundtrip."), mismatches);
+    exit(EXIT_FAILURE);
+  }
+
+  exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,48 @@
+/***********************************************************************
+ Freeciv - Copyright (C) 1996 - A Kjeldberg, L Gregersen, P Unold
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2, or (at your option)
+   any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+***********************************************************************/
+#ifndef FC__PACKETBENCH_H
+#define FC__PACKETBENCH_H
+
+#include <limits.h>             /* INT_MAX, used by packetbench_gen.c */
+
+/* utility */
+#include "support.h"            /* bool type */
+
+/* common */
+#include "fc_types.h"
+#include "requirements.h"
+#include "unit.h"
+#include "worklist.h"
+
+/* common/aicore */
+#include "cm.h"
+
+/* Longest variable length array of the random packets, so that they
+ * fit in MAX_LEN_PACKET. */
+#define PACKETBENCH_MAX_ARRAY   32
+
+/* Random values used by the generated packetbench_gen.c to fill the
+ * fields of the packets. They are valid on the wire, and survive a
+ * send and receive unchanged. */
+int sample_int(int min, int max);
+bool sample_bool(void);
+float sample_float(bool sign);
+void sample_memory(void *dest, size_t size);
+void sample_string(char *dest, size_t size);
+void sample_requirement(struct requirement *preq);
+void sample_action_probability(struct act_prob *prob);
+void sample_unit_order(struct unit_order *order);
+void sample_worklist(struct worklist *pwl);
+void sample_cm_parameter(struct cm_parameter *param);
+
+#endif /* FC__PACKETBENCH_H */
@@ -30,6 +30,7 @@
 #include "citizens.h"
 #include "culture.h"
 #include "diptreaty.h"
+#include "effects.h"
 #include "government.h"
 #include "map.h"
 #include "movement.h"
@@ -43,6 +44,9 @@
 #include "tech.h"
 #include "unitlist.h"
 
+/* common/aicore */
+#include "path_finding.h"
+
 /* common/scriptcore */
 #include "luascript_types.h"
 
@@ -329,6 +333,31 @@ void handle_player_rates(struct player *pplayer,
   }
 }
 
+/**********************************************************************//**
+  Refresh the cities of the other players which the effects requiring
+  the old or the new government of 'pplayer' may reach. The cities of
+  'pplayer' itself must already be refreshed.
+**************************************************************************/
+static void government_change_refresh_others(struct player *pplayer,
+                                             struct government *old_gov)
+{
+  enum req_range range = get_req_source_effects_range(
+                           &(const struct universal) {
+                             .kind = VUT_GOVERNMENT,
+                             .value.govern = pplayer->government
+                           });
+
+  if (old_gov != NULL) {
+    range = MAX(range, get_req_source_effects_range(
+                         &(const struct universal) {
+                           .kind = VUT_GOVERNMENT,
+                           .value.govern = old_gov
+                         }));
+  }
+
+  city_refresh_effects_range(pplayer, NULL, range);
+}
+
 /**********************************************************************//**
   Finish the revolution and set the player's government.  Call this as soon
   as the player has set a target_government and the revolution_finishes
@@ -337,6 +366,7 @@ void handle_player_rates(struct player *pplayer,
 void government_change(struct player *pplayer, struct government *gov,
                        bool revolution_finished)
 {
+  struct government *old_gov;
   struct research *presearch;
 
   if (revolution_finished) {
@@ -348,6 +378,7 @@ void government_change(struct player *pplayer, struct government *gov,
     gov->changed_to_times++;
   }
 
+  old_gov = pplayer->government;
   pplayer->government = gov;
   pplayer->target_government = NULL;
 
@@ -394,6 +425,7 @@ void government_change(struct player *pplayer, struct government *gov,
 
   check_player_max_rates(pplayer);
   city_refresh_for_player(pplayer);
+  government_change_refresh_others(pplayer, old_gov);
   send_player_info_c(pplayer, pplayer->connections);
 
   presearch = research_get(pplayer);
@@ -531,6 +563,7 @@ void handle_player_change_government(struct player *pplayer,
 {
   int turns;
   struct government *gov = government_by_number(government);
+  struct government *old_gov;
   bool anarchy;
 
   if (!gov || !can_change_to_government(pplayer, gov)) {
@@ -576,6 +609,7 @@ void handle_player_change_government(struct player *pplayer,
     }
   }
 
+  old_gov = pplayer->government;
   pplayer->government = game.government_during_revolution;
   pplayer->target_government = gov;
   pplayer->revolution_finishes = game.info.turn + turns;
@@ -616,6 +650,7 @@ void handle_player_change_government(struct player *pplayer,
 
   check_player_max_rates(pplayer);
   city_refresh_for_player(pplayer);
+  government_change_refresh_others(pplayer, old_gov);
   send_player_info_c(pplayer, pplayer->connections);
 
   log_debug("Government change complete for %s. Target government is %s; "
@@ -929,6 +964,7 @@ void handle_diplomacy_cancel_pact(struct player *pplayer,
   /* do the change */
   ds_plrplr2->type = ds_plr2plr->type = new_type;
   ds_plrplr2->turns_left = ds_plr2plr->turns_left = 16;
+  pf_map_cache_invalidate();
 
   if (new_type == DS_WAR) {
     player_update_last_war_action(pplayer);
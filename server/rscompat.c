@@ -257,6 +257,8 @@ rscompat_enabler_add_obligatory_hard_reqs(struct action_enabler *ae)
                                 &new_enabler->actor_reqs);
         requirement_vector_copy(&ae->target_reqs,
                                 &new_enabler->target_reqs);
+        req_program_invalidate(&ae->actor_reqs_prog);
+        req_program_invalidate(&ae->target_reqs_prog);
         FC_FREE(new_enabler);
       } else {
         /* Register the new enabler */
@@ -128,9 +128,21 @@ static char *road_sections = NULL;
 
 static struct requirement_vector reqs_list;
 
+/* The ruleset packets as sent to the first connection of each capability,
+ * to send them again to the next ones. See send_rulesets(). */
+#define SPECLIST_TAG packet_stream
+#define SPECLIST_TYPE struct packet_stream
+#include "speclist.h"
+#define packet_stream_list_iterate(streamlist, pstream) \
+  TYPED_LIST_ITERATE(struct packet_stream, streamlist, pstream)
+#define packet_stream_list_iterate_end LIST_ITERATE_END
+
+static struct packet_stream_list *ruleset_streams = NULL;
+
 static bool load_rulesetdir(const char *rsdir, bool compat_mode,
                             rs_conversion_logger logger,
                             bool act, bool buffer_script, bool load_luadata);
+static void ruleset_streams_free(void);
 static struct section_file *openload_ruleset_file(const char *whichset,
                                                   const char *rsdir);
 
@@ -446,6 +458,8 @@ static int ruleset_purge_redundant_reqs_enablers(void)
              && (purge_redundant_req_vec(&ae->actor_reqs, actor_reqs)
                  || purge_redundant_req_vec(&ae->target_reqs,
                                             target_reqs))) {
+        req_program_invalidate(&ae->actor_reqs_prog);
+        req_program_invalidate(&ae->target_reqs_prog);
         purged++;
       }
     } action_enabler_list_iterate_end;
@@ -475,6 +489,7 @@ static int ruleset_purge_redundant_reqs_effects(void)
     /* Do the purging. */
     effect_list_iterate(get_effects(type), eft) {
       while (purge_redundant_req_vec(&eft->reqs, msg)) {
+        req_program_invalidate(&eft->reqs_prog);
         purged++;
       }
     } effect_list_iterate_end;
@@ -2808,6 +2823,7 @@ static bool load_ruleset_buildings(struct section_file *file,
       }
 
       requirement_vector_copy(&b->reqs, reqs);
+      req_program_invalidate(&b->reqs_prog);
 
       {
         struct requirement_vector *obs_reqs =
@@ -7973,6 +7989,7 @@ static bool load_ruleset_actions(struct section_file *file,
         }
 
         requirement_vector_copy(&enabler->actor_reqs, actor_reqs);
+        req_program_invalidate(&enabler->actor_reqs_prog);
 
         target_reqs = lookup_req_list(file, compat, sec_name, "target_reqs", action_text);
         if (target_reqs == NULL) {
@@ -7981,6 +7998,7 @@ static bool load_ruleset_actions(struct section_file *file,
         }
 
         requirement_vector_copy(&enabler->target_reqs, target_reqs);
+        req_program_invalidate(&enabler->target_reqs_prog);
 
         action_enabler_add(enabler);
       } section_list_iterate_end;
@@ -9048,8 +9066,6 @@ static void send_ruleset_nations(struct conn_list *dest)
     lsend_packet_ruleset_nation(dest, &packet);
   } nations_iterate_end;
 
-  /* Send initial values of is_pickable */
-  send_nation_availability(dest, FALSE);
 }
 
 /**********************************************************************//**
@@ -9365,6 +9381,7 @@ static void nullcheck_secfile_destroy(struct section_file *file)
 **************************************************************************/
 void rulesets_deinit(void)
 {
+  ruleset_streams_free();
   script_server_free();
   requirement_vector_free(&reqs_list);
 }
@@ -9389,6 +9406,7 @@ static bool load_rulesetdir(const char *rsdir, bool compat_mode,
   compat_info.compat_mode = compat_mode;
   compat_info.log_cb = logger;
 
+  ruleset_streams_free();
   game_ruleset_free();
   /* Reset the list of available player colors. */
   playercolor_free();
@@ -9657,12 +9675,44 @@ bool reload_rulesets_settings(void)
 }
 
 /**********************************************************************//**
-  Send all ruleset information to the specified connections.
+  Forget the ruleset packets recorded by send_rulesets().
 **************************************************************************/
-void send_rulesets(struct conn_list *dest)
+static void ruleset_streams_free(void)
 {
-  conn_list_compression_freeze(dest);
+  if (ruleset_streams != NULL) {
+    packet_stream_list_destroy(ruleset_streams);
+    ruleset_streams = NULL;
+  }
+}
 
+/**********************************************************************//**
+  Send the ruleset packets recorded for a previous connection to the
+  connection. Returns FALSE if there are none it can use.
+**************************************************************************/
+static bool send_rulesets_recorded(struct connection *pconn)
+{
+  if (ruleset_streams == NULL) {
+    return FALSE;
+  }
+
+  packet_stream_list_iterate(ruleset_streams, pstream) {
+    if (packet_stream_replay(pstream, pconn)) {
+      log_verbose("Sent %lu bytes of recorded ruleset packets to %s.",
+                  (unsigned long) packet_stream_size(pstream),
+                  conn_description(pconn));
+      return TRUE;
+    }
+  } packet_stream_list_iterate_end;
+
+  return FALSE;
+}
+
+/**********************************************************************//**
+  Send the ruleset packets which don't change until the rulesets are
+  loaded again.
+**************************************************************************/
+static void send_rulesets_static(struct conn_list *dest)
+{
   /* ruleset_control also indicates to client that ruleset sending starts. */
   send_ruleset_control(dest);
 
@@ -9699,6 +9749,50 @@ void send_rulesets(struct conn_list *dest)
   send_ruleset_multipliers(dest);
   send_ruleset_musics(dest);
   send_ruleset_cache(dest);
+}
+
+/**********************************************************************//**
+  Send all ruleset information to the specified connections.
+
+  The packets sent to a single connection are recorded, and sent as they
+  are to the next connections using the same capability, so that they
+  are neither built nor compressed again.
+**************************************************************************/
+void send_rulesets(struct conn_list *dest)
+{
+  struct connection *pconn = NULL;
+
+#ifndef FREECIV_JSON_CONNECTION
+  if (conn_list_size(dest) == 1) {
+    pconn = conn_list_get(dest, 0);
+  }
+#endif /* FREECIV_JSON_CONNECTION */
+
+  conn_list_compression_freeze(dest);
+
+  if (pconn == NULL || !send_rulesets_recorded(pconn)) {
+    if (pconn != NULL) {
+      packet_stream_record_start(pconn);
+    }
+
+    send_rulesets_static(dest);
+
+    if (pconn != NULL) {
+      struct packet_stream *pstream = packet_stream_record_stop(pconn);
+
+      if (pstream != NULL) {
+        if (ruleset_streams == NULL) {
+          ruleset_streams
+            = packet_stream_list_new_full(packet_stream_destroy);
+        }
+        packet_stream_list_append(ruleset_streams, pstream);
+      }
+    }
+  }
+
+  /* Send initial values of is_pickable. They change during the game, so
+   * they are not recorded. */
+  send_nation_availability(dest, FALSE);
 
   /* Indicate client that all rulesets have now been sent. */
   lsend_packet_rulesets_ready(dest);
@@ -0,0 +1,401 @@
+/***********************************************************************
+ Freeciv - Copyright (C) 1996 - A Kjeldberg, L Gregersen, P Unold
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2, or (at your option)
+   any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+***********************************************************************/
+
+/*
+  Delta savegames.
+
+  A delta savegame holds only the entries of a full savegame that differ
+  from an earlier full savegame, the checkpoint. Besides the changed and
+  new entries, stored in sections of their usual names, it has a
+  [savedelta] section:
+
+  [savedelta]
+  base             = name of the checkpoint file, in the same directory
+  deleted_sections = sections of the checkpoint not in the savegame
+  deleted_entries  = "section.entry" paths of the checkpoint not in the
+                     savegame
+
+  Deltas are always made against the checkpoint itself, never against
+  another delta, so loading one only needs to apply it to its checkpoint.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include <fc_config.h>
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+/* utility */
+#include "log.h"
+#include "registry.h"
+#include "string_vector.h"
+#include "support.h"
+
+#include "savedelta.h"
+
+#define SAVEDELTA_SECTION "savedelta"
+
+/* Entries of one section by their names. */
+#define SPECHASH_TAG delta_entry
+#define SPECHASH_CSTR_KEY_TYPE
+#define SPECHASH_IDATA_TYPE struct entry *
+#include "spechash.h"
+
+/************************************************************************//**
+  Append a copy of the entry to the section.
+****************************************************************************/
+static void delta_entry_copy(struct section *psection,
+                             const struct entry *pentry)
+{
+  const char *name = entry_name(pentry);
+
+  switch (entry_type_get(pentry)) {
+  case ENTRY_BOOL:
+    {
+      bool val;
+
+      if (entry_bool_get(pentry, &val)) {
+        section_entry_bool_new(psection, name, val);
+      }
+    }
+    break;
+  case ENTRY_INT:
+    {
+      int val;
+
+      if (entry_int_get(pentry, &val)) {
+        section_entry_int_new(psection, name, val);
+      }
+    }
+    break;
+  case ENTRY_FLOAT:
+    {
+      float val;
+
+      if (entry_float_get(pentry, &val)) {
+        section_entry_float_new(psection, name, val);
+      }
+    }
+    break;
+  case ENTRY_STR:
+    {
+      const char *val;
+
+      if (entry_str_get(pentry, &val)) {
+        section_entry_str_new(psection, name, val, entry_str_escaped(pentry));
+      }
+    }
+    break;
+  case ENTRY_FILEREFERENCE:
+  case ENTRY_LONG_COMMENT:
+  case ENTRY_ILLEGAL:
+    break;
+  }
+}
+
+/************************************************************************//**
+  Give the value of the entry 'src' to the same named entry of the
+  section, replacing it if it has another type.
+****************************************************************************/
+static void delta_entry_assign(struct section_file *secfile,
+                               struct section *psection,
+                               const struct entry *src)
+{
+  struct entry *dest = secfile_entry_lookup(secfile, "%s.%s",
+                                            section_name(psection),
+                                            entry_name(src));
+
+  if (dest != NULL && entry_type_get(dest) == entry_type_get(src)) {
+    switch (entry_type_get(src)) {
+    case ENTRY_BOOL:
+      {
+        bool val;
+
+        entry_bool_get(src, &val);
+        entry_bool_set(dest, val);
+      }
+      return;
+    case ENTRY_INT:
+      {
+        int val;
+
+        entry_int_get(src, &val);
+        entry_int_set(dest, val);
+      }
+      return;
+    case ENTRY_FLOAT:
+      {
+        float val;
+
+        entry_float_get(src, &val);
+        entry_float_set(dest, val);
+      }
+      return;
+    case ENTRY_STR:
+      {
+        const char *val;
+
+        entry_str_get(src, &val);
+        entry_str_set(dest, val);
+        entry_str_set_escaped(dest, entry_str_escaped(src));
+      }
+      return;
+    case ENTRY_FILEREFERENCE:
+    case ENTRY_LONG_COMMENT:
+    case ENTRY_ILLEGAL:
+      break;
+    }
+  }
+
+  entry_destroy(dest);
+  delta_entry_copy(psection, src);
+}
+
+/************************************************************************//**
+  Return the length of the "name<number>." row prefix of an entry name
+  that is a cell of a table, or 0 if it is not one.
+****************************************************************************/
+static size_t delta_table_row_len(const char *name)
+{
+  const char *c = name;
+
+  while (fc_isalpha(*c) || *c == '_') {
+    c++;
+  }
+  if (c == name || !fc_isdigit(*c)) {
+    return 0;
+  }
+  while (fc_isdigit(*c)) {
+    c++;
+  }
+
+  return *c == '.' ? c + 1 - name : 0;
+}
+
+/************************************************************************//**
+  Make a delta of the full savegame 'full' against the checkpoint 'base',
+  whose file name is 'base_name'. Applying the returned delta to the
+  checkpoint gives back the contents of 'full'.
+****************************************************************************/
+struct section_file *savedelta_new(const struct section_file *base,
+                                   const struct section_file *full,
+                                   const char *base_name)
+{
+  struct section_file *delta = secfile_new(TRUE);
+  struct strvec *deleted_sections = strvec_new();
+  struct strvec *deleted_entries = strvec_new();
+  char path[1024];
+
+  /* Keep the delta information first in the file. */
+  secfile_section_new(delta, SAVEDELTA_SECTION);
+
+  section_list_iterate(secfile_sections(base), psection) {
+    if (secfile_section_by_name(full, section_name(psection)) == NULL) {
+      strvec_append(deleted_sections, section_name(psection));
+    }
+  } section_list_iterate_end;
+
+  section_list_iterate(secfile_sections(full), psection) {
+    const char *name = section_name(psection);
+    const struct section *bsection = secfile_section_by_name(base, name);
+    struct section *dsection = NULL;
+    struct delta_entry_hash *bentries = NULL;
+    const struct entry_list_link *plink, *next, *row_start;
+    size_t row_len;
+    bool row_changed;
+
+    if (bsection != NULL) {
+      const struct entry_list *plist = section_entries(bsection);
+
+      bentries = delta_entry_hash_new_nentries(entry_list_size(plist));
+      entry_list_iterate(plist, pentry) {
+        delta_entry_hash_insert(bentries, entry_name(pentry), pentry);
+      } entry_list_iterate_end;
+    } else {
+      /* A new section is needed in the delta even if it is empty. */
+      dsection = secfile_section_new(delta, name);
+    }
+
+    /* Table rows are copied whole, so that they are still saved in the
+     * tabular format. */
+    row_start = entry_list_head(section_entries(psection));
+    row_len = 0;
+    row_changed = FALSE;
+    for (plink = row_start; plink != NULL; plink = entry_list_link_next(plink)) {
+      const struct entry *pentry = entry_list_link_data(plink);
+      const char *ename = entry_name(pentry);
+      struct entry *bentry = NULL;
+
+      if (bentries != NULL
+          && delta_entry_hash_lookup(bentries, ename, &bentry)) {
+        delta_entry_hash_remove(bentries, ename);
+      }
+
+      if (bentry == NULL || !entry_equal(bentry, pentry)) {
+        row_changed = TRUE;
+      }
+
+      next = entry_list_link_next(plink);
+      if (row_len == 0) {
+        row_len = delta_table_row_len(ename);
+      }
+      if (next == NULL || row_len == 0
+          || 0 != strncmp(ename, entry_name(entry_list_link_data(next)),
+                          row_len)) {
+        /* End of the row. */
+        if (row_changed) {
+          const struct entry_list_link *plink2;
+
+          if (dsection == NULL) {
+            dsection = secfile_section_new(delta, name);
+          }
+          for (plink2 = row_start; plink2 != next;
+               plink2 = entry_list_link_next(plink2)) {
+            delta_entry_copy(dsection, entry_list_link_data(plink2));
+          }
+        }
+        row_start = next;
+        row_len = 0;
+        row_changed = FALSE;
+      }
+    }
+
+    if (bentries != NULL) {
+      /* What is left of the checkpoint section is gone now. */
+      entry_list_iterate(section_entries(bsection), pentry) {
+        if (delta_entry_hash_lookup(bentries, entry_name(pentry), NULL)) {
+          entry_path(pentry, path, sizeof(path));
+          strvec_append(deleted_entries, path);
+        }
+      } entry_list_iterate_end;
+      delta_entry_hash_destroy(bentries);
+    }
+  } section_list_iterate_end;
+
+  secfile_insert_str(delta, base_name, SAVEDELTA_SECTION ".base");
+  secfile_insert_str_vec(delta, strvec_data(deleted_sections),
+                         strvec_size(deleted_sections),
+                         SAVEDELTA_SECTION ".deleted_sections");
+  secfile_insert_str_vec(delta, strvec_data(deleted_entries),
+                         strvec_size(deleted_entries),
+                         SAVEDELTA_SECTION ".deleted_entries");
+
+  strvec_destroy(deleted_sections);
+  strvec_destroy(deleted_entries);
+
+  return delta;
+}
+
+/************************************************************************//**
+  Apply the delta to its checkpoint.
+****************************************************************************/
+static void savedelta_apply(struct section_file *base,
+                            const struct section_file *delta)
+{
+  const char **names;
+  size_t dim, i;
+
+  names = secfile_lookup_str_vec(delta, &dim, SAVEDELTA_SECTION
+                                 ".deleted_sections");
+  for (i = 0; i < dim; i++) {
+    section_destroy(secfile_section_by_name(base, names[i]));
+  }
+  free(names);
+
+  names = secfile_lookup_str_vec(delta, &dim, SAVEDELTA_SECTION
+                                 ".deleted_entries");
+  for (i = 0; i < dim; i++) {
+    secfile_entry_delete(base, "%s", names[i]);
+  }
+  free(names);
+
+  section_list_iterate(secfile_sections(delta), dsection) {
+    const char *name = section_name(dsection);
+    struct section *psection;
+
+    if (0 == strcmp(name, SAVEDELTA_SECTION)) {
+      continue;
+    }
+
+    psection = secfile_section_by_name(base, name);
+    if (psection == NULL) {
+      psection = secfile_section_new(base, name);
+      entry_list_iterate(section_entries(dsection), pentry) {
+        delta_entry_copy(psection, pentry);
+      } entry_list_iterate_end;
+    } else {
+      entry_list_iterate(section_entries(dsection), pentry) {
+        delta_entry_assign(base, psection, pentry);
+      } entry_list_iterate_end;
+    }
+  } section_list_iterate_end;
+}
+
+/************************************************************************//**
+  Load a savegame file. If it is a delta savegame, its checkpoint is
+  loaded from the same directory and the delta is applied to it, so the
+  caller always gets the full savegame. Returns NULL on failure.
+****************************************************************************/
+struct section_file *savedelta_secfile_load(const char *filename)
+{
+  struct section_file *delta, *base;
+  const char *base_name, *slash;
+  char base_path[1024];
+
+  /* Only the delta section is needed to tell a delta from a full
+   * savegame, the rest is parsed when applied or loaded. */
+  delta = secfile_load_lazy(filename, FALSE);
+  if (delta == NULL
+      || secfile_section_by_name(delta, SAVEDELTA_SECTION) == NULL) {
+    /* Failure, or a full savegame. */
+    return delta;
+  }
+
+  base_name = secfile_lookup_str(delta, SAVEDELTA_SECTION ".base");
+  if (base_name == NULL || strchr(base_name, '/') != NULL) {
+    log_error("Delta savegame %s has no valid checkpoint name.", filename);
+    secfile_destroy(delta);
+    return NULL;
+  }
+
+  slash = strrchr(filename, '/');
+  if (slash != NULL) {
+    fc_snprintf(base_path, sizeof(base_path), "%.*s/%s",
+                (int) (slash - filename), filename, base_name);
+  } else {
+    sz_strlcpy(base_path, base_name);
+  }
+
+  base = secfile_load(base_path, FALSE);
+  if (base == NULL) {
+    log_error("Can't load the checkpoint %s of the delta savegame %s: %s",
+              base_path, filename, secfile_error());
+    secfile_destroy(delta);
+    return NULL;
+  }
+  if (secfile_section_by_name(base, SAVEDELTA_SECTION) != NULL) {
+    log_error("The checkpoint %s of the delta savegame %s is a delta "
+              "savegame itself.", base_path, filename);
+    secfile_destroy(base);
+    secfile_destroy(delta);
+    return NULL;
+  }
+
+  log_verbose("Applying delta savegame %s to checkpoint %s.",
+              filename, base_path);
+  savedelta_apply(base, delta);
+  secfile_destroy(delta);
+
+  return base;
+}
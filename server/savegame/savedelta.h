@@ -0,0 +1,23 @@
+/***********************************************************************
+ Freeciv - Copyright (C) 1996 - A Kjeldberg, L Gregersen, P Unold
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2, or (at your option)
+   any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+***********************************************************************/
+#ifndef FC__SAVEDELTA_H
+#define FC__SAVEDELTA_H
+
+struct section_file;
+
+struct section_file *savedelta_new(const struct section_file *base,
+                                   const struct section_file *full,
+                                   const char *base_name);
+struct section_file *savedelta_secfile_load(const char *filename);
+
+#endif /* FC__SAVEDELTA_H */
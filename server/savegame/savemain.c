@@ -15,7 +15,27 @@
 #include <fc_config.h>
 #endif
 
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef FREECIV_HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
+#ifdef HAVE_SIGNAL_H
+#include <signal.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
 /* utility */
+#include "ioz.h"
 #include "log.h"
 #include "mem.h"
 #include "registry.h"
@@ -28,15 +48,42 @@
 /* server */
 #include "console.h"
 #include "notify.h"
+#include "sernet.h"
 
 /* server/savegame */
+#include "savedelta.h"
 #include "savegame2.h"
 #include "savegame3.h"
 
 #include "savemain.h"
 
+#if defined(HAVE_WORKING_FORK) && defined(HAVE_SYS_WAIT_H) \
+  && defined(HAVE_SIGNAL_H) && !defined(FREECIV_MSWINDOWS)
+/* Threaded saves fork a snapshot process that builds the whole savegame. */
+#define HAVE_SAVE_PROCESS
+
+/* Seconds to wait for the previous snapshot process to finish. */
+#define SAVE_PROCESS_TIMEOUT 120
+#endif
+
 static fc_thread *save_thread = NULL;
 
+#ifdef HAVE_SAVE_PROCESS
+static pid_t save_process = -1;
+static char save_process_filepath[600];
+#endif /* HAVE_SAVE_PROCESS */
+
+/* The full turn autosave that later turn autosaves are written as
+ * deltas against. */
+static struct {
+  char filepath[600];
+  /* Kept in memory when built by this process. */
+  struct section_file *sfile;
+  int deltas;
+  /* Set when the checkpoint must not be used any more. */
+  bool invalid;
+} checkpoint = { "", NULL, 0, FALSE };
+
 /************************************************************************//**
   Main entry point for loading a game.
 ****************************************************************************/
@@ -46,6 +93,9 @@ void savegame_load(struct section_file *sfile)
 
   fc_assert_ret(sfile != NULL);
 
+  /* Start the deltas of the loaded game from a checkpoint of its own. */
+  checkpoint.invalid = TRUE;
+
 #ifdef DEBUG_TIMERS
   struct timer *loadtimer = timer_new(TIMER_CPU, TIMER_DEBUG, "load");
   timer_start(loadtimer);
@@ -105,51 +155,290 @@ struct save_thread_data
   char filepath[600];
   int save_compress_level;
   enum fz_method save_compress_type;
+  bool binary;
+  bool delta;           /* Write a delta against the checkpoint */
+  bool checkpoint;      /* This is the new checkpoint */
+  bool keep_sfile;      /* The section file is kept as the checkpoint */
 };
 
+/************************************************************************//**
+  Return the file name part of the path.
+****************************************************************************/
+static const char *path_file_name(const char *path)
+{
+  const char *slash = strrchr(path, '/');
+
+  return slash != NULL ? slash + 1 : path;
+}
+
+/************************************************************************//**
+  Forget the checkpoint. Must not be called while a save is in progress.
+****************************************************************************/
+static void checkpoint_clear(void)
+{
+  if (checkpoint.sfile != NULL) {
+    secfile_destroy(checkpoint.sfile);
+    checkpoint.sfile = NULL;
+  }
+  checkpoint.filepath[0] = '\0';
+  checkpoint.deltas = 0;
+  checkpoint.invalid = FALSE;
+}
+
+/************************************************************************//**
+  Decide whether the turn autosave of save_thread_data becomes a delta
+  against the checkpoint or the new checkpoint.
+****************************************************************************/
+static void checkpoint_plan(struct save_thread_data *stdata)
+{
+  const char *name = path_file_name(stdata->filepath);
+  size_t dir_len = name - stdata->filepath;
+
+  if (game.server.checkpoint_turns <= 0) {
+    checkpoint_clear();
+    return;
+  }
+
+  /* The delta is loaded along with a checkpoint in the same directory. */
+  if (checkpoint.filepath[0] != '\0'
+      && checkpoint.deltas + 1 < game.server.checkpoint_turns
+      && (size_t) (path_file_name(checkpoint.filepath) - checkpoint.filepath)
+         == dir_len
+      && 0 == strncmp(checkpoint.filepath, stdata->filepath, dir_len)) {
+    stdata->delta = TRUE;
+    checkpoint.deltas++;
+  } else {
+    checkpoint_clear();
+    stdata->checkpoint = TRUE;
+    sz_strlcpy(checkpoint.filepath, stdata->filepath);
+  }
+}
+
+/************************************************************************//**
+  Build the section file of save_thread_data.
+****************************************************************************/
+static void save_thread_data_build(struct save_thread_data *stdata,
+                                   const char *save_reason, bool scenario)
+{
+  struct section_file *base, *delta;
+
+  /* Allowing duplicates shouldn't be allowed. However, it takes very too
+   * long time for huge game saving... */
+  stdata->sfile = secfile_new(TRUE);
+  savegame_save(stdata->sfile, save_reason, scenario);
+
+  if (!stdata->delta) {
+    return;
+  }
+
+  base = checkpoint.sfile;
+  if (base == NULL) {
+    base = secfile_load(checkpoint.filepath, FALSE);
+    if (base == NULL) {
+      log_error("Can't load the checkpoint %s, saving the whole game: %s",
+                checkpoint.filepath, secfile_error());
+      return;
+    }
+  }
+
+  delta = savedelta_new(base, stdata->sfile,
+                        path_file_name(checkpoint.filepath));
+  secfile_destroy(stdata->sfile);
+  stdata->sfile = delta;
+
+  if (base != checkpoint.sfile) {
+    secfile_destroy(base);
+  }
+}
+
 /************************************************************************//**
   Free resources of save_thread_data, including itself
 ****************************************************************************/
 static void save_thread_data_free(struct save_thread_data *stdata)
 {
-  secfile_destroy(stdata->sfile);
+  if (stdata->sfile != NULL && !stdata->keep_sfile) {
+    secfile_destroy(stdata->sfile);
+  }
   free(stdata);
 }
 
+/************************************************************************//**
+  Write the section file of save_thread_data to its file.
+****************************************************************************/
+static bool save_thread_data_write(struct save_thread_data *stdata)
+{
+  if (stdata->binary) {
+    return secfile_save_binary(stdata->sfile, stdata->filepath,
+                               stdata->save_compress_level,
+                               stdata->save_compress_type);
+  } else {
+    return secfile_save(stdata->sfile, stdata->filepath,
+                        stdata->save_compress_level,
+                        stdata->save_compress_type);
+  }
+}
+
+/************************************************************************//**
+  Tell about the result of a save.
+****************************************************************************/
+static void save_report(const char *filepath, bool success)
+{
+  if (!success) {
+    con_write(C_FAIL, _("Failed saving game as %s"), filepath);
+    notify_conn(NULL, NULL, E_LOG_ERROR, ftc_warning, _("Failed saving game."));
+  } else {
+    con_write(C_OK, _("Game saved as %s"), filepath);
+  }
+}
+
 /************************************************************************//**
   Run game saving thread.
 ****************************************************************************/
 static void save_thread_run(void *arg)
 {
   struct save_thread_data *stdata = (struct save_thread_data *)arg;
-  
-  if (!secfile_save(stdata->sfile, stdata->filepath, stdata->save_compress_level,
-                    stdata->save_compress_type)) {
-    con_write(C_FAIL, _("Failed saving game as %s"), stdata->filepath);
+  bool success = save_thread_data_write(stdata);
+
+  if (!success) {
     log_error("Game saving failed: %s", secfile_error());
-    notify_conn(NULL, NULL, E_LOG_ERROR, ftc_warning, _("Failed saving game."));
-  } else {
-    con_write(C_OK, _("Game saved as %s"), stdata->filepath);
+    if (stdata->checkpoint) {
+      /* Read by the main thread only after this one has finished. */
+      checkpoint.invalid = TRUE;
+    }
   }
+  save_report(stdata->filepath, success);
 
   save_thread_data_free(stdata);
 }
 
+#ifdef HAVE_SAVE_PROCESS
 /************************************************************************//**
-  Unconditionally save the game, with specified filename.
-  Always prints a message: either save ok, or failed.
+  Check if the snapshot process has finished, and report its result if
+  so. With 'block' wait for it to finish, but for SAVE_PROCESS_TIMEOUT
+  seconds at most: a process that takes longer is assumed to be stuck,
+  and gets killed. Returns FALSE if it had to be killed.
 ****************************************************************************/
-void save_game(const char *orig_filename, const char *save_reason,
-               bool scenario)
+static bool save_process_reap(bool block)
+{
+  int status;
+  pid_t ret;
+  bool success;
+  time_t deadline = time(NULL) + SAVE_PROCESS_TIMEOUT;
+  bool killed = FALSE;
+
+  if (save_process < 0) {
+    return TRUE;
+  }
+
+  for (;;) {
+    ret = waitpid(save_process, &status, WNOHANG);
+    if (ret < 0 && errno == EINTR) {
+      continue;
+    }
+    if (ret != 0) {
+      break;
+    }
+    if (!block) {
+      /* Still running. */
+      return TRUE;
+    }
+    if (time(NULL) >= deadline) {
+      log_error("The save process did not finish in %d seconds, "
+                "killing it.", SAVE_PROCESS_TIMEOUT);
+      kill(save_process, SIGKILL);
+      do {
+        ret = waitpid(save_process, &status, 0);
+      } while (ret < 0 && errno == EINTR);
+      killed = TRUE;
+      break;
+    }
+    fc_usleep(10000);
+  }
+
+  success = (!killed && ret == save_process && WIFEXITED(status)
+             && WEXITSTATUS(status) == EXIT_SUCCESS);
+  if (!success && 0 == strcmp(save_process_filepath, checkpoint.filepath)) {
+    checkpoint.invalid = TRUE;
+  }
+  save_report(save_process_filepath, success);
+  save_process = -1;
+
+  return !killed;
+}
+
+/************************************************************************//**
+  Fork a process to build and write the savegame. The child gets a
+  copy-on-write snapshot of the whole server, so it can run the usual
+  savegame code while the game continues in this process. Returns FALSE
+  if the process could not be started.
+****************************************************************************/
+static bool save_process_start(struct save_thread_data *stdata,
+                               const char *save_reason, bool scenario)
+{
+  pid_t pid;
+
+  /* Do not duplicate unwritten output in the child. */
+  fflush(NULL);
+
+  pid = fork();
+  if (pid < 0) {
+    log_error("Could not fork the save process: %s",
+              fc_strerror(fc_get_errno()));
+    return FALSE;
+  }
+
+  if (pid == 0) {
+    /* Inside the child. Leave interrupts to the game process, and never
+     * touch the connections; the result is told by the exit status. */
+    bool success;
+
+    signal(SIGINT, SIG_IGN);
+#ifdef SIGHUP
+    signal(SIGHUP, SIG_IGN);
+#endif
+    signal(SIGTERM, SIG_DFL);
+
+    close_sockets_in_fork_child();
+
+    save_thread_data_build(stdata, save_reason, scenario);
+    success = save_thread_data_write(stdata);
+    if (!success) {
+      log_error("Game saving failed: %s", secfile_error());
+    }
+
+    _exit(success ? EXIT_SUCCESS : EXIT_FAILURE);
+  }
+
+  save_process = pid;
+  sz_strlcpy(save_process_filepath, stdata->filepath);
+
+  return TRUE;
+}
+#endif /* HAVE_SAVE_PROCESS */
+
+/************************************************************************//**
+  Save the game. Turn autosaves may be written as deltas against the
+  latest full turn autosave.
+****************************************************************************/
+static void save_game_real(const char *orig_filename, const char *save_reason,
+                           bool scenario, bool turn_autosave)
 {
   char *dot, *filename;
   struct timer *timer_cpu, *timer_user;
   struct save_thread_data *stdata;
+#ifdef HAVE_SAVE_PROCESS
+  bool fork_usable;
+#endif
 
   stdata = fc_malloc(sizeof(*stdata));
 
   stdata->save_compress_type = game.server.save_compress_type;
   stdata->save_compress_level = game.server.save_compress_level;
+  /* Scenarios are meant to be distributed and edited, keep them as text. */
+  stdata->binary = game.server.save_binary && !scenario;
+  stdata->delta = FALSE;
+  stdata->checkpoint = FALSE;
+  stdata->keep_sfile = FALSE;
 
   if (!orig_filename) {
     stdata->filepath[0] = '\0';
@@ -202,15 +491,7 @@ void save_game(const char *orig_filename, const char *save_reason,
   timer_start(timer_cpu);
   timer_start(timer_user);
 
-  /* Allowing duplicates shouldn't be allowed. However, it takes very too
-   * long time for huge game saving... */
-  stdata->sfile = secfile_new(TRUE);
-  savegame_save(stdata->sfile, save_reason, scenario);
-
-  /* We have consistent game state in stdata->sfile now, so
-   * we could pass it to the saving thread already. We want to
-   * handle below notify_conn() and directory creation in
-   * main thread, though. */
+  stdata->sfile = NULL;
 
   /* Append ".sav" to filename. */
   sz_strlcat(stdata->filepath, ".sav");
@@ -298,19 +579,48 @@ void save_game(const char *orig_filename, const char *save_reason,
   if (save_thread != NULL) {
     /* Previously started thread */
     fc_thread_wait(save_thread);
-    if (!game.server.threaded_save) {
-      /* Setting has changed since the last save */
-      free(save_thread);
-      save_thread = NULL;
-    }
-  } else if (game.server.threaded_save) {
-    save_thread = fc_malloc(sizeof(save_thread));
+    free(save_thread);
+    save_thread = NULL;
   }
 
-  if (save_thread != NULL) {
-    fc_thread_start(save_thread, &save_thread_run, stdata);
-  } else {
-    save_thread_run(stdata);
+#ifdef HAVE_SAVE_PROCESS
+  /* Previously started snapshot process. Saves are written in order. If
+   * it got stuck, build this save in this process instead. */
+  fork_usable = save_process_reap(TRUE);
+#endif /* HAVE_SAVE_PROCESS */
+
+  if (checkpoint.invalid) {
+    checkpoint_clear();
+  }
+  if (turn_autosave && !scenario) {
+    checkpoint_plan(stdata);
+  }
+
+  fz_set_compress_threads(game.server.save_compress_threads);
+
+#ifdef HAVE_SAVE_PROCESS
+  if (game.server.threaded_save && fork_usable
+      && save_process_start(stdata, save_reason, scenario)) {
+    save_thread_data_free(stdata);
+    stdata = NULL;
+  }
+#endif /* HAVE_SAVE_PROCESS */
+
+  if (stdata != NULL) {
+    save_thread_data_build(stdata, save_reason, scenario);
+    if (stdata->checkpoint) {
+      checkpoint.sfile = stdata->sfile;
+      stdata->keep_sfile = TRUE;
+    }
+
+    /* We have consistent game state in stdata->sfile now, so
+     * we could pass it to the saving thread already. */
+    if (game.server.threaded_save) {
+      save_thread = fc_malloc(sizeof(*save_thread));
+      fc_thread_start(save_thread, &save_thread_run, stdata);
+    } else {
+      save_thread_run(stdata);
+    }
   }
 
 #ifdef LOG_TIMERS
@@ -322,6 +632,25 @@ void save_game(const char *orig_filename, const char *save_reason,
   timer_destroy(timer_user);
 }
 
+/************************************************************************//**
+  Unconditionally save the game, with specified filename.
+  Always prints a message: either save ok, or failed.
+****************************************************************************/
+void save_game(const char *orig_filename, const char *save_reason,
+               bool scenario)
+{
+  save_game_real(orig_filename, save_reason, scenario, FALSE);
+}
+
+/************************************************************************//**
+  Make the turn autosave. Between full checkpoints, only the changes
+  since the checkpoint are saved if the 'checkpointturns' setting says so.
+****************************************************************************/
+void save_game_turn(const char *filename, const char *save_reason)
+{
+  save_game_real(filename, save_reason, FALSE, TRUE);
+}
+
 /************************************************************************//**
   Close saving system.
 ****************************************************************************/
@@ -332,5 +661,46 @@ void save_system_close(void)
     free(save_thread);
     save_thread = NULL;
   }
+
+#ifdef HAVE_SAVE_PROCESS
+  save_process_reap(TRUE);
+#endif
+
+  checkpoint_clear();
+}
+
+/************************************************************************//**
+  Return the path of the checkpoint that the next turn autosave would be
+  a delta against, or NULL if there's none. The saves in progress are
+  finished first, so that the checkpoint file is complete.
+****************************************************************************/
+const char *save_checkpoint_path(void)
+{
+  if (save_thread != NULL) {
+    fc_thread_wait(save_thread);
+    free(save_thread);
+    save_thread = NULL;
+  }
+
+#ifdef HAVE_SAVE_PROCESS
+  save_process_reap(TRUE);
+#endif
+
+  if (checkpoint.invalid || checkpoint.filepath[0] == '\0') {
+    return NULL;
+  }
+
+  return checkpoint.filepath;
+}
+
+/************************************************************************//**
+  Report the result of a save that has finished in the background.
+  Called regularly from the main loop.
+****************************************************************************/
+void save_system_poll(void)
+{
+#ifdef HAVE_SAVE_PROCESS
+  save_process_reap(FALSE);
+#endif
 }
 
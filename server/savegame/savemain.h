@@ -24,7 +24,10 @@ void savegame_save(struct section_file *sfile, const char *save_reason,
 
 void save_game(const char *orig_filename, const char *save_reason,
                bool scenario);
+void save_game_turn(const char *filename, const char *save_reason);
+const char *save_checkpoint_path(void);
 
 void save_system_close(void);
+void save_system_poll(void);
 
 #endif /* FC__SAVEMAIN_H */
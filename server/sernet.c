@@ -45,6 +45,9 @@
 #include <readline/history.h>
 #include <readline/readline.h>
 #endif
+#ifdef HAVE_EPOLL
+#include <sys/epoll.h>
+#endif
 #ifdef HAVE_SYS_SELECT_H
 #include <sys/select.h>
 #endif
@@ -84,11 +87,16 @@
 #include "connecthand.h"
 #include "console.h"
 #include "meta.h"
+#include "netwriter.h"
 #include "plrhand.h"
 #include "srv_main.h"
+#include "srv_prof.h"
 #include "stdinhand.h"
 #include "voting.h"
 
+/* server/savegame */
+#include "savemain.h"
+
 #include "sernet.h"
 
 static struct connection connections[MAX_NUM_CONNECTIONS];
@@ -134,6 +142,444 @@ static void send_lanserver_response(void);
 
 static bool no_input = FALSE;
 
+/* Readiness of the sockets, as found by sniff_wait() and flush_wait() */
+#define SOCK_READABLE  (1 << 0)
+#define SOCK_WRITABLE  (1 << 1)
+#define SOCK_EXCEPTION (1 << 2)
+
+static unsigned char conn_ready[MAX_NUM_CONNECTIONS];
+static unsigned char *listen_ready;
+static bool stdin_ready = FALSE;
+
+#ifdef HAVE_EPOLL
+/* The epoll data of the sockets which are not connections. Connections
+ * are tagged with their index in connections[]. */
+#define EPOLL_TAG_STDIN  MAX_NUM_CONNECTIONS
+#define EPOLL_TAG_LISTEN (MAX_NUM_CONNECTIONS + 1)
+
+enum epoll_stdin {
+  EPOLL_STDIN_NONE,             /* Not registered */
+  EPOLL_STDIN_POLLED,           /* Registered to sniff_epfd */
+  EPOLL_STDIN_ALWAYS            /* Can't be polled, e.g. a regular file */
+};
+
+/* The sockets are registered once, to sniff_epfd for the main loop, and
+ * write interest is armed only while the send buffer has data. As
+ * flush_packets() waits only for the connections with data, they are
+ * registered to flush_epfd only meanwhile. When epoll is not available
+ * at run time, sniff_epfd is -1 and select() is used instead. */
+static int sniff_epfd = -1;
+static int flush_epfd = -1;
+static uint32_t sniff_armed[MAX_NUM_CONNECTIONS];
+static bool flush_armed[MAX_NUM_CONNECTIONS];
+static enum epoll_stdin stdin_epoll = EPOLL_STDIN_NONE;
+static struct epoll_event *epoll_events;
+static int epoll_events_num;
+
+/*************************************************************************//**
+  Add, modify or remove the registration of 'fd' to 'epfd'.
+*****************************************************************************/
+static bool epoll_register(int epfd, int op, int fd, uint32_t events,
+                           uint32_t tag)
+{
+  struct epoll_event ev;
+
+  memset(&ev, 0, sizeof(ev));
+  ev.events = events;
+  ev.data.u32 = tag;
+
+  return epoll_ctl(epfd, op, fd, &ev) == 0;
+}
+
+/*************************************************************************//**
+  Close the epoll instances. select() will be used from now on.
+*****************************************************************************/
+static void epoll_close(void)
+{
+  if (sniff_epfd >= 0) {
+    close(sniff_epfd);
+    sniff_epfd = -1;
+  }
+  if (flush_epfd >= 0) {
+    close(flush_epfd);
+    flush_epfd = -1;
+  }
+  stdin_epoll = EPOLL_STDIN_NONE;
+  FC_FREE(epoll_events);
+  epoll_events_num = 0;
+}
+
+/*************************************************************************//**
+  Create the epoll instances and register the listening sockets. On
+  failure, the server falls back to select().
+*****************************************************************************/
+static void epoll_open(void)
+{
+  int i;
+
+  sniff_epfd = epoll_create1(EPOLL_CLOEXEC);
+  flush_epfd = epoll_create1(EPOLL_CLOEXEC);
+  if (sniff_epfd < 0 || flush_epfd < 0) {
+    log_error("epoll_create1() failed: %s, using select() instead.",
+              fc_strerror(fc_get_errno()));
+    epoll_close();
+    return;
+  }
+
+  for (i = 0; i < listen_count; i++) {
+    if (!epoll_register(sniff_epfd, EPOLL_CTL_ADD, listen_socks[i],
+                        EPOLLIN | EPOLLPRI, EPOLL_TAG_LISTEN + i)) {
+      log_error("epoll_ctl() failed: %s, using select() instead.",
+                fc_strerror(fc_get_errno()));
+      epoll_close();
+      return;
+    }
+  }
+
+  epoll_events_num = MAX_NUM_CONNECTIONS + 1 + listen_count;
+  epoll_events = fc_calloc(epoll_events_num, sizeof(*epoll_events));
+}
+
+/*************************************************************************//**
+  Register a new connection socket. A previous socket of the same
+  connection slot has been removed from the epoll instances by
+  epoll_remove_connection() when it was closed.
+*****************************************************************************/
+static bool epoll_add_connection(int idx, int sock)
+{
+  if (sniff_epfd < 0) {
+    return TRUE;
+  }
+
+  flush_armed[idx] = FALSE;
+  sniff_armed[idx] = EPOLLIN | EPOLLPRI;
+  if (!epoll_register(sniff_epfd, EPOLL_CTL_ADD, sock, sniff_armed[idx],
+                      idx)) {
+    log_error("epoll_ctl() failed: %s", fc_strerror(fc_get_errno()));
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+/*************************************************************************//**
+  Remove the socket of a connection which is being closed from the epoll
+  instances. Closing the socket is not enough to drop the registrations
+  when another process, such as a savegame child, still holds a
+  duplicate of it.
+*****************************************************************************/
+static void epoll_remove_connection(int idx, int sock)
+{
+  if (sniff_epfd < 0) {
+    return;
+  }
+
+  epoll_ctl(sniff_epfd, EPOLL_CTL_DEL, sock, NULL);
+  if (flush_armed[idx]) {
+    epoll_ctl(flush_epfd, EPOLL_CTL_DEL, sock, NULL);
+  }
+  sniff_armed[idx] = 0;
+  flush_armed[idx] = FALSE;
+}
+
+/*************************************************************************//**
+  Keep the stdin registration in line with no_input.
+*****************************************************************************/
+static void epoll_update_stdin(void)
+{
+#if !defined(FREECIV_SOCKET_ZERO_NOT_STDIN) && !defined(__VMS)
+  if (no_input) {
+    if (stdin_epoll == EPOLL_STDIN_POLLED) {
+      epoll_ctl(sniff_epfd, EPOLL_CTL_DEL, 0, NULL);
+    }
+    stdin_epoll = EPOLL_STDIN_NONE;
+  } else if (stdin_epoll == EPOLL_STDIN_NONE) {
+    if (epoll_register(sniff_epfd, EPOLL_CTL_ADD, 0, EPOLLIN,
+                       EPOLL_TAG_STDIN)) {
+      stdin_epoll = EPOLL_STDIN_POLLED;
+    } else {
+      /* Files can't be polled, but select() reports them ready. */
+      stdin_epoll = EPOLL_STDIN_ALWAYS;
+    }
+  }
+#endif /* !FREECIV_SOCKET_ZERO_NOT_STDIN && !__VMS */
+}
+
+/*************************************************************************//**
+  Wait for the main loop events with epoll.
+*****************************************************************************/
+static int sniff_wait_epoll(fc_timeval *tv)
+{
+  int timeout = tv->tv_sec * 1000 + tv->tv_usec / 1000;
+  int i, num;
+
+  epoll_update_stdin();
+  if (stdin_epoll == EPOLL_STDIN_ALWAYS) {
+    timeout = 0;
+  }
+
+  conn_list_iterate(game.all_connections, pconn) {
+    int idx = pconn - connections;
+    uint32_t events = EPOLLIN | EPOLLPRI;
+
+    if (!pconn->server.is_closing && 0 < pconn->send_buffer->ndata) {
+      events |= EPOLLOUT;
+    }
+    if (events != sniff_armed[idx]
+        && epoll_register(sniff_epfd, EPOLL_CTL_MOD, pconn->sock, events,
+                          idx)) {
+      sniff_armed[idx] = events;
+    }
+  } conn_list_iterate_end;
+
+  num = epoll_wait(sniff_epfd, epoll_events, epoll_events_num, timeout);
+  if (num < 0) {
+    log_error("epoll_wait() failed: %s", fc_strerror(fc_get_errno()));
+    return num;
+  }
+
+  for (i = 0; i < num; i++) {
+    uint32_t events = epoll_events[i].events;
+    uint32_t tag = epoll_events[i].data.u32;
+    unsigned char ready = 0;
+
+    if (events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+      ready |= SOCK_READABLE;
+    }
+    if (events & EPOLLOUT) {
+      ready |= SOCK_WRITABLE;
+    }
+    if (events & EPOLLPRI) {
+      ready |= SOCK_EXCEPTION;
+    }
+
+    if (tag < MAX_NUM_CONNECTIONS) {
+      conn_ready[tag] = ready;
+    } else if (tag == EPOLL_TAG_STDIN) {
+      stdin_ready = (ready & SOCK_READABLE) != 0;
+    } else {
+      listen_ready[tag - EPOLL_TAG_LISTEN] = ready;
+    }
+  }
+
+  if (stdin_epoll == EPOLL_STDIN_ALWAYS) {
+    stdin_ready = TRUE;
+    num++;
+  }
+
+  return num;
+}
+
+/*************************************************************************//**
+  Wait with epoll until some of the connections with data to send can
+  be written to.
+*****************************************************************************/
+static int flush_wait_epoll(fc_timeval *tv, unsigned char *ready)
+{
+  int timeout = tv->tv_sec * 1000 + tv->tv_usec / 1000;
+  int waiting = 0;
+  int i, ret;
+
+  conn_list_iterate(game.all_connections, pconn) {
+    int idx = pconn - connections;
+    bool want = (!pconn->server.is_closing
+                 && 0 < pconn->send_buffer->ndata);
+
+    if (want && !flush_armed[idx]) {
+      flush_armed[idx] = epoll_register(flush_epfd, EPOLL_CTL_ADD,
+                                        pconn->sock, EPOLLOUT | EPOLLPRI,
+                                        idx);
+    } else if (!want && flush_armed[idx]) {
+      epoll_ctl(flush_epfd, EPOLL_CTL_DEL, pconn->sock, NULL);
+      flush_armed[idx] = FALSE;
+    }
+    if (want) {
+      waiting++;
+    }
+  } conn_list_iterate_end;
+
+  if (waiting == 0) {
+    return 0;
+  }
+
+  ret = epoll_wait(flush_epfd, epoll_events, epoll_events_num, timeout);
+  if (ret < 0) {
+    log_error("epoll_wait() failed: %s", fc_strerror(fc_get_errno()));
+    return ret;
+  }
+
+  for (i = 0; i < ret; i++) {
+    uint32_t events = epoll_events[i].events;
+
+    /* Errors are found out by trying to write. */
+    ready[epoll_events[i].data.u32]
+      = ((events & (EPOLLOUT | EPOLLHUP | EPOLLERR) ? SOCK_WRITABLE : 0)
+         | (events & EPOLLPRI ? SOCK_EXCEPTION : 0));
+  }
+
+  return ret;
+}
+#endif /* HAVE_EPOLL */
+
+/*************************************************************************//**
+  Wait for the main loop events with select().
+*****************************************************************************/
+static int sniff_wait_select(fc_timeval *tv)
+{
+  fd_set readfs, writefs, exceptfs;
+  int max_desc = 0;
+  int i, ret;
+
+  FC_FD_ZERO(&readfs);
+  FC_FD_ZERO(&writefs);
+  FC_FD_ZERO(&exceptfs);
+
+#if !defined(FREECIV_SOCKET_ZERO_NOT_STDIN) && !defined(__VMS)
+  if (!no_input) {
+    FD_SET(0, &readfs);
+  }
+#endif /* !FREECIV_SOCKET_ZERO_NOT_STDIN && !__VMS */
+
+  for (i = 0; i < listen_count; i++) {
+    FD_SET(listen_socks[i], &readfs);
+    FD_SET(listen_socks[i], &exceptfs);
+    max_desc = MAX(max_desc, listen_socks[i]);
+  }
+
+  for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
+    struct connection *pconn = connections + i;
+
+    if (pconn->used && !pconn->server.is_closing) {
+      FD_SET(pconn->sock, &readfs);
+      if (0 < pconn->send_buffer->ndata) {
+        FD_SET(pconn->sock, &writefs);
+      }
+      FD_SET(pconn->sock, &exceptfs);
+      max_desc = MAX(pconn->sock, max_desc);
+    }
+  }
+
+  ret = fc_select(max_desc + 1, &readfs, &writefs, &exceptfs, tv);
+  if (ret < 0) {
+    log_error("fc_select() failed: %s", fc_strerror(fc_get_errno()));
+  }
+  if (ret <= 0) {
+    return ret;
+  }
+
+#if !defined(FREECIV_SOCKET_ZERO_NOT_STDIN) && !defined(__VMS)
+  stdin_ready = (!no_input && FD_ISSET(0, &readfs));
+#endif /* !FREECIV_SOCKET_ZERO_NOT_STDIN && !__VMS */
+
+  for (i = 0; i < listen_count; i++) {
+    listen_ready[i] = ((FD_ISSET(listen_socks[i], &readfs)
+                        ? SOCK_READABLE : 0)
+                       | (FD_ISSET(listen_socks[i], &exceptfs)
+                          ? SOCK_EXCEPTION : 0));
+  }
+
+  for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
+    struct connection *pconn = connections + i;
+
+    if (pconn->used && !pconn->server.is_closing) {
+      conn_ready[i] = ((FD_ISSET(pconn->sock, &readfs) ? SOCK_READABLE : 0)
+                       | (FD_ISSET(pconn->sock, &writefs)
+                          ? SOCK_WRITABLE : 0)
+                       | (FD_ISSET(pconn->sock, &exceptfs)
+                          ? SOCK_EXCEPTION : 0));
+    }
+  }
+
+  return ret;
+}
+
+/*************************************************************************//**
+  Wait with select() until some of the connections with data to send
+  can be written to.
+*****************************************************************************/
+static int flush_wait_select(fc_timeval *tv, unsigned char *ready)
+{
+  fd_set writefs, exceptfs;
+  int max_desc = -1;
+  int i, ret;
+
+  FC_FD_ZERO(&writefs);
+  FC_FD_ZERO(&exceptfs);
+
+  for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
+    struct connection *pconn = &connections[i];
+
+    if (pconn->used
+        && !pconn->server.is_closing
+        && 0 < pconn->send_buffer->ndata) {
+      FD_SET(pconn->sock, &writefs);
+      FD_SET(pconn->sock, &exceptfs);
+      max_desc = MAX(pconn->sock, max_desc);
+    }
+  }
+
+  if (max_desc == -1) {
+    return 0;
+  }
+
+  ret = fc_select(max_desc + 1, NULL, &writefs, &exceptfs, tv);
+  if (ret <= 0) {
+    return ret;
+  }
+
+  for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
+    struct connection *pconn = &connections[i];
+
+    if (pconn->used && !pconn->server.is_closing) {
+      ready[i] = ((FD_ISSET(pconn->sock, &writefs) ? SOCK_WRITABLE : 0)
+                  | (FD_ISSET(pconn->sock, &exceptfs) ? SOCK_EXCEPTION : 0));
+    }
+  }
+
+  return ret;
+}
+
+/*************************************************************************//**
+  Wait up to 'tv' for input from the server operator, new connections
+  and input from the connections, or for the connections with data to
+  send to become writable. The results are stored into stdin_ready,
+  listen_ready[] and conn_ready[]. Returns the number of ready sockets,
+  0 on timeout or a negative value on error.
+*****************************************************************************/
+static int sniff_wait(fc_timeval *tv)
+{
+  stdin_ready = FALSE;
+  memset(listen_ready, 0, listen_count * sizeof(*listen_ready));
+  memset(conn_ready, 0, sizeof(conn_ready));
+
+#ifdef HAVE_EPOLL
+  if (sniff_epfd >= 0) {
+    return sniff_wait_epoll(tv);
+  }
+#endif /* HAVE_EPOLL */
+
+  return sniff_wait_select(tv);
+}
+
+/*************************************************************************//**
+  Wait up to 'tv' for the connections with data to send to become
+  writable. The results are stored into ready[MAX_NUM_CONNECTIONS].
+  Returns the number of ready sockets, or 0 if there was nothing to
+  wait for or on timeout, or a negative value on error.
+*****************************************************************************/
+static int flush_wait(fc_timeval *tv, unsigned char *ready)
+{
+  memset(ready, 0, MAX_NUM_CONNECTIONS * sizeof(*ready));
+
+#ifdef HAVE_EPOLL
+  if (flush_epfd >= 0) {
+    return flush_wait_epoll(tv, ready);
+  }
+#endif /* HAVE_EPOLL */
+
+  return flush_wait_select(tv, ready);
+}
+
 /* Avoid compiler warning about defined, but unused function
  * by defining it only when needed */
 #if defined(FREECIV_HAVE_LIBREADLINE) || \
@@ -240,6 +686,9 @@ static void close_connection(struct connection *pconn)
   conn_pattern_list_destroy(pconn->server.ignore_list);
   pconn->server.ignore_list = NULL;
 
+  FC_FREE(pconn->server.tile_chunk);
+  netwriter_forget(pconn);
+
   /* safe to do these even if not in lists: */
   conn_list_remove(game.web_client_connections, pconn);
   conn_list_remove(game.glob_observers, pconn);
@@ -249,6 +698,11 @@ static void close_connection(struct connection *pconn)
   pconn->playing = NULL;
   pconn->client_gui = GUI_STUB;
   pconn->access_level = ALLOW_NONE;
+#ifdef HAVE_EPOLL
+  if (pconn->used) {
+    epoll_remove_connection(pconn - connections, pconn->sock);
+  }
+#endif /* HAVE_EPOLL */
   connection_common_close(pconn);
 
   send_updated_vote_totals(NULL);
@@ -262,6 +716,9 @@ void close_connections_and_socket(void)
 {
   int i;
 
+  /* Write the last packets from the main thread. */
+  netwriter_stop();
+
   lsend_packet_server_shutdown(game.all_connections);
 
   for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
@@ -281,6 +738,10 @@ void close_connections_and_socket(void)
     fc_closesocket(listen_socks[i]);
   }
   FC_FREE(listen_socks);
+  FC_FREE(listen_ready);
+#ifdef HAVE_EPOLL
+  epoll_close();
+#endif /* HAVE_EPOLL */
 
   if (srvarg.announce != ANNOUNCE_NONE) {
     fc_closesocket(socklan);
@@ -303,6 +764,34 @@ void close_connections_and_socket(void)
   fc_shutdown_network();
 }
 
+/*************************************************************************//**
+  In a process forked from the server, close the inherited descriptors of
+  the listening and connection sockets and of the epoll instances, so
+  that they don't stay open while the child runs. The connections
+  themselves are left alone: they belong to the parent process.
+*****************************************************************************/
+void close_sockets_in_fork_child(void)
+{
+  int i;
+
+  for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
+    if (connections[i].used && connections[i].sock >= 0) {
+      fc_closesocket(connections[i].sock);
+    }
+  }
+
+  for (i = 0; i < listen_count; i++) {
+    fc_closesocket(listen_socks[i]);
+  }
+#ifdef HAVE_EPOLL
+  epoll_close();
+#endif /* HAVE_EPOLL */
+
+  if (srvarg.announce != ANNOUNCE_NONE) {
+    fc_closesocket(socklan);
+  }
+}
+
 /*************************************************************************//**
   Now really close connections marked as 'is_closing'.
   Do this here to avoid recursive sending.
@@ -375,18 +864,36 @@ static void cut_lagging_connection(struct connection *pconn)
   }
 }
 
+/*************************************************************************//**
+  Collect what the network writer thread did with the data of the
+  connections, and cut the ones it cannot write to.
+*****************************************************************************/
+static void poll_network_writer(void)
+{
+  int i;
+
+  for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
+    struct connection *pconn = &connections[i];
+
+    if (pconn->used && netwriter_poll(pconn)) {
+      cut_lagging_connection(pconn);
+    }
+  }
+}
+
 /*************************************************************************//**
   Attempt to flush all information in the send buffers for upto 'netwait'
-  seconds.
+  seconds. When the network writer thread runs, the send buffers are
+  already handed to it, and there is nothing to wait for.
 *****************************************************************************/
-void flush_packets(void)
+static void flush_packets_real(void)
 {
   int i;
-  int max_desc;
-  fd_set writefs, exceptfs;
+  unsigned char ready[MAX_NUM_CONNECTIONS];
   fc_timeval tv;
   time_t start;
 
+  poll_network_writer();
   (void) time(&start);
 
   for (;;) {
@@ -400,27 +907,7 @@ void flush_packets(void)
     tv.tv_usec = 0;
     tv.tv_sec = signsecs;
 
-    FC_FD_ZERO(&writefs);
-    FC_FD_ZERO(&exceptfs);
-    max_desc = -1;
-
-    for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
-      struct connection *pconn = &connections[i];
-
-      if (pconn->used
-          && !pconn->server.is_closing
-          && 0 < pconn->send_buffer->ndata) {
-        FD_SET(pconn->sock, &writefs);
-        FD_SET(pconn->sock, &exceptfs);
-        max_desc = MAX(pconn->sock, max_desc);
-      }
-    }
-
-    if (max_desc == -1) {
-      return;
-    }
-
-    if (fc_select(max_desc + 1, NULL, &writefs, &exceptfs, &tv) <= 0) {
+    if (flush_wait(&tv, ready) <= 0) {
       return;
     }
 
@@ -428,13 +915,13 @@ void flush_packets(void)
       struct connection *pconn = &connections[i];
 
       if (pconn->used && !pconn->server.is_closing) {
-        if (FD_ISSET(pconn->sock, &exceptfs)) {
+        if (ready[i] & SOCK_EXCEPTION) {
           log_verbose("connection (%s) cut due to exception data",
                       conn_description(pconn));
           connection_close_server(pconn, _("network exception"));
         } else {
           if (pconn->send_buffer && pconn->send_buffer->ndata > 0) {
-            if (FD_ISSET(pconn->sock, &writefs)) {
+            if (ready[i] & SOCK_WRITABLE) {
               flush_connection_send_buffer_all(pconn);
             } else {
               cut_lagging_connection(pconn);
@@ -446,6 +933,17 @@ void flush_packets(void)
   }
 }
 
+/*************************************************************************//**
+  Attempt to flush all information in the send buffers for upto 'netwait'
+  seconds, accounting the time spent in the server profile.
+*****************************************************************************/
+void flush_packets(void)
+{
+  srv_prof_start(SRV_PROF_FLUSH_PACKETS);
+  flush_packets_real();
+  srv_prof_stop(SRV_PROF_FLUSH_PACKETS);
+}
+
 struct packet_to_handle {
   void *data;
   enum packet_type type;
@@ -528,9 +1026,7 @@ static void incoming_client_packets(struct connection *pconn)
 enum server_events server_sniff_all_input(void)
 {
   int i, s;
-  int max_desc;
   bool excepting;
-  fd_set readfs, writefs, exceptfs;
   fc_timeval tv;
 #ifdef FREECIV_SOCKET_ZERO_NOT_STDIN
   char *bufptr;
@@ -587,6 +1083,8 @@ enum server_events server_sniff_all_input(void)
       return S_E_FORCE_END_OF_SNIFF;
     }
 
+    poll_network_writer();
+    save_system_poll();
     get_lanserver_announcement();
 
     /* end server if no players for 'srvarg.quitidle' seconds,
@@ -695,42 +1193,14 @@ enum server_events server_sniff_all_input(void)
     tv.tv_sec = 1;
     tv.tv_usec = 0;
 
-    FC_FD_ZERO(&readfs);
-    FC_FD_ZERO(&writefs);
-    FC_FD_ZERO(&exceptfs);
-
-    if (!no_input) {
 #ifdef FREECIV_SOCKET_ZERO_NOT_STDIN
+    if (!no_input) {
       fc_init_console();
-#else /* FREECIV_SOCKET_ZERO_NOT_STDIN */
-#   if !defined(__VMS)
-      FD_SET(0, &readfs);
-#   endif /* VMS */
-#endif /* FREECIV_SOCKET_ZERO_NOT_STDIN */
-    }
-
-    max_desc = 0;
-    for (i = 0; i < listen_count; i++) {
-      FD_SET(listen_socks[i], &readfs);
-      FD_SET(listen_socks[i], &exceptfs);
-      max_desc = MAX(max_desc, listen_socks[i]);
-    }
-
-    for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
-      struct connection *pconn = connections + i;
-
-      if (pconn->used && !pconn->server.is_closing) {
-        FD_SET(pconn->sock, &readfs);
-        if (0 < pconn->send_buffer->ndata) {
-          FD_SET(pconn->sock, &writefs);
-        }
-        FD_SET(pconn->sock, &exceptfs);
-        max_desc = MAX(pconn->sock, max_desc);
-      }
     }
+#endif /* FREECIV_SOCKET_ZERO_NOT_STDIN */
     con_prompt_off();    /* output doesn't generate a new prompt */
 
-    selret = fc_select(max_desc + 1, &readfs, &writefs, &exceptfs, &tv);
+    selret = sniff_wait(&tv);
     if (selret == 0) {
       /* timeout */
       call_ai_refresh();
@@ -776,7 +1246,7 @@ enum server_events server_sniff_all_input(void)
             lib$stop(status);
           }
           if (ttchar.numchars) {
-            FD_SET(0, &readfs);
+            stdin_ready = TRUE;
           } else {
             continue;
           }
@@ -788,13 +1258,11 @@ enum server_events server_sniff_all_input(void)
 #endif /* FREECIV_SOCKET_ZERO_NOT_STDIN */
 #endif /* !__VMS */
       }
-    } else if (selret < 0) {
-      log_error("fc_select() failed: %s", fc_strerror(fc_get_errno()));
     }
 
     excepting = FALSE;
     for (i = 0; i < listen_count; i++) {
-      if (FD_ISSET(listen_socks[i], &exceptfs)) {
+      if (listen_ready[i] & SOCK_EXCEPTION) {
         excepting = TRUE;
         break;
       }
@@ -804,7 +1272,7 @@ enum server_events server_sniff_all_input(void)
     }
     for (i = 0; i < listen_count; i++) {
       s = listen_socks[i];
-      if (FD_ISSET(s, &readfs)) {     /* new players connects */
+      if (listen_ready[i] & SOCK_READABLE) { /* new players connects */
         log_verbose("got new connection");
         if (-1 == server_accept_connection(s)) {
           /* There will be a log_error() message from
@@ -821,7 +1289,7 @@ enum server_events server_sniff_all_input(void)
 
       if (pconn->used
           && !pconn->server.is_closing
-          && FD_ISSET(pconn->sock, &exceptfs)) {
+          && (conn_ready[i] & SOCK_EXCEPTION)) {
         log_verbose("connection (%s) cut due to exception data",
                     conn_description(pconn));
         connection_close_server(pconn, _("network exception"));
@@ -836,7 +1304,7 @@ enum server_events server_sniff_all_input(void)
       free(bufptr_internal);
     }
 #else  /* !FREECIV_SOCKET_ZERO_NOT_STDIN */
-    if (!no_input && FD_ISSET(0, &readfs)) {    /* input from server operator */
+    if (!no_input && stdin_ready) {    /* input from server operator */
 #ifdef FREECIV_HAVE_LIBREADLINE
       rl_callback_read_char();
       if (readline_handled_input) {
@@ -892,7 +1360,7 @@ enum server_events server_sniff_all_input(void)
 
         if (!pconn->used
             || pconn->server.is_closing
-            || !FD_ISSET(pconn->sock, &readfs)) {
+            || !(conn_ready[i] & SOCK_READABLE)) {
           continue;
         }
 
@@ -915,7 +1383,7 @@ enum server_events server_sniff_all_input(void)
             && !pconn->server.is_closing
             && pconn->send_buffer
             && pconn->send_buffer->ndata > 0) {
-          if (FD_ISSET(pconn->sock, &writefs)) {
+          if (conn_ready[i] & SOCK_WRITABLE) {
             flush_connection_send_buffer_all(pconn);
           } else {
             cut_lagging_connection(pconn);
@@ -1086,6 +1554,14 @@ int server_make_connection(int new_sock, const char *client_addr,
     struct connection *pconn = &connections[i];
 
     if (!pconn->used) {
+#ifdef HAVE_EPOLL
+      if (!epoll_add_connection(i, new_sock)) {
+        fc_closesocket(new_sock);
+
+        return -1;
+      }
+#endif /* HAVE_EPOLL */
+
       connection_common_init(pconn);
       pconn->sock = new_sock;
       pconn->observer = FALSE;
@@ -1103,6 +1579,8 @@ int server_make_connection(int new_sock, const char *client_addr,
       pconn->server.ignore_list =
           conn_pattern_list_new_full(conn_pattern_destroy);
       pconn->server.is_closing = FALSE;
+      pconn->server.tile_chunk = NULL;
+      pconn->server.write_queue = NULL;
       pconn->ping_time = -1.0;
       pconn->incoming_packet_notify = NULL;
       pconn->outgoing_packet_notify = NULL;
@@ -1178,6 +1656,7 @@ int server_open_socket(void)
 
   /* Loop to create sockets, bind, listen. */
   listen_socks = fc_calloc(name_count, sizeof(listen_socks[0]));
+  listen_ready = fc_calloc(name_count, sizeof(listen_ready[0]));
   listen_count = 0;
 
   fc_sockaddr_list_iterate(list, paddr) {
@@ -1270,6 +1749,10 @@ int server_open_socket(void)
 
   fc_sockaddr_list_destroy(list);
 
+#ifdef HAVE_EPOLL
+  epoll_open();
+#endif /* HAVE_EPOLL */
+
   connections_set_close_callback(server_conn_close_callback);
 
   if (srvarg.announce == ANNOUNCE_NONE) {
@@ -36,6 +36,7 @@ enum server_events server_sniff_all_input(void);
 int server_open_socket(void);
 void flush_packets(void);
 void close_connections_and_socket(void);
+void close_sockets_in_fork_child(void);
 void init_connections(void);
 int server_make_connection(int new_sock,
                            const char *client_addr, const char *client_ip);
@@ -18,6 +18,7 @@
 /* utility */
 #include "astring.h"
 #include "fcintl.h"
+#include "fcthread.h"
 #include "game.h"
 #include "ioz.h"
 #include "log.h"
@@ -34,6 +35,7 @@
 #include "maphand.h"
 #include "meta.h"
 #include "nation.h"
+#include "netwriter.h"
 #include "notify.h"
 #include "plrhand.h"
 #include "report.h"
@@ -41,6 +43,7 @@
 #include "rssanity.h"
 #include "setcompat.h"
 #include "srv_main.h"
+#include "srv_prof.h"
 #include "stdinhand.h"
 
 #include "settings.h"
@@ -571,6 +574,20 @@ scoreloglevel_name(enum scorelog_level sl_level)
   return NULL;
 }
 
+/************************************************************************//**
+  Profile log format names accessor.
+****************************************************************************/
+static const struct sset_val_name *
+proflog_name(enum proflog_format format)
+{
+  switch (format) {
+  NAME_CASE(PROFLOG_DISABLED, "DISABLED", N_("No profile log"));
+  NAME_CASE(PROFLOG_CSV, "CSV", N_("Comma separated values"));
+  NAME_CASE(PROFLOG_JSON, "JSON", N_("One JSON object per turn"));
+  }
+  return NULL;
+}
+
 /************************************************************************//**
   Savegame compress type names accessor.
 ****************************************************************************/
@@ -698,6 +715,26 @@ static void scorelog_action(const struct setting *pset)
   }
 }
 
+/************************************************************************//**
+  (Re)start the profile log with the new format or file.
+****************************************************************************/
+static void proflog_action(const struct setting *pset)
+{
+  srv_prof_log_reset();
+}
+
+/************************************************************************//**
+  Start or stop the network writer thread.
+****************************************************************************/
+static void threaded_send_action(const struct setting *pset)
+{
+  if (*pset->boolean.pvalue) {
+    netwriter_start();
+  } else {
+    netwriter_stop();
+  }
+}
+
 /************************************************************************//**
   Create the selected number of AI's.
 ****************************************************************************/
@@ -882,6 +919,21 @@ static void aitype_action(const struct setting *pset)
   Validation callback functions.
 ****************************************************************************/
 
+/************************************************************************//**
+  Verify that the network writer thread can be used.
+****************************************************************************/
+static bool threaded_send_validate(bool value, struct connection *caller,
+                                   char *reject_msg, size_t reject_msg_len)
+{
+  if (value && !has_thread_cond_impl()) {
+    settings_snprintf(reject_msg, reject_msg_len,
+                      _("This server has no full threads implementation."));
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
 /************************************************************************//**
   Verify the selected savename definition.
 ****************************************************************************/
@@ -943,6 +995,22 @@ static bool scorefile_validate(const char *value, struct connection *caller,
 
   return TRUE;
 }
+
+/************************************************************************//**
+  Verify the name for the profile log file.
+****************************************************************************/
+static bool proffile_validate(const char *value, struct connection *caller,
+                              char *reject_msg, size_t reject_msg_len)
+{
+  if (!is_safe_filename(value)) {
+    settings_snprintf(reject_msg, reject_msg_len,
+                      _("Invalid profile log name definition: '%s'."),
+                      value);
+    return FALSE;
+  }
+
+  return TRUE;
+}
 #endif /* !FREECIV_WEB */
 
 /************************************************************************//**
@@ -1939,6 +2007,26 @@ static struct setting settings[] = {
           NULL, NULL, aifill_action,
           GAME_MIN_AIFILL, GAME_MAX_AIFILL, GAME_DEFAULT_AIFILL)
 
+  GEN_INT("aithreads", game.server.ai_threads,
+          SSET_META, SSET_INTERNAL, SSET_RARE, ALLOW_HACK, ALLOW_HACK,
+          N_("Number of threads for AI planning"),
+          N_("At the beginning of each phase, the AI players assess the "
+             "dangers to their cities. This is done for several players "
+             "at once when this is set to more than one thread. The "
+             "result of the game doesn't depend on this value."),
+          NULL, NULL, NULL,
+          GAME_MIN_AI_THREADS, GAME_MAX_AI_THREADS, GAME_DEFAULT_AI_THREADS)
+
+  GEN_INT("cmthreads", game.server.cm_threads,
+          SSET_META, SSET_INTERNAL, SSET_RARE, ALLOW_HACK, ALLOW_HACK,
+          N_("Number of threads for arranging city workers"),
+          N_("When the workers of all the cities of a player are "
+             "rearranged at once, the cities which don't share tiles "
+             "are handled at the same time by this number of threads. "
+             "The result of the game doesn't depend on this value."),
+          NULL, NULL, NULL,
+          GAME_MIN_CM_THREADS, GAME_MAX_CM_THREADS, GAME_DEFAULT_CM_THREADS)
+
   GEN_ENUM("persistentready", game.info.persistent_ready,
            SSET_META, SSET_NETWORK, SSET_RARE, ALLOW_NONE, ALLOW_BASIC,
 	  N_("When the Readiness of a player gets autotoggled off"),
@@ -3016,6 +3104,20 @@ static struct setting settings[] = {
              "wait at all."), NULL, NULL, NULL,
           GAME_MIN_NETWAIT, GAME_MAX_NETWAIT, GAME_DEFAULT_NETWAIT)
 
+  GEN_BOOL("threaded_send", game.server.threaded_send,
+           SSET_META, SSET_NETWORK, SSET_RARE, ALLOW_HACK, ALLOW_HACK,
+           N_("Whether to write to the network in separate thread"),
+           /* TRANS: The strings between single quotes are setting names and
+            * should not be translated. */
+           N_("If this is turned on, the data sent to the clients is "
+              "written to the network by a background thread, so that "
+              "the game does not wait for slow clients. The 'netwait' "
+              "setting has then no effect, and connections are cut for "
+              "lagging only after 'nettimeout' seconds without any "
+              "progress."),
+           threaded_send_validate, threaded_send_action,
+           GAME_DEFAULT_THREADED_SEND)
+
   GEN_INT("pingtime", game.server.pingtime,
           SSET_META, SSET_NETWORK, SSET_RARE, ALLOW_NONE, ALLOW_BASIC,
           N_("Seconds between PINGs"),
@@ -3110,6 +3212,20 @@ static struct setting settings[] = {
              "includes \"New turn\"."), NULL, NULL, NULL,
           GAME_MIN_SAVETURNS, GAME_MAX_SAVETURNS, GAME_DEFAULT_SAVETURNS)
 
+  GEN_INT("checkpointturns", game.server.checkpoint_turns,
+          SSET_META, SSET_INTERNAL, SSET_RARE, ALLOW_HACK, ALLOW_HACK,
+          N_("Turn auto-saves per full checkpoint"),
+          /* TRANS: The strings between single quotes are setting names
+           * and shouldn't be translated. */
+          N_("If this is more than one, only every this many turn "
+             "auto-saves is a full savegame, the checkpoint. The ones in "
+             "between record just the changes since the checkpoint, which "
+             "makes them much smaller. Loading such a savegame needs the "
+             "checkpoint in the same directory. With zero or one, every "
+             "turn auto-save is a full savegame. See also 'saveturns'."),
+          NULL, NULL, NULL, GAME_MIN_CHECKPOINTTURNS,
+          GAME_MAX_CHECKPOINTTURNS, GAME_DEFAULT_CHECKPOINTTURNS)
+
   GEN_INT("savefrequency", game.server.save_frequency,
           SSET_META, SSET_INTERNAL, SSET_VITAL, ALLOW_HACK, ALLOW_HACK,
           N_("Minutes per auto-save"),
@@ -3147,10 +3263,13 @@ static struct setting settings[] = {
            N_("Whether to do saving in separate thread"),
            /* TRANS: The string between single quotes is a setting name and
             * should not be translated. */
-           N_("If this is turned in, compressing and saving the actual "
-              "file containing the game situation takes place in "
+           N_("If this is turned in, saving the game takes place in "
               "the background while game otherwise continues. This way "
-              "users are not required to wait for the save to finish."),
+              "users are not required to wait for the save to finish. "
+              "Where the system supports it, a snapshot of the server "
+              "process builds and writes the whole savegame; otherwise "
+              "only compressing and saving the actual file takes place "
+              "in a separate thread."),
            NULL, NULL, GAME_DEFAULT_THREADED_SAVE)
 
   GEN_INT("compress", game.server.save_compress_level,
@@ -3169,6 +3288,34 @@ static struct setting settings[] = {
            N_("Compression library to use for savegames."),
            NULL, NULL, NULL, compresstype_name, GAME_DEFAULT_COMPRESS_TYPE)
 
+  GEN_INT("compressthreads", game.server.save_compress_threads,
+          SSET_META, SSET_INTERNAL, SSET_RARE, ALLOW_HACK, ALLOW_HACK,
+          N_("Savegame compression threads"),
+          /* TRANS: The strings between double quotes are also translated
+           * separately (they must match!). The string between single
+           * quotes is a setting name and shouldn't be translated. */
+          N_("Number of threads compressing savegames with the "
+             "\"Using xz\" and \"Using zstd\" 'compresstype' "
+             "algorithms. Several threads compress the savegame in "
+             "separate blocks, which makes it slightly larger, but the "
+             "file can be loaded like any other."),
+          NULL, NULL, NULL, GAME_MIN_COMPRESS_THREADS,
+          GAME_MAX_COMPRESS_THREADS, GAME_DEFAULT_COMPRESS_THREADS)
+
+  GEN_BOOL("savebinary", game.server.save_binary,
+           SSET_META, SSET_INTERNAL, SSET_RARE, ALLOW_HACK, ALLOW_HACK,
+           N_("Whether to save games in binary format"),
+           /* TRANS: The strings between single quotes are setting names
+            * and should not be translated. */
+           N_("If this is turned on, saved games are written in a binary "
+              "encoding of the same data as the default text format. It "
+              "is quicker to read and write, but larger and not human "
+              "readable. Loading the game takes as much memory as with "
+              "the text format. The 'compress' and 'compresstype' "
+              "settings apply to it as well. Scenarios are always saved "
+              "in the text format."),
+           NULL, NULL, GAME_DEFAULT_SAVE_BINARY)
+
   GEN_STRING("savename", game.server.save_name,
              SSET_META, SSET_INTERNAL, SSET_VITAL, ALLOW_HACK, ALLOW_HACK,
              N_("Definition of the save file name"),
@@ -3226,6 +3373,35 @@ static struct setting settings[] = {
              scorefile_validate, NULL, GAME_DEFAULT_SCOREFILE)
 #endif /* !FREECIV_WEB */
 
+  GEN_ENUM("proflog", game.server.proflog,
+           SSET_META, SSET_INTERNAL, SSET_RARE,
+#ifdef FREECIV_WEB
+           ALLOW_NONE, ALLOW_CTRL,
+#else /* FREECIV_WEB */
+           ALLOW_HACK, ALLOW_HACK,
+#endif /* FREECIV_WEB */
+           N_("Format of the server profile log"),
+           /* TRANS: The string between single quotes is a setting name and
+            * should not be translated. */
+           N_("If this is not disabled, the time spent by the server in "
+              "each phase of the turn, with the number of memory "
+              "allocations and the packet bytes it caused, is appended "
+              "to the file defined by the option 'proffile' every "
+              "turn, either as comma separated values or as one JSON "
+              "object per line."), NULL, NULL, proflog_action,
+           proflog_name, GAME_DEFAULT_PROFLOG)
+
+#ifndef FREECIV_WEB
+  GEN_STRING("proffile", game.server.proffile,
+             SSET_META, SSET_INTERNAL, SSET_RARE,
+             ALLOW_HACK, ALLOW_HACK,
+             N_("Name for the profile log file"),
+             /* TRANS: Don't translate the string in single quotes. */
+             N_("The default name for the profile log file is "
+                "'freeciv-prof.log'."),
+             proffile_validate, proflog_action, GAME_DEFAULT_PROFFILE)
+#endif /* !FREECIV_WEB */
+
   GEN_INT("maxconnectionsperhost", game.server.maxconnectionsperhost,
           SSET_RULES_FLEXIBLE, SSET_NETWORK, SSET_RARE,
           ALLOW_NONE, ALLOW_BASIC,
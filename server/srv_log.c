@@ -32,6 +32,9 @@
 #include "nation.h"
 #include "unit.h"
 
+/* common/aicore */
+#include "path_finding.h"
+
 /* server */
 #include "notify.h"
 #include "srv_main.h"
@@ -210,6 +213,30 @@ void timing_results_real(void)
   AILOG_OUT(" - Settler want", AIT_CITY_SETTLERS);
   AILOG_OUT("Citizen arrange", AIT_CITIZEN_ARRANGE);
   AILOG_OUT("Tech", AIT_TECH);
+
+  {
+    const struct pf_map_stats *pf_stats = pf_map_stats_get();
+
+    fc_snprintf(buf, sizeof(buf),
+                "  Path-finding: %u maps created, %lu bytes recycled, "
+                "%lu bytes allocated this turn",
+                pf_stats->maps_created,
+                (unsigned long) pf_stats->bytes_recycled,
+                (unsigned long) pf_stats->bytes_allocated);
+#ifdef LOG_TIMERS
+    log_test("%s", buf);
+#endif
+    notify_conn(NULL, NULL, E_AI_DEBUG, ftc_log, "%s", buf);
+    fc_snprintf(buf, sizeof(buf),
+                "  Path-finding cache: %u hits, %u misses, "
+                "%u invalidations this turn",
+                pf_stats->cache_hits, pf_stats->cache_misses,
+                pf_stats->cache_invalidations);
+#ifdef LOG_TIMERS
+    log_test("%s", buf);
+#endif
+    notify_conn(NULL, NULL, E_AI_DEBUG, ftc_log, "%s", buf);
+  }
 }
 
 /**********************************************************************//**
@@ -64,6 +64,7 @@
 
 /* common/aicore */
 #include "citymap.h"
+#include "path_finding.h"
 
 /* common */
 #include "achievements.h"
@@ -115,6 +116,7 @@
 #include "settings.h"
 #include "spacerace.h"
 #include "srv_log.h"
+#include "srv_prof.h"
 #include "stdinhand.h"
 #include "techtools.h"
 #include "unithand.h"
@@ -283,6 +285,9 @@ void srv_init(void)
   srvarg.auth_allow_guests = FALSE;
   srvarg.auth_allow_newusers = FALSE;
 
+  srvarg.pregame_callback = NULL;
+  srvarg.game_over_callback = NULL;
+
   /* Mark as initialized */
   has_been_srv_init = TRUE;
 
@@ -925,6 +930,7 @@ static void update_diplomatics(void)
           if (state->turns_left <= 0) {
             state->type = DS_PEACE;
             state2->type = DS_PEACE;
+            pf_map_cache_invalidate();
             state->turns_left = 0;
             state2->turns_left = 0;
             remove_illegal_armistice_units(plr1, plr2);
@@ -958,6 +964,7 @@ static void update_diplomatics(void)
                           nation_plural_for_player(plr1));
             state->type = DS_WAR;
             state2->type = DS_WAR;
+            pf_map_cache_invalidate();
             state->turns_left = 0;
             state2->turns_left = 0;
 
@@ -1091,12 +1098,18 @@ static void kill_dying_players(void)
 **************************************************************************/
 static void ai_start_phase(void)
 {
+  srv_prof_start(SRV_PROF_AI_START_PHASE);
+
+  call_ai_phase_planning();
+
   phase_players_iterate(pplayer) {
     if (is_ai(pplayer)) {
       CALL_PLR_AI_FUNC(first_activities, pplayer, pplayer);
     }
   } phase_players_iterate_end;
   kill_dying_players();
+
+  srv_prof_stop(SRV_PROF_AI_START_PHASE);
 }
 
 /**********************************************************************//**
@@ -1138,6 +1151,19 @@ static void begin_turn(bool is_new_turn)
   send_game_info(NULL);
 
   if (is_new_turn) {
+    log_debug("Path-finding: %u maps created, %u lattices recycled "
+              "(%lu bytes), %lu bytes allocated during previous turn.",
+              pf_map_stats_get()->maps_created,
+              pf_map_stats_get()->lattices_recycled,
+              (unsigned long) pf_map_stats_get()->bytes_recycled,
+              (unsigned long) pf_map_stats_get()->bytes_allocated);
+    log_debug("Path-finding cache: %u hits, %u misses, %u invalidations "
+              "during previous turn.",
+              pf_map_stats_get()->cache_hits,
+              pf_map_stats_get()->cache_misses,
+              pf_map_stats_get()->cache_invalidations);
+    pf_map_stats_reset();
+
     script_server_signal_emit("turn_begin",
                               (lua_Integer)game.info.turn,
                               (lua_Integer)game.info.year);
@@ -1280,10 +1306,12 @@ static void begin_phase(bool is_new_phase)
       }
     } whole_map_iterate_end;
 
+    srv_prof_start(SRV_PROF_UPDATE_UNIT_ACTIVITIES);
     phase_players_iterate(pplayer) {
       update_unit_activities(pplayer);
       flush_packets();
     } phase_players_iterate_end;
+    srv_prof_stop(SRV_PROF_UPDATE_UNIT_ACTIVITIES);
 
     /* Execute orders after activities have been completed (roads built,
      * pillage done, etc.). */
@@ -1461,6 +1489,7 @@ static void end_phase(void)
   send_city_suppression(TRUE);
 
   /* AI end of turn activities */
+  srv_prof_start(SRV_PROF_AI_END_PHASE);
   players_iterate(pplayer) {
     unit_list_iterate(pplayer->units, punit) {
       CALL_PLR_AI_FUNC(unit_turn_end, pplayer, punit);
@@ -1472,6 +1501,7 @@ static void end_phase(void)
       CALL_PLR_AI_FUNC(last_activities, pplayer, pplayer);
     }
   } phase_players_iterate_end;
+  srv_prof_stop(SRV_PROF_AI_END_PHASE);
 
   /* Refresh cities */
   phase_players_iterate(pplayer) {
@@ -1504,7 +1534,9 @@ static void end_phase(void)
     old_gold = pplayer->economic.gold;
     pplayer->server.bulbs_last_turn = 0;
 
+    srv_prof_start(SRV_PROF_UPDATE_CITY_ACTIVITIES);
     update_city_activities(pplayer);
+    srv_prof_stop(SRV_PROF_UPDATE_CITY_ACTIVITIES);
 
     update_national_activities(pplayer, old_gold);
 
@@ -1818,7 +1850,14 @@ void save_game_auto(const char *save_reason, enum autosave_type type)
   } else {
     fc_snprintf(filename, sizeof(filename), "%s-timer", game.server.save_name);
   }
-  save_game(filename, save_reason, FALSE);
+
+  srv_prof_start(SRV_PROF_SAVEGAME);
+  if (type == AS_TURN) {
+    save_game_turn(filename, save_reason);
+  } else {
+    save_game(filename, save_reason, FALSE);
+  }
+  srv_prof_stop(SRV_PROF_SAVEGAME);
 }
 
 /**********************************************************************//**
@@ -1875,6 +1914,9 @@ void fc__noreturn server_quit(void)
     } phase_players_iterate_end;
   }
 
+  /* Let a background save finish. */
+  save_system_close();
+
   if (game.server.save_timer != NULL) {
     timer_destroy(game.server.save_timer);
     game.server.save_timer = NULL;
@@ -1915,6 +1957,8 @@ void fc__noreturn server_quit(void)
   generator_free();
   close_connections_and_socket();
   rulesets_deinit();
+  ai_phase_planning_free();
+  auto_arrange_workers_free();
   CALL_FUNC_EACH_AI(module_close);
   timing_log_free();
   registry_module_close();
@@ -2870,7 +2914,10 @@ static void srv_running(void)
      * We have to initialize data as well as do some actions.  However when
      * loading a game we don't want to do these actions (like AI unit
      * movement and AI diplomacy). */
+    srv_prof_turn_begin();
+    srv_prof_start(SRV_PROF_BEGIN_TURN);
     begin_turn(is_new_turn);
+    srv_prof_stop(SRV_PROF_BEGIN_TURN);
 
     if (game.server.num_phases != 1) {
       /* We allow everyone to begin adjusting cities and such
@@ -2883,7 +2930,9 @@ static void srv_running(void)
     for (; game.info.phase < game.server.num_phases; game.info.phase++) {
       log_debug("Starting phase %d/%d.", game.info.phase,
                 game.server.num_phases);
+      srv_prof_start(SRV_PROF_BEGIN_PHASE);
       begin_phase(is_new_turn);
+      srv_prof_stop(SRV_PROF_BEGIN_PHASE);
       if (need_send_pending_events) {
         /* When loading a savegame, we need to send loaded events, after
          * the clients switched to the game page (after the first
@@ -2967,7 +3016,9 @@ static void srv_running(void)
        */
       lsend_packet_freeze_client(game.est_connections);
 
+      srv_prof_start(SRV_PROF_END_PHASE);
       end_phase();
+      srv_prof_stop(SRV_PROF_END_PHASE);
 
       conn_list_do_unbuffer(game.est_connections);
 
@@ -2984,7 +3035,10 @@ static void srv_running(void)
      * where phase is too high for is_new_turn to get set. */
     is_new_turn = TRUE;
 
+    srv_prof_start(SRV_PROF_END_TURN);
     end_turn();
+    srv_prof_stop(SRV_PROF_END_TURN);
+    srv_prof_turn_end();
     log_debug("Sendinfotometaserver");
     (void) send_server_info_to_metaserver(META_REFRESH);
 
@@ -3461,6 +3515,10 @@ void server_game_free(void)
 {
   CALL_FUNC_EACH_AI(game_free);
 
+  /* The next game may have another map size. */
+  pf_map_cache_free();
+  pf_map_pools_free();
+
   /* Free all the treaties that were left open when game finished. */
   free_treaties();
 
@@ -3494,6 +3552,7 @@ void server_game_free(void)
 
   event_cache_free();
   log_civ_score_free();
+  srv_prof_free();
   playercolor_free();
   citymap_free();
   game_free();
@@ -3521,6 +3580,10 @@ void fc__noreturn srv_main(void)
       event_cache_clear();
     }
 
+    if (NULL != srvarg.pregame_callback) {
+      srvarg.pregame_callback();
+    }
+
     log_normal(_("Now accepting new client connections on port %d."),
                srvarg.port);
     /* Remain in S_S_INITIAL until all players are ready. */
@@ -3535,6 +3598,10 @@ void fc__noreturn srv_main(void)
       srv_ready(); /* srv_ready() sets server state to S_S_RUNNING. */
       srv_running();
       srv_scores();
+
+      if (NULL != srvarg.game_over_callback) {
+        srvarg.game_over_callback();
+      }
     }
 
     /* Remain in S_S_OVER until players log out */
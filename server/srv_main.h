@@ -59,6 +59,9 @@ struct server_arguments {
   bool auth_allow_newusers;     /* defaults to FALSE */
   enum announce_type announce;
   int fatal_assertions;         /* default to -1 (disabled). */
+  /* hooks for programs running the server, such as freeciv-bench */
+  void (*pregame_callback)(void);   /* before waiting for the players */
+  void (*game_over_callback)(void); /* before the game is freed */
 };
 
 /* used in savegame values */
@@ -0,0 +1,400 @@
+/***********************************************************************
+ Freeciv - Copyright (C) 1996 - A Kjeldberg, L Gregersen, P Unold
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2, or (at your option)
+   any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+***********************************************************************/
+
+/**********************************************************************
+  Per-turn profile of the server. While the 'proflog' setting is
+  enabled, the wall clock time, the CPU time, the number of memory
+  allocations and the packet bytes of the main phases of the turn are
+  accounted, and one record per turn is appended to the 'proffile'.
+
+  The phases nest: every phase is accounted separately for each phase
+  it is called from (its parent), and its figures include those of the
+  phases it calls. A phase called again while it is already running is
+  accounted only once, for the outermost call.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <fc_config.h>
+#endif
+
+#include <stdio.h>
+#include <string.h>
+
+/* utility */
+#include "log.h"
+#include "mem.h"
+#include "shared.h"
+#include "support.h"
+#include "timing.h"
+
+/* common */
+#include "connection.h"
+#include "game.h"
+
+#include "srv_prof.h"
+
+/* The parent of the phases called directly from the turn loop. */
+#define SRV_PROF_TOP SRV_PROF_COUNT
+
+struct srv_prof_frame {
+  enum srv_prof_phase phase;
+  unsigned long allocations;
+  long packet_bytes;
+};
+
+static struct {
+  FILE *fp;
+  bool failed;                  /* Could not open the file. */
+
+  bool in_turn;
+  int turn;
+  struct srv_prof_record turn_total;
+  struct srv_prof_frame turn_frame;
+
+  /* Indexed by phase, then by parent. */
+  struct srv_prof_record records[SRV_PROF_COUNT][SRV_PROF_COUNT + 1];
+
+  /* Sums over all the turns, indexed by phase, the last one being the
+   * whole turn. */
+  struct srv_prof_record totals[SRV_PROF_COUNT + 1];
+
+  struct srv_prof_frame stack[SRV_PROF_COUNT];
+  int depth;
+  int running[SRV_PROF_COUNT];  /* Nesting level of each phase. */
+
+  /* One pair of timers for each phase, and one for the whole turn. */
+  struct timer *wall_timers[SRV_PROF_COUNT + 1];
+  struct timer *cpu_timers[SRV_PROF_COUNT + 1];
+} prof;
+
+/**********************************************************************//**
+  Return TRUE iff the profiler is enabled.
+**************************************************************************/
+static inline bool srv_prof_enabled(void)
+{
+  return PROFLOG_DISABLED != game.server.proflog;
+}
+
+/**********************************************************************//**
+  Return the number of bytes of packets sent to all the connections so
+  far.
+**************************************************************************/
+static long srv_prof_packet_bytes(void)
+{
+  long bytes = 0;
+
+  conn_list_iterate(game.all_connections, pconn) {
+    bytes += pconn->statistics.bytes_send;
+  } conn_list_iterate_end;
+
+  return bytes;
+}
+
+/**********************************************************************//**
+  Start the timers of 'slot' and record the counters in 'frame'.
+**************************************************************************/
+static void srv_prof_frame_start(struct srv_prof_frame *frame, int slot)
+{
+  prof.wall_timers[slot] = timer_renew(prof.wall_timers[slot], TIMER_USER,
+                                       TIMER_ACTIVE,
+                                       prof.wall_timers[slot] != NULL
+                                       ? NULL : "profile wall");
+  prof.cpu_timers[slot] = timer_renew(prof.cpu_timers[slot], TIMER_CPU,
+                                      TIMER_ACTIVE,
+                                      prof.cpu_timers[slot] != NULL
+                                      ? NULL : "profile cpu");
+  timer_start(prof.wall_timers[slot]);
+  timer_start(prof.cpu_timers[slot]);
+
+  frame->allocations = fc_mem_stats_allocations();
+  frame->packet_bytes = srv_prof_packet_bytes();
+}
+
+/**********************************************************************//**
+  Add the figures of 'src' to 'dest'.
+**************************************************************************/
+static void srv_prof_record_add(struct srv_prof_record *dest,
+                                const struct srv_prof_record *src)
+{
+  dest->calls += src->calls;
+  dest->wall += src->wall;
+  dest->cpu += src->cpu;
+  dest->allocations += src->allocations;
+  dest->packet_bytes += src->packet_bytes;
+}
+
+/**********************************************************************//**
+  Stop the timers of 'slot' and add what happened since 'frame' was
+  started to 'record' and to the totals of 'slot'.
+**************************************************************************/
+static void srv_prof_frame_stop(const struct srv_prof_frame *frame,
+                                int slot, struct srv_prof_record *record)
+{
+  struct srv_prof_record delta;
+  long bytes;
+
+  timer_stop(prof.wall_timers[slot]);
+  timer_stop(prof.cpu_timers[slot]);
+
+  /* The counter of a connection is lost when it is closed. */
+  bytes = srv_prof_packet_bytes() - frame->packet_bytes;
+
+  delta.calls = 1;
+  delta.wall = timer_read_seconds(prof.wall_timers[slot]);
+  delta.cpu = timer_read_seconds(prof.cpu_timers[slot]);
+  delta.allocations = fc_mem_stats_allocations() - frame->allocations;
+  delta.packet_bytes = MAX(bytes, 0);
+
+  srv_prof_record_add(record, &delta);
+  srv_prof_record_add(&prof.totals[slot], &delta);
+}
+
+/**********************************************************************//**
+  Forget the current turn, and close the log file so that it is opened
+  again, with the new settings, when the next record is written. Called
+  when the profile log settings change.
+**************************************************************************/
+void srv_prof_log_reset(void)
+{
+  if (prof.fp != NULL) {
+    fclose(prof.fp);
+    prof.fp = NULL;
+  }
+  prof.failed = FALSE;
+
+  prof.in_turn = FALSE;
+  prof.depth = 0;
+  memset(prof.running, 0, sizeof(prof.running));
+  memset(prof.totals, 0, sizeof(prof.totals));
+
+  fc_mem_stats_enable(srv_prof_enabled());
+}
+
+/**********************************************************************//**
+  Close the log file and free the timers.
+**************************************************************************/
+void srv_prof_free(void)
+{
+  int i;
+
+  srv_prof_log_reset();
+  fc_mem_stats_enable(FALSE);
+
+  for (i = 0; i <= SRV_PROF_COUNT; i++) {
+    if (prof.wall_timers[i] != NULL) {
+      timer_destroy(prof.wall_timers[i]);
+      prof.wall_timers[i] = NULL;
+    }
+    if (prof.cpu_timers[i] != NULL) {
+      timer_destroy(prof.cpu_timers[i]);
+      prof.cpu_timers[i] = NULL;
+    }
+  }
+}
+
+/**********************************************************************//**
+  Start the record of a new turn.
+**************************************************************************/
+void srv_prof_turn_begin(void)
+{
+  if (!srv_prof_enabled()) {
+    return;
+  }
+
+  memset(&prof.turn_total, 0, sizeof(prof.turn_total));
+  memset(prof.records, 0, sizeof(prof.records));
+  prof.turn = game.info.turn;
+  prof.in_turn = TRUE;
+
+  /* The setting may have been loaded from a savegame, bypassing its
+   * action. */
+  fc_mem_stats_enable(TRUE);
+
+  srv_prof_frame_start(&prof.turn_frame, SRV_PROF_TOP);
+}
+
+/**********************************************************************//**
+  Return the name of the parent of a phase.
+**************************************************************************/
+static const char *srv_prof_parent_name(int parent)
+{
+  return SRV_PROF_TOP == parent
+         ? "turn" : srv_prof_phase_name((enum srv_prof_phase) parent);
+}
+
+/**********************************************************************//**
+  Write a record as comma separated values.
+**************************************************************************/
+static void srv_prof_write_csv(const char *phase, const char *parent,
+                               const struct srv_prof_record *record)
+{
+  fprintf(prof.fp, "%d,%s,%s,%d,%.6f,%.6f,%lu,%ld\n", prof.turn, phase,
+          parent, record->calls, record->wall, record->cpu,
+          record->allocations, record->packet_bytes);
+}
+
+/**********************************************************************//**
+  Write the figures of a record as JSON members.
+**************************************************************************/
+static void srv_prof_write_json(const struct srv_prof_record *record)
+{
+  fprintf(prof.fp, "\"calls\":%d,\"wall\":%.6f,\"cpu\":%.6f,"
+          "\"allocations\":%lu,\"packet_bytes\":%ld", record->calls,
+          record->wall, record->cpu, record->allocations,
+          record->packet_bytes);
+}
+
+/**********************************************************************//**
+  Open the log file if needed. Returns FALSE if it can't be opened.
+**************************************************************************/
+static bool srv_prof_open(void)
+{
+  if (prof.fp != NULL) {
+    return TRUE;
+  }
+  if (prof.failed) {
+    return FALSE;
+  }
+
+  prof.fp = fc_fopen(game.server.proffile, "a");
+  if (prof.fp == NULL) {
+    log_error("Can't open profile log file '%s' for appending!",
+              game.server.proffile);
+    prof.failed = TRUE;
+    return FALSE;
+  }
+
+  if (PROFLOG_CSV == game.server.proflog
+      && 0 == fseek(prof.fp, 0, SEEK_END) && 0 == ftell(prof.fp)) {
+    fprintf(prof.fp,
+            "turn,phase,parent,calls,wall,cpu,allocations,packet_bytes\n");
+  }
+
+  return TRUE;
+}
+
+/**********************************************************************//**
+  End the record of the turn, and append it to the log file.
+**************************************************************************/
+void srv_prof_turn_end(void)
+{
+  bool first = TRUE;
+  int phase, parent;
+
+  if (!srv_prof_enabled() || !prof.in_turn) {
+    return;
+  }
+
+  srv_prof_frame_stop(&prof.turn_frame, SRV_PROF_TOP, &prof.turn_total);
+  prof.in_turn = FALSE;
+
+  if (!srv_prof_open()) {
+    return;
+  }
+
+  if (PROFLOG_CSV == game.server.proflog) {
+    srv_prof_write_csv("turn", "", &prof.turn_total);
+  } else {
+    fprintf(prof.fp, "{\"turn\":%d,", prof.turn);
+    srv_prof_write_json(&prof.turn_total);
+    fprintf(prof.fp, ",\"phases\":[");
+  }
+
+  for (phase = 0; phase < SRV_PROF_COUNT; phase++) {
+    for (parent = 0; parent <= SRV_PROF_COUNT; parent++) {
+      const struct srv_prof_record *record = &prof.records[phase][parent];
+
+      if (0 == record->calls) {
+        continue;
+      }
+
+      if (PROFLOG_CSV == game.server.proflog) {
+        srv_prof_write_csv(srv_prof_phase_name(phase),
+                           srv_prof_parent_name(parent), record);
+      } else {
+        fprintf(prof.fp, "%s{\"phase\":\"%s\",\"parent\":\"%s\",",
+                first ? "" : ",", srv_prof_phase_name(phase),
+                srv_prof_parent_name(parent));
+        srv_prof_write_json(record);
+        fprintf(prof.fp, "}");
+        first = FALSE;
+      }
+    }
+  }
+
+  if (PROFLOG_JSON == game.server.proflog) {
+    fprintf(prof.fp, "]}\n");
+  }
+  fflush(prof.fp);
+}
+
+/**********************************************************************//**
+  Start the profiling of a phase.
+**************************************************************************/
+void srv_prof_start(enum srv_prof_phase phase)
+{
+  if (!srv_prof_enabled() || !prof.in_turn) {
+    return;
+  }
+
+  if (0 < prof.running[phase]++) {
+    /* Only the outermost call is accounted. */
+    return;
+  }
+
+  fc_assert_ret(prof.depth < SRV_PROF_COUNT);
+  prof.stack[prof.depth].phase = phase;
+  srv_prof_frame_start(&prof.stack[prof.depth], phase);
+  prof.depth++;
+}
+
+/**********************************************************************//**
+  Stop the profiling of a phase.
+**************************************************************************/
+void srv_prof_stop(enum srv_prof_phase phase)
+{
+  int parent;
+
+  if (!srv_prof_enabled() || 0 == prof.running[phase]) {
+    /* Started before the profiler was enabled. */
+    return;
+  }
+
+  if (0 < --prof.running[phase]) {
+    return;
+  }
+
+  fc_assert_ret(0 < prof.depth && prof.stack[prof.depth - 1].phase == phase);
+  prof.depth--;
+  parent = 0 < prof.depth ? prof.stack[prof.depth - 1].phase : SRV_PROF_TOP;
+  srv_prof_frame_stop(&prof.stack[prof.depth], phase,
+                      &prof.records[phase][parent]);
+}
+
+/**********************************************************************//**
+  Return the sums of the records of all the turns profiled since the
+  profile log settings last changed. 'calls' is the number of turns.
+**************************************************************************/
+const struct srv_prof_record *srv_prof_turn_total(void)
+{
+  return &prof.totals[SRV_PROF_TOP];
+}
+
+/**********************************************************************//**
+  Return the sums of the records of 'phase', under all its parents, since
+  the profile log settings last changed.
+**************************************************************************/
+const struct srv_prof_record *srv_prof_phase_total(enum srv_prof_phase phase)
+{
+  return &prof.totals[phase];
+}
@@ -0,0 +1,65 @@
+/***********************************************************************
+ Freeciv - Copyright (C) 1996 - A Kjeldberg, L Gregersen, P Unold
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2, or (at your option)
+   any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+***********************************************************************/
+#ifndef FC__SRV_PROF_H
+#define FC__SRV_PROF_H
+
+/* utility */
+#include "support.h"            /* bool */
+
+/* The phases of the turn measured by the profiler. They may nest; each
+ * one is accounted separately for every phase it is called from. */
+#define SPECENUM_NAME srv_prof_phase
+#define SPECENUM_VALUE0 SRV_PROF_BEGIN_TURN
+#define SPECENUM_VALUE0NAME "begin_turn"
+#define SPECENUM_VALUE1 SRV_PROF_BEGIN_PHASE
+#define SPECENUM_VALUE1NAME "begin_phase"
+#define SPECENUM_VALUE2 SRV_PROF_UPDATE_UNIT_ACTIVITIES
+#define SPECENUM_VALUE2NAME "update_unit_activities"
+#define SPECENUM_VALUE3 SRV_PROF_AI_START_PHASE
+#define SPECENUM_VALUE3NAME "ai_start_phase"
+#define SPECENUM_VALUE4 SRV_PROF_END_PHASE
+#define SPECENUM_VALUE4NAME "end_phase"
+#define SPECENUM_VALUE5 SRV_PROF_AI_END_PHASE
+#define SPECENUM_VALUE5NAME "ai_end_phase"
+#define SPECENUM_VALUE6 SRV_PROF_UPDATE_CITY_ACTIVITIES
+#define SPECENUM_VALUE6NAME "update_city_activities"
+#define SPECENUM_VALUE7 SRV_PROF_END_TURN
+#define SPECENUM_VALUE7NAME "end_turn"
+#define SPECENUM_VALUE8 SRV_PROF_SAVEGAME
+#define SPECENUM_VALUE8NAME "savegame"
+#define SPECENUM_VALUE9 SRV_PROF_FLUSH_PACKETS
+#define SPECENUM_VALUE9NAME "flush_packets"
+#define SPECENUM_COUNT SRV_PROF_COUNT
+#include "specenum_gen.h"
+
+struct srv_prof_record {
+  int calls;
+  double wall;                  /* Seconds */
+  double cpu;                   /* Seconds */
+  unsigned long allocations;
+  long packet_bytes;
+};
+
+void srv_prof_log_reset(void);
+void srv_prof_free(void);
+
+void srv_prof_turn_begin(void);
+void srv_prof_turn_end(void);
+
+void srv_prof_start(enum srv_prof_phase phase);
+void srv_prof_stop(enum srv_prof_phase phase);
+
+const struct srv_prof_record *srv_prof_turn_total(void);
+const struct srv_prof_record *srv_prof_phase_total(enum srv_prof_phase phase);
+
+#endif /* FC__SRV_PROF_H */
@@ -33,6 +33,7 @@
 #include "fc_cmdline.h"
 #include "fciconv.h"
 #include "fcintl.h"
+#include "fcthreadpool.h"
 #include "log.h"
 #include "mem.h"
 #include "rand.h"
@@ -42,11 +43,15 @@
 #include "section_file.h"
 
 /* common */
+#include "actions.h"
 #include "capability.h"
+#include "city.h"
+#include "effects.h"
 #include "events.h"
 #include "fc_types.h" /* LINE_BREAK */
 #include "featured_text.h"
 #include "game.h"
+#include "improvement.h"
 #include "map.h"
 #include "mapimg.h"
 #include "packets.h"
@@ -80,6 +85,7 @@
 #include "voting.h"
 
 /* server/savegame */
+#include "savedelta.h"
 #include "savemain.h"
 
 /* server/scripting */
@@ -2709,6 +2715,508 @@ static bool cancelvote_command(struct connection *caller,
   return TRUE;
 }
 
+/**********************************************************************//**
+  Returns the number of the evaluations of the requirements of the
+  effects, the buildings and the action enablers for the city in which
+  the compiled program disagrees with the requirement vector.
+**************************************************************************/
+static int debug_reqs_city_mismatches(const struct city *pcity)
+{
+  const struct req_context context = {
+    .player = city_owner(pcity),
+    .city = pcity,
+    .tile = city_tile(pcity),
+  };
+  enum req_problem_type prob_type;
+  enum effect_type type;
+  int mismatches = 0;
+
+#define CHECK_REQS(_reqs_, _prog_)                                         \
+  if (are_reqs_active(&context, NULL, (_reqs_), prob_type)                 \
+      != are_reqs_active_prog(&context, NULL, (_reqs_), (_prog_),         \
+                              prob_type)) {                                \
+    mismatches++;                                                          \
+  }
+
+  for (prob_type = RPT_POSSIBLE; prob_type <= RPT_CERTAIN; prob_type++) {
+    for (type = 0; type < EFT_COUNT; type++) {
+      effect_list_iterate(get_effects(type), peffect) {
+        CHECK_REQS(&peffect->reqs, &peffect->reqs_prog);
+      } effect_list_iterate_end;
+    }
+
+    improvement_iterate(pimprove) {
+      CHECK_REQS(&pimprove->reqs, &pimprove->reqs_prog);
+    } improvement_iterate_end;
+
+    action_enablers_iterate(enabler) {
+      CHECK_REQS(&enabler->actor_reqs, &enabler->actor_reqs_prog);
+      CHECK_REQS(&enabler->target_reqs, &enabler->target_reqs_prog);
+    } action_enablers_iterate_end;
+  }
+
+#undef CHECK_REQS
+
+  return mismatches;
+}
+
+/**********************************************************************//**
+  Evaluate the requirements of all the effects for all the cities
+  'rounds' times, once with the requirement vectors themselves and once
+  with their compiled programs, and report how long each took. Then
+  check that each evaluation of the programs gives the same result as
+  the vectors. Returns FALSE if any doesn't.
+**************************************************************************/
+static bool debug_reqs_benchmark(struct connection *caller, int rounds)
+{
+  struct timer *timer = timer_new(TIMER_CPU, TIMER_ACTIVE, "reqs");
+  double vec_time = 0.0, prog_time = 0.0;
+  int evals = 0, mismatches = 0;
+  int i, pass;
+  enum effect_type type;
+
+  for (pass = 0; pass < 2; pass++) {
+    timer_clear(timer);
+    timer_start(timer);
+    for (i = 0; i < rounds; i++) {
+      cities_iterate(pcity) {
+        const struct req_context context = {
+          .player = city_owner(pcity),
+          .city = pcity,
+          .tile = city_tile(pcity),
+        };
+
+        for (type = 0; type < EFT_COUNT; type++) {
+          effect_list_iterate(get_effects(type), peffect) {
+            if (pass == 0) {
+              evals++;
+              are_reqs_active(&context, NULL, &peffect->reqs,
+                              RPT_CERTAIN);
+            } else {
+              are_reqs_active_prog(&context, NULL, &peffect->reqs,
+                                   &peffect->reqs_prog, RPT_CERTAIN);
+            }
+          } effect_list_iterate_end;
+        }
+      } cities_iterate_end;
+    }
+    timer_stop(timer);
+    if (pass == 0) {
+      vec_time = timer_read_seconds(timer);
+    } else {
+      prog_time = timer_read_seconds(timer);
+    }
+  }
+  timer_destroy(timer);
+
+  cmd_reply(CMD_DEBUG, caller, C_OK,
+            _("%d effect requirement evaluations: %.3fs as vectors, "
+              "%.3fs compiled."), evals, vec_time, prog_time);
+
+  cities_iterate(pcity) {
+    mismatches += debug_reqs_city_mismatches(pcity);
+  } cities_iterate_end;
+
+  if (mismatches > 0) {
+    cmd_reply(CMD_DEBUG, caller, C_FAIL,
+              _("Compiled requirements disagree with the vectors in "
+                "%d evaluations."), mismatches);
+    return FALSE;
+  }
+
+  cmd_reply(CMD_DEBUG, caller, C_OK,
+            _("Compiled requirements agree with the vectors."));
+
+  return TRUE;
+}
+
+/* The effect values and the results of a refresh of a city. */
+struct debug_memo_city {
+  struct city *pcity;
+  int bonus[EFT_COUNT];
+  int output_bonus[EFT_COUNT][O_LAST];
+  int waste[O_LAST];
+  int surplus[O_LAST];
+};
+
+/**********************************************************************//**
+  Record the effect values of the city into 'values', looking each up
+  twice so that the second lookup comes from the memo if the effect
+  values of the city are being remembered.
+**************************************************************************/
+static void debug_memo_record(struct debug_memo_city *values)
+{
+  const struct city *pcity = values->pcity;
+  enum effect_type type;
+
+  for (type = 0; type < EFT_COUNT; type++) {
+    get_city_bonus(pcity, type);
+    values->bonus[type] = get_city_bonus(pcity, type);
+    output_type_iterate(o) {
+      const struct output_type *poutput = get_output_type(o);
+
+      get_city_output_bonus(pcity, poutput, type);
+      values->output_bonus[type][o]
+        = get_city_output_bonus(pcity, poutput, type);
+    } output_type_iterate_end;
+  }
+
+  output_type_iterate(o) {
+    values->waste[o] = pcity->waste[o];
+    values->surplus[o] = pcity->surplus[o];
+  } output_type_iterate_end;
+}
+
+/**********************************************************************//**
+  Thread pool job: refresh one city, then record its effect values while
+  they are remembered.
+**************************************************************************/
+static void debug_memo_job(void *data, int index)
+{
+  struct debug_memo_city *values = (struct debug_memo_city *) data + index;
+
+  city_refresh_from_main_map(values->pcity, NULL);
+  city_effect_cache_begin(values->pcity);
+  debug_memo_record(values);
+  city_effect_cache_end(values->pcity);
+}
+
+/**********************************************************************//**
+  Check that the effect values and the refresh results of the cities
+  refreshed in two threads at once, remembering their effect values, are
+  the same as when refreshing them one by one without the memo. As the
+  waste of a city depends on its distance to the government centers,
+  the refresh of a city looks up the effects of other cities. Returns
+  FALSE if any value differs.
+**************************************************************************/
+static bool debug_memo_check(struct connection *caller)
+{
+  struct debug_memo_city *plain, *memo;
+  struct fc_threadpool *pool;
+  int cities_num = 0, mismatches = 0;
+  int i;
+
+  players_iterate(pplayer) {
+    cities_num += city_list_size(pplayer->cities);
+  } players_iterate_end;
+
+  plain = fc_calloc(MAX(cities_num, 1), sizeof(*plain));
+  memo = fc_calloc(MAX(cities_num, 1), sizeof(*memo));
+
+  i = 0;
+  cities_iterate(pcity) {
+    plain[i].pcity = pcity;
+    memo[i].pcity = pcity;
+    i++;
+  } cities_iterate_end;
+
+  city_effect_cache_enable(FALSE);
+  for (i = 0; i < cities_num; i++) {
+    city_refresh_from_main_map(plain[i].pcity, NULL);
+  }
+  for (i = 0; i < cities_num; i++) {
+    debug_memo_record(&plain[i]);
+  }
+  city_effect_cache_enable(TRUE);
+
+  /* The calling thread is the other one. */
+  pool = fc_threadpool_new(1);
+  fc_threadpool_run(pool, debug_memo_job, memo, cities_num);
+  fc_threadpool_destroy(pool);
+
+  for (i = 0; i < cities_num; i++) {
+    if (memcmp(&plain[i], &memo[i], sizeof(plain[i])) != 0) {
+      cmd_reply(CMD_DEBUG, caller, C_FAIL,
+                _("Remembered effect values of %s differ."),
+                city_name_get(plain[i].pcity));
+      mismatches++;
+    }
+  }
+
+  free(plain);
+  free(memo);
+
+  if (mismatches > 0) {
+    return FALSE;
+  }
+
+  cmd_reply(CMD_DEBUG, caller, C_OK,
+            _("Remembered effect values of %d cities refreshed in "
+              "parallel agree with the plain ones."), cities_num);
+
+  return TRUE;
+}
+
+/**********************************************************************//**
+  Compare the section file 'actual' with 'expected', replying the first
+  differences. Each entry of 'expected' is first looked up by its path,
+  then the sections and their numbers of entries are compared. With
+  'ordered', the sections and entries must also come in the same order.
+  Returns the number of differences.
+**************************************************************************/
+static int debug_secfile_mismatches(struct connection *caller,
+                                    const struct section_file *expected,
+                                    const struct section_file *actual,
+                                    bool ordered)
+{
+  const struct section_list *sections = secfile_sections(actual);
+  const struct section_list_link *plink = section_list_head(sections);
+  char path[1024];
+  int mismatches = 0;
+
+#define DEBUG_SECFILE_MISMATCH(_format_, ...)                               \
+  if (mismatches++ < 10) {                                                  \
+    cmd_reply(CMD_DEBUG, caller, C_FAIL, _format_, ## __VA_ARGS__);         \
+  }
+
+  section_list_iterate(secfile_sections(expected), psection) {
+    entry_list_iterate(section_entries(psection), pentry) {
+      const struct entry *pactual;
+
+      entry_path(pentry, path, sizeof(path));
+      pactual = secfile_entry_by_path(actual, path);
+      if (pactual == NULL) {
+        DEBUG_SECFILE_MISMATCH(_("%s is missing: %s"), path,
+                               secfile_error());
+      } else if (!entry_equal(pentry, pactual)) {
+        DEBUG_SECFILE_MISMATCH(_("%s differs."), path);
+      }
+    } entry_list_iterate_end;
+  } section_list_iterate_end;
+
+  if (section_list_size(secfile_sections(expected))
+      != section_list_size(sections)) {
+    DEBUG_SECFILE_MISMATCH(_("The number of sections differs."));
+    return mismatches;
+  }
+
+  section_list_iterate(secfile_sections(expected), psection) {
+    const struct section *pactual
+      = (ordered ? section_list_link_data(plink)
+         : secfile_section_by_name(actual, section_name(psection)));
+    const struct entry_list *entries;
+    const struct entry_list_link *elink;
+
+    plink = section_list_link_next(plink);
+    if (pactual == NULL
+        || strcmp(section_name(psection), section_name(pactual)) != 0) {
+      DEBUG_SECFILE_MISMATCH(_("Section %s is missing."),
+                             section_name(psection));
+      continue;
+    }
+
+    entries = section_entries(pactual);
+    elink = entry_list_head(entries);
+    if (entry_list_size(section_entries(psection))
+        != entry_list_size(entries)) {
+      DEBUG_SECFILE_MISMATCH(_("Section %s has other entries."),
+                             section_name(psection));
+    } else if (ordered) {
+      entry_list_iterate(section_entries(psection), pentry) {
+        if (strcmp(entry_name(pentry),
+                   entry_name(entry_list_link_data(elink))) != 0) {
+          entry_path(pentry, path, sizeof(path));
+          DEBUG_SECFILE_MISMATCH(_("%s is out of order."), path);
+          break;
+        }
+        elink = entry_list_link_next(elink);
+      } entry_list_iterate_end;
+    }
+  } section_list_iterate_end;
+
+#undef DEBUG_SECFILE_MISMATCH
+
+  return mismatches;
+}
+
+/**********************************************************************//**
+  Write the current game to a plain savegame file in the saves
+  directory, as 'filename'. Returns the section file of the savegame,
+  or NULL on failure.
+**************************************************************************/
+static struct section_file *debug_save_plain(struct connection *caller,
+                                             const char *name,
+                                             char *filename,
+                                             size_t filename_len)
+{
+  struct section_file *sfile;
+
+  if (srvarg.saves_pathname[0] != '\0') {
+    if (!make_dir(srvarg.saves_pathname)) {
+      cmd_reply(CMD_DEBUG, caller, C_FAIL,
+                _("Can't create saves directory %s!"),
+                srvarg.saves_pathname);
+      return NULL;
+    }
+    fc_snprintf(filename, filename_len, "%s/%s",
+                srvarg.saves_pathname, name);
+  } else {
+    fc_strlcpy(filename, name, filename_len);
+  }
+
+  sfile = secfile_new(TRUE);
+  savegame_save(sfile, "debug", FALSE);
+  if (!secfile_save(sfile, filename, 0, FZ_PLAIN)) {
+    cmd_reply(CMD_DEBUG, caller, C_FAIL, _("Failed saving %s: %s"),
+              filename, secfile_error());
+    secfile_destroy(sfile);
+    return NULL;
+  }
+
+  return sfile;
+}
+
+/**********************************************************************//**
+  Check that a savegame of the current game loaded lazily, its sections
+  parsed as their entries are looked up, has the same contents as when
+  parsed whole. Returns FALSE if they differ.
+**************************************************************************/
+static bool debug_registry_check(struct connection *caller)
+{
+  struct section_file *eager, *lazy;
+  char filename[600];
+  int mismatches;
+
+  eager = debug_save_plain(caller, "freeciv-debug-registry.sav",
+                           filename, sizeof(filename));
+  if (eager == NULL) {
+    return FALSE;
+  }
+  secfile_destroy(eager);
+
+  eager = secfile_load(filename, FALSE);
+  lazy = secfile_load_lazy(filename, FALSE);
+  fc_remove(filename);
+  if (eager == NULL || lazy == NULL) {
+    cmd_reply(CMD_DEBUG, caller, C_FAIL, _("Failed loading %s: %s"),
+              filename, secfile_error());
+    if (eager != NULL) {
+      secfile_destroy(eager);
+    }
+    if (lazy != NULL) {
+      secfile_destroy(lazy);
+    }
+    return FALSE;
+  }
+
+  mismatches = debug_secfile_mismatches(caller, eager, lazy, TRUE);
+  secfile_destroy(eager);
+  secfile_destroy(lazy);
+
+  if (mismatches > 0) {
+    cmd_reply(CMD_DEBUG, caller, C_FAIL,
+              _("%d differences between the lazily and the wholly "
+                "loaded savegame."), mismatches);
+    return FALSE;
+  }
+
+  cmd_reply(CMD_DEBUG, caller, C_OK,
+            _("The lazily loaded savegame agrees with the wholly "
+              "loaded one."));
+
+  return TRUE;
+}
+
+/**********************************************************************//**
+  Check that a delta savegame of the current game, made against the
+  checkpoint of the turn autosaves, loads with the same contents as the
+  full savegame. Returns FALSE if they differ, or if there's no
+  checkpoint.
+**************************************************************************/
+static bool debug_delta_check(struct connection *caller)
+{
+  const char *checkpoint = save_checkpoint_path();
+  const char *base_name;
+  struct section_file *base, *full, *delta, *expected, *actual;
+  char full_filename[600], delta_filename[600];
+  int sections, mismatches;
+
+  if (checkpoint == NULL) {
+    cmd_reply(CMD_DEBUG, caller, C_FAIL,
+              _("There's no checkpoint of the turn autosaves to make "
+                "a delta savegame against."));
+    return FALSE;
+  }
+
+  base = secfile_load(checkpoint, FALSE);
+  if (base == NULL) {
+    cmd_reply(CMD_DEBUG, caller, C_FAIL, _("Failed loading %s: %s"),
+              checkpoint, secfile_error());
+    return FALSE;
+  }
+
+  full = debug_save_plain(caller, "freeciv-debug-full.sav",
+                          full_filename, sizeof(full_filename));
+  if (full == NULL) {
+    secfile_destroy(base);
+    return FALSE;
+  }
+
+  /* The delta is loaded along with a checkpoint in the same directory. */
+  base_name = strrchr(checkpoint, '/');
+  if (base_name != NULL) {
+    base_name++;
+    fc_snprintf(delta_filename, sizeof(delta_filename),
+                "%.*s/freeciv-debug-delta.sav",
+                (int) (base_name - checkpoint - 1), checkpoint);
+  } else {
+    base_name = checkpoint;
+    sz_strlcpy(delta_filename, "freeciv-debug-delta.sav");
+  }
+
+  delta = savedelta_new(base, full, base_name);
+  sections = section_list_size(secfile_sections(delta)) - 1;
+  if (!secfile_save(delta, delta_filename, 0, FZ_PLAIN)) {
+    cmd_reply(CMD_DEBUG, caller, C_FAIL, _("Failed saving %s: %s"),
+              delta_filename, secfile_error());
+    sections = -1;
+  }
+  secfile_destroy(delta);
+  secfile_destroy(full);
+  secfile_destroy(base);
+
+  if (sections < 0) {
+    fc_remove(full_filename);
+    return FALSE;
+  }
+
+  expected = secfile_load(full_filename, FALSE);
+  actual = savedelta_secfile_load(delta_filename);
+  fc_remove(full_filename);
+  fc_remove(delta_filename);
+  if (expected == NULL || actual == NULL) {
+    cmd_reply(CMD_DEBUG, caller, C_FAIL,
+              _("Failed loading the savegames: %s"), secfile_error());
+    if (expected != NULL) {
+      secfile_destroy(expected);
+    }
+    if (actual != NULL) {
+      secfile_destroy(actual);
+    }
+    return FALSE;
+  }
+
+  /* The entries added since the checkpoint come last in their sections
+   * and the savegames are read by path, so the order doesn't matter. */
+  mismatches = debug_secfile_mismatches(caller, expected, actual,
+                                        FALSE);
+  secfile_destroy(expected);
+  secfile_destroy(actual);
+
+  if (mismatches > 0) {
+    cmd_reply(CMD_DEBUG, caller, C_FAIL,
+              _("%d differences between the delta and the full "
+                "savegame."), mismatches);
+    return FALSE;
+  }
+
+  cmd_reply(CMD_DEBUG, caller, C_OK,
+            _("The delta savegame of %d sections against %s loads as "
+              "the full savegame."), sections, checkpoint);
+
+  return TRUE;
+}
+
 /**********************************************************************//**
   Turn on selective debugging.
 **************************************************************************/
@@ -2718,6 +3226,7 @@ static bool debug_command(struct connection *caller, char *str,
   char buf[MAX_LEN_CONSOLE_LINE];
   char *arg[3];
   int ntokens = 0, i;
+  bool ok = TRUE;
 
   if (game.info.is_new_game) {
     cmd_reply(CMD_DEBUG, caller, C_SYNTAX,
@@ -2866,6 +3375,23 @@ static bool debug_command(struct connection *caller, char *str,
     } unit_list_iterate_end;
   } else if (ntokens > 0 && strcmp(arg[0], "timing") == 0) {
     TIMING_RESULTS();
+  } else if (ntokens > 0 && strcmp(arg[0], "reqs") == 0) {
+    int rounds = 10;
+
+    if (ntokens > 2
+        || (ntokens == 2 && (!str_to_int(arg[1], &rounds) || rounds < 1))) {
+      cmd_reply(CMD_DEBUG, caller, C_SYNTAX,
+                _("Undefined argument. Usage:\n%s"),
+                command_synopsis(command_by_number(CMD_DEBUG)));
+      goto cleanup;
+    }
+    ok = debug_reqs_benchmark(caller, rounds);
+  } else if (ntokens > 0 && strcmp(arg[0], "memo") == 0) {
+    ok = debug_memo_check(caller);
+  } else if (ntokens > 0 && strcmp(arg[0], "registry") == 0) {
+    ok = debug_registry_check(caller);
+  } else if (ntokens > 0 && strcmp(arg[0], "delta") == 0) {
+    ok = debug_delta_check(caller);
   } else if (ntokens > 0 && strcmp(arg[0], "ferries") == 0) {
     if (game.server.debug[DEBUG_FERRIES]) {
       game.server.debug[DEBUG_FERRIES] = FALSE;
@@ -2913,7 +3439,7 @@ static bool debug_command(struct connection *caller, char *str,
   for (i = 0; i < ntokens; i++) {
     free(arg[i]);
   }
-  return TRUE;
+  return ok;
 }
 
 /**********************************************************************//**
@@ -3854,7 +4380,7 @@ bool load_command(struct connection *caller, const char *filename, bool check,
 
   /* attempt to parse the file */
 
-  if (!(file = secfile_load(arg, FALSE))) {
+  if (!(file = savedelta_secfile_load(arg))) {
     log_error("Error loading savefile '%s': %s", arg, secfile_error());
     cmd_reply(CMD_LOAD, caller, C_FAIL, _("Could not load savefile: %s"),
               arg);
@@ -6663,6 +7189,90 @@ static void show_connections(struct connection *caller)
   cmd_reply(CMD_LIST, caller, C_COMMENT, horiz_line);
 }
 
+/**********************************************************************//**
+  Show the memory used by the delta caches of each connection, with the
+  packet types using the most of it.
+**************************************************************************/
+static void show_caches(struct connection *caller)
+{
+  const int num_top = 3;
+  size_t total = 0, total_entries = 0;
+
+  cmd_reply(CMD_LIST, caller, C_COMMENT,
+            _("Delta cache memory of connections:"));
+  cmd_reply(CMD_LIST, caller, C_COMMENT, horiz_line);
+
+  if (conn_list_size(game.all_connections) == 0) {
+    cmd_reply(CMD_LIST, caller, C_COMMENT, _("<no connections>"));
+  }
+
+  conn_list_iterate(game.all_connections, pconn) {
+    size_t size[PACKET_LAST], entries[PACKET_LAST];
+    size_t conn_size = 0, conn_entries = 0;
+    const struct observer_group *pgroup = pconn->phs.group;
+    const struct connection *first = NULL;
+    enum packet_type type;
+    int i;
+
+    if (NULL != pgroup) {
+      /* The shared cache is counted with its first connection. */
+      first = conn_list_get(observer_group_members(pgroup), 0);
+    }
+
+    for (type = 0; type < PACKET_LAST; type++) {
+      size[type] = packet_cache_memory(pconn, type, &entries[type]);
+      if (first == pconn) {
+        size_t group_entries;
+
+        size[type] += observer_group_cache_memory(pgroup, type,
+                                                  &group_entries);
+        entries[type] += group_entries;
+      }
+      conn_size += size[type];
+      conn_entries += entries[type];
+    }
+
+    cmd_reply(CMD_LIST, caller, C_COMMENT,
+              _("%s: %lu packets, %lu kB"), conn_description(pconn),
+              (unsigned long) conn_entries,
+              (unsigned long) (conn_size / 1024));
+    if (first == pconn) {
+      cmd_reply(CMD_LIST, caller, C_COMMENT,
+                _("  shared by a group of %d observers"),
+                conn_list_size(observer_group_members(pgroup)));
+    } else if (NULL != first) {
+      cmd_reply(CMD_LIST, caller, C_COMMENT,
+                _("  sharing the cache of %s"), conn_description(first));
+    }
+
+    for (i = 0; i < num_top; i++) {
+      enum packet_type largest = 0;
+
+      for (type = 1; type < PACKET_LAST; type++) {
+        if (size[type] > size[largest]) {
+          largest = type;
+        }
+      }
+      if (entries[largest] == 0) {
+        break;
+      }
+      cmd_reply(CMD_LIST, caller, C_COMMENT,
+                _("  %s: %lu packets, %lu kB"), packet_name(largest),
+                (unsigned long) entries[largest],
+                (unsigned long) (size[largest] / 1024));
+      size[largest] = 0;
+      entries[largest] = 0;
+    }
+
+    total += conn_size;
+    total_entries += conn_entries;
+  } conn_list_iterate_end;
+
+  cmd_reply(CMD_LIST, caller, C_COMMENT, horiz_line);
+  cmd_reply(CMD_LIST, caller, C_COMMENT, _("Total: %lu packets, %lu kB"),
+            (unsigned long) total_entries, (unsigned long) (total / 1024));
+}
+
 /**********************************************************************//**
   List all delegations of the current game.
 **************************************************************************/
@@ -7005,6 +7615,8 @@ static void show_colors(struct connection *caller)
 #define SPECENUM_VALUE9NAME  "teams"
 #define SPECENUM_VALUE10     LIST_VOTES
 #define SPECENUM_VALUE10NAME "votes"
+#define SPECENUM_VALUE11     LIST_CACHES
+#define SPECENUM_VALUE11NAME "caches"
 #include "specenum_gen.h"
 
 /**********************************************************************//**
@@ -7074,6 +7686,9 @@ static bool show_list(struct connection *caller, char *arg)
   case LIST_VOTES:
     show_votes(caller);
     return TRUE;
+  case LIST_CACHES:
+    show_caches(caller);
+    return TRUE;
   }
 
   cmd_reply(CMD_LIST, caller, C_FAIL,
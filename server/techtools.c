@@ -24,8 +24,10 @@
 #include "support.h"
 
 /* common */
+#include "effects.h"
 #include "game.h"
 #include "government.h"
+#include "improvement.h"
 #include "movement.h"
 #include "player.h"
 #include "research.h"
@@ -339,6 +341,93 @@ void send_research_info(const struct research *presearch,
   } conn_list_iterate_end;
 }
 
+/************************************************************************//**
+  Return the widest range at which the effects may change when the tech
+  is learned: through the effects requiring it, or tech flags or tech
+  counts, or through the effects of the buildings it may make obsolete.
+****************************************************************************/
+static enum req_range tech_found_effects_range(Tech_type_id tech_found)
+{
+  struct advance *vap = valid_advance_by_number(tech_found);
+  enum req_range range = REQ_RANGE_LOCAL;
+  enum req_range extras_range;
+  const enum universals_n tech_kinds[] = { VUT_TECHFLAG, VUT_MINTECHS };
+  const enum universals_n extra_kinds[] = {
+    VUT_EXTRA, VUT_EXTRAFLAG, VUT_ROADFLAG
+  };
+  int i;
+
+  for (i = 0; i < ARRAY_SIZE(tech_kinds); i++) {
+    range = MAX(range, get_req_source_effects_range(
+                         &(const struct universal) {
+                           .kind = tech_kinds[i]
+                         }));
+  }
+
+  if (vap != NULL) {
+    range = MAX(range, get_req_source_effects_range(
+                         &(const struct universal) {
+                           .kind = VUT_ADVANCE,
+                           .value.advance = vap
+                         }));
+  }
+
+  improvement_iterate(pimprove) {
+    requirement_vector_iterate(&pimprove->obsolete_by, pobs) {
+      if ((pobs->source.kind == VUT_ADVANCE
+           && pobs->source.value.advance == vap)
+          || pobs->source.kind == VUT_TECHFLAG
+          || pobs->source.kind == VUT_MINTECHS) {
+        range = MAX(range, get_req_source_effects_range(
+                             &(const struct universal) {
+                               .kind = VUT_IMPROVEMENT,
+                               .value.building = pimprove
+                             }));
+        break;
+      }
+    } requirement_vector_iterate_end;
+  } improvement_iterate_end;
+
+  /* The tech may give extras to the city centers, which are only seen
+   * by other cities through requirements wider than the tile. */
+  extras_range = REQ_RANGE_LOCAL;
+  for (i = 0; i < ARRAY_SIZE(extra_kinds); i++) {
+    extras_range = MAX(extras_range, get_req_source_effects_range(
+                                       &(const struct universal) {
+                                         .kind = extra_kinds[i]
+                                       }));
+  }
+  if (extras_range > REQ_RANGE_TILE) {
+    range = REQ_RANGE_WORLD;
+  }
+
+  return range;
+}
+
+/************************************************************************//**
+  Return whether the cities of 'aplayer' may need a refresh after the
+  players sharing the research learned a tech, when the effects may only
+  change within 'range' of them.
+****************************************************************************/
+static bool tech_found_affects_player(const struct research *presearch,
+                                      enum req_range range,
+                                      const struct player *aplayer)
+{
+  if (research_get(aplayer) == presearch || range >= REQ_RANGE_WORLD) {
+    return TRUE;
+  }
+
+  research_players_iterate(presearch, pplayer) {
+    if ((range >= REQ_RANGE_TEAM && players_on_same_team(pplayer, aplayer))
+        || (range >= REQ_RANGE_ALLIANCE
+            && pplayers_allied(pplayer, aplayer))) {
+      return TRUE;
+    }
+  } research_players_iterate_end;
+
+  return FALSE;
+}
+
 /************************************************************************//**
   Players sharing the research have got a new technology (from somewhere).
   'was_discovery' is passed on to upgrade_city_extras. Logging and
@@ -348,6 +437,8 @@ void found_new_tech(struct research *presearch, Tech_type_id tech_found,
                     bool was_discovery, bool saving_bulbs)
 {
   int had_embassies[player_slot_count()];
+  bool refresh_cities[player_slot_count()];
+  enum req_range effects_range;
   struct cur_govs_data *could_switch;
   bool was_first = FALSE;
   bool bonus_tech_hack = FALSE;
@@ -406,6 +497,19 @@ void found_new_tech(struct research *presearch, Tech_type_id tech_found,
     had_embassies[i] = get_player_bonus(aplayer, EFT_HAVE_EMBASSIES);
   } players_iterate_end;
 
+  /* Find out whose cities the tech may change. A first discovery also
+   * changes the world-wide state. Players appearing in the meantime get
+   * all their cities refreshed. */
+  effects_range = (was_first ? REQ_RANGE_WORLD
+                   : tech_found_effects_range(tech_found));
+  for (i = 0; i < player_slot_count(); i++) {
+    refresh_cities[i] = TRUE;
+  }
+  players_iterate(aplayer) {
+    refresh_cities[player_index(aplayer)]
+      = tech_found_affects_player(presearch, effects_range, aplayer);
+  } players_iterate_end;
+
   could_switch = create_current_governments_data(presearch);
 
   /* getting tech allows us to change research without applying techpenalty
@@ -469,14 +573,29 @@ void found_new_tech(struct research *presearch, Tech_type_id tech_found,
     }
 
     /* For any player. */
-    /* Update all cities in case the tech changed some effects. This is
-     * inefficient; it could be optimized if it's found to be a problem.
-     * But techs aren't researched that often. */
+    /* Update the cities in case the tech changed some effects. The trade
+     * routes of the changed cities are based on the cities at both ends,
+     * so update their partners too. */
     city_list_iterate(aplayer->cities, apcity) {
-      /* Refresh the city data; this also updates the squared city radius. */
-      city_refresh(apcity);
-      city_refresh_vision(apcity);
-      send_city_info(aplayer, apcity);
+      bool refresh = refresh_cities[i];
+
+      if (!refresh) {
+        trade_partners_iterate(apcity, partner) {
+          if (partner != NULL
+              && refresh_cities[player_index(city_owner(partner))]) {
+            refresh = TRUE;
+            break;
+          }
+        } trade_partners_iterate_end;
+      }
+
+      if (refresh) {
+        /* Refresh the city data; this also updates the squared city
+         * radius. */
+        city_refresh(apcity);
+        city_refresh_vision(apcity);
+        send_city_info(aplayer, apcity);
+      }
     } city_list_iterate_end;
 
     /* Send all player an updated info of the owner of the Marco Polo
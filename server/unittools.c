@@ -1611,6 +1611,9 @@ void transform_unit(struct unit *punit, const struct unit_type *to_unit,
   int old_hp = unit_type_get(punit)->hp;
   int lvls;
 
+  /* The unit may transport other units now. */
+  pf_map_cache_invalidate();
+
   punit->utype = to_unit;
 
   /* New type may not have the same veteran system, and we may want to
@@ -1774,6 +1777,9 @@ bool place_unit(struct unit *punit, struct player *pplayer,
   punit->id = identity_number();
   idex_register_unit(&wld, punit);
 
+  /* The paths around may change. */
+  pf_map_cache_invalidate();
+
   if (ptrans) {
     /* Set transporter for unit. */
     unit_transport_load_tp_status(punit, ptrans, force);
@@ -1854,6 +1860,9 @@ static void server_remove_unit_full(struct unit *punit, bool transported,
   /* The unit is doomed. */
   punit->server.dying = TRUE;
 
+  /* The paths around may change. */
+  pf_map_cache_invalidate();
+
 #if defined(FREECIV_DEBUG) && !defined(FREECIV_NDEBUG)
   unit_list_iterate(ptile->units, pcargo) {
     fc_assert(unit_transport_get(pcargo) != punit);
@@ -3231,6 +3240,7 @@ void unit_transport_load_send(struct unit *punit, struct unit *ptrans)
   } players_iterate_end;
 
   unit_transport_load(punit, ptrans, FALSE);
+  pf_map_cache_invalidate();
 
   players_iterate(pplayer) {
     if (BV_ISSET(can_see_unit, player_index(pplayer))
@@ -3279,6 +3289,7 @@ void unit_transport_unload_send(struct unit *punit)
   fc_assert_ret(ptrans);
 
   unit_transport_unload(punit);
+  pf_map_cache_invalidate();
 
   send_unit_info(NULL, punit);
   send_unit_info(NULL, ptrans);
@@ -3860,6 +3871,9 @@ bool unit_move(struct unit *punit, struct tile *pdesttile, int move_cost,
   psrctile = unit_tile(punit);
   adj = base_get_direction_for_step(&(wld.map), psrctile, pdesttile, &facing);
 
+  /* The paths around both tiles may change. */
+  pf_map_cache_invalidate();
+
   conn_list_do_buffer(game.est_connections);
 
   /* Unload the unit if on a transport. */
@@ -3978,6 +3992,9 @@ bool unit_move(struct unit *punit, struct tile *pdesttile, int move_cost,
     } players_iterate_end;
   } unit_move_data_list_iterate_end;
 
+  /* Do not keep paths computed while the units were moving. */
+  pf_map_cache_invalidate();
+
   /* Check timeout settings. */
   if (current_turn_timeout() != 0 && game.server.timeoutaddenemymove > 0) {
     bool new_information_for_enemy = FALSE;
@@ -328,6 +328,7 @@ void req_edit::req_type_menu(QAction *action)
     selected->source.kind = univ;
     universal_value_initial(&selected->source);
     update_selected();
+    ui->req_vec_changed(req_vector);
   }
 
   refresh();
@@ -345,6 +346,7 @@ void req_edit::req_range_menu(QAction *action)
   if (selected != nullptr) {
     selected->range = range;
     update_selected();
+    ui->req_vec_changed(req_vector);
   }
 
   refresh();
@@ -364,6 +366,7 @@ void req_edit::req_present_menu(QAction *action)
       selected->present = TRUE;
     }
     update_selected();
+    ui->req_vec_changed(req_vector);
   }
 
   refresh();
@@ -380,6 +383,7 @@ void req_edit::univ_value_enum_menu(QAction *action)
     universal_value_from_str(&selected->source, un_bytes.data());
 
     update_selected();
+    ui->req_vec_changed(req_vector);
     refresh();
   }
 }
@@ -398,6 +402,7 @@ void req_edit::univ_value_edit(int value)
                              buf);
 
     update_selected();
+    ui->req_vec_changed(req_vector);
 
     /* No full refresh() with fill_selected()
      * as that would take focus out after every digit user types */
@@ -32,7 +32,10 @@
 #include "registry.h"
 
 // common
+#include "actions.h"
+#include "effects.h"
 #include "game.h"
+#include "improvement.h"
 #include "version.h"
 
 // server
@@ -280,9 +283,49 @@ void ruledit_gui::launch_now()
 **************************************************************************/
 void ruledit_gui::incoming_req_vec_change(const requirement_vector *vec)
 {
+  req_vec_changed(vec);
+
   emit req_vec_may_have_changed(vec);
 }
 
+/**********************************************************************//**
+  Mark the compiled requirements of the effect dirty if they are the
+  changed requirement vector.
+**************************************************************************/
+static bool effect_req_vec_changed_cb(struct effect *peffect, void *data)
+{
+  if (&peffect->reqs == data) {
+    req_program_invalidate(&peffect->reqs_prog);
+  }
+
+  return true;
+}
+
+/**********************************************************************//**
+  A requirement vector has been changed. Mark the compiled requirements
+  of the ruleset item it belongs to dirty, if it has them.
+  @param vec the requirement vector that was changed.
+**************************************************************************/
+void ruledit_gui::req_vec_changed(const requirement_vector *vec)
+{
+  iterate_effect_cache(effect_req_vec_changed_cb, (void *)vec);
+
+  action_enablers_iterate(enabler) {
+    if (&enabler->actor_reqs == vec) {
+      req_program_invalidate(&enabler->actor_reqs_prog);
+    }
+    if (&enabler->target_reqs == vec) {
+      req_program_invalidate(&enabler->target_reqs_prog);
+    }
+  } action_enablers_iterate_end;
+
+  improvement_iterate(pimprove) {
+    if (&pimprove->reqs == vec) {
+      req_program_invalidate(&pimprove->reqs_prog);
+    }
+  } improvement_iterate_end;
+}
+
 /**********************************************************************//**
   Display status message
 **************************************************************************/
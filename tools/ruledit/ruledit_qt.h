@@ -114,6 +114,8 @@ class ruledit_gui : public QObject
     void unregister_effect_edit(class effect_edit *e_edit);
     void refresh_effect_edits();
 
+    void req_vec_changed(const requirement_vector *vec);
+
     struct rule_data data;
 
 signals:
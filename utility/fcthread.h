@@ -66,6 +66,63 @@ extern "C" {
 
 #endif /* FREECIV_HAVE_PTHREAD */
 
+/* Atomic integers, for the flags and counters which threads share without
+ * a mutex. Without C11 atomics they are volatile integers. The loads,
+ * stores and compare-and-swaps which order the memory accesses around
+ * them then take a mutex, and can only be used on fc_atomic_int. The
+ * relaxed additions can get lost. */
+#if defined(FREECIV_HAVE_C11_ATOMICS) && !defined(__cplusplus)
+
+#include <stdatomic.h>
+
+#define fc_atomic_int   atomic_int
+#define fc_atomic_ulong atomic_ulong
+
+#define fc_atomic_init(_obj_, _val_) atomic_init(_obj_, _val_)
+#define fc_atomic_load(_obj_) \
+  atomic_load_explicit(_obj_, memory_order_acquire)
+#define fc_atomic_store(_obj_, _val_) \
+  atomic_store_explicit(_obj_, _val_, memory_order_release)
+#define fc_atomic_load_relaxed(_obj_) \
+  atomic_load_explicit(_obj_, memory_order_relaxed)
+#define fc_atomic_add_relaxed(_obj_, _val_) \
+  atomic_fetch_add_explicit(_obj_, _val_, memory_order_relaxed)
+#define fc_atomic_cas(_obj_, _expected_, _desired_) \
+  atomic_compare_exchange_strong_explicit(_obj_, _expected_, _desired_, \
+                                          memory_order_acq_rel, \
+                                          memory_order_acquire)
+
+#else  /* FREECIV_HAVE_C11_ATOMICS */
+
+#define fc_atomic_int   volatile int
+#define fc_atomic_ulong volatile unsigned long
+
+#define fc_atomic_init(_obj_, _val_) (*(_obj_) = (_val_))
+#define fc_atomic_load(_obj_) fc_atomic_int_load_locked(_obj_)
+#define fc_atomic_store(_obj_, _val_) \
+  fc_atomic_int_store_locked(_obj_, _val_)
+#define fc_atomic_load_relaxed(_obj_) (*(_obj_))
+#define fc_atomic_add_relaxed(_obj_, _val_) (*(_obj_) += (_val_))
+#define fc_atomic_cas(_obj_, _expected_, _desired_) \
+  fc_atomic_int_cas_locked(_obj_, _expected_, _desired_)
+
+#endif /* FREECIV_HAVE_C11_ATOMICS */
+
+/* Storage class of variables with a separate instance in each thread.
+ * Left undefined when there's no thread local storage. */
+#ifdef __cplusplus
+#define fc_thread_local thread_local
+#elif defined(_MSC_VER)
+#define fc_thread_local __declspec(thread)
+#elif defined(FREECIV_HAVE_C11_THREAD_LOCAL)
+#define fc_thread_local _Thread_local
+#endif
+
+/* The fc_atomic_int operations without C11 atomics, in support.c */
+int fc_atomic_int_load_locked(volatile int *obj);
+void fc_atomic_int_store_locked(volatile int *obj, int value);
+bool fc_atomic_int_cas_locked(volatile int *obj, int *expected, int desired);
+
 int fc_thread_start(fc_thread *thread, void (*function) (void *arg), void *arg);
 void fc_thread_wait(fc_thread *thread);
 
@@ -0,0 +1,184 @@
+/***********************************************************************
+ Freeciv - Copyright (C) 1996 - A Kjeldberg, L Gregersen, P Unold
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2, or (at your option)
+   any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <fc_config.h>
+#endif
+
+/* utility */
+#include "fcthread.h"
+#include "log.h"
+#include "mem.h"
+#include "shared.h" /* MAX() */
+
+#include "fcthreadpool.h"
+
+/* A pool of worker threads running batches of jobs. The thread calling
+ * fc_threadpool_run() takes part in the batch, and returns only once all
+ * the jobs are done. The jobs are taken in order, but may finish in any
+ * order, so they must not depend on each other. */
+struct fc_threadpool {
+  int threads_num;              /* Number of worker threads. */
+  fc_thread *threads;
+
+  fc_mutex mutex;               /* Protects all the fields below. */
+  fc_thread_cond work_cond;     /* A batch is started, or quitting. */
+  fc_thread_cond done_cond;     /* The last job of the batch is done. */
+
+  fc_threadpool_job_fn func;
+  void *data;
+  int jobs_num;
+  int next_job;
+  int jobs_done;
+  bool quit;
+};
+
+/*******************************************************************//**
+  Run the jobs of the current batch until there are no more to take.
+  The mutex must be held by the caller; it is released while a job runs.
+***********************************************************************/
+static void fc_threadpool_run_jobs(struct fc_threadpool *pool)
+{
+  while (pool->next_job < pool->jobs_num) {
+    int job = pool->next_job++;
+
+    fc_mutex_release(&pool->mutex);
+    pool->func(pool->data, job);
+    fc_mutex_allocate(&pool->mutex);
+
+    if (++pool->jobs_done == pool->jobs_num) {
+      fc_thread_cond_signal(&pool->done_cond);
+    }
+  }
+}
+
+/*******************************************************************//**
+  Main function of the worker threads.
+***********************************************************************/
+static void fc_threadpool_worker(void *arg)
+{
+  struct fc_threadpool *pool = (struct fc_threadpool *) arg;
+
+  fc_mutex_allocate(&pool->mutex);
+  while (!pool->quit) {
+    fc_threadpool_run_jobs(pool);
+    if (!pool->quit) {
+      fc_thread_cond_wait(&pool->work_cond, &pool->mutex);
+    }
+  }
+  fc_mutex_release(&pool->mutex);
+}
+
+/*******************************************************************//**
+  Create a pool of 'threads_num' worker threads. When there is no
+  support for thread conditions, the pool has no worker at all and
+  the jobs are run by the calling thread.
+***********************************************************************/
+struct fc_threadpool *fc_threadpool_new(int threads_num)
+{
+  struct fc_threadpool *pool = fc_calloc(1, sizeof(*pool));
+  int i;
+
+  if (!has_thread_cond_impl()) {
+    threads_num = 0;
+  }
+
+  fc_mutex_init(&pool->mutex);
+  fc_thread_cond_init(&pool->work_cond);
+  fc_thread_cond_init(&pool->done_cond);
+
+  pool->threads = fc_calloc(MAX(threads_num, 1), sizeof(*pool->threads));
+  for (i = 0; i < threads_num; i++) {
+    if (fc_thread_start(&pool->threads[i], fc_threadpool_worker, pool)) {
+      log_error("Could only start %d of %d pool threads.", i, threads_num);
+      break;
+    }
+  }
+  pool->threads_num = i;
+
+  return pool;
+}
+
+/*******************************************************************//**
+  Stop the worker threads and free the pool. Must not be called while
+  a batch is running.
+***********************************************************************/
+void fc_threadpool_destroy(struct fc_threadpool *pool)
+{
+  int i;
+
+  fc_mutex_allocate(&pool->mutex);
+  pool->quit = TRUE;
+  for (i = 0; i < pool->threads_num; i++) {
+    fc_thread_cond_signal(&pool->work_cond);
+  }
+  fc_mutex_release(&pool->mutex);
+
+  for (i = 0; i < pool->threads_num; i++) {
+    fc_thread_wait(&pool->threads[i]);
+  }
+
+  fc_thread_cond_destroy(&pool->done_cond);
+  fc_thread_cond_destroy(&pool->work_cond);
+  fc_mutex_destroy(&pool->mutex);
+  free(pool->threads);
+  free(pool);
+}
+
+/*******************************************************************//**
+  Return the number of worker threads of the pool.
+***********************************************************************/
+int fc_threadpool_threads(const struct fc_threadpool *pool)
+{
+  return pool->threads_num;
+}
+
+/*******************************************************************//**
+  Run func(data, index) for every index from 0 to jobs_num - 1, shared
+  between the worker threads and the calling thread. Returns when all
+  the jobs are done. 'pool' may be NULL, then all the jobs are run by
+  the calling thread.
+***********************************************************************/
+void fc_threadpool_run(struct fc_threadpool *pool, fc_threadpool_job_fn func,
+                       void *data, int jobs_num)
+{
+  int i;
+
+  if (NULL == pool || 0 == pool->threads_num || 1 >= jobs_num) {
+    for (i = 0; i < jobs_num; i++) {
+      func(data, i);
+    }
+    return;
+  }
+
+  fc_mutex_allocate(&pool->mutex);
+  pool->func = func;
+  pool->data = data;
+  pool->jobs_num = jobs_num;
+  pool->next_job = 0;
+  pool->jobs_done = 0;
+  for (i = 0; i < pool->threads_num && i < jobs_num - 1; i++) {
+    fc_thread_cond_signal(&pool->work_cond);
+  }
+
+  fc_threadpool_run_jobs(pool);
+  while (pool->jobs_done < pool->jobs_num) {
+    fc_thread_cond_wait(&pool->done_cond, &pool->mutex);
+  }
+
+  pool->jobs_num = 0;
+  pool->next_job = 0;
+  pool->func = NULL;
+  pool->data = NULL;
+  fc_mutex_release(&pool->mutex);
+}
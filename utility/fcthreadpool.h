@@ -0,0 +1,40 @@
+/***********************************************************************
+ Freeciv - Copyright (C) 1996 - A Kjeldberg, L Gregersen, P Unold
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2, or (at your option)
+   any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+***********************************************************************/
+#ifndef FC__THREADPOOL_H
+#define FC__THREADPOOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* utility */
+#include "support.h" /* bool */
+
+/* A job of a batch. 'index' is the number of the job in the batch,
+ * from 0 to the number of jobs - 1. */
+typedef void (*fc_threadpool_job_fn)(void *data, int index);
+
+struct fc_threadpool;
+
+struct fc_threadpool *fc_threadpool_new(int threads_num);
+void fc_threadpool_destroy(struct fc_threadpool *pool);
+
+int fc_threadpool_threads(const struct fc_threadpool *pool);
+void fc_threadpool_run(struct fc_threadpool *pool, fc_threadpool_job_fn func,
+                       void *data, int jobs_num);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* FC__THREADPOOL_H */
@@ -537,6 +537,18 @@ size_t genhash_capacity(const struct genhash *pgenhash)
   return pgenhash->num_buckets;
 }
 
+/************************************************************************//**
+  Returns the number of bytes used by the genhash table itself, not
+  counting the memory of the keys and data.
+****************************************************************************/
+size_t genhash_memory_size(const struct genhash *pgenhash)
+{
+  fc_assert_ret_val(NULL != pgenhash, 0);
+  return (sizeof(*pgenhash)
+          + pgenhash->num_buckets * sizeof(*pgenhash->buckets)
+          + pgenhash->num_entries * sizeof(struct genhash_entry));
+}
+
 /************************************************************************//**
   Returns a newly allocated mostly deep copy of the given genhash table.
 ****************************************************************************/
@@ -576,6 +588,24 @@ struct genhash *genhash_copy(const struct genhash *pgenhash)
   return new_genhash;
 }
 
+/************************************************************************//**
+  Returns a new empty genhash table using the same functions as the given
+  one, with room for as many entries as it has. Useful to make deep copies
+  of tables which don't have copy functions.
+****************************************************************************/
+struct genhash *genhash_new_like(const struct genhash *pgenhash)
+{
+  fc_assert_ret_val(NULL != pgenhash, NULL);
+
+  return genhash_new_nentries_full(pgenhash->key_val_func,
+                                   pgenhash->key_comp_func,
+                                   pgenhash->key_copy_func,
+                                   pgenhash->key_free_func,
+                                   pgenhash->data_copy_func,
+                                   pgenhash->data_free_func,
+                                   pgenhash->num_entries);
+}
+
 /************************************************************************//**
   Remove all entries of the genhash table.
 ****************************************************************************/
@@ -76,9 +76,12 @@ void genhash_destroy(struct genhash *pgenhash);
 bool genhash_set_no_shrink(struct genhash *pgenhash, bool no_shrink);
 size_t genhash_size(const struct genhash *pgenhash);
 size_t genhash_capacity(const struct genhash *pgenhash);
+size_t genhash_memory_size(const struct genhash *pgenhash);
 
 struct genhash *genhash_copy(const struct genhash *pgenhash)
                 fc__warn_unused_result;
+struct genhash *genhash_new_like(const struct genhash *pgenhash)
+                fc__warn_unused_result;
 void genhash_clear(struct genhash *pgenhash);
 
 bool genhash_insert(struct genhash *pgenhash, const void *key,
@@ -68,6 +68,12 @@
  * VSNP_BUF_SIZE in support.c so that this still fits in. */
 #define PLAIN_FILE_BUF_SIZE (8096*1024)    // 8096kb
 
+/* The multithreaded xz and zstd encoders compress blocks, respectively
+ * jobs, of this size in parallel. Their default sizes are derived from
+ * the dictionary or window size, and are more than the whole of a typical
+ * savegame, which would leave all but one thread idle. */
+#define ENCODER_MT_BLOCK_SIZE (1024*1024)         /* 1Mb */
+
 #ifdef FREECIV_HAVE_LIBBZ2
 struct bzip2_struct {
   BZFILE *file;
@@ -118,6 +124,7 @@ struct xz_struct {
 
 static bool xz_outbuffer_to_file(fz_FILE *fp, lzma_action action);
 static void xz_action(fz_FILE *fp, lzma_action action);
+static int xz_fill(fz_FILE *fp);
 
 #endif /* FREECIV_HAVE_LIBLZMA */
 
@@ -139,6 +146,11 @@ struct zstd_struct {
 
 #endif /* FREECIV_HAVE_LIBZSTD */
 
+/* Number of threads that compress the files opened for writing, for the
+ * methods that can split their output in independently compressed
+ * blocks. Set with fz_set_compress_threads(). */
+static int compress_threads = 1;
+
 struct mem_fzFILE {
   bool control;
   char *buffer;
@@ -199,6 +211,16 @@ static inline bool fz_method_is_valid(enum fz_method method)
                       method), FZ_PLAIN))
 
 
+/************************************************************************//**
+  Set the number of threads used to compress the files opened for writing
+  after this. Only xz and zstd compression can use several threads; their
+  output can still be read by any decoder, and by a single thread.
+****************************************************************************/
+void fz_set_compress_threads(int threads)
+{
+  compress_threads = MAX(threads, 1);
+}
+
 /************************************************************************//**
   Open memory buffer for reading as fz_FILE.
   If control is TRUE, caller gives up control of the buffer
@@ -434,7 +456,23 @@ fz_FILE *fz_from_file(const char *filename, const char *in_mode,
       /*  xz files are binary files, so we should add "b" to mode! */
       sz_strlcat(mode, "b");
       memset(&fp->u.xz.stream, 0, sizeof(lzma_stream));
-      ret = lzma_easy_encoder(&fp->u.xz.stream, compress_level, LZMA_CHECK_CRC32);
+      ret = LZMA_PROG_ERROR;
+#if LZMA_VERSION >= 50020000
+      if (compress_threads > 1) {
+        lzma_mt mt;
+
+        memset(&mt, 0, sizeof(mt));
+        mt.threads = compress_threads;
+        mt.block_size = ENCODER_MT_BLOCK_SIZE;
+        mt.preset = compress_level;
+        mt.check = LZMA_CHECK_CRC32;
+        ret = lzma_stream_encoder_mt(&fp->u.xz.stream, &mt);
+      }
+#endif /* LZMA_VERSION >= 50020000 */
+      if (ret != LZMA_OK) {
+        /* Single threaded, also if the threads could not be set up. */
+        ret = lzma_easy_encoder(&fp->u.xz.stream, compress_level, LZMA_CHECK_CRC32);
+      }
       fp->u.xz.error = ret;
       if (ret != LZMA_OK) {
         free(fp);
@@ -472,6 +510,15 @@ fz_FILE *fz_from_file(const char *filename, const char *in_mode,
       /* As compress_level parameter is in range 0 - 9, and zstd takes 0 - 22,
        * we scale it a bit */
       ZSTD_initCStream(fp->u.zstd.cstream, compress_level * 2);
+#if ZSTD_VERSION_NUMBER >= 10400
+      if (compress_threads > 1) {
+        /* Fails harmlessly if libzstd was built without threads. */
+        ZSTD_CCtx_setParameter(fp->u.zstd.cstream, ZSTD_c_nbWorkers,
+                               compress_threads);
+        ZSTD_CCtx_setParameter(fp->u.zstd.cstream, ZSTD_c_jobSize,
+                               ENCODER_MT_BLOCK_SIZE);
+      }
+#endif /* ZSTD_VERSION_NUMBER >= 10400 */
 
       fp->u.zstd.in_buf.size = PLAIN_FILE_BUF_SIZE_ZSTD;
       fp->u.zstd.nonconst_in = fc_malloc(fp->u.zstd.in_buf.size);
@@ -599,13 +646,17 @@ int fz_fclose(fz_FILE *fp)
 #ifdef FREECIV_HAVE_LIBZSTD
   case FZ_ZSTD:
     if (fp->mode == 'w') {
-      fp->u.zstd.error = ZSTD_endStream(fp->u.zstd.cstream, &fp->u.zstd.out_buf);
-      while (fp->u.zstd.out_buf.pos > 0) {
-        fwrite(fp->u.zstd.out_buf.dst, 1,
-               fp->u.zstd.out_buf.pos, fp->u.zstd.plain);
-        fp->u.zstd.out_buf.pos = 0;
-        fp->u.zstd.error = ZSTD_flushStream(fp->u.zstd.cstream, &fp->u.zstd.out_buf);
-      }
+      /* With worker threads, the end of the stream may take several
+       * calls even when they produce no output. */
+      do {
+        fp->u.zstd.error = ZSTD_endStream(fp->u.zstd.cstream,
+                                          &fp->u.zstd.out_buf);
+        if (fp->u.zstd.out_buf.pos > 0) {
+          fwrite(fp->u.zstd.out_buf.dst, 1,
+                 fp->u.zstd.out_buf.pos, fp->u.zstd.plain);
+          fp->u.zstd.out_buf.pos = 0;
+        }
+      } while (fp->u.zstd.error > 0 && !ZSTD_isError(fp->u.zstd.error));
       ZSTD_freeCStream(fp->u.zstd.cstream);
     } else {
       ZSTD_freeDStream(fp->u.zstd.dstream);
@@ -647,6 +698,112 @@ int fz_fclose(fz_FILE *fp)
   return 1;
 }
 
+#ifdef FREECIV_HAVE_LIBLZMA
+/************************************************************************//**
+  Decompress more of the xz file to the output buffer, once it has been
+  read. Returns 1 on success, 0 at end-of-file, and -1 on error.
+****************************************************************************/
+static int xz_fill(fz_FILE *fp)
+{
+  size_t len = 0;
+
+  if (fp->u.xz.hack_byte_used) {
+    size_t hblen = 0;
+
+    fp->u.xz.in_buf[0] = fp->u.xz.hack_byte;
+    len = fread(fp->u.xz.in_buf + 1, 1, PLAIN_FILE_BUF_SIZE_XZ - 1,
+                fp->u.xz.plain);
+    len++;
+
+    if (len <= 1) {
+      hblen = fread(&fp->u.xz.hack_byte, 1, 1, fp->u.xz.plain);
+    }
+    if (hblen == 0) {
+      fp->u.xz.hack_byte_used = FALSE;
+    }
+  }
+  if (len == 0) {
+    if (fp->u.xz.error == LZMA_STREAM_END) {
+      return 0;
+    }
+    fp->u.xz.stream.next_out = fp->u.xz.out_buf;
+    fp->u.xz.stream.avail_out = PLAIN_FILE_BUF_SIZE_XZ;
+    xz_action(fp, LZMA_FINISH);
+    fp->u.xz.out_index = 0;
+    fp->u.xz.out_avail =
+      fp->u.xz.stream.total_out - fp->u.xz.total_read;
+  } else {
+    lzma_action action;
+
+    fp->u.xz.stream.next_in = fp->u.xz.in_buf;
+    fp->u.xz.stream.avail_in = len;
+    fp->u.xz.stream.next_out = fp->u.xz.out_buf;
+    fp->u.xz.stream.avail_out = PLAIN_FILE_BUF_SIZE_XZ;
+    if (fp->u.xz.hack_byte_used) {
+      action = LZMA_RUN;
+    } else {
+      action = LZMA_FINISH;
+    }
+    xz_action(fp, action);
+    fp->u.xz.out_avail =
+      fp->u.xz.stream.total_out - fp->u.xz.total_read;
+    fp->u.xz.out_index = 0;
+  }
+
+  if (fp->u.xz.error != LZMA_OK && fp->u.xz.error != LZMA_STREAM_END) {
+    return -1;
+  }
+
+  return 1;
+}
+#endif /* FREECIV_HAVE_LIBLZMA */
+
+#ifdef FREECIV_HAVE_LIBZSTD
+/************************************************************************//**
+  Decompress more of the zstd file to the output buffer, once it has been
+  read. Returns 1 on success, 0 at end-of-file, and -1 on error.
+****************************************************************************/
+static int zstd_fill(fz_FILE *fp)
+{
+  size_t len = 0;
+  int j;
+
+  fp->u.zstd.outbuf_pos = 0;
+
+  if (fp->u.zstd.in_buf.pos != 0) {
+    /* Move in-buffer */
+    for (j = 0; j < fp->u.zstd.in_buf.size - fp->u.zstd.in_buf.pos; j++) {
+      fp->u.zstd.nonconst_in[j] = fp->u.zstd.nonconst_in[j + fp->u.zstd.in_buf.pos];
+    }
+
+    /* Fill in-buffer from plain file */
+    len = fread(fp->u.zstd.nonconst_in + j, 1, fp->u.zstd.in_buf.size - j,
+                fp->u.zstd.plain);
+
+    if (len + j < fp->u.zstd.in_buf.size) {
+      fp->u.zstd.in_buf.size = len + j;
+    }
+  }
+
+  fp->u.zstd.out_buf.pos = 0;
+  fp->u.zstd.in_buf.pos = 0;
+
+  fp->u.zstd.error = ZSTD_decompressStream(fp->u.zstd.dstream,
+                                           &fp->u.zstd.out_buf,
+                                           &fp->u.zstd.in_buf);
+  if (ZSTD_isError(fp->u.zstd.error)) {
+    return -1;
+  }
+
+  if (fp->u.zstd.out_buf.pos == 0 && len == 0) {
+    /* Plain file fully read, and decompression outbuffer drained. */
+    return 0;
+  }
+
+  return 1;
+}
+#endif /* FREECIV_HAVE_LIBZSTD */
+
 /************************************************************************//**
   Get a line, like fgets.
   Returns NULL in case of error, or when end-of-file reached
@@ -696,10 +853,9 @@ char *fz_fgets(char *buffer, int size, fz_FILE *fp)
 #ifdef FREECIV_HAVE_LIBLZMA
   case FZ_XZ:
     {
-      int i, j;
+      int i, j, fill;
 
       for (i = 0; i < size - 1; i += j) {
-        size_t len = 0;
         bool line_end;
 
         for (j = 0, line_end = FALSE; fp->u.xz.out_avail > 0
@@ -718,61 +874,17 @@ char *fz_fgets(char *buffer, int size, fz_FILE *fp)
           return buffer;
         }
 
-        if (fp->u.xz.hack_byte_used) {
-          size_t hblen = 0;
-
-          fp->u.xz.in_buf[0] = fp->u.xz.hack_byte;
-          len = fread(fp->u.xz.in_buf + 1, 1, PLAIN_FILE_BUF_SIZE_XZ - 1,
-                      fp->u.xz.plain);
-          len++;
-
-          if (len <= 1) {
-            hblen = fread(&fp->u.xz.hack_byte, 1, 1, fp->u.xz.plain);
-          }
-          if (hblen == 0) {
-            fp->u.xz.hack_byte_used = FALSE;
-          }
-        }
-        if (len == 0) {
-          if (fp->u.xz.error == LZMA_STREAM_END) {
-            if (i + j == 0) {
-              /* Plain file read complete, and there was nothing in xz buffers
-                 -> end-of-file. */
-              return NULL;
-            }
-            buffer[i + j] = '\0';
-            return buffer;
-          } else {
-            fp->u.xz.stream.next_out = fp->u.xz.out_buf;
-            fp->u.xz.stream.avail_out = PLAIN_FILE_BUF_SIZE_XZ;
-            xz_action(fp, LZMA_FINISH);
-            fp->u.xz.out_index = 0;
-            fp->u.xz.out_avail =
-              fp->u.xz.stream.total_out - fp->u.xz.total_read;
-            if (fp->u.xz.error != LZMA_OK
-                && fp->u.xz.error != LZMA_STREAM_END) {
-              return NULL;
-            }
-          }
-        } else {
-          lzma_action action;
-
-          fp->u.xz.stream.next_in = fp->u.xz.in_buf;
-          fp->u.xz.stream.avail_in = len;
-          fp->u.xz.stream.next_out = fp->u.xz.out_buf;
-          fp->u.xz.stream.avail_out = PLAIN_FILE_BUF_SIZE_XZ;
-          if (fp->u.xz.hack_byte_used) {
-            action = LZMA_RUN;
-          } else {
-            action = LZMA_FINISH;
-          }
-          xz_action(fp, action);
-          fp->u.xz.out_avail =
-            fp->u.xz.stream.total_out - fp->u.xz.total_read;
-          fp->u.xz.out_index = 0;
-          if (fp->u.xz.error != LZMA_OK && fp->u.xz.error != LZMA_STREAM_END) {
+        fill = xz_fill(fp);
+        if (fill == 0) {
+          if (i + j == 0) {
+            /* Plain file read complete, and there was nothing in xz buffers
+               -> end-of-file. */
             return NULL;
           }
+          buffer[i + j] = '\0';
+          return buffer;
+        } else if (fill < 0) {
+          return NULL;
         }
       }
 
@@ -784,12 +896,9 @@ char *fz_fgets(char *buffer, int size, fz_FILE *fp)
 #ifdef FREECIV_HAVE_LIBZSTD
   case FZ_ZSTD:
     {
-      int i;
+      int i, fill;
 
       for (i = 0; i < size - 1;) {
-        int j;
-        size_t len = 0;
-
         while (fp->u.zstd.outbuf_pos < fp->u.zstd.out_buf.pos) {
           buffer[i] = ((char *)fp->u.zstd.out_buf.dst)[fp->u.zstd.outbuf_pos++];
           if (buffer[i] == '\n' || i == size - 2) {
@@ -800,35 +909,13 @@ char *fz_fgets(char *buffer, int size, fz_FILE *fp)
           i++;
         }
 
-        fp->u.zstd.outbuf_pos = 0;
-
-        if (fp->u.zstd.in_buf.pos != 0) {
-          /* Move in-buffer */
-          for (j = 0; j < fp->u.zstd.in_buf.size - fp->u.zstd.in_buf.pos; j++) {
-            fp->u.zstd.nonconst_in[j] = fp->u.zstd.nonconst_in[j + fp->u.zstd.in_buf.pos];
-          }
-
-          /* Fill in-buffer from plain file */
-          len = fread(fp->u.zstd.nonconst_in + j, 1, fp->u.zstd.in_buf.size - j,
-                      fp->u.zstd.plain);
-
-          if (len + j < fp->u.zstd.in_buf.size) {
-            fp->u.zstd.in_buf.size = len + j;
-          }
-        }
-
-        fp->u.zstd.out_buf.pos = 0;
-        fp->u.zstd.in_buf.pos = 0;
-
-        fp->u.zstd.error = ZSTD_decompressStream(fp->u.zstd.dstream,
-                                                 &fp->u.zstd.out_buf,
-                                                 &fp->u.zstd.in_buf);
-        if (ZSTD_isError(fp->u.zstd.error)) {
+        fill = zstd_fill(fp);
+        if (fill < 0) {
           /* zstd error */
           return NULL;
         }
 
-        if (fp->u.zstd.out_buf.pos == 0 && len == 0) {
+        if (fill == 0) {
           /* Plain file fully read, and decompression outbuffer drained. */
           if (i == 0) {
             return NULL;
@@ -929,7 +1016,11 @@ static bool xz_outbuffer_to_file(fz_FILE *fp, lzma_action action)
     }
     fp->u.xz.stream.avail_out = PLAIN_FILE_BUF_SIZE_XZ;
     fp->u.xz.stream.next_out = fp->u.xz.out_buf;
-  } while (fp->u.xz.stream.avail_in > 0);
+    /* When finishing, the encoder may still have output after all the
+     * input has been taken, especially if its threads have blocks in
+     * progress. */
+  } while (fp->u.xz.stream.avail_in > 0
+           || (action == LZMA_FINISH && fp->u.xz.error != LZMA_STREAM_END));
 
   return TRUE;
 }
@@ -1092,6 +1183,221 @@ int fz_fprintf(fz_FILE *fp, const char *format, ...)
   return 0;
 }
 
+/************************************************************************//**
+  Read binary data, like fread() with element size 1.
+
+  Returns number of (uncompressed) bytes actually read. That's less than
+  size only at end-of-file or on error; use fz_ferror() to tell them apart.
+****************************************************************************/
+int fz_fread(void *buffer, int size, fz_FILE *fp)
+{
+  char *out = buffer;
+
+  fc_assert_ret_val(NULL != fp, 0);
+  fc_assert_ret_val(0 <= size, 0);
+
+  if (fp->memory) {
+    int len = MIN(size, fp->u.mem.size - fp->u.mem.pos);
+
+    memcpy(out, fp->u.mem.buffer + fp->u.mem.pos, len);
+    fp->u.mem.pos += len;
+
+    return len;
+  }
+
+  switch (fz_method_validate(fp->method)) {
+#ifdef FREECIV_HAVE_LIBLZMA
+  case FZ_XZ:
+    {
+      int i = 0;
+
+      while (i < size) {
+        int len = MIN(size - i, fp->u.xz.out_avail);
+
+        memcpy(out + i, fp->u.xz.out_buf + fp->u.xz.out_index, len);
+        fp->u.xz.out_index += len;
+        fp->u.xz.out_avail -= len;
+        fp->u.xz.total_read += len;
+        i += len;
+
+        if (i < size && xz_fill(fp) <= 0) {
+          break;
+        }
+      }
+
+      return i;
+    }
+    break;
+#endif /* FREECIV_HAVE_LIBLZMA */
+#ifdef FREECIV_HAVE_LIBZSTD
+  case FZ_ZSTD:
+    {
+      int i = 0;
+
+      while (i < size) {
+        int len = MIN(size - i,
+                      fp->u.zstd.out_buf.pos - fp->u.zstd.outbuf_pos);
+
+        memcpy(out + i,
+               (char *)fp->u.zstd.out_buf.dst + fp->u.zstd.outbuf_pos, len);
+        fp->u.zstd.outbuf_pos += len;
+        i += len;
+
+        if (i < size && zstd_fill(fp) <= 0) {
+          break;
+        }
+      }
+
+      return i;
+    }
+    break;
+#endif /* FREECIV_HAVE_LIBZSTD */
+#ifdef FREECIV_HAVE_LIBBZ2
+  case FZ_BZIP2:
+    {
+      int i = 0;
+
+      /* See if first byte is already read and stored */
+      if (fp->u.bz2.firstbyte >= 0 && size > 0) {
+        out[0] = fp->u.bz2.firstbyte;
+        fp->u.bz2.firstbyte = -1;
+        i++;
+      }
+      while (i < size && !fp->u.bz2.eof) {
+        int last_read = BZ2_bzRead(&fp->u.bz2.error, fp->u.bz2.file,
+                                   out + i, size - i);
+
+        if (fp->u.bz2.error == BZ_STREAM_END) {
+          /* EOF reached. Do not BZ2_bzRead() any more. */
+          fp->u.bz2.eof = TRUE;
+        } else if (fp->u.bz2.error != BZ_OK) {
+          break;
+        }
+        i += last_read;
+      }
+
+      return i;
+    }
+#endif /* FREECIV_HAVE_LIBBZ2 */
+#ifdef FREECIV_HAVE_LIBZ
+  case FZ_ZLIB:
+    {
+      int len = gzread(fp->u.zlib, buffer, (unsigned int)size);
+
+      return MAX(len, 0);
+    }
+#endif /* FREECIV_HAVE_LIBZ */
+  case FZ_PLAIN:
+    return fread(buffer, 1, size, fp->u.plain);
+  }
+
+  /* Should never happen */
+  fc_assert_msg(FALSE, "Internal error in %s() (method = %d)",
+                __FUNCTION__, fp->method);
+  return 0;
+}
+
+/************************************************************************//**
+  Write binary data, like fwrite() with element size 1.
+
+  Returns number of (uncompressed) bytes actually written, or
+  0 on error.
+****************************************************************************/
+int fz_fwrite(const void *buffer, int size, fz_FILE *fp)
+{
+  const char *in = buffer;
+
+  fc_assert_ret_val(NULL != fp, 0);
+  fc_assert_ret_val(!fp->memory, 0);
+  fc_assert_ret_val(0 <= size, 0);
+
+  switch (fz_method_validate(fp->method)) {
+#ifdef FREECIV_HAVE_LIBLZMA
+  case FZ_XZ:
+    {
+      int i;
+
+      for (i = 0; i < size; i += PLAIN_FILE_BUF_SIZE_XZ) {
+        int len = MIN(size - i, PLAIN_FILE_BUF_SIZE_XZ);
+
+        memcpy(fp->u.xz.in_buf, in + i, len);
+        fp->u.xz.stream.next_in = fp->u.xz.in_buf;
+        fp->u.xz.stream.avail_in = len;
+
+        if (!xz_outbuffer_to_file(fp, LZMA_RUN)) {
+          return 0;
+        }
+      }
+
+      return size;
+    }
+    break;
+#endif /* FREECIV_HAVE_LIBLZMA */
+#ifdef FREECIV_HAVE_LIBZSTD
+  case FZ_ZSTD:
+    {
+      int i;
+
+      for (i = 0; i < size; i += PLAIN_FILE_BUF_SIZE_ZSTD) {
+        int num = MIN(size - i, PLAIN_FILE_BUF_SIZE_ZSTD);
+
+        memcpy(fp->u.zstd.nonconst_in, in + i, num);
+        fp->u.zstd.in_buf.pos = 0;
+        fp->u.zstd.in_buf.size = num;
+
+        while (fp->u.zstd.in_buf.pos < fp->u.zstd.in_buf.size) {
+          size_t len;
+
+          fp->u.zstd.error = ZSTD_compressStream(fp->u.zstd.cstream,
+                                                 &fp->u.zstd.out_buf,
+                                                 &fp->u.zstd.in_buf);
+          if (ZSTD_isError(fp->u.zstd.error)) {
+            return 0;
+          }
+
+          if (fp->u.zstd.out_buf.pos > 0) {
+            len = fwrite(fp->u.zstd.out_buf.dst, 1,
+                         fp->u.zstd.out_buf.pos, fp->u.zstd.plain);
+
+            if (len < fp->u.zstd.out_buf.pos) {
+              return 0;
+            }
+
+            fp->u.zstd.out_buf.pos = 0;
+          }
+        }
+      }
+
+      return size;
+    }
+    break;
+#endif /* FREECIV_HAVE_LIBZSTD */
+#ifdef FREECIV_HAVE_LIBBZ2
+  case FZ_BZIP2:
+    BZ2_bzWrite(&fp->u.bz2.error, fp->u.bz2.file, (void *)buffer, size);
+    if (fp->u.bz2.error != BZ_OK) {
+      return 0;
+    } else {
+      return size;
+    }
+#endif /* FREECIV_HAVE_LIBBZ2 */
+#ifdef FREECIV_HAVE_LIBZ
+  case FZ_ZLIB:
+    if (size == 0) {
+      return 0;
+    }
+    return gzwrite(fp->u.zlib, buffer, (unsigned int)size);
+#endif /* FREECIV_HAVE_LIBZ */
+  case FZ_PLAIN:
+    return fwrite(buffer, 1, size, fp->u.plain);
+  }
+
+  /* Should never happen */
+  fc_assert_msg(FALSE, "Internal error in %s() (method = %d)",
+                __FUNCTION__, fp->method);
+  return 0;
+}
+
 /************************************************************************//**
   Return non-zero if there is an error status associated with
   this stream.  Check fz_strerror for details.
@@ -51,6 +51,8 @@ enum fz_method {
 #endif
 };
 
+void fz_set_compress_threads(int threads);
+
 fz_FILE *fz_from_file(const char *filename, const char *in_mode,
                       enum fz_method method, int compress_level);
 fz_FILE *fz_from_stream(FILE *stream);
@@ -59,6 +61,8 @@ int fz_fclose(fz_FILE *fp);
 char *fz_fgets(char *buffer, int size, fz_FILE *fp);
 int fz_fprintf(fz_FILE *fp, const char *format, ...)
      fc__attribute((__format__ (__printf__, 2, 3)));
+int fz_fread(void *buffer, int size, fz_FILE *fp);
+int fz_fwrite(const void *buffer, int size, fz_FILE *fp);
 
 int fz_ferror(fz_FILE *fp);     
 const char *fz_strerror(fz_FILE *fp);
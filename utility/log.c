@@ -20,6 +20,10 @@
 #include <stdio.h>
 #include <string.h>
 
+#ifdef HAVE_PTHREAD_ATFORK
+#include <pthread.h>
+#endif
+
 /* utility */
 #include "deprecations.h"
 #include "fciconv.h"
@@ -42,6 +46,7 @@ static log_callback_fn log_callback = NULL;
 static log_prefix_fn log_prefix = NULL;
 
 static fc_mutex logfile_mutex;
+static bool logfile_mutex_ready = FALSE;
 
 #ifdef FREECIV_DEBUG
 static const enum log_level max_level = LOG_DEBUG;
@@ -236,6 +241,30 @@ out:
 #endif /* FREECIV_DEBUG */
 }
 
+#ifdef HAVE_PTHREAD_ATFORK
+/**********************************************************************//**
+  Called before fork(): hold the logfile mutex across it, so that the
+  child process can't inherit it locked by another thread.
+**************************************************************************/
+static void log_atfork_prepare(void)
+{
+  if (logfile_mutex_ready) {
+    fc_mutex_allocate(&logfile_mutex);
+  }
+}
+
+/**********************************************************************//**
+  Called after fork(), in both the processes: release the logfile mutex
+  held by log_atfork_prepare().
+**************************************************************************/
+static void log_atfork_release(void)
+{
+  if (logfile_mutex_ready) {
+    fc_mutex_release(&logfile_mutex);
+  }
+}
+#endif /* HAVE_PTHREAD_ATFORK */
+
 /**********************************************************************//**
   Initialise the log module. Either 'filename' or 'callback' may be NULL.
   If both are NULL, print to stderr. If both are non-NULL, both callback,
@@ -260,6 +289,19 @@ void log_init(const char *filename, enum log_level initial_level,
   log_prefix = prefix;
   fc_fatal_assertions = fatal_assertions;
   fc_mutex_init(&logfile_mutex);
+
+#ifdef HAVE_PTHREAD_ATFORK
+  {
+    static bool atfork_set = FALSE;
+
+    if (!atfork_set) {
+      pthread_atfork(log_atfork_prepare, log_atfork_release,
+                     log_atfork_release);
+      atfork_set = TRUE;
+    }
+  }
+#endif /* HAVE_PTHREAD_ATFORK */
+  logfile_mutex_ready = TRUE;
   log_verbose("log started");
   log_debug("LOG_DEBUG test");
 }
@@ -269,6 +311,7 @@ void log_init(const char *filename, enum log_level initial_level,
 **************************************************************************/
 void log_close(void)
 {
+  logfile_mutex_ready = FALSE;
   fc_mutex_destroy(&logfile_mutex);
 }
 
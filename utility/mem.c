@@ -26,6 +26,7 @@
 
 /* utility */
 #include "fcintl.h"
+#include "fcthread.h"
 #include "log.h"
 #include "shared.h"             /* TRUE, FALSE */
 
@@ -44,6 +45,43 @@ static void handle_alloc_failure(size_t size, const char *called_as,
   exit(EXIT_FAILURE);
 }
 
+/* Allocation statistics. The counter is only updated while the
+ * statistics are enabled, so that the allocations cost nothing more the
+ * rest of the time. It's a relaxed atomic, so that the threads which
+ * allocate at the same time don't wait for each other. */
+static fc_atomic_int mem_stats_enabled = FALSE;
+static fc_atomic_ulong mem_stats_allocations = 0;
+
+/******************************************************************//**
+  Count an allocation, if the statistics are enabled.
+**********************************************************************/
+static inline void mem_stats_count(void)
+{
+  if (fc_atomic_load_relaxed(&mem_stats_enabled)) {
+    fc_atomic_add_relaxed(&mem_stats_allocations, 1);
+  }
+}
+
+/******************************************************************//**
+  Enable or disable the counting of the allocations made through
+  fc_malloc(), fc_calloc(), fc_realloc() and fc_strdup(). Other threads
+  may be allocating meanwhile. Their allocations around the switch are
+  counted or not.
+**********************************************************************/
+void fc_mem_stats_enable(bool enable)
+{
+  fc_atomic_store(&mem_stats_enabled, enable);
+}
+
+/******************************************************************//**
+  Return the number of allocations counted while the statistics were
+  enabled.
+**********************************************************************/
+unsigned long fc_mem_stats_allocations(void)
+{
+  return fc_atomic_load_relaxed(&mem_stats_allocations);
+}
+
 #ifdef FREECIV_DEBUG
 /******************************************************************//**
   Check the size for sanity.
@@ -90,6 +128,7 @@ void *fc_real_malloc(size_t size,
   if (ptr == NULL) {
     handle_alloc_failure(size, called_as, line, file);
   }
+  mem_stats_count();
 
   return ptr;
 }
@@ -115,6 +154,7 @@ void *fc_real_realloc(void *ptr, size_t size,
   if (!new_ptr) {
     handle_alloc_failure(size, called_as, line, file);
   }
+  mem_stats_count();
 
   return new_ptr;
 }
@@ -61,6 +61,9 @@ char *real_fc_strdup(const char *str,
                      const char *called_as, int line, const char *file)
                      fc__warn_unused_result;
 
+void fc_mem_stats_enable(bool enable);
+unsigned long fc_mem_stats_allocations(void);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
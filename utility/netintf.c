@@ -42,6 +42,9 @@
 #ifdef HAVE_SYS_IOCTL_H
 #include <sys/ioctl.h>
 #endif
+#ifdef HAVE_SYS_UIO_H
+#include <sys/uio.h>
+#endif
 #ifdef HAVE_SIGNAL_H
 #include <signal.h>
 #elif defined(HAVE_SYS_SIGNAL_H)
@@ -180,6 +183,44 @@ int fc_writesocket(int sock, const void *buf, size_t size)
   return result;
 }
 
+/*********************************************************************//**
+  Write several buffers to a socket at once, at most FC_IOV_MAX. Returns
+  the number of bytes written like fc_writesocket(). Where there is no
+  vectored write, only the first buffer is written.
+*************************************************************************/
+int fc_writevsocket(int sock, const struct fc_iovec *iov, int iovcnt)
+{
+#if defined(HAVE_SYS_UIO_H) && !defined(FREECIV_HAVE_WINSOCK)
+  struct iovec vec[FC_IOV_MAX];
+  int i;
+
+  fc_assert_ret_val(0 < iovcnt && FC_IOV_MAX >= iovcnt, -1);
+
+  for (i = 0; i < iovcnt; i++) {
+    vec[i].iov_base = (void *) iov[i].base;
+    vec[i].iov_len = iov[i].len;
+  }
+
+#ifdef MSG_NOSIGNAL
+  {
+    struct msghdr msg;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = vec;
+    msg.msg_iovlen = iovcnt;
+
+    return sendmsg(sock, &msg, MSG_NOSIGNAL);
+  }
+#else  /* MSG_NOSIGNAL */
+  return writev(sock, vec, iovcnt);
+#endif /* MSG_NOSIGNAL */
+#else  /* HAVE_SYS_UIO_H && !FREECIV_HAVE_WINSOCK */
+  fc_assert_ret_val(0 < iovcnt, -1);
+
+  return fc_writesocket(sock, iov[0].base, iov[0].len);
+#endif /* HAVE_SYS_UIO_H && !FREECIV_HAVE_WINSOCK */
+}
+
 /*********************************************************************//**
   Close a socket.
 *************************************************************************/
@@ -84,6 +84,15 @@ union fc_sockaddr {
     TYPED_LIST_ITERATE(union fc_sockaddr, sockaddrlist, paddr)
 #define fc_sockaddr_list_iterate_end  LIST_ITERATE_END
 
+/* Most buffers written at once by fc_writevsocket(). */
+#define FC_IOV_MAX 64
+
+/* A buffer for fc_writevsocket(). */
+struct fc_iovec {
+  const void *base;
+  size_t len;
+};
+
 #ifdef FREECIV_MSWINDOWS
 typedef TIMEVAL fc_timeval;
 #else  /* FREECIV_MSWINDOWS */
@@ -95,6 +104,7 @@ int fc_select(int n, fd_set *readfds, fd_set *writefds, fd_set *exceptfds,
               fc_timeval *timeout);
 int fc_readsocket(int sock, void *buf, size_t size);
 int fc_writesocket(int sock, const void *buf, size_t size);
+int fc_writevsocket(int sock, const struct fc_iovec *iov, int iovcnt);
 void fc_closesocket(int sock);
 
 void fc_nonblock(int sockfd);
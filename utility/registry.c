@@ -45,11 +45,15 @@ void registry_module_close(void)
 }
 
 /*********************************************************************//**
-  Create a section file from a file.  Returns NULL on error.
+  Create a section file from a file, in any of the registry formats.
+  Text files are parsed lazily if requested.  Returns NULL on error.
 *************************************************************************/
-struct section_file *secfile_load(const char *filename,
-                                  bool allow_duplicates)
+static struct section_file *secfile_load_any(const char *filename,
+                                             bool allow_duplicates,
+                                             bool lazy)
 {
+  struct section_file *secfile;
+  bool is_binary;
 #ifdef FREECIV_HAVE_XML_REGISTRY
   struct stat buf;
 
@@ -63,5 +67,34 @@ struct section_file *secfile_load(const char *filename,
   }
 #endif /* FREECIV_HAVE_XML_REGISTRY */
 
+  secfile = binfile_load(filename, allow_duplicates, &is_binary);
+  if (is_binary) {
+    return secfile;
+  }
+
+  if (lazy) {
+    return secfile_load_lazy_text(filename, allow_duplicates);
+  }
+
   return secfile_load_section(filename, NULL, allow_duplicates);
 }
+
+/*********************************************************************//**
+  Create a section file from a file.  Returns NULL on error.
+*************************************************************************/
+struct section_file *secfile_load(const char *filename,
+                                  bool allow_duplicates)
+{
+  return secfile_load_any(filename, allow_duplicates, FALSE);
+}
+
+/*********************************************************************//**
+  Create a section file from a file, parsing the entries of a text
+  file section by section when they are first looked up.  Use it when
+  only a part of a big file is likely to be read.  Returns NULL on error.
+*************************************************************************/
+struct section_file *secfile_load_lazy(const char *filename,
+                                       bool allow_duplicates)
+{
+  return secfile_load_any(filename, allow_duplicates, TRUE);
+}
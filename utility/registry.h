@@ -28,6 +28,8 @@ struct section_file *secfile_new(bool allow_duplicates);
 void secfile_destroy(struct section_file *secfile);
 struct section_file *secfile_load(const char *filename,
                                   bool allow_duplicates);
+struct section_file *secfile_load_lazy(const char *filename,
+                                       bool allow_duplicates);
 
 void secfile_allow_digital_boolean(struct section_file *secfile,
                                    bool allow_digital_boolean);
@@ -36,6 +38,7 @@ const char *secfile_error(void);
 const char *section_name(const struct section *psection);
 
 #include "registry_ini.h"
+#include "registry_bin.h"
 
 #ifdef __cplusplus
 }
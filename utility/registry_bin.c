@@ -0,0 +1,622 @@
+/***********************************************************************
+ Freeciv - Copyright (C) 1996 - A Kjeldberg, L Gregersen, P Unold
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2, or (at your option)
+   any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+***********************************************************************/
+
+/**************************************************************************
+  Binary section file format.
+
+  This is an alternative on-disk representation of a section file, meant
+  for big machine written files like savegames. Nothing needs tokenizing
+  or unescaping when loading it. It is only an encoding of the registry:
+  loading still creates the same sections and entries as the text format,
+  so the loaded file takes as much memory as a loaded text file.
+
+  All numbers are 32 bit unsigned little endian. The file consists of:
+
+  - header: the magic "FCSECBIN", then version, reserved, number of
+    strings, size of the string data, number of sections and number of
+    entries.
+  - string table: one offset per string into the string data, then the
+    string data itself, every string '\0' terminated. All names, string
+    values and comments of the file are stored here once, and referred
+    by their index elsewhere. The table is padded to a multiple of four
+    bytes.
+  - section records: name, special type and number of entries for each
+    section. The entries of the sections follow each other in order.
+  - entry columns: the names, values, comments, types and string flags
+    of all entries, each as an array of its own. Values are the integer,
+    the bits of the float, 0 or 1 for booleans and the string index for
+    the string types. A missing name or comment is BINFILE_NONE.
+
+  Once the file is written, it may be compressed just like the text
+  format. binfile_load() recognizes the file from its magic.
+**************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <fc_config.h>
+#endif
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* utility */
+#include "fcintl.h"
+#include "mem.h"
+#include "registry.h"
+#include "section_file.h"
+#include "shared.h"
+#include "support.h"
+
+#include "registry_bin.h"
+
+#define BINFILE_MAGIC "FCSECBIN"
+#define BINFILE_MAGIC_LEN 8
+#define BINFILE_VERSION 1
+#define BINFILE_HEADER_SIZE (BINFILE_MAGIC_LEN + 6 * 4)
+#define BINFILE_SECTION_SIZE (3 * 4)
+
+#define BINFILE_NONE MAX_UINT32
+
+/* Entry flags. */
+#define BINFILE_ESCAPED    (1 << 0)
+#define BINFILE_RAW        (1 << 1)
+#define BINFILE_GT_MARKING (1 << 2)
+
+#define BINFILE_PAD(size) (((size) + 3) & ~((uint64_t) 3))
+
+#define SPECHASH_TAG binfile_string
+#define SPECHASH_CSTR_KEY_TYPE
+#define SPECHASH_INT_DATA_TYPE
+#include "spechash.h"
+
+/* String table being built when saving. */
+struct binfile_strings {
+  struct binfile_string_hash *hash;
+  const char **strings;
+  int num, alloc;
+  uint32_t size;
+};
+
+/**********************************************************************//**
+  Returns the index of the string in the table, adding it there first
+  if needed.
+**************************************************************************/
+static uint32_t binfile_string_index(struct binfile_strings *strtab,
+                                     const char *str)
+{
+  int idx;
+
+  if (NULL == str) {
+    return BINFILE_NONE;
+  }
+
+  if (binfile_string_hash_lookup(strtab->hash, str, &idx)) {
+    return idx;
+  }
+
+  if (strtab->num == strtab->alloc) {
+    strtab->alloc = MAX(2 * strtab->alloc, 256);
+    strtab->strings = fc_realloc(strtab->strings,
+                                 strtab->alloc * sizeof(*strtab->strings));
+  }
+  idx = strtab->num++;
+  strtab->strings[idx] = str;
+  strtab->size += strlen(str) + 1;
+  binfile_string_hash_insert(strtab->hash, str, idx);
+
+  return idx;
+}
+
+/**********************************************************************//**
+  Write 32 bit values to the file, in little endian byte order.
+**************************************************************************/
+static bool binfile_write_uint32(fz_FILE *fs, const uint32_t *values,
+                                 int count)
+{
+  unsigned char buf[4096];
+  int i = 0;
+
+  while (i < count) {
+    int len = 0;
+
+    for (; i < count && len < (int) sizeof(buf); i++) {
+      buf[len++] = values[i] & 0xFF;
+      buf[len++] = (values[i] >> 8) & 0xFF;
+      buf[len++] = (values[i] >> 16) & 0xFF;
+      buf[len++] = (values[i] >> 24) & 0xFF;
+    }
+    if (fz_fwrite(buf, len, fs) != len) {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+/**********************************************************************//**
+  Write zero bytes to pad the file to a multiple of four bytes, when
+  'size' bytes have been written since the last aligned position.
+**************************************************************************/
+static bool binfile_write_pad(fz_FILE *fs, uint64_t size)
+{
+  static const unsigned char zero[4] = { 0, 0, 0, 0 };
+  int len = BINFILE_PAD(size) - size;
+
+  return 0 == len || fz_fwrite(zero, len, fs) == len;
+}
+
+/**********************************************************************//**
+  Save the section file in the binary format. Compression works as with
+  secfile_save().
+**************************************************************************/
+bool secfile_save_binary(const struct section_file *secfile,
+                         const char *filename, int compression_level,
+                         enum fz_method compression_method)
+{
+  char real_filename[1024];
+  struct binfile_strings strtab;
+  uint32_t header[6];
+  uint32_t *str_offsets, *sections;
+  uint32_t *names, *values, *comments;
+  unsigned char *types, *flags;
+  int num_sections, num_entries, i, n;
+  uint32_t offset;
+  fz_FILE *fs;
+  bool success;
+
+  SECFILE_RETURN_VAL_IF_FAIL(secfile, NULL, NULL != secfile, FALSE);
+
+  if (NULL == filename) {
+    filename = secfile->name;
+  }
+
+  num_sections = section_list_size(secfile->sections);
+  num_entries = 0;
+  section_list_iterate(secfile->sections, psection) {
+    num_entries += entry_list_size(section_entries(psection));
+  } section_list_iterate_end;
+
+  strtab.hash = binfile_string_hash_new();
+  strtab.strings = NULL;
+  strtab.num = strtab.alloc = 0;
+  strtab.size = 0;
+
+  sections = fc_malloc(BINFILE_SECTION_SIZE * MAX(num_sections, 1));
+  names = fc_malloc(sizeof(*names) * MAX(num_entries, 1));
+  values = fc_malloc(sizeof(*values) * MAX(num_entries, 1));
+  comments = fc_malloc(sizeof(*comments) * MAX(num_entries, 1));
+  types = fc_malloc(MAX(num_entries, 1));
+  flags = fc_malloc(MAX(num_entries, 1));
+
+  /* Fill the columns. */
+  i = n = 0;
+  section_list_iterate(secfile->sections, psection) {
+    sections[i++] = binfile_string_index(&strtab, psection->name);
+    sections[i++] = psection->special;
+    sections[i++] = entry_list_size(section_entries(psection));
+
+    entry_list_iterate(section_entries(psection), pentry) {
+      names[n] = binfile_string_index(&strtab, pentry->name);
+      comments[n] = binfile_string_index(&strtab, pentry->comment);
+      types[n] = pentry->type;
+      flags[n] = 0;
+
+      switch (pentry->type) {
+      case ENTRY_BOOL:
+        values[n] = pentry->boolean.value ? 1 : 0;
+        break;
+      case ENTRY_INT:
+        values[n] = (uint32_t) pentry->integer.value;
+        break;
+      case ENTRY_FLOAT:
+        memcpy(&values[n], &pentry->floating.value, sizeof(values[n]));
+        break;
+      case ENTRY_STR:
+        values[n] = binfile_string_index(&strtab, pentry->string.value);
+        flags[n] = (pentry->string.escaped ? BINFILE_ESCAPED : 0)
+                   | (pentry->string.raw ? BINFILE_RAW : 0)
+                   | (pentry->string.gt_marking ? BINFILE_GT_MARKING : 0);
+        break;
+      case ENTRY_FILEREFERENCE:
+        values[n] = binfile_string_index(&strtab, pentry->string.value);
+        break;
+      case ENTRY_LONG_COMMENT:
+        /* The comment is the value. */
+        values[n] = comments[n];
+        comments[n] = BINFILE_NONE;
+        break;
+      case ENTRY_ILLEGAL:
+        fc_assert(pentry->type != ENTRY_ILLEGAL);
+        values[n] = 0;
+        break;
+      }
+      n++;
+    } entry_list_iterate_end;
+  } section_list_iterate_end;
+
+  str_offsets = fc_malloc(sizeof(*str_offsets) * MAX(strtab.num, 1));
+  for (i = 0, offset = 0; i < strtab.num; i++) {
+    str_offsets[i] = offset;
+    offset += strlen(strtab.strings[i]) + 1;
+  }
+
+  header[0] = BINFILE_VERSION;
+  header[1] = 0;
+  header[2] = strtab.num;
+  header[3] = strtab.size;
+  header[4] = num_sections;
+  header[5] = num_entries;
+
+  interpret_tilde(real_filename, sizeof(real_filename), filename);
+  fs = fz_from_file(real_filename, "w",
+                    compression_method, compression_level);
+
+  if (NULL == fs) {
+    SECFILE_LOG(secfile, NULL, _("Could not open %s for writing"),
+                real_filename);
+    success = FALSE;
+  } else {
+    success = (fz_fwrite(BINFILE_MAGIC, BINFILE_MAGIC_LEN, fs)
+               == BINFILE_MAGIC_LEN
+               && binfile_write_uint32(fs, header, ARRAY_SIZE(header))
+               && binfile_write_uint32(fs, str_offsets, strtab.num));
+
+    for (i = 0; success && i < strtab.num; i++) {
+      int len = strlen(strtab.strings[i]) + 1;
+
+      success = (fz_fwrite(strtab.strings[i], len, fs) == len);
+    }
+
+    success = (success
+               && binfile_write_pad(fs, strtab.size)
+               && binfile_write_uint32(fs, sections, 3 * num_sections)
+               && binfile_write_uint32(fs, names, num_entries)
+               && binfile_write_uint32(fs, values, num_entries)
+               && binfile_write_uint32(fs, comments, num_entries)
+               && fz_fwrite(types, num_entries, fs) == num_entries
+               && fz_fwrite(flags, num_entries, fs) == num_entries
+               && binfile_write_pad(fs, 2 * num_entries));
+
+    if (!success) {
+      SECFILE_LOG(secfile, NULL, "Error before closing %s: %s",
+                  real_filename, fz_strerror(fs));
+      fz_fclose(fs);
+    } else if (0 != fz_fclose(fs)) {
+      SECFILE_LOG(secfile, NULL, "Error closing %s", real_filename);
+      success = FALSE;
+    }
+  }
+
+  binfile_string_hash_destroy(strtab.hash);
+  free(strtab.strings);
+  free(str_offsets);
+  free(sections);
+  free(names);
+  free(values);
+  free(comments);
+  free(types);
+  free(flags);
+
+  return success;
+}
+
+/**********************************************************************//**
+  Read a 32 bit little endian value.
+**************************************************************************/
+static inline uint32_t binfile_uint32(const unsigned char *data)
+{
+  return ((uint32_t) data[0]
+          | ((uint32_t) data[1] << 8)
+          | ((uint32_t) data[2] << 16)
+          | ((uint32_t) data[3] << 24));
+}
+
+/**********************************************************************//**
+  Fill the section file from the binary data. Returns FALSE if the data
+  is not a valid binary section file.
+**************************************************************************/
+static bool binfile_parse(struct section_file *secfile,
+                          const unsigned char *data, uint64_t size)
+{
+  uint32_t num_strings, strings_size, num_sections, num_entries;
+  const unsigned char *str_offsets, *str_data, *sections;
+  const unsigned char *names, *values, *comments, *types, *flags;
+  uint64_t offset;
+  uint32_t i, n;
+
+/* The string with the index, or NULL if there's no such string. */
+#define BINFILE_STRING(_idx)                                               \
+  ((_idx) < num_strings                                                    \
+   && binfile_uint32(str_offsets + 4 * (_idx)) < strings_size              \
+   ? (const char *) str_data + binfile_uint32(str_offsets + 4 * (_idx))    \
+   : NULL)
+
+  if (size < BINFILE_HEADER_SIZE
+      || 0 != memcmp(data, BINFILE_MAGIC, BINFILE_MAGIC_LEN)) {
+    SECFILE_LOG(secfile, NULL, "Not a binary section file.");
+    return FALSE;
+  }
+  if (binfile_uint32(data + BINFILE_MAGIC_LEN) != BINFILE_VERSION) {
+    SECFILE_LOG(secfile, NULL, "Unsupported binary format version %u.",
+                binfile_uint32(data + BINFILE_MAGIC_LEN));
+    return FALSE;
+  }
+  num_strings = binfile_uint32(data + BINFILE_MAGIC_LEN + 8);
+  strings_size = binfile_uint32(data + BINFILE_MAGIC_LEN + 12);
+  num_sections = binfile_uint32(data + BINFILE_MAGIC_LEN + 16);
+  num_entries = binfile_uint32(data + BINFILE_MAGIC_LEN + 20);
+
+  offset = BINFILE_HEADER_SIZE;
+  str_offsets = data + offset;
+  offset += 4 * (uint64_t) num_strings;
+  str_data = data + MIN(offset, size);
+  offset = BINFILE_PAD(offset + strings_size);
+  sections = data + MIN(offset, size);
+  offset += BINFILE_SECTION_SIZE * (uint64_t) num_sections;
+  names = data + MIN(offset, size);
+  offset += 4 * (uint64_t) num_entries;
+  values = data + MIN(offset, size);
+  offset += 4 * (uint64_t) num_entries;
+  comments = data + MIN(offset, size);
+  offset += 4 * (uint64_t) num_entries;
+  types = data + MIN(offset, size);
+  offset += num_entries;
+  flags = data + MIN(offset, size);
+  offset += num_entries;
+
+  if (offset > size
+      || (0 < strings_size && '\0' != str_data[strings_size - 1])) {
+    SECFILE_LOG(secfile, NULL, "Truncated or corrupted binary file.");
+    return FALSE;
+  }
+
+  for (i = 0, n = 0; i < num_sections; i++) {
+    const unsigned char *record = sections + BINFILE_SECTION_SIZE * i;
+    const char *name = BINFILE_STRING(binfile_uint32(record));
+    uint32_t special = binfile_uint32(record + 4);
+    uint32_t count = binfile_uint32(record + 8);
+    struct section *psection;
+
+    if (NULL == name || count > num_entries - n
+        || (special != EST_NORMAL && special != EST_INCLUDE
+            && special != EST_COMMENT)) {
+      SECFILE_LOG(secfile, NULL, "Corrupted section record %u.", i);
+      return FALSE;
+    }
+
+    psection = secfile_section_new(secfile, name);
+    if (NULL == psection) {
+      return FALSE;
+    }
+    psection->special = special;
+    if (EST_INCLUDE == special) {
+      secfile->num_includes++;
+    } else if (EST_COMMENT == special) {
+      secfile->num_long_comments++;
+    }
+
+    for (count += n; n < count; n++) {
+      const char *ename = BINFILE_STRING(binfile_uint32(names + 4 * n));
+      uint32_t value = binfile_uint32(values + 4 * n);
+      uint32_t comment = binfile_uint32(comments + 4 * n);
+      const char *str = NULL;
+      struct entry *pentry = NULL;
+
+      if (types[n] == ENTRY_STR || types[n] == ENTRY_FILEREFERENCE
+          || types[n] == ENTRY_LONG_COMMENT) {
+        str = BINFILE_STRING(value);
+        if (NULL == str) {
+          SECFILE_LOG(secfile, psection, "Corrupted entry %u.", n);
+          return FALSE;
+        }
+      }
+      if (NULL == ename && types[n] != ENTRY_LONG_COMMENT) {
+        SECFILE_LOG(secfile, psection, "Corrupted entry %u.", n);
+        return FALSE;
+      }
+
+      switch (types[n]) {
+      case ENTRY_BOOL:
+        pentry = section_entry_bool_new(psection, ename, 0 != value);
+        break;
+      case ENTRY_INT:
+        pentry = section_entry_int_new(psection, ename, (int) value);
+        break;
+      case ENTRY_FLOAT:
+        {
+          float fvalue;
+
+          memcpy(&fvalue, &value, sizeof(fvalue));
+          pentry = section_entry_float_new(psection, ename, fvalue);
+        }
+        break;
+      case ENTRY_STR:
+        pentry = section_entry_str_new(psection, ename, str,
+                                       flags[n] & BINFILE_ESCAPED);
+        if (NULL != pentry) {
+          pentry->string.raw = (flags[n] & BINFILE_RAW);
+          pentry->string.gt_marking = (flags[n] & BINFILE_GT_MARKING);
+        }
+        break;
+      case ENTRY_FILEREFERENCE:
+        pentry = section_entry_filereference_new(psection, ename, str);
+        break;
+      case ENTRY_LONG_COMMENT:
+        pentry = section_entry_comment_new(psection, str);
+        break;
+      }
+
+      if (NULL == pentry) {
+        SECFILE_LOG(secfile, psection, "Corrupted entry %u.", n);
+        return FALSE;
+      }
+
+      if (BINFILE_NONE != comment) {
+        const char *cstr = BINFILE_STRING(comment);
+
+        if (NULL == cstr) {
+          SECFILE_LOG(secfile, psection, "Corrupted entry %u.", n);
+          return FALSE;
+        }
+        entry_set_comment(pentry, cstr);
+      }
+    }
+  }
+
+#undef BINFILE_STRING
+
+  if (n != num_entries) {
+    SECFILE_LOG(secfile, NULL, "Corrupted binary file: %u entries "
+                "outside sections.", num_entries - n);
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**********************************************************************//**
+  Read the rest of a compressed binary file to memory. The magic has
+  already been read. Returns NULL on error.
+**************************************************************************/
+static unsigned char *binfile_read_compressed(fz_FILE *fz, uint64_t *size)
+{
+  int alloc = 1024 * 1024;
+  unsigned char *data = fc_malloc(alloc);
+  int len = BINFILE_MAGIC_LEN;
+
+  memcpy(data, BINFILE_MAGIC, BINFILE_MAGIC_LEN);
+  for (;;) {
+    int got = fz_fread(data + len, alloc - len, fz);
+
+    len += got;
+    if (len < alloc) {
+      break;
+    }
+    if (alloc > MAX_UINT32 / 4) {
+      free(data);
+      return NULL;
+    }
+    alloc *= 2;
+    data = fc_realloc(data, alloc);
+  }
+
+  if (0 != fz_ferror(fz)) {
+    free(data);
+    return NULL;
+  }
+  *size = len;
+
+  return data;
+}
+
+/**********************************************************************//**
+  Load a section file in the binary format. Sets 'is_binary' to tell if
+  the file is a binary section file at all; if it isn't, NULL is returned
+  and the caller should try the other formats. Returns NULL also when
+  a binary file is corrupted.
+**************************************************************************/
+struct section_file *binfile_load(const char *filename,
+                                  bool allow_duplicates, bool *is_binary)
+{
+  char real_filename[1024];
+  char magic[BINFILE_MAGIC_LEN];
+  struct section_file *secfile;
+  unsigned char *data = NULL;
+  uint64_t size = 0;
+  FILE *plain;
+  bool success;
+
+  *is_binary = FALSE;
+
+  if (NULL == filename) {
+    return NULL;
+  }
+  interpret_tilde(real_filename, sizeof(real_filename), filename);
+
+  plain = fc_fopen(real_filename, "rb");
+  if (NULL == plain) {
+    return NULL;
+  }
+
+  if (fread(magic, 1, BINFILE_MAGIC_LEN, plain) == BINFILE_MAGIC_LEN
+      && 0 == memcmp(magic, BINFILE_MAGIC, BINFILE_MAGIC_LEN)) {
+    /* Uncompressed binary file. */
+    long len;
+
+    *is_binary = TRUE;
+
+    if (0 == fseek(plain, 0, SEEK_END) && 0 <= (len = ftell(plain))
+        && 0 == fseek(plain, 0, SEEK_SET)) {
+      data = fc_malloc(MAX(len, 1));
+      size = fread(data, 1, len, plain);
+    }
+    fclose(plain);
+  } else {
+    fz_FILE *fz;
+
+    fclose(plain);
+
+    fz = fz_from_file(real_filename, "r", FZ_PLAIN, 0);
+    if (NULL == fz) {
+      return NULL;
+    }
+    if (fz_fread(magic, BINFILE_MAGIC_LEN, fz) != BINFILE_MAGIC_LEN
+        || 0 != memcmp(magic, BINFILE_MAGIC, BINFILE_MAGIC_LEN)) {
+      /* Not a binary file. */
+      fz_fclose(fz);
+      return NULL;
+    }
+
+    *is_binary = TRUE;
+    data = binfile_read_compressed(fz, &size);
+    fz_fclose(fz);
+  }
+
+  /* Assign the real value later, to speed up the creation of new entries. */
+  secfile = secfile_new(TRUE);
+  secfile->name = fc_strdup(filename);
+
+  if (NULL == data) {
+    SECFILE_LOG(secfile, NULL, "Could not read %s", real_filename);
+    success = FALSE;
+  } else {
+    success = binfile_parse(secfile, data, size);
+  }
+
+  if (success) {
+    /* Build the entry hash table. */
+    secfile->allow_duplicates = allow_duplicates;
+    secfile->hash.entries = entry_hash_new_nentries(secfile->num_entries);
+
+    section_list_iterate(secfile->sections, psection) {
+      entry_list_iterate(psection->entries, pentry) {
+        if (!secfile_hash_insert(secfile, pentry)) {
+          success = FALSE;
+          break;
+        }
+      } entry_list_iterate_end;
+      if (!success) {
+        break;
+      }
+    } section_list_iterate_end;
+  }
+
+  free(data);
+
+  if (!success) {
+    secfile_destroy(secfile);
+    return NULL;
+  }
+
+  return secfile;
+}
@@ -187,45 +187,6 @@ static void entry_to_file(const struct entry *pentry, fz_FILE *fs);
 static void entry_from_inf_token(struct section *psection, const char *name,
                                  const char *tok, struct inputfile *file);
 
-/* An 'entry' is a string, integer, boolean or string vector;
- * See enum entry_type in registry.h.
- */
-struct entry {
-  struct section *psection;     /* Parent section. */
-  char *name;                   /* Name, not including section prefix. */
-  enum entry_type type;         /* The type of the entry. */
-  int used;                     /* Number of times entry looked up. */
-  char *comment;                /* Comment, may be NULL. */
-
-  union {
-    /* ENTRY_BOOL */
-    struct {
-      bool value;
-    } boolean;
-    /* ENTRY_INT */
-    struct {
-      int value;
-    } integer;
-    /* ENTRY_FLOAT */
-    struct {
-      float value;
-    } floating;
-    /* ENTRY_STR */
-    struct {
-      char *value;              /* Malloced string. */
-      bool escaped;             /* " or $. Usually TRUE */
-      bool raw;                 /* Do not add anything. */
-      bool gt_marking;          /* Save with gettext marking. */
-    } string;
-  };
-};
-
-static struct entry *section_entry_filereference_new(struct section *psection,
-                                                     const char *name,
-                                                     const char *value);
-static struct entry *section_entry_comment_new(struct section *psection,
-                                               const char *comment);
-
 /**********************************************************************//**
   Simplification of fileinfoname().
 **************************************************************************/
@@ -253,8 +214,8 @@ static bool is_secfile_entry_name_valid(const char *name)
 /**********************************************************************//**
   Insert an entry into the hash table.  Returns TRUE on success.
 **************************************************************************/
-static bool secfile_hash_insert(struct section_file *secfile,
-                                struct entry *pentry)
+bool secfile_hash_insert(struct section_file *secfile,
+                         struct entry *pentry)
 {
   char buf[256];
   struct entry *hentry;
@@ -298,16 +259,16 @@ static bool secfile_hash_delete(struct section_file *secfile,
 }
 
 /**********************************************************************//**
-  Base function to load a section file.  Note it closes the inputfile.
+  Parse the inputfile into the entries of the section file.  If 'section'
+  is not NULL, only this section is read and returned in 'single_section'.
+  Returns FALSE on error.  Note it closes the inputfile.
 **************************************************************************/
-static struct section_file *secfile_from_input_file(struct inputfile *inf,
-                                                    const char *filename,
-                                                    const char *section,
-                                                    bool allow_duplicates)
+static bool secfile_parse_input_file(struct section_file *secfile,
+                                     struct inputfile *inf,
+                                     const char *section,
+                                     struct section **single_section)
 {
-  struct section_file *secfile;
   struct section *psection = NULL;
-  struct section *single_section = NULL;
   bool table_state = FALSE;     /* TRUE when within tabular format. */
   int table_lineno = 0;         /* Row number in tabular, 0 top data row. */
   const char *tok;
@@ -318,26 +279,8 @@ static struct section_file *secfile_from_input_file(struct inputfile *inf,
   bool found_my_section = FALSE;
   bool error = FALSE;
 
-  if (!inf) {
-    return NULL;
-  }
-
-  /* Assign the real value later, to speed up the creation of new entries. */
-  secfile = secfile_new(TRUE);
-  if (filename) {
-    secfile->name = fc_strdup(filename);
-  } else {
-    secfile->name = NULL;
-  }
-
   astring_vector_init(&columns);
 
-  if (filename) {
-    log_verbose("Reading registry from \"%s\"", filename);
-  } else {
-    log_verbose("Reading registry");
-  }
-
   while (!inf_at_eof(inf)) {
     if (inf_token(inf, INF_TOK_EOL)) {
       continue;
@@ -375,7 +318,7 @@ static struct section_file *secfile_from_input_file(struct inputfile *inf,
         if (!section || strcmp(tok, section) == 0) {
           psection = secfile_section_new(secfile, tok);
           if (section) {
-            single_section = psection;
+            *single_section = psection;
             found_my_section = TRUE;
           }
         }
@@ -546,8 +489,43 @@ END:
   }
   astring_vector_free(&columns);
 
+  return !error;
+}
+
+/**********************************************************************//**
+  Base function to load a section file.  Note it closes the inputfile.
+**************************************************************************/
+static struct section_file *secfile_from_input_file(struct inputfile *inf,
+                                                    const char *filename,
+                                                    const char *section,
+                                                    bool allow_duplicates)
+{
+  struct section_file *secfile;
+  struct section *single_section = NULL;
+  bool error;
+
+  if (!inf) {
+    return NULL;
+  }
+
+  /* Assign the real value later, to speed up the creation of new entries. */
+  secfile = secfile_new(TRUE);
+  if (filename) {
+    secfile->name = fc_strdup(filename);
+  } else {
+    secfile->name = NULL;
+  }
+
+  if (filename) {
+    log_verbose("Reading registry from \"%s\"", filename);
+  } else {
+    log_verbose("Reading registry");
+  }
+
+  error = !secfile_parse_input_file(secfile, inf, section, &single_section);
+
   if (section != NULL) {
-    if (!found_my_section) {
+    if (single_section == NULL) {
       secfile_destroy(secfile);
       return NULL;
     }
@@ -614,6 +592,218 @@ struct section_file *secfile_from_stream(fz_FILE *stream,
                                  NULL, NULL, allow_duplicates);
 }
 
+/**********************************************************************//**
+  Account for a lazily loaded section which doesn't need its text
+  anymore.  The text of the file is released once no section needs it.
+**************************************************************************/
+static void section_lazy_release(struct section *psection)
+{
+  struct section_file *secfile = psection->secfile;
+
+  psection->lazy.pending = FALSE;
+  if (0 == --secfile->lazy.pending) {
+    free(secfile->lazy.buffer);
+    secfile->lazy.buffer = NULL;
+  }
+}
+
+/**********************************************************************//**
+  Create the entries of a lazily loaded section from its text, if not
+  done yet.
+**************************************************************************/
+static void section_lazy_load(struct section *psection)
+{
+  struct section_file *secfile;
+  struct entry_hash *entries;
+  bool allow_duplicates;
+  fz_FILE *fp;
+
+  if (!psection->lazy.pending) {
+    return;
+  }
+
+  secfile = psection->secfile;
+  log_debug("Parsing section [%s] of \"%s\"", psection->name,
+            secfile_name(secfile));
+
+  /* Like secfile_from_input_file(), create the entries first and hash
+   * them after.  Clear the pending flag first, the section header at the
+   * start of the text resolves to this very section. */
+  allow_duplicates = secfile->allow_duplicates;
+  entries = secfile->hash.entries;
+  secfile->allow_duplicates = TRUE;
+  secfile->hash.entries = NULL;
+  psection->lazy.pending = FALSE;
+
+  fp = fz_from_memory(secfile->lazy.buffer + psection->lazy.offset,
+                      psection->lazy.size, FALSE);
+  if (!secfile_parse_input_file(secfile,
+                                inf_from_stream(fp, datafilename),
+                                NULL, NULL)) {
+    /* Like a file which fails to load, the section has no entries then.
+     * The lookups of its entries fail with this error. */
+    psection->lazy.error = fc_strdup(secfile_error());
+    log_error("Failed to parse section [%s] of \"%s\": %s",
+              psection->name, secfile_name(secfile), psection->lazy.error);
+    entry_list_clear(psection->entries);
+  }
+
+  secfile->allow_duplicates = allow_duplicates;
+  secfile->hash.entries = entries;
+  entry_list_iterate(psection->entries, pentry) {
+    secfile_hash_insert(secfile, pentry);
+  } entry_list_iterate_end;
+
+  section_lazy_release(psection);
+}
+
+/**********************************************************************//**
+  Index the sections of the text of a file without parsing their
+  entries.  Returns FALSE if the file can't be loaded lazily: when it
+  includes other files, splits a section, or has entries out of any
+  section.  The string and comment syntax is followed only as far as
+  needed to find the section headers, the sections themselves are
+  checked when parsed.
+**************************************************************************/
+static bool secfile_lazy_index(struct section_file *secfile,
+                               const char *buffer, size_t size)
+{
+  struct section *psection = NULL;
+  char border = '\0';           /* Of the string being read, if any. */
+  size_t pos = 0;
+
+  while (pos < size) {
+    size_t line = pos;
+
+    if ('\0' == border) {
+      if ('\r' == buffer[pos]) {
+        /* Skipped by the inputfile too, for the "\n\r" line ends. */
+        pos++;
+      }
+      if ('[' == buffer[pos]) {
+        const char *start = buffer + pos + 1;
+        const char *end = start;
+        char name[MAX_LEN_SECPATH];
+
+        while (end < buffer + size && '\n' != *end && ']' != *end) {
+          end++;
+        }
+        if (end >= buffer + size || ']' != *end
+            || (size_t) (end - start) >= sizeof(name)) {
+          return FALSE;
+        }
+        /* Not fc_strlcpy(), it would measure the rest of the buffer. */
+        memcpy(name, start, end - start);
+        name[end - start] = '\0';
+        if (!is_secfile_entry_name_valid(name)
+            || NULL != secfile_section_by_name(secfile, name)) {
+          return FALSE;
+        }
+
+        if (NULL != psection) {
+          psection->lazy.size = line - psection->lazy.offset;
+        }
+        psection = secfile_section_new(secfile, name);
+        psection->lazy.offset = line;
+        psection->lazy.pending = TRUE;
+        secfile->lazy.pending++;
+      } else if (0 == strncmp(buffer + pos, "*include", 8)) {
+        return FALSE;
+      } else if (NULL == psection) {
+        while (pos < size && '\n' != buffer[pos] && fc_isspace(buffer[pos])) {
+          pos++;
+        }
+        if (pos < size && '\n' != buffer[pos]
+            && '#' != buffer[pos] && ';' != buffer[pos]) {
+          return FALSE;
+        }
+      }
+    }
+
+    for (; pos < size && '\n' != buffer[pos]; pos++) {
+      char c = buffer[pos];
+
+      if ('\0' != border) {
+        if ('\\' == c && pos + 1 < size && '\n' != buffer[pos + 1]) {
+          pos++;
+        } else if (border == c) {
+          border = '\0';
+        }
+      } else if ('#' == c || ';' == c) {
+        while (pos + 1 < size && '\n' != buffer[pos + 1]) {
+          pos++;
+        }
+      } else if ('"' == c || '\'' == c || '$' == c) {
+        border = c;
+      }
+    }
+    pos++;
+  }
+
+  if (NULL != psection) {
+    psection->lazy.size = size - psection->lazy.offset;
+  }
+
+  return '\0' == border;
+}
+
+/**********************************************************************//**
+  Create a section file from a file, only indexing its sections: the
+  entries of a section are parsed when the section is first accessed,
+  so reading a few sections of a big file costs only the parsing of
+  these.  Falls back to parsing the whole file when it can't be indexed.
+  Returns NULL on error.
+**************************************************************************/
+struct section_file *secfile_load_lazy_text(const char *filename,
+                                            bool allow_duplicates)
+{
+  char real_filename[1024];
+  struct section_file *secfile;
+  fz_FILE *fp;
+  char *buffer;
+  size_t size = 0, alloc = 64 * 1024;
+  int got;
+
+  interpret_tilde(real_filename, sizeof(real_filename), filename);
+  fp = fz_from_file(real_filename, "r", FZ_PLAIN, 0);
+  if (NULL == fp) {
+    return NULL;
+  }
+
+  buffer = fc_malloc(alloc);
+  while (0 < (got = fz_fread(buffer + size, alloc - size - 1, fp))) {
+    size += got;
+    if (size + 1 >= alloc) {
+      alloc *= 2;
+      buffer = fc_realloc(buffer, alloc);
+    }
+  }
+  fz_fclose(fp);
+  buffer[size] = '\0';
+
+  log_verbose("Indexing registry from \"%s\"", filename);
+
+  secfile = secfile_new(allow_duplicates);
+  secfile->name = fc_strdup(filename);
+  if (!secfile_lazy_index(secfile, buffer, size)) {
+    log_verbose("Can't index \"%s\", reading it whole", filename);
+    secfile_destroy(secfile);
+    return secfile_from_input_file(inf_from_stream(fz_from_memory(buffer,
+                                                                  size, TRUE),
+                                                   datafilename),
+                                   filename, NULL, allow_duplicates);
+  }
+
+  secfile->hash.entries = entry_hash_new();
+  if (0 < secfile->lazy.pending) {
+    secfile->lazy.buffer = buffer;
+  } else {
+    free(buffer);
+  }
+
+  return secfile;
+}
+
 /**********************************************************************//**
   Returns TRUE iff the character is legal in a table entry name.
 **************************************************************************/
@@ -1799,6 +1989,16 @@ struct entry *secfile_entry_by_path(const struct section_file *secfile,
     fullpath[len - 2] = '\0';
   }
 
+  if (0 < secfile->lazy.pending
+      && (ent_name = strchr(fullpath, '.'))) {
+    /* The section must be parsed before looking up its entries. */
+    *ent_name = '\0';
+    if ((psection = secfile_section_by_name(secfile, fullpath))) {
+      section_lazy_load(psection);
+    }
+    *ent_name = '.';
+  }
+
   if (NULL != secfile->hash.entries) {
     struct entry *pentry;
 
@@ -1825,6 +2025,43 @@ struct entry *secfile_entry_by_path(const struct section_file *secfile,
   }
 }
 
+/**********************************************************************//**
+  Returns the section of the entry path if it's a lazily loaded section
+  whose entries failed to parse, else NULL.
+**************************************************************************/
+static const struct section *
+secfile_failed_section(const struct section_file *secfile, const char *path)
+{
+  char secname[MAX_LEN_SECPATH];
+  const char *ent_name = strchr(path, '.');
+  const struct section *psection;
+
+  if (NULL == ent_name
+      || (size_t) (ent_name - path) >= sizeof(secname)) {
+    return NULL;
+  }
+  fc_strlcpy(secname, path, ent_name - path + 1);
+  psection = secfile_section_by_name(secfile, secname);
+
+  return (NULL != psection && NULL != psection->lazy.error
+          ? psection : NULL);
+}
+
+/* Report the failed lookup of the entry 'fullpath', with the parse error
+ * of its section if that's the reason. */
+#define SECFILE_LOG_NO_ENTRY(secfile, fullpath)                             \
+  do {                                                                      \
+    const struct section *_failed_ =                                        \
+        secfile_failed_section(secfile, fullpath);                          \
+                                                                            \
+    if (NULL != _failed_) {                                                 \
+      SECFILE_LOG(secfile, _failed_, "\"%s\" entry can't be read: %s",      \
+                  fullpath, _failed_->lazy.error);                          \
+    } else {                                                                \
+      SECFILE_LOG(secfile, NULL, "\"%s\" entry doesn't exist.", fullpath);  \
+    }                                                                       \
+  } while (FALSE)
+
 /**********************************************************************//**
   Delete an entry.
 **************************************************************************/
@@ -1886,7 +2123,7 @@ bool secfile_lookup_bool(const struct section_file *secfile, bool *bval,
   va_end(args);
 
   if (!(pentry = secfile_entry_by_path(secfile, fullpath))) {
-    SECFILE_LOG(secfile, NULL, "\"%s\" entry doesn't exist.", fullpath);
+    SECFILE_LOG_NO_ENTRY(secfile, fullpath);
     return FALSE;
   }
 
@@ -1950,7 +2187,7 @@ bool *secfile_lookup_bool_vec(const struct section_file *secfile,
 
   if (0 == i) {
     /* Doesn't exist. */
-    SECFILE_LOG(secfile, NULL, "\"%s\" entry doesn't exist.", fullpath);
+    SECFILE_LOG_NO_ENTRY(secfile, fullpath);
     return NULL;
   }
 
@@ -1986,7 +2223,7 @@ bool secfile_lookup_int(const struct section_file *secfile, int *ival,
   va_end(args);
 
   if (!(pentry = secfile_entry_by_path(secfile, fullpath))) {
-    SECFILE_LOG(secfile, NULL, "\"%s\" entry doesn't exist.", fullpath);
+    SECFILE_LOG_NO_ENTRY(secfile, fullpath);
     return FALSE;
   }
 
@@ -2097,7 +2334,7 @@ int *secfile_lookup_int_vec(const struct section_file *secfile,
 
   if (0 == i) {
     /* Doesn't exist. */
-    SECFILE_LOG(secfile, NULL, "\"%s\" entry doesn't exist.", fullpath);
+    SECFILE_LOG_NO_ENTRY(secfile, fullpath);
     return NULL;
   }
 
@@ -2133,7 +2370,7 @@ bool secfile_lookup_float(const struct section_file *secfile, float *fval,
   va_end(args);
 
   if (!(pentry = secfile_entry_by_path(secfile, fullpath))) {
-    SECFILE_LOG(secfile, NULL, "\"%s\" entry doesn't exist.", fullpath);
+    SECFILE_LOG_NO_ENTRY(secfile, fullpath);
     return FALSE;
   }
 
@@ -2187,7 +2424,7 @@ const char *secfile_lookup_str(const struct section_file *secfile,
   va_end(args);
 
   if (!(pentry = secfile_entry_by_path(secfile, fullpath))) {
-    SECFILE_LOG(secfile, NULL, "\"%s\" entry doesn't exist.", fullpath);
+    SECFILE_LOG_NO_ENTRY(secfile, fullpath);
     return NULL;
   }
 
@@ -2259,7 +2496,7 @@ const char **secfile_lookup_str_vec(const struct section_file *secfile,
 
   if (0 == i) {
     /* Doesn't exist. */
-    SECFILE_LOG(secfile, NULL, "\"%s\" entry doesn't exist.", fullpath);
+    SECFILE_LOG_NO_ENTRY(secfile, fullpath);
     return NULL;
   }
 
@@ -2303,7 +2540,7 @@ bool secfile_lookup_plain_enum_full(const struct section_file *secfile,
   va_end(args);
 
   if (!(pentry = secfile_entry_by_path(secfile, fullpath))) {
-    SECFILE_LOG(secfile, NULL, "\"%s\" entry doesn't exist.", fullpath);
+    SECFILE_LOG_NO_ENTRY(secfile, fullpath);
     return FALSE;
   }
 
@@ -2398,7 +2635,7 @@ int *secfile_lookup_plain_enum_vec_full(const struct section_file *secfile,
 
   if (0 == i) {
     /* Doesn't exist. */
-    SECFILE_LOG(secfile, NULL, "\"%s\" entry doesn't exist.", fullpath);
+    SECFILE_LOG_NO_ENTRY(secfile, fullpath);
     return NULL;
   }
 
@@ -2445,7 +2682,7 @@ bool secfile_lookup_bitwise_enum_full(const struct section_file *secfile,
   va_end(args);
 
   if (!(pentry = secfile_entry_by_path(secfile, fullpath))) {
-    SECFILE_LOG(secfile, NULL, "\"%s\" entry doesn't exist.", fullpath);
+    SECFILE_LOG_NO_ENTRY(secfile, fullpath);
     return FALSE;
   }
 
@@ -2581,7 +2818,7 @@ int *secfile_lookup_bitwise_enum_vec_full(const struct section_file *secfile,
 
   if (0 == i) {
     /* Doesn't exist. */
-    SECFILE_LOG(secfile, NULL, "\"%s\" entry doesn't exist.", fullpath);
+    SECFILE_LOG_NO_ENTRY(secfile, fullpath);
     return NULL;
   }
 
@@ -2627,7 +2864,7 @@ bool secfile_lookup_enum_data(const struct section_file *secfile,
   va_end(args);
 
   if (!(pentry = secfile_entry_by_path(secfile, fullpath))) {
-    SECFILE_LOG(secfile, NULL, "\"%s\" entry doesn't exist.", fullpath);
+    SECFILE_LOG_NO_ENTRY(secfile, fullpath);
     return FALSE;
   }
 
@@ -2709,7 +2946,7 @@ int secfile_lookup_enum_default_data(const struct section_file *secfile,
   va_end(args);
 
   if (!(pentry = secfile_entry_by_path(secfile, fullpath))) {
-    SECFILE_LOG(secfile, NULL, "\"%s\" entry doesn't exist.", fullpath);
+    SECFILE_LOG_NO_ENTRY(secfile, fullpath);
     return defval;
   }
 
@@ -2797,7 +3034,7 @@ int *secfile_lookup_enum_vec_data(const struct section_file *secfile,
 
   if (0 == i) {
     /* Doesn't exist. */
-    SECFILE_LOG(secfile, NULL, "\"%s\" entry doesn't exist.", fullpath);
+    SECFILE_LOG_NO_ENTRY(secfile, fullpath);
     return NULL;
   }
 
@@ -2951,6 +3188,10 @@ struct section *secfile_section_new(struct section_file *secfile,
   psection->special = EST_NORMAL;
   psection->name = fc_strdup(name);
   psection->entries = entry_list_new_full(entry_destroy);
+  psection->lazy.offset = 0;
+  psection->lazy.size = 0;
+  psection->lazy.pending = FALSE;
+  psection->lazy.error = NULL;
 
   /* Append to secfile. */
   psection->secfile = secfile;
@@ -2997,6 +3238,16 @@ void section_clear_all(struct section *psection)
 {
   SECFILE_RETURN_IF_FAIL(NULL, psection, NULL != psection);
 
+  if (psection->lazy.pending) {
+    /* No need to parse the entries to drop them. */
+    section_lazy_release(psection);
+  }
+  if (NULL != psection->lazy.error) {
+    /* An empty section is a valid one. */
+    free(psection->lazy.error);
+    psection->lazy.error = NULL;
+  }
+
   /* This include the removing of the hash datas. */
   entry_list_clear(psection->entries);
 
@@ -3039,6 +3290,9 @@ bool section_set_name(struct section *psection, const char *name)
     return FALSE;
   }
 
+  /* The text of the section still refers to the old name. */
+  section_lazy_load(psection);
+
   /* Remove old references in the hash tables. */
   if (NULL != secfile->hash.sections) {
     section_hash_remove(secfile->hash.sections, psection->name);
@@ -3072,7 +3326,15 @@ bool section_set_name(struct section *psection, const char *name)
 **************************************************************************/
 const struct entry_list *section_entries(const struct section *psection)
 {
-  return (NULL != psection ? psection->entries : NULL);
+  if (NULL == psection) {
+    return NULL;
+  }
+
+  /* Parsing the entries of a lazily loaded section doesn't change
+   * its contents. */
+  section_lazy_load((struct section *) psection);
+
+  return psection->entries;
 }
 
 /**********************************************************************//**
@@ -3083,7 +3345,7 @@ struct entry *section_entry_by_name(const struct section *psection,
 {
   SECFILE_RETURN_VAL_IF_FAIL(NULL, psection, NULL != psection, NULL);
 
-  entry_list_iterate(psection->entries, pentry) {
+  entry_list_iterate(section_entries(psection), pentry) {
     if (0 == strcmp(entry_name(pentry), name)) {
       entry_use(pentry);
       return pentry;
@@ -3140,6 +3402,9 @@ static struct entry *entry_new(struct section *psection, const char *name)
     return NULL;
   }
 
+  /* Keep the parsed entries first. */
+  section_lazy_load(psection);
+
   if (!is_secfile_entry_name_valid(name) && !long_comment) {
     SECFILE_LOG(secfile, psection, "\"%s\" is not a valid entry name.",
                 name);
@@ -3244,9 +3509,9 @@ struct entry *section_entry_str_new(struct section *psection,
 /**********************************************************************//**
   Returns a new entry of type ENTRY_FILEREFERENCE.
 **************************************************************************/
-static struct entry *section_entry_filereference_new(struct section *psection,
-                                                     const char *name,
-                                                     const char *value)
+struct entry *section_entry_filereference_new(struct section *psection,
+                                              const char *name,
+                                              const char *value)
 {
   struct entry *pentry = entry_new(psection, name);
 
@@ -3261,8 +3526,8 @@ static struct entry *section_entry_filereference_new(struct section *psection,
 /**********************************************************************//**
   Returns a new entry of type ENTRY_LONG_COMMENT.
 **************************************************************************/
-static struct entry *section_entry_comment_new(struct section *psection,
-                                               const char *comment)
+struct entry *section_entry_comment_new(struct section *psection,
+                                        const char *comment)
 {
   struct entry *pentry = entry_new(psection, "#");
 
@@ -3341,6 +3606,42 @@ enum entry_type entry_type_get(const struct entry *pentry)
   return (NULL != pentry ? pentry->type : ENTRY_ILLEGAL);
 }
 
+/**********************************************************************//**
+  Returns whether the two entries have the same type and value.  Their
+  names and comments are not compared.
+**************************************************************************/
+bool entry_equal(const struct entry *pentry1, const struct entry *pentry2)
+{
+  SECFILE_RETURN_VAL_IF_FAIL(NULL, NULL, NULL != pentry1, FALSE);
+  SECFILE_RETURN_VAL_IF_FAIL(NULL, NULL, NULL != pentry2, FALSE);
+
+  if (pentry1->type != pentry2->type) {
+    return FALSE;
+  }
+
+  switch (pentry1->type) {
+  case ENTRY_BOOL:
+    return pentry1->boolean.value == pentry2->boolean.value;
+  case ENTRY_INT:
+    return pentry1->integer.value == pentry2->integer.value;
+  case ENTRY_FLOAT:
+    return pentry1->floating.value == pentry2->floating.value;
+  case ENTRY_STR:
+    if (pentry1->string.escaped != pentry2->string.escaped) {
+      return FALSE;
+    }
+    fc__fallthrough;
+  case ENTRY_FILEREFERENCE:
+    return 0 == strcmp(pentry1->string.value, pentry2->string.value);
+  case ENTRY_LONG_COMMENT:
+    return 0 == strcmp(pentry1->comment, pentry2->comment);
+  case ENTRY_ILLEGAL:
+    break;
+  }
+
+  return FALSE;
+}
+
 /**********************************************************************//**
   Build the entry path.  Returns like snprintf().
 **************************************************************************/
@@ -62,6 +62,8 @@ struct section_file *secfile_load_section(const char *filename,
                                           bool allow_duplicates);
 struct section_file *secfile_from_stream(fz_FILE *stream,
                                          bool allow_duplicates);
+struct section_file *secfile_load_lazy_text(const char *filename,
+                                            bool allow_duplicates);
 
 bool secfile_save(const struct section_file *secfile, const char *filename,
                   int compression_level, enum fz_method compression_method);
@@ -635,6 +637,7 @@ void entry_destroy(struct entry *pentry);
 
 struct section *entry_section(const struct entry *pentry);
 enum entry_type entry_type_get(const struct entry *pentry);
+bool entry_equal(const struct entry *pentry1, const struct entry *pentry2);
 int entry_path(const struct entry *pentry, char *buf, size_t buf_len);
 
 const char *entry_name(const struct entry *pentry);
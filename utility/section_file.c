@@ -86,6 +86,9 @@ struct section_file *secfile_new(bool allow_duplicates)
   /* Maybe allocated later. */
   secfile->hash.entries = NULL;
 
+  secfile->lazy.buffer = NULL;
+  secfile->lazy.pending = 0;
+
   return secfile;
 }
 
@@ -109,6 +112,10 @@ void secfile_destroy(struct section_file *secfile)
 
   section_list_destroy(secfile->sections);
 
+  if (NULL != secfile->lazy.buffer) {
+    free(secfile->lazy.buffer);
+  }
+
   if (NULL != secfile->name) {
     free(secfile->name);
   }
@@ -30,6 +30,45 @@ struct section {
   enum entry_special_type special;
   char *name;                   /* Name of the section. */
   struct entry_list *entries;   /* The list of the children. */
+  struct {
+    size_t offset;              /* Start of the section text in the */
+    size_t size;                /* buffer of a lazily loaded file. */
+    bool pending;               /* Entries not parsed yet. */
+    char *error;                /* Why parsing the entries failed. */
+  } lazy;
+};
+
+/* An 'entry' is a string, integer, boolean or string vector;
+ * See enum entry_type in registry.h.
+ */
+struct entry {
+  struct section *psection;     /* Parent section. */
+  char *name;                   /* Name, not including section prefix. */
+  enum entry_type type;         /* The type of the entry. */
+  int used;                     /* Number of times entry looked up. */
+  char *comment;                /* Comment, may be NULL. */
+
+  union {
+    /* ENTRY_BOOL */
+    struct {
+      bool value;
+    } boolean;
+    /* ENTRY_INT */
+    struct {
+      int value;
+    } integer;
+    /* ENTRY_FLOAT */
+    struct {
+      float value;
+    } floating;
+    /* ENTRY_STR */
+    struct {
+      char *value;              /* Malloced string. */
+      bool escaped;             /* " or $. Usually TRUE */
+      bool raw;                 /* Do not add anything. */
+      bool gt_marking;          /* Save with gettext marking. */
+    } string;
+  };
 };
 
 /* The section file struct itself. */
@@ -48,6 +87,10 @@ struct section_file {
     struct section_hash *sections;
     struct entry_hash *entries;
   } hash;
+  struct {
+    char *buffer;                       /* Text of a lazily loaded file. */
+    int pending;                        /* Sections not parsed yet. */
+  } lazy;
 };
 
 void secfile_log(const struct section_file *secfile,
@@ -83,6 +126,15 @@ void secfile_log(const struct section_file *secfile,
 bool entry_from_token(struct section *psection, const char *name,
                       const char *tok);
 
+bool secfile_hash_insert(struct section_file *secfile,
+                         struct entry *pentry);
+
+struct entry *section_entry_filereference_new(struct section *psection,
+                                              const char *name,
+                                              const char *value);
+struct entry *section_entry_comment_new(struct section *psection,
+                                        const char *comment);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -127,6 +127,8 @@ static fc_mutex vsnprintf_mutex;
 static fc_mutex localtime_mutex;
 #endif /* HAVE_LOCALTIME_R */
 
+static fc_mutex atomic_mutex;
+
 /************************************************************************//**
   Initial allocation of string comparison buffers.
 ****************************************************************************/
@@ -1330,6 +1332,52 @@ struct tm *fc_localtime(const time_t *timep, struct tm *result)
 #endif /* HAVE_LOCALTIME_R */
 }
 
+/************************************************************************//**
+  Load of an fc_atomic_int without C11 atomics. The mutex orders the
+  memory accesses around it.
+****************************************************************************/
+int fc_atomic_int_load_locked(volatile int *obj)
+{
+  int value;
+
+  fc_mutex_allocate(&atomic_mutex);
+  value = *obj;
+  fc_mutex_release(&atomic_mutex);
+
+  return value;
+}
+
+/************************************************************************//**
+  Store to an fc_atomic_int without C11 atomics.
+****************************************************************************/
+void fc_atomic_int_store_locked(volatile int *obj, int value)
+{
+  fc_mutex_allocate(&atomic_mutex);
+  *obj = value;
+  fc_mutex_release(&atomic_mutex);
+}
+
+/************************************************************************//**
+  Compare-and-swap of an fc_atomic_int without C11 atomics: if it holds
+  '*expected', set it to 'desired' and return TRUE. Else put its value in
+  '*expected' and return FALSE.
+****************************************************************************/
+bool fc_atomic_int_cas_locked(volatile int *obj, int *expected, int desired)
+{
+  bool swapped;
+
+  fc_mutex_allocate(&atomic_mutex);
+  swapped = (*obj == *expected);
+  if (swapped) {
+    *obj = desired;
+  } else {
+    *expected = *obj;
+  }
+  fc_mutex_release(&atomic_mutex);
+
+  return swapped;
+}
+
 /************************************************************************//**
   Set quick_exit() callback if possible.
 ****************************************************************************/
@@ -1357,6 +1405,8 @@ void fc_support_init(void)
   fc_mutex_init(&localtime_mutex);
 #endif /* HAVE_LOCALTIME_R */
 
+  fc_mutex_init(&atomic_mutex);
+
   support_initialized = TRUE;
 }
 
@@ -1379,6 +1429,8 @@ void fc_support_free(void)
   fc_mutex_destroy(&localtime_mutex);
 #endif /* HAVE_LOCALTIME_R */
 
+  fc_mutex_destroy(&atomic_mutex);
+
   fc_strAPI_free();
 }
 